@@ -138,6 +138,8 @@ struct ns_clientmgr {
 	/* Lock covers manager state. */
 	isc_mutex_t			lock;
 	isc_boolean_t			exiting;
+	int				node;	      /*%< NUMA node, or -1 */
+	unsigned int			nexthome;     /*%< Next local worker */
 
 	/* Lock covers the clients list */
 	isc_mutex_t			listlock;
@@ -680,8 +682,11 @@ ns_client_endrequest(ns_client_t *client) {
 		client->next = NULL;
 	}
 
-	if (client->view != NULL)
+	if (client->view != NULL) {
+		dns_dampening_flush(client->view->dampening,
+				    &client->dampening, client->now);
 		dns_view_detach(&client->view);
+	}
 	if (client->opt != NULL) {
 		INSIST(dns_rdataset_isassociated(client->opt));
 		dns_rdataset_disassociate(client->opt);
@@ -739,6 +744,33 @@ ns_client_next(ns_client_t *client, isc_result_t result) {
 }
 
 
+/*%
+ * Count the time from the arrival of a query to the completion of its
+ * response in the view's latency histograms.
+ */
+static void
+client_latency(ns_client_t *client) {
+	dns_latencysource_t source;
+	isc_time_t now;
+
+	if (client->view == NULL || client->view->latencystats == NULL ||
+	    client->message == NULL ||
+	    client->message->opcode != dns_opcode_query)
+		return;
+
+	if ((client->attributes & NS_CLIENTATTR_RECURSED) != 0)
+		source = dns_latencysource_recursion;
+	else if ((client->message->flags & DNS_MESSAGEFLAG_AA) != 0)
+		source = dns_latencysource_auth;
+	else
+		source = dns_latencysource_cache;
+
+	TIME_NOW(&now);
+	dns_latencystats_record(client->view->latencystats, source,
+				client->message->rcode,
+				isc_time_microdiff(&now, &client->starttime));
+}
+
 static void
 client_senddone(isc_task_t *task, isc_event_t *event) {
 	ns_client_t *client;
@@ -760,6 +792,8 @@ client_senddone(isc_task_t *task, isc_event_t *event) {
 			      NS_LOGMODULE_CLIENT, ISC_LOG_WARNING,
 			      "error sending response: %s",
 			      isc_result_totext(sevent->result));
+	else
+		client_latency(client);
 
 	INSIST(client->nsends > 0);
 	client->nsends--;
@@ -933,10 +967,11 @@ ns_client_sendraw(ns_client_t *client, dns_message_t *message) {
 		goto done;
 	}
 
-        if (client->view != NULL && client->view->dampening != NULL)
+	if (client->view != NULL && client->view->dampening != NULL)
 		dns_dampening_score_size(client->view->dampening,
 					 &client->peeraddr,
-					 client->now, mr->length);
+					 client->now, mr->length,
+					 &client->dampening);
 
 	result = client_allocsendbuf(client, &buffer, NULL, mr->length,
 				     sendbuf, &data);
@@ -1119,8 +1154,18 @@ client_send(ns_client_t *client) {
 		isc_buffer_putuint16(&tcpbuffer, (isc_uint16_t) r.length);
 		isc_buffer_add(&tcpbuffer, r.length);
 		result = client_sendpkg(client, &tcpbuffer);
-	} else
+	} else {
+		if (client->dampening.damp != NULL &&
+		    client->view != NULL &&
+		    client->dampening.damp == client->view->dampening) {
+			isc_buffer_usedregion(&buffer, &r);
+			dns_dampening_score_size(client->view->dampening,
+						 &client->peeraddr,
+						 client->now, r.length,
+						 &client->dampening);
+		}
 		result = client_sendpkg(client, &buffer);
+	}
 
 	/* update statistics (XXXJT: is it okay to access message->xxxkey?) */
 	isc_stats_increment(ns_g_server->nsstats, dns_nsstatscounter_response);
@@ -1809,6 +1854,112 @@ process_opt(ns_client_t *client, dns_rdataset_t *opt) {
 	return (result);
 }
 
+/*
+ * Return ISC_TRUE if matching 'acl' can depend on the TSIG key.
+ */
+static isc_boolean_t
+acl_haskeys(dns_acl_t *acl) {
+	unsigned int i;
+
+	if (acl == NULL)
+		return (ISC_FALSE);
+	for (i = 0; i < acl->length; i++) {
+		if (acl->elements[i].type == dns_aclelementtype_keyname)
+			return (ISC_TRUE);
+		if (acl->elements[i].type == dns_aclelementtype_nestedacl &&
+		    acl_haskeys(acl->elements[i].nestedacl))
+			return (ISC_TRUE);
+	}
+	return (ISC_FALSE);
+}
+
+/*
+ * Find the view a UDP request in 'buffer' will be matched to, without
+ * parsing it.  The class and the RD flag are read from the header and the
+ * question.  A view whose ACLs refer to keys can only be decided if the
+ * request has no additional records, i.e. no TSIG.  Return NULL if the
+ * view cannot be determined this way.
+ */
+static dns_view_t *
+early_view(ns_client_t *client, isc_buffer_t *buffer) {
+	dns_view_t *view;
+	dns_rdataclass_t rdclass;
+	isc_netaddr_t netsrc, netdst;
+	isc_boolean_t rd, tsig;
+	unsigned char *p;
+	unsigned int length, n;
+
+	p = isc_buffer_current(buffer);
+	length = isc_buffer_remaininglength(buffer);
+	if (length < DNS_MESSAGE_HEADERLEN ||
+	    (p[2] & 0x80) != 0 ||			/* QR */
+	    p[4] != 0 || p[5] != 1)			/* QDCOUNT */
+		return (NULL);
+	rd = ISC_TF((p[2] & 0x01) != 0);
+	tsig = ISC_TF(p[10] != 0 || p[11] != 0);	/* ARCOUNT */
+
+	/* Skip the uncompressed query name. */
+	for (n = DNS_MESSAGE_HEADERLEN; n < length && p[n] != 0; n += p[n] + 1)
+		if ((p[n] & 0xc0) != 0)
+			return (NULL);
+	if (n + 5 > length)
+		return (NULL);
+	rdclass = (p[n + 3] << 8) | p[n + 4];
+
+	if ((client->interface->flags & NS_INTERFACEFLAG_ANYADDR) == 0)
+		isc_netaddr_fromsockaddr(&netdst, &client->interface->addr);
+	else if (client->interface->addr.type.sa.sa_family == AF_INET6 &&
+		 (client->attributes & NS_CLIENTATTR_PKTINFO) != 0) {
+		isc_netaddr_fromin6(&netdst, &client->pktinfo.ipi6_addr);
+		if (IN6_IS_ADDR_LINKLOCAL(&client->pktinfo.ipi6_addr))
+			isc_netaddr_setzone(&netdst,
+					    client->pktinfo.ipi6_ifindex);
+	} else
+		return (NULL);
+	isc_netaddr_fromsockaddr(&netsrc, &client->peeraddr);
+
+	for (view = ISC_LIST_HEAD(ns_g_server->viewlist);
+	     view != NULL;
+	     view = ISC_LIST_NEXT(view, link)) {
+		if (rdclass != view->rdclass &&
+		    rdclass != dns_rdataclass_any)
+			continue;
+		if (tsig && (acl_haskeys(view->matchclients) ||
+			     acl_haskeys(view->matchdestinations)))
+			return (NULL);
+		if (allowed(&netsrc, NULL, view->matchclients) &&
+		    allowed(&netdst, NULL, view->matchdestinations) &&
+		    !(!rd && view->matchrecursiveonly))
+			return (view);
+	}
+	return (NULL);
+}
+
+/*
+ * Count a request as local to the NUMA node of the network device it
+ * came in on, or remote from it, depending on the node of the worker
+ * which handles it.  Nothing is counted unless the nodes of both are
+ * known, which needs the workers to be bound to processors.
+ */
+static void
+count_numa(ns_client_t *client) {
+	int *nodes = ns_g_server->workernodes;
+	int node = client->interface->numanode;
+	int worker;
+
+	if (node < 0 || node >= NS_NUMA_MAXNODES || nodes == NULL)
+		return;
+	worker = isc_taskmgr_currentworker();
+	if (worker < 0 || (unsigned int)worker >= ns_g_cpus ||
+	    nodes[worker] < 0)
+		return;
+	isc_stats_increment(ns_g_server->numastats,
+			    ns_numastatscounter(node,
+				nodes[worker] == node ?
+				ns_numastatscounter_local :
+				ns_numastatscounter_remote));
+}
+
 /*
  * Handle an incoming request event from the socket (UDP case)
  * or tcpmsg (TCP case).
@@ -1889,6 +2040,7 @@ client_request(isc_task_t *task, isc_event_t *event) {
 
 	isc_task_getcurrenttime(task, &client->requesttime);
 	client->now = client->requesttime;
+	TIME_NOW(&client->starttime);
 
 	if (result != ISC_R_SUCCESS) {
 		if (TCP_CLIENT(client)) {
@@ -1943,6 +2095,28 @@ client_request(isc_task_t *task, isc_event_t *event) {
 			ns_client_next(client, ISC_R_SUCCESS);
 			goto cleanup;
 		}
+
+		/*
+		 * Drop queries of dampened prefixes before they are parsed,
+		 * if the view handling them suppresses the prefix.  The
+		 * view is only looked for if some view suppresses it.
+		 */
+		if (ns_g_server->dampfilter != NULL &&
+		    dns_dampening_filter_lookup(ns_g_server->dampfilter,
+						&client->peeraddr,
+						client->now) &&
+		    (view = early_view(client, buffer)) != NULL &&
+		    view->dampening != NULL &&
+		    dns_dampening_filter_check(ns_g_server->dampfilter,
+					       view->dampening,
+					       &client->peeraddr,
+					       client->now))
+		{
+			isc_stats_increment(ns_g_server->nsstats,
+					    dns_nsstatscounter_dampened);
+			ns_client_next(client, DNS_R_DROP);
+			goto cleanup;
+		}
 	}
 
 	/*
@@ -1997,6 +2171,7 @@ client_request(isc_task_t *task, isc_event_t *event) {
 	if (TCP_CLIENT(client))
 		isc_stats_increment(ns_g_server->nsstats,
 				    dns_nsstatscounter_requesttcp);
+	count_numa(client);
 
 	/*
 	 * It's a request.  Parse it.
@@ -2405,6 +2580,8 @@ get_clientmctx(ns_clientmgr_t *manager, isc_mem_t **mctxp) {
 		if (result != ISC_R_SUCCESS)
 			return (result);
 		isc_mem_setname(clientmctx, "client", NULL);
+		if (manager->node >= 0)
+			(void)isc_mem_setnode(clientmctx, manager->node);
 
 		manager->mctxpool[nextmctx] = clientmctx;
 	}
@@ -2502,6 +2679,7 @@ client_create(ns_clientmgr_t *manager, ns_client_t **clientp) {
 	client->nctls = 0;
 	client->references = 0;
 	client->attributes = 0;
+	isc_time_settoepoch(&client->starttime);
 	client->view = NULL;
 	client->dispatch = NULL;
 	client->udpsocket = NULL;
@@ -2524,6 +2702,7 @@ client_create(ns_clientmgr_t *manager, ns_client_t **clientp) {
 	client->recursionquota = NULL;
 	client->interface = NULL;
 	client->peeraddr_valid = ISC_FALSE;
+	dns_dampening_handle_init(&client->dampening);
 #ifdef ALLOW_FILTER_AAAA
 	client->filter_aaaa = dns_aaaa_ok;
 #endif
@@ -2894,6 +3073,8 @@ ns_clientmgr_create(isc_mem_t *mctx, isc_taskmgr_t *taskmgr,
 	manager->taskmgr = taskmgr;
 	manager->timermgr = timermgr;
 	manager->exiting = ISC_FALSE;
+	manager->node = -1;
+	manager->nexthome = 0;
 	ISC_LIST_INIT(manager->clients);
 	ISC_LIST_INIT(manager->recursing);
 	ISC_QUEUE_INIT(manager->inactive, ilink);
@@ -2922,6 +3103,15 @@ ns_clientmgr_create(isc_mem_t *mctx, isc_taskmgr_t *taskmgr,
 	return (result);
 }
 
+void
+ns_clientmgr_setnode(ns_clientmgr_t *manager, int node) {
+	REQUIRE(VALID_MANAGER(manager));
+
+	LOCK(&manager->lock);
+	manager->node = node;
+	UNLOCK(&manager->lock);
+}
+
 void
 ns_clientmgr_destroy(ns_clientmgr_t **managerp) {
 	isc_result_t result;
@@ -2963,6 +3153,43 @@ ns_clientmgr_destroy(ns_clientmgr_t **managerp) {
 	*managerp = NULL;
 }
 
+/*
+ * Return the index of 'disp' among the UDP listeners of 'ifp'.
+ */
+static unsigned int
+dispatch_index(ns_interface_t *ifp, dns_dispatch_t *disp) {
+	int i;
+
+	for (i = 0; i < ifp->nudpdispatch; i++)
+		if (ifp->udpdispatch[i] == disp)
+			return (i);
+	return (0);
+}
+
+/*
+ * Return the 'n'th (modulo their number) of the task workers bound to a
+ * processor on the NUMA node of the network device of 'ifp', or -1 if
+ * there is none.
+ */
+static int
+node_worker(ns_interface_t *ifp, unsigned int n) {
+	int *nodes = ns_g_server->workernodes;
+	unsigned int i, count = 0;
+
+	if (ifp->numanode < 0 || nodes == NULL)
+		return (-1);
+	for (i = 0; i < ns_g_cpus; i++)
+		if (nodes[i] == ifp->numanode)
+			count++;
+	if (count == 0)
+		return (-1);
+	n %= count;
+	for (i = 0; i < ns_g_cpus; i++)
+		if (nodes[i] == ifp->numanode && n-- == 0)
+			break;
+	return ((int)i);
+}
+
 static isc_result_t
 get_client(ns_clientmgr_t *manager, ns_interface_t *ifp,
 	   dns_dispatch_t *disp, isc_boolean_t tcp)
@@ -2970,6 +3197,9 @@ get_client(ns_clientmgr_t *manager, ns_interface_t *ifp,
 	isc_result_t result = ISC_R_SUCCESS;
 	isc_event_t *ev;
 	ns_client_t *client;
+	isc_boolean_t reuseport = ISC_FALSE;
+	unsigned int n;
+	int home;
 	MTRACE("get client");
 
 	REQUIRE(manager != NULL);
@@ -3018,7 +3248,30 @@ get_client(ns_clientmgr_t *manager, ns_interface_t *ifp,
 		dns_dispatch_attach(disp, &client->dispatch);
 		sock = dns_dispatch_getsocket(client->dispatch);
 		isc_socket_attach(sock, &client->udpsocket);
+		reuseport = ISC_TF((dns_dispatch_getattributes(disp) &
+				    DNS_DISPATCHATTR_REUSEPORT) != 0);
+	}
+
+	/*
+	 * There is a SO_REUSEPORT listener per worker thread; run the
+	 * clients of the listener N on the Nth worker, so every worker
+	 * serves one socket of its own.  If the workers are bound to
+	 * processors and the interface's network device is on a NUMA
+	 * node, only the workers of that node are counted, and the other
+	 * clients of the interface are spread over them as well.
+	 */
+	if (reuseport)
+		n = dispatch_index(ifp, disp);
+	else {
+		LOCK(&manager->lock);
+		n = manager->nexthome++;
+		UNLOCK(&manager->lock);
 	}
+	home = node_worker(ifp, n);
+	if (home >= 0)
+		isc_task_sethome(client->task, (unsigned int)home);
+	else if (reuseport)
+		isc_task_sethome(client->task, n);
 
 	INSIST(client->nctls == 0);
 	client->nctls++;
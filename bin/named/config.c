@@ -63,6 +63,7 @@ options {\n\
 "#	session-keyfile \"" NS_LOCALSTATEDIR "/run/named/session.key\";\n\
 	session-keyname local-ddns;\n\
 	session-keyalg hmac-sha256;\n\
+	dampening-early-drop no;\n\
 	deallocate-on-exit true;\n\
 #	directory <none>\n\
 	dump-file \"named_dump.db\";\n\
@@ -70,6 +71,7 @@ options {\n\
 	has-old-clients false;\n\
 	heartbeat-interval 60;\n\
 	host-statistics no;\n\
+	huge-pages no;\n\
 	interface-interval 60;\n\
 	listen-on {any;};\n\
 	listen-on-v6 {any;};\n\
@@ -93,6 +95,7 @@ options {\n\
 "\
 	recursive-clients 1000;\n\
 	resolver-query-timeout 10;\n\
+	reuseport no;\n\
 	rrset-order { order random; };\n\
 	serial-queries 20;\n\
 	serial-query-rate 20;\n\
@@ -108,6 +111,7 @@ options {\n\
 	transfers-in 10;\n\
 	transfers-out 10;\n\
 	treat-cr-as-space true;\n\
+	udp-receive-batch 1;\n\
 	use-id-pool true;\n\
 	use-ixfr true;\n\
 	edns-udp-size 4096;\n\
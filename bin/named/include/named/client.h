@@ -67,7 +67,9 @@
 #include <isc/stdtime.h>
 #include <isc/quota.h>
 #include <isc/queue.h>
+#include <isc/time.h>
 
+#include <dns/dampening.h>
 #include <dns/db.h>
 #include <dns/fixedname.h>
 #include <dns/name.h>
@@ -131,6 +133,8 @@ struct ns_client {
 	ns_query_t		query;
 	isc_stdtime_t		requesttime;
 	isc_stdtime_t		now;
+	isc_time_t		starttime;    /*%< for latency statistics */
+	dns_dampening_handle_t	dampening;    /*%< resolved on query start */
 	dns_name_t		signername;   /*%< [T]SIG key name */
 	dns_name_t *		signer;	      /*%< NULL if not valid sig */
 	isc_boolean_t		mortal;	      /*%< Die after handling request */
@@ -187,6 +191,7 @@ typedef ISC_LIST(ns_client_t) client_list_t;
 #define NS_CLIENTATTR_WANTEXPIRE	0x0800 /*%< return seconds to expire */
 #define NS_CLIENTATTR_HAVEEXPIRE	0x1000 /*%< return seconds to expire */
 #define NS_CLIENTATTR_WANTOPT		0x2000 /*%< add opt to reply */
+#define NS_CLIENTATTR_RECURSED		0x4000 /*%< answer needed a fetch */
 
 extern unsigned int ns_client_requests;
 
@@ -270,6 +275,13 @@ ns_clientmgr_create(isc_mem_t *mctx, isc_taskmgr_t *taskmgr,
  * Create a client manager.
  */
 
+void
+ns_clientmgr_setnode(ns_clientmgr_t *manager, int node);
+/*%
+ * Take the memory of the clients of 'manager' created from now on from
+ * NUMA node 'node', or let the system place it if 'node' is -1.
+ */
+
 void
 ns_clientmgr_destroy(ns_clientmgr_t **managerp);
 /*%
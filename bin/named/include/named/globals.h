@@ -156,6 +156,9 @@ EXTERN const char *		ns_g_engine		INIT(NULL);
 #endif
 
 EXTERN int			ns_g_listen		INIT(3);
+EXTERN unsigned int		ns_g_udpbatch		INIT(1);
+EXTERN isc_boolean_t		ns_g_reuseport		INIT(ISC_FALSE);
+EXTERN isc_boolean_t		ns_g_hugepages		INIT(ISC_FALSE);
 EXTERN isc_time_t		ns_g_boottime;
 EXTERN isc_time_t		ns_g_configtime;
 EXTERN isc_boolean_t		ns_g_memstatistics	INIT(ISC_FALSE);
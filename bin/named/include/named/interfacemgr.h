@@ -77,6 +77,8 @@ struct ns_interface {
 	isc_sockaddr_t		addr;           /*%< Address and port. */
 	unsigned int		flags;		/*%< Interface characteristics */
 	char 			name[32];	/*%< Null terminated. */
+	int			numanode;	/*%< NUMA node of the network
+						     device, or -1 */
 	dns_dispatch_t *	udpdispatch[MAX_UDP_DISPATCH];
 						/*%< UDP dispatchers. */
 	isc_socket_t *		tcpsocket;	/*%< TCP socket. */
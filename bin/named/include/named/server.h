@@ -30,6 +30,7 @@
 #include <isc/xml.h>
 
 #include <dns/acl.h>
+#include <dns/dampening.h>
 #include <dns/types.h>
 
 #include <named/types.h>
@@ -53,6 +54,8 @@ struct ns_server {
 	isc_quota_t		tcpquota;
 	isc_quota_t		recursionquota;
 	dns_acl_t		*blackholeacl;
+	dns_dampening_filter_t	*dampfilter;	/*%< Early dampening drop */
+	dns_dampening_t		*dampstore;	/*%< Shared dampening table */
 	char *			statsfile;	/*%< Statistics file name */
 	char *			dumpfile;	/*%< Dump file name */
 	char *			secrootsfile;	/*%< Secroots file name */
@@ -101,6 +104,7 @@ struct ns_server {
 	isc_stats_t *		zonestats;	/*% Zone management stats */
 	isc_stats_t  *		resolverstats;	/*% Resolver stats */
 	isc_stats_t *		sockstats;	/*%< Socket stats */
+	isc_stats_t *		numastats;	/*%< Per NUMA node stats */
 
 	ns_controls_t *		controls;	/*%< Control channels */
 	unsigned int		dispatchgen;
@@ -116,6 +120,9 @@ struct ns_server {
 	unsigned int		session_keyalg;
 	isc_uint16_t		session_keybits;
 	isc_boolean_t		interface_auto;
+	isc_boolean_t		affinity_set;	/*%< Threads bound to CPUs */
+	int *			workernodes;	/*%< NUMA node of each task
+						     worker, or NULL */
 	unsigned char		secret[32];	/*%< Source Identity Token */
 };
 
@@ -200,6 +207,27 @@ enum {
 #endif
 };
 
+/*%
+ * Per NUMA node request statistics.  Requests received on an interface
+ * whose network device is on node N are counted as local to N if a task
+ * worker bound to a processor of N handles them, and as remote from N if
+ * a worker bound elsewhere does.  Used as isc_statscounter_t values
+ * through ns_numastatscounter().
+ */
+#define NS_NUMA_MAXNODES		8
+
+enum {
+	ns_numastatscounter_local = 0,
+	ns_numastatscounter_remote = 1,
+
+	ns_numastatscounter_pernode = 2,
+	ns_numastatscounter_max = NS_NUMA_MAXNODES *
+				  ns_numastatscounter_pernode
+};
+
+#define ns_numastatscounter(node, kind) \
+	((node) * ns_numastatscounter_pernode + (kind))
+
 void
 ns_server_create(isc_mem_t *mctx, ns_server_t **serverp);
 /*%<
@@ -394,4 +422,10 @@ ns_server_signing(ns_server_t *server, char *args, isc_buffer_t *text);
  */
 isc_result_t
 ns_server_zonestatus(ns_server_t *server, char *args, isc_buffer_t *text);
+
+/*%
+ * List the netblocks with the highest dampening penalties.
+ */
+isc_result_t
+ns_server_dampeningdump(ns_server_t *server, char *args, isc_buffer_t *text);
 #endif /* NAMED_SERVER_H */
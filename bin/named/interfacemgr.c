@@ -368,6 +368,7 @@ ns_interface_create(ns_interfacemgr_t *mgr, isc_sockaddr_t *addr,
 	ifp->flags = 0;
 	strncpy(ifp->name, name, sizeof(ifp->name));
 	ifp->name[sizeof(ifp->name)-1] = '\0';
+	ifp->numanode = isc_os_ifnode(ifp->name);
 	ifp->clientmgr = NULL;
 
 	result = isc_mutex_init(&ifp->lock);
@@ -383,6 +384,7 @@ ns_interface_create(ns_interfacemgr_t *mgr, isc_sockaddr_t *addr,
 			      isc_result_totext(result));
 		goto clientmgr_create_failure;
 	}
+	ns_clientmgr_setnode(ifp->clientmgr, ifp->numanode);
 
 	for (disp = 0; disp < MAX_UDP_DISPATCH; disp++)
 		ifp->udpdispatch[disp] = NULL;
@@ -441,6 +443,14 @@ ns_interface_listenudp(ns_interface_t *ifp) {
 	attrmask |= DNS_DISPATCHATTR_IPV4 | DNS_DISPATCHATTR_IPV6;
 
 	ifp->nudpdispatch = ISC_MIN(ns_g_udpdisp, MAX_UDP_DISPATCH);
+	if (ns_g_reuseport) {
+		/*
+		 * One socket per worker thread instead of duplicates of
+		 * one socket; the kernel spreads the flows over them.
+		 */
+		attrs |= DNS_DISPATCHATTR_REUSEPORT;
+		ifp->nudpdispatch = ISC_MIN(ns_g_cpus, MAX_UDP_DISPATCH);
+	}
 	for (disp = 0; disp < ifp->nudpdispatch; disp++) {
 		result = dns_dispatch_getudp_dup(ifp->mgr->dispatchmgr,
 						 ns_g_socketmgr,
@@ -452,6 +462,17 @@ ns_interface_listenudp(ns_interface_t *ifp) {
 						 disp == 0
 						    ? NULL
 						    : ifp->udpdispatch[0]);
+		if (result == ISC_R_NOTIMPLEMENTED && disp == 0 &&
+		    (attrs & DNS_DISPATCHATTR_REUSEPORT) != 0) {
+			isc_log_write(IFMGR_COMMON_LOGARGS, ISC_LOG_WARNING,
+				      "SO_REUSEPORT is not supported, "
+				      "sharing one UDP socket");
+			attrs &= ~DNS_DISPATCHATTR_REUSEPORT;
+			ifp->nudpdispatch = ISC_MIN(ns_g_udpdisp,
+						    MAX_UDP_DISPATCH);
+			disp--;
+			continue;
+		}
 		if (result != ISC_R_SUCCESS) {
 			isc_log_write(IFMGR_COMMON_LOGARGS, ISC_LOG_ERROR,
 				      "could not listen on UDP socket: %s",
@@ -461,8 +482,18 @@ ns_interface_listenudp(ns_interface_t *ifp) {
 
 	}
 
-	result = ns_clientmgr_createclients(ifp->clientmgr, ifp->nudpdispatch,
-					    ifp, ISC_FALSE);
+	/*
+	 * With more than one client waiting on each socket the socket
+	 * manager can fill them with a single system call.
+	 */
+	result = ISC_R_SUCCESS;
+	for (i = 0; i < (int)ns_g_udpbatch; i++) {
+		result = ns_clientmgr_createclients(ifp->clientmgr,
+						    ifp->nudpdispatch,
+						    ifp, ISC_FALSE);
+		if (result != ISC_R_SUCCESS)
+			break;
+	}
 	if (result != ISC_R_SUCCESS) {
 		UNEXPECTED_ERROR(__FILE__, __LINE__,
 				 "UDP ns_clientmgr_createclients(): %s",
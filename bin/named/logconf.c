@@ -185,10 +185,14 @@ channel_fromconf(const cfg_obj_t *channel, isc_logconfig_t *logconfig)
 		const cfg_obj_t *printcat = NULL;
 		const cfg_obj_t *printsev = NULL;
 		const cfg_obj_t *printtime = NULL;
+		const cfg_obj_t *async = NULL;
+		const cfg_obj_t *overflow = NULL;
 
 		(void)cfg_map_get(channel, "print-category", &printcat);
 		(void)cfg_map_get(channel, "print-severity", &printsev);
 		(void)cfg_map_get(channel, "print-time", &printtime);
+		(void)cfg_map_get(channel, "async", &async);
+		(void)cfg_map_get(channel, "async-overflow", &overflow);
 
 		if (printcat != NULL && cfg_obj_asboolean(printcat))
 			flags |= ISC_LOG_PRINTCATEGORY;
@@ -196,6 +200,11 @@ channel_fromconf(const cfg_obj_t *channel, isc_logconfig_t *logconfig)
 			flags |= ISC_LOG_PRINTTIME;
 		if (printsev != NULL && cfg_obj_asboolean(printsev))
 			flags |= ISC_LOG_PRINTLEVEL;
+		if (async != NULL && cfg_obj_asboolean(async))
+			flags |= ISC_LOG_ASYNC;
+		if (overflow != NULL &&
+		    strcasecmp(cfg_obj_asstring(overflow), "block") == 0)
+			flags |= ISC_LOG_ASYNCBLOCK;
 	}
 
 	level = ISC_LOG_INFO;
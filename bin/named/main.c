@@ -34,6 +34,7 @@
 #include <isc/platform.h>
 #include <isc/print.h>
 #include <isc/resource.h>
+#include <isc/stats.h>
 #include <isc/stdio.h>
 #include <isc/string.h>
 #include <isc/task.h>
@@ -670,6 +671,13 @@ create_managers(void) {
 		      ISC_LOG_INFO, "using %u UDP listener%s per interface",
 		      ns_g_udpdisp, ns_g_udpdisp == 1 ? "" : "s");
 
+	/*
+	 * Statistics shards are handed out in the order threads first update
+	 * a counter, not by role, so count every thread that may: the task
+	 * workers, the socket watchers, the timer thread and the main thread.
+	 */
+	isc_stats_setthreads(ns_g_cpus + ns_g_udpdisp + 2);
+
 	result = isc_taskmgr_create(ns_g_mctx, ns_g_cpus, 0, &ns_g_taskmgr);
 	if (result != ISC_R_SUCCESS) {
 		UNEXPECTED_ERROR(__FILE__, __LINE__,
@@ -686,7 +694,11 @@ create_managers(void) {
 		return (ISC_R_UNEXPECTED);
 	}
 
-	result = isc_socketmgr_create2(ns_g_mctx, &ns_g_socketmgr, maxsocks);
+	/*
+	 * One socket watcher thread per UDP listener.
+	 */
+	result = isc_socketmgr_create2(ns_g_mctx, &ns_g_socketmgr, maxsocks,
+				       ns_g_udpdisp);
 	if (result != ISC_R_SUCCESS) {
 		UNEXPECTED_ERROR(__FILE__, __LINE__,
 				 "isc_socketmgr_create() failed: %s",
@@ -0,0 +1,4370 @@
+/*
+ * Generated by Id 
+ */
+#include <isc/backtrace.h>
+const int isc__backtrace_nsymbols = 4362;
+const isc_backtrace_symmap_t isc__backtrace_symtable[] = {
+	{ (void *)0x0000000000033000, "_init" },
+	{ (void *)0x0000000000033d50, "library_fatal_error.cold" },
+	{ (void *)0x0000000000033d55, "assertion_failed.cold" },
+	{ (void *)0x0000000000033d5a, "txt_valid_regex.cold" },
+	{ (void *)0x0000000000033d70, "main" },
+	{ (void *)0x0000000000035010, "_start" },
+	{ (void *)0x0000000000035040, "deregister_tm_clones" },
+	{ (void *)0x0000000000035070, "register_tm_clones" },
+	{ (void *)0x00000000000350b0, "__do_global_dtors_aux" },
+	{ (void *)0x00000000000350f0, "frame_dummy" },
+	{ (void *)0x0000000000035100, "do_empty_lookup" },
+	{ (void *)0x0000000000035110, "dns64_rdata" },
+	{ (void *)0x0000000000035260, "builtin_destroy" },
+	{ (void *)0x0000000000035340, "builtin_create" },
+	{ (void *)0x0000000000035600, "builtin_authority" },
+	{ (void *)0x0000000000035690, "dns64_lookup" },
+	{ (void *)0x0000000000035930, "do_dns64_lookup" },
+	{ (void *)0x0000000000035940, "builtin_lookup" },
+	{ (void *)0x0000000000035960, "do_authors_lookup" },
+	{ (void *)0x0000000000035aa0, "do_hostname_lookup" },
+	{ (void *)0x0000000000035c70, "do_version_lookup" },
+	{ (void *)0x0000000000035d60, "do_id_lookup" },
+	{ (void *)0x0000000000035f30, "ns_builtin_init" },
+	{ (void *)0x0000000000035fe0, "ns_builtin_deinit" },
+	{ (void *)0x0000000000036000, "acl_haskeys" },
+	{ (void *)0x0000000000036080, "client_allocsendbuf" },
+	{ (void *)0x00000000000361f0, "clientmgr_destroy" },
+	{ (void *)0x0000000000036340, "ns_client_recursing" },
+	{ (void *)0x0000000000036460, "ns_client_killoldestquery" },
+	{ (void *)0x00000000000366b0, "ns_client_addopt" },
+	{ (void *)0x00000000000368c0, "ns_client_isself" },
+	{ (void *)0x0000000000036aa0, "ns_client_shuttingdown" },
+	{ (void *)0x0000000000036ab0, "ns_clientmgr_create" },
+	{ (void *)0x0000000000036ca0, "ns_clientmgr_setnode" },
+	{ (void *)0x0000000000036d40, "ns_clientmgr_destroy" },
+	{ (void *)0x0000000000036e90, "ns_client_getsockaddr" },
+	{ (void *)0x0000000000036ea0, "ns_client_checkaclsilent" },
+	{ (void *)0x0000000000036f60, "ns_client_logv" },
+	{ (void *)0x0000000000037130, "ns_client_log" },
+	{ (void *)0x00000000000371f0, "ns_client_settimeout" },
+	{ (void *)0x0000000000037280, "ns_client_dumpmessage" },
+	{ (void *)0x0000000000037390, "client_accept" },
+	{ (void *)0x00000000000374c0, "client_udprecv" },
+	{ (void *)0x0000000000037590, "ns_client_next" },
+	{ (void *)0x0000000000037690, "client_read" },
+	{ (void *)0x0000000000037760, "exit_check" },
+	{ (void *)0x0000000000038740, "client_start" },
+	{ (void *)0x00000000000387c0, "client_senddone" },
+	{ (void *)0x0000000000038a50, "client_sendpkg" },
+	{ (void *)0x0000000000038c40, "ns_client_sendraw" },
+	{ (void *)0x0000000000038e00, "client_send" },
+	{ (void *)0x0000000000039350, "ns_client_attach" },
+	{ (void *)0x00000000000393f0, "ns_client_detach" },
+	{ (void *)0x0000000000039460, "client_delay" },
+	{ (void *)0x00000000000395a0, "get_client" },
+	{ (void *)0x000000000003a2a0, "ns_clientmgr_createclients" },
+	{ (void *)0x000000000003a380, "ns_client_replace" },
+	{ (void *)0x000000000003a420, "ns_client_send" },
+	{ (void *)0x000000000003a520, "client_newconn" },
+	{ (void *)0x000000000003a900, "ns_client_error" },
+	{ (void *)0x000000000003ad50, "client_request" },
+	{ (void *)0x000000000003c4d0, "client_shutdown" },
+	{ (void *)0x000000000003c750, "client_timeout" },
+	{ (void *)0x000000000003c8b0, "ns_client_checkacl" },
+	{ (void *)0x000000000003c960, "ns_client_aclmsg" },
+	{ (void *)0x000000000003ca00, "ns_client_dumprecursing" },
+	{ (void *)0x000000000003cdf0, "ns_client_qnamereplace" },
+	{ (void *)0x000000000003ce90, "ns_client_sourceip" },
+	{ (void *)0x000000000003cef0, "ns_config_parsedefaults" },
+	{ (void *)0x000000000003cf40, "ns_config_get" },
+	{ (void *)0x000000000003cf90, "ns_checknames_get" },
+	{ (void *)0x000000000003d0b0, "ns_config_listcount" },
+	{ (void *)0x000000000003d0e0, "ns_config_getclass" },
+	{ (void *)0x000000000003d170, "ns_config_gettype" },
+	{ (void *)0x000000000003d200, "ns_config_getzonetype" },
+	{ (void *)0x000000000003d2d0, "ns_config_putiplist" },
+	{ (void *)0x000000000003d3d0, "ns_config_putipandkeylist" },
+	{ (void *)0x000000000003d610, "ns_config_getport" },
+	{ (void *)0x000000000003d750, "ns_config_getiplist" },
+	{ (void *)0x000000000003dbc0, "ns_config_getdscp" },
+	{ (void *)0x000000000003dc70, "ns_config_getipandkeylist" },
+	{ (void *)0x000000000003eb70, "ns_config_getkeyalgorithm2" },
+	{ (void *)0x000000000003ed70, "ns_config_getkeyalgorithm" },
+	{ (void *)0x000000000003ed80, "command_compare" },
+	{ (void *)0x000000000003edd0, "ns_control_docommand" },
+	{ (void *)0x000000000003f540, "maybe_free_connection" },
+	{ (void *)0x000000000003f700, "free_controlkey" },
+	{ (void *)0x000000000003f780, "free_controlkeylist" },
+	{ (void *)0x000000000003f890, "free_listener" },
+	{ (void *)0x000000000003f970, "controlkeylist_fromcfg" },
+	{ (void *)0x000000000003fa90, "register_keys" },
+	{ (void *)0x00000000000400d0, "get_rndckey" },
+	{ (void *)0x0000000000040470, "control_accept" },
+	{ (void *)0x00000000000404e0, "control_timeout" },
+	{ (void *)0x0000000000040520, "update_listener.isra.0" },
+	{ (void *)0x0000000000040970, "add_listener" },
+	{ (void *)0x0000000000041010, "shutdown_listener" },
+	{ (void *)0x0000000000041250, "control_newconn" },
+	{ (void *)0x0000000000041590, "control_senddone" },
+	{ (void *)0x00000000000416f0, "control_recvmessage" },
+	{ (void *)0x0000000000041ee0, "ns_controls_shutdown" },
+	{ (void *)0x0000000000041f20, "ns_controls_configure" },
+	{ (void *)0x0000000000042940, "ns_controls_create" },
+	{ (void *)0x00000000000429f0, "ns_controls_destroy" },
+	{ (void *)0x0000000000042a60, "clearlistenon" },
+	{ (void *)0x0000000000042bc0, "listenon_is_ip6_any.part.0" },
+	{ (void *)0x0000000000042be0, "ns_interfacemgr_getaclenv" },
+	{ (void *)0x0000000000042bf0, "ns_interfacemgr_attach" },
+	{ (void *)0x0000000000042cc0, "ns_interfacemgr_detach" },
+	{ (void *)0x0000000000042ec0, "ns_interfacemgr_create" },
+	{ (void *)0x00000000000431c0, "route_event" },
+	{ (void *)0x00000000000433a0, "ns_interface_shutdown" },
+	{ (void *)0x00000000000433d0, "ns_interface_attach" },
+	{ (void *)0x00000000000434a0, "ns_interface_detach" },
+	{ (void *)0x00000000000436d0, "purge_old_interfaces" },
+	{ (void *)0x00000000000438e0, "ns_interfacemgr_shutdown" },
+	{ (void *)0x00000000000439d0, "ns_interface_setup" },
+	{ (void *)0x00000000000442a0, "do_scan" },
+	{ (void *)0x00000000000451b0, "ns_interfacemgr_scan0" },
+	{ (void *)0x0000000000045270, "ns_interfacemgr_scan" },
+	{ (void *)0x0000000000045280, "ns_interfacemgr_adjust" },
+	{ (void *)0x0000000000045290, "ns_interfacemgr_setlistenon4" },
+	{ (void *)0x0000000000045320, "ns_interfacemgr_setlistenon6" },
+	{ (void *)0x00000000000453b0, "ns_interfacemgr_dumprecursing" },
+	{ (void *)0x0000000000045460, "ns_interfacemgr_listeningon" },
+	{ (void *)0x00000000000454c0, "ns_listenelt_create" },
+	{ (void *)0x0000000000045560, "ns_listenelt_destroy" },
+	{ (void *)0x00000000000455a0, "ns_listenlist_create" },
+	{ (void *)0x0000000000045620, "ns_listenlist_attach" },
+	{ (void *)0x0000000000045650, "ns_listenlist_detach" },
+	{ (void *)0x0000000000045700, "ns_listenlist_default" },
+	{ (void *)0x0000000000045880, "ns_log_setdefaultchannels" },
+	{ (void *)0x00000000000458f0, "ns_log_setsafechannels" },
+	{ (void *)0x0000000000045960, "ns_log_setdefaultcategory" },
+	{ (void *)0x00000000000459c0, "ns_log_init" },
+	{ (void *)0x0000000000045ad0, "ns_log_setunmatchedcategory" },
+	{ (void *)0x0000000000045af0, "ns_log_shutdown" },
+	{ (void *)0x0000000000045b20, "ns_log_configure" },
+	{ (void *)0x0000000000046510, "library_unexpected_error" },
+	{ (void *)0x00000000000465d0, "library_fatal_error" },
+	{ (void *)0x00000000000466e0, "assertion_failed" },
+	{ (void *)0x0000000000046910, "usage" },
+	{ (void *)0x0000000000046950, "ns_main_earlywarning" },
+	{ (void *)0x0000000000046a70, "ns_main_earlyfatal" },
+	{ (void *)0x0000000000046bb0, "parse_int" },
+	{ (void *)0x0000000000046c10, "ns_main_setmemstats" },
+	{ (void *)0x0000000000046c80, "notify_log" },
+	{ (void *)0x0000000000046d30, "respond" },
+	{ (void *)0x0000000000046da0, "ns_notify_start" },
+	{ (void *)0x0000000000047020, "rpz_get_zbits" },
+	{ (void *)0x0000000000047160, "inc_stats" },
+	{ (void *)0x00000000000471e0, "log_query" },
+	{ (void *)0x00000000000473c0, "log_queryerror" },
+	{ (void *)0x0000000000047520, "answer_in_glue" },
+	{ (void *)0x0000000000047800, "query_getcachedb" },
+	{ (void *)0x0000000000047a10, "rpz_log_rewrite" },
+	{ (void *)0x0000000000047b50, "query_findclosestnsec3" },
+	{ (void *)0x0000000000047f80, "warn_rfc1918" },
+	{ (void *)0x0000000000048120, "dns64_aaaaok" },
+	{ (void *)0x0000000000048370, "validate" },
+	{ (void *)0x00000000000488f0, "rpz_clean.part.0" },
+	{ (void *)0x0000000000048910, "rpz_clean" },
+	{ (void *)0x00000000000489b0, "query_findversion.part.0" },
+	{ (void *)0x0000000000048bd0, "redirect" },
+	{ (void *)0x0000000000048fe0, "rpz_log_fail.part.0" },
+	{ (void *)0x00000000000490c0, "query_getnamebuf.part.0" },
+	{ (void *)0x00000000000490f0, "query_newname.part.0" },
+	{ (void *)0x0000000000049110, "query_newname" },
+	{ (void *)0x00000000000491a0, "rpz_ready.part.0" },
+	{ (void *)0x00000000000491c0, "query_keepname.part.0" },
+	{ (void *)0x00000000000491e0, "query_releasename.part.0" },
+	{ (void *)0x0000000000049210, "query_releasename" },
+	{ (void *)0x0000000000049260, "query_putrdataset" },
+	{ (void *)0x00000000000492b0, "query_sortlist_order_1element" },
+	{ (void *)0x0000000000049380, "query_validatezonedb" },
+	{ (void *)0x0000000000049760, "query_discardcache.constprop.0" },
+	{ (void *)0x0000000000049940, "query_sortlist_order_2element" },
+	{ (void *)0x0000000000049a10, "rpz_rewrite_ns_skip" },
+	{ (void *)0x0000000000049aa0, "rpz_get_p_name" },
+	{ (void *)0x0000000000049c30, "fixrdataset" },
+	{ (void *)0x0000000000049cb0, "prefetch_done" },
+	{ (void *)0x0000000000049e80, "query_error" },
+	{ (void *)0x0000000000049f80, "query_next" },
+	{ (void *)0x000000000004a050, "query_send" },
+	{ (void *)0x000000000004a1b0, "rpz_st_clear" },
+	{ (void *)0x000000000004a400, "query_getdb" },
+	{ (void *)0x000000000004a750, "fixfname.part.0" },
+	{ (void *)0x000000000004a960, "query_addrrset" },
+	{ (void *)0x000000000004ac40, "query_add_cname" },
+	{ (void *)0x000000000004aee0, "rpz_add_cname" },
+	{ (void *)0x000000000004b120, "query_addns.isra.0" },
+	{ (void *)0x000000000004b480, "query_prefetch" },
+	{ (void *)0x000000000004b620, "query_addsoa" },
+	{ (void *)0x000000000004baf0, "query_recurse" },
+	{ (void *)0x000000000004bfd0, "rpz_find_p" },
+	{ (void *)0x000000000004c810, "rpz_rewrite_ip" },
+	{ (void *)0x000000000004cd80, "query_addbestns" },
+	{ (void *)0x000000000004d7b0, "rpz_rrset_find.constprop.0" },
+	{ (void *)0x000000000004de10, "rpz_rewrite_ip_rrset.constprop.0" },
+	{ (void *)0x000000000004e0d0, "rpz_rewrite_ip_rrsets" },
+	{ (void *)0x000000000004e280, "query_addnoqnameproof" },
+	{ (void *)0x000000000004e9a0, "rpz_rewrite_name" },
+	{ (void *)0x000000000004ef40, "rpz_rewrite" },
+	{ (void *)0x000000000004fa10, "query_filter64.constprop.0" },
+	{ (void *)0x0000000000050100, "query_dns64.constprop.0" },
+	{ (void *)0x0000000000050890, "query_addds" },
+	{ (void *)0x0000000000051150, "query_addadditional" },
+	{ (void *)0x00000000000526e0, "query_addadditional2" },
+	{ (void *)0x00000000000540f0, "query_addwildcardproof" },
+	{ (void *)0x0000000000055050, "query_addnxrrsetnsec" },
+	{ (void *)0x00000000000553a0, "query_find" },
+	{ (void *)0x000000000005b200, "query_resume" },
+	{ (void *)0x000000000005b5a0, "ns_query_cancel" },
+	{ (void *)0x000000000005b630, "query_reset" },
+	{ (void *)0x000000000005bb50, "query_next_callback" },
+	{ (void *)0x000000000005bb60, "ns_query_free" },
+	{ (void *)0x000000000005bb70, "ns_query_init" },
+	{ (void *)0x000000000005be80, "ns_query_start" },
+	{ (void *)0x000000000005c4d0, "pps_timer_tick" },
+	{ (void *)0x000000000005c510, "heartbeat_timer_tick" },
+	{ (void *)0x000000000005c560, "directory_callback" },
+	{ (void *)0x000000000005c630, "set_limit" },
+	{ (void *)0x000000000005c740, "configure_view_acl" },
+	{ (void *)0x000000000005c870, "create_dampening" },
+	{ (void *)0x000000000005ca80, "configure_dampening_params" },
+	{ (void *)0x000000000005d6e0, "portset_fromconf" },
+	{ (void *)0x000000000005d7e0, "setstring" },
+	{ (void *)0x000000000005d850, "cleanup_session_key" },
+	{ (void *)0x000000000005d920, "setup_newzones" },
+	{ (void *)0x000000000005db80, "newzone_cfgctx_destroy" },
+	{ (void *)0x000000000005dc40, "end_reserved_dispatches" },
+	{ (void *)0x000000000005de10, "dlzconfigure_callback" },
+	{ (void *)0x000000000005dea0, "add_zone_tolist" },
+	{ (void *)0x000000000005df30, "disable_algorithms" },
+	{ (void *)0x000000000005e100, "configure_forward" },
+	{ (void *)0x000000000005e640, "configure_zone" },
+	{ (void *)0x000000000005f3b0, "configure_alternates" },
+	{ (void *)0x000000000005f730, "configure_order" },
+	{ (void *)0x000000000005f9c0, "configure_view_nametable" },
+	{ (void *)0x000000000005fc20, "dstkey_fromconfig" },
+	{ (void *)0x00000000000601b0, "load_view_keys" },
+	{ (void *)0x0000000000060380, "configure_dynamic_db" },
+	{ (void *)0x0000000000060580, "add_ns" },
+	{ (void *)0x0000000000060760, "configure_rrl" },
+	{ (void *)0x0000000000060f70, "configure_dampening" },
+	{ (void *)0x0000000000061270, "add_listenelt" },
+	{ (void *)0x0000000000061400, "load_zones" },
+	{ (void *)0x0000000000061610, "save_dampening" },
+	{ (void *)0x0000000000061690, "shutdown_server" },
+	{ (void *)0x0000000000061b90, "fatal" },
+	{ (void *)0x0000000000061c10, "view_loaded" },
+	{ (void *)0x0000000000061d20, "putstr" },
+	{ (void *)0x0000000000061d60, "dumpcontext_destroy" },
+	{ (void *)0x0000000000062050, "dumpdone" },
+	{ (void *)0x0000000000062480, "delete_keynames" },
+	{ (void *)0x0000000000062610, "list_keynames" },
+	{ (void *)0x0000000000062860, "count_zones" },
+	{ (void *)0x00000000000628e0, "removed" },
+	{ (void *)0x0000000000062980, "configure_server_quota" },
+	{ (void *)0x00000000000629e0, "synczone" },
+	{ (void *)0x0000000000062a60, "inuse" },
+	{ (void *)0x0000000000062af0, "reload.part.0" },
+	{ (void *)0x0000000000062b70, "create_empty_zone.constprop.0" },
+	{ (void *)0x00000000000635b0, "get_view_querysource_dispatch.constprop.0" },
+	{ (void *)0x0000000000063960, "interface_timer_tick" },
+	{ (void *)0x0000000000063a50, "find_view.constprop.0" },
+	{ (void *)0x0000000000063b00, "create_view" },
+	{ (void *)0x0000000000063ca0, "ns_listenlist_fromconfig.isra.0" },
+	{ (void *)0x0000000000063f80, "unbind_threads" },
+	{ (void *)0x0000000000064040, "dns64_reverse" },
+	{ (void *)0x0000000000064410, "setoptstring" },
+	{ (void *)0x00000000000644c0, "add_keydata_zone" },
+	{ (void *)0x0000000000064870, "configure_view_dnsseckeys" },
+	{ (void *)0x0000000000064e30, "zone_from_args" },
+	{ (void *)0x0000000000065250, "ns_server_flushonshutdown" },
+	{ (void *)0x0000000000065280, "ns_server_create" },
+	{ (void *)0x0000000000065900, "ns_server_destroy" },
+	{ (void *)0x0000000000065be0, "ns_add_reserved_dispatch" },
+	{ (void *)0x0000000000065e90, "configure_peer" },
+	{ (void *)0x00000000000663f0, "configure_view" },
+	{ (void *)0x000000000006b1d0, "load_configuration" },
+	{ (void *)0x000000000006eb80, "run_server" },
+	{ (void *)0x000000000006eda0, "loadconfig" },
+	{ (void *)0x000000000006ee90, "ns_server_reload" },
+	{ (void *)0x000000000006efa0, "ns_server_reloadwanted" },
+	{ (void *)0x000000000006f030, "ns_server_scan_interfaces" },
+	{ (void *)0x000000000006f080, "ns_server_retransfercommand" },
+	{ (void *)0x000000000006f140, "ns_server_reloadcommand" },
+	{ (void *)0x000000000006f2a0, "ns_server_reconfigcommand" },
+	{ (void *)0x000000000006f410, "ns_server_notifycommand" },
+	{ (void *)0x000000000006f4c0, "ns_server_refreshcommand" },
+	{ (void *)0x000000000006f610, "ns_server_togglequerylog" },
+	{ (void *)0x000000000006f770, "ns_server_dumpstats" },
+	{ (void *)0x000000000006f8a0, "ns_server_dumpdb" },
+	{ (void *)0x000000000006fc80, "ns_server_dumpsecroots" },
+	{ (void *)0x000000000006ffb0, "ns_server_dumprecursing" },
+	{ (void *)0x0000000000070130, "ns_server_setdebuglevel" },
+	{ (void *)0x0000000000070230, "ns_server_validation" },
+	{ (void *)0x0000000000070560, "ns_server_flushcache" },
+	{ (void *)0x0000000000070920, "ns_server_flushnode" },
+	{ (void *)0x0000000000070c50, "ns_server_status" },
+	{ (void *)0x0000000000070e50, "ns_server_tsigdelete" },
+	{ (void *)0x0000000000071070, "ns_server_tsiglist" },
+	{ (void *)0x00000000000712a0, "ns_server_rekey" },
+	{ (void *)0x00000000000713c0, "ns_server_sync" },
+	{ (void *)0x0000000000071720, "ns_server_freeze" },
+	{ (void *)0x0000000000071c90, "add_comment" },
+	{ (void *)0x0000000000071d10, "ns_server_add_zone" },
+	{ (void *)0x0000000000072530, "ns_server_del_zone" },
+	{ (void *)0x0000000000072e20, "ns_server_signing" },
+	{ (void *)0x00000000000735b0, "ns_server_zonestatus" },
+	{ (void *)0x0000000000074420, "ns_server_dampeningdump" },
+	{ (void *)0x0000000000074790, "ns_sortlist_addrorder1" },
+	{ (void *)0x00000000000747c0, "ns_sortlist_addrorder2" },
+	{ (void *)0x0000000000074800, "ns_sortlist_setup" },
+	{ (void *)0x0000000000074970, "ns_sortlist_byaddrsetup" },
+	{ (void *)0x00000000000749e0, "metrics_latencysum" },
+	{ (void *)0x00000000000749f0, "metrics_free" },
+	{ (void *)0x0000000000074a10, "destroy_listener" },
+	{ (void *)0x0000000000074ad0, "render_xsl" },
+	{ (void *)0x0000000000074bf0, "metrics_grow" },
+	{ (void *)0x0000000000074ca0, "metrics_printf" },
+	{ (void *)0x0000000000074dd0, "client_ok" },
+	{ (void *)0x0000000000074f40, "latencystat_dump" },
+	{ (void *)0x0000000000075000, "rdatasetstats_dump" },
+	{ (void *)0x00000000000750e0, "rdtypestat_dump" },
+	{ (void *)0x0000000000075150, "opcodestat_dump" },
+	{ (void *)0x00000000000751d0, "set_desc.part.0" },
+	{ (void *)0x00000000000751f0, "set_desc" },
+	{ (void *)0x0000000000075260, "generalstat_dump" },
+	{ (void *)0x0000000000075290, "metrics_putmem" },
+	{ (void *)0x0000000000075300, "metrics_label" },
+	{ (void *)0x00000000000753d0, "metrics_begin" },
+	{ (void *)0x0000000000075430, "metrics_zonequeries" },
+	{ (void *)0x00000000000754c0, "metrics_counters" },
+	{ (void *)0x00000000000755d0, "metrics_zonerequests" },
+	{ (void *)0x0000000000075680, "metrics_rdtype" },
+	{ (void *)0x0000000000075710, "metrics_opcode" },
+	{ (void *)0x00000000000757b0, "metrics_rdataset" },
+	{ (void *)0x00000000000758a0, "metrics_zoneserial" },
+	{ (void *)0x0000000000075950, "metrics_latencyend" },
+	{ (void *)0x0000000000075b20, "metrics_latency" },
+	{ (void *)0x0000000000075c80, "init_desc" },
+	{ (void *)0x0000000000078a30, "render_metrics.constprop.0" },
+	{ (void *)0x0000000000079e80, "render_metrics_all" },
+	{ (void *)0x0000000000079ec0, "render_metrics_server" },
+	{ (void *)0x0000000000079f00, "render_metrics_views" },
+	{ (void *)0x0000000000079f40, "render_metrics_zones" },
+	{ (void *)0x0000000000079f80, "render_metrics_mem" },
+	{ (void *)0x0000000000079fc0, "render_metrics_net" },
+	{ (void *)0x000000000007a000, "ns_statschannels_configure" },
+	{ (void *)0x000000000007ad40, "ns_statschannels_shutdown" },
+	{ (void *)0x000000000007aef0, "ns_stats_dump" },
+	{ (void *)0x000000000007bcf0, "ns_tkeyctx_fromconfig" },
+	{ (void *)0x000000000007c120, "add_initial_keys" },
+	{ (void *)0x000000000007c500, "ns_tsigkeyring_fromconfig" },
+	{ (void *)0x000000000007c640, "rrset_exists_action" },
+	{ (void *)0x000000000007c650, "count_rr_action" },
+	{ (void *)0x000000000007c660, "type_not_soa_nor_ns_p" },
+	{ (void *)0x000000000007c680, "type_not_dnssec" },
+	{ (void *)0x000000000007c6a0, "true_p" },
+	{ (void *)0x000000000007c6b0, "ssu_checkrule" },
+	{ (void *)0x000000000007c710, "cname_compatibility_action" },
+	{ (void *)0x000000000007c740, "rr_equal_p" },
+	{ (void *)0x000000000007c760, "temp_append" },
+	{ (void *)0x000000000007c7f0, "replaces_p" },
+	{ (void *)0x000000000007c9e0, "add_rr_prepare_action" },
+	{ (void *)0x000000000007cb00, "temp_order" },
+	{ (void *)0x000000000007cb50, "checkupdateacl" },
+	{ (void *)0x000000000007ccd0, "foreach_rrset" },
+	{ (void *)0x000000000007cdf0, "get_current_rr" },
+	{ (void *)0x000000000007cef0, "foreach_node_rr_action" },
+	{ (void *)0x000000000007cfa0, "foreach_rr" },
+	{ (void *)0x000000000007d1a0, "delete_if" },
+	{ (void *)0x000000000007d200, "rrset_exists" },
+	{ (void *)0x000000000007d240, "rr_exists" },
+	{ (void *)0x000000000007d3b0, "do_one_tuple" },
+	{ (void *)0x000000000007d590, "do_diff" },
+	{ (void *)0x000000000007d720, "send_forward_event" },
+	{ (void *)0x000000000007d8c0, "update_log" },
+	{ (void *)0x000000000007da20, "update_log_cb" },
+	{ (void *)0x000000000007da40, "check_mx" },
+	{ (void *)0x000000000007de10, "respond" },
+	{ (void *)0x000000000007dea0, "forward_done" },
+	{ (void *)0x000000000007df10, "forward_fail" },
+	{ (void *)0x000000000007df70, "get_iterations.constprop.0" },
+	{ (void *)0x000000000007e260, "check_dnssec" },
+	{ (void *)0x000000000007e410, "name_exists_action" },
+	{ (void *)0x000000000007e420, "delete_if_action" },
+	{ (void *)0x000000000007e4b0, "remove_orphaned_ds" },
+	{ (void *)0x000000000007e730, "forward_action" },
+	{ (void *)0x000000000007e820, "forward_callback" },
+	{ (void *)0x000000000007e920, "updatedone_action" },
+	{ (void *)0x000000000007eab0, "update_action" },
+	{ (void *)0x00000000000832e0, "ns_update_start" },
+	{ (void *)0x0000000000083680, "rrstream_noop_pause" },
+	{ (void *)0x0000000000083690, "soa_rrstream_first" },
+	{ (void *)0x00000000000836a0, "soa_rrstream_next" },
+	{ (void *)0x00000000000836b0, "soa_rrstream_current" },
+	{ (void *)0x00000000000836d0, "compound_rrstream_first" },
+	{ (void *)0x0000000000083700, "compound_rrstream_next" },
+	{ (void *)0x0000000000083780, "ixfr_rrstream_current" },
+	{ (void *)0x0000000000083790, "ixfr_rrstream_next" },
+	{ (void *)0x00000000000837a0, "ixfr_rrstream_first" },
+	{ (void *)0x00000000000837b0, "ixfr_rrstream_destroy" },
+	{ (void *)0x00000000000837f0, "soa_rrstream_destroy" },
+	{ (void *)0x0000000000083830, "compound_rrstream_destroy" },
+	{ (void *)0x0000000000083880, "axfr_rrstream_pause" },
+	{ (void *)0x0000000000083890, "axfr_rrstream_current" },
+	{ (void *)0x00000000000838a0, "axfr_rrstream_next" },
+	{ (void *)0x0000000000083910, "axfr_rrstream_first" },
+	{ (void *)0x00000000000839b0, "axfr_rrstream_destroy" },
+	{ (void *)0x00000000000839f0, "xfrout_ctx_destroy" },
+	{ (void *)0x0000000000083b70, "xfrout_logv" },
+	{ (void *)0x0000000000083c20, "xfrout_log1" },
+	{ (void *)0x0000000000083cb0, "xfrout_log" },
+	{ (void *)0x0000000000083d60, "compound_rrstream_pause" },
+	{ (void *)0x0000000000083da0, "compound_rrstream_current" },
+	{ (void *)0x0000000000083e10, "xfrout_maybe_destroy" },
+	{ (void *)0x0000000000083e90, "xfrout_ctx_create.constprop.0" },
+	{ (void *)0x0000000000084110, "xfrout_client_shutdown" },
+	{ (void *)0x0000000000084150, "soa_rrstream_create" },
+	{ (void *)0x0000000000084270, "sendstream" },
+	{ (void *)0x0000000000084ff0, "xfrout_senddone" },
+	{ (void *)0x0000000000085170, "ns_xfr_start" },
+	{ (void *)0x0000000000086370, "strtoargvsub" },
+	{ (void *)0x0000000000086450, "configure_zone_acl" },
+	{ (void *)0x00000000000868b0, "zonetype_fromconfig.part.0" },
+	{ (void *)0x00000000000868e0, "ns_zone_configure" },
+	{ (void *)0x000000000008ac90, "ns_zone_configure_writeable_dlz" },
+	{ (void *)0x000000000008ad30, "ns_zone_reusable" },
+	{ (void *)0x000000000008b000, "lwaddr_netaddr_fromlwresaddr" },
+	{ (void *)0x000000000008b050, "lwaddr_sockaddr_fromlwresaddr" },
+	{ (void *)0x000000000008b0d0, "lwaddr_lwresaddr_fromnetaddr" },
+	{ (void *)0x000000000008b130, "lwaddr_lwresaddr_fromsockaddr" },
+	{ (void *)0x000000000008b1a0, "ns__lwresd_memalloc" },
+	{ (void *)0x000000000008b1c0, "ns__lwresd_memfree" },
+	{ (void *)0x000000000008b1e0, "buffer_putstr" },
+	{ (void *)0x000000000008b220, "initialize_mutex" },
+	{ (void *)0x000000000008b260, "ns_lwresd_parseeresolvconf" },
+	{ (void *)0x000000000008bb70, "ns_lwdmanager_create" },
+	{ (void *)0x000000000008bff0, "ns_lwdmanager_attach" },
+	{ (void *)0x000000000008c0d0, "ns_lwdmanager_detach" },
+	{ (void *)0x000000000008c260, "ns_lwreslistener_attach" },
+	{ (void *)0x000000000008c340, "ns_lwreslistener_detach" },
+	{ (void *)0x000000000008c4e0, "configure_listener" },
+	{ (void *)0x000000000008ccb0, "ns_lwreslistener_unlinkcm" },
+	{ (void *)0x000000000008ce60, "ns_lwreslistener_linkcm" },
+	{ (void *)0x000000000008ced0, "ns_lwresd_configure" },
+	{ (void *)0x000000000008d420, "ns_lwresd_shutdown" },
+	{ (void *)0x000000000008d590, "ns_lwdclient_log" },
+	{ (void *)0x000000000008d640, "lwdclientmgr_shutdown_callback" },
+	{ (void *)0x000000000008d890, "ns_lwdclientmgr_create" },
+	{ (void *)0x000000000008dca0, "ns_lwdclient_startrecv" },
+	{ (void *)0x000000000008e080, "ns_lwdclient_stateidle" },
+	{ (void *)0x000000000008e310, "ns_lwdclient_recv" },
+	{ (void *)0x000000000008e6b0, "ns_lwdclient_send" },
+	{ (void *)0x000000000008e790, "ns_lwdclient_sendreply" },
+	{ (void *)0x000000000008e7e0, "ns_lwdclient_initialize" },
+	{ (void *)0x000000000008e8c0, "ns_lwdclient_errorpktsend" },
+	{ (void *)0x000000000008e990, "addr_compare" },
+	{ (void *)0x000000000008e9a0, "setup_addresses.isra.0" },
+	{ (void *)0x000000000008eb00, "restart_find" },
+	{ (void *)0x000000000008ef60, "start_find" },
+	{ (void *)0x000000000008f0e0, "generate_reply" },
+	{ (void *)0x000000000008f630, "process_gabn_finddone" },
+	{ (void *)0x000000000008f7e0, "ns_lwdclient_processgabn" },
+	{ (void *)0x000000000008f9c0, "start_byaddr" },
+	{ (void *)0x000000000008fa40, "byaddr_done" },
+	{ (void *)0x000000000008fd40, "ns_lwdclient_processgnba" },
+	{ (void *)0x000000000008ffb0, "start_lookup" },
+	{ (void *)0x00000000000900c0, "fill_array" },
+	{ (void *)0x0000000000090180, "lookup_done" },
+	{ (void *)0x0000000000090e80, "ns_lwdclient_processgrbn" },
+	{ (void *)0x00000000000910d0, "ns_lwdclient_processnoop" },
+	{ (void *)0x0000000000091250, "ns_lwsearchlist_create" },
+	{ (void *)0x0000000000091360, "ns_lwsearchlist_attach" },
+	{ (void *)0x0000000000091480, "ns_lwsearchlist_detach" },
+	{ (void *)0x0000000000091700, "ns_lwsearchlist_append" },
+	{ (void *)0x0000000000091830, "ns_lwsearchctx_init" },
+	{ (void *)0x00000000000918d0, "ns_lwsearchctx_first" },
+	{ (void *)0x0000000000091900, "ns_lwsearchctx_next" },
+	{ (void *)0x00000000000919d0, "ns_lwsearchctx_current" },
+	{ (void *)0x0000000000091a40, "cleanup_pidfile" },
+	{ (void *)0x0000000000091aa0, "linux_setcaps" },
+	{ (void *)0x0000000000091b40, "mkdirpath.constprop.0" },
+	{ (void *)0x0000000000091cd0, "safe_open.constprop.0" },
+	{ (void *)0x0000000000091d50, "ns_os_init" },
+	{ (void *)0x0000000000091da0, "ns_os_daemonize" },
+	{ (void *)0x0000000000091f40, "ns_os_started" },
+	{ (void *)0x0000000000091fb0, "ns_os_opendevnull" },
+	{ (void *)0x0000000000091fe0, "ns_os_closedevnull" },
+	{ (void *)0x0000000000092010, "ns_os_chroot" },
+	{ (void *)0x00000000000920a0, "ns_os_inituserinfo" },
+	{ (void *)0x0000000000092190, "ns_os_changeuser" },
+	{ (void *)0x0000000000092290, "ns_os_adjustnofile" },
+	{ (void *)0x00000000000922d0, "ns_os_minprivs" },
+	{ (void *)0x0000000000092360, "ns_os_openfile" },
+	{ (void *)0x0000000000092580, "ns_os_writepidfile" },
+	{ (void *)0x0000000000092690, "ns_os_shutdown" },
+	{ (void *)0x00000000000926b0, "ns_os_gethostname" },
+	{ (void *)0x00000000000926d0, "ns_os_shutdownmsg" },
+	{ (void *)0x0000000000092790, "ns_os_tzset" },
+	{ (void *)0x00000000000927a0, "dlopen_dlz_delrdataset" },
+	{ (void *)0x0000000000092890, "dlopen_dlz_subrdataset" },
+	{ (void *)0x0000000000092980, "dlopen_dlz_addrdataset" },
+	{ (void *)0x0000000000092a70, "dlopen_dlz_ssumatch" },
+	{ (void *)0x0000000000092ba0, "dlopen_dlz_configure" },
+	{ (void *)0x0000000000092c70, "dlopen_dlz_closeversion" },
+	{ (void *)0x0000000000092d40, "dlopen_dlz_newversion" },
+	{ (void *)0x0000000000092e10, "dlopen_dlz_allowzonexfr" },
+	{ (void *)0x0000000000092ee0, "dlopen_dlz_allnodes" },
+	{ (void *)0x0000000000092fb0, "dlopen_dlz_authority" },
+	{ (void *)0x0000000000093080, "dlopen_dlz_lookup" },
+	{ (void *)0x0000000000093150, "dlopen_dlz_findzonedb" },
+	{ (void *)0x0000000000093210, "dlopen_dlz_destroy" },
+	{ (void *)0x0000000000093360, "dlopen_log" },
+	{ (void *)0x0000000000093410, "dlopen_dlz_create" },
+	{ (void *)0x0000000000093ae0, "dlz_dlopen_init" },
+	{ (void *)0x0000000000093b60, "dlz_dlopen_clear" },
+	{ (void *)0x0000000000093ba0, "lwres_free" },
+	{ (void *)0x0000000000093bb0, "lwres_malloc" },
+	{ (void *)0x0000000000093be0, "lwres_context_create" },
+	{ (void *)0x0000000000093d30, "lwres_context_destroy" },
+	{ (void *)0x0000000000093d90, "lwres_context_nextserial" },
+	{ (void *)0x0000000000093dc0, "lwres_context_initserial" },
+	{ (void *)0x0000000000093df0, "lwres_context_freemem" },
+	{ (void *)0x0000000000093e50, "lwres_context_allocmem" },
+	{ (void *)0x0000000000093e90, "lwres_context_getsocket" },
+	{ (void *)0x0000000000093ea0, "lwres_context_send" },
+	{ (void *)0x0000000000094070, "lwres_context_recv" },
+	{ (void *)0x0000000000094170, "lwres_context_sendrecv" },
+	{ (void *)0x0000000000094250, "lwres_buffer_init" },
+	{ (void *)0x00000000000942a0, "lwres_buffer_invalidate" },
+	{ (void *)0x00000000000942f0, "lwres_buffer_add" },
+	{ (void *)0x0000000000094350, "lwres_buffer_subtract" },
+	{ (void *)0x00000000000943c0, "lwres_buffer_clear" },
+	{ (void *)0x0000000000094400, "lwres_buffer_first" },
+	{ (void *)0x0000000000094440, "lwres_buffer_forward" },
+	{ (void *)0x00000000000944a0, "lwres_buffer_back" },
+	{ (void *)0x0000000000094500, "lwres_buffer_getuint8" },
+	{ (void *)0x0000000000094570, "lwres_buffer_putuint8" },
+	{ (void *)0x00000000000945e0, "lwres_buffer_getuint16" },
+	{ (void *)0x0000000000094660, "lwres_buffer_putuint16" },
+	{ (void *)0x00000000000946d0, "lwres_buffer_getuint32" },
+	{ (void *)0x0000000000094740, "lwres_buffer_putuint32" },
+	{ (void *)0x00000000000947b0, "lwres_buffer_putmem" },
+	{ (void *)0x0000000000094830, "lwres_buffer_getmem" },
+	{ (void *)0x00000000000948b0, "lwres_create_addr" },
+	{ (void *)0x0000000000094960, "lwres_strdup" },
+	{ (void *)0x00000000000949d0, "eatwhite" },
+	{ (void *)0x0000000000094a70, "getword.constprop.0" },
+	{ (void *)0x0000000000094af0, "lwres_conf_init" },
+	{ (void *)0x0000000000094bd0, "lwres_conf_clear" },
+	{ (void *)0x0000000000094d30, "lwres_conf_parse" },
+	{ (void *)0x0000000000095630, "lwres_conf_print" },
+	{ (void *)0x0000000000095a50, "lwres_conf_get" },
+	{ (void *)0x0000000000095a80, "lwres_lwpacket_renderheader" },
+	{ (void *)0x0000000000095b60, "lwres_lwpacket_parseheader" },
+	{ (void *)0x0000000000095c60, "lwres_gabnrequest_render" },
+	{ (void *)0x0000000000095ec0, "lwres_gabnresponse_render" },
+	{ (void *)0x0000000000096200, "lwres_gabnrequest_parse" },
+	{ (void *)0x0000000000096380, "lwres_gabnresponse_parse" },
+	{ (void *)0x0000000000096820, "lwres_gabnrequest_free" },
+	{ (void *)0x00000000000968a0, "lwres_gabnresponse_free" },
+	{ (void *)0x00000000000969f0, "lwres_gnbarequest_render" },
+	{ (void *)0x0000000000096c40, "lwres_gnbaresponse_render" },
+	{ (void *)0x0000000000096ed0, "lwres_gnbaresponse_parse" },
+	{ (void *)0x0000000000097160, "lwres_gnbarequest_free" },
+	{ (void *)0x00000000000971e0, "lwres_gnbarequest_parse" },
+	{ (void *)0x0000000000097340, "lwres_gnbaresponse_free" },
+	{ (void *)0x0000000000097410, "lwres_grbnrequest_render" },
+	{ (void *)0x0000000000097680, "lwres_grbnresponse_render" },
+	{ (void *)0x00000000000979c0, "lwres_grbnrequest_parse" },
+	{ (void *)0x0000000000097b60, "lwres_grbnresponse_parse" },
+	{ (void *)0x0000000000097f10, "lwres_grbnrequest_free" },
+	{ (void *)0x0000000000097f90, "lwres_grbnresponse_free" },
+	{ (void *)0x0000000000098090, "lwres_nooprequest_render" },
+	{ (void *)0x0000000000098270, "lwres_noopresponse_render" },
+	{ (void *)0x0000000000098450, "lwres_nooprequest_parse" },
+	{ (void *)0x00000000000985d0, "lwres_noopresponse_parse" },
+	{ (void *)0x0000000000098750, "lwres_noopresponse_free" },
+	{ (void *)0x00000000000987d0, "lwres_nooprequest_free" },
+	{ (void *)0x0000000000098850, "lwres_net_aton" },
+	{ (void *)0x0000000000098aa0, "inet_pton4" },
+	{ (void *)0x0000000000098ba0, "lwres_net_pton" },
+	{ (void *)0x0000000000098e10, "lwres_net_ntop" },
+	{ (void *)0x00000000000991a0, "lwres_data_parse" },
+	{ (void *)0x0000000000099250, "lwres_string_parse" },
+	{ (void *)0x0000000000099310, "lwres_addr_parse" },
+	{ (void *)0x00000000000993b0, "lwres_getaddrsbyname" },
+	{ (void *)0x00000000000996e0, "lwres_getnamebyaddr" },
+	{ (void *)0x0000000000099a10, "lwres_getrdatabyname" },
+	{ (void *)0x0000000000099d30, "destroy" },
+	{ (void *)0x0000000000099e80, "clear_entry" },
+	{ (void *)0x000000000009a140, "water" },
+	{ (void *)0x000000000009a280, "finddbent.part.0" },
+	{ (void *)0x000000000009a2a0, "unlink_dbentries" },
+	{ (void *)0x000000000009a670, "dns_acache_create" },
+	{ (void *)0x000000000009ad70, "dns_acache_attach" },
+	{ (void *)0x000000000009adf0, "dns_acache_countquerymiss" },
+	{ (void *)0x000000000009ae10, "dns_acache_detach" },
+	{ (void *)0x000000000009aef0, "dns_acache_shutdown" },
+	{ (void *)0x000000000009b030, "dns_acache_setdb" },
+	{ (void *)0x000000000009b290, "dns_acache_createentry" },
+	{ (void *)0x000000000009b4a0, "dns_acache_getentry" },
+	{ (void *)0x000000000009ba00, "dns_acache_cancelentry" },
+	{ (void *)0x000000000009bbc0, "dns_acache_attachentry" },
+	{ (void *)0x000000000009bc40, "begin_cleaning" },
+	{ (void *)0x000000000009bdc0, "acache_overmem_cleaning_action" },
+	{ (void *)0x000000000009bf20, "acache_cleaning_timer_action" },
+	{ (void *)0x000000000009bfc0, "dns_acache_setentry" },
+	{ (void *)0x000000000009c590, "dns_acache_detachentry" },
+	{ (void *)0x000000000009c6f0, "shutdown_task" },
+	{ (void *)0x000000000009cc20, "dns_acache_putdb" },
+	{ (void *)0x000000000009d530, "dns_acache_setcleaninginterval" },
+	{ (void *)0x000000000009d6b0, "end_cleaning" },
+	{ (void *)0x000000000009daa0, "acache_incremental_cleaning_action" },
+	{ (void *)0x000000000009e0d0, "acache_cleaner_shutdown_action" },
+	{ (void *)0x000000000009e2c0, "dns_acache_setcachesize" },
+	{ (void *)0x000000000009e360, "is_insecure" },
+	{ (void *)0x000000000009e3e0, "initialize_action" },
+	{ (void *)0x000000000009e420, "dns_acl_isany" },
+	{ (void *)0x000000000009e480, "dns_acl_isnone" },
+	{ (void *)0x000000000009e4f0, "dns_aclelement_match" },
+	{ (void *)0x000000000009e5f0, "dns_acl_match" },
+	{ (void *)0x000000000009ea20, "dns_acl_attach" },
+	{ (void *)0x000000000009ea80, "dns_acl_merge" },
+	{ (void *)0x000000000009ed10, "dns_acl_detach" },
+	{ (void *)0x000000000009eee0, "dns_acl_create" },
+	{ (void *)0x000000000009f040, "dns_acl_none" },
+	{ (void *)0x000000000009f0b0, "dns_acl_any" },
+	{ (void *)0x000000000009f130, "dns_acl_isinsecure" },
+	{ (void *)0x000000000009f2a0, "dns_aclenv_init" },
+	{ (void *)0x000000000009f310, "dns_aclenv_copy" },
+	{ (void *)0x000000000009f350, "dns_aclenv_destroy" },
+	{ (void *)0x000000000009f370, "unlink_entry" },
+	{ (void *)0x000000000009f670, "unlink_name" },
+	{ (void *)0x000000000009f960, "shutdown_task" },
+	{ (void *)0x000000000009fe50, "event_free" },
+	{ (void *)0x000000000009ff20, "dec_adb_irefcnt" },
+	{ (void *)0x00000000000a0140, "DP" },
+	{ (void *)0x00000000000a01f0, "clean_finds_at_name" },
+	{ (void *)0x00000000000a0580, "set_target" },
+	{ (void *)0x00000000000a0810, "check_exit.part.0" },
+	{ (void *)0x00000000000a0840, "water" },
+	{ (void *)0x00000000000a0890, "entry_is_lame" },
+	{ (void *)0x00000000000a0a80, "free_adbfetch.part.0" },
+	{ (void *)0x00000000000a0ab0, "print_dns_name" },
+	{ (void *)0x00000000000a0b10, "free_adbentry" },
+	{ (void *)0x00000000000a0e20, "check_expire_entry" },
+	{ (void *)0x00000000000a0f20, "cleanup_entries" },
+	{ (void *)0x00000000000a1050, "find_entry_and_lock" },
+	{ (void *)0x00000000000a1360, "link_entry" },
+	{ (void *)0x00000000000a1620, "free_adbname" },
+	{ (void *)0x00000000000a1850, "clean_namehooks" },
+	{ (void *)0x00000000000a1c50, "dump_entry.constprop.0" },
+	{ (void *)0x00000000000a1de0, "check_expire_namehooks" },
+	{ (void *)0x00000000000a1fc0, "kill_name" },
+	{ (void *)0x00000000000a2360, "check_expire_name" },
+	{ (void *)0x00000000000a2430, "cleanup_names" },
+	{ (void *)0x00000000000a25d0, "fetch_name" },
+	{ (void *)0x00000000000a2940, "import_rdataset" },
+	{ (void *)0x00000000000a30f0, "fetch_callback" },
+	{ (void *)0x00000000000a3820, "dbfind_name" },
+	{ (void *)0x00000000000a3db0, "grow_names" },
+	{ (void *)0x00000000000a4810, "grow_entries" },
+	{ (void *)0x00000000000a5260, "dns_adb_create" },
+	{ (void *)0x00000000000a62f0, "dns_adb_attach" },
+	{ (void *)0x00000000000a63d0, "dns_adb_detach" },
+	{ (void *)0x00000000000a65c0, "dns_adb_whenshutdown" },
+	{ (void *)0x00000000000a67b0, "dns_adb_shutdown" },
+	{ (void *)0x00000000000a6bc0, "dns_adb_createfind" },
+	{ (void *)0x00000000000a85b0, "dns_adb_destroyfind" },
+	{ (void *)0x00000000000a8ce0, "dns_adb_cancelfind" },
+	{ (void *)0x00000000000a90d0, "dns_adb_dump" },
+	{ (void *)0x00000000000a9750, "dns_adb_dumpfind" },
+	{ (void *)0x00000000000a9900, "dns_adb_marklame" },
+	{ (void *)0x00000000000a9b80, "dns_adb_adjustsrtt" },
+	{ (void *)0x00000000000a9d40, "dns_adb_changeflags" },
+	{ (void *)0x00000000000a9eb0, "dns_adb_noedns" },
+	{ (void *)0x00000000000aa050, "dns_adb_plainresponse" },
+	{ (void *)0x00000000000aa190, "dns_adb_timeout" },
+	{ (void *)0x00000000000aa310, "dns_adb_ednsto" },
+	{ (void *)0x00000000000aa540, "dns_adb_setudpsize" },
+	{ (void *)0x00000000000aa6d0, "dns_adb_getudpsize" },
+	{ (void *)0x00000000000aa7d0, "dns_adb_probesize" },
+	{ (void *)0x00000000000aa900, "dns_adb_setsit" },
+	{ (void *)0x00000000000aab90, "dns_adb_getsit" },
+	{ (void *)0x00000000000aacf0, "dns_adb_findaddrinfo" },
+	{ (void *)0x00000000000ab130, "dns_adb_freeaddrinfo" },
+	{ (void *)0x00000000000ab4d0, "dns_adb_flush" },
+	{ (void *)0x00000000000ab630, "dns_adb_flushname" },
+	{ (void *)0x00000000000ab810, "dns_adb_flushnames" },
+	{ (void *)0x00000000000aba00, "dns_adb_setadbsize" },
+	{ (void *)0x00000000000abaa0, "lookup_done" },
+	{ (void *)0x00000000000abce0, "bevent_destroy" },
+	{ (void *)0x00000000000abe50, "dns_byaddr_createptrname2" },
+	{ (void *)0x00000000000abfb0, "dns_byaddr_createptrname" },
+	{ (void *)0x00000000000abfc0, "dns_byaddr_create" },
+	{ (void *)0x00000000000ac2b0, "dns_byaddr_cancel" },
+	{ (void *)0x00000000000ac380, "dns_byaddr_destroy" },
+	{ (void *)0x00000000000ac4a0, "begin_cleaning" },
+	{ (void *)0x00000000000ac680, "overmem_cleaning_action" },
+	{ (void *)0x00000000000ac810, "cleaning_timer_action" },
+	{ (void *)0x00000000000ac8d0, "cache_free" },
+	{ (void *)0x00000000000acbb0, "water" },
+	{ (void *)0x00000000000accb0, "clearnode" },
+	{ (void *)0x00000000000acd90, "cleartree" },
+	{ (void *)0x00000000000acf40, "getcounter" },
+	{ (void *)0x00000000000acf70, "cache_cleaner_init.constprop.0" },
+	{ (void *)0x00000000000ad230, "dns_cache_create3" },
+	{ (void *)0x00000000000ad920, "dns_cache_create" },
+	{ (void *)0x00000000000ad950, "dns_cache_create2" },
+	{ (void *)0x00000000000ad980, "dns_cache_attach" },
+	{ (void *)0x00000000000ada60, "dns_cache_attachdb" },
+	{ (void *)0x00000000000adb60, "dns_cache_setfilename" },
+	{ (void *)0x00000000000adc80, "dns_cache_load" },
+	{ (void *)0x00000000000add40, "dns_cache_dump" },
+	{ (void *)0x00000000000ade10, "dns_cache_detach" },
+	{ (void *)0x00000000000adfd0, "dns_cache_setcleaninginterval" },
+	{ (void *)0x00000000000ae0f0, "end_cleaning" },
+	{ (void *)0x00000000000ae1c0, "incremental_cleaning_action" },
+	{ (void *)0x00000000000ae5a0, "cleaner_shutdown_action" },
+	{ (void *)0x00000000000ae720, "dns_cache_getcleaninginterval" },
+	{ (void *)0x00000000000ae7d0, "dns_cache_getname" },
+	{ (void *)0x00000000000ae800, "dns_cache_clean" },
+	{ (void *)0x00000000000ae940, "dns_cache_setcachesize" },
+	{ (void *)0x00000000000aeaa0, "dns_cache_getcachesize" },
+	{ (void *)0x00000000000aeb50, "dns_cache_flush" },
+	{ (void *)0x00000000000aed10, "dns_cache_flushnode" },
+	{ (void *)0x00000000000aee80, "dns_cache_flushname" },
+	{ (void *)0x00000000000aee90, "dns_cache_getstats" },
+	{ (void *)0x00000000000aeec0, "dns_cache_updatestats" },
+	{ (void *)0x00000000000aef30, "dns_cache_dumpstats" },
+	{ (void *)0x00000000000af190, "dns_clientinfomethods_init" },
+	{ (void *)0x00000000000af1a0, "dns_clientinfo_init" },
+	{ (void *)0x00000000000af1b0, "dns_compress_init" },
+	{ (void *)0x00000000000af250, "dns_compress_invalidate" },
+	{ (void *)0x00000000000af310, "dns_compress_setmethods" },
+	{ (void *)0x00000000000af350, "dns_compress_getmethods" },
+	{ (void *)0x00000000000af380, "dns_compress_setsensitive" },
+	{ (void *)0x00000000000af3c0, "dns_compress_getsensitive" },
+	{ (void *)0x00000000000af400, "dns_compress_getedns" },
+	{ (void *)0x00000000000af430, "dns_compress_findglobal" },
+	{ (void *)0x00000000000af6d0, "dns_compress_add" },
+	{ (void *)0x00000000000af8b0, "dns_compress_rollback" },
+	{ (void *)0x00000000000af980, "dns_decompress_init" },
+	{ (void *)0x00000000000af9e0, "dns_decompress_invalidate" },
+	{ (void *)0x00000000000afa10, "dns_decompress_setmethods" },
+	{ (void *)0x00000000000afa70, "dns_decompress_getmethods" },
+	{ (void *)0x00000000000afaa0, "dns_decompress_edns" },
+	{ (void *)0x00000000000afad0, "dns_decompress_type" },
+	{ (void *)0x00000000000afb00, "queue_walk" },
+	{ (void *)0x00000000000afb90, "queue_makehash" },
+	{ (void *)0x00000000000afc30, "extract_prefix" },
+	{ (void *)0x00000000000afd70, "sketch_init" },
+	{ (void *)0x00000000000b00e0, "queue_growfield" },
+	{ (void *)0x00000000000b01a0, "queue_init" },
+	{ (void *)0x00000000000b0420, "sketch_destroy" },
+	{ (void *)0x00000000000b0520, "queue_rehash" },
+	{ (void *)0x00000000000b0660, "queue_destroy" },
+	{ (void *)0x00000000000b0790, "level_prefixlen.part.0" },
+	{ (void *)0x00000000000b07c0, "shard_hash" },
+	{ (void *)0x00000000000b0830, "sketch_walk" },
+	{ (void *)0x00000000000b08b0, "dns_dampening_handle_init.part.0" },
+	{ (void *)0x00000000000b08d0, "sketch_getstats" },
+	{ (void *)0x00000000000b0990, "sketch_heavy" },
+	{ (void *)0x00000000000b0a00, "sketch_delete" },
+	{ (void *)0x00000000000b0ae0, "queue_getstats" },
+	{ (void *)0x00000000000b0ba0, "queue_search" },
+	{ (void *)0x00000000000b0d40, "filter_probe" },
+	{ (void *)0x00000000000b0f80, "queue_delete" },
+	{ (void *)0x00000000000b11d0, "shard_of" },
+	{ (void *)0x00000000000b12e0, "sketch_search" },
+	{ (void *)0x00000000000b1490, "handle_resolve" },
+	{ (void *)0x00000000000b1620, "handle_entry" },
+	{ (void *)0x00000000000b1740, "handle_apply" },
+	{ (void *)0x00000000000b1af0, "filter_charge" },
+	{ (void *)0x00000000000b1ee0, "dns_dampening_prefixlen" },
+	{ (void *)0x00000000000b1f80, "log_dampening" },
+	{ (void *)0x00000000000b20d0, "save_entry" },
+	{ (void *)0x00000000000b2200, "dns_dampening_setdecay" },
+	{ (void *)0x00000000000b2310, "dns_dampening_decay" },
+	{ (void *)0x00000000000b2390, "update_penalty" },
+	{ (void *)0x00000000000b2560, "queue_update" },
+	{ (void *)0x00000000000b2750, "queue_add" },
+	{ (void *)0x00000000000b2ae0, "top_entry" },
+	{ (void *)0x00000000000b2c90, "restore_entry" },
+	{ (void *)0x00000000000b2f70, "merge_entry" },
+	{ (void *)0x00000000000b2fb0, "sketch_raise" },
+	{ (void *)0x00000000000b3040, "sketch_update" },
+	{ (void *)0x00000000000b36b0, "sketch_add" },
+	{ (void *)0x00000000000b3760, "dns_dampening_handle_init" },
+	{ (void *)0x00000000000b37b0, "dns_dampening_query" },
+	{ (void *)0x00000000000b4900, "dns_dampening_score_qtype" },
+	{ (void *)0x00000000000b49e0, "dns_dampening_score_size" },
+	{ (void *)0x00000000000b4ad0, "dns_dampening_flush" },
+	{ (void *)0x00000000000b4b60, "dns_dampening_filter_create" },
+	{ (void *)0x00000000000b4ce0, "dns_dampening_filter_attach" },
+	{ (void *)0x00000000000b4d60, "dns_dampening_filter_detach" },
+	{ (void *)0x00000000000b4e80, "dns_dampening_filter_lookup" },
+	{ (void *)0x00000000000b4ee0, "dns_dampening_filter_check" },
+	{ (void *)0x00000000000b4fe0, "dns_dampening_attach" },
+	{ (void *)0x00000000000b5060, "dns_dampening_initshared" },
+	{ (void *)0x00000000000b51f0, "dns_dampening_detach" },
+	{ (void *)0x00000000000b5500, "dns_dampening_create" },
+	{ (void *)0x00000000000b5890, "dns_dampening_init" },
+	{ (void *)0x00000000000b5900, "dns_dampening_destroy" },
+	{ (void *)0x00000000000b5990, "dns_dampening_getstats" },
+	{ (void *)0x00000000000b5b20, "dns_dampening_top" },
+	{ (void *)0x00000000000b5c70, "dns_dampening_merge" },
+	{ (void *)0x00000000000b5dd0, "dns_dampening_save" },
+	{ (void *)0x00000000000b6080, "dns_dampening_restore" },
+	{ (void *)0x00000000000b6450, "initialize" },
+	{ (void *)0x00000000000b6530, "dns_db_iszone.part.0" },
+	{ (void *)0x00000000000b6550, "dns_db_origin.part.0" },
+	{ (void *)0x00000000000b6570, "dns_db_create" },
+	{ (void *)0x00000000000b6770, "dns_db_attach" },
+	{ (void *)0x00000000000b6800, "dns_db_detach" },
+	{ (void *)0x00000000000b6880, "dns_db_ondestroy" },
+	{ (void *)0x00000000000b68c0, "dns_db_iscache" },
+	{ (void *)0x00000000000b68f0, "dns_db_iszone" },
+	{ (void *)0x00000000000b6910, "dns_db_isstub" },
+	{ (void *)0x00000000000b6950, "dns_db_isdnssec" },
+	{ (void *)0x00000000000b69c0, "dns_db_issecure" },
+	{ (void *)0x00000000000b6a20, "dns_db_ispersistent" },
+	{ (void *)0x00000000000b6a60, "dns_db_origin" },
+	{ (void *)0x00000000000b6a80, "dns_db_class" },
+	{ (void *)0x00000000000b6ab0, "dns_db_beginload" },
+	{ (void *)0x00000000000b6b10, "dns_db_endload" },
+	{ (void *)0x00000000000b6ba0, "dns_db_load3" },
+	{ (void *)0x00000000000b6c70, "dns_db_load" },
+	{ (void *)0x00000000000b6c80, "dns_db_load2" },
+	{ (void *)0x00000000000b6c90, "dns_db_serialize" },
+	{ (void *)0x00000000000b6ce0, "dns_db_dump" },
+	{ (void *)0x00000000000b6cf0, "dns_db_dump2" },
+	{ (void *)0x00000000000b6d20, "dns_db_currentversion" },
+	{ (void *)0x00000000000b6da0, "dns_db_newversion" },
+	{ (void *)0x00000000000b6e20, "dns_db_attachversion" },
+	{ (void *)0x00000000000b6ee0, "dns_db_closeversion" },
+	{ (void *)0x00000000000b6f80, "dns_db_findnode" },
+	{ (void *)0x00000000000b7000, "dns_db_findnodeext" },
+	{ (void *)0x00000000000b7080, "dns_db_findnsec3node" },
+	{ (void *)0x00000000000b70f0, "dns_db_find" },
+	{ (void *)0x00000000000b72e0, "dns_db_findext" },
+	{ (void *)0x00000000000b7520, "dns_db_findzonecut" },
+	{ (void *)0x00000000000b7660, "dns_db_attachnode" },
+	{ (void *)0x00000000000b76e0, "dns_db_detachnode" },
+	{ (void *)0x00000000000b7760, "dns_db_transfernode" },
+	{ (void *)0x00000000000b7830, "dns_db_expirenode" },
+	{ (void *)0x00000000000b78b0, "dns_db_printnode" },
+	{ (void *)0x00000000000b7910, "dns_db_createiterator" },
+	{ (void *)0x00000000000b7980, "dns_db_findrdataset" },
+	{ (void *)0x00000000000b7b20, "dns_db_allrdatasets" },
+	{ (void *)0x00000000000b7b90, "dns_db_addrdataset" },
+	{ (void *)0x00000000000b7d70, "dns_db_subtractrdataset" },
+	{ (void *)0x00000000000b7f00, "dns_db_deleterdataset" },
+	{ (void *)0x00000000000b7fa0, "dns_db_overmem" },
+	{ (void *)0x00000000000b7fe0, "dns_db_getsoaserial" },
+	{ (void *)0x00000000000b81a0, "dns_db_nodecount" },
+	{ (void *)0x00000000000b81e0, "dns_db_hashsize" },
+	{ (void *)0x00000000000b8230, "dns_db_settask" },
+	{ (void *)0x00000000000b8270, "dns_db_register" },
+	{ (void *)0x00000000000b84e0, "dns_db_unregister" },
+	{ (void *)0x00000000000b8730, "dns_db_getoriginnode" },
+	{ (void *)0x00000000000b87d0, "dns_db_getrrsetstats" },
+	{ (void *)0x00000000000b8810, "dns_db_setcachestats" },
+	{ (void *)0x00000000000b8860, "dns_db_getnsec3parameters" },
+	{ (void *)0x00000000000b88e0, "dns_db_setsigningtime" },
+	{ (void *)0x00000000000b8900, "dns_db_getsigningtime" },
+	{ (void *)0x00000000000b8920, "dns_db_resigned" },
+	{ (void *)0x00000000000b8940, "dns_db_rpz_attach" },
+	{ (void *)0x00000000000b8970, "dns_db_rpz_ready" },
+	{ (void *)0x00000000000b8990, "dns_dbiterator_destroy" },
+	{ (void *)0x00000000000b8a10, "dns_dbiterator_first" },
+	{ (void *)0x00000000000b8a40, "dns_dbiterator_last" },
+	{ (void *)0x00000000000b8a70, "dns_dbiterator_seek" },
+	{ (void *)0x00000000000b8aa0, "dns_dbiterator_prev" },
+	{ (void *)0x00000000000b8ad0, "dns_dbiterator_next" },
+	{ (void *)0x00000000000b8b00, "dns_dbiterator_current" },
+	{ (void *)0x00000000000b8ba0, "dns_dbiterator_pause" },
+	{ (void *)0x00000000000b8bd0, "dns_dbiterator_origin" },
+	{ (void *)0x00000000000b8c60, "dns_dbiterator_setcleanmode" },
+	{ (void *)0x00000000000b8c90, "diff_apply" },
+	{ (void *)0x00000000000b93c0, "dns_difftuple_create" },
+	{ (void *)0x00000000000b9540, "dns_difftuple_free" },
+	{ (void *)0x00000000000b95c0, "dns_difftuple_copy" },
+	{ (void *)0x00000000000b95e0, "dns_diff_init" },
+	{ (void *)0x00000000000b9600, "dns_diff_clear" },
+	{ (void *)0x00000000000b9750, "dns_diff_append" },
+	{ (void *)0x00000000000b97a0, "dns_diff_appendminimal" },
+	{ (void *)0x00000000000b9a10, "dns_diff_apply" },
+	{ (void *)0x00000000000b9a20, "dns_diff_applysilently" },
+	{ (void *)0x00000000000b9a30, "dns_diff_load" },
+	{ (void *)0x00000000000b9c80, "dns_diff_sort" },
+	{ (void *)0x00000000000b9f20, "dns_diff_print" },
+	{ (void *)0x00000000000ba2e0, "qid_destroy" },
+	{ (void *)0x00000000000ba3c0, "qid_allocate" },
+	{ (void *)0x00000000000ba680, "mgr_log" },
+	{ (void *)0x00000000000ba790, "destroy_mgr_ok" },
+	{ (void *)0x00000000000ba840, "dispatch_log" },
+	{ (void *)0x00000000000ba950, "destroy_mgr" },
+	{ (void *)0x00000000000bac50, "deref_portentry" },
+	{ (void *)0x00000000000baeb0, "destroy_dispsocket" },
+	{ (void *)0x00000000000bb160, "free_sevent" },
+	{ (void *)0x00000000000bb180, "free_buffer" },
+	{ (void *)0x00000000000bb330, "allocate_udp_buffer" },
+	{ (void *)0x00000000000bb450, "dispatch_free" },
+	{ (void *)0x00000000000bb6d0, "destroy_disp" },
+	{ (void *)0x00000000000bbab0, "entry_search" },
+	{ (void *)0x00000000000bbb80, "request_log" },
+	{ (void *)0x00000000000bbd00, "open_socket" },
+	{ (void *)0x00000000000bbe20, "deactivate_dispsocket" },
+	{ (void *)0x00000000000bc260, "portavailable.constprop.0" },
+	{ (void *)0x00000000000bc3d0, "do_cancel.part.0" },
+	{ (void *)0x00000000000bc600, "dispatch_random" },
+	{ (void *)0x00000000000bc820, "dispatch_allocate.constprop.0" },
+	{ (void *)0x00000000000bcb40, "dispatch_createudp" },
+	{ (void *)0x00000000000bd510, "startrecv" },
+	{ (void *)0x00000000000bd8d0, "tcp_recv" },
+	{ (void *)0x00000000000bdfe0, "udp_recv" },
+	{ (void *)0x00000000000bea50, "udp_shrecv" },
+	{ (void *)0x00000000000bea90, "udp_exrecv" },
+	{ (void *)0x00000000000bead0, "dns_dispatchmgr_setblackhole" },
+	{ (void *)0x00000000000beb30, "dns_dispatchmgr_getblackhole" },
+	{ (void *)0x00000000000beb60, "dns_dispatchmgr_setblackportlist" },
+	{ (void *)0x00000000000beb90, "dns_dispatchmgr_getblackportlist" },
+	{ (void *)0x00000000000bebc0, "dns_dispatchmgr_setavailports" },
+	{ (void *)0x00000000000beee0, "dns_dispatchmgr_create" },
+	{ (void *)0x00000000000bf6c0, "dns_dispatchmgr_destroy" },
+	{ (void *)0x00000000000bf7d0, "dns_dispatchmgr_setstats" },
+	{ (void *)0x00000000000bf850, "dns_dispatch_createtcp" },
+	{ (void *)0x00000000000bfbc0, "dns_dispatch_getudp_dup" },
+	{ (void *)0x00000000000c0560, "dns_dispatch_getudp" },
+	{ (void *)0x00000000000c0590, "dns_dispatch_attach" },
+	{ (void *)0x00000000000c0670, "dns_dispatch_detach" },
+	{ (void *)0x00000000000c0840, "dns_dispatch_addresponse2" },
+	{ (void *)0x00000000000c20e0, "dns_dispatch_addresponse" },
+	{ (void *)0x00000000000c2140, "dns_dispatch_starttcp" },
+	{ (void *)0x00000000000c2210, "dns_dispatch_removeresponse" },
+	{ (void *)0x00000000000c2a10, "dns_dispatch_getsocket" },
+	{ (void *)0x00000000000c2a40, "dns_dispatch_getentrysocket" },
+	{ (void *)0x00000000000c2a80, "dns_dispatch_getlocaladdress" },
+	{ (void *)0x00000000000c2b70, "dns_dispatch_cancel" },
+	{ (void *)0x00000000000c2c60, "dns_dispatch_getattributes" },
+	{ (void *)0x00000000000c2c90, "dns_dispatch_changeattributes" },
+	{ (void *)0x00000000000c2e30, "dns_dispatch_importrecv" },
+	{ (void *)0x00000000000c3050, "dns_dispatchset_get" },
+	{ (void *)0x00000000000c3120, "dns_dispatchset_create" },
+	{ (void *)0x00000000000c34e0, "dns_dispatchset_cancelall" },
+	{ (void *)0x00000000000c3570, "dns_dispatchset_destroy" },
+	{ (void *)0x00000000000c3650, "dns_dispatch_setdscp" },
+	{ (void *)0x00000000000c3680, "dns_dispatch_getdscp" },
+	{ (void *)0x00000000000c36b0, "dns_dlzstrtoargvsub" },
+	{ (void *)0x00000000000c37f0, "dlz_initialize" },
+	{ (void *)0x00000000000c3850, "dns_dlzallowzonexfr" },
+	{ (void *)0x00000000000c3940, "dns_dlzcreate" },
+	{ (void *)0x00000000000c3d10, "dns_dlzdestroy" },
+	{ (void *)0x00000000000c3e30, "dns_dlzregister" },
+	{ (void *)0x00000000000c41a0, "dns_dlzstrtoargv" },
+	{ (void *)0x00000000000c41b0, "dns_dlzunregister" },
+	{ (void *)0x00000000000c4400, "dns_dlz_writeablezone" },
+	{ (void *)0x00000000000c4680, "dns_dlzconfigure" },
+	{ (void *)0x00000000000c4710, "dns_dlz_ssumatch" },
+	{ (void *)0x00000000000c47e0, "dns_dns64_create" },
+	{ (void *)0x00000000000c4aa0, "dns_dns64_destroy" },
+	{ (void *)0x00000000000c4b40, "dns_dns64_aaaafroma" },
+	{ (void *)0x00000000000c4ce0, "dns_dns64_next" },
+	{ (void *)0x00000000000c4cf0, "dns_dns64_append" },
+	{ (void *)0x00000000000c4d20, "dns_dns64_unlink" },
+	{ (void *)0x00000000000c4e00, "dns_dns64_aaaaok" },
+	{ (void *)0x00000000000c51c0, "rdata_compare_wrapper" },
+	{ (void *)0x00000000000c51d0, "digest_callback" },
+	{ (void *)0x00000000000c51e0, "digest_sig" },
+	{ (void *)0x00000000000c5310, "rdataset_to_sortedarray" },
+	{ (void *)0x00000000000c5440, "mark_active_keys" },
+	{ (void *)0x00000000000c55e0, "make_dnskey.constprop.0" },
+	{ (void *)0x00000000000c5660, "publish_key" },
+	{ (void *)0x00000000000c5810, "remove_key" },
+	{ (void *)0x00000000000c5910, "dns_dnssec_keyfromrdata" },
+	{ (void *)0x00000000000c5a60, "dns_dnssec_sign" },
+	{ (void *)0x00000000000c61e0, "dns_dnssec_verify3" },
+	{ (void *)0x00000000000c6ab0, "dns_dnssec_verify2" },
+	{ (void *)0x00000000000c6ad0, "dns_dnssec_verify" },
+	{ (void *)0x00000000000c6b00, "dns_dnssec_keyactive" },
+	{ (void *)0x00000000000c6c40, "dns_dnssec_findzonekeys2" },
+	{ (void *)0x00000000000c7220, "dns_dnssec_findzonekeys" },
+	{ (void *)0x00000000000c7240, "dns_dnssec_signmessage" },
+	{ (void *)0x00000000000c7820, "dns_dnssec_verifymessage" },
+	{ (void *)0x00000000000c7be0, "dns_dnssec_signs" },
+	{ (void *)0x00000000000c7dd0, "dns_dnssec_selfsigns" },
+	{ (void *)0x00000000000c7eb0, "dns_dnsseckey_create" },
+	{ (void *)0x00000000000c7fd0, "addkey" },
+	{ (void *)0x00000000000c8120, "dns_dnsseckey_destroy" },
+	{ (void *)0x00000000000c8190, "dns_dnssec_findmatchingkeys" },
+	{ (void *)0x00000000000c8820, "dns_dnssec_keylistfromrdataset" },
+	{ (void *)0x00000000000c8d50, "dns_dnssec_updatekeys" },
+	{ (void *)0x00000000000c96a0, "auto_detach" },
+	{ (void *)0x00000000000c97f0, "dns_fwdtable_create" },
+	{ (void *)0x00000000000c9900, "dns_fwdtable_addfwd" },
+	{ (void *)0x00000000000c9c50, "dns_fwdtable_add" },
+	{ (void *)0x00000000000c9fb0, "dns_fwdtable_delete" },
+	{ (void *)0x00000000000ca080, "dns_fwdtable_find2" },
+	{ (void *)0x00000000000ca160, "dns_fwdtable_find" },
+	{ (void *)0x00000000000ca170, "dns_fwdtable_destroy" },
+	{ (void *)0x00000000000ca200, "dyndb_initialize" },
+	{ (void *)0x00000000000ca260, "dns_dyndb_set_view.part.0" },
+	{ (void *)0x00000000000ca280, "dns_dyndb_set_zonemgr.part.0" },
+	{ (void *)0x00000000000ca2a0, "dns_dyndb_set_task.part.0" },
+	{ (void *)0x00000000000ca2c0, "load_symbol.constprop.0" },
+	{ (void *)0x00000000000ca360, "dns_dynamic_db_load" },
+	{ (void *)0x00000000000ca680, "dns_dynamic_db_cleanup" },
+	{ (void *)0x00000000000ca880, "dns_dyndb_arguments_create" },
+	{ (void *)0x00000000000ca8b0, "dns_dyndb_arguments_destroy" },
+	{ (void *)0x00000000000ca940, "dns_dyndb_set_view" },
+	{ (void *)0x00000000000ca990, "dns_dyndb_get_view" },
+	{ (void *)0x00000000000ca9c0, "dns_dyndb_set_zonemgr" },
+	{ (void *)0x00000000000caa10, "dns_dyndb_get_zonemgr" },
+	{ (void *)0x00000000000caa40, "dns_dyndb_set_task" },
+	{ (void *)0x00000000000caa90, "dns_dyndb_get_task" },
+	{ (void *)0x00000000000caac0, "dns_dyndb_set_timermgr" },
+	{ (void *)0x00000000000caaf0, "dns_dyndb_get_timermgr" },
+	{ (void *)0x00000000000cab20, "dns_iptable_addprefix" },
+	{ (void *)0x00000000000cade0, "dns_iptable_merge" },
+	{ (void *)0x00000000000caf30, "dns_iptable_attach" },
+	{ (void *)0x00000000000caf90, "dns_iptable_detach" },
+	{ (void *)0x00000000000cb0b0, "dns_iptable_create" },
+	{ (void *)0x00000000000cb160, "index_add" },
+	{ (void *)0x00000000000cb2a0, "ixfr_order" },
+	{ (void *)0x00000000000cb390, "journal_write" },
+	{ (void *)0x00000000000cb410, "journal_seek" },
+	{ (void *)0x00000000000cb490, "index_to_disk" },
+	{ (void *)0x00000000000cb570, "journal_read" },
+	{ (void *)0x00000000000cb600, "journal_read_xhdr" },
+	{ (void *)0x00000000000cb640, "journal_fsync" },
+	{ (void *)0x00000000000cb6d0, "size_buffer" },
+	{ (void *)0x00000000000cb750, "read_one_rr" },
+	{ (void *)0x00000000000cba70, "rdata_order" },
+	{ (void *)0x00000000000cbaa0, "journal_next" },
+	{ (void *)0x00000000000cbba0, "journal_find" },
+	{ (void *)0x00000000000cbcd0, "dns_journal_current_rr.part.0" },
+	{ (void *)0x00000000000cbcf0, "journal_header_encode" },
+	{ (void *)0x00000000000cbd50, "diff_namespace" },
+	{ (void *)0x00000000000ccb10, "journal_open" },
+	{ (void *)0x00000000000cd2a0, "dns_db_createsoatuple" },
+	{ (void *)0x00000000000cd3f0, "dns_journal_open" },
+	{ (void *)0x00000000000cd4b0, "dns_journal_begin_transaction" },
+	{ (void *)0x00000000000cd5a0, "dns_journal_writediff" },
+	{ (void *)0x00000000000cd870, "dns_journal_commit" },
+	{ (void *)0x00000000000cdbf0, "dns_journal_write_transaction" },
+	{ (void *)0x00000000000cdc50, "dns_journal_destroy" },
+	{ (void *)0x00000000000cddd0, "dns_journal_first_serial" },
+	{ (void *)0x00000000000cdde0, "dns_journal_last_serial" },
+	{ (void *)0x00000000000cddf0, "dns_journal_set_sourceserial" },
+	{ (void *)0x00000000000cde50, "dns_journal_get_sourceserial" },
+	{ (void *)0x00000000000cde90, "dns_journal_iter_init" },
+	{ (void *)0x00000000000cdf20, "dns_journal_rollforward" },
+	{ (void *)0x00000000000ce560, "dns_journal_print" },
+	{ (void *)0x00000000000ce9d0, "dns_journal_first_rr" },
+	{ (void *)0x00000000000cea70, "dns_journal_next_rr" },
+	{ (void *)0x00000000000cea90, "dns_journal_current_rr" },
+	{ (void *)0x00000000000ceac0, "dns_db_diffx" },
+	{ (void *)0x00000000000cec00, "dns_db_diff" },
+	{ (void *)0x00000000000cec60, "dns_journal_compact" },
+	{ (void *)0x00000000000cf4a0, "dns_keynode_detachall.part.0" },
+	{ (void *)0x00000000000cf4c0, "dns_keytable_create" },
+	{ (void *)0x00000000000cf620, "dns_keytable_attach" },
+	{ (void *)0x00000000000cf750, "dns_keytable_detach" },
+	{ (void *)0x00000000000cf940, "dns_keytable_delete" },
+	{ (void *)0x00000000000cfa80, "dns_keytable_finddeepestmatch" },
+	{ (void *)0x00000000000cfbd0, "dns_keytable_issecuredomain" },
+	{ (void *)0x00000000000cfd50, "dns_keytable_dump" },
+	{ (void *)0x00000000000cff20, "dns_keynode_key" },
+	{ (void *)0x00000000000cff50, "dns_keynode_managed" },
+	{ (void *)0x00000000000cff80, "dns_keynode_create" },
+	{ (void *)0x00000000000d0010, "dns_keynode_attach" },
+	{ (void *)0x00000000000d0070, "dns_keytable_find" },
+	{ (void *)0x00000000000d0270, "dns_keytable_nextkeynode" },
+	{ (void *)0x00000000000d03a0, "dns_keytable_findkeynode" },
+	{ (void *)0x00000000000d05f0, "dns_keytable_findnextkeynode" },
+	{ (void *)0x00000000000d0780, "dns_keytable_attachkeynode" },
+	{ (void *)0x00000000000d08a0, "dns_keynode_detach" },
+	{ (void *)0x00000000000d0960, "insert" },
+	{ (void *)0x00000000000d0bd0, "dns_keytable_add" },
+	{ (void *)0x00000000000d0c20, "dns_keytable_marksecure" },
+	{ (void *)0x00000000000d0c30, "dns_keytable_deletekeynode" },
+	{ (void *)0x00000000000d0e40, "dns_keytable_detachkeynode" },
+	{ (void *)0x00000000000d0f70, "free_keynode" },
+	{ (void *)0x00000000000d0fc0, "dns_keynode_detachall" },
+	{ (void *)0x00000000000d1030, "open_msgcat" },
+	{ (void *)0x00000000000d1050, "initialize" },
+	{ (void *)0x00000000000d1160, "dns_lib_initmsgcat" },
+	{ (void *)0x00000000000d11a0, "dns_lib_init" },
+	{ (void *)0x00000000000d1240, "dns_lib_shutdown" },
+	{ (void *)0x00000000000d1320, "dns_log_init" },
+	{ (void *)0x00000000000d1360, "dns_log_setcontext" },
+	{ (void *)0x00000000000d1370, "levent_destroy" },
+	{ (void *)0x00000000000d14b0, "lookup_find" },
+	{ (void *)0x00000000000d1e00, "fetch_done" },
+	{ (void *)0x00000000000d1eb0, "dns_lookup_create" },
+	{ (void *)0x00000000000d2150, "dns_lookup_cancel" },
+	{ (void *)0x00000000000d2240, "dns_lookup_destroy" },
+	{ (void *)0x00000000000d23c0, "limit_ttl" },
+	{ (void *)0x00000000000d2400, "grow_rdatalist" },
+	{ (void *)0x00000000000d2990, "grow_rdata" },
+	{ (void *)0x00000000000d2f80, "incctx_create" },
+	{ (void *)0x00000000000d30b0, "load_header" },
+	{ (void *)0x00000000000d3310, "load_map" },
+	{ (void *)0x00000000000d3390, "openfile_map" },
+	{ (void *)0x00000000000d33f0, "openfile_raw" },
+	{ (void *)0x00000000000d3450, "openfile_text" },
+	{ (void *)0x00000000000d3460, "read_and_check.part.0" },
+	{ (void *)0x00000000000d3490, "genname" },
+	{ (void *)0x00000000000d37f0, "gettoken" },
+	{ (void *)0x00000000000d38e0, "commit" },
+	{ (void *)0x00000000000d3c90, "generate" },
+	{ (void *)0x00000000000d4460, "pushfile" },
+	{ (void *)0x00000000000d4660, "load_raw" },
+	{ (void *)0x00000000000d52d0, "loadctx_create.constprop.0" },
+	{ (void *)0x00000000000d5820, "load_text" },
+	{ (void *)0x00000000000da0e0, "dns_loadctx_attach" },
+	{ (void *)0x00000000000da210, "dns_loadctx_detach" },
+	{ (void *)0x00000000000da4a0, "load_quantum" },
+	{ (void *)0x00000000000da580, "dns_master_loadfile5" },
+	{ (void *)0x00000000000da660, "dns_master_loadfile" },
+	{ (void *)0x00000000000da690, "dns_master_loadfile2" },
+	{ (void *)0x00000000000da6c0, "dns_master_loadfile3" },
+	{ (void *)0x00000000000da6f0, "dns_master_loadfile4" },
+	{ (void *)0x00000000000da720, "dns_master_loadfileinc5" },
+	{ (void *)0x00000000000da880, "dns_master_loadfileinc4" },
+	{ (void *)0x00000000000da8c0, "dns_master_loadfileinc" },
+	{ (void *)0x00000000000da900, "dns_master_loadfileinc2" },
+	{ (void *)0x00000000000da940, "dns_master_loadfileinc3" },
+	{ (void *)0x00000000000da980, "dns_master_loadstream" },
+	{ (void *)0x00000000000daa70, "dns_master_loadstreaminc" },
+	{ (void *)0x00000000000dabf0, "dns_master_loadbuffer" },
+	{ (void *)0x00000000000dace0, "dns_master_loadbufferinc" },
+	{ (void *)0x00000000000dae50, "dns_master_loadlexer" },
+	{ (void *)0x00000000000daf10, "dns_master_loadlexerinc" },
+	{ (void *)0x00000000000db050, "dns_loadctx_cancel" },
+	{ (void *)0x00000000000db100, "dns_master_initrawheader" },
+	{ (void *)0x00000000000db110, "dump_rdatasets_map" },
+	{ (void *)0x00000000000db120, "indent" },
+	{ (void *)0x00000000000db290, "totext_ctx_init" },
+	{ (void *)0x00000000000db450, "question_totext" },
+	{ (void *)0x00000000000db5c0, "dump_rdatasets_raw" },
+	{ (void *)0x00000000000dba40, "dumptostreaminc" },
+	{ (void *)0x00000000000dc070, "flushandsync" },
+	{ (void *)0x00000000000dc170, "closeandrename" },
+	{ (void *)0x00000000000dc290, "opentmp.constprop.0" },
+	{ (void *)0x00000000000dc3c0, "dumpctx_create.constprop.0" },
+	{ (void *)0x00000000000dc680, "dump_order_compare" },
+	{ (void *)0x00000000000dc6e0, "rdataset_totext" },
+	{ (void *)0x00000000000dce70, "dump_rdatasets_text" },
+	{ (void *)0x00000000000dd390, "dns_rdataset_totext" },
+	{ (void *)0x00000000000dd440, "dns_master_rdatasettotext" },
+	{ (void *)0x00000000000dd4c0, "dns_master_questiontotext" },
+	{ (void *)0x00000000000dd540, "dns_dumpctx_attach" },
+	{ (void *)0x00000000000dd660, "dns_dumpctx_detach" },
+	{ (void *)0x00000000000dd870, "dump_quantum" },
+	{ (void *)0x00000000000dd9c0, "dns_dumpctx_version" },
+	{ (void *)0x00000000000dd9f0, "dns_dumpctx_db" },
+	{ (void *)0x00000000000dda20, "dns_dumpctx_cancel" },
+	{ (void *)0x00000000000ddac0, "dns_master_dumptostreaminc" },
+	{ (void *)0x00000000000ddc20, "dns_master_dumptostream" },
+	{ (void *)0x00000000000ddcb0, "dns_master_dumptostream2" },
+	{ (void *)0x00000000000ddd40, "dns_master_dumptostream3" },
+	{ (void *)0x00000000000dddd0, "dns_master_dumpinc3" },
+	{ (void *)0x00000000000de000, "dns_master_dumpinc" },
+	{ (void *)0x00000000000de020, "dns_master_dumpinc2" },
+	{ (void *)0x00000000000de050, "dns_master_dump3" },
+	{ (void *)0x00000000000de170, "dns_master_dump" },
+	{ (void *)0x00000000000de190, "dns_master_dump2" },
+	{ (void *)0x00000000000de1a0, "dns_master_dumpnodetostream" },
+	{ (void *)0x00000000000de2f0, "dns_master_dumpnode" },
+	{ (void *)0x00000000000de440, "dns_master_stylecreate" },
+	{ (void *)0x00000000000de500, "dns_master_stylecreate2" },
+	{ (void *)0x00000000000de5c0, "dns_master_styledestroy" },
+	{ (void *)0x00000000000de610, "spacefortsig" },
+	{ (void *)0x00000000000de670, "currentbuffer.part.0" },
+	{ (void *)0x00000000000de6a0, "getname" },
+	{ (void *)0x00000000000de7b0, "newrdata" },
+	{ (void *)0x00000000000de9b0, "dns_message_resetsig.part.0" },
+	{ (void *)0x00000000000de9d0, "newrdatalist" },
+	{ (void *)0x00000000000debc0, "getrdata" },
+	{ (void *)0x00000000000ded20, "getsection" },
+	{ (void *)0x00000000000dfa10, "dns_message_create" },
+	{ (void *)0x00000000000dfed0, "dns_message_find" },
+	{ (void *)0x00000000000dff50, "dns_message_findtype" },
+	{ (void *)0x00000000000dffe0, "dns_message_parse" },
+	{ (void *)0x00000000000e0a30, "dns_message_renderbegin" },
+	{ (void *)0x00000000000e0b30, "dns_message_renderchangebuffer" },
+	{ (void *)0x00000000000e0c20, "dns_message_renderrelease" },
+	{ (void *)0x00000000000e0c80, "msgresetopt" },
+	{ (void *)0x00000000000e0d20, "msgresetsigs" },
+	{ (void *)0x00000000000e1010, "msgreset" },
+	{ (void *)0x00000000000e1e20, "dns_message_reset" },
+	{ (void *)0x00000000000e1ea0, "dns_message_destroy" },
+	{ (void *)0x00000000000e1f40, "dns_message_renderreserve" },
+	{ (void *)0x00000000000e1fc0, "dns_message_rendersection" },
+	{ (void *)0x00000000000e2690, "dns_message_renderheader" },
+	{ (void *)0x00000000000e27d0, "dns_message_firstname" },
+	{ (void *)0x00000000000e2840, "dns_message_nextname" },
+	{ (void *)0x00000000000e28d0, "dns_message_currentname" },
+	{ (void *)0x00000000000e2970, "dns_message_findname" },
+	{ (void *)0x00000000000e2b10, "dns_message_movename" },
+	{ (void *)0x00000000000e2d20, "dns_message_addname" },
+	{ (void *)0x00000000000e2df0, "dns_message_removename" },
+	{ (void *)0x00000000000e2fa0, "dns_message_gettempname" },
+	{ (void *)0x00000000000e3030, "dns_message_gettempoffsets" },
+	{ (void *)0x00000000000e3160, "dns_message_gettemprdata" },
+	{ (void *)0x00000000000e31d0, "dns_message_gettemprdataset" },
+	{ (void *)0x00000000000e3260, "dns_message_gettemprdatalist" },
+	{ (void *)0x00000000000e34c0, "dns_message_puttempname" },
+	{ (void *)0x00000000000e3570, "dns_message_puttemprdata" },
+	{ (void *)0x00000000000e3610, "dns_message_puttemprdataset" },
+	{ (void *)0x00000000000e36c0, "dns_message_renderreset" },
+	{ (void *)0x00000000000e37e0, "dns_message_renderend" },
+	{ (void *)0x00000000000e3d90, "dns_message_puttemprdatalist" },
+	{ (void *)0x00000000000e3e30, "dns_message_peekheader" },
+	{ (void *)0x00000000000e3ee0, "dns_message_reply" },
+	{ (void *)0x00000000000e43f0, "dns_message_getopt" },
+	{ (void *)0x00000000000e4420, "dns_message_setopt" },
+	{ (void *)0x00000000000e4590, "dns_message_gettsig" },
+	{ (void *)0x00000000000e4600, "dns_message_settsigkey" },
+	{ (void *)0x00000000000e4750, "dns_message_gettsigkey" },
+	{ (void *)0x00000000000e4780, "dns_message_getquerytsig" },
+	{ (void *)0x00000000000e48a0, "dns_message_getsig0" },
+	{ (void *)0x00000000000e4940, "dns_message_setsig0key" },
+	{ (void *)0x00000000000e4a80, "dns_message_getsig0key" },
+	{ (void *)0x00000000000e4ab0, "dns_message_takebuffer" },
+	{ (void *)0x00000000000e4b80, "dns_message_setquerytsig" },
+	{ (void *)0x00000000000e4d80, "dns_message_signer" },
+	{ (void *)0x00000000000e5100, "dns_message_resetsig" },
+	{ (void *)0x00000000000e5160, "dns_message_checksig" },
+	{ (void *)0x00000000000e5510, "dns_message_rechecksig" },
+	{ (void *)0x00000000000e5590, "dns_message_sectiontotext" },
+	{ (void *)0x00000000000e5820, "dns_message_pseudosectiontotext" },
+	{ (void *)0x00000000000e62c0, "dns_message_totext" },
+	{ (void *)0x00000000000e68a0, "dns_message_getrawmessage" },
+	{ (void *)0x00000000000e68d0, "dns_message_setsortorder" },
+	{ (void *)0x00000000000e6910, "dns_message_settimeadjust" },
+	{ (void *)0x00000000000e6940, "dns_message_gettimeadjust" },
+	{ (void *)0x00000000000e6970, "dns_opcode_totext" },
+	{ (void *)0x00000000000e69e0, "dns_message_logfmtpacket" },
+	{ (void *)0x00000000000e6b10, "dns_message_logpacket" },
+	{ (void *)0x00000000000e6b30, "dns_message_buildopt" },
+	{ (void *)0x00000000000e6e70, "set_offsets" },
+	{ (void *)0x00000000000e6fd0, "free_specific" },
+	{ (void *)0x00000000000e7010, "totext_filter_proc_key_init.part.0" },
+	{ (void *)0x00000000000e7150, "thread_key_mutex_init" },
+	{ (void *)0x00000000000e7190, "dns_name_invalidate.part.0" },
+	{ (void *)0x00000000000e71b0, "dns_name_setbuffer.part.0" },
+	{ (void *)0x00000000000e71d0, "dns_name_fullhash.part.0" },
+	{ (void *)0x00000000000e71f0, "dns_name_init" },
+	{ (void *)0x00000000000e7240, "dns_name_reset" },
+	{ (void *)0x00000000000e72c0, "dns_name_invalidate" },
+	{ (void *)0x00000000000e7310, "dns_name_isvalid" },
+	{ (void *)0x00000000000e73b0, "dns_name_setbuffer" },
+	{ (void *)0x00000000000e7400, "dns_name_hasbuffer" },
+	{ (void *)0x00000000000e7440, "dns_name_isabsolute" },
+	{ (void *)0x00000000000e7470, "dns_name_ismailbox" },
+	{ (void *)0x00000000000e7600, "dns_name_ishostname" },
+	{ (void *)0x00000000000e7770, "dns_name_iswildcard" },
+	{ (void *)0x00000000000e77f0, "dns_name_internalwildcard" },
+	{ (void *)0x00000000000e78e0, "dns_name_hash" },
+	{ (void *)0x00000000000e7980, "dns_name_fullhash" },
+	{ (void *)0x00000000000e79c0, "dns_fullname_hash" },
+	{ (void *)0x00000000000e7a10, "dns_name_hashbylabel" },
+	{ (void *)0x00000000000e7bc0, "dns_name_fullcompare" },
+	{ (void *)0x00000000000e7e70, "dns_name_compare" },
+	{ (void *)0x00000000000e7e90, "dns_name_equal" },
+	{ (void *)0x00000000000e7fc0, "dns_name_caseequal" },
+	{ (void *)0x00000000000e8070, "dns_name_rdatacompare" },
+	{ (void *)0x00000000000e8250, "dns_name_issubdomain" },
+	{ (void *)0x00000000000e8280, "dns_name_countlabels" },
+	{ (void *)0x00000000000e82e0, "dns_name_getlabel" },
+	{ (void *)0x00000000000e8400, "dns_name_getlabelsequence" },
+	{ (void *)0x00000000000e85d0, "dns_name_matcheswildcard" },
+	{ (void *)0x00000000000e8730, "dns_name_clone" },
+	{ (void *)0x00000000000e8820, "dns_name_fromregion" },
+	{ (void *)0x00000000000e8970, "dns_name_toregion" },
+	{ (void *)0x00000000000e89d0, "dns_name_fromtext" },
+	{ (void *)0x00000000000e92f0, "dns_name_totext2" },
+	{ (void *)0x00000000000e96a0, "dns_name_totext" },
+	{ (void *)0x00000000000e96b0, "dns_name_toprincipal" },
+	{ (void *)0x00000000000e96c0, "dns_name_tofilenametext" },
+	{ (void *)0x00000000000e9980, "dns_name_downcase" },
+	{ (void *)0x00000000000e9c40, "dns_name_fromwire" },
+	{ (void *)0x00000000000e9fc0, "dns_name_towire" },
+	{ (void *)0x00000000000ea250, "dns_name_concatenate" },
+	{ (void *)0x00000000000ea710, "dns_name_split" },
+	{ (void *)0x00000000000ea8a0, "dns_name_dup" },
+	{ (void *)0x00000000000eaa10, "dns_name_dupwithoffsets" },
+	{ (void *)0x00000000000eaba0, "dns_name_free" },
+	{ (void *)0x00000000000eac60, "dns_name_digest" },
+	{ (void *)0x00000000000ead60, "dns_name_dynamic" },
+	{ (void *)0x00000000000eada0, "dns_name_print" },
+	{ (void *)0x00000000000eae40, "dns_name_settotextfilter" },
+	{ (void *)0x00000000000eaf50, "dns_name_format" },
+	{ (void *)0x00000000000eaff0, "dns_name_tostring" },
+	{ (void *)0x00000000000eb0f0, "dns_name_fromstring2" },
+	{ (void *)0x00000000000eb2a0, "dns_name_fromstring" },
+	{ (void *)0x00000000000eb2c0, "dns_name_copy" },
+	{ (void *)0x00000000000eb450, "dns_name_destroy" },
+	{ (void *)0x00000000000eb530, "rdataset_disassociate" },
+	{ (void *)0x00000000000eb540, "rdataset_first" },
+	{ (void *)0x00000000000eb580, "rdataset_next" },
+	{ (void *)0x00000000000eb5b0, "rdataset_clone" },
+	{ (void *)0x00000000000eb600, "rdataset_count" },
+	{ (void *)0x00000000000eb620, "rdataset_settrust" },
+	{ (void *)0x00000000000eb630, "addoptout" },
+	{ (void *)0x00000000000ebc80, "rdataset_current" },
+	{ (void *)0x00000000000ebce0, "dns_ncache_add" },
+	{ (void *)0x00000000000ebd00, "dns_ncache_addoptout" },
+	{ (void *)0x00000000000ebd30, "dns_ncache_towire" },
+	{ (void *)0x00000000000ec280, "dns_ncache_getrdataset" },
+	{ (void *)0x00000000000ec610, "dns_ncache_getsigrdataset" },
+	{ (void *)0x00000000000eca80, "dns_ncache_current" },
+	{ (void *)0x00000000000ecd90, "dns_nsec_compressbitmap.part.0" },
+	{ (void *)0x00000000000ece20, "dns_nsec_setbit" },
+	{ (void *)0x00000000000ece50, "dns_nsec_isset" },
+	{ (void *)0x00000000000ece70, "dns_nsec_compressbitmap" },
+	{ (void *)0x00000000000ece80, "dns_nsec_buildrdata" },
+	{ (void *)0x00000000000ed0c0, "dns_nsec_build" },
+	{ (void *)0x00000000000ed200, "dns_nsec_typepresent" },
+	{ (void *)0x00000000000ed390, "dns_nsec_nseconly" },
+	{ (void *)0x00000000000ed560, "dns_nsec_noexistnodata" },
+	{ (void *)0x00000000000edac0, "do_one_tuple" },
+	{ (void *)0x00000000000edca0, "rr_exists" },
+	{ (void *)0x00000000000ede10, "delete" },
+	{ (void *)0x00000000000ee030, "find_nsec3" },
+	{ (void *)0x00000000000ee110, "dns_nsec3_buildrdata" },
+	{ (void *)0x00000000000ee550, "dns_nsec3_typepresent" },
+	{ (void *)0x00000000000ee6c0, "dns_nsec3_hashname" },
+	{ (void *)0x00000000000ee860, "dns_nsec3_hashlength" },
+	{ (void *)0x00000000000ee870, "dns_nsec3_supportedhash" },
+	{ (void *)0x00000000000ee880, "dns_nsec3param_fromprivate" },
+	{ (void *)0x00000000000ee970, "better_param" },
+	{ (void *)0x00000000000eeaf0, "dns_nsec3param_toprivate" },
+	{ (void *)0x00000000000eebb0, "dns_nsec3param_deletechains" },
+	{ (void *)0x00000000000ef110, "dns_nsec3_delnsec3" },
+	{ (void *)0x00000000000efaf0, "dns_nsec3_addnsec3" },
+	{ (void *)0x00000000000f08c0, "dns_nsec3_addnsec3s" },
+	{ (void *)0x00000000000f0aa0, "dns_nsec3_addnsec3sx" },
+	{ (void *)0x00000000000f0e30, "dns_nsec3_delnsec3sx" },
+	{ (void *)0x00000000000f1140, "dns_nsec3_delnsec3s" },
+	{ (void *)0x00000000000f1150, "dns_nsec3_activex" },
+	{ (void *)0x00000000000f14e0, "dns_nsec3_active" },
+	{ (void *)0x00000000000f14f0, "dns_nsec3_maxiterations" },
+	{ (void *)0x00000000000f1710, "dns_nsec3_noexistnodata" },
+	{ (void *)0x00000000000f2020, "dns_order_create" },
+	{ (void *)0x00000000000f20f0, "dns_order_add" },
+	{ (void *)0x00000000000f2270, "dns_order_find" },
+	{ (void *)0x00000000000f2340, "dns_order_attach" },
+	{ (void *)0x00000000000f23c0, "dns_order_detach" },
+	{ (void *)0x00000000000f25d0, "dns_peerlist_new" },
+	{ (void *)0x00000000000f2660, "dns_peerlist_attach" },
+	{ (void *)0x00000000000f2700, "dns_peerlist_peerbyaddr" },
+	{ (void *)0x00000000000f27a0, "dns_peer_newprefix" },
+	{ (void *)0x00000000000f28d0, "dns_peer_new" },
+	{ (void *)0x00000000000f2950, "dns_peer_attach" },
+	{ (void *)0x00000000000f29f0, "dns_peerlist_addpeer" },
+	{ (void *)0x00000000000f2b10, "dns_peerlist_currpeer" },
+	{ (void *)0x00000000000f2b30, "dns_peer_detach" },
+	{ (void *)0x00000000000f2d00, "dns_peerlist_detach" },
+	{ (void *)0x00000000000f2f40, "dns_peer_setbogus" },
+	{ (void *)0x00000000000f2f90, "dns_peer_getbogus" },
+	{ (void *)0x00000000000f3000, "dns_peer_setprovideixfr" },
+	{ (void *)0x00000000000f3050, "dns_peer_getprovideixfr" },
+	{ (void *)0x00000000000f30c0, "dns_peer_setrequestixfr" },
+	{ (void *)0x00000000000f3110, "dns_peer_getrequestixfr" },
+	{ (void *)0x00000000000f3180, "dns_peer_setsupportedns" },
+	{ (void *)0x00000000000f31d0, "dns_peer_getsupportedns" },
+	{ (void *)0x00000000000f3240, "dns_peer_setrequestnsid" },
+	{ (void *)0x00000000000f3290, "dns_peer_getrequestnsid" },
+	{ (void *)0x00000000000f3300, "dns_peer_setrequestsit" },
+	{ (void *)0x00000000000f3350, "dns_peer_getrequestsit" },
+	{ (void *)0x00000000000f33c0, "dns_peer_settransfers" },
+	{ (void *)0x00000000000f3410, "dns_peer_gettransfers" },
+	{ (void *)0x00000000000f3480, "dns_peer_settransferformat" },
+	{ (void *)0x00000000000f34d0, "dns_peer_gettransferformat" },
+	{ (void *)0x00000000000f3540, "dns_peer_getkey" },
+	{ (void *)0x00000000000f35b0, "dns_peer_setkey" },
+	{ (void *)0x00000000000f3630, "dns_peer_setkeybycharp" },
+	{ (void *)0x00000000000f37e0, "dns_peer_settransfersource" },
+	{ (void *)0x00000000000f3900, "dns_peer_gettransfersource" },
+	{ (void *)0x00000000000f39e0, "dns_peer_setnotifysource" },
+	{ (void *)0x00000000000f3b00, "dns_peer_getnotifysource" },
+	{ (void *)0x00000000000f3be0, "dns_peer_setquerysource" },
+	{ (void *)0x00000000000f3d00, "dns_peer_getquerysource" },
+	{ (void *)0x00000000000f3de0, "dns_peer_setudpsize" },
+	{ (void *)0x00000000000f3e30, "dns_peer_getudpsize" },
+	{ (void *)0x00000000000f3ea0, "dns_peer_setmaxudp" },
+	{ (void *)0x00000000000f3ef0, "dns_peer_getmaxudp" },
+	{ (void *)0x00000000000f3f60, "dns_peer_setnotifydscp" },
+	{ (void *)0x00000000000f3fc0, "dns_peer_getnotifydscp" },
+	{ (void *)0x00000000000f4020, "dns_peer_settransferdscp" },
+	{ (void *)0x00000000000f4080, "dns_peer_gettransferdscp" },
+	{ (void *)0x00000000000f40e0, "dns_peer_setquerydscp" },
+	{ (void *)0x00000000000f4140, "dns_peer_getquerydscp" },
+	{ (void *)0x00000000000f41a0, "dns_private_chains" },
+	{ (void *)0x00000000000f49a0, "dns_private_totext" },
+	{ (void *)0x00000000000f4c20, "dns_rbt_zero_header" },
+	{ (void *)0x00000000000f4c70, "serialize_nodes" },
+	{ (void *)0x00000000000f50b0, "rehash" },
+	{ (void *)0x00000000000f51f0, "freenode" },
+	{ (void *)0x00000000000f5250, "create_node" },
+	{ (void *)0x00000000000f53d0, "printnodename" },
+	{ (void *)0x00000000000f5490, "dns_rbt_printtree" },
+	{ (void *)0x00000000000f56b0, "rotate_right.part.0" },
+	{ (void *)0x00000000000f56e0, "rotate_left.part.0" },
+	{ (void *)0x00000000000f5710, "unhash_node.part.0" },
+	{ (void *)0x00000000000f5730, "hash_node.part.0" },
+	{ (void *)0x00000000000f5750, "dns_rbtnodechain_reset.part.0" },
+	{ (void *)0x00000000000f5770, "treefix" },
+	{ (void *)0x00000000000f5d10, "deletetree" },
+	{ (void *)0x00000000000f5e60, "dns_rbt_serialize_align" },
+	{ (void *)0x00000000000f5e90, "dns_rbt_serialize_tree" },
+	{ (void *)0x00000000000f6190, "dns_rbt_create" },
+	{ (void *)0x00000000000f6320, "dns_rbt_destroy2" },
+	{ (void *)0x00000000000f6540, "dns_rbt_destroy" },
+	{ (void *)0x00000000000f6580, "dns_rbt_deserialize_tree" },
+	{ (void *)0x00000000000f6770, "dns_rbt_nodecount" },
+	{ (void *)0x00000000000f67a0, "dns_rbt_hashsize" },
+	{ (void *)0x00000000000f67d0, "dns_rbt_addnode" },
+	{ (void *)0x00000000000f7530, "dns_rbt_addname" },
+	{ (void *)0x00000000000f75d0, "dns_rbt_deletenode" },
+	{ (void *)0x00000000000f8010, "dns_rbt_namefromnode" },
+	{ (void *)0x00000000000f80c0, "dns_rbt_fullnamefromnode" },
+	{ (void *)0x00000000000f8230, "dns_rbt_formatnodename" },
+	{ (void *)0x00000000000f8370, "dns_rbt_printnodeinfo" },
+	{ (void *)0x00000000000f8480, "dns_rbt_printall" },
+	{ (void *)0x00000000000f84c0, "dns_rbtnodechain_init" },
+	{ (void *)0x00000000000f8530, "dns_rbtnodechain_current" },
+	{ (void *)0x00000000000f8740, "dns_rbtnodechain_prev" },
+	{ (void *)0x00000000000f8880, "dns_rbt_findnode" },
+	{ (void *)0x00000000000f9810, "dns_rbt_findname" },
+	{ (void *)0x00000000000f98a0, "dns_rbt_deletename" },
+	{ (void *)0x00000000000f9960, "dns_rbtnodechain_down" },
+	{ (void *)0x00000000000f9b60, "dns_rbtnodechain_nextflat" },
+	{ (void *)0x00000000000f9c20, "dns_rbtnodechain_next" },
+	{ (void *)0x00000000000f9ea0, "dns_rbtnodechain_first" },
+	{ (void *)0x00000000000f9f30, "dns_rbtnodechain_last" },
+	{ (void *)0x00000000000fa010, "dns_rbtnodechain_reset" },
+	{ (void *)0x00000000000fa040, "dns_rbtnodechain_invalidate" },
+	{ (void *)0x00000000000fa070, "ttl_sooner" },
+	{ (void *)0x00000000000fa080, "resign_sooner" },
+	{ (void *)0x00000000000fa090, "set_index" },
+	{ (void *)0x00000000000fa0a0, "overmem" },
+	{ (void *)0x00000000000fa0b0, "ispersistent" },
+	{ (void *)0x00000000000fa0c0, "rdataset_first" },
+	{ (void *)0x00000000000fa100, "rdataset_next" },
+	{ (void *)0x00000000000fa140, "rdataset_count" },
+	{ (void *)0x00000000000fa160, "attachnode" },
+	{ (void *)0x00000000000fa1f0, "attachversion" },
+	{ (void *)0x00000000000fa280, "update_header" },
+	{ (void *)0x00000000000fa4b0, "free_acachearray" },
+	{ (void *)0x00000000000fa540, "isdnssec" },
+	{ (void *)0x00000000000fa610, "rdataset_settrust" },
+	{ (void *)0x00000000000fa6e0, "issecure" },
+	{ (void *)0x00000000000fa7b0, "add_changed" },
+	{ (void *)0x00000000000fa900, "rdatasetiter_next" },
+	{ (void *)0x00000000000faad0, "rdatasetiter_first" },
+	{ (void *)0x00000000000fac30, "currentversion" },
+	{ (void *)0x00000000000fad20, "update_rrsetstats" },
+	{ (void *)0x00000000000fad90, "hashsize" },
+	{ (void *)0x00000000000fae50, "rpz_ready" },
+	{ (void *)0x00000000000faf50, "rpz_attach" },
+	{ (void *)0x00000000000fb060, "update_cachestats" },
+	{ (void *)0x00000000000fb0d0, "set_ttl" },
+	{ (void *)0x00000000000fb130, "delete_node" },
+	{ (void *)0x00000000000fb3b0, "cleanup_dead_nodes" },
+	{ (void *)0x00000000000fb530, "acache_cancelentry" },
+	{ (void *)0x00000000000fb600, "rdataset_putadditional" },
+	{ (void *)0x00000000000fb810, "acache_callback" },
+	{ (void *)0x00000000000fb9e0, "rdataset_setadditional" },
+	{ (void *)0x00000000000fbe10, "rdataset_getadditional" },
+	{ (void *)0x00000000000fc050, "rdataset_getclosest" },
+	{ (void *)0x00000000000fc1a0, "rdataset_getnoqname" },
+	{ (void *)0x00000000000fc2f0, "rdataset_current" },
+	{ (void *)0x00000000000fc370, "resign_insert" },
+	{ (void *)0x00000000000fc400, "setsigningtime" },
+	{ (void *)0x00000000000fc650, "add_wildcard_magic" },
+	{ (void *)0x00000000000fc710, "getnsec3parameters" },
+	{ (void *)0x00000000000fc930, "settask" },
+	{ (void *)0x00000000000fca10, "nodecount" },
+	{ (void *)0x00000000000fcad0, "iszonesecure" },
+	{ (void *)0x00000000000fcf50, "endload" },
+	{ (void *)0x00000000000fd120, "allrdatasets" },
+	{ (void *)0x00000000000fd2f0, "createiterator" },
+	{ (void *)0x00000000000fd4e0, "dbiterator_origin" },
+	{ (void *)0x00000000000fd500, "printnode" },
+	{ (void *)0x00000000000fd6d0, "zone_findzonecut" },
+	{ (void *)0x00000000000fd6f0, "activeempty" },
+	{ (void *)0x00000000000fd950, "matchparams" },
+	{ (void *)0x00000000000fdab0, "dump" },
+	{ (void *)0x00000000000fdb30, "rbt_datafixer" },
+	{ (void *)0x00000000000fdc80, "rbt_datawriter" },
+	{ (void *)0x00000000000fde90, "rbtdb_zero_header" },
+	{ (void *)0x00000000000fdee0, "serialize" },
+	{ (void *)0x00000000000fe0f0, "beginload" },
+	{ (void *)0x00000000000fe2f0, "deserialize" },
+	{ (void *)0x00000000000fe540, "setcachestats" },
+	{ (void *)0x00000000000fe5d0, "free_rbtdb" },
+	{ (void *)0x00000000000ff020, "maybe_free_rbtdb" },
+	{ (void *)0x00000000000ff290, "cleanup_dead_nodes_callback" },
+	{ (void *)0x00000000000ff4a0, "free_rbtdb_callback" },
+	{ (void *)0x00000000000ff4c0, "new_reference.part.0" },
+	{ (void *)0x00000000000ff4f0, "attach" },
+	{ (void *)0x00000000000ff550, "getrrsetstats" },
+	{ (void *)0x00000000000ff5b0, "resume_iteration.part.0" },
+	{ (void *)0x00000000000ff5d0, "reference_iter_node.part.0" },
+	{ (void *)0x00000000000ff600, "previous_closest_nsec.part.0" },
+	{ (void *)0x00000000000ff7e0, "detach" },
+	{ (void *)0x00000000000ff860, "loadnode.constprop.0" },
+	{ (void *)0x00000000000ffb00, "add_empty_wildcards.isra.0" },
+	{ (void *)0x00000000000ffbe0, "newversion" },
+	{ (void *)0x00000000000ffed0, "rdataset_clone" },
+	{ (void *)0x00000000000fffb0, "expirenode" },
+	{ (void *)0x0000000000100330, "getoriginnode" },
+	{ (void *)0x0000000000100470, "free_rdataset" },
+	{ (void *)0x0000000000100840, "delete_callback" },
+	{ (void *)0x0000000000100900, "decrement_reference" },
+	{ (void *)0x0000000000101410, "flush_deletions" },
+	{ (void *)0x0000000000101690, "dbiterator_pause" },
+	{ (void *)0x0000000000101730, "closeversion" },
+	{ (void *)0x00000000001025d0, "detachnode" },
+	{ (void *)0x00000000001028c0, "rdataset_disassociate" },
+	{ (void *)0x00000000001028f0, "rdatasetiter_destroy" },
+	{ (void *)0x0000000000102960, "prune_tree" },
+	{ (void *)0x0000000000102d30, "dbiterator_destroy" },
+	{ (void *)0x0000000000102f10, "zone_zonecut_callback" },
+	{ (void *)0x0000000000103220, "reactivate_node" },
+	{ (void *)0x0000000000103580, "dbiterator_seek" },
+	{ (void *)0x0000000000103890, "findnodeintree" },
+	{ (void *)0x0000000000103cd0, "findnsec3node" },
+	{ (void *)0x0000000000103d10, "findnode" },
+	{ (void *)0x0000000000103d50, "dbiterator_prev" },
+	{ (void *)0x0000000000104000, "dbiterator_next" },
+	{ (void *)0x00000000001042b0, "dbiterator_last" },
+	{ (void *)0x0000000000104570, "dbiterator_first" },
+	{ (void *)0x0000000000104810, "bind_rdataset" },
+	{ (void *)0x00000000001049f0, "getsigningtime" },
+	{ (void *)0x0000000000104d00, "zone_findrdataset" },
+	{ (void *)0x0000000000104fb0, "cache_findrdataset" },
+	{ (void *)0x00000000001052f0, "find_deepest_zonecut" },
+	{ (void *)0x0000000000105b50, "find_closest_nsec" },
+	{ (void *)0x0000000000106330, "resigned" },
+	{ (void *)0x00000000001066e0, "dbiterator_current" },
+	{ (void *)0x0000000000106970, "rdatasetiter_current" },
+	{ (void *)0x0000000000106c40, "expire_header" },
+	{ (void *)0x0000000000106da0, "rdataset_expire" },
+	{ (void *)0x0000000000106e70, "cache_zonecut_callback" },
+	{ (void *)0x0000000000107280, "subtractrdataset" },
+	{ (void *)0x0000000000107820, "cache_findzonecut" },
+	{ (void *)0x0000000000107f80, "add" },
+	{ (void *)0x0000000000108c80, "deleterdataset" },
+	{ (void *)0x0000000000108ee0, "addrdataset" },
+	{ (void *)0x0000000000109e70, "loading_addrdataset" },
+	{ (void *)0x000000000010a190, "cache_find" },
+	{ (void *)0x000000000010b8f0, "zone_find" },
+	{ (void *)0x000000000010d480, "dns_rbtdb_create" },
+	{ (void *)0x000000000010e020, "ttl_sooner" },
+	{ (void *)0x000000000010e030, "resign_sooner" },
+	{ (void *)0x000000000010e040, "set_index" },
+	{ (void *)0x000000000010e050, "overmem" },
+	{ (void *)0x000000000010e060, "ispersistent" },
+	{ (void *)0x000000000010e070, "rdataset_first" },
+	{ (void *)0x000000000010e0b0, "rdataset_next" },
+	{ (void *)0x000000000010e0f0, "rdataset_count" },
+	{ (void *)0x000000000010e110, "attachnode" },
+	{ (void *)0x000000000010e1a0, "attachversion" },
+	{ (void *)0x000000000010e230, "update_header" },
+	{ (void *)0x000000000010e460, "free_acachearray" },
+	{ (void *)0x000000000010e4f0, "isdnssec" },
+	{ (void *)0x000000000010e5c0, "rdataset_settrust" },
+	{ (void *)0x000000000010e690, "issecure" },
+	{ (void *)0x000000000010e760, "add_changed" },
+	{ (void *)0x000000000010e8b0, "rdatasetiter_next" },
+	{ (void *)0x000000000010ea80, "rdatasetiter_first" },
+	{ (void *)0x000000000010ebe0, "currentversion" },
+	{ (void *)0x000000000010ecd0, "update_rrsetstats" },
+	{ (void *)0x000000000010ed40, "hashsize" },
+	{ (void *)0x000000000010ee00, "rpz_ready" },
+	{ (void *)0x000000000010ef00, "rpz_attach" },
+	{ (void *)0x000000000010f010, "update_cachestats" },
+	{ (void *)0x000000000010f080, "set_ttl" },
+	{ (void *)0x000000000010f0e0, "delete_node" },
+	{ (void *)0x000000000010f360, "cleanup_dead_nodes" },
+	{ (void *)0x000000000010f4e0, "acache_cancelentry" },
+	{ (void *)0x000000000010f5b0, "rdataset_putadditional" },
+	{ (void *)0x000000000010f7c0, "acache_callback" },
+	{ (void *)0x000000000010f990, "rdataset_setadditional" },
+	{ (void *)0x000000000010fdc0, "rdataset_getadditional" },
+	{ (void *)0x0000000000110000, "rdataset_getclosest" },
+	{ (void *)0x0000000000110150, "rdataset_getnoqname" },
+	{ (void *)0x00000000001102a0, "rdataset_current" },
+	{ (void *)0x0000000000110320, "resign_insert" },
+	{ (void *)0x00000000001103b0, "setsigningtime" },
+	{ (void *)0x0000000000110600, "add_wildcard_magic" },
+	{ (void *)0x00000000001106c0, "getnsec3parameters" },
+	{ (void *)0x00000000001108e0, "settask" },
+	{ (void *)0x00000000001109c0, "nodecount" },
+	{ (void *)0x0000000000110a80, "iszonesecure" },
+	{ (void *)0x0000000000110f10, "endload" },
+	{ (void *)0x00000000001110e0, "allrdatasets" },
+	{ (void *)0x00000000001112b0, "createiterator" },
+	{ (void *)0x00000000001114a0, "dbiterator_origin" },
+	{ (void *)0x00000000001114c0, "printnode" },
+	{ (void *)0x0000000000111690, "zone_findzonecut" },
+	{ (void *)0x00000000001116b0, "activeempty" },
+	{ (void *)0x0000000000111910, "matchparams" },
+	{ (void *)0x0000000000111a80, "dump" },
+	{ (void *)0x0000000000111b00, "rbt_datafixer" },
+	{ (void *)0x0000000000111c50, "rbt_datawriter" },
+	{ (void *)0x0000000000111e60, "rbtdb_zero_header" },
+	{ (void *)0x0000000000111eb0, "serialize" },
+	{ (void *)0x00000000001120c0, "beginload" },
+	{ (void *)0x00000000001122c0, "deserialize" },
+	{ (void *)0x0000000000112510, "setcachestats" },
+	{ (void *)0x00000000001125a0, "free_rbtdb" },
+	{ (void *)0x0000000000112ff0, "maybe_free_rbtdb" },
+	{ (void *)0x0000000000113260, "cleanup_dead_nodes_callback" },
+	{ (void *)0x0000000000113470, "free_rbtdb_callback" },
+	{ (void *)0x0000000000113490, "new_reference.part.0" },
+	{ (void *)0x00000000001134c0, "attach" },
+	{ (void *)0x0000000000113520, "getrrsetstats" },
+	{ (void *)0x0000000000113580, "resume_iteration.part.0" },
+	{ (void *)0x00000000001135a0, "reference_iter_node.part.0" },
+	{ (void *)0x00000000001135d0, "previous_closest_nsec.part.0" },
+	{ (void *)0x00000000001137b0, "detach" },
+	{ (void *)0x0000000000113830, "loadnode.constprop.0" },
+	{ (void *)0x0000000000113ad0, "add_empty_wildcards.isra.0" },
+	{ (void *)0x0000000000113bb0, "newversion" },
+	{ (void *)0x0000000000113ea0, "rdataset_clone" },
+	{ (void *)0x0000000000113f80, "expirenode" },
+	{ (void *)0x0000000000114300, "getoriginnode" },
+	{ (void *)0x0000000000114440, "free_rdataset" },
+	{ (void *)0x0000000000114810, "delete_callback" },
+	{ (void *)0x00000000001148d0, "decrement_reference" },
+	{ (void *)0x00000000001153f0, "flush_deletions" },
+	{ (void *)0x0000000000115670, "dbiterator_pause" },
+	{ (void *)0x0000000000115710, "closeversion" },
+	{ (void *)0x00000000001165c0, "detachnode" },
+	{ (void *)0x00000000001168b0, "rdataset_disassociate" },
+	{ (void *)0x00000000001168e0, "rdatasetiter_destroy" },
+	{ (void *)0x0000000000116950, "prune_tree" },
+	{ (void *)0x0000000000116d20, "dbiterator_destroy" },
+	{ (void *)0x0000000000116f00, "zone_zonecut_callback" },
+	{ (void *)0x0000000000117210, "reactivate_node" },
+	{ (void *)0x0000000000117570, "dbiterator_seek" },
+	{ (void *)0x0000000000117880, "findnodeintree" },
+	{ (void *)0x0000000000117cc0, "findnsec3node" },
+	{ (void *)0x0000000000117d00, "findnode" },
+	{ (void *)0x0000000000117d40, "dbiterator_prev" },
+	{ (void *)0x0000000000117ff0, "dbiterator_next" },
+	{ (void *)0x00000000001182a0, "dbiterator_last" },
+	{ (void *)0x0000000000118560, "dbiterator_first" },
+	{ (void *)0x0000000000118800, "bind_rdataset" },
+	{ (void *)0x00000000001189e0, "getsigningtime" },
+	{ (void *)0x0000000000118cf0, "zone_findrdataset" },
+	{ (void *)0x0000000000118fa0, "cache_findrdataset" },
+	{ (void *)0x00000000001192e0, "find_deepest_zonecut" },
+	{ (void *)0x0000000000119b40, "find_closest_nsec" },
+	{ (void *)0x000000000011a330, "resigned" },
+	{ (void *)0x000000000011a6e0, "dbiterator_current" },
+	{ (void *)0x000000000011a970, "rdatasetiter_current" },
+	{ (void *)0x000000000011ac50, "expire_header" },
+	{ (void *)0x000000000011adb0, "rdataset_expire" },
+	{ (void *)0x000000000011ae80, "cache_zonecut_callback" },
+	{ (void *)0x000000000011b290, "subtractrdataset" },
+	{ (void *)0x000000000011b840, "cache_findzonecut" },
+	{ (void *)0x000000000011bfa0, "add" },
+	{ (void *)0x000000000011cca0, "deleterdataset" },
+	{ (void *)0x000000000011cf00, "addrdataset" },
+	{ (void *)0x000000000011de90, "loading_addrdataset" },
+	{ (void *)0x000000000011e1b0, "cache_find" },
+	{ (void *)0x000000000011f910, "zone_find" },
+	{ (void *)0x00000000001214b0, "dns_rbtdb64_create" },
+	{ (void *)0x0000000000122060, "maybe_numeric" },
+	{ (void *)0x0000000000122150, "dns_mnemonic_fromtext" },
+	{ (void *)0x00000000001221d0, "dns_mnemonic_totext" },
+	{ (void *)0x00000000001222a0, "dns_rcode_fromtext" },
+	{ (void *)0x00000000001222d0, "dns_rcode_totext" },
+	{ (void *)0x00000000001222e0, "dns_tsigrcode_fromtext" },
+	{ (void *)0x0000000000122310, "dns_tsigrcode_totext" },
+	{ (void *)0x0000000000122320, "dns_cert_fromtext" },
+	{ (void *)0x0000000000122350, "dns_cert_totext" },
+	{ (void *)0x0000000000122360, "dns_secalg_fromtext" },
+	{ (void *)0x0000000000122390, "dns_secalg_totext" },
+	{ (void *)0x00000000001223a0, "dns_secalg_format" },
+	{ (void *)0x0000000000122420, "dns_secproto_fromtext" },
+	{ (void *)0x0000000000122450, "dns_secproto_totext" },
+	{ (void *)0x0000000000122460, "dns_hashalg_fromtext" },
+	{ (void *)0x0000000000122490, "dns_keyflags_fromtext" },
+	{ (void *)0x00000000001225b0, "dns_dsdigest_fromtext" },
+	{ (void *)0x00000000001225e0, "dns_dsdigest_totext" },
+	{ (void *)0x00000000001225f0, "dns_dsdigest_format" },
+	{ (void *)0x0000000000122670, "dns_rdataclass_fromtext" },
+	{ (void *)0x00000000001228f0, "dns_rdataclass_totext" },
+	{ (void *)0x0000000000122b40, "dns_rdataclass_format" },
+	{ (void *)0x0000000000122bc0, "putbyte" },
+	{ (void *)0x0000000000122c30, "txt_totext" },
+	{ (void *)0x0000000000122df0, "byte_btoa" },
+	{ (void *)0x0000000000122f80, "multitxt_totext" },
+	{ (void *)0x0000000000123170, "mem_tobuffer" },
+	{ (void *)0x00000000001231c0, "txt_fromwire" },
+	{ (void *)0x0000000000123240, "txt_valid_regex" },
+	{ (void *)0x0000000000123470, "default_fromtext_callback" },
+	{ (void *)0x0000000000123520, "buffer_fromregion" },
+	{ (void *)0x0000000000123560, "fromtext_error" },
+	{ (void *)0x00000000001236d0, "uint32_tobuffer" },
+	{ (void *)0x0000000000123710, "str_totext" },
+	{ (void *)0x0000000000123770, "mygetservbyname" },
+	{ (void *)0x0000000000123820, "locator_pton" },
+	{ (void *)0x0000000000123960, "atob_tobuffer" },
+	{ (void *)0x0000000000123cc0, "name_prefix" },
+	{ (void *)0x0000000000123d90, "uint8_fromregion.part.0" },
+	{ (void *)0x0000000000123db0, "uint16_fromregion.part.0" },
+	{ (void *)0x0000000000123dd0, "uint16_consume_fromregion.part.0" },
+	{ (void *)0x0000000000123e00, "warn_badname.part.0" },
+	{ (void *)0x0000000000123e80, "uint16_tobuffer.part.0" },
+	{ (void *)0x0000000000123ec0, "init_lock" },
+	{ (void *)0x0000000000123f00, "uint8_tobuffer.part.0" },
+	{ (void *)0x0000000000123f50, "uint16_fromregion.isra.0" },
+	{ (void *)0x0000000000123f70, "uint32_fromregion.isra.0" },
+	{ (void *)0x0000000000123fa0, "compare_hs_a.isra.0" },
+	{ (void *)0x0000000000124090, "txt_fromtext" },
+	{ (void *)0x00000000001242c0, "tostruct_nsec3" },
+	{ (void *)0x00000000001245d0, "compare_in_apl" },
+	{ (void *)0x00000000001246c0, "compare_gpos" },
+	{ (void *)0x00000000001247d0, "compare_nid" },
+	{ (void *)0x00000000001248e0, "compare_l64" },
+	{ (void *)0x00000000001249f0, "compare_dlv" },
+	{ (void *)0x0000000000124b00, "compare_tlsa" },
+	{ (void *)0x0000000000124c10, "compare_nsec3param" },
+	{ (void *)0x0000000000124d20, "compare_eui64" },
+	{ (void *)0x0000000000124e30, "compare_sshfp" },
+	{ (void *)0x0000000000124f40, "compare_l32" },
+	{ (void *)0x0000000000125050, "compare_hinfo" },
+	{ (void *)0x0000000000125160, "compare_x25" },
+	{ (void *)0x0000000000125270, "compare_cert" },
+	{ (void *)0x0000000000125380, "compare_dnskey" },
+	{ (void *)0x0000000000125490, "compare_loc" },
+	{ (void *)0x00000000001255a0, "compare_ds" },
+	{ (void *)0x00000000001256b0, "compare_isdn" },
+	{ (void *)0x00000000001257c0, "compare_eui48" },
+	{ (void *)0x00000000001258d0, "compare_nsec3" },
+	{ (void *)0x00000000001259e0, "compare_key" },
+	{ (void *)0x0000000000125af0, "compare_in_nsap" },
+	{ (void *)0x0000000000125c20, "compare_in_aaaa" },
+	{ (void *)0x0000000000125d60, "compare_in_dhcid" },
+	{ (void *)0x0000000000125e90, "compare_in_a" },
+	{ (void *)0x0000000000125fd0, "compare_in_wks" },
+	{ (void *)0x0000000000126100, "towire_rp" },
+	{ (void *)0x0000000000126290, "towire_minfo" },
+	{ (void *)0x0000000000126420, "compare_md" },
+	{ (void *)0x0000000000126590, "compare_ns" },
+	{ (void *)0x0000000000126700, "compare_ptr" },
+	{ (void *)0x0000000000126870, "compare_mg" },
+	{ (void *)0x00000000001269e0, "compare_mf" },
+	{ (void *)0x0000000000126b50, "compare_dname" },
+	{ (void *)0x0000000000126cc0, "compare_mb" },
+	{ (void *)0x0000000000126e30, "compare_cname" },
+	{ (void *)0x0000000000126fa0, "compare_mr" },
+	{ (void *)0x0000000000127110, "compare_nxt" },
+	{ (void *)0x0000000000127290, "compare_in_nsap_ptr" },
+	{ (void *)0x0000000000127420, "fromtext_in_nsap.constprop.0" },
+	{ (void *)0x0000000000127630, "towire_soa" },
+	{ (void *)0x0000000000127820, "tostruct_minfo" },
+	{ (void *)0x0000000000127a30, "tostruct_rp" },
+	{ (void *)0x0000000000127c40, "tostruct_nxt" },
+	{ (void *)0x0000000000127e30, "tostruct_nsec" },
+	{ (void *)0x0000000000128020, "towire_in_px" },
+	{ (void *)0x0000000000128210, "tostruct_in_a6" },
+	{ (void *)0x0000000000128420, "compare_in_px" },
+	{ (void *)0x00000000001286f0, "tostruct_loc.constprop.0" },
+	{ (void *)0x00000000001288d0, "tostruct_hinfo" },
+	{ (void *)0x0000000000128ad0, "tostruct_isdn" },
+	{ (void *)0x0000000000128ce0, "compare_tkey" },
+	{ (void *)0x0000000000128ed0, "tostruct_in_px" },
+	{ (void *)0x0000000000129110, "compare_any_tsig" },
+	{ (void *)0x0000000000129320, "tostruct_in_srv" },
+	{ (void *)0x00000000001294f0, "compare_minfo" },
+	{ (void *)0x0000000000129720, "compare_rp" },
+	{ (void *)0x0000000000129950, "compare_ch_a" },
+	{ (void *)0x0000000000129b80, "compare_uri" },
+	{ (void *)0x0000000000129dd0, "fromtext_in_apl.constprop.0" },
+	{ (void *)0x000000000012a180, "fromstruct_nxt" },
+	{ (void *)0x000000000012a340, "compare_in_a6" },
+	{ (void *)0x000000000012a5e0, "compare_soa" },
+	{ (void *)0x000000000012a890, "tostruct_gpos" },
+	{ (void *)0x000000000012ab60, "tostruct_soa" },
+	{ (void *)0x000000000012aee0, "fromstruct_nsec" },
+	{ (void *)0x000000000012b150, "tostruct_hip" },
+	{ (void *)0x000000000012b4a0, "tostruct_sig" },
+	{ (void *)0x000000000012b820, "tostruct_rrsig" },
+	{ (void *)0x000000000012bba0, "tostruct_keydata" },
+	{ (void *)0x000000000012bd20, "totext_in_apl.constprop.0" },
+	{ (void *)0x000000000012c0d0, "compare_naptr" },
+	{ (void *)0x000000000012c4e0, "tostruct_tkey" },
+	{ (void *)0x000000000012c8b0, "compare_mx" },
+	{ (void *)0x000000000012cac0, "compare_afsdb" },
+	{ (void *)0x000000000012ccd0, "compare_rt" },
+	{ (void *)0x000000000012cee0, "compare_in_kx" },
+	{ (void *)0x000000000012d110, "compare_in_srv" },
+	{ (void *)0x000000000012d340, "tostruct_naptr" },
+	{ (void *)0x000000000012d840, "tostruct_ipseckey" },
+	{ (void *)0x000000000012dbf0, "tostruct_any_tsig" },
+	{ (void *)0x000000000012e040, "totext_minfo" },
+	{ (void *)0x000000000012e220, "totext_rp" },
+	{ (void *)0x000000000012e400, "towire_rrsig" },
+	{ (void *)0x000000000012e600, "towire_sig" },
+	{ (void *)0x000000000012e800, "totext_in_kx" },
+	{ (void *)0x000000000012e9d0, "totext_loc.constprop.0" },
+	{ (void *)0x000000000012f040, "compare_sig" },
+	{ (void *)0x000000000012f350, "fromwire_in_apl.constprop.0" },
+	{ (void *)0x000000000012f510, "fromtext_naptr.constprop.0" },
+	{ (void *)0x000000000012f770, "fromtext_afsdb.constprop.0" },
+	{ (void *)0x000000000012f950, "fromtext_rt.constprop.0" },
+	{ (void *)0x000000000012fb30, "fromtext_uri.constprop.0" },
+	{ (void *)0x000000000012ff30, "towire_naptr" },
+	{ (void *)0x0000000000130220, "fromtext_mx.constprop.0" },
+	{ (void *)0x0000000000130540, "totext_ch_a" },
+	{ (void *)0x0000000000130760, "totext_l64.constprop.0" },
+	{ (void *)0x0000000000130910, "fromstruct_in_a6.constprop.0" },
+	{ (void *)0x0000000000130b10, "fromstruct_dlv" },
+	{ (void *)0x0000000000130d60, "fromstruct_ds" },
+	{ (void *)0x0000000000130fb0, "totext_opt" },
+	{ (void *)0x00000000001312a0, "fromwire_loc.constprop.0" },
+	{ (void *)0x0000000000131450, "totext_in_a6" },
+	{ (void *)0x0000000000131750, "fromtext_in_px.constprop.0" },
+	{ (void *)0x0000000000131950, "totext_in_px" },
+	{ (void *)0x0000000000131bc0, "fromstruct_soa" },
+	{ (void *)0x0000000000131d90, "fromtext_in_a6.constprop.0" },
+	{ (void *)0x0000000000132070, "totext_nsec3param.constprop.0" },
+	{ (void *)0x0000000000132300, "fromwire_ipseckey.constprop.0" },
+	{ (void *)0x0000000000132510, "fromwire_tkey.constprop.0" },
+	{ (void *)0x0000000000132770, "totext_sshfp" },
+	{ (void *)0x0000000000132a00, "totext_in_dhcid" },
+	{ (void *)0x0000000000132c30, "fromstruct_ipseckey" },
+	{ (void *)0x0000000000132e80, "fromtext_cert.constprop.0" },
+	{ (void *)0x0000000000133040, "fromtext_ds.constprop.0" },
+	{ (void *)0x0000000000133240, "totext_tlsa" },
+	{ (void *)0x0000000000133530, "totext_ds" },
+	{ (void *)0x0000000000133880, "totext_dlv" },
+	{ (void *)0x0000000000133bd0, "unknown_totext" },
+	{ (void *)0x0000000000133e40, "totext_in_srv" },
+	{ (void *)0x0000000000134160, "totext_ipseckey" },
+	{ (void *)0x0000000000134690, "fromtext_in_srv.constprop.0" },
+	{ (void *)0x0000000000134930, "fromwire_any_tsig.constprop.0" },
+	{ (void *)0x0000000000134c10, "fromtext_dnskey.constprop.0" },
+	{ (void *)0x0000000000134e10, "fromtext_key.constprop.0" },
+	{ (void *)0x0000000000135010, "fromtext_in_wks.constprop.0" },
+	{ (void *)0x00000000001355b0, "fromstruct_loc" },
+	{ (void *)0x00000000001357f0, "totext_soa" },
+	{ (void *)0x0000000000135d80, "fromstruct_naptr" },
+	{ (void *)0x0000000000136080, "fromstruct_nsec3" },
+	{ (void *)0x0000000000136450, "fromtext_any_tsig.constprop.0" },
+	{ (void *)0x00000000001367f0, "fromtext_hip.constprop.0" },
+	{ (void *)0x0000000000136b40, "fromtext_nsec3param.constprop.0" },
+	{ (void *)0x0000000000136d90, "totext_cert" },
+	{ (void *)0x0000000000137070, "fromstruct_tkey" },
+	{ (void *)0x00000000001372e0, "fromstruct_sig" },
+	{ (void *)0x0000000000137540, "fromstruct_rrsig" },
+	{ (void *)0x00000000001377a0, "fromwire_opt.constprop.0" },
+	{ (void *)0x0000000000137a30, "fromtext_tkey.constprop.0" },
+	{ (void *)0x0000000000137d60, "totext_hip" },
+	{ (void *)0x0000000000138150, "fromstruct_any_tsig.constprop.0" },
+	{ (void *)0x00000000001383f0, "fromtext_keydata.constprop.0" },
+	{ (void *)0x00000000001386c0, "fromtext_ipseckey.constprop.0" },
+	{ (void *)0x0000000000138a80, "totext_naptr" },
+	{ (void *)0x0000000000138d90, "totext_any_tsig" },
+	{ (void *)0x0000000000139460, "totext_key" },
+	{ (void *)0x0000000000139a50, "totext_tkey" },
+	{ (void *)0x000000000013a230, "fromtext_loc.constprop.0" },
+	{ (void *)0x000000000013b4f0, "dns_rdata_apl_first" },
+	{ (void *)0x000000000013b600, "dns_rdata_apl_next" },
+	{ (void *)0x000000000013b780, "dns_rdata_apl_current" },
+	{ (void *)0x000000000013b990, "dns_rdata_hip_first" },
+	{ (void *)0x000000000013b9b0, "dns_rdata_hip_next" },
+	{ (void *)0x000000000013ba40, "fromstruct_hip" },
+	{ (void *)0x000000000013bd30, "dns_rdata_hip_current" },
+	{ (void *)0x000000000013bdc0, "dns_rdata_init" },
+	{ (void *)0x000000000013be00, "dns_rdata_reset" },
+	{ (void *)0x000000000013be80, "dns_rdata_clone" },
+	{ (void *)0x000000000013bf50, "dns_rdata_compare" },
+	{ (void *)0x000000000013c4e0, "dns_rdata_casecompare" },
+	{ (void *)0x000000000013d800, "dns_rdata_fromregion" },
+	{ (void *)0x000000000013d890, "dns_rdata_toregion" },
+	{ (void *)0x000000000013d910, "totext_dnskey" },
+	{ (void *)0x000000000013e050, "totext_keydata" },
+	{ (void *)0x000000000013e6a0, "dns_rdata_fromwire" },
+	{ (void *)0x0000000000140290, "dns_rdata_towire" },
+	{ (void *)0x0000000000141a70, "dns_rdata_fromstruct" },
+	{ (void *)0x00000000001439f0, "dns_rdata_tostruct" },
+	{ (void *)0x0000000000145700, "dns_rdata_freestruct" },
+	{ (void *)0x0000000000146550, "dns_rdata_additionaldata" },
+	{ (void *)0x0000000000146c70, "dns_rdata_digest" },
+	{ (void *)0x00000000001476b0, "dns_rdata_checkowner" },
+	{ (void *)0x0000000000147710, "dns_rdata_checknames" },
+	{ (void *)0x0000000000147c60, "dns_rdatatype_attributes" },
+	{ (void *)0x0000000000147db0, "dns_rdatatype_fromtext" },
+	{ (void *)0x0000000000149560, "fromtext_nsec3.constprop.0" },
+	{ (void *)0x0000000000149960, "fromtext_nsec.constprop.0" },
+	{ (void *)0x0000000000149c50, "fromtext_rrsig.constprop.0" },
+	{ (void *)0x000000000014a100, "fromtext_nxt.constprop.0" },
+	{ (void *)0x000000000014a410, "fromtext_sig.constprop.0" },
+	{ (void *)0x000000000014a800, "dns_rdata_fromtext" },
+	{ (void *)0x000000000014d820, "dns_rdatatype_totext" },
+	{ (void *)0x000000000014eb20, "totext_sig" },
+	{ (void *)0x000000000014f210, "totext_nxt" },
+	{ (void *)0x000000000014f480, "totext_rrsig" },
+	{ (void *)0x000000000014fb40, "totext_nsec3" },
+	{ (void *)0x00000000001501d0, "totext_nsec.constprop.0" },
+	{ (void *)0x00000000001504d0, "rdata_totext" },
+	{ (void *)0x0000000000151fb0, "dns_rdata_totext" },
+	{ (void *)0x0000000000152000, "dns_rdata_tofmttext" },
+	{ (void *)0x0000000000152080, "dns_rdatatype_format" },
+	{ (void *)0x0000000000152100, "dns_rdata_covers" },
+	{ (void *)0x0000000000152170, "dns_rdatatype_ismeta" },
+	{ (void *)0x0000000000152180, "dns_rdatatype_issingleton" },
+	{ (void *)0x0000000000152190, "dns_rdatatype_notquestion" },
+	{ (void *)0x00000000001521a0, "dns_rdatatype_questiononly" },
+	{ (void *)0x00000000001521b0, "dns_rdatatype_atparent" },
+	{ (void *)0x00000000001521c0, "dns_rdataclass_ismeta" },
+	{ (void *)0x00000000001521e0, "dns_rdatatype_isdnssec" },
+	{ (void *)0x00000000001521f0, "dns_rdatatype_iszonecutauth" },
+	{ (void *)0x0000000000152210, "dns_rdatatype_isknown" },
+	{ (void *)0x0000000000152230, "dns_rdata_exists" },
+	{ (void *)0x00000000001522b0, "dns_rdata_notexist" },
+	{ (void *)0x0000000000152330, "dns_rdata_deleterrset" },
+	{ (void *)0x00000000001523b0, "dns_rdata_makedelete" },
+	{ (void *)0x00000000001523e0, "dns_rdata_updateop" },
+	{ (void *)0x0000000000152510, "isc__rdatalist_disassociate" },
+	{ (void *)0x0000000000152520, "isc__rdatalist_first" },
+	{ (void *)0x0000000000152540, "isc__rdatalist_addnoqname" },
+	{ (void *)0x0000000000152620, "isc__rdatalist_addclosest" },
+	{ (void *)0x0000000000152700, "isc__rdatalist_getnoqname" },
+	{ (void *)0x0000000000152810, "isc__rdatalist_getclosest" },
+	{ (void *)0x0000000000152920, "isc__rdatalist_next" },
+	{ (void *)0x0000000000152970, "isc__rdatalist_clone" },
+	{ (void *)0x0000000000152a00, "isc__rdatalist_count" },
+	{ (void *)0x0000000000152a50, "isc__rdatalist_current" },
+	{ (void *)0x0000000000152ab0, "dns_rdatalist_init" },
+	{ (void *)0x0000000000152b00, "dns_rdatalist_tordataset" },
+	{ (void *)0x0000000000152be0, "dns_rdatalist_fromrdataset" },
+	{ (void *)0x0000000000152c10, "question_disassociate" },
+	{ (void *)0x0000000000152c20, "question_cursor" },
+	{ (void *)0x0000000000152c30, "question_clone" },
+	{ (void *)0x0000000000152c70, "towire_compare" },
+	{ (void *)0x0000000000152c80, "question_count" },
+	{ (void *)0x0000000000152ca0, "question_current" },
+	{ (void *)0x0000000000152cc0, "dns_trust_totext" },
+	{ (void *)0x0000000000152ce0, "dns_rdataset_init" },
+	{ (void *)0x0000000000152d50, "dns_rdataset_invalidate" },
+	{ (void *)0x0000000000152df0, "dns_rdataset_disassociate" },
+	{ (void *)0x0000000000152e90, "dns_rdataset_isassociated" },
+	{ (void *)0x0000000000152ed0, "dns_rdataset_makequestion" },
+	{ (void *)0x0000000000152f40, "dns_rdataset_count" },
+	{ (void *)0x0000000000152fa0, "dns_rdataset_clone" },
+	{ (void *)0x0000000000153040, "dns_rdataset_first" },
+	{ (void *)0x00000000001530a0, "dns_rdataset_next" },
+	{ (void *)0x0000000000153100, "dns_rdataset_current" },
+	{ (void *)0x0000000000153160, "towiresorted.constprop.0" },
+	{ (void *)0x0000000000153cf0, "dns_rdataset_towiresorted" },
+	{ (void *)0x0000000000153d10, "dns_rdataset_towirepartial" },
+	{ (void *)0x0000000000153d60, "dns_rdataset_towire" },
+	{ (void *)0x0000000000153d80, "dns_rdataset_additionaldata" },
+	{ (void *)0x0000000000153e80, "dns_rdataset_addnoqname" },
+	{ (void *)0x0000000000153ef0, "dns_rdataset_getnoqname" },
+	{ (void *)0x0000000000153f60, "dns_rdataset_addclosest" },
+	{ (void *)0x0000000000153fd0, "dns_rdataset_getclosest" },
+	{ (void *)0x0000000000154040, "dns_rdataset_getadditional" },
+	{ (void *)0x00000000001541e0, "dns_rdataset_setadditional" },
+	{ (void *)0x0000000000154260, "dns_rdataset_putadditional" },
+	{ (void *)0x00000000001542e0, "dns_rdataset_settrust" },
+	{ (void *)0x0000000000154350, "dns_rdataset_expire" },
+	{ (void *)0x00000000001543c0, "dns_rdataset_trimttl" },
+	{ (void *)0x00000000001544e0, "dns_rdatasetiter_destroy" },
+	{ (void *)0x0000000000154560, "dns_rdatasetiter_first" },
+	{ (void *)0x0000000000154590, "dns_rdatasetiter_next" },
+	{ (void *)0x00000000001545c0, "dns_rdatasetiter_current" },
+	{ (void *)0x0000000000154660, "rdataset_disassociate" },
+	{ (void *)0x0000000000154670, "rdataset_first" },
+	{ (void *)0x00000000001546b0, "rdataset_next" },
+	{ (void *)0x00000000001546e0, "rdataset_clone" },
+	{ (void *)0x0000000000154730, "rdataset_count" },
+	{ (void *)0x0000000000154750, "compare_rdata" },
+	{ (void *)0x0000000000154760, "rdataset_current" },
+	{ (void *)0x00000000001547e0, "dns_rdataslab_fromrdataset" },
+	{ (void *)0x0000000000154c00, "dns_rdataslab_tordataset" },
+	{ (void *)0x0000000000154cc0, "dns_rdataslab_size" },
+	{ (void *)0x0000000000154d20, "dns_rdataslab_merge" },
+	{ (void *)0x00000000001559d0, "dns_rdataslab_subtract" },
+	{ (void *)0x0000000000156090, "dns_rdataslab_equal" },
+	{ (void *)0x0000000000156140, "dns_rdataslab_equalx" },
+	{ (void *)0x0000000000156370, "sort_finds" },
+	{ (void *)0x0000000000156710, "free_algorithm" },
+	{ (void *)0x0000000000156730, "free_digest" },
+	{ (void *)0x0000000000156750, "spillattimer_countdown" },
+	{ (void *)0x0000000000156920, "send_shutdown_events" },
+	{ (void *)0x0000000000156a60, "empty_bucket" },
+	{ (void *)0x0000000000156b50, "fctx_cleanupfinds" },
+	{ (void *)0x0000000000156cb0, "fctx_cleanupaltfinds" },
+	{ (void *)0x0000000000156e10, "fctx_cleanupforwaddrs" },
+	{ (void *)0x0000000000156fa0, "fctx_cleanupaltaddrs" },
+	{ (void *)0x0000000000157130, "log_edns" },
+	{ (void *)0x00000000001571b0, "rrsig_fromchildzone" },
+	{ (void *)0x00000000001572b0, "findname" },
+	{ (void *)0x00000000001575f0, "possibly_mark" },
+	{ (void *)0x0000000000157850, "log_fetch" },
+	{ (void *)0x00000000001578e0, "log_formerr" },
+	{ (void *)0x0000000000157a40, "fctx_log" },
+	{ (void *)0x0000000000157b30, "is_answertarget_allowed" },
+	{ (void *)0x0000000000157c90, "ncache_adderesult" },
+	{ (void *)0x0000000000157dc0, "clone_results" },
+	{ (void *)0x0000000000157f60, "resizehash" },
+	{ (void *)0x00000000001580c0, "fctx_destroy" },
+	{ (void *)0x0000000000158880, "destroy_badcache.part.0" },
+	{ (void *)0x0000000000158970, "fctx_shutdown" },
+	{ (void *)0x0000000000158a10, "fctx_nextaddress" },
+	{ (void *)0x0000000000158ca0, "trim_ns_ttl.part.0" },
+	{ (void *)0x0000000000158d60, "resquery_destroy.part.0" },
+	{ (void *)0x0000000000158d90, "dns_resolver_getquerydscp4.part.0" },
+	{ (void *)0x0000000000158db0, "dns_resolver_getquerydscp6.part.0" },
+	{ (void *)0x0000000000158dd0, "findnoqname.constprop.0" },
+	{ (void *)0x00000000001592e0, "fctx_sendevents.constprop.0" },
+	{ (void *)0x0000000000159730, "fctx_unlink" },
+	{ (void *)0x0000000000159ad0, "maybe_destroy" },
+	{ (void *)0x0000000000159d30, "fctx_decreference" },
+	{ (void *)0x0000000000159dc0, "add_bad" },
+	{ (void *)0x000000000015a140, "add_bad_edns" },
+	{ (void *)0x000000000015a250, "resquery_send" },
+	{ (void *)0x000000000015afe0, "check_related" },
+	{ (void *)0x000000000015b250, "valcreate" },
+	{ (void *)0x000000000015b430, "noanswer_response" },
+	{ (void *)0x000000000015bf70, "fctx_query" },
+	{ (void *)0x000000000015c880, "fctx_cancelquery.isra.0" },
+	{ (void *)0x000000000015d050, "fctx_cancelqueries" },
+	{ (void *)0x000000000015d0c0, "fctx_done" },
+	{ (void *)0x000000000015d2b0, "fctx_create" },
+	{ (void *)0x000000000015dc40, "answer_response" },
+	{ (void *)0x000000000015eb90, "dns_resolver_create" },
+	{ (void *)0x000000000015f500, "dns_resolver_freeze" },
+	{ (void *)0x000000000015f540, "dns_resolver_attach" },
+	{ (void *)0x000000000015f6d0, "dns_resolver_whenshutdown" },
+	{ (void *)0x000000000015f850, "dns_resolver_shutdown" },
+	{ (void *)0x000000000015fba0, "dns_resolver_detach" },
+	{ (void *)0x0000000000160250, "dns_resolver_createfetch2" },
+	{ (void *)0x0000000000160d70, "dns_resolver_createfetch" },
+	{ (void *)0x0000000000160db0, "dns_resolver_prime" },
+	{ (void *)0x0000000000161190, "dns_resolver_cancelfetch" },
+	{ (void *)0x0000000000161470, "fctx_doshutdown" },
+	{ (void *)0x00000000001617a0, "dns_resolver_destroyfetch" },
+	{ (void *)0x00000000001619b0, "prime_done" },
+	{ (void *)0x0000000000161c60, "dns_resolver_logfetch" },
+	{ (void *)0x0000000000161f20, "dns_resolver_dispatchmgr" },
+	{ (void *)0x0000000000161f50, "dns_resolver_dispatchv4" },
+	{ (void *)0x0000000000161f90, "dns_resolver_dispatchv6" },
+	{ (void *)0x0000000000161fd0, "dns_resolver_socketmgr" },
+	{ (void *)0x0000000000162000, "dns_resolver_taskmgr" },
+	{ (void *)0x0000000000162030, "dns_resolver_getlamettl" },
+	{ (void *)0x0000000000162060, "dns_resolver_setlamettl" },
+	{ (void *)0x0000000000162090, "dns_resolver_nrunning" },
+	{ (void *)0x0000000000162110, "dns_resolver_addalternate" },
+	{ (void *)0x0000000000162330, "dns_resolver_setudpsize" },
+	{ (void *)0x0000000000162360, "dns_resolver_getudpsize" },
+	{ (void *)0x0000000000162390, "dns_resolver_flushbadcache" },
+	{ (void *)0x0000000000162560, "dns_resolver_flushbadnames" },
+	{ (void *)0x0000000000162750, "dns_resolver_addbadcache" },
+	{ (void *)0x0000000000162ad0, "fctx_getaddresses" },
+	{ (void *)0x00000000001634f0, "fctx_try" },
+	{ (void *)0x0000000000163690, "fctx_start" },
+	{ (void *)0x00000000001639f0, "fctx_finddone" },
+	{ (void *)0x0000000000163d60, "resquery_connected" },
+	{ (void *)0x00000000001640d0, "process_sendevent" },
+	{ (void *)0x0000000000164300, "resquery_senddone" },
+	{ (void *)0x00000000001643c0, "resquery_udpconnected" },
+	{ (void *)0x0000000000164480, "resume_dslookup" },
+	{ (void *)0x0000000000164ad0, "fctx_timeout" },
+	{ (void *)0x0000000000164c50, "resquery_response" },
+	{ (void *)0x0000000000168850, "validated" },
+	{ (void *)0x0000000000169930, "dns_resolver_getbadcache" },
+	{ (void *)0x0000000000169b80, "dns_resolver_printbadcache" },
+	{ (void *)0x0000000000169dd0, "dns_resolver_reset_algorithms" },
+	{ (void *)0x0000000000169e20, "dns_resolver_disable_algorithm" },
+	{ (void *)0x000000000016a130, "dns_resolver_algorithm_supported" },
+	{ (void *)0x000000000016a1d0, "dns_resolver_reset_ds_digests" },
+	{ (void *)0x000000000016a220, "dns_resolver_disable_ds_digest" },
+	{ (void *)0x000000000016a530, "dns_resolver_ds_digest_supported" },
+	{ (void *)0x000000000016a5d0, "dns_resolver_resetmustbesecure" },
+	{ (void *)0x000000000016a620, "dns_resolver_setmustbesecure" },
+	{ (void *)0x000000000016a6b0, "dns_resolver_getmustbesecure" },
+	{ (void *)0x000000000016a730, "dns_resolver_getclientsperquery" },
+	{ (void *)0x000000000016a810, "dns_resolver_setclientsperquery" },
+	{ (void *)0x000000000016a8e0, "dns_resolver_getzeronosoattl" },
+	{ (void *)0x000000000016a910, "dns_resolver_setzeronosoattl" },
+	{ (void *)0x000000000016a940, "dns_resolver_getoptions" },
+	{ (void *)0x000000000016a970, "dns_resolver_gettimeout" },
+	{ (void *)0x000000000016a9a0, "dns_resolver_settimeout" },
+	{ (void *)0x000000000016aa00, "dns_resolver_setquerydscp4" },
+	{ (void *)0x000000000016aa30, "dns_resolver_getquerydscp4" },
+	{ (void *)0x000000000016aa50, "dns_resolver_setquerydscp6" },
+	{ (void *)0x000000000016aa80, "dns_resolver_getquerydscp6" },
+	{ (void *)0x000000000016aaa0, "initialize_action" },
+	{ (void *)0x000000000016ab20, "dns_result_totext" },
+	{ (void *)0x000000000016ab70, "dns_result_register" },
+	{ (void *)0x000000000016abc0, "dns_result_torcode" },
+	{ (void *)0x000000000016acc0, "in_rootns" },
+	{ (void *)0x000000000016ad90, "inrrset" },
+	{ (void *)0x000000000016ae20, "report.isra.0" },
+	{ (void *)0x000000000016af80, "dns_rootns_create" },
+	{ (void *)0x000000000016b490, "dns_root_checkhints" },
+	{ (void *)0x000000000016be00, "set_sum_pair" },
+	{ (void *)0x000000000016be70, "zbit_to_num" },
+	{ (void *)0x000000000016bee0, "fix_qname_skip_recurse" },
+	{ (void *)0x000000000016bf80, "adj_trigger_cnt" },
+	{ (void *)0x000000000016c210, "rpz_node_deleter" },
+	{ (void *)0x000000000016c230, "add_nm" },
+	{ (void *)0x000000000016c380, "fix_triggers" },
+	{ (void *)0x000000000016c650, "ip2name" },
+	{ (void *)0x000000000016c880, "make_nm_set.part.0" },
+	{ (void *)0x000000000016c8b0, "make_addr_set.part.0" },
+	{ (void *)0x000000000016c8e0, "type_from_name" },
+	{ (void *)0x000000000016c970, "new_node.isra.0" },
+	{ (void *)0x000000000016cb00, "search" },
+	{ (void *)0x000000000016cf80, "name2data" },
+	{ (void *)0x000000000016d1a0, "add_name" },
+	{ (void *)0x000000000016d270, "del_name" },
+	{ (void *)0x000000000016d4b0, "name2ipkey" },
+	{ (void *)0x000000000016dc10, "add_cidr" },
+	{ (void *)0x000000000016dd20, "dns_rpz_type2str" },
+	{ (void *)0x000000000016ddb0, "dns_rpz_str2policy" },
+	{ (void *)0x000000000016de20, "dns_rpz_policy2str" },
+	{ (void *)0x000000000016ded0, "dns_rpz_new_zones" },
+	{ (void *)0x000000000016e1a0, "dns_rpz_attach_rpzs" },
+	{ (void *)0x000000000016e200, "dns_rpz_detach_rpzs" },
+	{ (void *)0x000000000016e650, "dns_rpz_beginload" },
+	{ (void *)0x000000000016e8d0, "dns_rpz_ready" },
+	{ (void *)0x000000000016ef70, "dns_rpz_add" },
+	{ (void *)0x000000000016f130, "dns_rpz_delete" },
+	{ (void *)0x000000000016f4b0, "dns_rpz_find_ip" },
+	{ (void *)0x000000000016f860, "dns_rpz_find_name" },
+	{ (void *)0x000000000016fa20, "dns_rpz_decode_cname" },
+	{ (void *)0x000000000016fbb0, "add_entries" },
+	{ (void *)0x000000000016fd30, "add_hash" },
+	{ (void *)0x000000000016fe40, "debit_log" },
+	{ (void *)0x000000000016fee0, "alloc_hash" },
+	{ (void *)0x0000000000170070, "get_rate.part.0" },
+	{ (void *)0x00000000001700a0, "alloc_entries.isra.0" },
+	{ (void *)0x0000000000170160, "expand_entries" },
+	{ (void *)0x00000000001701d0, "response_balance" },
+	{ (void *)0x0000000000170280, "request_grow" },
+	{ (void *)0x00000000001703c0, "ref_entry" },
+	{ (void *)0x00000000001705b0, "debit_rrl_entry" },
+	{ (void *)0x0000000000170da0, "make_log_buf.part.0" },
+	{ (void *)0x0000000000171cd0, "log_end.part.0" },
+	{ (void *)0x0000000000171dd0, "log_stops" },
+	{ (void *)0x0000000000171f00, "lock_entry" },
+	{ (void *)0x0000000000172920, "free_shard" },
+	{ (void *)0x0000000000172b50, "detach_rrl" },
+	{ (void *)0x0000000000172c90, "grow_shard" },
+	{ (void *)0x0000000000173080, "dns_rrl" },
+	{ (void *)0x0000000000173d50, "dns_rrl_view_destroy" },
+	{ (void *)0x0000000000173e40, "dns_rrl_settask" },
+	{ (void *)0x0000000000173e80, "dns_rrl_init" },
+	{ (void *)0x0000000000174370, "dns_rriterator_init" },
+	{ (void *)0x0000000000174460, "dns_rriterator_first" },
+	{ (void *)0x00000000001745b0, "dns_rriterator_nextrrset" },
+	{ (void *)0x0000000000174700, "dns_rriterator_next" },
+	{ (void *)0x00000000001747d0, "dns_rriterator_pause" },
+	{ (void *)0x0000000000174830, "dns_rriterator_destroy" },
+	{ (void *)0x00000000001748c0, "dns_rriterator_current" },
+	{ (void *)0x0000000000174a80, "beginload" },
+	{ (void *)0x0000000000174a90, "dump" },
+	{ (void *)0x0000000000174aa0, "findzonecut" },
+	{ (void *)0x0000000000174ab0, "printnode" },
+	{ (void *)0x0000000000174ac0, "addrdataset" },
+	{ (void *)0x0000000000174ad0, "subtractrdataset" },
+	{ (void *)0x0000000000174ae0, "deleterdataset" },
+	{ (void *)0x0000000000174af0, "issecure" },
+	{ (void *)0x0000000000174b00, "ispersistent" },
+	{ (void *)0x0000000000174b10, "overmem" },
+	{ (void *)0x0000000000174b20, "settask" },
+	{ (void *)0x0000000000174b30, "dbiterator_first" },
+	{ (void *)0x0000000000174b50, "dbiterator_last" },
+	{ (void *)0x0000000000174b70, "dbiterator_prev" },
+	{ (void *)0x0000000000174b90, "dbiterator_next" },
+	{ (void *)0x0000000000174bb0, "dbiterator_pause" },
+	{ (void *)0x0000000000174bc0, "rdatasetiter_first" },
+	{ (void *)0x0000000000174be0, "rdatasetiter_next" },
+	{ (void *)0x0000000000174c00, "expirenode" },
+	{ (void *)0x0000000000174c30, "attachnode" },
+	{ (void *)0x0000000000174d30, "allrdatasets" },
+	{ (void *)0x0000000000174df0, "attach" },
+	{ (void *)0x0000000000174ed0, "dns_sdb_create" },
+	{ (void *)0x0000000000175220, "detach" },
+	{ (void *)0x00000000001754a0, "dbiterator_origin" },
+	{ (void *)0x00000000001754b0, "destroynode" },
+	{ (void *)0x0000000000175890, "detachnode" },
+	{ (void *)0x00000000001759e0, "rdatasetiter_destroy" },
+	{ (void *)0x0000000000175a30, "dbiterator_seek" },
+	{ (void *)0x0000000000175aa0, "rdataset_clone" },
+	{ (void *)0x0000000000175af0, "disassociate" },
+	{ (void *)0x0000000000175b20, "dbiterator_destroy" },
+	{ (void *)0x0000000000175c70, "createiterator" },
+	{ (void *)0x0000000000175f70, "closeversion" },
+	{ (void *)0x0000000000175fd0, "attachversion" },
+	{ (void *)0x0000000000176030, "currentversion" },
+	{ (void *)0x0000000000176070, "dbiterator_current" },
+	{ (void *)0x00000000001760c0, "findrdataset" },
+	{ (void *)0x00000000001761a0, "endload" },
+	{ (void *)0x00000000001761b0, "createnode.constprop.0" },
+	{ (void *)0x00000000001762a0, "getnode.constprop.0" },
+	{ (void *)0x0000000000176500, "findnodeext" },
+	{ (void *)0x0000000000176910, "findext" },
+	{ (void *)0x0000000000176f00, "newversion" },
+	{ (void *)0x0000000000176f10, "nodecount" },
+	{ (void *)0x0000000000176f20, "rdatasetiter_current" },
+	{ (void *)0x0000000000176f80, "dns_sdb_register" },
+	{ (void *)0x00000000001771b0, "dns_sdb_unregister" },
+	{ (void *)0x0000000000177250, "dns_sdb_putrdata" },
+	{ (void *)0x0000000000177490, "dns_sdb_putrr" },
+	{ (void *)0x00000000001777c0, "dns_sdb_putnamedrr" },
+	{ (void *)0x0000000000177810, "dns_sdb_putnamedrdata" },
+	{ (void *)0x0000000000177870, "dns_sdb_putsoa" },
+	{ (void *)0x0000000000177930, "rdatasetiter_first" },
+	{ (void *)0x0000000000177950, "rdatasetiter_next" },
+	{ (void *)0x0000000000177970, "beginload" },
+	{ (void *)0x0000000000177980, "dump" },
+	{ (void *)0x0000000000177990, "findzonecut" },
+	{ (void *)0x00000000001779a0, "printnode" },
+	{ (void *)0x00000000001779b0, "issecure" },
+	{ (void *)0x00000000001779c0, "ispersistent" },
+	{ (void *)0x00000000001779d0, "overmem" },
+	{ (void *)0x00000000001779e0, "settask" },
+	{ (void *)0x00000000001779f0, "dbiterator_first" },
+	{ (void *)0x0000000000177a10, "dbiterator_last" },
+	{ (void *)0x0000000000177a30, "dbiterator_prev" },
+	{ (void *)0x0000000000177a50, "dbiterator_next" },
+	{ (void *)0x0000000000177a70, "dbiterator_pause" },
+	{ (void *)0x0000000000177a80, "expirenode" },
+	{ (void *)0x0000000000177ab0, "dbiterator_seek" },
+	{ (void *)0x0000000000177b20, "attach" },
+	{ (void *)0x0000000000177c00, "attachnode" },
+	{ (void *)0x0000000000177d00, "allrdatasets" },
+	{ (void *)0x0000000000177e00, "detach" },
+	{ (void *)0x0000000000177f70, "destroynode" },
+	{ (void *)0x0000000000178350, "detachnode" },
+	{ (void *)0x00000000001784a0, "rdatasetiter_destroy" },
+	{ (void *)0x00000000001784f0, "deleterdataset" },
+	{ (void *)0x0000000000178640, "dns_sdlzssumatch" },
+	{ (void *)0x0000000000178900, "dns_sdlzcreateDBP" },
+	{ (void *)0x0000000000178ae0, "dbiterator_origin" },
+	{ (void *)0x0000000000178af0, "findrdataset" },
+	{ (void *)0x0000000000178be0, "rdataset_clone" },
+	{ (void *)0x0000000000178c30, "disassociate" },
+	{ (void *)0x0000000000178c60, "dbiterator_destroy" },
+	{ (void *)0x0000000000178db0, "sdlz_log" },
+	{ (void *)0x0000000000178e60, "closeversion" },
+	{ (void *)0x0000000000178fc0, "newversion" },
+	{ (void *)0x00000000001790c0, "dns_sdlzdestroy" },
+	{ (void *)0x0000000000179190, "dns_sdlzcreate" },
+	{ (void *)0x0000000000179320, "attachversion" },
+	{ (void *)0x0000000000179380, "currentversion" },
+	{ (void *)0x00000000001793e0, "dns_sdlzconfigure" },
+	{ (void *)0x00000000001794c0, "dbiterator_current" },
+	{ (void *)0x0000000000179510, "modrdataset.constprop.0" },
+	{ (void *)0x0000000000179730, "addrdataset" },
+	{ (void *)0x0000000000179790, "subtractrdataset" },
+	{ (void *)0x00000000001797f0, "createnode.constprop.0" },
+	{ (void *)0x00000000001798f0, "endload" },
+	{ (void *)0x0000000000179900, "nodecount" },
+	{ (void *)0x0000000000179910, "rdatasetiter_current" },
+	{ (void *)0x0000000000179970, "dns_sdlzfindzone" },
+	{ (void *)0x0000000000179b70, "createiterator.part.0" },
+	{ (void *)0x0000000000179eb0, "createiterator" },
+	{ (void *)0x0000000000179f10, "dns_sdlzallowzonexfr" },
+	{ (void *)0x000000000017a1d0, "findnodeext" },
+	{ (void *)0x000000000017a7e0, "findnode" },
+	{ (void *)0x000000000017a7f0, "findext" },
+	{ (void *)0x000000000017ad90, "find" },
+	{ (void *)0x000000000017adc0, "getoriginnode" },
+	{ (void *)0x000000000017ae50, "dns_sdlz_putrr" },
+	{ (void *)0x000000000017b280, "dns_sdlz_putnamedrr" },
+	{ (void *)0x000000000017b4e0, "dns_sdlz_putsoa" },
+	{ (void *)0x000000000017b5a0, "dns_sdlzregister" },
+	{ (void *)0x000000000017b820, "dns_sdlzunregister" },
+	{ (void *)0x000000000017b8e0, "dns_sdlz_setdb" },
+	{ (void *)0x000000000017b910, "dns_soa_buildrdata" },
+	{ (void *)0x000000000017ba80, "dns_soa_getserial" },
+	{ (void *)0x000000000017bae0, "dns_soa_getrefresh" },
+	{ (void *)0x000000000017bb40, "dns_soa_getretry" },
+	{ (void *)0x000000000017bba0, "dns_soa_getexpire" },
+	{ (void *)0x000000000017bc00, "dns_soa_getminimum" },
+	{ (void *)0x000000000017bc60, "dns_soa_setserial" },
+	{ (void *)0x000000000017bcc0, "dns_soa_setrefresh" },
+	{ (void *)0x000000000017bd20, "dns_soa_setretry" },
+	{ (void *)0x000000000017bd80, "dns_soa_setexpire" },
+	{ (void *)0x000000000017bde0, "dns_soa_setminimum" },
+	{ (void *)0x000000000017be40, "dns_ssutable_create" },
+	{ (void *)0x000000000017bf50, "dns_ssutable_attach" },
+	{ (void *)0x000000000017c070, "dns_ssutable_detach" },
+	{ (void *)0x000000000017c3e0, "dns_ssutable_addrule" },
+	{ (void *)0x000000000017c7d0, "dns_ssutable_checkrules" },
+	{ (void *)0x000000000017d260, "dns_ssurule_isgrant" },
+	{ (void *)0x000000000017d290, "dns_ssurule_identity" },
+	{ (void *)0x000000000017d2c0, "dns_ssurule_matchtype" },
+	{ (void *)0x000000000017d2f0, "dns_ssurule_name" },
+	{ (void *)0x000000000017d320, "dns_ssurule_types" },
+	{ (void *)0x000000000017d380, "dns_ssutable_firstrule" },
+	{ (void *)0x000000000017d3f0, "dns_ssutable_nextrule" },
+	{ (void *)0x000000000017d460, "dns_ssutable_createdlz" },
+	{ (void *)0x000000000017d570, "ssu_e_log.constprop.0" },
+	{ (void *)0x000000000017d620, "dns_ssu_external_match" },
+	{ (void *)0x000000000017dbe0, "rdatatype_dumpcb" },
+	{ (void *)0x000000000017dc10, "opcode_dumpcb" },
+	{ (void *)0x000000000017dc20, "latencysum_dumpcb" },
+	{ (void *)0x000000000017dc70, "create_stats" },
+	{ (void *)0x000000000017dd90, "latency_dumpcb" },
+	{ (void *)0x000000000017de50, "rdataset_dumpcb" },
+	{ (void *)0x000000000017df40, "dns_stats_attach" },
+	{ (void *)0x000000000017e020, "dns_stats_detach" },
+	{ (void *)0x000000000017e150, "dns_generalstats_create" },
+	{ (void *)0x000000000017e180, "dns_rdatatypestats_create" },
+	{ (void *)0x000000000017e1c0, "dns_rdatasetstats_create" },
+	{ (void *)0x000000000017e200, "dns_opcodestats_create" },
+	{ (void *)0x000000000017e240, "dns_latencystats_create" },
+	{ (void *)0x000000000017e280, "dns_generalstats_increment" },
+	{ (void *)0x000000000017e2c0, "dns_rdatatypestats_increment" },
+	{ (void *)0x000000000017e320, "dns_rdatasetstats_increment" },
+	{ (void *)0x000000000017e3c0, "dns_rdatasetstats_decrement" },
+	{ (void *)0x000000000017e450, "dns_opcodestats_increment" },
+	{ (void *)0x000000000017e490, "dns_latencystats_record" },
+	{ (void *)0x000000000017e5e0, "dns_generalstats_dump" },
+	{ (void *)0x000000000017e620, "dns_rdatatypestats_dump" },
+	{ (void *)0x000000000017e680, "dns_rdatasetstats_dump" },
+	{ (void *)0x000000000017e6e0, "dns_opcodestats_dump" },
+	{ (void *)0x000000000017e740, "dns_latencystats_dump" },
+	{ (void *)0x000000000017e7a0, "dns_latencystats_dumpsums" },
+	{ (void *)0x000000000017e800, "dns_stats_alloccounters" },
+	{ (void *)0x000000000017e850, "dns_stats_freecounters" },
+	{ (void *)0x000000000017e880, "recv_message" },
+	{ (void *)0x000000000017e9b0, "recv_length" },
+	{ (void *)0x000000000017eb70, "dns_tcpmsg_init" },
+	{ (void *)0x000000000017ec10, "dns_tcpmsg_setmaxsize" },
+	{ (void *)0x000000000017ec70, "dns_tcpmsg_readmessage" },
+	{ (void *)0x000000000017edf0, "dns_tcpmsg_cancelread" },
+	{ (void *)0x000000000017ee30, "dns_tcpmsg_keepbuffer" },
+	{ (void *)0x000000000017eeb0, "dns_tcpmsg_invalidate" },
+	{ (void *)0x000000000017ef20, "dns_time64_totext" },
+	{ (void *)0x000000000017f190, "dns_time64_from32" },
+	{ (void *)0x000000000017f1e0, "dns_time32_totext" },
+	{ (void *)0x000000000017f250, "dns_time64_fromtext" },
+	{ (void *)0x000000000017f520, "dns_time32_fromtext" },
+	{ (void *)0x000000000017f550, "dns_timer_setidle" },
+	{ (void *)0x000000000017f5c0, "tkey_log" },
+	{ (void *)0x000000000017f680, "find_tkey" },
+	{ (void *)0x000000000017f740, "compute_secret" },
+	{ (void *)0x000000000017f8c0, "free_namelist" },
+	{ (void *)0x000000000017fb20, "add_rdata_to_list" },
+	{ (void *)0x000000000017fed0, "_dns_tkey_dumpmessage" },
+	{ (void *)0x000000000017ff60, "buildquery.constprop.0" },
+	{ (void *)0x00000000001802c0, "dns_tkeyctx_create" },
+	{ (void *)0x00000000001803c0, "dns_tkeyctx_destroy" },
+	{ (void *)0x00000000001804f0, "dns_tkey_processquery" },
+	{ (void *)0x00000000001818a0, "dns_tkey_builddhquery" },
+	{ (void *)0x0000000000181d60, "dns_tkey_buildgssquery" },
+	{ (void *)0x0000000000181f80, "dns_tkey_builddeletequery" },
+	{ (void *)0x0000000000182070, "dns_tkey_processdhresponse" },
+	{ (void *)0x0000000000182840, "dns_tkey_processgssresponse" },
+	{ (void *)0x0000000000182be0, "dns_tkey_processdeleteresponse" },
+	{ (void *)0x0000000000182de0, "dns_tkey_gssnegotiate" },
+	{ (void *)0x0000000000183130, "remove_fromring" },
+	{ (void *)0x0000000000183290, "tsigkey_free" },
+	{ (void *)0x00000000001833e0, "tsig_log.constprop.0" },
+	{ (void *)0x0000000000183610, "cleanup_ring" },
+	{ (void *)0x0000000000183770, "keyring_add" },
+	{ (void *)0x00000000001838d0, "free_tsignode" },
+	{ (void *)0x0000000000183ab0, "dns_tsigkey_createfromkey" },
+	{ (void *)0x0000000000184330, "restore_key" },
+	{ (void *)0x0000000000184730, "dns_tsigkeyring_dumpanddetach" },
+	{ (void *)0x0000000000184ae0, "dns_tsigkey_create" },
+	{ (void *)0x0000000000184ed0, "dns_tsigkey_attach" },
+	{ (void *)0x0000000000184f60, "dns_tsigkey_detach" },
+	{ (void *)0x0000000000185000, "dns_tsigkey_setdeleted" },
+	{ (void *)0x00000000001850d0, "dns_tsig_sign" },
+	{ (void *)0x0000000000185a40, "dns_tsigkey_find" },
+	{ (void *)0x0000000000185fb0, "dns_tsig_verify" },
+	{ (void *)0x0000000000187060, "dns_tsigkeyring_create" },
+	{ (void *)0x00000000001871d0, "dns_tsigkeyring_add" },
+	{ (void *)0x0000000000187210, "dns_tsigkeyring_attach" },
+	{ (void *)0x0000000000187340, "dns_tsigkeyring_detach" },
+	{ (void *)0x0000000000187480, "dns_keyring_restore" },
+	{ (void *)0x00000000001874d0, "ttlfmt" },
+	{ (void *)0x00000000001875c0, "bind_ttl.isra.0" },
+	{ (void *)0x00000000001877a0, "dns_ttl_totext" },
+	{ (void *)0x0000000000187a30, "dns_counter_fromtext" },
+	{ (void *)0x0000000000187a40, "dns_ttl_fromtext" },
+	{ (void *)0x0000000000187a70, "rrset_exists_action" },
+	{ (void *)0x0000000000187a80, "true_p" },
+	{ (void *)0x0000000000187a90, "rrsig_p" },
+	{ (void *)0x0000000000187aa0, "is_non_nsec_action" },
+	{ (void *)0x0000000000187ae0, "name_order" },
+	{ (void *)0x0000000000187b00, "temp_order" },
+	{ (void *)0x0000000000187b50, "foreach_node_rr_action" },
+	{ (void *)0x0000000000187c00, "do_one_tuple" },
+	{ (void *)0x0000000000187de0, "is_active" },
+	{ (void *)0x0000000000187f30, "foreach_rrset" },
+	{ (void *)0x0000000000188050, "foreach_rr" },
+	{ (void *)0x0000000000188250, "rrset_exists" },
+	{ (void *)0x0000000000188290, "update_log" },
+	{ (void *)0x0000000000188390, "delete_if.constprop.0" },
+	{ (void *)0x00000000001883f0, "name_exists_action" },
+	{ (void *)0x0000000000188400, "namelist_append_subdomain" },
+	{ (void *)0x0000000000188570, "add_sigs" },
+	{ (void *)0x00000000001889c0, "delete_if_action" },
+	{ (void *)0x0000000000188a50, "add_exposed_sigs" },
+	{ (void *)0x0000000000188c60, "next_active" },
+	{ (void *)0x0000000000188f00, "dns_update_signatures" },
+	{ (void *)0x000000000018b200, "dns_update_soaserial" },
+	{ (void *)0x000000000018b250, "check_ds" },
+	{ (void *)0x000000000018b370, "isselfsigned" },
+	{ (void *)0x000000000018b6a0, "get_dst_key" },
+	{ (void *)0x000000000018b880, "isdelegation" },
+	{ (void *)0x000000000018bc60, "val_rdataset_first" },
+	{ (void *)0x000000000018bda0, "val_rdataset_next" },
+	{ (void *)0x000000000018bed0, "exit_check.part.0" },
+	{ (void *)0x000000000018bf00, "validator_logv.constprop.0" },
+	{ (void *)0x000000000018bff0, "validator_log" },
+	{ (void *)0x000000000018c0c0, "view_find" },
+	{ (void *)0x000000000018c5c0, "validator_logcreate" },
+	{ (void *)0x000000000018c640, "verify" },
+	{ (void *)0x000000000018c860, "checkkey" },
+	{ (void *)0x000000000018ca00, "checkwildcard" },
+	{ (void *)0x000000000018cca0, "findnsec3proofs.isra.0" },
+	{ (void *)0x000000000018d190, "keyfromds" },
+	{ (void *)0x000000000018d330, "create_fetch" },
+	{ (void *)0x000000000018d4a0, "dns_validator_create" },
+	{ (void *)0x000000000018d900, "validate_authority" },
+	{ (void *)0x000000000018dc20, "validate_ncache" },
+	{ (void *)0x000000000018df70, "finddlvsep" },
+	{ (void *)0x000000000018e4f0, "startfinddlvsep" },
+	{ (void *)0x000000000018e8c0, "validatezonekey" },
+	{ (void *)0x000000000018faa0, "proveunsecure" },
+	{ (void *)0x0000000000190680, "nsecvalidate.part.0" },
+	{ (void *)0x0000000000190940, "nsecvalidate" },
+	{ (void *)0x00000000001909b0, "validate" },
+	{ (void *)0x00000000001911f0, "dns_validator_send" },
+	{ (void *)0x00000000001912e0, "dns_validator_cancel" },
+	{ (void *)0x0000000000191460, "dns_validator_destroy" },
+	{ (void *)0x00000000001915d0, "destroy" },
+	{ (void *)0x00000000001917a0, "validator_start" },
+	{ (void *)0x0000000000191c60, "dlvfetched" },
+	{ (void *)0x0000000000192350, "fetch_callback_validator" },
+	{ (void *)0x00000000001926f0, "dsfetched" },
+	{ (void *)0x0000000000192a80, "dsfetched2" },
+	{ (void *)0x0000000000192eb0, "dlvvalidated" },
+	{ (void *)0x0000000000193320, "keyvalidated" },
+	{ (void *)0x00000000001936b0, "dsvalidated" },
+	{ (void *)0x0000000000193b00, "cnamevalidated" },
+	{ (void *)0x0000000000193e00, "authvalidated" },
+	{ (void *)0x0000000000194170, "dialup" },
+	{ (void *)0x0000000000194180, "dns_view_create" },
+	{ (void *)0x0000000000194890, "dns_view_attach" },
+	{ (void *)0x0000000000194920, "dns_view_dialup" },
+	{ (void *)0x0000000000194990, "dns_view_weakattach" },
+	{ (void *)0x0000000000194a70, "dns_view_createzonetable" },
+	{ (void *)0x0000000000194b00, "dns_view_createresolver" },
+	{ (void *)0x0000000000194de0, "dns_view_setcache2" },
+	{ (void *)0x0000000000194ef0, "dns_view_setcache" },
+	{ (void *)0x0000000000194f00, "dns_view_iscacheshared" },
+	{ (void *)0x0000000000194f30, "dns_view_sethints" },
+	{ (void *)0x0000000000194fe0, "dns_view_setkeyring" },
+	{ (void *)0x0000000000195060, "dns_view_setdynamickeyring" },
+	{ (void *)0x00000000001950e0, "dns_view_getdynamickeyring" },
+	{ (void *)0x0000000000195160, "dns_view_restorekeyring" },
+	{ (void *)0x0000000000195200, "dns_view_setdstport" },
+	{ (void *)0x0000000000195230, "dns_view_freeze" },
+	{ (void *)0x00000000001952c0, "dns_view_thaw" },
+	{ (void *)0x0000000000195320, "dns_view_addzone" },
+	{ (void *)0x00000000001953a0, "dns_view_findzone" },
+	{ (void *)0x00000000001954a0, "dns_view_find2" },
+	{ (void *)0x0000000000195c60, "dns_view_find" },
+	{ (void *)0x0000000000195c90, "dns_view_simplefind" },
+	{ (void *)0x0000000000195e20, "dns_view_findzonecut2" },
+	{ (void *)0x0000000000196440, "dns_view_findzonecut" },
+	{ (void *)0x0000000000196460, "dns_viewlist_find" },
+	{ (void *)0x00000000001964f0, "dns_viewlist_findzone" },
+	{ (void *)0x0000000000196730, "dns_view_load" },
+	{ (void *)0x0000000000196790, "dns_view_loadnew" },
+	{ (void *)0x00000000001967f0, "dns_view_asyncload" },
+	{ (void *)0x0000000000196850, "dns_view_gettsig" },
+	{ (void *)0x00000000001968c0, "dns_view_getpeertsig" },
+	{ (void *)0x0000000000196940, "dns_view_checksig" },
+	{ (void *)0x00000000001969b0, "dns_view_dumpdbtostream" },
+	{ (void *)0x0000000000196a40, "dns_view_flushcache2" },
+	{ (void *)0x0000000000196b00, "dns_view_flushcache" },
+	{ (void *)0x0000000000196b10, "dns_view_flushname" },
+	{ (void *)0x0000000000196b90, "dns_view_flushnode" },
+	{ (void *)0x0000000000196c30, "dns_view_adddelegationonly" },
+	{ (void *)0x0000000000196e30, "dns_view_excludedelegationonly" },
+	{ (void *)0x0000000000197030, "dns_view_isdelegationonly" },
+	{ (void *)0x0000000000197170, "dns_view_setrootdelonly" },
+	{ (void *)0x00000000001971a0, "dns_view_getrootdelonly" },
+	{ (void *)0x00000000001971d0, "dns_view_freezezones" },
+	{ (void *)0x0000000000197230, "dns_view_setadbstats" },
+	{ (void *)0x00000000001972c0, "dns_view_getadbstats" },
+	{ (void *)0x0000000000197340, "dns_view_setresstats" },
+	{ (void *)0x00000000001973d0, "dns_view_getresstats" },
+	{ (void *)0x0000000000197450, "dns_view_setresquerystats" },
+	{ (void *)0x00000000001974e0, "dns_view_getresquerystats" },
+	{ (void *)0x0000000000197560, "dns_view_setlatencystats" },
+	{ (void *)0x00000000001975f0, "dns_view_getlatencystats" },
+	{ (void *)0x0000000000197670, "dns_view_initsecroots" },
+	{ (void *)0x00000000001976d0, "dns_view_getsecroots" },
+	{ (void *)0x0000000000197750, "dns_view_issecuredomain" },
+	{ (void *)0x00000000001977a0, "dns_view_untrust" },
+	{ (void *)0x00000000001978a0, "dns_view_setnewzones" },
+	{ (void *)0x0000000000197a30, "destroy" },
+	{ (void *)0x0000000000198560, "req_shutdown" },
+	{ (void *)0x00000000001986d0, "adb_shutdown" },
+	{ (void *)0x0000000000198840, "resolver_shutdown" },
+	{ (void *)0x00000000001989b0, "view_flushanddetach" },
+	{ (void *)0x0000000000198c70, "dns_view_flushanddetach" },
+	{ (void *)0x0000000000198c80, "dns_view_detach" },
+	{ (void *)0x0000000000198c90, "dns_view_weakdetach" },
+	{ (void *)0x0000000000198e10, "dns_view_searchdlz" },
+	{ (void *)0x00000000001990d0, "get_master_options" },
+	{ (void *)0x0000000000199180, "zone_setrawdata" },
+	{ (void *)0x00000000001991a0, "zone_iattach" },
+	{ (void *)0x0000000000199270, "zone_idetach" },
+	{ (void *)0x0000000000199320, "notify_create" },
+	{ (void *)0x00000000001993f0, "zone_debuglog" },
+	{ (void *)0x0000000000199540, "notify_log" },
+	{ (void *)0x0000000000199650, "zonemgr_cancelio" },
+	{ (void *)0x00000000001999b0, "zone_load_soa_rr" },
+	{ (void *)0x0000000000199c60, "do_one_tuple" },
+	{ (void *)0x0000000000199e40, "same_keynames" },
+	{ (void *)0x0000000000199ec0, "update_soa_serial" },
+	{ (void *)0x0000000000199fd0, "notify_send_queue" },
+	{ (void *)0x000000000019a070, "message_count" },
+	{ (void *)0x000000000019a0f0, "create_query" },
+	{ (void *)0x000000000019a270, "add_opt" },
+	{ (void *)0x000000000019a450, "zonemgr_putio" },
+	{ (void *)0x000000000019a840, "zone_freedbargs" },
+	{ (void *)0x000000000019a900, "clear_addresskeylist" },
+	{ (void *)0x000000000019aa30, "mctxfree" },
+	{ (void *)0x000000000019aa60, "zone_registerinclude" },
+	{ (void *)0x000000000019abc0, "zonemgr_getio" },
+	{ (void *)0x000000000019ae60, "trust_key" },
+	{ (void *)0x000000000019af70, "sendtomaster" },
+	{ (void *)0x000000000019b370, "zonemgr_free" },
+	{ (void *)0x000000000019b460, "logmsg" },
+	{ (void *)0x000000000019b520, "rr_exists" },
+	{ (void *)0x000000000019b690, "clear_keylist" },
+	{ (void *)0x000000000019b7b0, "exit_check.part.0" },
+	{ (void *)0x000000000019b7e0, "inline_secure.part.0" },
+	{ (void *)0x000000000019b800, "inline_raw.part.0" },
+	{ (void *)0x000000000019b820, "zone_detachdb.part.0" },
+	{ (void *)0x000000000019b840, "mctxinit" },
+	{ (void *)0x000000000019b8b0, "dns_zone_getview.part.0" },
+	{ (void *)0x000000000019b8d0, "dns_zone_getjournal.part.0" },
+	{ (void *)0x000000000019b8f0, "dns_zone_rpz_enable_db.part.0" },
+	{ (void *)0x000000000019b910, "dns_zone_getsigvalidityinterval.part.0" },
+	{ (void *)0x000000000019b930, "dns_zone_getkeydirectory.part.0" },
+	{ (void *)0x000000000019b950, "dns_zone_getprivatetype.part.0" },
+	{ (void *)0x000000000019b970, "normalize_key.constprop.0" },
+	{ (void *)0x000000000019bab0, "matchkey" },
+	{ (void *)0x000000000019bb90, "find_zone_keys.constprop.0" },
+	{ (void *)0x000000000019bc70, "set_addrkeylist.constprop.0" },
+	{ (void *)0x000000000019bef0, "zone_send_securedb.isra.0" },
+	{ (void *)0x000000000019bfe0, "zone_send_secureserial.isra.0" },
+	{ (void *)0x000000000019c0b0, "zone_unload" },
+	{ (void *)0x000000000019c1e0, "zone_namerd_tostr" },
+	{ (void *)0x000000000019c440, "set_resigntime" },
+	{ (void *)0x000000000019c660, "delete_nsec" },
+	{ (void *)0x000000000019c7b0, "add_sigs" },
+	{ (void *)0x000000000019cc20, "offline" },
+	{ (void *)0x000000000019cd10, "add_nsec" },
+	{ (void *)0x000000000019d020, "updatesecure" },
+	{ (void *)0x000000000019d140, "fixup_nsec3param" },
+	{ (void *)0x000000000019d6a0, "dns_zone_setclass" },
+	{ (void *)0x000000000019d900, "dns_zone_getclass" },
+	{ (void *)0x000000000019d930, "dns_zone_setnotifytype" },
+	{ (void *)0x000000000019d9f0, "dns_zone_settype" },
+	{ (void *)0x000000000019db90, "dns_zone_getdbtype" },
+	{ (void *)0x000000000019dd80, "dns_zone_setdbtype" },
+	{ (void *)0x000000000019dfd0, "dns_zone_create" },
+	{ (void *)0x000000000019e5f0, "dns_zone_setview" },
+	{ (void *)0x000000000019e880, "dns_zone_getview" },
+	{ (void *)0x000000000019e8a0, "dns_zone_setorigin" },
+	{ (void *)0x000000000019eb90, "dns_zone_setacache" },
+	{ (void *)0x000000000019ed80, "dns_zone_setfile2" },
+	{ (void *)0x000000000019f010, "dns_zone_setfile" },
+	{ (void *)0x000000000019f020, "dns_zone_getfile" },
+	{ (void *)0x000000000019f050, "dns_zone_getmaxttl" },
+	{ (void *)0x000000000019f080, "dns_zone_setmaxttl" },
+	{ (void *)0x000000000019f170, "dns_zone_setjournal" },
+	{ (void *)0x000000000019f2d0, "dns_zone_getjournal" },
+	{ (void *)0x000000000019f2f0, "dns_zone_isdynamic" },
+	{ (void *)0x000000000019f3b0, "dns_zone_rpz_enable" },
+	{ (void *)0x000000000019f550, "dns_zone_get_rpz_num" },
+	{ (void *)0x000000000019f560, "dns_zone_rpz_enable_db" },
+	{ (void *)0x000000000019f590, "dns_zone_asyncload" },
+	{ (void *)0x000000000019f7b0, "dns__zone_loadpending" },
+	{ (void *)0x000000000019f7f0, "dns_zone_setrawdata" },
+	{ (void *)0x000000000019f8c0, "dns_zone_attach" },
+	{ (void *)0x000000000019f940, "dns_zone_iattach" },
+	{ (void *)0x000000000019fa50, "dns_zone_getmctx" },
+	{ (void *)0x000000000019fa80, "dns_zone_getmgr" },
+	{ (void *)0x000000000019fab0, "dns_zone_setflag" },
+	{ (void *)0x000000000019fbb0, "dns_zone_setoption" },
+	{ (void *)0x000000000019fcb0, "dns_zone_setoption2" },
+	{ (void *)0x000000000019fdb0, "dns_zone_getoptions" },
+	{ (void *)0x000000000019fde0, "dns_zone_getoptions2" },
+	{ (void *)0x000000000019fe10, "dns_zone_setkeyopt" },
+	{ (void *)0x000000000019ff10, "dns_zone_getkeyopts" },
+	{ (void *)0x000000000019ff40, "dns_zone_setxfrsource4" },
+	{ (void *)0x00000000001a00a0, "dns_zone_getxfrsource4" },
+	{ (void *)0x00000000001a00d0, "dns_zone_setxfrsource4dscp" },
+	{ (void *)0x00000000001a01a0, "dns_zone_getxfrsource4dscp" },
+	{ (void *)0x00000000001a01d0, "dns_zone_setxfrsource6" },
+	{ (void *)0x00000000001a0330, "dns_zone_getxfrsource6" },
+	{ (void *)0x00000000001a0360, "dns_zone_getxfrsource6dscp" },
+	{ (void *)0x00000000001a0390, "dns_zone_setxfrsource6dscp" },
+	{ (void *)0x00000000001a0460, "dns_zone_setaltxfrsource4" },
+	{ (void *)0x00000000001a05c0, "dns_zone_getaltxfrsource4" },
+	{ (void *)0x00000000001a05f0, "dns_zone_setaltxfrsource4dscp" },
+	{ (void *)0x00000000001a06c0, "dns_zone_getaltxfrsource4dscp" },
+	{ (void *)0x00000000001a06f0, "dns_zone_setaltxfrsource6" },
+	{ (void *)0x00000000001a0850, "dns_zone_getaltxfrsource6" },
+	{ (void *)0x00000000001a0880, "dns_zone_setaltxfrsource6dscp" },
+	{ (void *)0x00000000001a0950, "dns_zone_getaltxfrsource6dscp" },
+	{ (void *)0x00000000001a0980, "dns_zone_setnotifysrc4" },
+	{ (void *)0x00000000001a0ae0, "dns_zone_getnotifysrc4" },
+	{ (void *)0x00000000001a0b10, "dns_zone_setnotifysrc4dscp" },
+	{ (void *)0x00000000001a0be0, "dns_zone_getnotifysrc4dscp" },
+	{ (void *)0x00000000001a0c10, "dns_zone_setnotifysrc6" },
+	{ (void *)0x00000000001a0d70, "dns_zone_getnotifysrc6" },
+	{ (void *)0x00000000001a0da0, "dns_zone_setnotifysrc6dscp" },
+	{ (void *)0x00000000001a0e70, "dns_zone_getnotifysrc6dscp" },
+	{ (void *)0x00000000001a0ea0, "dns_zone_setalsonotifydscpkeys" },
+	{ (void *)0x00000000001a1150, "dns_zone_setalsonotify" },
+	{ (void *)0x00000000001a1160, "dns_zone_setalsonotifywithkeys" },
+	{ (void *)0x00000000001a1170, "dns_zone_setmasterswithkeys" },
+	{ (void *)0x00000000001a1580, "zone_free" },
+	{ (void *)0x00000000001a2010, "dns_zone_idetach" },
+	{ (void *)0x00000000001a21a0, "forward_destroy" },
+	{ (void *)0x00000000001a23b0, "notify_destroy" },
+	{ (void *)0x00000000001a26f0, "notify_send_toaddr" },
+	{ (void *)0x00000000001a3370, "notify_done" },
+	{ (void *)0x00000000001a35b0, "notify_send" },
+	{ (void *)0x00000000001a3b90, "notify_find_address" },
+	{ (void *)0x00000000001a3cf0, "process_adb_event" },
+	{ (void *)0x00000000001a3e60, "dns_zone_detach" },
+	{ (void *)0x00000000001a40b0, "dns_zone_setmasters" },
+	{ (void *)0x00000000001a40c0, "dns_zone_getdb" },
+	{ (void *)0x00000000001a4190, "dns_zone_setdb" },
+	{ (void *)0x00000000001a4290, "dns_zone_unload" },
+	{ (void *)0x00000000001a4370, "dns_zone_setminrefreshtime" },
+	{ (void *)0x00000000001a43d0, "dns_zone_setmaxrefreshtime" },
+	{ (void *)0x00000000001a4430, "dns_zone_setminretrytime" },
+	{ (void *)0x00000000001a4490, "dns_zone_setmaxretrytime" },
+	{ (void *)0x00000000001a44f0, "dns_zone_setnotifyacl" },
+	{ (void *)0x00000000001a4600, "dns_zone_setqueryacl" },
+	{ (void *)0x00000000001a4710, "dns_zone_setqueryonacl" },
+	{ (void *)0x00000000001a4820, "dns_zone_setupdateacl" },
+	{ (void *)0x00000000001a4930, "dns_zone_setforwardacl" },
+	{ (void *)0x00000000001a4a40, "dns_zone_setxfracl" },
+	{ (void *)0x00000000001a4b50, "dns_zone_getnotifyacl" },
+	{ (void *)0x00000000001a4b80, "dns_zone_getqueryacl" },
+	{ (void *)0x00000000001a4bb0, "dns_zone_getqueryonacl" },
+	{ (void *)0x00000000001a4be0, "dns_zone_getupdateacl" },
+	{ (void *)0x00000000001a4c10, "dns_zone_getforwardacl" },
+	{ (void *)0x00000000001a4c40, "dns_zone_getxfracl" },
+	{ (void *)0x00000000001a4c70, "dns_zone_clearupdateacl" },
+	{ (void *)0x00000000001a4d60, "dns_zone_clearforwardacl" },
+	{ (void *)0x00000000001a4e50, "dns_zone_clearnotifyacl" },
+	{ (void *)0x00000000001a4f40, "dns_zone_clearqueryacl" },
+	{ (void *)0x00000000001a5030, "dns_zone_clearqueryonacl" },
+	{ (void *)0x00000000001a5120, "dns_zone_clearxfracl" },
+	{ (void *)0x00000000001a5210, "dns_zone_getupdatedisabled" },
+	{ (void *)0x00000000001a5240, "dns_zone_setupdatedisabled" },
+	{ (void *)0x00000000001a5270, "dns_zone_getzeronosoattl" },
+	{ (void *)0x00000000001a52a0, "dns_zone_setzeronosoattl" },
+	{ (void *)0x00000000001a52d0, "dns_zone_setchecknames" },
+	{ (void *)0x00000000001a5300, "dns_zone_getchecknames" },
+	{ (void *)0x00000000001a5330, "dns_zone_setjournalsize" },
+	{ (void *)0x00000000001a5360, "dns_zone_getjournalsize" },
+	{ (void *)0x00000000001a5390, "dns_zone_name" },
+	{ (void *)0x00000000001a53f0, "dns_zone_logc" },
+	{ (void *)0x00000000001a5530, "dns_zone_log" },
+	{ (void *)0x00000000001a5680, "zmgr_start_xfrin_ifquota" },
+	{ (void *)0x00000000001a5c50, "zmgr_resume_xfrs" },
+	{ (void *)0x00000000001a5ce0, "zone_count_ns_rr" },
+	{ (void *)0x00000000001a6110, "zone_get_from_db" },
+	{ (void *)0x00000000001a6320, "dns_zone_getserial2" },
+	{ (void *)0x00000000001a64f0, "dns_zone_getserial" },
+	{ (void *)0x00000000001a6510, "maybe_send_secure" },
+	{ (void *)0x00000000001a65e0, "get_raw_serial" },
+	{ (void *)0x00000000001a66b0, "dumptostream" },
+	{ (void *)0x00000000001a6890, "dns_zone_dumptostream3" },
+	{ (void *)0x00000000001a68a0, "dns_zone_dumptostream2" },
+	{ (void *)0x00000000001a68c0, "dns_zone_dumptostream" },
+	{ (void *)0x00000000001a68e0, "dns_zone_fulldumptostream" },
+	{ (void *)0x00000000001a6900, "update_log_cb" },
+	{ (void *)0x00000000001a6920, "zone_journal" },
+	{ (void *)0x00000000001a6a60, "zone_settimer" },
+	{ (void *)0x00000000001a7160, "cancel_refresh" },
+	{ (void *)0x00000000001a7260, "queue_soa_query" },
+	{ (void *)0x00000000001a7370, "zone_signwithkey" },
+	{ (void *)0x00000000001a7660, "dns_zone_maintenance" },
+	{ (void *)0x00000000001a77b0, "dns_zone_notify" },
+	{ (void *)0x00000000001a78e0, "zone_needdump" },
+	{ (void *)0x00000000001a7af0, "dns_zone_markdirty" },
+	{ (void *)0x00000000001a7e00, "zone_dump" },
+	{ (void *)0x00000000001a83e0, "dns_zone_flush" },
+	{ (void *)0x00000000001a8590, "dns_zone_dump" },
+	{ (void *)0x00000000001a86f0, "receive_secure_serial" },
+	{ (void *)0x00000000001a99d0, "zone_xfrdone.part.0" },
+	{ (void *)0x00000000001aa8f0, "zone_xfrdone" },
+	{ (void *)0x00000000001aa960, "soa_query" },
+	{ (void *)0x00000000001ab570, "ns_query" },
+	{ (void *)0x00000000001ac1a0, "check_nsec3param" },
+	{ (void *)0x00000000001ac540, "set_refreshkeytimer" },
+	{ (void *)0x00000000001ac6e0, "minimal_update" },
+	{ (void *)0x00000000001ac9f0, "sync_keyzone" },
+	{ (void *)0x00000000001ad740, "dns_zone_synckeyzone" },
+	{ (void *)0x00000000001ad850, "zone_replacedb" },
+	{ (void *)0x00000000001adf80, "zone_addnsec3chain" },
+	{ (void *)0x00000000001ae570, "resume_addnsec3chain" },
+	{ (void *)0x00000000001ae8b0, "zone_saveunique" },
+	{ (void *)0x00000000001ae980, "zone_postload" },
+	{ (void *)0x00000000001b1c50, "zone_loaddone" },
+	{ (void *)0x00000000001b2120, "zone_gotreadhandle" },
+	{ (void *)0x00000000001b2270, "zone_load" },
+	{ (void *)0x00000000001b2fb0, "dns_zone_load" },
+	{ (void *)0x00000000001b2fc0, "dns_zone_loadnew" },
+	{ (void *)0x00000000001b2fd0, "zone_asyncload" },
+	{ (void *)0x00000000001b3140, "dns_zone_loadandthaw" },
+	{ (void *)0x00000000001b31b0, "receive_secure_db" },
+	{ (void *)0x00000000001b4890, "zone_expire" },
+	{ (void *)0x00000000001b4920, "dns_zone_expire" },
+	{ (void *)0x00000000001b4a00, "dns_zone_refresh.part.0" },
+	{ (void *)0x00000000001b4c00, "dns_zone_refresh" },
+	{ (void *)0x00000000001b4c40, "dump_done" },
+	{ (void *)0x00000000001b4f90, "zone_gotwritehandle" },
+	{ (void *)0x00000000001b52a0, "forward_callback" },
+	{ (void *)0x00000000001b55b0, "zone_notify" },
+	{ (void *)0x00000000001b6180, "zone_refreshkeys" },
+	{ (void *)0x00000000001b6b20, "keyfetch_done" },
+	{ (void *)0x00000000001b87c0, "set_key_expiry_warning" },
+	{ (void *)0x00000000001b8900, "del_sigs" },
+	{ (void *)0x00000000001b9140, "update_sigs" },
+	{ (void *)0x00000000001b9450, "keydone" },
+	{ (void *)0x00000000001b9a20, "setnsec3param" },
+	{ (void *)0x00000000001ba100, "zone_sign" },
+	{ (void *)0x00000000001bc720, "zone_resigninc" },
+	{ (void *)0x00000000001bcee0, "zone_nsec3chain" },
+	{ (void *)0x00000000001bfe70, "zone_rekey" },
+	{ (void *)0x00000000001c1910, "zone_timer" },
+	{ (void *)0x00000000001c2010, "dns_zone_setmaxxfrin" },
+	{ (void *)0x00000000001c2040, "dns_zone_getmaxxfrin" },
+	{ (void *)0x00000000001c2070, "dns_zone_setmaxxfrout" },
+	{ (void *)0x00000000001c20a0, "dns_zone_getmaxxfrout" },
+	{ (void *)0x00000000001c20d0, "dns_zone_gettype" },
+	{ (void *)0x00000000001c2100, "dns_zone_getorigin" },
+	{ (void *)0x00000000001c2130, "dns_zone_settask" },
+	{ (void *)0x00000000001c22c0, "dns_zone_gettask" },
+	{ (void *)0x00000000001c2300, "dns_zone_setidlein" },
+	{ (void *)0x00000000001c2340, "dns_zone_getidlein" },
+	{ (void *)0x00000000001c2370, "dns_zone_setidleout" },
+	{ (void *)0x00000000001c23a0, "dns_zone_getidleout" },
+	{ (void *)0x00000000001c23d0, "dns_zone_replacedb" },
+	{ (void *)0x00000000001c2680, "dns_zone_getssutable" },
+	{ (void *)0x00000000001c27b0, "dns_zone_setssutable" },
+	{ (void *)0x00000000001c28b0, "dns_zone_setsigvalidityinterval" },
+	{ (void *)0x00000000001c28e0, "dns_zone_getsigvalidityinterval" },
+	{ (void *)0x00000000001c2900, "dns_zone_setsigresigninginterval" },
+	{ (void *)0x00000000001c2a40, "dns_zone_getsigresigninginterval" },
+	{ (void *)0x00000000001c2a70, "dns_zone_forwardupdate" },
+	{ (void *)0x00000000001c2bf0, "dns_zone_next" },
+	{ (void *)0x00000000001c2c60, "dns_zone_first" },
+	{ (void *)0x00000000001c2cd0, "dns_zonemgr_create" },
+	{ (void *)0x00000000001c2ff0, "dns_zonemgr_createzone" },
+	{ (void *)0x00000000001c30e0, "dns_zonemgr_managezone" },
+	{ (void *)0x00000000001c3430, "dns_zonemgr_releasezone" },
+	{ (void *)0x00000000001c3760, "zone_shutdown" },
+	{ (void *)0x00000000001c3f70, "dns_zonemgr_attach" },
+	{ (void *)0x00000000001c4080, "dns_zonemgr_detach" },
+	{ (void *)0x00000000001c41b0, "dns_zonemgr_forcemaint" },
+	{ (void *)0x00000000001c42f0, "dns_zonemgr_resumexfrs" },
+	{ (void *)0x00000000001c43a0, "dns_zonemgr_shutdown" },
+	{ (void *)0x00000000001c45a0, "dns_zonemgr_setsize" },
+	{ (void *)0x00000000001c4750, "dns_zonemgr_settransfersin" },
+	{ (void *)0x00000000001c4780, "dns_zonemgr_getttransfersin" },
+	{ (void *)0x00000000001c47b0, "dns_zonemgr_settransfersperns" },
+	{ (void *)0x00000000001c47e0, "dns_zonemgr_getttransfersperns" },
+	{ (void *)0x00000000001c4810, "dns_zonemgr_setiolimit" },
+	{ (void *)0x00000000001c4870, "dns_zonemgr_getiolimit" },
+	{ (void *)0x00000000001c48a0, "dns_zonemgr_setserialqueryrate" },
+	{ (void *)0x00000000001c49c0, "dns_zonemgr_getserialqueryrate" },
+	{ (void *)0x00000000001c49f0, "dns_zonemgr_sethugepages" },
+	{ (void *)0x00000000001c4a20, "dns_zonemgr_unreachable" },
+	{ (void *)0x00000000001c4b90, "got_transfer_quota" },
+	{ (void *)0x00000000001c5440, "refresh_callback" },
+	{ (void *)0x00000000001c6520, "dns_zonemgr_unreachabledel" },
+	{ (void *)0x00000000001c66d0, "dns_zone_notifyreceive" },
+	{ (void *)0x00000000001c7240, "dns_zonemgr_unreachableadd" },
+	{ (void *)0x00000000001c7690, "stub_callback" },
+	{ (void *)0x00000000001c85a0, "dns_zone_forcereload" },
+	{ (void *)0x00000000001c86d0, "dns_zone_isforced" },
+	{ (void *)0x00000000001c8710, "dns_zone_setstatistics" },
+	{ (void *)0x00000000001c8720, "dns_zone_getstatscounters" },
+	{ (void *)0x00000000001c8730, "dns_zone_setstats" },
+	{ (void *)0x00000000001c8850, "dns_zone_setrequeststats" },
+	{ (void *)0x00000000001c8980, "dns_zone_setrcvquerystats" },
+	{ (void *)0x00000000001c8a90, "dns_zone_getrequeststats" },
+	{ (void *)0x00000000001c8ab0, "dns_zone_getrcvquerystats" },
+	{ (void *)0x00000000001c8ad0, "dns_zone_dialup" },
+	{ (void *)0x00000000001c8bb0, "dns_zone_setdialup" },
+	{ (void *)0x00000000001c8d30, "dns_zone_setkeydirectory" },
+	{ (void *)0x00000000001c8e90, "dns_zone_getkeydirectory" },
+	{ (void *)0x00000000001c8eb0, "dns_zonemgr_getcount" },
+	{ (void *)0x00000000001c90a0, "dns_zone_checknames" },
+	{ (void *)0x00000000001c9340, "dns_zone_setcheckmx" },
+	{ (void *)0x00000000001c9370, "dns_zone_setchecksrv" },
+	{ (void *)0x00000000001c93a0, "dns_zone_setcheckns" },
+	{ (void *)0x00000000001c93d0, "dns_zone_setisself" },
+	{ (void *)0x00000000001c94c0, "dns_zone_setnotifydelay" },
+	{ (void *)0x00000000001c9580, "dns_zone_getnotifydelay" },
+	{ (void *)0x00000000001c95b0, "dns_zone_signwithkey" },
+	{ (void *)0x00000000001c96d0, "dns_zone_addnsec3chain" },
+	{ (void *)0x00000000001c9880, "dns_zone_setnodes" },
+	{ (void *)0x00000000001c98c0, "dns_zone_setsignatures" },
+	{ (void *)0x00000000001c9910, "dns_zone_setprivatetype" },
+	{ (void *)0x00000000001c9940, "dns_zone_getprivatetype" },
+	{ (void *)0x00000000001c9960, "dns_zone_rekey" },
+	{ (void *)0x00000000001c9a80, "dns_zone_nscheck" },
+	{ (void *)0x00000000001c9b40, "dns_zone_setadded" },
+	{ (void *)0x00000000001c9c00, "dns_zone_getadded" },
+	{ (void *)0x00000000001c9c30, "dns_zone_dlzpostload" },
+	{ (void *)0x00000000001c9f60, "dns_zone_setrefreshkeyinterval" },
+	{ (void *)0x00000000001c9fb0, "dns_zone_setrequestixfr" },
+	{ (void *)0x00000000001c9fe0, "dns_zone_getrequestixfr" },
+	{ (void *)0x00000000001ca010, "dns_zone_setserialupdatemethod" },
+	{ (void *)0x00000000001ca040, "dns_zone_getserialupdatemethod" },
+	{ (void *)0x00000000001ca070, "dns_zone_link" },
+	{ (void *)0x00000000001ca530, "dns_zone_getraw" },
+	{ (void *)0x00000000001ca630, "dns_zone_keydone" },
+	{ (void *)0x00000000001ca8b0, "dns_zone_setnsec3param" },
+	{ (void *)0x00000000001cabc0, "dns_zone_getloadtime" },
+	{ (void *)0x00000000001cacc0, "dns_zone_getexpiretime" },
+	{ (void *)0x00000000001cadc0, "dns_zone_getrefreshtime" },
+	{ (void *)0x00000000001caec0, "dns_zone_getrefreshkeytime" },
+	{ (void *)0x00000000001cafc0, "dns_zone_getincludes" },
+	{ (void *)0x00000000001cb1c0, "dns_zone_setstatlevel" },
+	{ (void *)0x00000000001cb1f0, "dns_zone_getstatlevel" },
+	{ (void *)0x00000000001cb220, "dns_zonekey_iszonekey" },
+	{ (void *)0x00000000001cb2a0, "auto_detach" },
+	{ (void *)0x00000000001cb2c0, "flush" },
+	{ (void *)0x00000000001cb2d0, "load" },
+	{ (void *)0x00000000001cb300, "asyncload" },
+	{ (void *)0x00000000001cb3d0, "loadnew" },
+	{ (void *)0x00000000001cb400, "freezezones" },
+	{ (void *)0x00000000001cb700, "dns_zt_create" },
+	{ (void *)0x00000000001cb860, "dns_zt_mount" },
+	{ (void *)0x00000000001cb960, "dns_zt_unmount" },
+	{ (void *)0x00000000001cba30, "dns_zt_find" },
+	{ (void *)0x00000000001cbb40, "dns_zt_attach" },
+	{ (void *)0x00000000001cbc70, "dns_zt_apply2" },
+	{ (void *)0x00000000001cbdd0, "dns_zt_asyncload" },
+	{ (void *)0x00000000001cbf30, "dns_zt_freezezones" },
+	{ (void *)0x00000000001cc010, "dns_zt_apply" },
+	{ (void *)0x00000000001cc020, "zt_destroy" },
+	{ (void *)0x00000000001cc090, "zt_flushanddetach" },
+	{ (void *)0x00000000001cc1c0, "dns_zt_flushanddetach" },
+	{ (void *)0x00000000001cc1d0, "dns_zt_detach" },
+	{ (void *)0x00000000001cc1e0, "doneloading" },
+	{ (void *)0x00000000001cc390, "dns_zt_load" },
+	{ (void *)0x00000000001cc460, "dns_zt_loadnew" },
+	{ (void *)0x00000000001cc530, "comparekeys" },
+	{ (void *)0x00000000001cc610, "buildfilename" },
+	{ (void *)0x00000000001cc780, "get_key_struct" },
+	{ (void *)0x00000000001cc990, "addsuffix" },
+	{ (void *)0x00000000001ccad0, "dst_algorithm_supported.part.0" },
+	{ (void *)0x00000000001ccaf0, "algorithm_status" },
+	{ (void *)0x00000000001ccb80, "dst_lib_destroy" },
+	{ (void *)0x00000000001ccc20, "dst_lib_init2" },
+	{ (void *)0x00000000001ccd60, "dst_lib_init" },
+	{ (void *)0x00000000001ccd70, "dst_algorithm_supported" },
+	{ (void *)0x00000000001ccda0, "dst_ds_digest_supported" },
+	{ (void *)0x00000000001ccdc0, "dst_context_create4" },
+	{ (void *)0x00000000001ccf80, "dst_context_create" },
+	{ (void *)0x00000000001ccfa0, "dst_context_create2" },
+	{ (void *)0x00000000001ccfb0, "dst_context_create3" },
+	{ (void *)0x00000000001ccfc0, "dst_context_destroy" },
+	{ (void *)0x00000000001cd070, "dst_context_adddata" },
+	{ (void *)0x00000000001cd100, "dst_context_sign" },
+	{ (void *)0x00000000001cd1d0, "dst_context_verify" },
+	{ (void *)0x00000000001cd280, "dst_context_verify2" },
+	{ (void *)0x00000000001cd370, "dst_key_setexternal" },
+	{ (void *)0x00000000001cd380, "dst_key_isexternal" },
+	{ (void *)0x00000000001cd390, "dst_key_todns" },
+	{ (void *)0x00000000001cd4d0, "computeid" },
+	{ (void *)0x00000000001cd550, "pub_compare" },
+	{ (void *)0x00000000001cd6e0, "dst_key_tobuffer" },
+	{ (void *)0x00000000001cd7a0, "dst_key_getgssctx" },
+	{ (void *)0x00000000001cd7d0, "dst_key_fromgssapi" },
+	{ (void *)0x00000000001cd8c0, "dst_key_getnum" },
+	{ (void *)0x00000000001cd950, "dst_key_setnum" },
+	{ (void *)0x00000000001cd9c0, "dst_key_unsetnum" },
+	{ (void *)0x00000000001cda20, "dst_key_gettime" },
+	{ (void *)0x00000000001cdab0, "printtime" },
+	{ (void *)0x00000000001cdba0, "dst_key_settime" },
+	{ (void *)0x00000000001cdc00, "dst_key_unsettime" },
+	{ (void *)0x00000000001cdc60, "dst_key_getprivateformat" },
+	{ (void *)0x00000000001cdce0, "dst_key_setprivateformat" },
+	{ (void *)0x00000000001cdd20, "dst_key_compare" },
+	{ (void *)0x00000000001cdd40, "dst_key_pubcompare" },
+	{ (void *)0x00000000001cdd50, "dst_key_paramcompare" },
+	{ (void *)0x00000000001cde00, "dst_key_attach" },
+	{ (void *)0x00000000001cdeb0, "dst_key_free" },
+	{ (void *)0x00000000001ce0b0, "dst_key_buildinternal" },
+	{ (void *)0x00000000001ce240, "dst_key_fromlabel" },
+	{ (void *)0x00000000001ce420, "dst_key_generate2" },
+	{ (void *)0x00000000001ce5e0, "dst_key_generate" },
+	{ (void *)0x00000000001ce600, "frombuffer.constprop.0" },
+	{ (void *)0x00000000001ce790, "dst_key_frombuffer" },
+	{ (void *)0x00000000001ce820, "dst_key_fromdns" },
+	{ (void *)0x00000000001ce960, "dst_key_isprivate" },
+	{ (void *)0x00000000001ce9c0, "dst_key_computesecret" },
+	{ (void *)0x00000000001ceb20, "dst_key_privatefrombuffer" },
+	{ (void *)0x00000000001cec60, "dst_key_buildfilename" },
+	{ (void *)0x00000000001cece0, "write_public_key" },
+	{ (void *)0x00000000001cf180, "dst_key_tofile" },
+	{ (void *)0x00000000001cf2a0, "dst_key_sigsize" },
+	{ (void *)0x00000000001cf410, "dst_key_secretsize" },
+	{ (void *)0x00000000001cf4a0, "dst_key_setflags" },
+	{ (void *)0x00000000001cf4d0, "dst_key_format" },
+	{ (void *)0x00000000001cf560, "dst_key_dump" },
+	{ (void *)0x00000000001cf600, "dst_key_restore" },
+	{ (void *)0x00000000001cf730, "dst_key_inactive" },
+	{ (void *)0x00000000001cf760, "dst_key_setinactive" },
+	{ (void *)0x00000000001cf790, "dst_key_read_public" },
+	{ (void *)0x00000000001cfb10, "dst_key_fromnamedfile" },
+	{ (void *)0x00000000001d0050, "dst_key_fromfile" },
+	{ (void *)0x00000000001d0250, "dst__entropy_getdata" },
+	{ (void *)0x00000000001d02a0, "dst__entropy_status" },
+	{ (void *)0x00000000001d02b0, "dst_key_tkeytoken" },
+	{ (void *)0x00000000001d02e0, "initialize_action" },
+	{ (void *)0x00000000001d0330, "dst_result_totext" },
+	{ (void *)0x00000000001d0380, "dst_result_register" },
+	{ (void *)0x00000000001d03d0, "dst_gssapi_acquirecred" },
+	{ (void *)0x00000000001d0400, "dst_gssapi_identitymatchesrealmkrb5" },
+	{ (void *)0x00000000001d0410, "dst_gssapi_identitymatchesrealmms" },
+	{ (void *)0x00000000001d0420, "dst_gssapi_releasecred" },
+	{ (void *)0x00000000001d0430, "dst_gssapi_initctx" },
+	{ (void *)0x00000000001d0440, "dst_gssapi_acceptctx" },
+	{ (void *)0x00000000001d0450, "dst_gssapi_deletectx" },
+	{ (void *)0x00000000001d0460, "gss_error_tostring" },
+	{ (void *)0x00000000001d0490, "gss_log" },
+	{ (void *)0x00000000001d0540, "hmacmd5_isprivate" },
+	{ (void *)0x00000000001d0550, "hmacmd5_tofile" },
+	{ (void *)0x00000000001d05e0, "hmacsha1_tofile" },
+	{ (void *)0x00000000001d0670, "hmacsha224_tofile" },
+	{ (void *)0x00000000001d0700, "hmacsha256_tofile" },
+	{ (void *)0x00000000001d0790, "hmacsha384_tofile" },
+	{ (void *)0x00000000001d0820, "hmacsha512_tofile" },
+	{ (void *)0x00000000001d08b0, "hmacmd5_fromdns" },
+	{ (void *)0x00000000001d0970, "hmacmd5_destroy" },
+	{ (void *)0x00000000001d09b0, "hmacsha1_destroy" },
+	{ (void *)0x00000000001d09f0, "hmacsha224_destroy" },
+	{ (void *)0x00000000001d0a30, "hmacsha256_destroy" },
+	{ (void *)0x00000000001d0a70, "hmacsha384_destroy" },
+	{ (void *)0x00000000001d0ad0, "hmacsha512_destroy" },
+	{ (void *)0x00000000001d0b30, "hmacmd5_generate" },
+	{ (void *)0x00000000001d0bd0, "hmacmd5_compare" },
+	{ (void *)0x00000000001d0c20, "hmacsha384_compare" },
+	{ (void *)0x00000000001d0c70, "hmacmd5_verify" },
+	{ (void *)0x00000000001d0cb0, "hmacmd5_sign" },
+	{ (void *)0x00000000001d0cf0, "hmacmd5_adddata" },
+	{ (void *)0x00000000001d0d10, "hmacmd5_destroyctx" },
+	{ (void *)0x00000000001d0d60, "hmacmd5_createctx" },
+	{ (void *)0x00000000001d0db0, "hmacsha1_fromdns" },
+	{ (void *)0x00000000001d0e70, "hmacsha1_generate" },
+	{ (void *)0x00000000001d0f10, "hmacsha1_verify" },
+	{ (void *)0x00000000001d0f60, "hmacsha1_sign" },
+	{ (void *)0x00000000001d0fa0, "hmacsha1_adddata" },
+	{ (void *)0x00000000001d0fc0, "hmacsha1_destroyctx" },
+	{ (void *)0x00000000001d1010, "hmacsha1_createctx" },
+	{ (void *)0x00000000001d1060, "hmacsha224_fromdns" },
+	{ (void *)0x00000000001d1120, "hmacsha224_generate" },
+	{ (void *)0x00000000001d11c0, "hmacsha224_verify" },
+	{ (void *)0x00000000001d1210, "hmacsha224_sign" },
+	{ (void *)0x00000000001d1250, "hmacsha224_adddata" },
+	{ (void *)0x00000000001d1270, "hmacsha224_destroyctx" },
+	{ (void *)0x00000000001d12c0, "hmacsha224_createctx" },
+	{ (void *)0x00000000001d1310, "hmacsha256_fromdns" },
+	{ (void *)0x00000000001d13d0, "hmacsha256_generate" },
+	{ (void *)0x00000000001d1470, "hmacsha256_verify" },
+	{ (void *)0x00000000001d14c0, "hmacsha256_sign" },
+	{ (void *)0x00000000001d1500, "hmacsha256_adddata" },
+	{ (void *)0x00000000001d1520, "hmacsha256_destroyctx" },
+	{ (void *)0x00000000001d1570, "hmacsha256_createctx" },
+	{ (void *)0x00000000001d15c0, "hmacsha384_fromdns" },
+	{ (void *)0x00000000001d16a0, "hmacsha384_generate" },
+	{ (void *)0x00000000001d1730, "hmacsha384_verify" },
+	{ (void *)0x00000000001d1780, "hmacsha384_sign" },
+	{ (void *)0x00000000001d17c0, "hmacsha384_adddata" },
+	{ (void *)0x00000000001d17e0, "hmacsha384_destroyctx" },
+	{ (void *)0x00000000001d1830, "hmacsha384_createctx" },
+	{ (void *)0x00000000001d1880, "hmacsha512_fromdns" },
+	{ (void *)0x00000000001d1960, "hmacsha512_generate" },
+	{ (void *)0x00000000001d19f0, "hmacsha512_verify" },
+	{ (void *)0x00000000001d1a40, "hmacsha512_sign" },
+	{ (void *)0x00000000001d1a80, "hmacsha512_adddata" },
+	{ (void *)0x00000000001d1aa0, "hmacsha512_destroyctx" },
+	{ (void *)0x00000000001d1af0, "hmacsha512_createctx" },
+	{ (void *)0x00000000001d1b40, "hmacmd5_todns" },
+	{ (void *)0x00000000001d1ba0, "hmacsha1_todns" },
+	{ (void *)0x00000000001d1c00, "hmacsha224_todns" },
+	{ (void *)0x00000000001d1c60, "hmacsha256_todns" },
+	{ (void *)0x00000000001d1cc0, "hmacsha384_todns" },
+	{ (void *)0x00000000001d1d20, "hmacsha512_todns" },
+	{ (void *)0x00000000001d1d80, "hmacsha384_isprivate" },
+	{ (void *)0x00000000001d1d90, "hmacmd5_parse" },
+	{ (void *)0x00000000001d1ed0, "hmacsha512_isprivate" },
+	{ (void *)0x00000000001d1ee0, "hmacsha1_isprivate" },
+	{ (void *)0x00000000001d1ef0, "hmacsha224_isprivate" },
+	{ (void *)0x00000000001d1f00, "hmacsha256_isprivate" },
+	{ (void *)0x00000000001d1f10, "hmacsha384_parse" },
+	{ (void *)0x00000000001d2050, "hmacsha1_parse" },
+	{ (void *)0x00000000001d2190, "hmacsha256_parse" },
+	{ (void *)0x00000000001d22d0, "hmacsha224_parse" },
+	{ (void *)0x00000000001d2410, "hmacsha512_parse" },
+	{ (void *)0x00000000001d2550, "hmacsha512_compare" },
+	{ (void *)0x00000000001d25a0, "hmacsha256_compare" },
+	{ (void *)0x00000000001d25f0, "hmacsha1_compare" },
+	{ (void *)0x00000000001d2640, "hmacsha224_compare" },
+	{ (void *)0x00000000001d2690, "dst__hmacmd5_init" },
+	{ (void *)0x00000000001d26d0, "dst__hmacsha1_init" },
+	{ (void *)0x00000000001d2710, "dst__hmacsha224_init" },
+	{ (void *)0x00000000001d2750, "dst__hmacsha256_init" },
+	{ (void *)0x00000000001d2790, "dst__hmacsha384_init" },
+	{ (void *)0x00000000001d27d0, "dst__hmacsha512_init" },
+	{ (void *)0x00000000001d2810, "dst_region_computeid" },
+	{ (void *)0x00000000001d28f0, "dst_region_computerid" },
+	{ (void *)0x00000000001d29d0, "dst_key_name" },
+	{ (void *)0x00000000001d2a00, "dst_key_size" },
+	{ (void *)0x00000000001d2a30, "dst_key_proto" },
+	{ (void *)0x00000000001d2a60, "dst_key_alg" },
+	{ (void *)0x00000000001d2a90, "dst_key_flags" },
+	{ (void *)0x00000000001d2ac0, "dst_key_id" },
+	{ (void *)0x00000000001d2af0, "dst_key_rid" },
+	{ (void *)0x00000000001d2b20, "dst_key_class" },
+	{ (void *)0x00000000001d2b50, "dst_key_iszonekey" },
+	{ (void *)0x00000000001d2bc0, "dst_key_isnullkey" },
+	{ (void *)0x00000000001d2c30, "dst_key_setbits" },
+	{ (void *)0x00000000001d2ce0, "dst_key_getbits" },
+	{ (void *)0x00000000001d2d10, "dst_key_setttl" },
+	{ (void *)0x00000000001d2d40, "dst_key_getttl" },
+	{ (void *)0x00000000001d2d70, "deleterdataset" },
+	{ (void *)0x00000000001d2d80, "createiterator" },
+	{ (void *)0x00000000001d2d90, "rdataset_first" },
+	{ (void *)0x00000000001d2dd0, "rdataset_next" },
+	{ (void *)0x00000000001d2e00, "rdataset_count" },
+	{ (void *)0x00000000001d2e20, "rdataset_settrust" },
+	{ (void *)0x00000000001d2e30, "dns_ecdb_create" },
+	{ (void *)0x00000000001d3050, "attachnode" },
+	{ (void *)0x00000000001d31b0, "rdataset_clone" },
+	{ (void *)0x00000000001d3230, "allrdatasets" },
+	{ (void *)0x00000000001d3320, "attach" },
+	{ (void *)0x00000000001d3400, "bind_rdataset" },
+	{ (void *)0x00000000001d3500, "addrdataset" },
+	{ (void *)0x00000000001d3700, "rdataset_current" },
+	{ (void *)0x00000000001d3780, "rdataset_disassociate" },
+	{ (void *)0x00000000001d37b0, "rdatasetiter_destroy" },
+	{ (void *)0x00000000001d3850, "destroy_ecdb" },
+	{ (void *)0x00000000001d3900, "detachnode" },
+	{ (void *)0x00000000001d3dd0, "detach" },
+	{ (void *)0x00000000001d3f00, "findnode" },
+	{ (void *)0x00000000001d41a0, "rdatasetiter_next" },
+	{ (void *)0x00000000001d41e0, "rdatasetiter_first" },
+	{ (void *)0x00000000001d4230, "findzonecut" },
+	{ (void *)0x00000000001d4260, "find" },
+	{ (void *)0x00000000001d4290, "rdatasetiter_current" },
+	{ (void *)0x00000000001d42d0, "dns_ecdb_register" },
+	{ (void *)0x00000000001d4340, "dns_ecdb_unregister" },
+	{ (void *)0x00000000001d4370, "isclog_warn_callback" },
+	{ (void *)0x00000000001d4420, "isclog_error_callback" },
+	{ (void *)0x00000000001d44d0, "stdio_error_warn_callback" },
+	{ (void *)0x00000000001d4580, "dns_rdatacallbacks_initcommon.part.0" },
+	{ (void *)0x00000000001d45a0, "dns_rdatacallbacks_init" },
+	{ (void *)0x00000000001d4600, "dns_rdatacallbacks_init_stdio" },
+	{ (void *)0x00000000001d4650, "dns_ds_buildrdata" },
+	{ (void *)0x00000000001d4a00, "dns_keydata_todnskey" },
+	{ (void *)0x00000000001d4ac0, "dns_keydata_fromdnskey" },
+	{ (void *)0x00000000001d4b90, "req_log" },
+	{ (void *)0x00000000001d4c40, "requestmgr_attach" },
+	{ (void *)0x00000000001d4ce0, "send_shutdown_events" },
+	{ (void *)0x00000000001d4e30, "send_if_done" },
+	{ (void *)0x00000000001d4ed0, "mgr_destroy" },
+	{ (void *)0x00000000001d5020, "req_cancel" },
+	{ (void *)0x00000000001d5130, "do_cancel" },
+	{ (void *)0x00000000001d5210, "req_senddone" },
+	{ (void *)0x00000000001d5390, "req_response" },
+	{ (void *)0x00000000001d5530, "isblackholed" },
+	{ (void *)0x00000000001d55d0, "create_tcp_dispatch" },
+	{ (void *)0x00000000001d5770, "find_udp_dispatch" },
+	{ (void *)0x00000000001d5840, "set_timer" },
+	{ (void *)0x00000000001d58d0, "req_render" },
+	{ (void *)0x00000000001d5b50, "req_getsocket" },
+	{ (void *)0x00000000001d5ba0, "req_send.part.0" },
+	{ (void *)0x00000000001d5bc0, "new_request.constprop.0" },
+	{ (void *)0x00000000001d5cd0, "req_destroy" },
+	{ (void *)0x00000000001d5f50, "req_connected" },
+	{ (void *)0x00000000001d61c0, "req_timeout" },
+	{ (void *)0x00000000001d63f0, "dns_requestmgr_create" },
+	{ (void *)0x00000000001d6780, "dns_requestmgr_whenshutdown" },
+	{ (void *)0x00000000001d6900, "dns_requestmgr_attach" },
+	{ (void *)0x00000000001d6a10, "dns_requestmgr_detach" },
+	{ (void *)0x00000000001d6ba0, "dns_request_createraw4" },
+	{ (void *)0x00000000001d7610, "dns_request_createraw" },
+	{ (void *)0x00000000001d7640, "dns_request_createraw2" },
+	{ (void *)0x00000000001d7690, "dns_request_createraw3" },
+	{ (void *)0x00000000001d76d0, "dns_request_createvia4" },
+	{ (void *)0x00000000001d8150, "dns_request_create" },
+	{ (void *)0x00000000001d8190, "dns_request_createvia" },
+	{ (void *)0x00000000001d81d0, "dns_request_createvia2" },
+	{ (void *)0x00000000001d8220, "dns_request_createvia3" },
+	{ (void *)0x00000000001d8260, "dns_request_cancel" },
+	{ (void *)0x00000000001d83a0, "dns_requestmgr_shutdown" },
+	{ (void *)0x00000000001d84c0, "dns_request_getresponse" },
+	{ (void *)0x00000000001d8590, "dns_request_usedtcp" },
+	{ (void *)0x00000000001d85d0, "dns_request_destroy" },
+	{ (void *)0x00000000001d8930, "xfrin_logv" },
+	{ (void *)0x00000000001d89c0, "ixfr_apply" },
+	{ (void *)0x00000000001d8a80, "ixfr_putdata" },
+	{ (void *)0x00000000001d8b30, "render" },
+	{ (void *)0x00000000001d8c00, "ixfr_commit" },
+	{ (void *)0x00000000001d8c70, "xfrin_log1.constprop.0" },
+	{ (void *)0x00000000001d8d30, "xfrin_cancelio" },
+	{ (void *)0x00000000001d8d90, "xfrin_log" },
+	{ (void *)0x00000000001d8ed0, "maybe_free" },
+	{ (void *)0x00000000001d9160, "xfrin_fail" },
+	{ (void *)0x00000000001d9200, "xfrin_timeout" },
+	{ (void *)0x00000000001d9260, "xfrin_start" },
+	{ (void *)0x00000000001d9330, "xfrin_send_done" },
+	{ (void *)0x00000000001d9420, "xfrin_send_request" },
+	{ (void *)0x00000000001d9ab0, "xfrin_connect_done" },
+	{ (void *)0x00000000001d9ca0, "xfrin_recv_done" },
+	{ (void *)0x00000000001daad0, "dns_xfrin_create3" },
+	{ (void *)0x00000000001db140, "dns_xfrin_create" },
+	{ (void *)0x00000000001db2f0, "dns_xfrin_create2" },
+	{ (void *)0x00000000001db320, "dns_xfrin_shutdown" },
+	{ (void *)0x00000000001db350, "dns_xfrin_attach" },
+	{ (void *)0x00000000001db380, "dns_xfrin_detach" },
+	{ (void *)0x00000000001db3c0, "open_msgcat" },
+	{ (void *)0x00000000001db3e0, "dst_lib_initmsgcat" },
+	{ (void *)0x00000000001db420, "dst__privstruct_free.part.0" },
+	{ (void *)0x00000000001db4c0, "check_data" },
+	{ (void *)0x00000000001dba00, "dst__privstruct_free" },
+	{ (void *)0x00000000001dba20, "dst__privstruct_parse" },
+	{ (void *)0x00000000001dc050, "dst__privstruct_writefile" },
+	{ (void *)0x00000000001dc6f0, "check_forward" },
+	{ (void *)0x00000000001dc7c0, "check_nonzero" },
+	{ (void *)0x00000000001dc860, "bind9_check_controlskeys" },
+	{ (void *)0x00000000001dc990, "freekey" },
+	{ (void *)0x00000000001dc9b0, "nameexist" },
+	{ (void *)0x00000000001dcb00, "check_options" },
+	{ (void *)0x00000000001dde00, "checkacl" },
+	{ (void *)0x00000000001ddf40, "check_orderent" },
+	{ (void *)0x00000000001de2e0, "check_order" },
+	{ (void *)0x00000000001de370, "check_dual_stack" },
+	{ (void *)0x00000000001de5d0, "validate_masters" },
+	{ (void *)0x00000000001de950, "check_zoneconf" },
+	{ (void *)0x00000000001e04c0, "check_servers" },
+	{ (void *)0x00000000001e0910, "check_trusted_key" },
+	{ (void *)0x00000000001e0c60, "bind9_check_key" },
+	{ (void *)0x00000000001e0f50, "check_keylist" },
+	{ (void *)0x00000000001e1220, "check_viewconf" },
+	{ (void *)0x00000000001e24c0, "bind9_check_namedconf" },
+	{ (void *)0x00000000001e34a0, "get_acl_def" },
+	{ (void *)0x00000000001e3580, "count_acl_elements" },
+	{ (void *)0x00000000001e3730, "cfg_aclconfctx_create" },
+	{ (void *)0x00000000001e3830, "cfg_aclconfctx_attach" },
+	{ (void *)0x00000000001e38b0, "cfg_aclconfctx_detach" },
+	{ (void *)0x00000000001e3a70, "cfg_acl_fromconfig2" },
+	{ (void *)0x00000000001e4510, "cfg_acl_fromconfig" },
+	{ (void *)0x00000000001e4530, "cfg_log_init" },
+	{ (void *)0x00000000001e4570, "doc_enum_or_other" },
+	{ (void *)0x00000000001e4580, "parse_querysource" },
+	{ (void *)0x00000000001e4870, "doc_optional_uint32" },
+	{ (void *)0x00000000001e4880, "doc_boolorauto" },
+	{ (void *)0x00000000001e4890, "print_auto" },
+	{ (void *)0x00000000001e48a0, "doc_lookaside" },
+	{ (void *)0x00000000001e48b0, "doc_serverid" },
+	{ (void *)0x00000000001e48c0, "print_hostname" },
+	{ (void *)0x00000000001e48d0, "print_none" },
+	{ (void *)0x00000000001e48e0, "doc_qstringornone" },
+	{ (void *)0x00000000001e48f0, "print_querysource" },
+	{ (void *)0x00000000001e4990, "parse_maxttlval" },
+	{ (void *)0x00000000001e4a40, "parse_sizeval" },
+	{ (void *)0x00000000001e4b80, "print_keyvalue" },
+	{ (void *)0x00000000001e4bd0, "doc_masterselement" },
+	{ (void *)0x00000000001e4cb0, "print_negated" },
+	{ (void *)0x00000000001e4ce0, "doc_rpz_cname" },
+	{ (void *)0x00000000001e4d00, "doc_rpz_policy" },
+	{ (void *)0x00000000001e4d60, "doc_sockaddrnameport" },
+	{ (void *)0x00000000001e4eb0, "doc_logfile" },
+	{ (void *)0x00000000001e4f10, "doc_optional_keyvalue" },
+	{ (void *)0x00000000001e4f80, "doc_optional_bracketed_list" },
+	{ (void *)0x00000000001e4f90, "doc_matchname" },
+	{ (void *)0x00000000001e4fe0, "doc_updatepolicy" },
+	{ (void *)0x00000000001e5020, "doc_keyvalue" },
+	{ (void *)0x00000000001e5060, "cfg_doc_kv_tuple" },
+	{ (void *)0x00000000001e5130, "parse_maybe_optional_keyvalue" },
+	{ (void *)0x00000000001e5210, "parse_optional_keyvalue" },
+	{ (void *)0x00000000001e5220, "parse_keyvalue" },
+	{ (void *)0x00000000001e5230, "parse_masterselement" },
+	{ (void *)0x00000000001e5300, "parse_matchname" },
+	{ (void *)0x00000000001e5350, "print_updatepolicy" },
+	{ (void *)0x00000000001e5390, "cfg_parse_kv_tuple" },
+	{ (void *)0x00000000001e5520, "parse_sockaddrnameport" },
+	{ (void *)0x00000000001e5660, "parse_logfile" },
+	{ (void *)0x00000000001e57f0, "cfg_parse_rpz_policy" },
+	{ (void *)0x00000000001e58e0, "cfg_print_kv_tuple" },
+	{ (void *)0x00000000001e5990, "print_logfile" },
+	{ (void *)0x00000000001e5a20, "parse_optional_uint32" },
+	{ (void *)0x00000000001e5a70, "parse_optional_class" },
+	{ (void *)0x00000000001e5ac0, "parse_optional_facility" },
+	{ (void *)0x00000000001e5b10, "parse_server_key_kludge" },
+	{ (void *)0x00000000001e5bc0, "parse_matchtype" },
+	{ (void *)0x00000000001e5c20, "parse_zonestat" },
+	{ (void *)0x00000000001e5c90, "print_boolorauto" },
+	{ (void *)0x00000000001e5cf0, "parse_addrmatchelt" },
+	{ (void *)0x00000000001e5e20, "parse_updatepolicy" },
+	{ (void *)0x00000000001e5f60, "parse_boolorauto" },
+	{ (void *)0x00000000001e5fd0, "print_lookaside" },
+	{ (void *)0x00000000001e6030, "parse_logseverity" },
+	{ (void *)0x00000000001e6100, "parse_serverid" },
+	{ (void *)0x00000000001e61b0, "parse_qstringornone" },
+	{ (void *)0x00000000001e6220, "parse_notify_type" },
+	{ (void *)0x00000000001e6290, "parse_size" },
+	{ (void *)0x00000000001e6300, "parse_dialup_type" },
+	{ (void *)0x00000000001e6370, "parse_ixfrdiff_type" },
+	{ (void *)0x00000000001e63e0, "parse_maxttl" },
+	{ (void *)0x00000000001e6450, "parse_filter_aaaa" },
+	{ (void *)0x00000000001e64c0, "parse_logversions" },
+	{ (void *)0x00000000001e6530, "parse_portrange" },
+	{ (void *)0x00000000001e6750, "cfg_print_void" },
+	{ (void *)0x00000000001e6760, "cfg_print_ustring" },
+	{ (void *)0x00000000001e6780, "print_qstring" },
+	{ (void *)0x00000000001e67d0, "print_sstring" },
+	{ (void *)0x00000000001e6850, "cfg_print_spacelist" },
+	{ (void *)0x00000000001e68a0, "free_string" },
+	{ (void *)0x00000000001e68d0, "token_addr" },
+	{ (void *)0x00000000001e6b90, "current_file.part.0" },
+	{ (void *)0x00000000001e6bc0, "cfg_obj_islist.part.0" },
+	{ (void *)0x00000000001e6be0, "cfg_list_first.part.0" },
+	{ (void *)0x00000000001e6c00, "cfg_doc_void" },
+	{ (void *)0x00000000001e6c10, "cfg_print_boolean" },
+	{ (void *)0x00000000001e6c40, "free_noop" },
+	{ (void *)0x00000000001e6c50, "print_list" },
+	{ (void *)0x00000000001e6cd0, "cfg_print_uint64" },
+	{ (void *)0x00000000001e6d10, "cfg_print_uint32" },
+	{ (void *)0x00000000001e6d50, "cfg_doc_terminal" },
+	{ (void *)0x00000000001e6da0, "cfg_print_sockaddr" },
+	{ (void *)0x00000000001e6eb0, "cfg_doc_netaddr" },
+	{ (void *)0x00000000001e6fa0, "cfg_doc_sockaddr" },
+	{ (void *)0x00000000001e70e0, "cfg_print_obj" },
+	{ (void *)0x00000000001e70f0, "cfg_print_chars" },
+	{ (void *)0x00000000001e7100, "cfg_parse_obj" },
+	{ (void *)0x00000000001e7160, "cfg_print" },
+	{ (void *)0x00000000001e7190, "cfg_printx" },
+	{ (void *)0x00000000001e71c0, "cfg_print_tuple" },
+	{ (void *)0x00000000001e7250, "cfg_doc_tuple" },
+	{ (void *)0x00000000001e72c0, "cfg_obj_istuple" },
+	{ (void *)0x00000000001e7300, "cfg_tuple_get" },
+	{ (void *)0x00000000001e73a0, "cfg_parser_setcallback" },
+	{ (void *)0x00000000001e73b0, "cfg_parser_attach" },
+	{ (void *)0x00000000001e7430, "cfg_obj_isvoid" },
+	{ (void *)0x00000000001e7470, "cfg_print_cstr" },
+	{ (void *)0x00000000001e74a0, "cfg_print_rawuint" },
+	{ (void *)0x00000000001e74e0, "cfg_obj_isuint32" },
+	{ (void *)0x00000000001e7520, "cfg_obj_asuint32" },
+	{ (void *)0x00000000001e7560, "cfg_obj_isuint64" },
+	{ (void *)0x00000000001e75a0, "cfg_obj_asuint64" },
+	{ (void *)0x00000000001e75e0, "cfg_is_enum" },
+	{ (void *)0x00000000001e7640, "cfg_doc_enum" },
+	{ (void *)0x00000000001e76e0, "cfg_obj_isstring" },
+	{ (void *)0x00000000001e7720, "cfg_obj_asstring" },
+	{ (void *)0x00000000001e7760, "cfg_obj_isboolean" },
+	{ (void *)0x00000000001e77a0, "cfg_obj_asboolean" },
+	{ (void *)0x00000000001e77e0, "cfg_parse_listelt" },
+	{ (void *)0x00000000001e78a0, "cfg_print_bracketed_list" },
+	{ (void *)0x00000000001e7910, "cfg_doc_bracketed_list" },
+	{ (void *)0x00000000001e7960, "cfg_obj_islist" },
+	{ (void *)0x00000000001e7980, "cfg_list_first" },
+	{ (void *)0x00000000001e79b0, "cfg_list_next" },
+	{ (void *)0x00000000001e79e0, "cfg_list_length" },
+	{ (void *)0x00000000001e7aa0, "cfg_listelt_value" },
+	{ (void *)0x00000000001e7ad0, "cfg_print_mapbody" },
+	{ (void *)0x00000000001e7cb0, "cfg_doc_mapbody" },
+	{ (void *)0x00000000001e7d70, "cfg_print_map" },
+	{ (void *)0x00000000001e7e00, "cfg_doc_map" },
+	{ (void *)0x00000000001e80b0, "cfg_obj_ismap" },
+	{ (void *)0x00000000001e80f0, "cfg_map_get" },
+	{ (void *)0x00000000001e8190, "cfg_map_getname" },
+	{ (void *)0x00000000001e81d0, "cfg_map_count" },
+	{ (void *)0x00000000001e8210, "cfg_lookingat_netaddr" },
+	{ (void *)0x00000000001e8230, "cfg_print_rawaddr" },
+	{ (void *)0x00000000001e82a0, "print_netprefix" },
+	{ (void *)0x00000000001e8300, "cfg_obj_isnetprefix" },
+	{ (void *)0x00000000001e8340, "cfg_obj_asnetprefix" },
+	{ (void *)0x00000000001e8410, "cfg_obj_issockaddr" },
+	{ (void *)0x00000000001e8450, "cfg_obj_assockaddr" },
+	{ (void *)0x00000000001e8490, "cfg_obj_getdscp" },
+	{ (void *)0x00000000001e84d0, "cfg_ungettoken" },
+	{ (void *)0x00000000001e8500, "cfg_parser_error" },
+	{ (void *)0x00000000001e85a0, "cfg_gettoken" },
+	{ (void *)0x00000000001e8840, "cfg_peektoken" },
+	{ (void *)0x00000000001e8890, "parser_complain" },
+	{ (void *)0x00000000001e8a90, "cfg_parse_special" },
+	{ (void *)0x00000000001e8ae0, "parse_semicolon" },
+	{ (void *)0x00000000001e8b50, "cfg_parse_rawaddr" },
+	{ (void *)0x00000000001e8c30, "cfg_parse_rawport" },
+	{ (void *)0x00000000001e8cd0, "cfg_parse_dscp" },
+	{ (void *)0x00000000001e8d50, "cfg_parser_warning" },
+	{ (void *)0x00000000001e8df0, "cfg_obj_log" },
+	{ (void *)0x00000000001e8f10, "cfg_obj_file" },
+	{ (void *)0x00000000001e8f20, "cfg_obj_line" },
+	{ (void *)0x00000000001e8f30, "cfg_create_obj" },
+	{ (void *)0x00000000001e9030, "cfg_create_tuple" },
+	{ (void *)0x00000000001e9150, "create_string" },
+	{ (void *)0x00000000001e9220, "cfg_parse_qstring" },
+	{ (void *)0x00000000001e9280, "cfg_parse_astring" },
+	{ (void *)0x00000000001e92f0, "cfg_parse_sstring" },
+	{ (void *)0x00000000001e9360, "parse_ustring" },
+	{ (void *)0x00000000001e93c0, "cfg_parse_void" },
+	{ (void *)0x00000000001e93d0, "cfg_parse_uint32" },
+	{ (void *)0x00000000001e9450, "cfg_parse_boolean" },
+	{ (void *)0x00000000001e9560, "cfg_create_list" },
+	{ (void *)0x00000000001e9590, "parse_token" },
+	{ (void *)0x00000000001e96e0, "cfg_parse_netprefix" },
+	{ (void *)0x00000000001e9920, "cfg_obj_istype" },
+	{ (void *)0x00000000001e9930, "cfg_obj_destroy" },
+	{ (void *)0x00000000001e9a20, "free_map" },
+	{ (void *)0x00000000001e9a40, "free_tuple" },
+	{ (void *)0x00000000001e9ae0, "cfg_parse_tuple" },
+	{ (void *)0x00000000001e9ba0, "cfg_parser_create" },
+	{ (void *)0x00000000001e9e00, "parser_openfile" },
+	{ (void *)0x00000000001e9f40, "parse2" },
+	{ (void *)0x00000000001ea050, "cfg_parse_file" },
+	{ (void *)0x00000000001ea0a0, "cfg_parse_buffer" },
+	{ (void *)0x00000000001ea100, "cfg_parser_destroy" },
+	{ (void *)0x00000000001ea1b0, "cfg_parse_enum" },
+	{ (void *)0x00000000001ea2c0, "cfg_parse_bracketed_list" },
+	{ (void *)0x00000000001ea4b0, "cfg_parse_spacelist" },
+	{ (void *)0x00000000001ea5d0, "map_symtabitem_destroy" },
+	{ (void *)0x00000000001ea5f0, "cfg_parse_mapbody" },
+	{ (void *)0x00000000001eac80, "cfg_parse_map" },
+	{ (void *)0x00000000001ead10, "parse_any_named_map" },
+	{ (void *)0x00000000001eae30, "cfg_parse_named_map" },
+	{ (void *)0x00000000001eae50, "cfg_parse_addressed_map" },
+	{ (void *)0x00000000001eae70, "cfg_parse_netprefix_map" },
+	{ (void *)0x00000000001eae90, "parse_unsupported" },
+	{ (void *)0x00000000001eb020, "parse_netaddr" },
+	{ (void *)0x00000000001eb0c0, "cfg_parse_sockaddr" },
+	{ (void *)0x00000000001eb2f0, "free_list" },
+	{ (void *)0x00000000001eb350, "cfg_obj_attach" },
+	{ (void *)0x00000000001eb3d0, "cfg_doc_obj" },
+	{ (void *)0x00000000001eb3e0, "cfg_print_grammar" },
+	{ (void *)0x00000000001eb410, "isccc_alist_first.part.0" },
+	{ (void *)0x00000000001eb430, "isccc_alist_create" },
+	{ (void *)0x00000000001eb480, "isccc_alist_alistp" },
+	{ (void *)0x00000000001eb4d0, "isccc_alist_emptyp" },
+	{ (void *)0x00000000001eb530, "isccc_alist_first" },
+	{ (void *)0x00000000001eb570, "isccc_alist_assq" },
+	{ (void *)0x00000000001eb650, "isccc_alist_delete" },
+	{ (void *)0x00000000001eb780, "isccc_alist_define" },
+	{ (void *)0x00000000001eb820, "isccc_alist_definestring" },
+	{ (void *)0x00000000001eb880, "isccc_alist_definebinary" },
+	{ (void *)0x00000000001eb8e0, "isccc_alist_lookup" },
+	{ (void *)0x00000000001eb900, "isccc_alist_lookupstring" },
+	{ (void *)0x00000000001eb950, "isccc_alist_lookupbinary" },
+	{ (void *)0x00000000001eb9a0, "isccc_alist_prettyprint" },
+	{ (void *)0x00000000001ebc50, "symtab_clean" },
+	{ (void *)0x00000000001ebc70, "value_towire" },
+	{ (void *)0x00000000001ebe70, "table_towire" },
+	{ (void *)0x00000000001ebf40, "symtab_undefine" },
+	{ (void *)0x00000000001ebf50, "sign" },
+	{ (void *)0x00000000001ec290, "value_fromwire.constprop.0" },
+	{ (void *)0x00000000001ec3e0, "table_fromwire" },
+	{ (void *)0x00000000001ec910, "createmessage.part.0" },
+	{ (void *)0x00000000001ecb90, "isccc_cc_towire" },
+	{ (void *)0x00000000001ecd20, "isccc_cc_fromwire" },
+	{ (void *)0x00000000001ecd70, "isccc_cc_createmessage" },
+	{ (void *)0x00000000001ecde0, "isccc_cc_isack" },
+	{ (void *)0x00000000001ece30, "isccc_cc_isreply" },
+	{ (void *)0x00000000001ece80, "isccc_cc_definestring" },
+	{ (void *)0x00000000001ecec0, "isccc_cc_defineuint32" },
+	{ (void *)0x00000000001ecf20, "isccc_cc_lookupstring" },
+	{ (void *)0x00000000001ecf90, "isccc_cc_lookupuint32" },
+	{ (void *)0x00000000001ecff0, "isccc_cc_createack" },
+	{ (void *)0x00000000001ed1d0, "isccc_cc_createresponse" },
+	{ (void *)0x00000000001ed450, "isccc_cc_createsymtab" },
+	{ (void *)0x00000000001ed470, "isccc_cc_cleansymtab" },
+	{ (void *)0x00000000001ed490, "isccc_cc_checkdup" },
+	{ (void *)0x00000000001ed7d0, "recv_message" },
+	{ (void *)0x00000000001ed910, "recv_length" },
+	{ (void *)0x00000000001eda30, "isccc_ccmsg_init" },
+	{ (void *)0x00000000001edad0, "isccc_ccmsg_setmaxsize" },
+	{ (void *)0x00000000001edb00, "isccc_ccmsg_readmessage" },
+	{ (void *)0x00000000001edc80, "isccc_ccmsg_cancelread" },
+	{ (void *)0x00000000001edcc0, "isccc_ccmsg_invalidate" },
+	{ (void *)0x00000000001edd30, "initialize_action" },
+	{ (void *)0x00000000001edd80, "isccc_result_totext" },
+	{ (void *)0x00000000001eddd0, "isccc_result_register" },
+	{ (void *)0x00000000001ede20, "isccc_sexpr_cons" },
+	{ (void *)0x00000000001ede50, "isccc_sexpr_tconst" },
+	{ (void *)0x00000000001ede60, "isccc_sexpr_fromstring" },
+	{ (void *)0x00000000001edeb0, "isccc_sexpr_frombinary" },
+	{ (void *)0x00000000001edf20, "isccc_sexpr_free" },
+	{ (void *)0x00000000001edfb0, "isccc_sexpr_print" },
+	{ (void *)0x00000000001ee190, "isccc_sexpr_car" },
+	{ (void *)0x00000000001ee1c0, "isccc_sexpr_cdr" },
+	{ (void *)0x00000000001ee1f0, "isccc_sexpr_setcar" },
+	{ (void *)0x00000000001ee220, "isccc_sexpr_setcdr" },
+	{ (void *)0x00000000001ee250, "isccc_sexpr_addtolist" },
+	{ (void *)0x00000000001ee320, "isccc_sexpr_listp" },
+	{ (void *)0x00000000001ee340, "isccc_sexpr_emptyp" },
+	{ (void *)0x00000000001ee350, "isccc_sexpr_stringp" },
+	{ (void *)0x00000000001ee360, "isccc_sexpr_binaryp" },
+	{ (void *)0x00000000001ee370, "isccc_sexpr_tostring" },
+	{ (void *)0x00000000001ee3a0, "isccc_sexpr_tobinary" },
+	{ (void *)0x00000000001ee3d0, "isccc_symtab_create" },
+	{ (void *)0x00000000001ee4f0, "isccc_symtab_destroy" },
+	{ (void *)0x00000000001ee6f0, "isccc_symtab_lookup" },
+	{ (void *)0x00000000001ee8c0, "isccc_symtab_define" },
+	{ (void *)0x00000000001eeca0, "isccc_symtab_undefine" },
+	{ (void *)0x00000000001eef90, "isccc_symtab_foreach" },
+	{ (void *)0x00000000001ef1a0, "isccc_base64_encode" },
+	{ (void *)0x00000000001ef220, "isccc_base64_decode" },
+	{ (void *)0x00000000001ef270, "open_msgcat" },
+	{ (void *)0x00000000001ef290, "isccc_lib_initmsgcat" },
+	{ (void *)0x00000000001ef2d0, "default_callback" },
+	{ (void *)0x00000000001ef4d0, "isc_assertion_failed" },
+	{ (void *)0x00000000001ef4e0, "isc_assertion_setcallback" },
+	{ (void *)0x00000000001ef500, "isc_assertion_typetotext" },
+	{ (void *)0x00000000001ef540, "isc_backtrace_gettrace" },
+	{ (void *)0x00000000001ef5a0, "isc_backtrace_getsymbolfromindex" },
+	{ (void *)0x00000000001ef630, "isc_backtrace_getsymbol" },
+	{ (void *)0x00000000001ef720, "base32_decodestring" },
+	{ (void *)0x00000000001ef9f0, "base32_tobuffer" },
+	{ (void *)0x00000000001efdb0, "base32_decoderegion" },
+	{ (void *)0x00000000001f00b0, "base32_totext" },
+	{ (void *)0x00000000001f0660, "isc_base32_totext" },
+	{ (void *)0x00000000001f0670, "isc_base32hex_totext" },
+	{ (void *)0x00000000001f0680, "isc_base32_tobuffer" },
+	{ (void *)0x00000000001f06a0, "isc_base32hex_tobuffer" },
+	{ (void *)0x00000000001f06c0, "isc_base32_decodestring" },
+	{ (void *)0x00000000001f06d0, "isc_base32hex_decodestring" },
+	{ (void *)0x00000000001f06e0, "isc_base32_decoderegion" },
+	{ (void *)0x00000000001f06f0, "isc_base32hex_decoderegion" },
+	{ (void *)0x00000000001f0700, "isc_base64_totext" },
+	{ (void *)0x00000000001f0a80, "isc_base64_tobuffer" },
+	{ (void *)0x00000000001f0d20, "isc_base64_decodestring" },
+	{ (void *)0x00000000001f0f00, "isc__buffer_init.part.0" },
+	{ (void *)0x00000000001f0f20, "isc__buffer_init" },
+	{ (void *)0x00000000001f0f60, "isc__buffer_initnull" },
+	{ (void *)0x00000000001f0f90, "isc_buffer_reinit" },
+	{ (void *)0x00000000001f1000, "isc__buffer_invalidate" },
+	{ (void *)0x00000000001f1090, "isc__buffer_region" },
+	{ (void *)0x00000000001f10f0, "isc__buffer_usedregion" },
+	{ (void *)0x00000000001f1150, "isc__buffer_availableregion" },
+	{ (void *)0x00000000001f11c0, "isc__buffer_add" },
+	{ (void *)0x00000000001f1220, "isc__buffer_subtract" },
+	{ (void *)0x00000000001f1290, "isc__buffer_clear" },
+	{ (void *)0x00000000001f12d0, "isc__buffer_consumedregion" },
+	{ (void *)0x00000000001f1330, "isc__buffer_remainingregion" },
+	{ (void *)0x00000000001f13a0, "isc__buffer_activeregion" },
+	{ (void *)0x00000000001f1420, "isc__buffer_setactive" },
+	{ (void *)0x00000000001f1480, "isc__buffer_first" },
+	{ (void *)0x00000000001f14b0, "isc__buffer_forward" },
+	{ (void *)0x00000000001f1510, "isc__buffer_back" },
+	{ (void *)0x00000000001f1570, "isc_buffer_compact" },
+	{ (void *)0x00000000001f15e0, "isc_buffer_getuint8" },
+	{ (void *)0x00000000001f1650, "isc__buffer_putuint8" },
+	{ (void *)0x00000000001f16b0, "isc_buffer_getuint16" },
+	{ (void *)0x00000000001f1720, "isc__buffer_putuint16" },
+	{ (void *)0x00000000001f1790, "isc__buffer_putuint24" },
+	{ (void *)0x00000000001f1800, "isc_buffer_getuint32" },
+	{ (void *)0x00000000001f1870, "isc__buffer_putuint32" },
+	{ (void *)0x00000000001f18d0, "isc_buffer_getuint48" },
+	{ (void *)0x00000000001f1970, "isc__buffer_putuint48" },
+	{ (void *)0x00000000001f1a00, "isc__buffer_putmem" },
+	{ (void *)0x00000000001f1a70, "isc__buffer_putstr" },
+	{ (void *)0x00000000001f1b10, "isc_buffer_copyregion" },
+	{ (void *)0x00000000001f1ba0, "isc_buffer_allocate" },
+	{ (void *)0x00000000001f1c50, "isc_buffer_free" },
+	{ (void *)0x00000000001f1d60, "isc_commandline_parse" },
+	{ (void *)0x00000000001f1ff0, "isc_crc64_init" },
+	{ (void *)0x00000000001f2020, "isc_crc64_update" },
+	{ (void *)0x00000000001f20a0, "isc_crc64_final" },
+	{ (void *)0x00000000001f20d0, "default_unexpected_callback" },
+	{ (void *)0x00000000001f2130, "default_fatal_callback" },
+	{ (void *)0x00000000001f21c0, "isc_error_setunexpected" },
+	{ (void *)0x00000000001f21e0, "isc_error_setfatal" },
+	{ (void *)0x00000000001f2200, "isc_error_unexpected" },
+	{ (void *)0x00000000001f2290, "isc_error_fatal" },
+	{ (void *)0x00000000001f2320, "isc_error_runtimecheck" },
+	{ (void *)0x00000000001f2370, "destroy" },
+	{ (void *)0x00000000001f2390, "isc_event_allocate" },
+	{ (void *)0x00000000001f2460, "isc_event_free" },
+	{ (void *)0x00000000001f24c0, "destroy" },
+	{ (void *)0x00000000001f2650, "initialize_lock" },
+	{ (void *)0x00000000001f2690, "isc_hash_ctxcreate" },
+	{ (void *)0x00000000001f28b0, "isc_hash_create" },
+	{ (void *)0x00000000001f2a00, "isc_hash_ctxinit" },
+	{ (void *)0x00000000001f2b70, "isc_hash_init" },
+	{ (void *)0x00000000001f2bb0, "isc_hash_ctxattach" },
+	{ (void *)0x00000000001f2c30, "isc_hash_ctxdetach" },
+	{ (void *)0x00000000001f2cd0, "isc_hash_destroy" },
+	{ (void *)0x00000000001f2d60, "isc_hash_ctxcalc" },
+	{ (void *)0x00000000001f2e80, "isc_hash_calc" },
+	{ (void *)0x00000000001f2fa0, "float_up" },
+	{ (void *)0x00000000001f30b0, "sink_down" },
+	{ (void *)0x00000000001f3210, "isc_heap_create" },
+	{ (void *)0x00000000001f3300, "isc_heap_destroy" },
+	{ (void *)0x00000000001f33c0, "isc_heap_insert" },
+	{ (void *)0x00000000001f3500, "isc_heap_delete" },
+	{ (void *)0x00000000001f35e0, "isc_heap_increased" },
+	{ (void *)0x00000000001f3650, "isc_heap_decreased" },
+	{ (void *)0x00000000001f36c0, "isc_heap_element" },
+	{ (void *)0x00000000001f3720, "isc_heap_foreach" },
+	{ (void *)0x00000000001f37b0, "isc_hex_totext" },
+	{ (void *)0x00000000001f3940, "isc_hex_tobuffer" },
+	{ (void *)0x00000000001f3ae0, "isc_hex_decodestring" },
+	{ (void *)0x00000000001f3c10, "isc_hmacmd5_init" },
+	{ (void *)0x00000000001f3ce0, "isc_hmacmd5_invalidate" },
+	{ (void *)0x00000000001f3d10, "isc_hmacmd5_update" },
+	{ (void *)0x00000000001f3d20, "isc_hmacmd5_sign" },
+	{ (void *)0x00000000001f3de0, "isc_hmacmd5_verify" },
+	{ (void *)0x00000000001f3e10, "isc_hmacmd5_verify2" },
+	{ (void *)0x00000000001f3e60, "isc_hmacsha1_init" },
+	{ (void *)0x00000000001f3f30, "isc_hmacsha1_invalidate" },
+	{ (void *)0x00000000001f3f70, "isc_hmacsha1_update" },
+	{ (void *)0x00000000001f3f80, "isc_hmacsha1_sign" },
+	{ (void *)0x00000000001f4090, "isc_hmacsha224_init" },
+	{ (void *)0x00000000001f4160, "isc_hmacsha224_invalidate" },
+	{ (void *)0x00000000001f4190, "isc_hmacsha224_update" },
+	{ (void *)0x00000000001f41a0, "isc_hmacsha224_sign" },
+	{ (void *)0x00000000001f4280, "isc_hmacsha256_init" },
+	{ (void *)0x00000000001f4350, "isc_hmacsha256_invalidate" },
+	{ (void *)0x00000000001f4380, "isc_hmacsha256_update" },
+	{ (void *)0x00000000001f4390, "isc_hmacsha256_sign" },
+	{ (void *)0x00000000001f4470, "isc_hmacsha384_init" },
+	{ (void *)0x00000000001f4580, "isc_hmacsha384_invalidate" },
+	{ (void *)0x00000000001f45b0, "isc_hmacsha384_update" },
+	{ (void *)0x00000000001f45c0, "isc_hmacsha384_sign" },
+	{ (void *)0x00000000001f46d0, "isc_hmacsha512_init" },
+	{ (void *)0x00000000001f47e0, "isc_hmacsha512_invalidate" },
+	{ (void *)0x00000000001f4810, "isc_hmacsha512_update" },
+	{ (void *)0x00000000001f4820, "isc_hmacsha512_sign" },
+	{ (void *)0x00000000001f4930, "isc_hmacsha1_verify" },
+	{ (void *)0x00000000001f4990, "isc_hmacsha224_verify" },
+	{ (void *)0x00000000001f49f0, "isc_hmacsha256_verify" },
+	{ (void *)0x00000000001f4a50, "isc_hmacsha384_verify" },
+	{ (void *)0x00000000001f4ab0, "isc_hmacsha512_verify" },
+	{ (void *)0x00000000001f4b10, "render_500" },
+	{ (void *)0x00000000001f4b90, "render_404" },
+	{ (void *)0x00000000001f4c10, "reset_client" },
+	{ (void *)0x00000000001f4ce0, "httpdmgr_destroy" },
+	{ (void *)0x00000000001f4f70, "isc_httpd_accept" },
+	{ (void *)0x00000000001f51e0, "destroy_client" },
+	{ (void *)0x00000000001f53a0, "isc_httpd_senddone" },
+	{ (void *)0x00000000001f56d0, "grow_headerspace" },
+	{ (void *)0x00000000001f5770, "isc_httpdmgr_create" },
+	{ (void *)0x00000000001f5a30, "isc_httpdmgr_shutdown" },
+	{ (void *)0x00000000001f5ae0, "isc_httpd_response" },
+	{ (void *)0x00000000001f5b70, "isc_httpd_addheader" },
+	{ (void *)0x00000000001f5c20, "isc_httpd_endheaders" },
+	{ (void *)0x00000000001f5d30, "isc_httpd_addheaderuint" },
+	{ (void *)0x00000000001f5dd0, "isc_httpd_recvdone" },
+	{ (void *)0x00000000001f6570, "isc_httpdmgr_addurl2" },
+	{ (void *)0x00000000001f6680, "isc_httpdmgr_addurl" },
+	{ (void *)0x00000000001f6690, "isc_net_aton" },
+	{ (void *)0x00000000001f68b0, "isc_iterated_hash" },
+	{ (void *)0x00000000001f6950, "isc_lex_create" },
+	{ (void *)0x00000000001f6a90, "isc_lex_getcomments" },
+	{ (void *)0x00000000001f6ac0, "isc_lex_setcomments" },
+	{ (void *)0x00000000001f6af0, "isc_lex_getspecials" },
+	{ (void *)0x00000000001f6b30, "isc_lex_setspecials" },
+	{ (void *)0x00000000001f6b70, "isc_lex_openfile" },
+	{ (void *)0x00000000001f6d50, "isc_lex_openstream" },
+	{ (void *)0x00000000001f6f10, "isc_lex_openbuffer" },
+	{ (void *)0x00000000001f70d0, "isc_lex_close" },
+	{ (void *)0x00000000001f72a0, "isc_lex_destroy" },
+	{ (void *)0x00000000001f73a0, "isc_lex_gettoken" },
+	{ (void *)0x00000000001f8410, "isc_lex_ungettoken" },
+	{ (void *)0x00000000001f84d0, "isc_lex_getmastertoken" },
+	{ (void *)0x00000000001f85b0, "isc_lex_getoctaltoken" },
+	{ (void *)0x00000000001f8640, "isc_lex_getlasttokentext" },
+	{ (void *)0x00000000001f8730, "isc_lex_getsourcename" },
+	{ (void *)0x00000000001f8770, "isc_lex_getsourceline" },
+	{ (void *)0x00000000001f87b0, "isc_lex_setsourcename" },
+	{ (void *)0x00000000001f8860, "isc_lex_isfile" },
+	{ (void *)0x00000000001f88a0, "open_msgcat" },
+	{ (void *)0x00000000001f88c0, "do_register" },
+	{ (void *)0x00000000001f89b0, "isc_lib_initmsgcat" },
+	{ (void *)0x00000000001f8a40, "isc_lib_register" },
+	{ (void *)0x00000000001f8a80, "sync_channellist" },
+	{ (void *)0x00000000001f8b80, "assignchannel" },
+	{ (void *)0x00000000001f8d10, "roll_log" },
+	{ (void *)0x00000000001f90a0, "file_ready" },
+	{ (void *)0x00000000001f92b0, "file_checksize" },
+	{ (void *)0x00000000001f9320, "async_write" },
+	{ (void *)0x00000000001f9550, "async_run" },
+	{ (void *)0x00000000001f98a0, "isc_log_doit" },
+	{ (void *)0x00000000001fa510, "isc_logconfig_get" },
+	{ (void *)0x00000000001fa570, "isc_logconfig_destroy" },
+	{ (void *)0x00000000001faac0, "isc_logconfig_use" },
+	{ (void *)0x00000000001fac00, "isc_log_destroy" },
+	{ (void *)0x00000000001fae20, "isc_log_registercategories" },
+	{ (void *)0x00000000001faee0, "isc_log_categorybyname" },
+	{ (void *)0x00000000001faf70, "isc_log_registermodules" },
+	{ (void *)0x00000000001fb030, "isc_log_modulebyname" },
+	{ (void *)0x00000000001fb0c0, "isc_log_createchannel" },
+	{ (void *)0x00000000001fb650, "isc_logconfig_create" },
+	{ (void *)0x00000000001fb840, "isc_log_create" },
+	{ (void *)0x00000000001fba40, "isc_log_usechannel" },
+	{ (void *)0x00000000001fbbb0, "isc_log_write" },
+	{ (void *)0x00000000001fbc40, "isc_log_vwrite" },
+	{ (void *)0x00000000001fbc60, "isc_log_write1" },
+	{ (void *)0x00000000001fbcf0, "isc_log_vwrite1" },
+	{ (void *)0x00000000001fbd10, "isc_log_iwrite" },
+	{ (void *)0x00000000001fbdb0, "isc_log_ivwrite" },
+	{ (void *)0x00000000001fbde0, "isc_log_iwrite1" },
+	{ (void *)0x00000000001fbe80, "isc_log_ivwrite1" },
+	{ (void *)0x00000000001fbeb0, "isc_log_setcontext" },
+	{ (void *)0x00000000001fbec0, "isc_log_setdebuglevel" },
+	{ (void *)0x00000000001fbfb0, "isc_log_getdebuglevel" },
+	{ (void *)0x00000000001fbfe0, "isc_log_setduplicateinterval" },
+	{ (void *)0x00000000001fc010, "isc_log_getduplicateinterval" },
+	{ (void *)0x00000000001fc040, "isc_log_settag" },
+	{ (void *)0x00000000001fc110, "isc_log_gettag" },
+	{ (void *)0x00000000001fc140, "isc_log_opensyslog" },
+	{ (void *)0x00000000001fc150, "isc_log_closefilelogs" },
+	{ (void *)0x00000000001fc2f0, "isc_log_getdropped" },
+	{ (void *)0x00000000001fc3a0, "isc_log_wouldlog" },
+	{ (void *)0x00000000001fc3e0, "transform" },
+	{ (void *)0x00000000001fcad0, "isc_md5_init" },
+	{ (void *)0x00000000001fcaf0, "isc_md5_invalidate" },
+	{ (void *)0x00000000001fcb20, "isc_md5_update" },
+	{ (void *)0x00000000001fcc00, "isc_md5_final" },
+	{ (void *)0x00000000001fcd50, "isc__mem_attach" },
+	{ (void *)0x00000000001fce40, "cache_create" },
+	{ (void *)0x00000000001fcf60, "isc__mem_waterack" },
+	{ (void *)0x00000000001fd060, "isc__mem_setdestroycheck" },
+	{ (void *)0x00000000001fd110, "isc_mem_setquota" },
+	{ (void *)0x00000000001fd1d0, "isc_mem_getquota" },
+	{ (void *)0x00000000001fd290, "isc__mem_maxinuse" },
+	{ (void *)0x00000000001fd350, "isc__mem_total" },
+	{ (void *)0x00000000001fd410, "isc__mem_setwater" },
+	{ (void *)0x00000000001fd5d0, "isc__mempool_setfreemax" },
+	{ (void *)0x00000000001fd690, "isc_mempool_getfreemax" },
+	{ (void *)0x00000000001fd750, "isc_mempool_getfreecount" },
+	{ (void *)0x00000000001fd810, "isc__mempool_setmaxalloc" },
+	{ (void *)0x00000000001fd900, "isc_mempool_getmaxalloc" },
+	{ (void *)0x00000000001fd9c0, "isc__mempool_getallocated" },
+	{ (void *)0x00000000001fda80, "isc__mempool_setfillcount" },
+	{ (void *)0x00000000001fdb70, "isc_mempool_getfillcount" },
+	{ (void *)0x00000000001fdc30, "initialize_action" },
+	{ (void *)0x00000000001fdd00, "default_memfree" },
+	{ (void *)0x00000000001fdd10, "delete_trace_entry" },
+	{ (void *)0x00000000001fdf80, "isc_mem_ondestroy" },
+	{ (void *)0x00000000001fe010, "add_trace_entry" },
+	{ (void *)0x00000000001fe230, "default_memalloc" },
+	{ (void *)0x00000000001fe250, "isc_mem_setname" },
+	{ (void *)0x00000000001fe330, "isc__mempool_setname" },
+	{ (void *)0x00000000001fe410, "mem_putstats.part.0" },
+	{ (void *)0x00000000001fe440, "isc__mem_isovermem.part.0" },
+	{ (void *)0x00000000001fe460, "isc__mem_isovermem" },
+	{ (void *)0x00000000001fe480, "isc_mem_getname" },
+	{ (void *)0x00000000001fe4c0, "isc_mem_gettag" },
+	{ (void *)0x00000000001fe4f0, "isc__mempool_associatelock" },
+	{ (void *)0x00000000001fe570, "mem_put.part.0" },
+	{ (void *)0x00000000001fe5a0, "cache_release" },
+	{ (void *)0x00000000001fe630, "cache_put" },
+	{ (void *)0x00000000001feba0, "print_active.part.0" },
+	{ (void *)0x00000000001fecc0, "isc_mem_stats" },
+	{ (void *)0x00000000001ff020, "isc__mem_inuse" },
+	{ (void *)0x00000000001ff140, "more_basic_blocks" },
+	{ (void *)0x00000000001ff5c0, "mem_getunlocked" },
+	{ (void *)0x00000000001ff810, "mem_putunlocked" },
+	{ (void *)0x00000000001ff9b0, "isc___mempool_put" },
+	{ (void *)0x00000000001ffd30, "destroy" },
+	{ (void *)0x0000000000200470, "isc__mem_detach" },
+	{ (void *)0x00000000002005d0, "isc__mem_destroy" },
+	{ (void *)0x0000000000200720, "mem_allocateunlocked" },
+	{ (void *)0x00000000002007c0, "isc___mempool_get" },
+	{ (void *)0x0000000000200bd0, "cache_get" },
+	{ (void *)0x00000000002011a0, "isc___mem_allocate" },
+	{ (void *)0x0000000000201580, "isc___mem_free" },
+	{ (void *)0x00000000002018f0, "isc_mem_createx2" },
+	{ (void *)0x0000000000201e70, "isc_mem_createx" },
+	{ (void *)0x0000000000201e80, "isc_mem_create" },
+	{ (void *)0x0000000000201f90, "isc_mem_create2" },
+	{ (void *)0x0000000000201fc0, "isc_mem_sethugepages" },
+	{ (void *)0x00000000002020d0, "isc_mem_setnode" },
+	{ (void *)0x0000000000202200, "isc_mem_nodesize" },
+	{ (void *)0x00000000002022c0, "isc_mem_hugepages" },
+	{ (void *)0x0000000000202380, "isc__mem_printactive" },
+	{ (void *)0x00000000002023f0, "isc_mem_printallactive" },
+	{ (void *)0x0000000000202500, "isc_mem_checkdestroyed" },
+	{ (void *)0x0000000000202610, "isc_mem_references" },
+	{ (void *)0x00000000002026d0, "isc_mem_summary" },
+	{ (void *)0x0000000000202930, "isc_mem_register" },
+	{ (void *)0x00000000002029f0, "isc__mem_register" },
+	{ (void *)0x0000000000202a00, "isc__mem_create2" },
+	{ (void *)0x0000000000202ac0, "isc_mem_attach" },
+	{ (void *)0x0000000000202b60, "isc_mem_detach" },
+	{ (void *)0x0000000000202be0, "isc_mem_destroy" },
+	{ (void *)0x0000000000202c60, "isc_mem_setdestroycheck" },
+	{ (void *)0x0000000000202c90, "isc_mem_setwater" },
+	{ (void *)0x0000000000202cd0, "isc_mem_waterack" },
+	{ (void *)0x0000000000202d10, "isc_mem_inuse" },
+	{ (void *)0x0000000000202d50, "isc_mem_maxinuse" },
+	{ (void *)0x0000000000202d90, "isc_mem_total" },
+	{ (void *)0x0000000000202dd0, "isc_mem_isovermem" },
+	{ (void *)0x0000000000202e30, "isc_mempool_create" },
+	{ (void *)0x0000000000202e70, "isc_mempool_getallocated" },
+	{ (void *)0x0000000000202eb0, "isc_mempool_setmaxalloc" },
+	{ (void *)0x0000000000202ef0, "isc_mempool_setfreemax" },
+	{ (void *)0x0000000000202f30, "isc_mempool_setname" },
+	{ (void *)0x0000000000202f70, "isc_mempool_associatelock" },
+	{ (void *)0x0000000000202fb0, "isc_mempool_setfillcount" },
+	{ (void *)0x0000000000202ff0, "isc__mem_allocate" },
+	{ (void *)0x0000000000203030, "isc___mem_get" },
+	{ (void *)0x0000000000203440, "isc__mem_get" },
+	{ (void *)0x0000000000203480, "isc__mempool_create" },
+	{ (void *)0x0000000000203640, "isc___mem_strdup" },
+	{ (void *)0x00000000002036e0, "isc__mem_strdup" },
+	{ (void *)0x0000000000203720, "isc__mem_free" },
+	{ (void *)0x0000000000203760, "isc___mem_putanddetach" },
+	{ (void *)0x0000000000203b20, "isc__mem_putanddetach" },
+	{ (void *)0x0000000000203b80, "isc___mem_put" },
+	{ (void *)0x0000000000203ef0, "isc__mem_put" },
+	{ (void *)0x0000000000203f30, "isc__mempool_destroy" },
+	{ (void *)0x00000000002043c0, "isc_mempool_destroy" },
+	{ (void *)0x0000000000204440, "isc___mem_reallocate" },
+	{ (void *)0x0000000000204560, "isc__mem_reallocate" },
+	{ (void *)0x00000000002045a0, "isc__mempool_get" },
+	{ (void *)0x00000000002045e0, "isc__mempool_put" },
+	{ (void *)0x0000000000204620, "isc_mutexblock_init" },
+	{ (void *)0x00000000002046e0, "isc_mutexblock_destroy" },
+	{ (void *)0x0000000000204740, "isc_netaddr_equal" },
+	{ (void *)0x00000000002047e0, "isc_netaddr_eqprefix" },
+	{ (void *)0x0000000000204900, "isc_netaddr_totext" },
+	{ (void *)0x0000000000204a60, "isc_netaddr_format" },
+	{ (void *)0x0000000000204b00, "isc_netaddr_prefixok" },
+	{ (void *)0x0000000000204ba0, "isc_netaddr_masktoprefixlen" },
+	{ (void *)0x0000000000204c70, "isc_netaddr_fromin" },
+	{ (void *)0x0000000000204cb0, "isc_netaddr_fromin6" },
+	{ (void *)0x0000000000204cf0, "isc_netaddr_frompath" },
+	{ (void *)0x0000000000204d60, "isc_netaddr_setzone" },
+	{ (void *)0x0000000000204d90, "isc_netaddr_getzone" },
+	{ (void *)0x0000000000204da0, "isc_netaddr_fromsockaddr" },
+	{ (void *)0x0000000000204e20, "isc_netaddr_any" },
+	{ (void *)0x0000000000204e60, "isc_netaddr_any6" },
+	{ (void *)0x0000000000204ea0, "isc_netaddr_ismulticast" },
+	{ (void *)0x0000000000204ee0, "isc_netaddr_isexperimental" },
+	{ (void *)0x0000000000204f10, "isc_netaddr_islinklocal" },
+	{ (void *)0x0000000000204f40, "isc_netaddr_issitelocal" },
+	{ (void *)0x0000000000204f70, "isc_netaddr_fromv4mapped" },
+	{ (void *)0x0000000000205000, "isc_netscope_pton" },
+	{ (void *)0x0000000000205080, "alloc_pool.constprop.0" },
+	{ (void *)0x0000000000205150, "isc_pool_get" },
+	{ (void *)0x0000000000205180, "isc_pool_count" },
+	{ (void *)0x00000000002051b0, "isc_pool_destroy" },
+	{ (void *)0x0000000000205250, "isc_pool_create" },
+	{ (void *)0x0000000000205330, "isc_pool_expand" },
+	{ (void *)0x00000000002054d0, "isc_ondestroy_init" },
+	{ (void *)0x00000000002054e0, "isc_ondestroy_register" },
+	{ (void *)0x00000000002055d0, "isc_ondestroy_notify" },
+	{ (void *)0x0000000000205730, "isc_parse_uint32" },
+	{ (void *)0x00000000002057b0, "isc_parse_uint16" },
+	{ (void *)0x00000000002057f0, "isc_parse_uint8" },
+	{ (void *)0x0000000000205830, "isc_portset_create" },
+	{ (void *)0x00000000002058a0, "isc_portset_destroy" },
+	{ (void *)0x00000000002058e0, "isc_portset_isset" },
+	{ (void *)0x0000000000205920, "isc_portset_nports" },
+	{ (void *)0x0000000000205950, "isc_portset_add" },
+	{ (void *)0x00000000002059a0, "isc_portset_remove" },
+	{ (void *)0x00000000002059d0, "isc_portset_addrange" },
+	{ (void *)0x0000000000205a60, "isc_portset_removerange" },
+	{ (void *)0x0000000000205af0, "isc_quota_init" },
+	{ (void *)0x0000000000205b10, "isc_quota_destroy" },
+	{ (void *)0x0000000000205b80, "isc_quota_soft" },
+	{ (void *)0x0000000000205c00, "isc_quota_max" },
+	{ (void *)0x0000000000205c80, "isc_quota_reserve" },
+	{ (void *)0x0000000000205d30, "isc_quota_release" },
+	{ (void *)0x0000000000205dc0, "isc_quota_attach" },
+	{ (void *)0x0000000000205e20, "isc_quota_detach" },
+	{ (void *)0x0000000000205e60, "_ref_prefix" },
+	{ (void *)0x0000000000205ff0, "_deref_prefix" },
+	{ (void *)0x0000000000206080, "_clear_radix" },
+	{ (void *)0x0000000000206210, "isc_radix_create" },
+	{ (void *)0x00000000002062d0, "isc_radix_destroy" },
+	{ (void *)0x0000000000206320, "isc_radix_process" },
+	{ (void *)0x00000000002063f0, "isc_radix_search" },
+	{ (void *)0x0000000000206650, "isc_radix_insert" },
+	{ (void *)0x00000000002070c0, "isc_radix_remove" },
+	{ (void *)0x0000000000207360, "initialize_rand" },
+	{ (void *)0x0000000000207380, "isc_random_seed" },
+	{ (void *)0x00000000002073d0, "isc_random_get" },
+	{ (void *)0x0000000000207460, "isc_random_jitter" },
+	{ (void *)0x00000000002074c0, "ratelimiter_tick" },
+	{ (void *)0x0000000000207710, "isc_ratelimiter_create" },
+	{ (void *)0x00000000002078f0, "isc_ratelimiter_setinterval" },
+	{ (void *)0x00000000002079a0, "isc_ratelimiter_setpertic" },
+	{ (void *)0x00000000002079b0, "isc_ratelimiter_enqueue" },
+	{ (void *)0x0000000000207bb0, "isc_ratelimiter_shutdown" },
+	{ (void *)0x0000000000207db0, "isc_ratelimiter_attach" },
+	{ (void *)0x0000000000207e90, "isc_ratelimiter_detach" },
+	{ (void *)0x0000000000207fd0, "ratelimiter_shutdowncomplete" },
+	{ (void *)0x0000000000207ff0, "isc_ratelimiter_stall" },
+	{ (void *)0x00000000002080e0, "isc_ratelimiter_release" },
+	{ (void *)0x00000000002081a0, "isc_refcount_init" },
+	{ (void *)0x00000000002081d0, "isc_region_compare" },
+	{ (void *)0x0000000000208260, "isc_regex_validate" },
+	{ (void *)0x0000000000208af0, "register_table" },
+	{ (void *)0x0000000000208c70, "initialize_action" },
+	{ (void *)0x0000000000208d30, "isc_result_totext" },
+	{ (void *)0x0000000000208e70, "isc_result_register" },
+	{ (void *)0x0000000000208ee0, "isc_rwlock_init" },
+	{ (void *)0x00000000002090b0, "isc_rwlock_destroy" },
+	{ (void *)0x0000000000209160, "isc_rwlock_lock" },
+	{ (void *)0x0000000000209520, "isc_rwlock_trylock" },
+	{ (void *)0x0000000000209640, "isc_rwlock_tryupgrade" },
+	{ (void *)0x00000000002096c0, "isc_rwlock_downgrade" },
+	{ (void *)0x00000000002097e0, "isc_rwlock_unlock" },
+	{ (void *)0x0000000000209a77, "isc_safe_memcmp" },
+	{ (void *)0x0000000000209af0, "isc_serial_lt" },
+	{ (void *)0x0000000000209b10, "isc_serial_gt" },
+	{ (void *)0x0000000000209b20, "isc_serial_le" },
+	{ (void *)0x0000000000209b50, "isc_serial_ge" },
+	{ (void *)0x0000000000209b70, "isc_serial_eq" },
+	{ (void *)0x0000000000209b80, "isc_serial_ne" },
+	{ (void *)0x0000000000209b90, "transform" },
+	{ (void *)0x000000000020ae70, "isc_sha1_init" },
+	{ (void *)0x000000000020aec0, "isc_sha1_invalidate" },
+	{ (void *)0x000000000020aef0, "isc_sha1_update" },
+	{ (void *)0x000000000020b030, "isc_sha1_final" },
+	{ (void *)0x000000000020b180, "isc_sha224_init" },
+	{ (void *)0x000000000020b1c0, "isc_sha224_invalidate" },
+	{ (void *)0x000000000020b1f0, "isc_sha256_init" },
+	{ (void *)0x000000000020b230, "isc_sha256_invalidate" },
+	{ (void *)0x000000000020b260, "isc_sha256_transform" },
+	{ (void *)0x000000000020b4c0, "isc_sha256_update" },
+	{ (void *)0x000000000020b640, "isc_sha224_update" },
+	{ (void *)0x000000000020b650, "isc_sha256_final" },
+	{ (void *)0x000000000020b830, "isc_sha224_final" },
+	{ (void *)0x000000000020b860, "isc_sha512_init" },
+	{ (void *)0x000000000020b8d0, "isc_sha512_invalidate" },
+	{ (void *)0x000000000020b900, "isc_sha512_transform" },
+	{ (void *)0x000000000020bb70, "isc_sha512_update" },
+	{ (void *)0x000000000020bd10, "isc_sha512_last" },
+	{ (void *)0x000000000020bf20, "isc_sha512_final" },
+	{ (void *)0x000000000020bfb0, "isc_sha384_init" },
+	{ (void *)0x000000000020c020, "isc_sha384_invalidate" },
+	{ (void *)0x000000000020c050, "isc_sha384_update" },
+	{ (void *)0x000000000020c060, "isc_sha384_final" },
+	{ (void *)0x000000000020c0f0, "isc_sha224_end" },
+	{ (void *)0x000000000020c1c0, "isc_sha224_data" },
+	{ (void *)0x000000000020c230, "isc_sha256_end" },
+	{ (void *)0x000000000020c6e0, "isc_sha256_data" },
+	{ (void *)0x000000000020c750, "isc_sha512_end" },
+	{ (void *)0x000000000020cc00, "isc_sha512_data" },
+	{ (void *)0x000000000020cc90, "isc_sha384_end" },
+	{ (void *)0x000000000020d140, "isc_sha384_data" },
+	{ (void *)0x000000000020d1d0, "isc_sockaddr_compare" },
+	{ (void *)0x000000000020d2c0, "isc_sockaddr_equal" },
+	{ (void *)0x000000000020d2d0, "isc_sockaddr_eqaddr" },
+	{ (void *)0x000000000020d2e0, "isc_sockaddr_eqaddrprefix" },
+	{ (void *)0x000000000020d330, "isc_sockaddr_totext" },
+	{ (void *)0x000000000020d470, "isc_sockaddr_format" },
+	{ (void *)0x000000000020d500, "isc_sockaddr_hash" },
+	{ (void *)0x000000000020d640, "isc_sockaddr_any" },
+	{ (void *)0x000000000020d690, "isc_sockaddr_any6" },
+	{ (void *)0x000000000020d6e0, "isc_sockaddr_fromin" },
+	{ (void *)0x000000000020d750, "isc_sockaddr_anyofpf" },
+	{ (void *)0x000000000020d820, "isc_sockaddr_fromin6" },
+	{ (void *)0x000000000020d890, "isc_sockaddr_v6fromin" },
+	{ (void *)0x000000000020d900, "isc_sockaddr_pf" },
+	{ (void *)0x000000000020d910, "isc_sockaddr_fromnetaddr" },
+	{ (void *)0x000000000020d9e0, "isc_sockaddr_setport" },
+	{ (void *)0x000000000020da30, "isc_sockaddr_getport" },
+	{ (void *)0x000000000020da80, "isc_sockaddr_ismulticast" },
+	{ (void *)0x000000000020dac0, "isc_sockaddr_isexperimental" },
+	{ (void *)0x000000000020db00, "isc_sockaddr_issitelocal" },
+	{ (void *)0x000000000020db40, "isc_sockaddr_islinklocal" },
+	{ (void *)0x000000000020db80, "isc_sockaddr_frompath" },
+	{ (void *)0x000000000020dc00, "initialize_action" },
+	{ (void *)0x000000000020dc90, "create_shard" },
+	{ (void *)0x000000000020dd40, "getshard" },
+	{ (void *)0x000000000020def0, "isc_stats_setthreads" },
+	{ (void *)0x000000000020dfa0, "isc_stats_attach" },
+	{ (void *)0x000000000020e080, "isc_stats_detach" },
+	{ (void *)0x000000000020e260, "isc_stats_ncounters" },
+	{ (void *)0x000000000020e290, "isc_stats_create" },
+	{ (void *)0x000000000020e590, "isc_stats_increment" },
+	{ (void *)0x000000000020e620, "isc_stats_add" },
+	{ (void *)0x000000000020e6b0, "isc_stats_decrement" },
+	{ (void *)0x000000000020e740, "isc_stats_dump" },
+	{ (void *)0x000000000020e8c0, "isc_stats_set" },
+	{ (void *)0x000000000020ea10, "isc_string_touint64" },
+	{ (void *)0x000000000020eb90, "isc_string_printf" },
+	{ (void *)0x000000000020ecb0, "isc_string_printf_truncate" },
+	{ (void *)0x000000000020eda0, "isc_string_regiondup" },
+	{ (void *)0x000000000020ee30, "isc_string_separate" },
+	{ (void *)0x000000000020eeb0, "isc_string_strlcpy" },
+	{ (void *)0x000000000020ef00, "isc_string_copy" },
+	{ (void *)0x000000000020ef80, "isc_string_copy_truncate" },
+	{ (void *)0x000000000020efe0, "isc_string_strlcat" },
+	{ (void *)0x000000000020f060, "isc_string_append" },
+	{ (void *)0x000000000020f120, "isc_string_append_truncate" },
+	{ (void *)0x000000000020f1b0, "isc_string_strcasestr" },
+	{ (void *)0x000000000020f240, "isc_symtab_create" },
+	{ (void *)0x000000000020f400, "isc_symtab_destroy" },
+	{ (void *)0x000000000020f550, "isc_symtab_lookup" },
+	{ (void *)0x000000000020f6f0, "isc_symtab_define" },
+	{ (void *)0x000000000020fdb0, "isc_symtab_undefine" },
+	{ (void *)0x0000000000210070, "isc_symtab_count" },
+	{ (void *)0x00000000002100a0, "task_shutdown" },
+	{ (void *)0x0000000000210280, "isc__task_attach" },
+	{ (void *)0x0000000000210360, "dequeue_events" },
+	{ (void *)0x00000000002105d0, "isc__task_unsendrange" },
+	{ (void *)0x00000000002105e0, "isc__task_unsend" },
+	{ (void *)0x0000000000210600, "isc__task_getcurrenttime" },
+	{ (void *)0x00000000002106c0, "isc__task_setprivilege" },
+	{ (void *)0x0000000000210950, "isc__task_create" },
+	{ (void *)0x0000000000210c30, "isc__task_purgerange" },
+	{ (void *)0x0000000000210ca0, "isc_task_purgeevent" },
+	{ (void *)0x0000000000210eb0, "isc__task_onshutdown" },
+	{ (void *)0x0000000000211080, "isc__task_setname" },
+	{ (void *)0x0000000000211160, "destroy_queues" },
+	{ (void *)0x0000000000211240, "manager_free" },
+	{ (void *)0x0000000000211300, "isc__taskmgr_create" },
+	{ (void *)0x0000000000211880, "task_detach.part.0" },
+	{ (void *)0x00000000002118b0, "task_send.part.0" },
+	{ (void *)0x00000000002118e0, "isc__task_getname" },
+	{ (void *)0x0000000000211910, "isc__task_gettag" },
+	{ (void *)0x0000000000211940, "initialize" },
+	{ (void *)0x0000000000211980, "isc_taskmgr_excltask" },
+	{ (void *)0x0000000000211a00, "isc__taskmgr_mode" },
+	{ (void *)0x0000000000211a80, "isc__task_privilege" },
+	{ (void *)0x0000000000211b10, "initialize_workerkey" },
+	{ (void *)0x0000000000211b50, "isc__task_destroy.part.0" },
+	{ (void *)0x0000000000211b70, "pop_readyq.isra.0" },
+	{ (void *)0x0000000000211dd0, "task_ready" },
+	{ (void *)0x0000000000212100, "isc__task_detach" },
+	{ (void *)0x0000000000212270, "isc_taskmgr_setexcltask" },
+	{ (void *)0x0000000000212300, "isc__task_sendanddetach" },
+	{ (void *)0x00000000002125c0, "isc__task_shutdown" },
+	{ (void *)0x0000000000212680, "isc__task_purge" },
+	{ (void *)0x00000000002126f0, "isc__task_send" },
+	{ (void *)0x00000000002128e0, "run" },
+	{ (void *)0x0000000000213ca0, "isc__taskmgr_setmode" },
+	{ (void *)0x0000000000213e80, "isc__task_endexclusive" },
+	{ (void *)0x0000000000214090, "isc__task_beginexclusive" },
+	{ (void *)0x00000000002143c0, "isc__taskmgr_destroy" },
+	{ (void *)0x0000000000214980, "isc__taskmgr_pause" },
+	{ (void *)0x0000000000214c60, "isc__taskmgr_resume" },
+	{ (void *)0x0000000000214e20, "isc_taskmgr_setaffinity" },
+	{ (void *)0x0000000000214ed0, "isc_taskmgr_currentworker" },
+	{ (void *)0x0000000000214f20, "isc_task_sethome" },
+	{ (void *)0x0000000000214ff0, "isc_task_exiting" },
+	{ (void *)0x0000000000215020, "isc_task_register" },
+	{ (void *)0x00000000002150e0, "isc__task_register" },
+	{ (void *)0x00000000002150f0, "isc_taskmgr_createinctx" },
+	{ (void *)0x00000000002151d0, "isc_taskmgr_create" },
+	{ (void *)0x00000000002152b0, "isc_taskmgr_destroy" },
+	{ (void *)0x0000000000215330, "isc_taskmgr_setmode" },
+	{ (void *)0x0000000000215370, "isc_taskmgr_mode" },
+	{ (void *)0x00000000002153b0, "isc_task_create" },
+	{ (void *)0x0000000000215430, "isc_task_attach" },
+	{ (void *)0x00000000002154d0, "isc_task_detach" },
+	{ (void *)0x0000000000215550, "isc_task_send" },
+	{ (void *)0x00000000002155f0, "isc_task_sendanddetach" },
+	{ (void *)0x00000000002156c0, "isc_task_unsend" },
+	{ (void *)0x0000000000215730, "isc_task_onshutdown" },
+	{ (void *)0x0000000000215770, "isc_task_shutdown" },
+	{ (void *)0x00000000002157b0, "isc__task_destroy" },
+	{ (void *)0x00000000002157d0, "isc_task_destroy" },
+	{ (void *)0x0000000000215800, "isc_task_setname" },
+	{ (void *)0x0000000000215840, "isc_task_purge" },
+	{ (void *)0x0000000000215900, "isc_task_beginexclusive" },
+	{ (void *)0x0000000000215940, "isc_task_endexclusive" },
+	{ (void *)0x0000000000215980, "isc_task_setprivilege" },
+	{ (void *)0x00000000002159c0, "isc_task_privilege" },
+	{ (void *)0x0000000000215a00, "isc_task_getcurrenttime" },
+	{ (void *)0x0000000000215a20, "isc_task_purgerange" },
+	{ (void *)0x0000000000215ae0, "alloc_pool.constprop.0" },
+	{ (void *)0x0000000000215be0, "isc_taskpool_gettask" },
+	{ (void *)0x0000000000215c20, "isc_taskpool_size" },
+	{ (void *)0x0000000000215c50, "isc_taskpool_destroy" },
+	{ (void *)0x0000000000215cf0, "isc_taskpool_create" },
+	{ (void *)0x0000000000215dd0, "isc_taskpool_expand" },
+	{ (void *)0x0000000000215f80, "isc_taskpool_setprivilege" },
+	{ (void *)0x0000000000215fe0, "wheel_next" },
+	{ (void *)0x00000000002160a0, "isc_timer_gettype" },
+	{ (void *)0x0000000000216150, "isc__timer_touch" },
+	{ (void *)0x0000000000216240, "isc__timer_attach" },
+	{ (void *)0x0000000000216320, "initialize" },
+	{ (void *)0x0000000000216360, "isc_timermgr_poke" },
+	{ (void *)0x00000000002163c0, "wakeup.constprop.0" },
+	{ (void *)0x0000000000216470, "isc__timermgr_destroy" },
+	{ (void *)0x0000000000216770, "isc__timer_detach" },
+	{ (void *)0x0000000000216c50, "schedule" },
+	{ (void *)0x00000000002171b0, "isc__timer_create" },
+	{ (void *)0x0000000000217740, "isc__timer_reset" },
+	{ (void *)0x0000000000217c70, "dispatch" },
+	{ (void *)0x0000000000218850, "run" },
+	{ (void *)0x00000000002189e0, "isc__timermgr_create" },
+	{ (void *)0x0000000000218ec0, "isc__timermgr_dispatchat" },
+	{ (void *)0x0000000000218f70, "isc_timer_register" },
+	{ (void *)0x0000000000219030, "isc__timer_register" },
+	{ (void *)0x0000000000219040, "isc_timermgr_createinctx" },
+	{ (void *)0x0000000000219120, "isc_timermgr_create" },
+	{ (void *)0x00000000002191e0, "isc_timermgr_destroy" },
+	{ (void *)0x0000000000219250, "isc_timer_create" },
+	{ (void *)0x0000000000219290, "isc_timer_attach" },
+	{ (void *)0x0000000000219330, "isc_timer_detach" },
+	{ (void *)0x00000000002193b0, "isc_timer_reset" },
+	{ (void *)0x00000000002193f0, "isc_timer_touch" },
+	{ (void *)0x0000000000219430, "exit_action" },
+	{ (void *)0x0000000000219440, "reload_action" },
+	{ (void *)0x0000000000219450, "isc__app_block" },
+	{ (void *)0x0000000000219550, "isc__app_unblock" },
+	{ (void *)0x0000000000219670, "isc__app_ctxonrun" },
+	{ (void *)0x00000000002197a0, "isc__app_ctxshutdown" },
+	{ (void *)0x00000000002199e0, "isc__app_shutdown" },
+	{ (void *)0x00000000002199f0, "isc__app_ctxsuspend" },
+	{ (void *)0x0000000000219c10, "isc__app_reload" },
+	{ (void *)0x0000000000219c20, "isc__appctx_create" },
+	{ (void *)0x0000000000219ce0, "isc__appctx_settaskmgr.part.0" },
+	{ (void *)0x0000000000219d00, "isc__appctx_settaskmgr" },
+	{ (void *)0x0000000000219d20, "isc__appctx_setsocketmgr.part.0" },
+	{ (void *)0x0000000000219d40, "isc__appctx_setsocketmgr" },
+	{ (void *)0x0000000000219d60, "isc__appctx_settimermgr.part.0" },
+	{ (void *)0x0000000000219d80, "isc__appctx_settimermgr" },
+	{ (void *)0x0000000000219da0, "handle_signal" },
+	{ (void *)0x0000000000219e60, "isc__app_ctxstart" },
+	{ (void *)0x000000000021a070, "isc__app_start" },
+	{ (void *)0x000000000021a0b0, "isc__app_ctxrun" },
+	{ (void *)0x000000000021a490, "isc__app_run" },
+	{ (void *)0x000000000021a4a0, "isc__app_ctxfinish" },
+	{ (void *)0x000000000021a500, "initialize" },
+	{ (void *)0x000000000021a540, "isc__appctx_destroy" },
+	{ (void *)0x000000000021a5c0, "isc__app_finish" },
+	{ (void *)0x000000000021a620, "isc__app_onrun" },
+	{ (void *)0x000000000021a640, "isc_app_register" },
+	{ (void *)0x000000000021a700, "isc__app_register" },
+	{ (void *)0x000000000021a710, "isc_appctx_create" },
+	{ (void *)0x000000000021a7d0, "isc_appctx_destroy" },
+	{ (void *)0x000000000021a850, "isc_app_ctxstart" },
+	{ (void *)0x000000000021a890, "isc_app_ctxrun" },
+	{ (void *)0x000000000021a8d0, "isc_app_ctxonrun" },
+	{ (void *)0x000000000021a910, "isc_app_ctxsuspend" },
+	{ (void *)0x000000000021a950, "isc_app_ctxshutdown" },
+	{ (void *)0x000000000021a990, "isc_app_ctxfinish" },
+	{ (void *)0x000000000021aa00, "isc_appctx_settaskmgr" },
+	{ (void *)0x000000000021aa80, "isc_appctx_setsocketmgr" },
+	{ (void *)0x000000000021ab00, "isc_appctx_settimermgr" },
+	{ (void *)0x000000000021ab80, "isc_app_start" },
+	{ (void *)0x000000000021abd0, "isc_app_onrun" },
+	{ (void *)0x000000000021ac00, "isc_app_run" },
+	{ (void *)0x000000000021ac20, "isc_app_shutdown" },
+	{ (void *)0x000000000021ac40, "isc_app_reload" },
+	{ (void *)0x000000000021ac60, "isc_app_finish" },
+	{ (void *)0x000000000021acd0, "isc_app_block" },
+	{ (void *)0x000000000021acf0, "isc_app_unblock" },
+	{ (void *)0x000000000021ad10, "isc_dir_init" },
+	{ (void *)0x000000000021ad60, "isc_dir_open" },
+	{ (void *)0x000000000021aed0, "isc_dir_read" },
+	{ (void *)0x000000000021aff0, "isc_dir_close" },
+	{ (void *)0x000000000021b040, "isc_dir_reset" },
+	{ (void *)0x000000000021b090, "isc_dir_chdir" },
+	{ (void *)0x000000000021b0f0, "isc_dir_chroot" },
+	{ (void *)0x000000000021b160, "isc_dir_createunique" },
+	{ (void *)0x000000000021b2d0, "samplequeue_release" },
+	{ (void *)0x000000000021b370, "destroysource" },
+	{ (void *)0x000000000021b5c0, "samplesource_allocate" },
+	{ (void *)0x000000000021b650, "destroy" },
+	{ (void *)0x000000000021b830, "kbdstop" },
+	{ (void *)0x000000000021b880, "kbdstart" },
+	{ (void *)0x000000000021b900, "entropypool_adddata" },
+	{ (void *)0x000000000021bbd0, "crunchsamples" },
+	{ (void *)0x000000000021bd50, "fillpool" },
+	{ (void *)0x000000000021c710, "isc_entropy_getdata" },
+	{ (void *)0x000000000021cb60, "isc_entropy_create" },
+	{ (void *)0x000000000021ccd0, "isc_entropy_destroysource" },
+	{ (void *)0x000000000021ce50, "isc_entropy_createcallbacksource" },
+	{ (void *)0x000000000021d0b0, "isc_entropy_stopcallbacksources" },
+	{ (void *)0x000000000021d1b0, "isc_entropy_createsamplesource" },
+	{ (void *)0x000000000021d390, "isc_entropy_addsample" },
+	{ (void *)0x000000000021d4c0, "isc_entropy_addcallbacksample" },
+	{ (void *)0x000000000021d560, "kbdget" },
+	{ (void *)0x000000000021d630, "isc_entropy_putdata" },
+	{ (void *)0x000000000021d710, "isc_entropy_stats" },
+	{ (void *)0x000000000021d860, "isc_entropy_status" },
+	{ (void *)0x000000000021d8e0, "isc_entropy_attach" },
+	{ (void *)0x000000000021d9b0, "isc_entropy_detach" },
+	{ (void *)0x000000000021db00, "isc_entropy_createfilesource" },
+	{ (void *)0x000000000021df10, "isc_entropy_usebestsource" },
+	{ (void *)0x000000000021e080, "isc___errno2result" },
+	{ (void *)0x000000000021e1b0, "isc_file_openuniquemode.part.0" },
+	{ (void *)0x000000000021e380, "isc_file_iscurrentdir.part.0" },
+	{ (void *)0x000000000021e3a0, "isc_file_basename.part.0" },
+	{ (void *)0x000000000021e3c0, "isc_file_getsizefd" },
+	{ (void *)0x000000000021e430, "isc_file_mode" },
+	{ (void *)0x000000000021e4d0, "isc_file_getmodtime" },
+	{ (void *)0x000000000021e570, "isc_file_getsize" },
+	{ (void *)0x000000000021e610, "isc_file_settime" },
+	{ (void *)0x000000000021e6c0, "isc_file_template" },
+	{ (void *)0x000000000021e7e0, "isc_file_mktemplate" },
+	{ (void *)0x000000000021e800, "isc_file_renameunique" },
+	{ (void *)0x000000000021e9a0, "isc_file_openunique" },
+	{ (void *)0x000000000021ea00, "isc_file_openuniqueprivate" },
+	{ (void *)0x000000000021ea60, "isc_file_openuniquemode" },
+	{ (void *)0x000000000021eac0, "isc_file_bopenunique" },
+	{ (void *)0x000000000021eb20, "isc_file_bopenuniqueprivate" },
+	{ (void *)0x000000000021eb80, "isc_file_bopenuniquemode" },
+	{ (void *)0x000000000021ebe0, "isc_file_remove" },
+	{ (void *)0x000000000021ec40, "isc_file_rename" },
+	{ (void *)0x000000000021ecb0, "isc_file_exists" },
+	{ (void *)0x000000000021ed30, "isc_file_isplainfile" },
+	{ (void *)0x000000000021eda0, "isc_file_isplainfilefd" },
+	{ (void *)0x000000000021ee10, "isc_file_isdirectory" },
+	{ (void *)0x000000000021ee80, "isc_file_isabsolute" },
+	{ (void *)0x000000000021eeb0, "isc_file_iscurrentdir" },
+	{ (void *)0x000000000021eed0, "isc_file_ischdiridempotent" },
+	{ (void *)0x000000000021ef20, "isc_file_basename" },
+	{ (void *)0x000000000021ef50, "isc_file_progname" },
+	{ (void *)0x000000000021efe0, "isc_file_absolutepath" },
+	{ (void *)0x000000000021f0f0, "isc_file_truncate" },
+	{ (void *)0x000000000021f130, "isc_file_safecreate" },
+	{ (void *)0x000000000021f280, "isc_file_splitpath" },
+	{ (void *)0x000000000021f3d0, "isc_file_mmap" },
+	{ (void *)0x000000000021f3e0, "isc_file_munmap" },
+	{ (void *)0x000000000021f3f0, "isc_fsaccess_add" },
+	{ (void *)0x000000000021f460, "isc_fsaccess_remove" },
+	{ (void *)0x000000000021f4e0, "isc_fsaccess_set" },
+	{ (void *)0x000000000021f680, "get_addr" },
+	{ (void *)0x000000000021f750, "internal_current" },
+	{ (void *)0x000000000021fb60, "isc_interfaceiter_create" },
+	{ (void *)0x000000000021fd40, "isc_interfaceiter_current" },
+	{ (void *)0x000000000021fd90, "isc_interfaceiter_first" },
+	{ (void *)0x000000000021feb0, "isc_interfaceiter_next" },
+	{ (void *)0x000000000021ff90, "isc_interfaceiter_destroy" },
+	{ (void *)0x0000000000220080, "isc_keyboard_open" },
+	{ (void *)0x0000000000220190, "isc_keyboard_close" },
+	{ (void *)0x00000000002201f0, "isc_keyboard_getchar" },
+	{ (void *)0x00000000002202a0, "isc_keyboard_canceled" },
+	{ (void *)0x00000000002202b0, "try_proto" },
+	{ (void *)0x0000000000220410, "initialize_action" },
+	{ (void *)0x0000000000220450, "try_ipv6pktinfo" },
+	{ (void *)0x0000000000220580, "cmsgsend.isra.0" },
+	{ (void *)0x00000000002208e0, "try_dscp" },
+	{ (void *)0x0000000000220c20, "try_ipv6only" },
+	{ (void *)0x0000000000220e30, "isc_net_probeipv4" },
+	{ (void *)0x0000000000220e90, "isc_net_probeipv6" },
+	{ (void *)0x0000000000220ef0, "isc_net_probeunix" },
+	{ (void *)0x0000000000220f50, "isc_net_probe_ipv6only" },
+	{ (void *)0x0000000000220fb0, "isc_net_probe_ipv6pktinfo" },
+	{ (void *)0x0000000000221010, "isc_net_probedscp" },
+	{ (void *)0x0000000000221070, "isc_net_getudpportrange" },
+	{ (void *)0x00000000002210b0, "isc_net_disableipv4" },
+	{ (void *)0x0000000000221110, "isc_net_disableipv6" },
+	{ (void *)0x0000000000221170, "isc_net_enableipv4" },
+	{ (void *)0x00000000002211d0, "isc_net_enableipv6" },
+	{ (void *)0x0000000000221230, "isc_os_ncpus" },
+	{ (void *)0x0000000000221250, "isc_os_cpunode" },
+	{ (void *)0x0000000000221310, "isc_os_ifnode" },
+	{ (void *)0x00000000002214a0, "isc_resource_setlimit" },
+	{ (void *)0x0000000000221630, "isc_resource_getlimit" },
+	{ (void *)0x0000000000221730, "isc_resource_getcurlimit" },
+	{ (void *)0x0000000000221830, "isc__socket_getfd" },
+	{ (void *)0x0000000000221840, "isc__socket_attach" },
+	{ (void *)0x0000000000221920, "isc__socket_getpeername" },
+	{ (void *)0x0000000000221a90, "isc__socket_isbound" },
+	{ (void *)0x0000000000221b40, "get_batchcmsgbuf" },
+	{ (void *)0x0000000000221bc0, "allocate_socket" },
+	{ (void *)0x0000000000221ea0, "make_nonblock" },
+	{ (void *)0x0000000000221f20, "setdscp" },
+	{ (void *)0x0000000000222090, "isc__socket_dscp" },
+	{ (void *)0x0000000000222130, "isc__socket_ipv6only" },
+	{ (void *)0x0000000000222240, "clear_bsdcompat" },
+	{ (void *)0x00000000002222c0, "free_socket" },
+	{ (void *)0x0000000000222560, "send_recvdone_event" },
+	{ (void *)0x00000000002226b0, "send_senddone_event" },
+	{ (void *)0x0000000000222830, "build_msghdr_recv" },
+	{ (void *)0x0000000000222ac0, "allocate_socketevent" },
+	{ (void *)0x0000000000222b30, "isc__socket_cleanunix" },
+	{ (void *)0x0000000000222eb0, "isc__socket_permunix" },
+	{ (void *)0x00000000002230a0, "isc__socket_listen" },
+	{ (void *)0x0000000000223260, "isc__socket_getsockname" },
+	{ (void *)0x00000000002233c0, "destroy_socketevent" },
+	{ (void *)0x00000000002233f0, "isc__socket_filter.part.0" },
+	{ (void *)0x0000000000223410, "isc__socket_filter" },
+	{ (void *)0x0000000000223430, "isc__socket_gettype.part.0" },
+	{ (void *)0x0000000000223450, "isc__socket_gettype" },
+	{ (void *)0x0000000000223470, "initialize" },
+	{ (void *)0x00000000002234b0, "inc_stats.part.0" },
+	{ (void *)0x00000000002234d0, "isc__socket_cancel.part.0" },
+	{ (void *)0x0000000000223870, "isc__socket_cancel" },
+	{ (void *)0x00000000002238b0, "add_stats.part.0" },
+	{ (void *)0x00000000002238d0, "socket_log.constprop.0" },
+	{ (void *)0x0000000000223a60, "build_msghdr_send" },
+	{ (void *)0x0000000000224070, "complete_recv" },
+	{ (void *)0x00000000002244d0, "manager_log.constprop.0" },
+	{ (void *)0x00000000002245d0, "select_poke.isra.0" },
+	{ (void *)0x00000000002246d0, "isc__socket_accept" },
+	{ (void *)0x00000000002249f0, "isc__socket_fdwatchpoke" },
+	{ (void *)0x0000000000224b40, "isc__socket_fdwatchcreate" },
+	{ (void *)0x0000000000224e30, "cleanup_thread" },
+	{ (void *)0x0000000000224f50, "isc__socketmgr_destroy" },
+	{ (void *)0x0000000000225330, "isc__socket_bind" },
+	{ (void *)0x00000000002256f0, "closesocket" },
+	{ (void *)0x00000000002259b0, "destroy" },
+	{ (void *)0x0000000000225cb0, "isc__socket_detach" },
+	{ (void *)0x0000000000225df0, "internal_fdwatch_read" },
+	{ (void *)0x0000000000226060, "internal_fdwatch_write" },
+	{ (void *)0x00000000002262d0, "internal_connect" },
+	{ (void *)0x0000000000226770, "doio_sendbatch" },
+	{ (void *)0x0000000000226a50, "isc__socket_connect" },
+	{ (void *)0x0000000000227050, "internal_accept" },
+	{ (void *)0x0000000000227a90, "watcher" },
+	{ (void *)0x0000000000228a90, "recv_error" },
+	{ (void *)0x0000000000228bd0, "doio_recvbatch" },
+	{ (void *)0x0000000000228ec0, "doio_recv" },
+	{ (void *)0x0000000000228fe0, "internal_recv" },
+	{ (void *)0x00000000002292c0, "socket_recv" },
+	{ (void *)0x0000000000229530, "isc__socket_recvv" },
+	{ (void *)0x0000000000229840, "isc__socket_recv2" },
+	{ (void *)0x00000000002298a0, "isc__socket_recv" },
+	{ (void *)0x0000000000229a00, "opensocket" },
+	{ (void *)0x000000000022a450, "socket_create" },
+	{ (void *)0x000000000022a7a0, "isc__socket_create" },
+	{ (void *)0x000000000022a7b0, "isc__socket_dup" },
+	{ (void *)0x000000000022a820, "doio_send" },
+	{ (void *)0x000000000022aad0, "internal_send" },
+	{ (void *)0x000000000022ad40, "socket_send" },
+	{ (void *)0x000000000022b320, "isc__socket_sendto" },
+	{ (void *)0x000000000022b480, "isc__socket_send" },
+	{ (void *)0x000000000022b4a0, "isc__socket_sendto2" },
+	{ (void *)0x000000000022b560, "isc__socket_open" },
+	{ (void *)0x000000000022b740, "isc__socket_close" },
+	{ (void *)0x000000000022ba00, "isc__socketmgr_setreserved" },
+	{ (void *)0x000000000022ba30, "isc__socketmgr_maxudp" },
+	{ (void *)0x000000000022ba60, "isc_socketmgr_setaffinity" },
+	{ (void *)0x000000000022bb20, "isc__socketmgr_create2" },
+	{ (void *)0x000000000022c450, "isc__socketmgr_create" },
+	{ (void *)0x000000000022c460, "isc_socketmgr_getmaxsockets" },
+	{ (void *)0x000000000022c4c0, "isc_socketmgr_setstats" },
+	{ (void *)0x000000000022c570, "isc__socket_sendtov2" },
+	{ (void *)0x000000000022c860, "isc__socket_sendtov" },
+	{ (void *)0x000000000022c880, "isc__socket_sendv" },
+	{ (void *)0x000000000022c8a0, "isc_socket_socketevent" },
+	{ (void *)0x000000000022c910, "isc__socket_setname" },
+	{ (void *)0x000000000022c9e0, "isc__socket_getname" },
+	{ (void *)0x000000000022c9f0, "isc__socket_gettag" },
+	{ (void *)0x000000000022ca00, "isc_socket_register" },
+	{ (void *)0x000000000022cac0, "isc__socket_register" },
+	{ (void *)0x000000000022cad0, "isc_socketmgr_createinctx" },
+	{ (void *)0x000000000022cbb0, "isc_socketmgr_create" },
+	{ (void *)0x000000000022cc70, "isc_socketmgr_destroy" },
+	{ (void *)0x000000000022ccf0, "isc_socket_create" },
+	{ (void *)0x000000000022cd40, "isc_socket_attach" },
+	{ (void *)0x000000000022cde0, "isc_socket_detach" },
+	{ (void *)0x000000000022ce60, "isc_socket_bind" },
+	{ (void *)0x000000000022cea0, "isc_socket_sendto" },
+	{ (void *)0x000000000022cee0, "isc_socket_connect" },
+	{ (void *)0x000000000022cf20, "isc_socket_recv" },
+	{ (void *)0x000000000022cf60, "isc_socket_cancel" },
+	{ (void *)0x000000000022cff0, "isc_socket_getsockname" },
+	{ (void *)0x000000000022d030, "isc_socket_ipv6only" },
+	{ (void *)0x000000000022d070, "isc_socket_dscp" },
+	{ (void *)0x000000000022d0b0, "isc_socket_gettype" },
+	{ (void *)0x000000000022d110, "isc_socket_setname" },
+	{ (void *)0x000000000022d140, "isc_socket_fdwatchcreate" },
+	{ (void *)0x000000000022d180, "isc_socket_fdwatchpoke" },
+	{ (void *)0x000000000022d1c0, "isc_socket_dup" },
+	{ (void *)0x000000000022d240, "isc_socket_getfd" },
+	{ (void *)0x000000000022d280, "isc_socket_open" },
+	{ (void *)0x000000000022d290, "isc_socket_close" },
+	{ (void *)0x000000000022d2a0, "isc_socketmgr_create2" },
+	{ (void *)0x000000000022d2b0, "isc_socket_recvv" },
+	{ (void *)0x000000000022d2c0, "isc_socket_recv2" },
+	{ (void *)0x000000000022d320, "isc_socket_send" },
+	{ (void *)0x000000000022d340, "isc_socket_sendv" },
+	{ (void *)0x000000000022d360, "isc_socket_sendtov" },
+	{ (void *)0x000000000022d380, "isc_socket_sendtov2" },
+	{ (void *)0x000000000022d390, "isc_socket_sendto2" },
+	{ (void *)0x000000000022d3a0, "isc_socket_cleanunix" },
+	{ (void *)0x000000000022d3b0, "isc_socket_permunix" },
+	{ (void *)0x000000000022d3c0, "isc_socket_filter" },
+	{ (void *)0x000000000022d3e0, "isc_socket_listen" },
+	{ (void *)0x000000000022d3f0, "isc_socket_accept" },
+	{ (void *)0x000000000022d400, "isc_socket_getpeername" },
+	{ (void *)0x000000000022d410, "isc_stdio_open" },
+	{ (void *)0x000000000022d440, "isc_stdio_close" },
+	{ (void *)0x000000000022d480, "isc_stdio_seek" },
+	{ (void *)0x000000000022d4c0, "isc_stdio_tell" },
+	{ (void *)0x000000000022d520, "isc_stdio_read" },
+	{ (void *)0x000000000022d5a0, "isc_stdio_write" },
+	{ (void *)0x000000000022d610, "isc_stdio_flush" },
+	{ (void *)0x000000000022d650, "isc_stdio_sync" },
+	{ (void *)0x000000000022d6a0, "isc_stdtime_get" },
+	{ (void *)0x000000000022d7b0, "init_lock" },
+	{ (void *)0x000000000022d7f0, "isc__strerror" },
+	{ (void *)0x000000000022d930, "isc_syslog_facilityfromstring" },
+	{ (void *)0x000000000022d9f0, "isc_interval_set" },
+	{ (void *)0x000000000022da40, "isc_interval_iszero" },
+	{ (void *)0x000000000022daa0, "isc_time_set" },
+	{ (void *)0x000000000022daf0, "isc_time_settoepoch" },
+	{ (void *)0x000000000022db20, "isc_time_isepoch" },
+	{ (void *)0x000000000022db80, "isc_time_now" },
+	{ (void *)0x000000000022dca0, "isc_time_nowplusinterval" },
+	{ (void *)0x000000000022de60, "isc_time_compare" },
+	{ (void *)0x000000000022def0, "isc_time_add" },
+	{ (void *)0x000000000022dfd0, "isc_time_subtract" },
+	{ (void *)0x000000000022e090, "isc_time_microdiff" },
+	{ (void *)0x000000000022e130, "isc_time_seconds" },
+	{ (void *)0x000000000022e180, "isc_time_secondsastimet" },
+	{ (void *)0x000000000022e1e0, "isc_time_nanoseconds" },
+	{ (void *)0x000000000022e230, "isc_time_formattimestamp" },
+	{ (void *)0x000000000022e310, "isc_time_formathttptimestamp" },
+	{ (void *)0x000000000022e390, "isc_time_parsehttptimestamp" },
+	{ (void *)0x000000000022e420, "isc_time_formatISO8601" },
+	{ (void *)0x000000000022e4a0, "isc_msgcat_open" },
+	{ (void *)0x000000000022e520, "isc_msgcat_close" },
+	{ (void *)0x000000000022e5a0, "isc_msgcat_get" },
+	{ (void *)0x000000000022e650, "isc_condition_waituntil" },
+	{ (void *)0x000000000022e790, "isc__mutex_init" },
+	{ (void *)0x000000000022e850, "isc_thread_create" },
+	{ (void *)0x000000000022e8e0, "isc_thread_setconcurrency" },
+	{ (void *)0x000000000022e8f0, "isc_thread_setaffinity" },
+	{ (void *)0x000000000022e9a0, "isc_thread_yield" },
+	{ (void *)0x000000000022e9b0, "isc_bufferlist_usedcount" },
+	{ (void *)0x000000000022ea20, "isc_bufferlist_availablecount" },
+	{ (void *)0x000000000022ea90, "conv_num" },
+	{ (void *)0x000000000022eb30, "isc_tm_timegm" },
+	{ (void *)0x000000000022ec50, "isc_tm_strptime" },
+	{ (void *)0x000000000022f3ec, "_fini" },
+	{ (void *)0x0, "" },
+};
@@ -3993,6 +3993,7 @@ query_recurse(ns_client_t *client, dns_rdatatype_t qtype, dns_name_t *qname,
 		 * is shutting down will not be destroyed until all the
 		 * events have been received.
 		 */
+		client->attributes |= NS_CLIENTATTR_RECURSED;
 	} else {
 		query_putrdataset(client, &rdataset);
 		if (sigrdataset != NULL)
@@ -8235,7 +8236,8 @@ ns_query_start(ns_client_t *client) {
 	   	if( DNS_DAMPENING_STATE_SUPPRESS ==
 		    dns_dampening_query(client->view->dampening,
 					&client->peeraddr, client->now,
-					&client_penalty) ) {
+					&client_penalty,
+					&client->dampening) ) {
 		   	inc_stats(client, dns_nsstatscounter_dampened);
 			query_next(client, DNS_R_DROP);
 			return;
@@ -8288,7 +8290,8 @@ ns_query_start(ns_client_t *client) {
 	if (client->view != NULL && client->view->dampening != NULL)
 		dns_dampening_score_qtype(client->view->dampening,
 					  &client->peeraddr, client->now,
-					  client->message->id, qtype);
+					  client->message->id, qtype,
+					  &client->dampening);
 
 	if (dns_rdatatype_ismeta(qtype)) {
 		switch (qtype) {
@@ -37,6 +37,7 @@
 #include <isc/hex.h>
 #include <isc/httpd.h>
 #include <isc/lex.h>
+#include <isc/os.h>
 #include <isc/parseint.h>
 #include <isc/portset.h>
 #include <isc/print.h>
@@ -1999,7 +2000,7 @@ configure_rrl(dns_view_t *view, const cfg_obj_t *config, const cfg_obj_t *map) {
 	const cfg_obj_t *obj;
 	dns_rrl_t *rrl;
 	isc_result_t result;
-	int min_entries, i, j;
+	int min_entries, shards, i, j;
 
 	/*
 	 * Most DNS servers have few clients, but intentinally open
@@ -2015,9 +2016,27 @@ configure_rrl(dns_view_t *view, const cfg_obj_t *config, const cfg_obj_t *map) {
 		if (min_entries < 1)
 			min_entries = 1;
 	}
-	result = dns_rrl_init(&rrl, view, min_entries);
+
+	/*
+	 * One shard per worker thread lets the workers limit responses
+	 * to different clients without waiting for each other.
+	 */
+	shards = ISC_MAX(ns_g_cpus, 1);
+	obj = NULL;
+	result = cfg_map_get(map, "table-shards", &obj);
+	if (result == ISC_R_SUCCESS) {
+		shards = cfg_obj_asuint32(obj);
+		if (shards < 1 || shards > DNS_RRL_MAX_SHARDS) {
+			cfg_obj_log(obj, ns_g_lctx, ISC_LOG_ERROR,
+				    "table-shards %d < 1 or > %d",
+				    shards, DNS_RRL_MAX_SHARDS);
+			return (ISC_R_RANGE);
+		}
+	}
+	result = dns_rrl_init(&rrl, view, min_entries, shards);
 	if (result != ISC_R_SUCCESS)
 		return (result);
+	dns_rrl_settask(rrl, ns_g_server->task);
 
 	i = ISC_MAX(20000, min_entries);
 	obj = NULL;
@@ -2366,124 +2385,187 @@ create_empty_zone(dns_zone_t *zone, dns_name_t *name, dns_view_t *view,
 	return (result);
 }
 
+/*
+ * Upper bound for the dampening table, 16M prefixes.
+ */
+#define DAMPENING_MAX_TABLE_SIZE	(1 << 24)
+#define DAMPSNAPFILE "dampening.snap"
+#define DAMPSHAREDFILE "shared.damp"
+#define DAMPSNAP ".damp"
+
+/*
+ * Create a dampening table sized according to 'map'.
+ */
 static isc_result_t
-configure_dampening(dns_view_t *view, const cfg_obj_t *config,
-		    const cfg_obj_t *map) {
+create_dampening(const cfg_obj_t *map, isc_mem_t *mctx,
+		 dns_dampening_t **dampp)
+{
 	const cfg_obj_t *obj;
 	isc_result_t result;
-   	int min_entries, i;
+   	int min_entries, max_entries, shards;
+	unsigned int storage;
 
 	min_entries = 500;
 	obj = NULL;
 	result = cfg_map_get(map, "min-table-size", &obj);
 	if (result == ISC_R_SUCCESS) {
 		min_entries = cfg_obj_asuint32(obj);
-	   	CHECKRANGE(obj, 1 < min_entries && min_entries < ISC_UINT16_MAX,
+	   	CHECKRANGE(obj, 1 < min_entries &&
+			   min_entries <= DAMPENING_MAX_TABLE_SIZE,
 			   "invalid '{min-table-size %d;}'", min_entries);
 	}
-	result = dns_dampening_init(view, min_entries);
-	if (result != ISC_R_SUCCESS)
-		goto cleanup;
 
-	i = ISC_MAX(min_entries, 1000);
+	max_entries = ISC_MAX(min_entries, 1000);
 	obj = NULL;
 	result = cfg_map_get(map, "max-table-size", &obj);
 	if (result == ISC_R_SUCCESS) {
-		i = cfg_obj_asuint32(obj);
-		CHECKRANGE(obj, min_entries <= i && i < ISC_UINT16_MAX,
-			   "invalid '{max-table-size %d;}'", i);
+		max_entries = cfg_obj_asuint32(obj);
+		CHECKRANGE(obj, min_entries <= max_entries &&
+			   max_entries <= DAMPENING_MAX_TABLE_SIZE,
+			   "invalid '{max-table-size %d;}'", max_entries);
 	}
-	view->dampening->max_entries = i;
 
-   	i = 600;
+	/*
+	 * One shard per worker thread keeps the lock contention low.
+	 */
+	shards = ISC_MIN(ISC_MAX(ns_g_cpus, 1), (unsigned int)min_entries);
 	obj = NULL;
-	result = cfg_map_get(map, "halflife", &obj);
+	result = cfg_map_get(map, "table-shards", &obj);
 	if (result == ISC_R_SUCCESS) {
-		i = cfg_obj_asuint32(obj);
-		CHECKRANGE(obj, 10 < i,
-			   "invalid '{halflife %d;}'", i);
+		shards = cfg_obj_asuint32(obj);
+		CHECKRANGE(obj, 0 < shards && shards <= 1024 &&
+			   shards <= min_entries,
+			   "invalid '{table-shards %d;}'", shards);
 	}
-	view->dampening->decay.halflife = i;
-
-   	i = ISC_MAX(1 , view->dampening->decay.halflife / 100);
+	/*
+	 * "all" runs the implementations in parallel for comparison.
+	 */
+	storage = DNS_DAMPENING_STORAGE_QUEUE;
 	obj = NULL;
-	result = cfg_map_get(map, "update-delay", &obj);
+	result = cfg_map_get(map, "storage", &obj);
 	if (result == ISC_R_SUCCESS) {
-		i = cfg_obj_asuint32(obj);
-		CHECKRANGE(obj, i <= view->dampening->decay.halflife,
-			   "invalid '{update-delay %d;}'", i);
-	}
-	view->dampening->decay.updatedelay = i;
+		const char *str = cfg_obj_asstring(obj);
+		if (strcasecmp(str, "sketch") == 0)
+			storage = DNS_DAMPENING_STORAGE_SKETCH;
+		else if (strcasecmp(str, "all") == 0)
+			storage = DNS_DAMPENING_STORAGE_QUEUE |
+				  DNS_DAMPENING_STORAGE_SKETCH;
+	}
+	result = dns_dampening_create(mctx, min_entries, max_entries, shards,
+				      storage, dampp);
+cleanup:
+	return (result);
+}
 
-   	i = 32000;
-	obj = NULL;
-	result = cfg_map_get(map, "limit-maximum", &obj);
-	if (result == ISC_R_SUCCESS) {
-		i = cfg_obj_asuint32(obj);
-		CHECKRANGE(obj, 1000 <= i && i <= ISC_UINT16_MAX,
-			   "invalid '{limit-maximum %d;}'", i);
+/*
+ * Set the parameters of 'damp' from 'map'. A view using the shared table
+ * takes over the table parameters and sets only its exempt list, limits,
+ * and scores. The shared table itself has no exempt list.
+ */
+static isc_result_t
+configure_dampening_params(dns_view_t *view, dns_dampening_t *damp,
+			   const cfg_obj_t *config, const cfg_obj_t *map)
+{
+	const cfg_obj_t *obj;
+	const cfg_listelt_t *element;
+	isc_result_t result;
+	isc_boolean_t table = ISC_TF(damp->store == NULL);
+	int i;
+
+	if (table) {
+		i = 600;
+		obj = NULL;
+		result = cfg_map_get(map, "halflife", &obj);
+		if (result == ISC_R_SUCCESS) {
+			i = cfg_obj_asuint32(obj);
+			CHECKRANGE(obj, 10 < i,
+				   "invalid '{halflife %d;}'", i);
+		}
+		damp->decay.halflife = i;
+
+		i = ISC_MAX(1 , damp->decay.halflife / 100);
+		obj = NULL;
+		result = cfg_map_get(map, "update-delay", &obj);
+		if (result == ISC_R_SUCCESS) {
+			i = cfg_obj_asuint32(obj);
+			CHECKRANGE(obj, i <= damp->decay.halflife,
+				   "invalid '{update-delay %d;}'", i);
+		}
+		dns_dampening_setdecay(damp,
+				       damp->decay.halflife, i);
+
+		i = 32000;
+		obj = NULL;
+		result = cfg_map_get(map, "limit-maximum", &obj);
+		if (result == ISC_R_SUCCESS) {
+			i = cfg_obj_asuint32(obj);
+			CHECKRANGE(obj, 1000 <= i && i <= ISC_UINT16_MAX,
+				   "invalid '{limit-maximum %d;}'", i);
+		}
+		damp->limit.maximum = i;
 	}
-	view->dampening->limit.maximum = i;
 
-   	i = 0.8 * view->dampening->limit.maximum;
+   	i = 0.8 * damp->limit.maximum;
 	obj = NULL;
 	result = cfg_map_get(map, "limit-enable-dampening", &obj);
 	if (result == ISC_R_SUCCESS) {
 		i = cfg_obj_asuint32(obj);
-		CHECKRANGE(obj, 0.3 * view->dampening->limit.maximum < i && i < view->dampening->limit.maximum,
+		CHECKRANGE(obj, 0.3 * damp->limit.maximum < i && i < damp->limit.maximum,
 			   "invalid '{limit-enable-dampening %d;}'", i);
 	}
-	view->dampening->limit.enable_dampening = i;
+	damp->limit.enable_dampening = i;
 
-   	i = 0.3 * view->dampening->limit.maximum;
+   	i = 0.3 * damp->limit.maximum;
 	obj = NULL;
 	result = cfg_map_get(map, "limit-disable-dampening", &obj);
 	if (result == ISC_R_SUCCESS) {
 		i = cfg_obj_asuint32(obj);
-		CHECKRANGE(obj, 0.1 * view->dampening->limit.maximum < i && i < view->dampening->limit.enable_dampening,
+		CHECKRANGE(obj, 0.1 * damp->limit.maximum < i && i < damp->limit.enable_dampening,
 			   "invalid '{limit-disable-dampening %d;}'", i);
 	}
-	view->dampening->limit.disable_dampening = i;
+	damp->limit.disable_dampening = i;
 
-   	i = 100;
-	obj = NULL;
-	result = cfg_map_get(map, "limit-irrelevant", &obj);
-	if (result == ISC_R_SUCCESS) {
-		i = cfg_obj_asuint32(obj);
-		CHECKRANGE(obj, 100 < i && i < view->dampening->limit.disable_dampening,
-			   "invalid '{limit-irrelevant %d;}'", i);
+	if (table) {
+		i = 100;
+		obj = NULL;
+		result = cfg_map_get(map, "limit-irrelevant", &obj);
+		if (result == ISC_R_SUCCESS) {
+			i = cfg_obj_asuint32(obj);
+			CHECKRANGE(obj, 100 < i && i < damp->limit.disable_dampening,
+				   "invalid '{limit-irrelevant %d;}'", i);
+		}
+		damp->limit.irrelevant = i;
 	}
-	view->dampening->limit.irrelevant = i;
 
    	i = 10;
 	obj = NULL;
 	result = cfg_map_get(map, "score-first-query", &obj);
 	if (result == ISC_R_SUCCESS) {
 		i = cfg_obj_asuint32(obj);
-		CHECKRANGE(obj, i < view->dampening->limit.enable_dampening,
+		CHECKRANGE(obj, i < damp->limit.enable_dampening,
 			   "invalid '{score-first-query %d;}'", i);
 	}
-	view->dampening->score.first_query = i;
+	damp->score.first_query = i;
 
    	i = 1;
 	obj = NULL;
 	result = cfg_map_get(map, "score-per-query", &obj);
 	if (result == ISC_R_SUCCESS) {
 		i = cfg_obj_asuint32(obj);
-		CHECKRANGE(obj, i < view->dampening->limit.maximum,
+		CHECKRANGE(obj, i < damp->limit.maximum,
 			   "invalid '{score-per-query %d;}'", i);
 	}
-	view->dampening->score.per_query = i;
+	damp->score.per_query = i;
 
    	i = 100;
 	obj = NULL;
 	result = cfg_map_get(map, "score-qtype-any", &obj);
 	if (result == ISC_R_SUCCESS) {
 		i = cfg_obj_asuint32(obj);
-		CHECKRANGE(obj, i < view->dampening->limit.maximum,
+		CHECKRANGE(obj, i < damp->limit.maximum,
 			   "invalid '{score-qtype-any %d;}'", i);
 	}
-	view->dampening->score.qtype_any = i;
+	damp->score.qtype_any = i;
 
    	i = 500;
 	obj = NULL;
@@ -2493,100 +2575,324 @@ configure_dampening(dns_view_t *view, const cfg_obj_t *config,
 		CHECKRANGE(obj, i < ISC_UINT16_MAX / 4,
 			   "invalid '{minimum-score-size %d;}'", i);
 	}
-	view->dampening->score.minimum_size = i;
+	damp->score.minimum_size = i;
 
-   	i = ISC_MAX(4000,4*view->dampening->score.minimum_size);
+   	i = ISC_MAX(4000,4*damp->score.minimum_size);
 	obj = NULL;
 	result = cfg_map_get(map, "maximum-score-size", &obj);
 	if (result == ISC_R_SUCCESS) {
 		i = cfg_obj_asuint32(obj);
-		CHECKRANGE(obj, i > view->dampening->score.minimum_size && i <= ISC_UINT16_MAX,
+		CHECKRANGE(obj, i > damp->score.minimum_size && i <= ISC_UINT16_MAX,
 			   "invalid '{maximum-score-size %d;}'", i);
 	}
-	view->dampening->score.maximum_size = i;
+	damp->score.maximum_size = i;
 
    	i = 100;
 	obj = NULL;
 	result = cfg_map_get(map, "score-size", &obj);
 	if (result == ISC_R_SUCCESS) {
 		i = cfg_obj_asuint32(obj);
-		CHECKRANGE(obj, i < view->dampening->limit.maximum,
+		CHECKRANGE(obj, i < damp->limit.maximum,
 			   "invalid '{score-size %d;}'", i);
 	}
-	view->dampening->score.size_penalty = i;
+	damp->score.size_penalty = i;
 
    	i = 100;
 	obj = NULL;
 	result = cfg_map_get(map, "score-duplicates", &obj);
 	if (result == ISC_R_SUCCESS) {
 		i = cfg_obj_asuint32(obj);
-		CHECKRANGE(obj, i < view->dampening->limit.maximum,
+		CHECKRANGE(obj, i < damp->limit.maximum,
 			   "invalid '{score-duplicates %d;}'", i);
 	}
-	view->dampening->score.duplicates = i;
+	damp->score.duplicates = i;
 
-	i = 24;
-	obj = NULL;
-	result = cfg_map_get(map, "IPv4-prefix-length", &obj);
-	if (result == ISC_R_SUCCESS) {
-		i = cfg_obj_asuint32(obj);
-		CHECKRANGE(obj, i >= 8 && i <= 32,
-			   "invalid '{IPv4-prefix-length %d;}'", i);
+	if (table) {
+		i = 24;
+		obj = NULL;
+		result = cfg_map_get(map, "IPv4-prefix-length", &obj);
+		if (result == ISC_R_SUCCESS) {
+			i = cfg_obj_asuint32(obj);
+			CHECKRANGE(obj, i >= 8 && i <= 32,
+				   "invalid '{IPv4-prefix-length %d;}'", i);
+		}
+		damp->prefixlen.ipv4 = i;
+
+		i = 48;
+		obj = NULL;
+		result = cfg_map_get(map, "IPv6-prefix-length", &obj);
+		if (result == ISC_R_SUCCESS) {
+			i = cfg_obj_asuint32(obj);
+			CHECKRANGE(obj, i >= 16 && i <= 128,
+				   "invalid '{IPv6-prefix-length %d;}'", i);
+		}
+		damp->prefixlen.ipv6 = i;
+
+		/*
+		 * Coarser aggregation levels, each with limits of its own.
+		 */
+		damp->aggregate_count = 0;
+		obj = NULL;
+		(void)cfg_map_get(map, "aggregate", &obj);
+		for (element = cfg_list_first(obj);
+		     element != NULL;
+		     element = cfg_list_next(element))
+		{
+			const cfg_obj_t *agg = cfg_listelt_value(element);
+			struct dns_dampening_aggregate *level;
+
+			CHECKRANGE(agg, damp->aggregate_count <
+					DNS_DAMPENING_MAXLEVELS - 1,
+				   "too many aggregate levels, at most %d",
+				   DNS_DAMPENING_MAXLEVELS - 1);
+			level = &damp->aggregate[damp->aggregate_count++];
+
+			i = damp->prefixlen.ipv4;
+			obj = NULL;
+			result = cfg_map_get(agg, "IPv4-prefix-length", &obj);
+			if (result == ISC_R_SUCCESS) {
+				i = cfg_obj_asuint32(obj);
+				CHECKRANGE(obj, i >= 8 &&
+					   i <= (int)damp->prefixlen.ipv4,
+					   "invalid '{aggregate "
+					   "{IPv4-prefix-length %d;}}'", i);
+			}
+			level->prefixlen.ipv4 = i;
+
+			i = damp->prefixlen.ipv6;
+			obj = NULL;
+			result = cfg_map_get(agg, "IPv6-prefix-length", &obj);
+			if (result == ISC_R_SUCCESS) {
+				i = cfg_obj_asuint32(obj);
+				CHECKRANGE(obj, i >= 16 &&
+					   i <= (int)damp->prefixlen.ipv6,
+					   "invalid '{aggregate "
+					   "{IPv6-prefix-length %d;}}'", i);
+			}
+			level->prefixlen.ipv6 = i;
+
+			i = damp->limit.enable_dampening;
+			obj = NULL;
+			result = cfg_map_get(agg, "limit-enable-dampening",
+					     &obj);
+			if (result == ISC_R_SUCCESS) {
+				i = cfg_obj_asuint32(obj);
+				CHECKRANGE(obj, 0.3 * damp->limit.maximum < i &&
+					   i < damp->limit.maximum,
+					   "invalid '{aggregate "
+					   "{limit-enable-dampening %d;}}'", i);
+			}
+			level->enable_dampening = i;
+
+			i = damp->limit.disable_dampening;
+			obj = NULL;
+			result = cfg_map_get(agg, "limit-disable-dampening",
+					     &obj);
+			if (result == ISC_R_SUCCESS) {
+				i = cfg_obj_asuint32(obj);
+				CHECKRANGE(obj, 0.1 * damp->limit.maximum < i &&
+					   i < (int)level->enable_dampening,
+					   "invalid '{aggregate "
+					   "{limit-disable-dampening %d;}}'",
+					   i);
+			}
+			level->disable_dampening = i;
+		}
 	}
-	view->dampening->prefixlen.ipv4 = i;
 
-	i = 48;
-	obj = NULL;
-	result = cfg_map_get(map, "IPv6-prefix-length", &obj);
-	if (result == ISC_R_SUCCESS) {
-		i = cfg_obj_asuint32(obj);
-		CHECKRANGE(obj, i >= 16 && i <= 128,
-			   "invalid '{IPv6-prefix-length %d;}'", i);
+	if (view != NULL) {
+		obj = NULL;
+		result = cfg_map_get(map, "exempt-clients", &obj);
+		if (result == ISC_R_SUCCESS) {
+			result = cfg_acl_fromconfig(obj, config, ns_g_lctx,
+						    ns_g_aclconfctx, ns_g_mctx,
+						    0, &damp->exempt);
+			CHECKRANGE(obj, result == ISC_R_SUCCESS,
+				   "invalid %s", "address_match_list");
+		}
+	}
+
+	if (table) {
+		i = 0;
+		obj = NULL;
+		result = cfg_map_get(map, "report-interval", &obj);
+		if (result == ISC_R_SUCCESS) {
+			i = cfg_obj_asuint32(obj);
+		}
+		damp->statistics.report_interval = i;
+
+		obj = NULL;
+		result = cfg_map_get(map, "report-timing", &obj);
+		if (result == ISC_R_SUCCESS)
+			damp->statistics.timing = cfg_obj_asboolean(obj);
 	}
-	view->dampening->prefixlen.ipv6 = i;
+
+	isc_log_write(ns_g_lctx, NS_LOGCATEGORY_GENERAL,
+		      NS_LOGMODULE_SERVER, ISC_LOG_INFO,
+		      "Dampening configured to max_entries=%d shards=%d prefixlen{ipv4=%d ipv6=%d} decay{halflife=%d updatedelay=%d} limit{max=%d enable=%d disable=%d irrelevant=%d} aggregate=%d score{first=%d each=%d any=%d dup=%d size=%d mins=%d maxs=%d} report=%d timing=%d",
+		      damp->max_entries,
+		      damp->store != NULL ? damp->store->shards_count
+					  : damp->shards_count,
+		      damp->prefixlen.ipv4,
+		      damp->prefixlen.ipv6,
+		      damp->decay.halflife,
+		      damp->decay.updatedelay,
+		      damp->limit.maximum,
+		      damp->limit.enable_dampening,
+		      damp->limit.disable_dampening,
+		      damp->limit.irrelevant,
+		      damp->aggregate_count,
+		      damp->score.first_query,
+		      damp->score.per_query,
+		      damp->score.qtype_any,
+		      damp->score.duplicates,
+		      damp->score.size_penalty,
+		      damp->score.minimum_size,
+		      damp->score.maximum_size,
+		      damp->statistics.report_interval,
+		      damp->statistics.timing
+		      );
+	return (ISC_R_SUCCESS);
+cleanup:
+	return (result);
+}
+
+static isc_result_t
+configure_dampening(dns_view_t *view, const cfg_obj_t *config,
+		    const cfg_obj_t *map) {
+	const cfg_obj_t *obj;
+	isc_result_t result;
+	dns_view_t *pview = NULL;
+	isc_stdtime_t now;
 
 	obj = NULL;
-	result = cfg_map_get(map, "exempt-clients", &obj);
+	result = cfg_map_get(map, "shared-table", &obj);
+	if (result == ISC_R_SUCCESS && cfg_obj_asboolean(obj)) {
+		if (ns_g_server->dampstore == NULL) {
+			cfg_obj_log(obj, ns_g_lctx, ISC_LOG_ERROR,
+				    "'shared-table' requires a dampening "
+				    "block with 'shared-table yes;' in the "
+				    "options");
+			return (ISC_R_FAILURE);
+		}
+		result = dns_dampening_initshared(view,
+						  ns_g_server->dampstore);
+	} else
+		result = create_dampening(map, view->mctx,
+					  &view->dampening);
+	if (result != ISC_R_SUCCESS)
+		goto cleanup;
+	if (ns_g_server->dampfilter != NULL)
+		dns_dampening_filter_attach(ns_g_server->dampfilter,
+					    &view->dampening->filter);
+
+	CHECK(configure_dampening_params(view, view->dampening, config, map));
+
+	/*
+	 * Carry the penalties over a reconfiguration, or restore them
+	 * from the snapshot of the last shutdown. The shared table does
+	 * this for the views using it.
+	 */
+	obj = NULL;
+	result = cfg_map_get(map, "snapshot", &obj);
+	if (result == ISC_R_SUCCESS && cfg_obj_asboolean(obj) &&
+	    view->dampening->store == NULL) {
+		char buffer[ISC_SHA256_DIGESTSTRINGLENGTH + sizeof(DAMPSNAP)];
+
+		isc_sha256_data((void *)view->name, strlen(view->name),
+				buffer);
+		strcat(buffer, DAMPSNAP);
+		view->dampening->snapshot =
+			isc_mem_strdup(view->mctx,
+				       strcmp(view->name, "_default") == 0 ?
+				       DAMPSNAPFILE : buffer);
+		if (view->dampening->snapshot == NULL) {
+			result = ISC_R_NOMEMORY;
+			goto cleanup;
+		}
+	}
+
+	isc_stdtime_get(&now);
+	result = dns_viewlist_find(&ns_g_server->viewlist, view->name,
+				   view->rdclass, &pview);
 	if (result == ISC_R_SUCCESS) {
-		result = cfg_acl_fromconfig(obj, config, ns_g_lctx,
-					    ns_g_aclconfctx, ns_g_mctx,
-					    0, &view->dampening->exempt);
-		CHECKRANGE(obj, result == ISC_R_SUCCESS,
-			   "invalid %s", "address_match_list");
+		if (pview->dampening != NULL &&
+		    pview->dampening->store == NULL)
+			dns_dampening_merge(view->dampening,
+					    pview->dampening, now);
+		dns_view_detach(&pview);
+	} else if (view->dampening->snapshot != NULL) {
+		result = dns_dampening_restore(view->dampening,
+					       view->dampening->snapshot,
+					       now);
+		if (result != ISC_R_SUCCESS && result != ISC_R_FILENOTFOUND)
+			cfg_obj_log(obj, ns_g_lctx, ISC_LOG_WARNING,
+				    "restoring dampening state from '%s': %s",
+				    view->dampening->snapshot,
+				    isc_result_totext(result));
 	}
+	return (ISC_R_SUCCESS);
+cleanup:
+	if (view->dampening != NULL)
+		dns_dampening_destroy(view);
+	return (result);
+}
+
+/*
+ * Build the dampening table shared by the views from the dampening block
+ * of the options, if it has 'shared-table yes;'. The penalties are taken
+ * over from the previous shared table, or restored from its snapshot.
+ */
+static isc_result_t
+configure_shared_dampening(ns_server_t *server, const cfg_obj_t *config) {
+	const cfg_obj_t *options = NULL;
+	const cfg_obj_t *map = NULL;
+	const cfg_obj_t *obj = NULL;
+	dns_dampening_t *store = NULL;
+	isc_stdtime_t now;
+	isc_result_t result;
+
+	(void)cfg_map_get(config, "options", &options);
+	if (options != NULL)
+		(void)cfg_map_get(options, "dampening", &map);
+	if (map != NULL)
+		(void)cfg_map_get(map, "shared-table", &obj);
+	if (obj == NULL || !cfg_obj_asboolean(obj)) {
+		if (server->dampstore != NULL)
+			dns_dampening_detach(&server->dampstore);
+		return (ISC_R_SUCCESS);
+	}
+
+	CHECK(create_dampening(map, ns_g_mctx, &store));
+	CHECK(configure_dampening_params(NULL, store, config, map));
 
-   	i = 0;
 	obj = NULL;
-	result = cfg_map_get(map, "report-interval", &obj);
-	if (result == ISC_R_SUCCESS) {
-		i = cfg_obj_asuint32(obj);
+	result = cfg_map_get(map, "snapshot", &obj);
+	if (result == ISC_R_SUCCESS && cfg_obj_asboolean(obj)) {
+		store->snapshot = isc_mem_strdup(ns_g_mctx, DAMPSHAREDFILE);
+		if (store->snapshot == NULL) {
+			result = ISC_R_NOMEMORY;
+			goto cleanup;
+		}
 	}
-	view->dampening->statistics.report_interval = i;
 
-	isc_log_write(ns_g_lctx, NS_LOGCATEGORY_GENERAL,
-		      NS_LOGMODULE_SERVER, ISC_LOG_INFO,
-		      "Dampening configured to max_entries=%d prefixlen{ipv4=%d ipv6=%d} decay{halflife=%d updatedelay=%d} limit{max=%d enable=%d disable=%d irrelevant=%d} score{first=%d each=%d any=%d dup=%d size=%d mins=%d maxs=%d} report=%d",
-		      view->dampening->max_entries,
-		      view->dampening->prefixlen.ipv4,
-		      view->dampening->prefixlen.ipv6,
-		      view->dampening->decay.halflife,
-		      view->dampening->decay.updatedelay,
-		      view->dampening->limit.maximum,
-		      view->dampening->limit.enable_dampening,
-		      view->dampening->limit.disable_dampening,
-		      view->dampening->limit.irrelevant,
-		      view->dampening->score.first_query,
-		      view->dampening->score.per_query,
-		      view->dampening->score.qtype_any,
-		      view->dampening->score.duplicates,
-		      view->dampening->score.size_penalty,
-		      view->dampening->score.minimum_size,
-		      view->dampening->score.maximum_size,
-		      view->dampening->statistics.report_interval
-		      );
+	isc_stdtime_get(&now);
+	if (server->dampstore != NULL) {
+		dns_dampening_merge(store, server->dampstore, now);
+		dns_dampening_detach(&server->dampstore);
+	} else if (store->snapshot != NULL) {
+		result = dns_dampening_restore(store, store->snapshot, now);
+		if (result != ISC_R_SUCCESS && result != ISC_R_FILENOTFOUND)
+			cfg_obj_log(obj, ns_g_lctx, ISC_LOG_WARNING,
+				    "restoring dampening state from '%s': %s",
+				    store->snapshot,
+				    isc_result_totext(result));
+	}
+	server->dampstore = store;
 	return (ISC_R_SUCCESS);
 cleanup:
-	dns_dampening_destroy(view);
+	if (store != NULL)
+		dns_dampening_detach(&store);
 	return (result);
 }
 
@@ -2649,6 +2955,7 @@ configure_view(dns_view_t *view, dns_viewlist_t *viewlist,
 	const cfg_obj_t *disablelist = NULL;
 	isc_stats_t *resstats = NULL;
 	dns_stats_t *resquerystats = NULL;
+	dns_stats_t *latencystats = NULL;
 	isc_boolean_t auto_dlv = ISC_FALSE;
 	isc_boolean_t auto_root = ISC_FALSE;
 	ns_cache_t *nsc;
@@ -3190,6 +3497,16 @@ configure_view(dns_view_t *view, dns_viewlist_t *viewlist,
 			isc_mem_setname(cmctx, "cache", NULL);
 			CHECK(isc_mem_create(0, 0, &hmctx));
 			isc_mem_setname(hmctx, "cache_heap", NULL);
+			if (ns_g_hugepages &&
+			    (isc_mem_sethugepages(cmctx, ISC_TRUE) !=
+			     ISC_R_SUCCESS ||
+			     isc_mem_sethugepages(hmctx, ISC_TRUE) !=
+			     ISC_R_SUCCESS))
+				isc_log_write(ns_g_lctx, NS_LOGCATEGORY_GENERAL,
+					      NS_LOGMODULE_SERVER,
+					      ISC_LOG_WARNING,
+					      "huge-pages: not supported "
+					      "by the memory allocator");
 			CHECK(dns_cache_create3(cmctx, hmctx, ns_g_taskmgr,
 						ns_g_timermgr, view->rdclass,
 						cachename, "rbt", 0, NULL,
@@ -3457,7 +3774,8 @@ configure_view(dns_view_t *view, dns_viewlist_t *viewlist,
 	dns_tsigkeyring_detach(&ring);
 
 	/*
-	 * See if we can re-use a dynamic key ring.
+	 * See if we can re-use a dynamic key ring and the query latency
+	 * histograms.
 	 */
 	result = dns_viewlist_find(&ns_g_server->viewlist, view->name,
 				   view->rdclass, &pview);
@@ -3468,9 +3786,13 @@ configure_view(dns_view_t *view, dns_viewlist_t *viewlist,
 		if (ring != NULL)
 			dns_view_setdynamickeyring(view, ring);
 		dns_tsigkeyring_detach(&ring);
+		dns_view_getlatencystats(pview, &latencystats);
 		dns_view_detach(&pview);
 	} else
 		dns_view_restorekeyring(view);
+	if (latencystats == NULL)
+		CHECK(dns_latencystats_create(mctx, &latencystats));
+	dns_view_setlatencystats(view, latencystats);
 
 	/*
 	 * Configure the view's peer list.
@@ -4130,6 +4452,8 @@ configure_view(dns_view_t *view, dns_viewlist_t *viewlist,
 		isc_stats_detach(&resstats);
 	if (resquerystats != NULL)
 		dns_stats_detach(&resquerystats);
+	if (latencystats != NULL)
+		dns_stats_detach(&latencystats);
 	if (order != NULL)
 		dns_order_detach(&order);
 	if (cmctx != NULL)
@@ -5669,6 +5993,124 @@ count_zones(const cfg_obj_t *conf) {
 	return (n);
 }
 
+/*
+ * Record the NUMA node of each task worker once worker N is bound to
+ * processor cpus[N % ncpus], so that the clients of an interface can be
+ * kept on the node of its network device.  The map is only changed in
+ * exclusive mode, which is what lets clients read it without a lock.
+ */
+static void
+set_workernodes(ns_server_t *server, const int *cpus, unsigned int ncpus) {
+	unsigned int i;
+
+	if (server->workernodes == NULL) {
+		server->workernodes = isc_mem_get(server->mctx,
+						  ns_g_cpus * sizeof(int));
+		if (server->workernodes == NULL)
+			return;
+	}
+	for (i = 0; i < ns_g_cpus; i++)
+		server->workernodes[i] = isc_os_cpunode(cpus[i % ncpus]);
+}
+
+static void
+clear_workernodes(ns_server_t *server) {
+	if (server->workernodes != NULL)
+		isc_mem_put(server->mctx, server->workernodes,
+			    ns_g_cpus * sizeof(int));
+	server->workernodes = NULL;
+}
+
+/*
+ * Let the task manager workers and the socket watchers run on any
+ * processor again.
+ */
+static void
+unbind_threads(ns_server_t *server) {
+	isc_result_t result;
+
+	clear_workernodes(server);
+
+	/*
+	 * ISC_R_NOTIMPLEMENTED means no thread of that manager can have
+	 * been bound in the first place.
+	 */
+	result = isc_taskmgr_setaffinity(ns_g_taskmgr, NULL, 0);
+	if (result == ISC_R_SUCCESS || result == ISC_R_NOTIMPLEMENTED)
+		result = isc_socketmgr_setaffinity(ns_g_socketmgr, NULL, 0);
+	if (result != ISC_R_SUCCESS && result != ISC_R_NOTIMPLEMENTED) {
+		isc_log_write(ns_g_lctx, NS_LOGCATEGORY_GENERAL,
+			      NS_LOGMODULE_SERVER, ISC_LOG_WARNING,
+			      "cpu-affinity: cannot unbind threads: %s",
+			      isc_result_totext(result));
+		return;
+	}
+	server->affinity_set = ISC_FALSE;
+}
+
+/*
+ * Bind the task manager workers and the socket watchers to the processors
+ * listed in 'cpulist', or let them run anywhere again if there is no list
+ * and they were bound before.  Whether a processor exists and may be used
+ * is left to the system: the number of processors online says nothing
+ * about the highest processor number, nor about cpusets.  If binding
+ * fails part way the threads which were already bound are released
+ * again, so 'affinity_set' always says whether any thread is bound.
+ */
+static void
+configure_affinity(ns_server_t *server, const cfg_obj_t *cpulist) {
+	const cfg_listelt_t *element;
+	isc_result_t result;
+	unsigned int i, n = 0;
+	int *cpus = NULL;
+
+	for (element = cfg_list_first(cpulist);
+	     element != NULL;
+	     element = cfg_list_next(element))
+		n++;
+
+	if (n == 0) {
+		if (server->affinity_set)
+			unbind_threads(server);
+		return;
+	}
+
+	cpus = isc_mem_get(server->mctx, n * sizeof(*cpus));
+	if (cpus == NULL) {
+		isc_log_write(ns_g_lctx, NS_LOGCATEGORY_GENERAL,
+			      NS_LOGMODULE_SERVER, ISC_LOG_WARNING,
+			      "cpu-affinity: %s",
+			      isc_result_totext(ISC_R_NOMEMORY));
+		if (server->affinity_set)
+			unbind_threads(server);
+		return;
+	}
+	for (element = cfg_list_first(cpulist), i = 0;
+	     element != NULL;
+	     element = cfg_list_next(element), i++)
+		cpus[i] = (int)cfg_obj_asuint32(cfg_listelt_value(element));
+
+	server->affinity_set = ISC_TRUE;
+	result = isc_taskmgr_setaffinity(ns_g_taskmgr, cpus, n);
+	if (result == ISC_R_SUCCESS)
+		result = isc_socketmgr_setaffinity(ns_g_socketmgr, cpus, n);
+	if (result != ISC_R_SUCCESS) {
+		isc_log_write(ns_g_lctx, NS_LOGCATEGORY_GENERAL,
+			      NS_LOGMODULE_SERVER, ISC_LOG_WARNING,
+			      "cpu-affinity: cannot bind threads to "
+			      "processors: %s", isc_result_totext(result));
+		unbind_threads(server);
+	} else {
+		set_workernodes(server, cpus, n);
+		isc_log_write(ns_g_lctx, NS_LOGCATEGORY_GENERAL,
+			      NS_LOGMODULE_SERVER, ISC_LOG_INFO,
+			      "bound worker and socket threads to %u "
+			      "processor%s", n, n == 1 ? "" : "s");
+	}
+
+	isc_mem_put(server->mctx, cpus, n * sizeof(*cpus));
+}
+
 static isc_result_t
 load_configuration(const char *filename, ns_server_t *server,
 		   isc_boolean_t first_time)
@@ -5898,6 +6340,22 @@ load_configuration(const char *filename, ns_server_t *server,
 		dns_dispatchmgr_setblackhole(ns_g_dispatchmgr,
 					     server->blackholeacl);
 
+	/*
+	 * The early drop filter is shared by the dampening of all views.
+	 * Keep the existing one across reloads.
+	 */
+	obj = NULL;
+	result = ns_config_get(maps, "dampening-early-drop", &obj);
+	INSIST(result == ISC_R_SUCCESS);
+	if (cfg_obj_asboolean(obj)) {
+		if (server->dampfilter == NULL)
+			CHECK(dns_dampening_filter_create(ns_g_mctx,
+							  &server->dampfilter));
+	} else if (server->dampfilter != NULL)
+		dns_dampening_filter_detach(&server->dampfilter);
+
+	CHECK(configure_shared_dampening(server, config));
+
 	obj = NULL;
 	result = ns_config_get(maps, "match-mapped-addresses", &obj);
 	INSIST(result == ISC_R_SUCCESS);
@@ -6019,6 +6477,42 @@ load_configuration(const char *filename, ns_server_t *server,
 	if ((ns_g_listen > 0) && (ns_g_listen < 10))
 		ns_g_listen = 10;
 
+	/*
+	 * Find the number of clients waiting on each UDP listener.
+	 */
+	obj = NULL;
+	result = ns_config_get(maps, "udp-receive-batch", &obj);
+	INSIST(result == ISC_R_SUCCESS);
+	ns_g_udpbatch = cfg_obj_asuint32(obj);
+	if (ns_g_udpbatch < 1)
+		ns_g_udpbatch = 1;
+	if (ns_g_udpbatch > ISC_SOCKET_MAXBATCH)
+		ns_g_udpbatch = ISC_SOCKET_MAXBATCH;
+
+	/*
+	 * Whether new UDP listeners get a SO_REUSEPORT socket per worker.
+	 */
+	obj = NULL;
+	result = ns_config_get(maps, "reuseport", &obj);
+	INSIST(result == ISC_R_SUCCESS);
+	ns_g_reuseport = cfg_obj_asboolean(obj);
+
+	/*
+	 * Whether cache and zone memory is carved from huge pages.
+	 */
+	obj = NULL;
+	result = ns_config_get(maps, "huge-pages", &obj);
+	INSIST(result == ISC_R_SUCCESS);
+	ns_g_hugepages = cfg_obj_asboolean(obj);
+	dns_zonemgr_sethugepages(server->zonemgr, ns_g_hugepages);
+
+	/*
+	 * Bind the worker threads to processors.
+	 */
+	obj = NULL;
+	(void)ns_config_get(maps, "cpu-affinity", &obj);
+	configure_affinity(server, obj);
+
 	/*
 	 * Configure the interface manager according to the "listen-on"
 	 * statement.
@@ -6881,6 +7375,21 @@ ns_server_flushonshutdown(ns_server_t *server, isc_boolean_t flush) {
 	server->flushonshutdown = flush;
 }
 
+static void
+save_dampening(dns_dampening_t *damp, const char *name) {
+	isc_result_t result;
+	isc_stdtime_t now;
+
+	isc_stdtime_get(&now);
+	result = dns_dampening_save(damp, damp->snapshot, now);
+	if (result != ISC_R_SUCCESS)
+		isc_log_write(ns_g_lctx, NS_LOGCATEGORY_GENERAL,
+			      NS_LOGMODULE_SERVER, ISC_LOG_ERROR,
+			      "saving dampening state of '%s' "
+			      "to '%s': %s", name, damp->snapshot,
+			      isc_result_totext(result));
+}
+
 static void
 shutdown_server(isc_task_t *task, isc_event_t *event) {
 	isc_result_t result;
@@ -6915,11 +7424,19 @@ shutdown_server(isc_task_t *task, isc_event_t *event) {
 	     view = view_next) {
 		view_next = ISC_LIST_NEXT(view, link);
 		ISC_LIST_UNLINK(server->viewlist, view, link);
+		if (view->dampening != NULL &&
+		    view->dampening->snapshot != NULL)
+			save_dampening(view->dampening, view->name);
 		if (flush)
 			dns_view_flushanddetach(&view);
 		else
 			dns_view_detach(&view);
 	}
+	if (server->dampstore != NULL) {
+		if (server->dampstore->snapshot != NULL)
+			save_dampening(server->dampstore, "shared table");
+		dns_dampening_detach(&server->dampstore);
+	}
 
 	dns_dynamic_db_cleanup(ISC_TRUE);
 
@@ -6947,6 +7464,8 @@ shutdown_server(isc_task_t *task, isc_event_t *event) {
 
 	if (server->blackholeacl != NULL)
 		dns_acl_detach(&server->blackholeacl);
+	if (server->dampfilter != NULL)
+		dns_dampening_filter_detach(&server->dampfilter);
 
 #ifdef HAVE_GEOIP
 	dns_geoip_shutdown();
@@ -6996,6 +7515,8 @@ ns_server_create(isc_mem_t *mctx, ns_server_t **serverp) {
 	ISC_LIST_INIT(server->viewlist);
 	server->in_roothints = NULL;
 	server->blackholeacl = NULL;
+	server->dampfilter = NULL;
+	server->dampstore = NULL;
 
 	/* Must be first. */
 	/* dst_lib_init2 call moved to before chroot. */
@@ -7061,6 +7582,10 @@ ns_server_create(isc_mem_t *mctx, ns_server_t **serverp) {
 				    isc_sockstatscounter_max),
 		   "isc_stats_create");
 	isc_socketmgr_setstats(ns_g_socketmgr, server->sockstats);
+	server->numastats = NULL;
+	CHECKFATAL(isc_stats_create(server->mctx, &server->numastats,
+				    ns_numastatscounter_max),
+		   "isc_stats_create");
 
 	server->bindkeysfile = isc_mem_strdup(server->mctx, "bind.keys");
 	CHECKFATAL(server->bindkeysfile == NULL ? ISC_R_NOMEMORY :
@@ -7085,6 +7610,8 @@ ns_server_create(isc_mem_t *mctx, ns_server_t **serverp) {
 	server->version_set = ISC_FALSE;
 	server->version = NULL;
 	server->server_usehostname = ISC_FALSE;
+	server->affinity_set = ISC_FALSE;
+	server->workernodes = NULL;
 	server->server_id = NULL;
 
 	CHECKFATAL(isc_stats_create(ns_g_mctx, &server->nsstats,
@@ -7142,6 +7669,8 @@ ns_server_destroy(ns_server_t **serverp) {
 	isc_stats_detach(&server->zonestats);
 	isc_stats_detach(&server->resolverstats);
 	isc_stats_detach(&server->sockstats);
+	isc_stats_detach(&server->numastats);
+	clear_workernodes(server);
 
 	isc_mem_free(server->mctx, server->statsfile);
 	isc_mem_free(server->mctx, server->bindkeysfile);
@@ -10104,3 +10633,85 @@ ns_server_zonestatus(ns_server_t *server, char *args, isc_buffer_t *text) {
 		dns_zone_detach(&zone);
 	return (result);
 }
+
+/*
+ * Act on a "dampening-dump" command from the command channel: list the
+ * netblocks with the highest penalties. The tables are scanned shard by
+ * shard without entering exclusive mode.
+ */
+#define DAMPDUMP_DEFAULT	10
+#define DAMPDUMP_MAX		50
+
+isc_result_t
+ns_server_dampeningdump(ns_server_t *server, char *args, isc_buffer_t *text) {
+	dns_dampening_entry_t top[DAMPDUMP_MAX];
+	char addrbuf[ISC_NETADDR_FORMATSIZE];
+	char *ptr, *viewname = NULL;
+	unsigned int i, n, count = DAMPDUMP_DEFAULT, found;
+	isc_boolean_t any = ISC_FALSE;
+	isc_stdtime_t now;
+	dns_view_t *view;
+
+	/* Skip the command name. */
+	ptr = next_token(&args, " \t");
+	if (ptr == NULL)
+		return (ISC_R_UNEXPECTEDEND);
+
+	/* Optional count and view name. */
+	ptr = next_token(&args, " \t");
+	if (ptr != NULL && isdigit((unsigned char)ptr[0])) {
+		count = atoi(ptr);
+		if (count == 0 || count > DAMPDUMP_MAX)
+			return (ISC_R_RANGE);
+		ptr = next_token(&args, " \t");
+	}
+	viewname = ptr;
+
+	isc_stdtime_get(&now);
+	for (view = ISC_LIST_HEAD(server->viewlist);
+	     view != NULL;
+	     view = ISC_LIST_NEXT(view, link))
+	{
+		if (viewname != NULL && strcmp(viewname, view->name) != 0)
+			continue;
+		if (view->dampening == NULL)
+			continue;
+		any = ISC_TRUE;
+
+		found = dns_dampening_top(view->dampening, now, top, count);
+		for (i = 0; i < found; i++) {
+			isc_netaddr_t netaddr = top[i].netaddr;
+			unsigned int len;
+
+			/* The zone tags the aggregation level */
+			len = dns_dampening_prefixlen(view->dampening,
+						      &netaddr);
+			if (len != (netaddr.family == AF_INET ?
+				    view->dampening->prefixlen.ipv4 :
+				    view->dampening->prefixlen.ipv6))
+				netaddr.zone = 0;
+			isc_netaddr_format(&netaddr, addrbuf,
+					   sizeof(addrbuf));
+			n = snprintf((char *)isc_buffer_used(text),
+				     isc_buffer_availablelength(text),
+				     "view \"%s\"; %s/%u; penalty %u%s;\n",
+				     view->name, addrbuf, len,
+				     top[i].penalty,
+				     top[i].dampening ? "; dampened" : "");
+			if (n >= isc_buffer_availablelength(text))
+				return (ISC_R_NOSPACE);
+			isc_buffer_add(text, n);
+		}
+	}
+
+	if (!any) {
+		n = snprintf((char *)isc_buffer_used(text),
+			     isc_buffer_availablelength(text),
+			     "no view with dampening found.\n");
+		if (n >= isc_buffer_availablelength(text))
+			return (ISC_R_NOSPACE);
+		isc_buffer_add(text, n);
+	}
+
+	return (ISC_R_SUCCESS);
+}
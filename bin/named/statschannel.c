@@ -32,6 +32,7 @@
 
 #include <dns/cache.h>
 #include <dns/db.h>
+#include <dns/dampening.h>
 #include <dns/opcode.h>
 #include <dns/resolver.h>
 #include <dns/rdataclass.h>
@@ -62,6 +63,7 @@ struct ns_statschannel {
 	 */
 	isc_mutex_t				lock;
 	dns_acl_t				*acl;
+	size_t					metricsize;
 
 	/* Locked by server task */
 	ISC_LINK(struct ns_statschannel)	link;
@@ -77,6 +79,16 @@ stats_dumparg {
 	isc_result_t		result;
 } stats_dumparg_t;
 
+typedef struct
+latency_dumparg {
+	isc_statsformat_t	type;
+	void			*arg;		/* type dependent argument */
+	int			histogram;	/* last one dumped, or -1 */
+	void			*sourceobj;	/* JSON: current source */
+	void			*bucketlist;	/* JSON: current histogram */
+	isc_result_t		result;
+} latency_dumparg_t;
+
 static isc_once_t once = ISC_ONCE_INIT;
 
 /*%
@@ -90,21 +102,19 @@ static const char *adbstats_desc[dns_adbstats_max];
 static const char *zonestats_desc[dns_zonestatscounter_max];
 static const char *sockstats_desc[isc_sockstatscounter_max];
 static const char *dnssecstats_desc[dns_dnssecstats_max];
-#ifdef HAVE_LIBXML2
 static const char *nsstats_xmldesc[dns_nsstatscounter_max];
 static const char *resstats_xmldesc[dns_resstatscounter_max];
 static const char *adbstats_xmldesc[dns_adbstats_max];
 static const char *zonestats_xmldesc[dns_zonestatscounter_max];
 static const char *sockstats_xmldesc[isc_sockstatscounter_max];
 static const char *dnssecstats_xmldesc[dns_dnssecstats_max];
-#else
-#define nsstats_xmldesc NULL
-#define resstats_xmldesc NULL
-#define adbstats_xmldesc NULL
-#define zonestats_xmldesc NULL
-#define sockstats_xmldesc NULL
-#define dnssecstats_xmldesc NULL
-#endif	/* HAVE_LIBXML2 */
+
+/*%
+ * The per NUMA node counters are named "Node<N>Local" and "Node<N>Remote"
+ * in every format.
+ */
+static char numastats_names[ns_numastatscounter_max][sizeof("Node99Remote")];
+static const char *numastats_desc[ns_numastatscounter_max];
 
 #define TRY0(a) do { xmlrc = (a); if (xmlrc < 0) goto error; } while(0)
 
@@ -119,6 +129,7 @@ static int adbstats_index[dns_adbstats_max];
 static int zonestats_index[dns_zonestatscounter_max];
 static int sockstats_index[isc_sockstatscounter_max];
 static int dnssecstats_index[dns_dnssecstats_max];
+static int numastats_index[ns_numastatscounter_max];
 
 static inline void
 set_desc(int counter, int maxcounter, const char *fdesc, const char **fdescs,
@@ -126,17 +137,10 @@ set_desc(int counter, int maxcounter, const char *fdesc, const char **fdescs,
 {
 	REQUIRE(counter < maxcounter);
 	REQUIRE(fdescs[counter] == NULL);
-#ifdef HAVE_LIBXML2
 	REQUIRE(xdescs[counter] == NULL);
-#endif
 
 	fdescs[counter] = fdesc;
-#ifdef HAVE_LIBXML2
 	xdescs[counter] = xdesc;
-#else
-	UNUSED(xdesc);
-	UNUSED(xdescs);
-#endif
 }
 
 static void
@@ -146,10 +150,8 @@ init_desc(void) {
 	/* Initialize name server statistics */
 	for (i = 0; i < dns_nsstatscounter_max; i++)
 		nsstats_desc[i] = NULL;
-#ifdef HAVE_LIBXML2
 	for (i = 0; i < dns_nsstatscounter_max; i++)
 		nsstats_xmldesc[i] = NULL;
-#endif
 
 #define SET_NSSTATDESC(counterid, desc, xmldesc) \
 	do { \
@@ -244,10 +246,8 @@ init_desc(void) {
 	/* Initialize resolver statistics */
 	for (i = 0; i < dns_resstatscounter_max; i++)
 		resstats_desc[i] = NULL;
-#ifdef  HAVE_LIBXML2
 	for (i = 0; i < dns_resstatscounter_max; i++)
 		resstats_xmldesc[i] = NULL;
-#endif
 
 #define SET_RESSTATDESC(counterid, desc, xmldesc) \
 	do { \
@@ -329,10 +329,8 @@ init_desc(void) {
 	/* Initialize adb statistics */
 	for (i = 0; i < dns_adbstats_max; i++)
 		adbstats_desc[i] = NULL;
-#ifdef  HAVE_LIBXML2
 	for (i = 0; i < dns_adbstats_max; i++)
 		adbstats_xmldesc[i] = NULL;
-#endif
 
 #define SET_ADBSTATDESC(id, desc, xmldesc) \
 	do { \
@@ -351,10 +349,8 @@ init_desc(void) {
 	/* Initialize zone statistics */
 	for (i = 0; i < dns_zonestatscounter_max; i++)
 		zonestats_desc[i] = NULL;
-#ifdef  HAVE_LIBXML2
 	for (i = 0; i < dns_zonestatscounter_max; i++)
 		zonestats_xmldesc[i] = NULL;
-#endif
 
 #define SET_ZONESTATDESC(counterid, desc, xmldesc) \
 	do { \
@@ -384,10 +380,8 @@ init_desc(void) {
 	/* Initialize socket statistics */
 	for (i = 0; i < isc_sockstatscounter_max; i++)
 		sockstats_desc[i] = NULL;
-#ifdef  HAVE_LIBXML2
 	for (i = 0; i < isc_sockstatscounter_max; i++)
 		sockstats_xmldesc[i] = NULL;
-#endif
 
 #define SET_SOCKSTATDESC(counterid, desc, xmldesc) \
 	do { \
@@ -498,15 +492,31 @@ init_desc(void) {
 	SET_SOCKSTATDESC(unixactive, "Unix domain sockets active",
 			 "UnixActive");
 	SET_SOCKSTATDESC(rawactive, "Raw sockets active", "RawActive");
+	SET_SOCKSTATDESC(udp4recvbatch, "UDP/IPv4 batched receive calls",
+			 "UDP4RecvBatch");
+	SET_SOCKSTATDESC(udp6recvbatch, "UDP/IPv6 batched receive calls",
+			 "UDP6RecvBatch");
+	SET_SOCKSTATDESC(udp4recvbatchmsgs,
+			 "UDP/IPv4 datagrams received in batches",
+			 "UDP4RecvBatchMsgs");
+	SET_SOCKSTATDESC(udp6recvbatchmsgs,
+			 "UDP/IPv6 datagrams received in batches",
+			 "UDP6RecvBatchMsgs");
+	SET_SOCKSTATDESC(udp4sendbatch, "UDP/IPv4 batched send calls",
+			 "UDP4SendBatch");
+	SET_SOCKSTATDESC(udp6sendbatch, "UDP/IPv6 batched send calls",
+			 "UDP6SendBatch");
+	SET_SOCKSTATDESC(udp4sendbatchmsgs, "UDP/IPv4 datagrams sent in batches",
+			 "UDP4SendBatchMsgs");
+	SET_SOCKSTATDESC(udp6sendbatchmsgs, "UDP/IPv6 datagrams sent in batches",
+			 "UDP6SendBatchMsgs");
 	INSIST(i == isc_sockstatscounter_max);
 
 	/* Initialize DNSSEC statistics */
 	for (i = 0; i < dns_dnssecstats_max; i++)
 		dnssecstats_desc[i] = NULL;
-#ifdef  HAVE_LIBXML2
 	for (i = 0; i < dns_dnssecstats_max; i++)
 		dnssecstats_xmldesc[i] = NULL;
-#endif
 
 #define SET_DNSSECSTATDESC(counterid, desc, xmldesc) \
 	do { \
@@ -540,7 +550,6 @@ init_desc(void) {
 		INSIST(sockstats_desc[i] != NULL);
 	for (i = 0; i < dns_dnssecstats_max; i++)
 		INSIST(dnssecstats_desc[i] != NULL);
-#ifdef  HAVE_LIBXML2
 	for (i = 0; i < dns_nsstatscounter_max; i++)
 		INSIST(nsstats_xmldesc[i] != NULL);
 	for (i = 0; i < dns_resstatscounter_max; i++)
@@ -553,7 +562,15 @@ init_desc(void) {
 		INSIST(sockstats_xmldesc[i] != NULL);
 	for (i = 0; i < dns_dnssecstats_max; i++)
 		INSIST(dnssecstats_xmldesc[i] != NULL);
-#endif
+
+	for (i = 0; i < ns_numastatscounter_max; i++) {
+		snprintf(numastats_names[i], sizeof(numastats_names[i]),
+			 "Node%d%s", i / ns_numastatscounter_pernode,
+			 (i % ns_numastatscounter_pernode ==
+			  ns_numastatscounter_local) ? "Local" : "Remote");
+		numastats_desc[i] = numastats_names[i];
+		numastats_index[i] = i;
+	}
 }
 
 /*%
@@ -893,6 +910,150 @@ opcodestat_dump(dns_opcode_t code, isc_uint64_t val, void *arg) {
 #endif
 }
 
+static const char *latencysource_names[dns_latencysource_max] = {
+	"auth", "cache", "recursion"
+};
+
+static const char *latencyrcode_names[dns_latencyrcode_max] = {
+	"NOERROR", "SERVFAIL", "NXDOMAIN", "REFUSED", "other"
+};
+
+/*%
+ * Buckets arrive grouped by histogram, so a new histogram element is
+ * opened whenever the source or the response code changes.
+ */
+static void
+latencystat_dump(dns_latencysource_t source, dns_latencyrcode_t rcode,
+		 isc_uint64_t lo, isc_uint64_t hi, isc_uint64_t val, void *arg)
+{
+	latency_dumparg_t *dumparg = arg;
+	int histogram = source * dns_latencyrcode_max + rcode;
+	FILE *fp;
+#ifdef HAVE_LIBXML2
+	xmlTextWriterPtr writer;
+	int xmlrc;
+#endif
+#ifdef HAVE_JSON
+	json_object *latencyobj, *sourceobj, *bucketlist, *bucketobj, *obj;
+#endif
+
+	if (dumparg->result != ISC_R_SUCCESS)
+		return;
+
+	switch (dumparg->type) {
+	case isc_statsformat_file:
+		fp = dumparg->arg;
+		if (hi != 0)
+			fprintf(fp, "%20" ISC_PRINT_QUADFORMAT "u %s %s "
+				"%" ISC_PRINT_QUADFORMAT "u-"
+				"%" ISC_PRINT_QUADFORMAT "uus\n", val,
+				latencysource_names[source],
+				latencyrcode_names[rcode], lo, hi);
+		else
+			fprintf(fp, "%20" ISC_PRINT_QUADFORMAT "u %s %s "
+				"%" ISC_PRINT_QUADFORMAT "u-us\n", val,
+				latencysource_names[source],
+				latencyrcode_names[rcode], lo);
+		break;
+	case isc_statsformat_xml:
+#ifdef HAVE_LIBXML2
+		writer = dumparg->arg;
+
+		if (histogram != dumparg->histogram) {
+			if (dumparg->histogram != -1)
+				TRY0(xmlTextWriterEndElement(writer));
+			TRY0(xmlTextWriterStartElement(writer,
+						ISC_XMLCHAR "histogram"));
+			TRY0(xmlTextWriterWriteAttribute(writer,
+				ISC_XMLCHAR "source",
+				ISC_XMLCHAR latencysource_names[source]));
+			TRY0(xmlTextWriterWriteAttribute(writer,
+				ISC_XMLCHAR "rcode",
+				ISC_XMLCHAR latencyrcode_names[rcode]));
+		}
+
+		TRY0(xmlTextWriterStartElement(writer, ISC_XMLCHAR "bucket"));
+		TRY0(xmlTextWriterWriteFormatAttribute(writer,
+						ISC_XMLCHAR "lo",
+						"%" ISC_PRINT_QUADFORMAT "u",
+						lo));
+		if (hi != 0)
+			TRY0(xmlTextWriterWriteFormatAttribute(writer,
+						ISC_XMLCHAR "hi",
+						"%" ISC_PRINT_QUADFORMAT "u",
+						hi));
+		TRY0(xmlTextWriterWriteFormatString(writer,
+					       "%" ISC_PRINT_QUADFORMAT "u",
+					       val));
+		TRY0(xmlTextWriterEndElement(writer)); /* bucket */
+#endif
+		break;
+	case isc_statsformat_json:
+#ifdef HAVE_JSON
+		latencyobj = (json_object *) dumparg->arg;
+
+		if (dumparg->histogram == -1 ||
+		    dumparg->histogram / dns_latencyrcode_max != (int)source) {
+			sourceobj = json_object_new_object();
+			if (sourceobj == NULL)
+				goto nomem;
+			json_object_object_add(latencyobj,
+					       latencysource_names[source],
+					       sourceobj);
+			dumparg->sourceobj = sourceobj;
+		}
+		sourceobj = dumparg->sourceobj;
+
+		if (histogram != dumparg->histogram) {
+			bucketlist = json_object_new_array();
+			if (bucketlist == NULL)
+				goto nomem;
+			json_object_object_add(sourceobj,
+					       latencyrcode_names[rcode],
+					       bucketlist);
+			dumparg->bucketlist = bucketlist;
+		}
+		bucketlist = dumparg->bucketlist;
+
+		bucketobj = json_object_new_object();
+		if (bucketobj == NULL)
+			goto nomem;
+		json_object_array_add(bucketlist, bucketobj);
+
+		obj = json_object_new_int64(lo);
+		if (obj == NULL)
+			goto nomem;
+		json_object_object_add(bucketobj, "lo", obj);
+		if (hi != 0) {
+			obj = json_object_new_int64(hi);
+			if (obj == NULL)
+				goto nomem;
+			json_object_object_add(bucketobj, "hi", obj);
+		}
+		obj = json_object_new_int64(val);
+		if (obj == NULL)
+			goto nomem;
+		json_object_object_add(bucketobj, "count", obj);
+#endif
+		break;
+	}
+	dumparg->histogram = histogram;
+	return;
+
+#ifdef HAVE_LIBXML2
+ error:
+	isc_log_write(ns_g_lctx, NS_LOGCATEGORY_GENERAL, NS_LOGMODULE_SERVER,
+		      ISC_LOG_ERROR, "failed at latencystat_dump()");
+	dumparg->result = ISC_R_FAILURE;
+	return;
+#endif
+#ifdef HAVE_JSON
+ nomem:
+	dumparg->result = ISC_R_NOMEMORY;
+	return;
+#endif
+}
+
 #ifdef HAVE_LIBXML2
 /*
  * Which statistics to include when rendering to XML
@@ -1007,6 +1168,7 @@ generatexml(ns_server_t *server, isc_uint32_t flags,
 	isc_uint64_t adbstat_values[dns_adbstats_max];
 	isc_uint64_t zonestat_values[dns_zonestatscounter_max];
 	isc_uint64_t sockstat_values[isc_sockstatscounter_max];
+	isc_uint64_t numastat_values[ns_numastatscounter_max];
 	isc_result_t result;
 
 	isc_time_now(&now);
@@ -1022,7 +1184,7 @@ generatexml(ns_server_t *server, isc_uint32_t flags,
 			ISC_XMLCHAR "type=\"text/xsl\" href=\"/bind9.xsl\""));
 	TRY0(xmlTextWriterStartElement(writer, ISC_XMLCHAR "statistics"));
 	TRY0(xmlTextWriterWriteAttribute(writer, ISC_XMLCHAR "version",
-					 ISC_XMLCHAR "3.5"));
+					 ISC_XMLCHAR "3.7"));
 
 	/* Set common fields for statistics dump */
 	dumparg.type = isc_statsformat_xml;
@@ -1079,6 +1241,19 @@ generatexml(ns_server_t *server, isc_uint32_t flags,
 
 		TRY0(xmlTextWriterEndElement(writer)); /* /nsstat */
 
+		TRY0(xmlTextWriterStartElement(writer, ISC_XMLCHAR "counters"));
+		TRY0(xmlTextWriterWriteAttribute(writer, ISC_XMLCHAR "type",
+						 ISC_XMLCHAR "numastat"));
+
+		result = dump_counters(server->numastats, isc_statsformat_xml,
+				       writer, NULL, numastats_desc,
+				       ns_numastatscounter_max,
+				       numastats_index, numastat_values, 0);
+		if (result != ISC_R_SUCCESS)
+			goto error;
+
+		TRY0(xmlTextWriterEndElement(writer)); /* /numastat */
+
 		TRY0(xmlTextWriterStartElement(writer, ISC_XMLCHAR "counters"));
 		TRY0(xmlTextWriterWriteAttribute(writer, ISC_XMLCHAR "type",
 						 ISC_XMLCHAR "zonestat"));
@@ -1225,6 +1400,36 @@ generatexml(ns_server_t *server, isc_uint32_t flags,
 		TRY0(dns_cache_renderxml(view->cache, writer));
 		TRY0(xmlTextWriterEndElement(writer)); /* </cachestats> */
 
+		/* <dampening> */
+		if (view->dampening != NULL) {
+			TRY0(xmlTextWriterStartElement(writer,
+						       ISC_XMLCHAR "counters"));
+			TRY0(xmlTextWriterWriteAttribute(writer,
+							 ISC_XMLCHAR "type",
+							 ISC_XMLCHAR "dampening"));
+			TRY0(dns_dampening_renderxml(view->dampening, writer));
+			TRY0(xmlTextWriterEndElement(writer)); /* </dampening> */
+		}
+
+		/* <latency> */
+		if (view->latencystats != NULL) {
+			latency_dumparg_t latencyarg;
+
+			TRY0(xmlTextWriterStartElement(writer,
+						       ISC_XMLCHAR "latency"));
+			latencyarg.type = isc_statsformat_xml;
+			latencyarg.arg = writer;
+			latencyarg.histogram = -1;
+			latencyarg.result = ISC_R_SUCCESS;
+			dns_latencystats_dump(view->latencystats,
+					      latencystat_dump, &latencyarg, 0);
+			if (latencyarg.result != ISC_R_SUCCESS)
+				goto error;
+			if (latencyarg.histogram != -1)
+				TRY0(xmlTextWriterEndElement(writer));
+			TRY0(xmlTextWriterEndElement(writer)); /* </latency> */
+		}
+
 		TRY0(xmlTextWriterEndElement(writer)); /* view */
 
 		view = ISC_LIST_NEXT(view, link);
@@ -1548,6 +1753,7 @@ generatejson(ns_server_t *server, size_t *msglen,
 	isc_uint64_t adbstat_values[dns_adbstats_max];
 	isc_uint64_t zonestat_values[dns_zonestatscounter_max];
 	isc_uint64_t sockstat_values[isc_sockstatscounter_max];
+	isc_uint64_t numastat_values[ns_numastatscounter_max];
 	stats_dumparg_t dumparg;
 	char boottime[sizeof "yyyy-mm-ddThh:mm:ssZ"];
 	char configtime[sizeof "yyyy-mm-ddThh:mm:ssZ"];
@@ -1565,7 +1771,7 @@ generatejson(ns_server_t *server, size_t *msglen,
 	/*
 	 * These statistics are included no matter which URL we use.
 	 */
-	obj = json_object_new_string("1.0");
+	obj = json_object_new_string("1.2");
 	CHECKMEM(obj);
 	json_object_object_add(bindstats, "json-stats-version", obj);
 
@@ -1647,6 +1853,27 @@ generatejson(ns_server_t *server, size_t *msglen,
 		else
 			json_object_put(counters);
 
+		/* per NUMA node counters */
+		counters = json_object_new_object();
+
+		dumparg.result = ISC_R_SUCCESS;
+		dumparg.arg = counters;
+
+		result = dump_counters(server->numastats, isc_statsformat_json,
+			       counters, NULL, numastats_desc,
+			       ns_numastatscounter_max,
+			       numastats_index, numastat_values, 0);
+		if (result != ISC_R_SUCCESS) {
+			json_object_put(counters);
+			goto error;
+		}
+
+		if (json_object_get_object(counters)->count != 0)
+			json_object_object_add(bindstats, "numastats",
+					       counters);
+		else
+			json_object_put(counters);
+
 		/* zone stat counters */
 		counters = json_object_new_object();
 
@@ -1804,6 +2031,48 @@ generatejson(ns_server_t *server, size_t *msglen,
 				json_object_object_add(res, "cachestats",
 						       counters);
 
+				if (view->dampening != NULL) {
+					counters = json_object_new_object();
+					CHECKMEM(counters);
+
+					result = dns_dampening_renderjson(
+							view->dampening,
+							counters);
+					if (result != ISC_R_SUCCESS) {
+						json_object_put(counters);
+						goto error;
+					}
+
+					json_object_object_add(res,
+							       "dampening",
+							       counters);
+				}
+
+				if (view->latencystats != NULL) {
+					latency_dumparg_t latencyarg;
+
+					counters = json_object_new_object();
+					CHECKMEM(counters);
+
+					latencyarg.type = isc_statsformat_json;
+					latencyarg.arg = counters;
+					latencyarg.histogram = -1;
+					latencyarg.sourceobj = NULL;
+					latencyarg.bucketlist = NULL;
+					latencyarg.result = ISC_R_SUCCESS;
+					dns_latencystats_dump(view->latencystats,
+							      latencystat_dump,
+							      &latencyarg, 0);
+					if (latencyarg.result != ISC_R_SUCCESS) {
+						json_object_put(counters);
+						result = latencyarg.result;
+						goto error;
+					}
+
+					json_object_object_add(res, "latency",
+							       counters);
+				}
+
 				istats = view->adbstats;
 				if (istats != NULL) {
 					counters = json_object_new_object();
@@ -2040,6 +2309,851 @@ render_json_net(const char *url, isc_httpdurl_t *urlinfo,
 }
 #endif /* HAVE_JSON */
 
+/*
+ * Which statistics to include when rendering OpenMetrics text
+ */
+#define STATS_METRICS_SERVER	0x01
+#define STATS_METRICS_VIEWS	0x02
+#define STATS_METRICS_ZONES	0x04
+#define STATS_METRICS_MEM	0x08
+#define STATS_METRICS_NET	0x10
+#define STATS_METRICS_ALL	0xff
+
+/*%
+ * Body size for the first scrape of a listener.  Later scrapes start
+ * from the size of the previous response, so the body is normally
+ * allocated once.
+ */
+#define METRICS_INITSIZE	16384
+
+/*%
+ * The text is written straight into a single buffer, one sample per line,
+ * which is handed to the HTTP layer as the response body.
+ */
+typedef struct metrics {
+	isc_mem_t		*mctx;
+	char			*base;
+	size_t			size;
+	size_t			used;
+	const char		*family;	/* current metric family */
+	const char		*suffix;	/* sample name suffix */
+	const char		*view;		/* label on every sample */
+	const char		*zone;		/* label on every sample */
+	isc_boolean_t		haslabels;
+	int			histogram;	/* latency: current series */
+	isc_uint64_t		cumulative;	/* latency: running bucket sum */
+	size_t			mark;		/* latency: end of last
+						   non-empty bucket */
+	isc_uint64_t		latencysum[dns_latencysource_max *
+					   dns_latencyrcode_max];
+	isc_result_t		result;
+} metrics_t;
+
+static void
+metrics_grow(metrics_t *m, size_t needed) {
+	size_t newsize;
+	char *newbase;
+
+	newsize = m->size;
+	while (newsize - m->used < needed)
+		newsize *= 2;
+
+	newbase = isc_mem_get(m->mctx, newsize);
+	if (newbase == NULL) {
+		m->result = ISC_R_NOMEMORY;
+		return;
+	}
+	memmove(newbase, m->base, m->used);
+	isc_mem_put(m->mctx, m->base, m->size);
+	m->base = newbase;
+	m->size = newsize;
+}
+
+static void
+metrics_putmem(metrics_t *m, const char *p, size_t len) {
+	if (m->result == ISC_R_SUCCESS && m->size - m->used < len)
+		metrics_grow(m, len);
+	if (m->result != ISC_R_SUCCESS)
+		return;
+	memmove(m->base + m->used, p, len);
+	m->used += len;
+}
+
+static void
+metrics_printf(metrics_t *m, const char *fmt, ...) ISC_FORMAT_PRINTF(2, 3);
+
+static void
+metrics_printf(metrics_t *m, const char *fmt, ...) {
+	va_list ap;
+	int n;
+
+	while (m->result == ISC_R_SUCCESS) {
+		va_start(ap, fmt);
+		n = vsnprintf(m->base + m->used, m->size - m->used, fmt, ap);
+		va_end(ap);
+		if (n < 0) {
+			m->result = ISC_R_FAILURE;
+			return;
+		}
+		if ((size_t)n < m->size - m->used) {
+			m->used += n;
+			return;
+		}
+		metrics_grow(m, (size_t)n + 1);
+	}
+}
+
+/*%
+ * Start a metric family.  Counter samples carry the "_total" suffix.
+ */
+static void
+metrics_family(metrics_t *m, const char *family, const char *type,
+	       const char *help)
+{
+	m->family = family;
+	m->suffix = (strcmp(type, "counter") == 0) ? "_total" : "";
+	metrics_printf(m, "# TYPE %s %s\n# HELP %s %s\n",
+		       family, type, family, help);
+}
+
+static void
+metrics_label(metrics_t *m, const char *name, const char *value) {
+	const char *s, *e;
+
+	metrics_printf(m, "%c%s=\"", m->haslabels ? ',' : '{', name);
+	m->haslabels = ISC_TRUE;
+
+	for (s = value; *s != '\0'; s = e + 1) {
+		e = s + strcspn(s, "\\\"\n");
+		metrics_putmem(m, s, e - s);
+		if (*e == '\0')
+			break;
+		metrics_putmem(m, "\\", 1);
+		metrics_putmem(m, (*e == '\n') ? "n" : e, 1);
+	}
+	metrics_putmem(m, "\"", 1);
+}
+
+static void
+metrics_begin(metrics_t *m) {
+	metrics_printf(m, "%s%s", m->family, m->suffix);
+	m->haslabels = ISC_FALSE;
+	if (m->view != NULL)
+		metrics_label(m, "view", m->view);
+	if (m->zone != NULL)
+		metrics_label(m, "zone", m->zone);
+}
+
+static void
+metrics_value(metrics_t *m, isc_uint64_t value) {
+	metrics_printf(m, "%s %" ISC_PRINT_QUADFORMAT "u\n",
+		       m->haslabels ? "}" : "", value);
+}
+
+static void
+metrics_sample(metrics_t *m, const char *label, const char *name,
+	       isc_uint64_t value)
+{
+	metrics_begin(m);
+	if (label != NULL)
+		metrics_label(m, label, name);
+	metrics_value(m, value);
+}
+
+static void
+metrics_counters(metrics_t *m, isc_stats_t *stats, const char **desc,
+		 int ncounters, int *indices, isc_uint64_t *values,
+		 int options)
+{
+	stats_dumparg_t dumparg;
+	int i, index;
+
+	dumparg.type = isc_statsformat_file;
+	dumparg.ncounters = ncounters;
+	dumparg.counterindices = indices;
+	dumparg.countervalues = values;
+
+	memset(values, 0, sizeof(values[0]) * ncounters);
+	isc_stats_dump(stats, generalstat_dump, &dumparg, options);
+
+	for (i = 0; i < ncounters; i++) {
+		index = indices[i];
+		if (values[index] == 0 &&
+		    (options & ISC_STATSDUMP_VERBOSE) == 0)
+			continue;
+		metrics_sample(m, "name", desc[index], values[index]);
+	}
+}
+
+/*
+ * Render the per NUMA node request counters with the node and whether
+ * the requests were handled on it as labels.  Nodes which saw no
+ * requests are left out.
+ */
+static void
+metrics_numa(metrics_t *m, isc_stats_t *stats, isc_uint64_t *values) {
+	stats_dumparg_t dumparg;
+	char nodebuf[sizeof("99")];
+	isc_uint64_t local, remote;
+	int node;
+
+	dumparg.type = isc_statsformat_file;
+	dumparg.ncounters = ns_numastatscounter_max;
+	dumparg.counterindices = numastats_index;
+	dumparg.countervalues = values;
+
+	memset(values, 0, sizeof(values[0]) * ns_numastatscounter_max);
+	isc_stats_dump(stats, generalstat_dump, &dumparg,
+		       ISC_STATSDUMP_VERBOSE);
+
+	metrics_family(m, "bind_numa_requests", "counter",
+		       "Requests by the NUMA node of their interface, "
+		       "handled on a worker of that node or not.");
+	for (node = 0; node < NS_NUMA_MAXNODES; node++) {
+		local = values[ns_numastatscounter(node,
+				ns_numastatscounter_local)];
+		remote = values[ns_numastatscounter(node,
+				ns_numastatscounter_remote)];
+		if (local == 0 && remote == 0)
+			continue;
+		snprintf(nodebuf, sizeof(nodebuf), "%d", node);
+		metrics_begin(m);
+		metrics_label(m, "node", nodebuf);
+		metrics_label(m, "placement", "local");
+		metrics_value(m, local);
+		metrics_begin(m);
+		metrics_label(m, "node", nodebuf);
+		metrics_label(m, "placement", "remote");
+		metrics_value(m, remote);
+	}
+}
+
+static void
+metrics_rdtype(dns_rdatastatstype_t type, isc_uint64_t val, void *arg) {
+	metrics_t *m = arg;
+	char typebuf[64];
+	const char *typestr;
+
+	if ((DNS_RDATASTATSTYPE_ATTR(type) & DNS_RDATASTATSTYPE_ATTR_OTHERTYPE)
+	    == 0) {
+		dns_rdatatype_format(DNS_RDATASTATSTYPE_BASE(type), typebuf,
+				     sizeof(typebuf));
+		typestr = typebuf;
+	} else
+		typestr = "Others";
+
+	metrics_sample(m, "type", typestr, val);
+}
+
+static void
+metrics_rdataset(dns_rdatastatstype_t type, isc_uint64_t val, void *arg) {
+	metrics_t *m = arg;
+	char typebuf[64];
+	const char *typestr;
+	unsigned int attr = DNS_RDATASTATSTYPE_ATTR(type);
+
+	if ((attr & DNS_RDATASTATSTYPE_ATTR_NXDOMAIN) != 0)
+		typestr = "NXDOMAIN";
+	else if ((attr & DNS_RDATASTATSTYPE_ATTR_OTHERTYPE) != 0)
+		typestr = "Others";
+	else {
+		dns_rdatatype_format(DNS_RDATASTATSTYPE_BASE(type), typebuf,
+				     sizeof(typebuf));
+		typestr = typebuf;
+	}
+
+	metrics_begin(m);
+	metrics_label(m, "type", typestr);
+	metrics_label(m, "nxrrset",
+		      (attr & DNS_RDATASTATSTYPE_ATTR_NXRRSET) != 0 ?
+		      "1" : "0");
+	metrics_label(m, "stale",
+		      (attr & DNS_RDATASTATSTYPE_ATTR_STALE) != 0 ?
+		      "1" : "0");
+	metrics_value(m, val);
+}
+
+static void
+metrics_opcode(dns_opcode_t code, isc_uint64_t val, void *arg) {
+	metrics_t *m = arg;
+	isc_buffer_t b;
+	char codebuf[64];
+
+	isc_buffer_init(&b, codebuf, sizeof(codebuf) - 1);
+	dns_opcode_totext(code, &b);
+	codebuf[isc_buffer_usedlength(&b)] = '\0';
+
+	metrics_sample(m, "opcode", codebuf, val);
+}
+
+/*%
+ * Close the current latency series: drop the empty buckets after its last
+ * non-empty one, or the whole series if it is empty, and add the "+Inf"
+ * bucket, the sum and the count.
+ */
+static void
+metrics_latencyend(metrics_t *m) {
+	int source = m->histogram / dns_latencyrcode_max;
+	int rcode = m->histogram % dns_latencyrcode_max;
+	isc_uint64_t sum = m->latencysum[m->histogram];
+
+	if (m->result == ISC_R_SUCCESS)
+		m->used = m->mark;
+	if (m->cumulative == 0)
+		return;
+
+	m->suffix = "_bucket";
+	metrics_begin(m);
+	metrics_label(m, "source", latencysource_names[source]);
+	metrics_label(m, "rcode", latencyrcode_names[rcode]);
+	metrics_label(m, "le", "+Inf");
+	metrics_value(m, m->cumulative);
+
+	m->suffix = "_sum";
+	metrics_begin(m);
+	metrics_label(m, "source", latencysource_names[source]);
+	metrics_label(m, "rcode", latencyrcode_names[rcode]);
+	metrics_printf(m, "} %" ISC_PRINT_QUADFORMAT "u.%06u\n",
+		       sum / 1000000, (unsigned int)(sum % 1000000));
+
+	m->suffix = "_count";
+	metrics_begin(m);
+	metrics_label(m, "source", latencysource_names[source]);
+	metrics_label(m, "rcode", latencyrcode_names[rcode]);
+	metrics_value(m, m->cumulative);
+}
+
+static void
+metrics_latencysum(dns_latencysource_t source, dns_latencyrcode_t rcode,
+		   isc_uint64_t usec, void *arg)
+{
+	metrics_t *m = arg;
+
+	m->latencysum[source * dns_latencyrcode_max + rcode] = usec;
+}
+
+/*%
+ * The buckets are dumped including the empty ones, so that every series
+ * lists the same boundaries; metrics_latencyend() cuts each series off
+ * after the last boundary its queries reached.  The open-ended last
+ * bucket is covered by "+Inf".
+ */
+static void
+metrics_latency(dns_latencysource_t source, dns_latencyrcode_t rcode,
+		isc_uint64_t lo, isc_uint64_t hi, isc_uint64_t val, void *arg)
+{
+	metrics_t *m = arg;
+	int histogram = source * dns_latencyrcode_max + rcode;
+	char le[32];
+
+	UNUSED(lo);
+
+	if (histogram != m->histogram) {
+		if (m->histogram != -1)
+			metrics_latencyend(m);
+		m->histogram = histogram;
+		m->cumulative = 0;
+		m->mark = m->used;
+	}
+
+	m->cumulative += val;
+	if (hi == 0) {
+		if (val != 0)
+			m->mark = m->used;
+		return;
+	}
+
+	snprintf(le, sizeof(le), "%" ISC_PRINT_QUADFORMAT "u.%06u",
+		 hi / 1000000, (unsigned int)(hi % 1000000));
+
+	m->suffix = "_bucket";
+	metrics_begin(m);
+	metrics_label(m, "source", latencysource_names[source]);
+	metrics_label(m, "rcode", latencyrcode_names[rcode]);
+	metrics_label(m, "le", le);
+	metrics_value(m, m->cumulative);
+	if (val != 0)
+		m->mark = m->used;
+}
+
+/*
+ * The zone label is the bare origin; the class and view are not part of
+ * it, and a '/' in the origin (as in RFC 2317 zones) is kept.
+ */
+static void
+metrics_zonename(dns_zone_t *zone, char *buf, size_t size) {
+	dns_name_format(dns_zone_getorigin(zone), buf, size);
+}
+
+static isc_result_t
+metrics_zoneserial(dns_zone_t *zone, void *arg) {
+	metrics_t *m = arg;
+	char buf[DNS_NAME_FORMATSIZE];
+	isc_uint32_t serial;
+
+	if (dns_zone_getstatlevel(zone) == dns_zonestat_none ||
+	    dns_zone_getserial2(zone, &serial) != ISC_R_SUCCESS)
+		return (ISC_R_SUCCESS);
+
+	metrics_zonename(zone, buf, sizeof(buf));
+	m->zone = buf;
+	metrics_sample(m, NULL, NULL, serial);
+	m->zone = NULL;
+
+	return (m->result);
+}
+
+static isc_result_t
+metrics_zonerequests(dns_zone_t *zone, void *arg) {
+	metrics_t *m = arg;
+	char buf[DNS_NAME_FORMATSIZE];
+	isc_uint64_t nsstat_values[dns_nsstatscounter_max];
+	isc_stats_t *zonestats;
+
+	zonestats = dns_zone_getrequeststats(zone);
+	if (dns_zone_getstatlevel(zone) != dns_zonestat_full ||
+	    zonestats == NULL)
+		return (ISC_R_SUCCESS);
+
+	metrics_zonename(zone, buf, sizeof(buf));
+	m->zone = buf;
+	metrics_counters(m, zonestats, nsstats_xmldesc,
+			 dns_nsstatscounter_max, nsstats_index,
+			 nsstat_values, 0);
+	m->zone = NULL;
+
+	return (m->result);
+}
+
+static isc_result_t
+metrics_zonequeries(dns_zone_t *zone, void *arg) {
+	metrics_t *m = arg;
+	char buf[DNS_NAME_FORMATSIZE];
+	dns_stats_t *rcvquerystats;
+
+	rcvquerystats = dns_zone_getrcvquerystats(zone);
+	if (dns_zone_getstatlevel(zone) != dns_zonestat_full ||
+	    rcvquerystats == NULL)
+		return (ISC_R_SUCCESS);
+
+	metrics_zonename(zone, buf, sizeof(buf));
+	m->zone = buf;
+	dns_rdatatypestats_dump(rcvquerystats, metrics_rdtype, m, 0);
+	m->zone = NULL;
+
+	return (m->result);
+}
+
+static void
+metrics_zones(metrics_t *m, ns_server_t *server, const char *family,
+	      const char *type, const char *help,
+	      isc_result_t (*action)(dns_zone_t *, void *))
+{
+	dns_view_t *view;
+
+	metrics_family(m, family, type, help);
+	for (view = ISC_LIST_HEAD(server->viewlist);
+	     view != NULL && m->result == ISC_R_SUCCESS;
+	     view = ISC_LIST_NEXT(view, link))
+	{
+		m->view = view->name;
+		(void)dns_zt_apply(view->zonetable, ISC_TRUE, action, m);
+	}
+	m->view = NULL;
+}
+
+static isc_boolean_t
+sockstat_isgauge(int counter) {
+	switch (counter) {
+	case isc_sockstatscounter_udp4active:
+	case isc_sockstatscounter_udp6active:
+	case isc_sockstatscounter_tcp4active:
+	case isc_sockstatscounter_tcp6active:
+	case isc_sockstatscounter_unixactive:
+	case isc_sockstatscounter_rawactive:
+		return (ISC_TRUE);
+	default:
+		return (ISC_FALSE);
+	}
+}
+
+/*%
+ * Each metric family is emitted in one piece, as the format requires, so
+ * the per-view and per-zone families each take their own pass over the
+ * views.
+ */
+static void
+generatemetrics(metrics_t *m, ns_server_t *server, isc_uint32_t flags) {
+	isc_uint64_t nsstat_values[dns_nsstatscounter_max];
+	isc_uint64_t resstat_values[dns_resstatscounter_max];
+	isc_uint64_t adbstat_values[dns_adbstats_max];
+	isc_uint64_t zonestat_values[dns_zonestatscounter_max];
+	isc_uint64_t sockstat_values[isc_sockstatscounter_max];
+	isc_uint64_t numastat_values[ns_numastatscounter_max];
+	stats_dumparg_t dumparg;
+	isc_memsummary_t summary;
+	dns_stats_t *cacherrstats;
+	dns_view_t *view;
+	int i, index;
+
+	if ((flags & STATS_METRICS_SERVER) != 0) {
+		metrics_family(m, "bind_boot_time_seconds", "gauge",
+			       "Time the server was started.");
+		metrics_sample(m, NULL, NULL, isc_time_seconds(&ns_g_boottime));
+		metrics_family(m, "bind_config_time_seconds", "gauge",
+			       "Time the configuration was last loaded.");
+		metrics_sample(m, NULL, NULL,
+			       isc_time_seconds(&ns_g_configtime));
+
+		metrics_family(m, "bind_requests", "counter",
+			       "Incoming requests by opcode.");
+		dns_opcodestats_dump(server->opcodestats, metrics_opcode, m,
+				     ISC_STATSDUMP_VERBOSE);
+
+		metrics_family(m, "bind_incoming_queries", "counter",
+			       "Incoming queries by RR type.");
+		dns_rdatatypestats_dump(server->rcvquerystats, metrics_rdtype,
+					m, 0);
+
+		/*
+		 * The recursing clients counter goes up and down, so it gets
+		 * its own gauge family.
+		 */
+		metrics_family(m, "bind_nsstats", "counter",
+			       "Name server statistics.");
+		dumparg.type = isc_statsformat_file;
+		dumparg.ncounters = dns_nsstatscounter_max;
+		dumparg.counterindices = nsstats_index;
+		dumparg.countervalues = nsstat_values;
+		memset(nsstat_values, 0, sizeof(nsstat_values));
+		isc_stats_dump(server->nsstats, generalstat_dump, &dumparg,
+			       ISC_STATSDUMP_VERBOSE);
+		for (i = 0; i < dns_nsstatscounter_max; i++) {
+			index = nsstats_index[i];
+			if (index == dns_nsstatscounter_recursclients)
+				continue;
+			metrics_sample(m, "name", nsstats_xmldesc[index],
+				       nsstat_values[index]);
+		}
+		metrics_family(m, "bind_recursive_clients", "gauge",
+			       "Clients currently waiting on recursion.");
+		metrics_sample(m, NULL, NULL,
+			nsstat_values[dns_nsstatscounter_recursclients]);
+
+		metrics_numa(m, server->numastats, numastat_values);
+
+		metrics_family(m, "bind_log_dropped", "counter",
+			       "Log lines dropped by full asynchronous "
+			       "channels.");
+		metrics_sample(m, NULL, NULL, isc_log_getdropped(ns_g_lctx));
+
+		metrics_family(m, "bind_zonestats", "counter",
+			       "Zone maintenance statistics.");
+		metrics_counters(m, server->zonestats, zonestats_xmldesc,
+				 dns_zonestatscounter_max, zonestats_index,
+				 zonestat_values, ISC_STATSDUMP_VERBOSE);
+
+		/*
+		 * Most of the common resolver statistics entries are 0, so
+		 * we don't use the verbose dump here.
+		 */
+		metrics_family(m, "bind_resstats", "counter",
+			       "Common resolver statistics.");
+		metrics_counters(m, server->resolverstats, resstats_xmldesc,
+				 dns_resstatscounter_max, resstats_index,
+				 resstat_values, 0);
+	}
+
+	if ((flags & STATS_METRICS_VIEWS) != 0) {
+		metrics_family(m, "bind_view_resolver", "counter",
+			       "Per-view resolver statistics.");
+		for (view = ISC_LIST_HEAD(server->viewlist); view != NULL;
+		     view = ISC_LIST_NEXT(view, link))
+		{
+			if (view->resstats == NULL)
+				continue;
+			m->view = view->name;
+			metrics_counters(m, view->resstats, resstats_xmldesc,
+					 dns_resstatscounter_max,
+					 resstats_index, resstat_values,
+					 ISC_STATSDUMP_VERBOSE);
+		}
+		m->view = NULL;
+
+		metrics_family(m, "bind_view_outgoing_queries", "counter",
+			       "Outgoing queries by RR type.");
+		for (view = ISC_LIST_HEAD(server->viewlist); view != NULL;
+		     view = ISC_LIST_NEXT(view, link))
+		{
+			if (view->resquerystats == NULL)
+				continue;
+			m->view = view->name;
+			dns_rdatatypestats_dump(view->resquerystats,
+						metrics_rdtype, m, 0);
+		}
+		m->view = NULL;
+
+		metrics_family(m, "bind_view_cache_rrsets", "gauge",
+			       "RRsets in the cache database by type.");
+		for (view = ISC_LIST_HEAD(server->viewlist); view != NULL;
+		     view = ISC_LIST_NEXT(view, link))
+		{
+			cacherrstats = dns_db_getrrsetstats(view->cachedb);
+			if (cacherrstats == NULL)
+				continue;
+			m->view = view->name;
+			dns_rdatasetstats_dump(cacherrstats, metrics_rdataset,
+					       m, 0);
+		}
+		m->view = NULL;
+
+		metrics_family(m, "bind_view_adb", "gauge",
+			       "Address database statistics.");
+		for (view = ISC_LIST_HEAD(server->viewlist); view != NULL;
+		     view = ISC_LIST_NEXT(view, link))
+		{
+			if (view->adbstats == NULL)
+				continue;
+			m->view = view->name;
+			metrics_counters(m, view->adbstats, adbstats_xmldesc,
+					 dns_adbstats_max, adbstats_index,
+					 adbstat_values, ISC_STATSDUMP_VERBOSE);
+		}
+		m->view = NULL;
+
+		metrics_family(m, "bind_query_latency_seconds", "histogram",
+			       "Time from receiving a query to sending "
+			       "the response.");
+		for (view = ISC_LIST_HEAD(server->viewlist); view != NULL;
+		     view = ISC_LIST_NEXT(view, link))
+		{
+			if (view->latencystats == NULL)
+				continue;
+			m->view = view->name;
+			m->histogram = -1;
+			memset(m->latencysum, 0, sizeof(m->latencysum));
+			dns_latencystats_dumpsums(view->latencystats,
+						  metrics_latencysum, m, 0);
+			dns_latencystats_dump(view->latencystats,
+					      metrics_latency, m,
+					      ISC_STATSDUMP_VERBOSE);
+			if (m->histogram != -1)
+				metrics_latencyend(m);
+		}
+		m->view = NULL;
+	}
+
+	if ((flags & STATS_METRICS_ZONES) != 0) {
+		metrics_zones(m, server, "bind_zone_serial", "gauge",
+			      "SOA serial of the zone.", metrics_zoneserial);
+		metrics_zones(m, server, "bind_zone_requests", "counter",
+			      "Per-zone name server statistics.",
+			      metrics_zonerequests);
+		metrics_zones(m, server, "bind_zone_incoming_queries",
+			      "counter", "Per-zone incoming queries by RR type.",
+			      metrics_zonequeries);
+	}
+
+	if ((flags & STATS_METRICS_MEM) != 0) {
+		isc_mem_summary(&summary);
+
+		metrics_family(m, "bind_memory_total_bytes", "gauge",
+			       "Memory obtained from the system.");
+		metrics_sample(m, NULL, NULL, summary.total);
+		metrics_family(m, "bind_memory_in_use_bytes", "gauge",
+			       "Memory in use.");
+		metrics_sample(m, NULL, NULL, summary.inuse);
+		metrics_family(m, "bind_memory_block_bytes", "gauge",
+			       "Memory held in internal allocator blocks.");
+		metrics_sample(m, NULL, NULL, summary.blocksize);
+		metrics_family(m, "bind_memory_huge_page_bytes", "gauge",
+			       "Memory held on huge pages.");
+		metrics_sample(m, NULL, NULL, summary.hugesize);
+		metrics_family(m, "bind_memory_context_bytes", "gauge",
+			       "Memory used by the memory contexts themselves.");
+		metrics_sample(m, NULL, NULL, summary.contextsize);
+		metrics_family(m, "bind_memory_lost_bytes", "gauge",
+			       "Memory lost by destroyed contexts.");
+		metrics_sample(m, NULL, NULL, summary.lost);
+		metrics_family(m, "bind_memory_contexts", "gauge",
+			       "Number of memory contexts.");
+		metrics_sample(m, NULL, NULL, summary.contexts);
+	}
+
+	if ((flags & STATS_METRICS_NET) != 0) {
+		dumparg.type = isc_statsformat_file;
+		dumparg.ncounters = isc_sockstatscounter_max;
+		dumparg.counterindices = sockstats_index;
+		dumparg.countervalues = sockstat_values;
+		memset(sockstat_values, 0, sizeof(sockstat_values));
+		isc_stats_dump(server->sockstats, generalstat_dump, &dumparg,
+			       ISC_STATSDUMP_VERBOSE);
+
+		metrics_family(m, "bind_sockets", "counter",
+			       "Socket I/O statistics.");
+		for (i = 0; i < isc_sockstatscounter_max; i++) {
+			index = sockstats_index[i];
+			if (!sockstat_isgauge(index))
+				metrics_sample(m, "name",
+					       sockstats_xmldesc[index],
+					       sockstat_values[index]);
+		}
+
+		metrics_family(m, "bind_sockets_active", "gauge",
+			       "Sockets currently open.");
+		for (i = 0; i < isc_sockstatscounter_max; i++) {
+			index = sockstats_index[i];
+			if (sockstat_isgauge(index))
+				metrics_sample(m, "name",
+					       sockstats_xmldesc[index],
+					       sockstat_values[index]);
+		}
+	}
+
+	metrics_printf(m, "# EOF\n");
+}
+
+static void
+metrics_free(isc_buffer_t *buffer, void *arg) {
+	isc_mem_t *mctx = arg;
+	void *base = isc_buffer_base(buffer);
+
+	isc_mem_put(mctx, base, isc_buffer_length(buffer));
+}
+
+static isc_result_t
+render_metrics(isc_uint32_t flags, const char *url, isc_httpdurl_t *urlinfo,
+	       const char *querystring, const char *headers, void *arg,
+	       unsigned int *retcode, const char **retmsg,
+	       const char **mimetype, isc_buffer_t *b,
+	       isc_httpdfree_t **freecb, void **freecb_args)
+{
+	ns_statschannel_t *listener = arg;
+	metrics_t m;
+
+	UNUSED(url);
+	UNUSED(urlinfo);
+	UNUSED(headers);
+	UNUSED(querystring);
+
+	memset(&m, 0, sizeof(m));
+	m.mctx = listener->mctx;
+	m.histogram = -1;
+	m.result = ISC_R_SUCCESS;
+
+	LOCK(&listener->lock);
+	m.size = listener->metricsize;
+	UNLOCK(&listener->lock);
+
+	m.base = isc_mem_get(m.mctx, m.size);
+	if (m.base == NULL)
+		return (ISC_R_NOMEMORY);
+
+	generatemetrics(&m, ns_g_server, flags);
+	if (m.result != ISC_R_SUCCESS) {
+		isc_log_write(ns_g_lctx, NS_LOGCATEGORY_GENERAL,
+			      NS_LOGMODULE_SERVER, ISC_LOG_ERROR,
+			      "failed at rendering metrics: %s",
+			      isc_result_totext(m.result));
+		isc_mem_put(m.mctx, m.base, m.size);
+		return (m.result);
+	}
+
+	LOCK(&listener->lock);
+	if (m.size > listener->metricsize)
+		listener->metricsize = m.size;
+	UNLOCK(&listener->lock);
+
+	*retcode = 200;
+	*retmsg = "OK";
+	*mimetype = "application/openmetrics-text; version=1.0.0; "
+		    "charset=utf-8";
+	isc_buffer_reinit(b, m.base, m.size);
+	isc_buffer_add(b, m.used);
+	*freecb = metrics_free;
+	*freecb_args = m.mctx;
+
+	return (ISC_R_SUCCESS);
+}
+
+static isc_result_t
+render_metrics_all(const char *url, isc_httpdurl_t *urlinfo,
+		   const char *querystring, const char *headers, void *arg,
+		   unsigned int *retcode, const char **retmsg,
+		   const char **mimetype, isc_buffer_t *b,
+		   isc_httpdfree_t **freecb, void **freecb_args)
+{
+	return (render_metrics(STATS_METRICS_ALL, url, urlinfo,
+			       querystring, headers, arg,
+			       retcode, retmsg, mimetype, b,
+			       freecb, freecb_args));
+}
+
+static isc_result_t
+render_metrics_server(const char *url, isc_httpdurl_t *urlinfo,
+		      const char *querystring, const char *headers, void *arg,
+		      unsigned int *retcode, const char **retmsg,
+		      const char **mimetype, isc_buffer_t *b,
+		      isc_httpdfree_t **freecb, void **freecb_args)
+{
+	return (render_metrics(STATS_METRICS_SERVER, url, urlinfo,
+			       querystring, headers, arg,
+			       retcode, retmsg, mimetype, b,
+			       freecb, freecb_args));
+}
+
+static isc_result_t
+render_metrics_views(const char *url, isc_httpdurl_t *urlinfo,
+		     const char *querystring, const char *headers, void *arg,
+		     unsigned int *retcode, const char **retmsg,
+		     const char **mimetype, isc_buffer_t *b,
+		     isc_httpdfree_t **freecb, void **freecb_args)
+{
+	return (render_metrics(STATS_METRICS_VIEWS, url, urlinfo,
+			       querystring, headers, arg,
+			       retcode, retmsg, mimetype, b,
+			       freecb, freecb_args));
+}
+
+static isc_result_t
+render_metrics_zones(const char *url, isc_httpdurl_t *urlinfo,
+		     const char *querystring, const char *headers, void *arg,
+		     unsigned int *retcode, const char **retmsg,
+		     const char **mimetype, isc_buffer_t *b,
+		     isc_httpdfree_t **freecb, void **freecb_args)
+{
+	return (render_metrics(STATS_METRICS_ZONES, url, urlinfo,
+			       querystring, headers, arg,
+			       retcode, retmsg, mimetype, b,
+			       freecb, freecb_args));
+}
+
+static isc_result_t
+render_metrics_mem(const char *url, isc_httpdurl_t *urlinfo,
+		   const char *querystring, const char *headers, void *arg,
+		   unsigned int *retcode, const char **retmsg,
+		   const char **mimetype, isc_buffer_t *b,
+		   isc_httpdfree_t **freecb, void **freecb_args)
+{
+	return (render_metrics(STATS_METRICS_MEM, url, urlinfo,
+			       querystring, headers, arg,
+			       retcode, retmsg, mimetype, b,
+			       freecb, freecb_args));
+}
+
+static isc_result_t
+render_metrics_net(const char *url, isc_httpdurl_t *urlinfo,
+		   const char *querystring, const char *headers, void *arg,
+		   unsigned int *retcode, const char **retmsg,
+		   const char **mimetype, isc_buffer_t *b,
+		   isc_httpdfree_t **freecb, void **freecb_args)
+{
+	return (render_metrics(STATS_METRICS_NET, url, urlinfo,
+			       querystring, headers, arg,
+			       retcode, retmsg, mimetype, b,
+			       freecb, freecb_args));
+}
+
 static isc_result_t
 render_xsl(const char *url, isc_httpdurl_t *urlinfo,
 	   const char *querystring, const char *headers,
@@ -2168,6 +3282,7 @@ add_listener(ns_server_t *server, ns_statschannel_t **listenerp,
 	listener->address = *addr;
 	listener->acl = NULL;
 	listener->mctx = NULL;
+	listener->metricsize = METRICS_INITSIZE;
 	ISC_LINK_INIT(listener, link);
 
 	result = isc_mutex_init(&listener->lock);
@@ -2253,6 +3368,18 @@ add_listener(ns_server_t *server, ns_statschannel_t **listenerp,
 	isc_httpdmgr_addurl(listener->httpdmgr, "/json/v1/mem",
 			    render_json_mem, server);
 #endif
+	isc_httpdmgr_addurl(listener->httpdmgr, "/metrics",
+			    render_metrics_all, listener);
+	isc_httpdmgr_addurl(listener->httpdmgr, "/metrics/server",
+			    render_metrics_server, listener);
+	isc_httpdmgr_addurl(listener->httpdmgr, "/metrics/views",
+			    render_metrics_views, listener);
+	isc_httpdmgr_addurl(listener->httpdmgr, "/metrics/zones",
+			    render_metrics_zones, listener);
+	isc_httpdmgr_addurl(listener->httpdmgr, "/metrics/memory",
+			    render_metrics_mem, listener);
+	isc_httpdmgr_addurl(listener->httpdmgr, "/metrics/sockets",
+			    render_metrics_net, listener);
 	isc_httpdmgr_addurl2(listener->httpdmgr, "/bind9.xsl", ISC_TRUE,
 			     render_xsl, server);
 
@@ -2359,7 +3486,8 @@ ns_statschannels_configure(ns_server_t *server, const cfg_obj_t *config,
 #ifndef HAVE_LIBXML2
 		isc_log_write(ns_g_lctx, NS_LOGCATEGORY_GENERAL,
 			      NS_LOGMODULE_SERVER, ISC_LOG_WARNING,
-			      "statistics-channels specified but not effective "
+			      "statistics-channels specified but only "
+			      "OpenMetrics output is available "
 			      "due to missing XML library");
 #endif
 
@@ -2475,6 +3603,7 @@ ns_stats_dump(ns_server_t *server, FILE *fp) {
 	isc_uint64_t adbstat_values[dns_adbstats_max];
 	isc_uint64_t zonestat_values[dns_zonestatscounter_max];
 	isc_uint64_t sockstat_values[isc_sockstatscounter_max];
+	isc_uint64_t numastat_values[ns_numastatscounter_max];
 
 	RUNTIME_CHECK(isc_once_do(&once, init_desc) == ISC_R_SUCCESS);
 
@@ -2511,6 +3640,11 @@ ns_stats_dump(ns_server_t *server, FILE *fp) {
 			     nsstats_desc, dns_nsstatscounter_max,
 			     nsstats_index, nsstat_values, 0);
 
+	fprintf(fp, "++ NUMA Node Statistics ++\n");
+	(void) dump_counters(server->numastats, isc_statsformat_file, fp, NULL,
+			     numastats_desc, ns_numastatscounter_max,
+			     numastats_index, numastat_values, 0);
+
 	fprintf(fp, "++ Zone Maintenance Statistics ++\n");
 	(void) dump_counters(server->zonestats, isc_statsformat_file, fp, NULL,
 			     zonestats_desc, dns_zonestatscounter_max,
@@ -2593,6 +3727,26 @@ ns_stats_dump(ns_server_t *server, FILE *fp) {
 				     adbstats_index, adbstat_values, 0);
 	}
 
+	fprintf(fp, "++ Query Latency ++\n");
+	for (view = ISC_LIST_HEAD(server->viewlist);
+	     view != NULL;
+	     view = ISC_LIST_NEXT(view, link)) {
+		latency_dumparg_t latencyarg;
+
+		if (view->latencystats == NULL)
+			continue;
+		if (strcmp(view->name, "_default") == 0)
+			fprintf(fp, "[View: default]\n");
+		else
+			fprintf(fp, "[View: %s]\n", view->name);
+		latencyarg.type = isc_statsformat_file;
+		latencyarg.arg = fp;
+		latencyarg.histogram = -1;
+		latencyarg.result = ISC_R_SUCCESS;
+		dns_latencystats_dump(view->latencystats, latencystat_dump,
+				      &latencyarg, 0);
+	}
+
 	fprintf(fp, "++ Socket I/O Statistics ++\n");
 	(void) dump_counters(server->sockstats, isc_statsformat_file, fp, NULL,
 			     sockstats_desc, isc_sockstatscounter_max,
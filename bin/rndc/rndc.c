@@ -128,6 +128,8 @@ command is one of the following:\n\
 		Update keys without signing immediately.\n\
   zonestatus zone [class [view]]\n\
 		Display the current status of a zone.\n\
+  dampening-dump [count] [view]\n\
+		List the netblocks with the highest dampening penalties.\n\
   stats		Write server statistics to the statistics file.\n\
   querylog newstate\n\
 		Enable / disable query logging.\n\
@@ -0,0 +1,301 @@
+/*
+ * Copyright (C) 2014  Internet Systems Consortium, Inc. ("ISC")
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS.  IN NO EVENT SHALL ISC BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE
+ * OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * Microbenchmark of the dampening penalty decay. It compares the former
+ * floating point exp() computation with the fixed point decay table and
+ * measures the query path when every update has to decay the penalty.
+ *
+ * The storage implementations are compared on a spoofed source workload:
+ * every tenth query comes from a single attacking prefix, the others from
+ * random prefixes out of 2^24.
+ *
+ * Usage: dampening_test [-n iterations] [-h halflife] [-t table size]
+ */
+
+#include <config.h>
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <isc/commandline.h>
+#include <isc/mem.h>
+#include <isc/sockaddr.h>
+#include <isc/time.h>
+#include <isc/util.h>
+
+#include <dns/dampening.h>
+#include <dns/view.h>
+
+static volatile unsigned int sink;
+
+static unsigned int
+decay_exp(unsigned int penalty, unsigned int elapsed, int halflife) {
+	float p = penalty;
+
+	p *= exp(-(0.693 * elapsed) / halflife);
+	return ((unsigned int)p);
+}
+
+static dns_view_t *
+setup(isc_mem_t *mctx, unsigned int storage, int size, int halflife) {
+	dns_view_t *view = NULL;
+	dns_dampening_t *damp;
+
+	RUNTIME_CHECK(dns_view_create(mctx, dns_rdataclass_in, "bench",
+				      &view) == ISC_R_SUCCESS);
+	RUNTIME_CHECK(dns_dampening_init(view, size, size, 1, storage) ==
+		      ISC_R_SUCCESS);
+	damp = view->dampening;
+	dns_dampening_setdecay(damp, halflife, 0);
+	damp->prefixlen.ipv4 = 24;
+	damp->prefixlen.ipv6 = 48;
+	damp->limit.maximum = 32000;
+	damp->limit.enable_dampening = 25600;
+	damp->limit.disable_dampening = 9600;
+	damp->limit.irrelevant = 0;
+	damp->score.first_query = 10;
+	damp->score.per_query = 1000;
+	return (view);
+}
+
+static void
+report(const char *what, const isc_time_t *start, unsigned int n) {
+	isc_time_t end;
+	isc_uint64_t us;
+
+	RUNTIME_CHECK(isc_time_now(&end) == ISC_R_SUCCESS);
+	us = isc_time_microdiff(&end, start);
+	printf("%-24s %10u ops %8.1f ns/op\n", what, n,
+	       (double)us * 1000.0 / n);
+}
+
+/*
+ * A query which promotes its prefix out of the sketch keeps the reference
+ * to the sketch estimate in its handle. Scoring the response with it must
+ * not promote the prefix a second time.
+ */
+static void
+check_promotion(isc_mem_t *mctx) {
+	dns_view_t *view;
+	dns_dampening_t *damp;
+	dns_dampening_handle_t handle;
+	dns_dampening_stats_t stats;
+	isc_sockaddr_t addr;
+	struct in_addr in;
+	int i;
+
+	view = setup(mctx, DNS_DAMPENING_STORAGE_SKETCH, 1000, 600);
+	damp = view->dampening;
+	damp->score.minimum_size = 512;
+	damp->score.maximum_size = 4096;
+	damp->score.size_penalty = 0;
+	in.s_addr = htonl(0xc0000201);
+	isc_sockaddr_fromin(&addr, &in, 53);
+
+	/* Stay just below limit-enable-dampening, the next query promotes */
+	for (i = 0; i < 26; i++)
+		(void)dns_dampening_query(damp, &addr, 1000, NULL, NULL);
+	dns_dampening_handle_init(&handle);
+	(void)dns_dampening_query(damp, &addr, 1000, NULL, &handle);
+	dns_dampening_score_size(damp, &addr, 1000, 512, &handle);
+
+	dns_dampening_getstats(damp, &stats);
+	printf("sketch promotion %lu heavy hitters for one prefix\n",
+	       (unsigned long)stats.entries);
+	RUNTIME_CHECK(stats.entries == 1);
+	dns_view_detach(&view);
+}
+
+/*
+ * Queries dropped by the early drop filter must reach the denied counters
+ * of the table, even if the prefix is never published again. A view of a
+ * shared table is released while the filter holds drops for it.
+ */
+static void
+check_filter(isc_mem_t *mctx) {
+	dns_view_t *view = NULL;
+	dns_dampening_t *store = NULL;
+	dns_dampening_filter_t *filter = NULL;
+	dns_dampening_stats_t stats;
+	isc_sockaddr_t addr;
+	struct in_addr in;
+	isc_uint64_t denied;
+	int i;
+
+	RUNTIME_CHECK(dns_dampening_create(mctx, 1000, 1000, 1,
+					   DNS_DAMPENING_STORAGE_QUEUE,
+					   &store) == ISC_R_SUCCESS);
+	dns_dampening_setdecay(store, 600, 0);
+	store->prefixlen.ipv4 = 24;
+	store->prefixlen.ipv6 = 48;
+	store->limit.maximum = 32000;
+	store->limit.enable_dampening = 25600;
+	store->limit.disable_dampening = 9600;
+	store->limit.irrelevant = 0;
+	store->score.first_query = 10;
+	store->score.per_query = 1000;
+
+	RUNTIME_CHECK(dns_view_create(mctx, dns_rdataclass_in, "filter",
+				      &view) == ISC_R_SUCCESS);
+	RUNTIME_CHECK(dns_dampening_initshared(view, store) == ISC_R_SUCCESS);
+	RUNTIME_CHECK(dns_dampening_filter_create(mctx, &filter) ==
+		      ISC_R_SUCCESS);
+	dns_dampening_filter_attach(filter, &view->dampening->filter);
+
+	in.s_addr = htonl(0xc0000201);
+	isc_sockaddr_fromin(&addr, &in, 53);
+	for (i = 0; i < 30; i++)
+		(void)dns_dampening_query(view->dampening, &addr, 1000,
+					  NULL, NULL);
+	dns_dampening_getstats(store, &stats);
+	denied = stats.counters.denied;
+	RUNTIME_CHECK(denied > 0);
+
+	for (i = 0; i < 5; i++)
+		RUNTIME_CHECK(dns_dampening_filter_check(filter,
+							 view->dampening,
+							 &addr, 1000));
+	dns_view_detach(&view);
+
+	dns_dampening_getstats(store, &stats);
+	printf("filter drops charged %lu of 5\n",
+	       (unsigned long)(stats.counters.denied - denied));
+	RUNTIME_CHECK(stats.counters.denied == denied + 5);
+	RUNTIME_CHECK(!dns_dampening_filter_lookup(filter, &addr, 1000));
+
+	dns_dampening_filter_detach(&filter);
+	dns_dampening_detach(&store);
+}
+
+int
+main(int argc, char *argv[]) {
+	isc_mem_t *mctx = NULL;
+	dns_view_t *view = NULL;
+	dns_dampening_t *damp;
+	dns_dampening_stats_t stats;
+	isc_time_t start;
+	isc_sockaddr_t addr;
+	struct in_addr in;
+	unsigned int i, n = 10000000, maxerr = 0, err, attacker;
+	unsigned int storage, missed;
+	size_t inuse;
+	int halflife = 600, size = 100000, ch, penalty;
+
+	while ((ch = isc_commandline_parse(argc, argv, "n:h:t:")) != -1) {
+		switch (ch) {
+		case 'n':
+			n = atoi(isc_commandline_argument);
+			break;
+		case 'h':
+			halflife = atoi(isc_commandline_argument);
+			break;
+		case 't':
+			size = atoi(isc_commandline_argument);
+			break;
+		default:
+			fprintf(stderr, "usage: dampening_test "
+				"[-n iterations] [-h halflife] "
+				"[-t table size]\n");
+			exit(1);
+		}
+	}
+	RUNTIME_CHECK(n > 0 && halflife > 10 && size > 1);
+
+	RUNTIME_CHECK(isc_mem_create(0, 0, &mctx) == ISC_R_SUCCESS);
+	check_promotion(mctx);
+	check_filter(mctx);
+
+	view = setup(mctx, DNS_DAMPENING_STORAGE_QUEUE, 1000, halflife);
+	damp = view->dampening;
+
+	/*
+	 * Accuracy of the table against the floating point decay.
+	 */
+	for (i = 0; i < 20U * halflife; i += 7) {
+		unsigned int a = decay_exp(32000, i, halflife);
+		unsigned int b = dns_dampening_decay(damp, 32000, i);
+		err = a > b ? a - b : b - a;
+		maxerr = ISC_MAX(maxerr, err);
+	}
+	printf("max deviation from exp() %u of 32000\n", maxerr);
+
+	RUNTIME_CHECK(isc_time_now(&start) == ISC_R_SUCCESS);
+	for (i = 0; i < n; i++)
+		sink += decay_exp(1000 + (i & 0x7fff), i & 0xffff, halflife);
+	report("decay exp()", &start, n);
+
+	RUNTIME_CHECK(isc_time_now(&start) == ISC_R_SUCCESS);
+	for (i = 0; i < n; i++)
+		sink += dns_dampening_decay(damp, 1000 + (i & 0x7fff),
+					    i & 0xffff);
+	report("decay table", &start, n);
+
+	/*
+	 * A single prefix queried once per second decays on every update.
+	 */
+	in.s_addr = htonl(0xc0000201);
+	isc_sockaddr_fromin(&addr, &in, 53);
+	RUNTIME_CHECK(isc_time_now(&start) == ISC_R_SUCCESS);
+	for (i = 0; i < n; i++)
+		sink += dns_dampening_query(damp, &addr, 1000 + i, NULL, NULL);
+	report("query with decay", &start, n);
+
+	dns_view_detach(&view);
+
+	/*
+	 * Spoofed sources: the attacker has to stay dampened, the random
+	 * prefixes must not be dampened.
+	 */
+	for (storage = DNS_DAMPENING_STORAGE_QUEUE;
+	     storage <= DNS_DAMPENING_STORAGE_SKETCH;
+	     storage <<= 1)
+	{
+		inuse = isc_mem_inuse(mctx);
+		view = setup(mctx, storage, size, halflife);
+		damp = view->dampening;
+		inuse = isc_mem_inuse(mctx) - inuse;
+
+		attacker = 0xc6336400;
+		missed = 0;
+		RUNTIME_CHECK(isc_time_now(&start) == ISC_R_SUCCESS);
+		for (i = 0; i < n; i++) {
+			if (i % 10 == 0)
+				in.s_addr = htonl(attacker);
+			else
+				in.s_addr = htonl((random() & 0xffffff) << 8);
+			isc_sockaddr_fromin(&addr, &in, 53);
+			if (dns_dampening_query(damp, &addr, 1000 + i / 10000,
+						&penalty, NULL) ==
+			    DNS_DAMPENING_STATE_NORMAL &&
+			    i % 10 == 0 && i > 1000)
+				missed++;
+		}
+		report(storage == DNS_DAMPENING_STORAGE_QUEUE ?
+		       "spoofed queue" : "spoofed sketch", &start, n);
+		dns_dampening_getstats(damp, &stats);
+		printf("%-24s %10lu bytes, %lu prefixes dampened, "
+		       "attacker missed %u\n", "",
+		       (unsigned long)inuse, (unsigned long)stats.dampened,
+		       missed);
+		dns_view_detach(&view);
+	}
+
+	isc_mem_destroy(&mctx);
+
+	return (0);
+}
@@ -0,0 +1,537 @@
+/*
+ * Copyright (C) 2014  Internet Systems Consortium, Inc. ("ISC")
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS.  IN NO EVENT SHALL ISC BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE
+ * OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * Replay benchmark for the dampening and response rate limiting tables.
+ * A stream of queries is fed directly into dns_dampening_query() and the
+ * scoring functions, and into dns_rrl(), without any network. The stream
+ * is either read from a file or generated.
+ *
+ * Each line of the file describes one query:
+ *
+ *	timestamp source qtype response-size [label]
+ *
+ * e.g. "1400000000 192.0.2.1 ANY 3000 1". The label is 1 for attack
+ * traffic and 0 for legitimate traffic; queries without a label are not
+ * counted in the error rates. Lines starting with '#' are ignored.
+ *
+ * The generated stream spreads legitimate queries over -c client prefixes
+ * out of 10/8 and sends -p percent of the queries from -a attacking
+ * prefixes out of 198.51.100/24, asking for ANY with large responses.
+ *
+ * The queries are dealt round robin to -T threads. For both tables the
+ * throughput, the time spent waiting for the locks of the dampening table,
+ * the memory used, and the rates of suppressed legitimate (false positive)
+ * and passed attack (false negative) queries are reported. With -g the
+ * rate limiting table grows on a task instead of in the query path.
+ *
+ * Usage: dampreplay_test [-f file] [-n queries] [-d duration] [-c clients]
+ *	[-a attackers] [-p attack percent] [-T threads] [-s storage]
+ *	[-S shards] [-t table size] [-l prefix length] [-e enable limit]
+ *	[-x disable limit] [-r responses per second] [-g]
+ */
+
+#include <config.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <isc/commandline.h>
+#include <isc/mem.h>
+#include <isc/netaddr.h>
+#include <isc/sockaddr.h>
+#include <isc/string.h>
+#include <isc/task.h>
+#include <isc/thread.h>
+#include <isc/time.h>
+#include <isc/util.h>
+
+#include <dns/dampening.h>
+#include <dns/fixedname.h>
+#include <dns/name.h>
+#include <dns/rdatatype.h>
+#include <dns/rrl.h>
+#include <dns/view.h>
+
+#define MAX_THREADS	64
+
+typedef struct {
+	isc_stdtime_t	now;
+	isc_sockaddr_t	addr;
+	dns_rdatatype_t	qtype;
+	isc_uint16_t	size;
+	int		label;		/* 1 attack, 0 legitimate, -1 none */
+} record_t;
+
+typedef struct {
+	isc_uint64_t	passed[2];
+	isc_uint64_t	suppressed[2];
+	isc_uint64_t	inside;		/* ns spent in the table calls */
+} counters_t;
+
+typedef struct {
+	dns_view_t	*view;
+	unsigned int	first;
+	counters_t	counters;
+} worker_t;
+
+static record_t *records;
+static unsigned int nrecords, nallocated, nthreads = 1;
+static dns_fixedname_t fqname;
+
+static isc_uint64_t
+now_ns(void) {
+	isc_time_t t;
+
+	RUNTIME_CHECK(isc_time_now(&t) == ISC_R_SUCCESS);
+	return ((isc_uint64_t)isc_time_seconds(&t) * 1000000000 +
+		isc_time_nanoseconds(&t));
+}
+
+static void
+count(counters_t *c, int label, isc_boolean_t suppressed) {
+	if (label < 0)
+		return;
+	if (suppressed)
+		c->suppressed[label]++;
+	else
+		c->passed[label]++;
+}
+
+/*
+ * Follow the path of a UDP query in named: the query is checked first,
+ * the query type is scored after parsing, and the size with the response.
+ */
+static isc_threadresult_t
+#ifdef WIN32
+WINAPI
+#endif
+run_dampening(isc_threadarg_t arg) {
+	worker_t *w = arg;
+	dns_dampening_t *damp = w->view->dampening;
+	dns_dampening_handle_t handle;
+	dns_dampening_state_t state;
+	isc_uint64_t start;
+	record_t *r;
+	unsigned int i;
+
+	dns_dampening_handle_init(&handle);
+	for (i = w->first; i < nrecords; i += nthreads) {
+		r = &records[i];
+		start = now_ns();
+		state = dns_dampening_query(damp, &r->addr, r->now, NULL,
+					    &handle);
+		if (state == DNS_DAMPENING_STATE_NORMAL) {
+			dns_dampening_score_qtype(damp, &r->addr, r->now,
+						  (dns_messageid_t)i, r->qtype,
+						  &handle);
+			dns_dampening_score_size(damp, &r->addr, r->now,
+						 r->size, &handle);
+		}
+		dns_dampening_flush(damp, &handle, r->now);
+		w->counters.inside += now_ns() - start;
+		count(&w->counters, r->label,
+		      ISC_TF(state == DNS_DAMPENING_STATE_SUPPRESS));
+	}
+	return ((isc_threadresult_t)0);
+}
+
+static isc_threadresult_t
+#ifdef WIN32
+WINAPI
+#endif
+run_rrl(isc_threadarg_t arg) {
+	worker_t *w = arg;
+	dns_rrl_result_t result;
+	char log_buf[DNS_RRL_LOG_BUF_LEN];
+	isc_uint64_t start;
+	record_t *r;
+	unsigned int i;
+
+	for (i = w->first; i < nrecords; i += nthreads) {
+		r = &records[i];
+		start = now_ns();
+		result = dns_rrl(w->view, &r->addr, ISC_FALSE,
+				 dns_rdataclass_in, r->qtype,
+				 dns_fixedname_name(&fqname), ISC_R_SUCCESS,
+				 r->now, ISC_FALSE, log_buf, sizeof(log_buf));
+		w->counters.inside += now_ns() - start;
+		count(&w->counters, r->label,
+		      ISC_TF(result != DNS_RRL_RESULT_OK));
+	}
+	return ((isc_threadresult_t)0);
+}
+
+static void
+load(isc_mem_t *mctx, const char *file) {
+	char line[1024], addr[128], type[32];
+	unsigned int size, lineno = 0;
+	unsigned long now;
+	isc_textregion_t tr;
+	isc_netaddr_t na;
+	struct in_addr in4;
+	struct in6_addr in6;
+	record_t *r;
+	FILE *fp;
+	int label, n;
+
+	fp = fopen(file, "r");
+	if (fp == NULL) {
+		perror(file);
+		exit(1);
+	}
+	while (fgets(line, sizeof(line), fp) != NULL) {
+		lineno++;
+		if (line[0] == '#' || line[0] == '\n')
+			continue;
+		label = -1;
+		n = sscanf(line, "%lu %127s %31s %u %d", &now, addr, type,
+			   &size, &label);
+		if (n < 4) {
+			fprintf(stderr, "%s:%u: syntax error\n", file, lineno);
+			exit(1);
+		}
+		if (nrecords == nallocated) {
+			record_t *old = records;
+
+			nallocated = nallocated == 0 ? 65536 : nallocated * 2;
+			records = isc_mem_get(mctx,
+					      nallocated * sizeof(*records));
+			RUNTIME_CHECK(records != NULL);
+			if (old != NULL) {
+				memmove(records, old,
+					nrecords * sizeof(*records));
+				isc_mem_put(mctx, old,
+					    nrecords * sizeof(*records));
+			}
+		}
+		r = &records[nrecords];
+		if (inet_pton(AF_INET6, addr, &in6) == 1)
+			isc_netaddr_fromin6(&na, &in6);
+		else if (inet_pton(AF_INET, addr, &in4) == 1)
+			isc_netaddr_fromin(&na, &in4);
+		else {
+			fprintf(stderr, "%s:%u: bad address '%s'\n",
+				file, lineno, addr);
+			exit(1);
+		}
+		isc_sockaddr_fromnetaddr(&r->addr, &na, 53);
+		tr.base = type;
+		tr.length = strlen(type);
+		if (dns_rdatatype_fromtext(&r->qtype, &tr) != ISC_R_SUCCESS) {
+			fprintf(stderr, "%s:%u: bad type '%s'\n",
+				file, lineno, type);
+			exit(1);
+		}
+		r->now = (isc_stdtime_t)now;
+		r->size = ISC_MIN(size, 65535);
+		r->label = label > 0 ? 1 : label;
+		nrecords++;
+	}
+	fclose(fp);
+}
+
+static void
+generate(isc_mem_t *mctx, unsigned int n, unsigned int duration,
+	 unsigned int clients, unsigned int attackers, unsigned int percent)
+{
+	struct in_addr in;
+	record_t *r;
+	unsigned int i;
+
+	records = isc_mem_get(mctx, n * sizeof(*records));
+	RUNTIME_CHECK(records != NULL);
+	nallocated = n;
+	for (i = 0; i < n; i++) {
+		r = &records[i];
+		r->now = 1000 + (isc_uint64_t)i * duration / n;
+		if ((unsigned int)(random() % 100) < percent) {
+			in.s_addr = htonl(0xc6336400 +
+					  random() % attackers);
+			r->qtype = dns_rdatatype_any;
+			r->size = 3000;
+			r->label = 1;
+		} else {
+			in.s_addr = htonl(0x0a000000 +
+					  ((random() % clients) << 8) +
+					  random() % 256);
+			r->qtype = dns_rdatatype_a;
+			r->size = 100 + random() % 400;
+			r->label = 0;
+		}
+		isc_sockaddr_fromin(&r->addr, &in, 53);
+	}
+	nrecords = n;
+}
+
+static void
+report(const char *what, isc_uint64_t wall, worker_t *workers,
+       isc_uint64_t lockwait, size_t memory)
+{
+	counters_t total;
+	unsigned int i;
+
+	memset(&total, 0, sizeof(total));
+	for (i = 0; i < nthreads; i++) {
+		total.passed[0] += workers[i].counters.passed[0];
+		total.passed[1] += workers[i].counters.passed[1];
+		total.suppressed[0] += workers[i].counters.suppressed[0];
+		total.suppressed[1] += workers[i].counters.suppressed[1];
+		total.inside += workers[i].counters.inside;
+	}
+	printf("%-10s %8.1f ns/op wall %8.1f ns/op in call", what,
+	       (double)wall / nrecords, (double)total.inside / nrecords);
+	if (lockwait != ISC_UINT64_MAX)
+		printf(" %8.1f ns/op lock wait",
+		       (double)lockwait / nrecords);
+	printf("\n%-10s %10lu bytes", "", (unsigned long)memory);
+	if (total.passed[0] + total.suppressed[0] > 0)
+		printf(", false positive %.4f%%",
+		       100.0 * total.suppressed[0] /
+		       (total.passed[0] + total.suppressed[0]));
+	if (total.passed[1] + total.suppressed[1] > 0)
+		printf(", false negative %.4f%%",
+		       100.0 * total.passed[1] /
+		       (total.passed[1] + total.suppressed[1]));
+	printf("\n");
+}
+
+static isc_uint64_t
+run(isc_threadfunc_t func, dns_view_t *view, worker_t *workers) {
+	isc_thread_t threads[MAX_THREADS];
+	isc_uint64_t start;
+	unsigned int i;
+
+	start = now_ns();
+	for (i = 0; i < nthreads; i++) {
+		memset(&workers[i], 0, sizeof(workers[i]));
+		workers[i].view = view;
+		workers[i].first = i;
+		RUNTIME_CHECK(isc_thread_create(func, &workers[i],
+						&threads[i]) == ISC_R_SUCCESS);
+	}
+	for (i = 0; i < nthreads; i++)
+		(void)isc_thread_join(threads[i], NULL);
+	return (now_ns() - start);
+}
+
+static void
+setrate(dns_rrl_rate_t *rate, int r, const char *str) {
+	rate->r = r;
+	rate->scaled = r;
+	rate->str = str;
+}
+
+static void
+usage(void) {
+	fprintf(stderr, "usage: dampreplay_test [-f file] [-n queries] "
+		"[-d duration] [-c clients] [-a attackers] "
+		"[-p attack percent] [-T threads] [-s queue|sketch|all] "
+		"[-S shards] [-t table size] [-l prefix length] "
+		"[-e enable limit] [-x disable limit] "
+		"[-r responses per second] [-g]\n");
+	exit(1);
+}
+
+int
+main(int argc, char *argv[]) {
+	isc_mem_t *mctx = NULL;
+	dns_view_t *view = NULL;
+	dns_dampening_t *damp;
+	dns_dampening_stats_t stats;
+	dns_rrl_t *rrl = NULL;
+	isc_taskmgr_t *taskmgr = NULL;
+	isc_task_t *task = NULL;
+	worker_t workers[MAX_THREADS];
+	isc_buffer_t b;
+	isc_uint64_t wall;
+	const char *file = NULL;
+	unsigned int n = 1000000, duration = 600, clients = 10000;
+	unsigned int attackers = 4, percent = 10, storage;
+	unsigned int shards = 0, prefixlen = 24, enable = 25600;
+	unsigned int disable = 9600, rate = 5;
+	isc_boolean_t background = ISC_FALSE;
+	size_t inuse;
+	int size = 100000, ch;
+
+	storage = DNS_DAMPENING_STORAGE_QUEUE;
+	while ((ch = isc_commandline_parse(argc, argv,
+				"a:c:d:e:f:gl:n:p:r:s:S:t:T:x:")) != -1) {
+		switch (ch) {
+		case 'a':
+			attackers = atoi(isc_commandline_argument);
+			break;
+		case 'c':
+			clients = atoi(isc_commandline_argument);
+			break;
+		case 'd':
+			duration = atoi(isc_commandline_argument);
+			break;
+		case 'e':
+			enable = atoi(isc_commandline_argument);
+			break;
+		case 'f':
+			file = isc_commandline_argument;
+			break;
+		case 'g':
+			background = ISC_TRUE;
+			break;
+		case 'l':
+			prefixlen = atoi(isc_commandline_argument);
+			break;
+		case 'n':
+			n = atoi(isc_commandline_argument);
+			break;
+		case 'p':
+			percent = atoi(isc_commandline_argument);
+			break;
+		case 'r':
+			rate = atoi(isc_commandline_argument);
+			break;
+		case 's':
+			if (strcmp(isc_commandline_argument, "sketch") == 0)
+				storage = DNS_DAMPENING_STORAGE_SKETCH;
+			else if (strcmp(isc_commandline_argument, "all") == 0)
+				storage = DNS_DAMPENING_STORAGE_QUEUE |
+					  DNS_DAMPENING_STORAGE_SKETCH;
+			else if (strcmp(isc_commandline_argument,
+					"queue") != 0)
+				usage();
+			break;
+		case 'S':
+			shards = atoi(isc_commandline_argument);
+			break;
+		case 't':
+			size = atoi(isc_commandline_argument);
+			break;
+		case 'T':
+			nthreads = atoi(isc_commandline_argument);
+			break;
+		case 'x':
+			disable = atoi(isc_commandline_argument);
+			break;
+		default:
+			usage();
+		}
+	}
+	if (n == 0 || duration == 0 || clients == 0 || attackers == 0 ||
+	    percent > 100 || size < 2 || nthreads < 1 ||
+	    nthreads > MAX_THREADS || prefixlen < 8 || prefixlen > 32 ||
+	    disable >= enable || enable >= 32000)
+		usage();
+	if (shards == 0)
+		shards = nthreads;
+
+	RUNTIME_CHECK(isc_mem_create(0, 0, &mctx) == ISC_R_SUCCESS);
+	if (file != NULL)
+		load(mctx, file);
+	else
+		generate(mctx, n, duration, clients, attackers, percent);
+	if (nrecords == 0) {
+		fprintf(stderr, "no queries\n");
+		exit(1);
+	}
+	printf("%u queries, %u threads\n", nrecords, nthreads);
+
+	dns_fixedname_init(&fqname);
+	isc_buffer_constinit(&b, "www.example.", 12);
+	isc_buffer_add(&b, 12);
+	RUNTIME_CHECK(dns_name_fromtext(dns_fixedname_name(&fqname), &b,
+					dns_rootname, 0, NULL) ==
+		      ISC_R_SUCCESS);
+
+	/*
+	 * Dampening with the defaults of named, apart from the options.
+	 */
+	RUNTIME_CHECK(dns_view_create(mctx, dns_rdataclass_in, "replay",
+				      &view) == ISC_R_SUCCESS);
+	inuse = isc_mem_inuse(mctx);
+	RUNTIME_CHECK(dns_dampening_init(view, ISC_MIN(500, size), size,
+					 ISC_MIN((int)shards,
+						 ISC_MIN(500, size)),
+					 storage) == ISC_R_SUCCESS);
+	damp = view->dampening;
+	dns_dampening_setdecay(damp, 600, 6);
+	damp->prefixlen.ipv4 = prefixlen;
+	damp->prefixlen.ipv6 = 48;
+	damp->limit.maximum = 32000;
+	damp->limit.enable_dampening = enable;
+	damp->limit.disable_dampening = disable;
+	damp->limit.irrelevant = 100;
+	damp->score.first_query = 10;
+	damp->score.per_query = 1;
+	damp->score.qtype_any = 100;
+	damp->score.duplicates = 100;
+	damp->score.minimum_size = 500;
+	damp->score.maximum_size = 4000;
+	damp->score.size_penalty = 100;
+
+	wall = run(run_dampening, view, workers);
+	dns_dampening_getstats(damp, &stats);
+	report("dampening", wall, workers, stats.counters.lock,
+	       isc_mem_inuse(mctx) - inuse);
+	dns_view_detach(&view);
+
+	/*
+	 * Response rate limiting with the defaults of named.
+	 */
+	RUNTIME_CHECK(dns_view_create(mctx, dns_rdataclass_in, "replay",
+				      &view) == ISC_R_SUCCESS);
+	inuse = isc_mem_inuse(mctx);
+	RUNTIME_CHECK(dns_rrl_init(&rrl, view, ISC_MIN(500, size),
+				   shards) == ISC_R_SUCCESS);
+	if (background) {
+		RUNTIME_CHECK(isc_taskmgr_create(mctx, 1, 0, &taskmgr) ==
+			      ISC_R_SUCCESS);
+		RUNTIME_CHECK(isc_task_create(taskmgr, 0, &task) ==
+			      ISC_R_SUCCESS);
+		dns_rrl_settask(rrl, task);
+	}
+	rrl->max_entries = size;
+	setrate(&rrl->responses_per_second, rate, "responses-per-second");
+	setrate(&rrl->referrals_per_second, rate, "referrals-per-second");
+	setrate(&rrl->nodata_per_second, rate, "nodata-per-second");
+	setrate(&rrl->nxdomains_per_second, rate, "nxdomains-per-second");
+	setrate(&rrl->errors_per_second, rate, "errors-per-second");
+	setrate(&rrl->all_per_second, 0, "all-per-second");
+	setrate(&rrl->slip, 2, "slip");
+	rrl->window = 15;
+	rrl->qps_scale = 0;
+	rrl->qps = 1.0;
+	rrl->ipv4_prefixlen = prefixlen;
+	rrl->ipv4_mask = prefixlen == 32 ? 0xffffffff :
+			 htonl(0xffffffff << (32 - prefixlen));
+	rrl->ipv6_prefixlen = 56;
+	rrl->ipv6_mask[0] = 0xffffffff;
+	rrl->ipv6_mask[1] = htonl(0xffffff00);
+	rrl->ipv6_mask[2] = 0;
+	rrl->ipv6_mask[3] = 0;
+
+	wall = run(run_rrl, view, workers);
+	report("rrl", wall, workers, ISC_UINT64_MAX,
+	       isc_mem_inuse(mctx) - inuse);
+	dns_view_detach(&view);
+	if (taskmgr != NULL) {
+		isc_task_detach(&task);
+		isc_taskmgr_destroy(&taskmgr);
+	}
+
+	isc_mem_put(mctx, records, nallocated * sizeof(*records));
+	isc_mem_destroy(&mctx);
+
+	return (0);
+}
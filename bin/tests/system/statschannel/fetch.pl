@@ -0,0 +1,52 @@
+#!/usr/bin/perl
+#
+# Copyright (C) 2014  Internet Systems Consortium, Inc. ("ISC")
+#
+# Permission to use, copy, modify, and/or distribute this software for any
+# purpose with or without fee is hereby granted, provided that the above
+# copyright notice and this permission notice appear in all copies.
+#
+# THE SOFTWARE IS PROVIDED "AS IS" AND ISC DISCLAIMS ALL WARRANTIES WITH
+# REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+# AND FITNESS.  IN NO EVENT SHALL ISC BE LIABLE FOR ANY SPECIAL, DIRECT,
+# INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+# LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE
+# OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+# PERFORMANCE OF THIS SOFTWARE.
+
+# $Id$
+
+#
+# Fetch a page from a statistics channel and print its body.
+#
+# Usage: fetch.pl address port path
+#
+# Exits non-zero if the page could not be fetched or the server did
+# not answer "200 OK".
+#
+
+use strict;
+use IO::Socket::INET;
+
+my ($addr, $port, $path) = @ARGV;
+die "usage: fetch.pl address port path\n" unless defined($path);
+
+my $sock = IO::Socket::INET->new(PeerAddr => $addr, PeerPort => $port,
+				 Proto => "tcp", Timeout => 10)
+	or die "connect $addr#$port: $!\n";
+
+print $sock "GET $path HTTP/1.0\r\nHost: $addr\r\n\r\n";
+
+my $status = <$sock>;
+die "no response\n" unless defined($status);
+die "bad response: $status" unless $status =~ m|^HTTP/1\.\d 200 |;
+
+while (my $line = <$sock>) {
+	last if $line =~ /^\r?\n$/;
+}
+
+while (my $line = <$sock>) {
+	print $line;
+}
+
+close($sock);
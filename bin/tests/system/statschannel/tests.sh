@@ -0,0 +1,166 @@
+#!/bin/sh
+#
+# Copyright (C) 2014  Internet Systems Consortium, Inc. ("ISC")
+#
+# Permission to use, copy, modify, and/or distribute this software for any
+# purpose with or without fee is hereby granted, provided that the above
+# copyright notice and this permission notice appear in all copies.
+#
+# THE SOFTWARE IS PROVIDED "AS IS" AND ISC DISCLAIMS ALL WARRANTIES WITH
+# REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+# AND FITNESS.  IN NO EVENT SHALL ISC BE LIABLE FOR ANY SPECIAL, DIRECT,
+# INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+# LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE
+# OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+# PERFORMANCE OF THIS SOFTWARE.
+
+# $Id$
+
+SYSTEMTESTTOP=..
+. $SYSTEMTESTTOP/conf.sh
+
+DIGOPTS="+tcp +noadd +nosea +nostat +noquest +nocomm +nocmd"
+DIGCMD="$DIG $DIGOPTS -p 5300"
+FETCH="$PERL fetch.pl 10.53.0.2 8853"
+
+status=0
+
+n=1
+ret=0
+echo "I:sending queries to ns2 ($n)"
+$DIGCMD a.example. @10.53.0.2 a > dig.out.ns2.$n.1 || ret=1
+grep '^a\.example\..*10\.0\.0\.1' dig.out.ns2.$n.1 > /dev/null || ret=1
+$DIGCMD nonexistent.example. @10.53.0.2 a > dig.out.ns2.$n.2 || ret=1
+$DIGCMD 1.0/26.2.0.192.in-addr.arpa. @10.53.0.2 ptr > dig.out.ns2.$n.3 || ret=1
+grep 'PTR.*a\.example\.' dig.out.ns2.$n.3 > /dev/null || ret=1
+if [ $ret != 0 ]; then echo "I:failed"; fi
+status=`expr $status + $ret`
+
+n=`expr $n + 1`
+ret=0
+echo "I:fetching /metrics from ns2 ($n)"
+$FETCH /metrics > metrics.out.$n || ret=1
+cp metrics.out.$n metrics.out
+if [ $ret != 0 ]; then echo "I:failed"; fi
+status=`expr $status + $ret`
+
+n=`expr $n + 1`
+ret=0
+echo "I:checking that the exposition ends with '# EOF' ($n)"
+tail -1 metrics.out | grep '^# EOF$' > /dev/null || ret=1
+test `grep -c '^# EOF$' metrics.out` -eq 1 || ret=1
+if [ $ret != 0 ]; then echo "I:failed"; fi
+status=`expr $status + $ret`
+
+n=`expr $n + 1`
+ret=0
+echo "I:checking the metric family names ($n)"
+for family in bind_boot_time_seconds bind_config_time_seconds \
+	      bind_requests bind_incoming_queries bind_nsstats \
+	      bind_query_latency_seconds bind_zone_serial \
+	      bind_zone_requests bind_zone_incoming_queries \
+	      bind_memory_total_bytes bind_memory_in_use_bytes \
+	      bind_sockets bind_sockets_active
+do
+	grep "^# TYPE $family " metrics.out > /dev/null || {
+		echo "I:missing family $family"; ret=1;
+	}
+done
+# Every sample belongs to the family declared before it, and counters
+# carry the "_total" suffix.
+awk '/^# TYPE / { family = $3; type = $4; next }
+     /^#/ { next }
+     {
+	name = $1; sub(/\{.*/, "", name);
+	if (type == "counter") ok = (name == family "_total");
+	else if (type == "histogram")
+		ok = (name == family "_bucket" || name == family "_count" ||
+		      name == family "_sum");
+	else ok = (name == family);
+	if (!ok) { print "I:sample " name " in family " family; bad = 1 }
+     }
+     END { exit bad }' metrics.out || ret=1
+# No family is declared twice.
+test -z "`grep '^# TYPE ' metrics.out | awk '{print $3}' | sort | uniq -d`" ||
+	ret=1
+if [ $ret != 0 ]; then echo "I:failed"; fi
+status=`expr $status + $ret`
+
+n=`expr $n + 1`
+ret=0
+echo "I:checking the latency histograms ($n)"
+# Within each series the buckets must not decrease, every series starts
+# at the first bucket boundary and has a sum, and the "+Inf" bucket must
+# equal the series' count.
+awk '/^bind_query_latency_seconds_(bucket|count|sum)\{/ {
+	labels = $1; sub(/^[^{]*\{/, "", labels); sub(/\}$/, "", labels);
+	le = "";
+	if (match(labels, /,le="[^"]*"/)) {
+		le = substr(labels, RSTART + 5, RLENGTH - 6);
+		labels = substr(labels, 1, RSTART - 1);
+	}
+	if ($1 ~ /_count\{/) {
+		if (!(labels in inf)) {
+			print "I:no +Inf bucket for " labels; bad = 1;
+		} else if (inf[labels] != $2) {
+			print "I:+Inf " inf[labels] " != count " $2 \
+			      " for " labels;
+			bad = 1;
+		}
+		count[labels] = $2;
+		series++;
+		next;
+	}
+	if ($1 ~ /_sum\{/) {
+		sum[labels] = $2;
+		next;
+	}
+	if (!(labels in last) && le != "0.000001") {
+		print "I:first bucket le=" le " for " labels; bad = 1;
+	}
+	if ((labels in last) && $2 + 0 < last[labels] + 0) {
+		print "I:bucket le=" le " decreases for " labels; bad = 1;
+	}
+	last[labels] = $2;
+	if (le == "+Inf")
+		inf[labels] = $2;
+     }
+     END {
+	for (labels in inf)
+		if (!(labels in count)) {
+			print "I:no count for " labels; bad = 1;
+		}
+	for (labels in count)
+		if (!(labels in sum)) {
+			print "I:no sum for " labels; bad = 1;
+		}
+	if (series == 0) { print "I:no latency series"; bad = 1 }
+	exit bad;
+     }' metrics.out || ret=1
+if [ $ret != 0 ]; then echo "I:failed"; fi
+status=`expr $status + $ret`
+
+n=`expr $n + 1`
+ret=0
+echo "I:checking that an RFC 2317 zone keeps its full name ($n)"
+grep '^bind_zone_serial{view="_default",zone="0/26\.2\.0\.192\.in-addr\.arpa"} 2014101601$' metrics.out > /dev/null || ret=1
+grep '^bind_zone_serial{view="_default",zone="example"} 1$' metrics.out > /dev/null || ret=1
+grep '^bind_zone_incoming_queries_total{view="_default",zone="0/26\.2\.0\.192\.in-addr\.arpa",type="PTR"} 1$' metrics.out > /dev/null || ret=1
+if [ $ret != 0 ]; then echo "I:failed"; fi
+status=`expr $status + $ret`
+
+n=`expr $n + 1`
+ret=0
+echo "I:checking the partial pages ($n)"
+for page in server views zones memory sockets
+do
+	$FETCH /metrics/$page > metrics.out.$n.$page || ret=1
+	tail -1 metrics.out.$n.$page | grep '^# EOF$' > /dev/null || ret=1
+done
+grep '^# TYPE bind_zone_serial ' metrics.out.$n.zones > /dev/null || ret=1
+grep '^# TYPE bind_zone_serial ' metrics.out.$n.server > /dev/null && ret=1
+if [ $ret != 0 ]; then echo "I:failed"; fi
+status=`expr $status + $ret`
+
+echo "I:exit status: $status"
+exit $status
@@ -0,0 +1,308 @@
+/*
+ * Copyright (C) 2014  Internet Systems Consortium, Inc. ("ISC")
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS.  IN NO EVENT SHALL ISC BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE
+ * OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * Reschedule benchmark for the timer manager.  -n timers are spread over
+ * -k tasks and rescheduled -r times in total by -T threads, each thread
+ * owning a range of timers and their tasks.  The new due times are drawn
+ * between one minute and -m minutes ahead, so nothing fires during the
+ * run; this is how zone refresh, expire and resign timers and the idle
+ * timers of clients and fetches move.
+ *
+ * The same stream is then replayed against a single isc_heap_t under one
+ * mutex, the way the timer manager scheduled timers before it used
+ * timing wheels, and the throughput of both is reported.
+ *
+ * Usage: timerbench_test [-n timers] [-k tasks] [-r resets] [-T threads]
+ *	[-m minutes]
+ */
+
+#include <config.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <isc/commandline.h>
+#include <isc/heap.h>
+#include <isc/mem.h>
+#include <isc/mutex.h>
+#include <isc/task.h>
+#include <isc/thread.h>
+#include <isc/time.h>
+#include <isc/timer.h>
+#include <isc/util.h>
+
+#define MAX_THREADS	64
+
+/*
+ * The padding makes this as large as a timer was when timers were kept
+ * in a heap, so the heap walk touches as much memory as it used to.
+ */
+typedef struct {
+	isc_mutex_t	lock;
+	isc_time_t	idle;
+	isc_time_t	due;
+	unsigned int	index;
+	char		pad[96];
+} heaptimer_t;
+
+typedef struct {
+	unsigned int	first;		/* first timer owned */
+	unsigned int	count;		/* number of timers owned */
+	unsigned int	nresets;
+	isc_interval_t	*intervals;
+} worker_t;
+
+static unsigned int nthreads = 4;
+static isc_timer_t **timers;
+static heaptimer_t *heaptimers;
+static isc_heap_t *heap;
+static isc_mutex_t heaplock;
+
+static isc_uint64_t
+now_ns(void) {
+	isc_time_t t;
+
+	RUNTIME_CHECK(isc_time_now(&t) == ISC_R_SUCCESS);
+	return ((isc_uint64_t)isc_time_seconds(&t) * 1000000000 +
+		isc_time_nanoseconds(&t));
+}
+
+static void
+timeout(isc_task_t *task, isc_event_t *event) {
+	UNUSED(task);
+	isc_event_free(&event);
+}
+
+static isc_boolean_t
+sooner(void *v1, void *v2) {
+	heaptimer_t *t1 = v1, *t2 = v2;
+
+	return (ISC_TF(isc_time_compare(&t1->due, &t2->due) < 0));
+}
+
+static void
+set_index(void *what, unsigned int index) {
+	heaptimer_t *t = what;
+
+	t->index = index;
+}
+
+static isc_threadresult_t
+#ifdef _WIN32
+WINAPI
+#endif
+wheel_worker(void *arg) {
+	worker_t *w = arg;
+	unsigned int i;
+
+	for (i = 0; i < w->nresets; i++)
+		RUNTIME_CHECK(isc_timer_reset(timers[w->first + i % w->count],
+					      isc_timertype_once, NULL,
+					      &w->intervals[i], ISC_FALSE) ==
+			      ISC_R_SUCCESS);
+
+	return ((isc_threadresult_t)0);
+}
+
+static isc_threadresult_t
+#ifdef _WIN32
+WINAPI
+#endif
+heap_worker(void *arg) {
+	worker_t *w = arg;
+	heaptimer_t *t;
+	isc_time_t now;
+	unsigned int i;
+	int cmp;
+
+	/*
+	 * This mirrors what isc_timer_reset() and schedule() did for a
+	 * once timer with an idle interval when the timers were kept in
+	 * a heap: the manager lock, then the timer lock, are held while
+	 * the idle time is set and the heap is fixed up.
+	 */
+	for (i = 0; i < w->nresets; i++) {
+		t = &heaptimers[w->first + i % w->count];
+		RUNTIME_CHECK(isc_time_now(&now) == ISC_R_SUCCESS);
+		LOCK(&heaplock);
+		LOCK(&t->lock);
+		RUNTIME_CHECK(isc_time_add(&now, &w->intervals[i], &t->idle) ==
+			      ISC_R_SUCCESS);
+		cmp = isc_time_compare(&t->idle, &t->due);
+		t->due = t->idle;
+		if (cmp < 0)
+			isc_heap_increased(heap, t->index);
+		else if (cmp > 0)
+			isc_heap_decreased(heap, t->index);
+		UNLOCK(&t->lock);
+		UNLOCK(&heaplock);
+	}
+
+	return ((isc_threadresult_t)0);
+}
+
+static isc_uint64_t
+run(isc_threadfunc_t func, worker_t *workers) {
+	isc_thread_t threads[MAX_THREADS];
+	isc_uint64_t start;
+	unsigned int i;
+
+	start = now_ns();
+	for (i = 0; i < nthreads; i++)
+		RUNTIME_CHECK(isc_thread_create(func, &workers[i],
+						&threads[i]) == ISC_R_SUCCESS);
+	for (i = 0; i < nthreads; i++)
+		(void)isc_thread_join(threads[i], NULL);
+	return (now_ns() - start);
+}
+
+static void
+report(const char *what, isc_uint64_t wall, unsigned int nresets) {
+	printf("%-6s %10.1f ns/reset %12.0f resets/s\n", what,
+	       (double)wall * nthreads / nresets,
+	       (double)nresets * 1000000000 / wall);
+}
+
+static void
+usage(void) {
+	fprintf(stderr, "usage: timerbench_test [-n timers] [-k tasks] "
+		"[-r resets] [-T threads] [-m minutes]\n");
+	exit(1);
+}
+
+int
+main(int argc, char *argv[]) {
+	isc_mem_t *mctx = NULL;
+	isc_taskmgr_t *taskmgr = NULL;
+	isc_timermgr_t *timermgr = NULL;
+	isc_task_t **tasks;
+	worker_t workers[MAX_THREADS];
+	isc_interval_t interval;
+	isc_time_t now;
+	isc_uint64_t wheel, heapwall;
+	unsigned int ntimers = 200000, ntasks = 1000, nresets = 4000000;
+	unsigned int minutes = 1440, i, j, per;
+	int ch;
+
+	while ((ch = isc_commandline_parse(argc, argv, "k:m:n:r:T:")) != -1) {
+		switch (ch) {
+		case 'k':
+			ntasks = atoi(isc_commandline_argument);
+			break;
+		case 'm':
+			minutes = atoi(isc_commandline_argument);
+			break;
+		case 'n':
+			ntimers = atoi(isc_commandline_argument);
+			break;
+		case 'r':
+			nresets = atoi(isc_commandline_argument);
+			break;
+		case 'T':
+			nthreads = atoi(isc_commandline_argument);
+			break;
+		default:
+			usage();
+		}
+	}
+	if (nthreads < 1 || nthreads > MAX_THREADS || minutes < 2 ||
+	    ntasks < nthreads || ntimers < ntasks || nresets < nthreads)
+		usage();
+
+	RUNTIME_CHECK(isc_mem_create(0, 0, &mctx) == ISC_R_SUCCESS);
+	RUNTIME_CHECK(isc_taskmgr_create(mctx, 1, 0, &taskmgr) ==
+		      ISC_R_SUCCESS);
+	RUNTIME_CHECK(isc_timermgr_create(mctx, &timermgr) == ISC_R_SUCCESS);
+
+	tasks = isc_mem_get(mctx, ntasks * sizeof(*tasks));
+	timers = isc_mem_get(mctx, ntimers * sizeof(*timers));
+	heaptimers = isc_mem_get(mctx, ntimers * sizeof(*heaptimers));
+	RUNTIME_CHECK(tasks != NULL && timers != NULL && heaptimers != NULL);
+	RUNTIME_CHECK(isc_heap_create(mctx, sooner, set_index, 0, &heap) ==
+		      ISC_R_SUCCESS);
+	RUNTIME_CHECK(isc_mutex_init(&heaplock) == ISC_R_SUCCESS);
+
+	/*
+	 * Timer i belongs to task i % ntasks; the timers of a thread's
+	 * tasks are contiguous, as are its tasks.
+	 */
+	for (i = 0; i < ntasks; i++) {
+		tasks[i] = NULL;
+		RUNTIME_CHECK(isc_task_create(taskmgr, 0, &tasks[i]) ==
+			      ISC_R_SUCCESS);
+	}
+	RUNTIME_CHECK(isc_time_now(&now) == ISC_R_SUCCESS);
+	for (i = 0; i < ntimers; i++) {
+		isc_interval_set(&interval, 60 + random() % (60 * minutes - 60),
+				 0);
+		timers[i] = NULL;
+		RUNTIME_CHECK(isc_timer_create(timermgr, isc_timertype_once,
+					       NULL, &interval,
+					       tasks[i * ntasks / ntimers],
+					       timeout, NULL, &timers[i]) ==
+			      ISC_R_SUCCESS);
+		RUNTIME_CHECK(isc_time_add(&now, &interval,
+					   &heaptimers[i].due) ==
+			      ISC_R_SUCCESS);
+		RUNTIME_CHECK(isc_mutex_init(&heaptimers[i].lock) ==
+			      ISC_R_SUCCESS);
+		RUNTIME_CHECK(isc_heap_insert(heap, &heaptimers[i]) ==
+			      ISC_R_SUCCESS);
+	}
+
+	per = nresets / nthreads;
+	for (i = 0; i < nthreads; i++) {
+		workers[i].first = i * (ntimers / nthreads);
+		workers[i].count = ntimers / nthreads;
+		workers[i].nresets = per;
+		workers[i].intervals = isc_mem_get(mctx, per *
+						   sizeof(isc_interval_t));
+		RUNTIME_CHECK(workers[i].intervals != NULL);
+		for (j = 0; j < per; j++)
+			isc_interval_set(&workers[i].intervals[j],
+					 60 + random() % (60 * minutes - 60),
+					 random() % 1000000000);
+	}
+
+	printf("%u timers, %u tasks, %u resets, %u threads\n",
+	       ntimers, ntasks, per * nthreads, nthreads);
+	wheel = run(wheel_worker, workers);
+	heapwall = run(heap_worker, workers);
+	report("wheel", wheel, per * nthreads);
+	report("heap", heapwall, per * nthreads);
+
+	for (i = 0; i < nthreads; i++)
+		isc_mem_put(mctx, workers[i].intervals,
+			    per * sizeof(isc_interval_t));
+	for (i = 0; i < ntimers; i++) {
+		isc_timer_detach(&timers[i]);
+		DESTROYLOCK(&heaptimers[i].lock);
+	}
+	for (i = 0; i < ntasks; i++)
+		isc_task_detach(&tasks[i]);
+	isc_heap_destroy(&heap);
+	DESTROYLOCK(&heaplock);
+	isc_mem_put(mctx, heaptimers, ntimers * sizeof(*heaptimers));
+	isc_mem_put(mctx, timers, ntimers * sizeof(*timers));
+	isc_mem_put(mctx, tasks, ntasks * sizeof(*tasks));
+	isc_timermgr_destroy(&timermgr);
+	isc_taskmgr_destroy(&taskmgr);
+	isc_mem_destroy(&mctx);
+
+	return (0);
+}
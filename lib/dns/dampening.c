@@ -3,8 +3,7 @@
  */
 
 #include <config.h>
-#include <math.h>
-#include <sys/time.h>
+#include <time.h>
 
 /*
 #include <isc/buffer.h>
@@ -24,29 +23,106 @@
 #include <dns/view.h>
  */
 
+#include <isc/atomic.h>
+#include <isc/buffer.h>
+#include <isc/file.h>
 #include <isc/mem.h>
+#include <isc/mutexblock.h>
+#include <isc/print.h>
+#include <isc/refcount.h>
+#include <isc/stdio.h>
+#include <isc/string.h>
 #include <dns/dampening.h>
 #include <dns/log.h>
 #include <dns/view.h>
 
+/*
+ * The timing uses the coarse monotonic clock, which is read from the vDSO
+ * without a system call. Its resolution is a few milliseconds, so single
+ * measurements are mostly zero, but the sums over many operations are
+ * meaningful. The counters belong to the instance and are updated under
+ * its lock. Timing can be disabled by "report-timing no;".
+ */
+#if defined(HAVE_CLOCK_GETTIME) && defined(CLOCK_MONOTONIC_COARSE)
+#define DAMPENING_CLOCK	CLOCK_MONOTONIC_COARSE
+#elif defined(HAVE_CLOCK_GETTIME) && defined(CLOCK_MONOTONIC)
+#define DAMPENING_CLOCK	CLOCK_MONOTONIC
+#endif
+
+static inline isc_uint64_t
+dampening_clock(void) {
+#ifdef DAMPENING_CLOCK
+   struct timespec ts;
+
+   if(clock_gettime(DAMPENING_CLOCK, &ts) == 0)
+     return (isc_uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+   return 0;
+}
+
 #define DAMPENING_STATISTICS_DO(impl, field, command)	do { \
-   struct timeval before, after, diff; \
-   gettimeofday(&before, NULL); \
-   command; \
-   gettimeofday(&after, NULL); \
-   timersub(&after, &before, &diff); \
-   timeradd(&diff, &((impl)->statistics.field), &after); \
-   (impl)->statistics.field = after; \
+   if((impl)->conf->statistics.timing) { \
+      isc_uint64_t before = dampening_clock(); \
+      command; \
+      (impl)->statistics.total.field += dampening_clock() - before; \
+   } else { \
+      command; \
+   } \
 }  while(0)
-#define DAMPENING_STATISTICS_INC(impl, field)	do { (impl)->statistics.field++; } while(0)
+#define DAMPENING_STATISTICS_INC(impl, field)	do { (impl)->statistics.total.field++; } while(0)
+
+/*
+ * Log the counters of an instance since the last report.
+ */
+#define DAMPENING_DIFF(impl, field) \
+   ((impl)->statistics.total.field - (impl)->statistics.reported.field)
+#define DAMPENING_SECONDS(impl, field) \
+   (unsigned long)(DAMPENING_DIFF(impl, field) / 1000000000), \
+   (unsigned long)(DAMPENING_DIFF(impl, field) % 1000000000 / 1000)
+
+static void
+report_statistics(dns_dampening_implementation_t * impl, int shard) {
+   if(isc_log_wouldlog(dns_lctx, ISC_LOG_INFO))
+     isc_log_write(dns_lctx, DNS_LOGCATEGORY_DAMPENING,
+		   DNS_LOGMODULE_REQUEST, ISC_LOG_INFO,
+		   "Stats for #%d/%d: queries %lu/%lu/%lu: lock=%lu.%06lu, search=%lu.%06lu, update=%lu.%06lu, add=%lu.%06lu",
+		   (int)(impl - impl->conf->workers) / impl->conf->shards_count, shard,
+		   (unsigned long)DAMPENING_DIFF(impl, allowed),
+		   (unsigned long)DAMPENING_DIFF(impl, denied),
+		   (unsigned long)DAMPENING_DIFF(impl, skipped),
+		   DAMPENING_SECONDS(impl, lock),
+		   DAMPENING_SECONDS(impl, search),
+		   DAMPENING_SECONDS(impl, update),
+		   DAMPENING_SECONDS(impl, add));
+   impl->statistics.reported = impl->statistics.total;
+}
+
+/*
+ * Iterate over the instances of all implementations responsible for 'shard'.
+ */
+#define DAMPENING_FOREACH(damp, impl, shard)	\
+   for(impl = (damp)->workers + (shard); \
+       impl < (damp)->workers + (damp)->workers_count * (damp)->shards_count; \
+       impl += (damp)->shards_count)
+
+/*
+ * The table holding the entries of 'damp', shared by several views or not.
+ */
+#define DAMPENING_TABLE(damp)	((damp)->store != NULL ? (damp)->store : (damp))
 
 
-static isc_result_t queue_init(isc_mem_t *, dns_dampening_implementation_t *, dns_dampening_t *, uint16_t);
+static isc_result_t queue_init(isc_mem_t *, dns_dampening_implementation_t *, dns_dampening_t *, isc_uint32_t, isc_uint32_t);
+static isc_result_t sketch_init(isc_mem_t *, dns_dampening_implementation_t *, dns_dampening_t *, isc_uint32_t, isc_uint32_t);
+static isc_uint32_t filter_publish(dns_dampening_filter_t *, const dns_dampening_t *, const isc_netaddr_t *, const struct dns_dampening_prefix *, isc_stdtime_t);
 
+/*
+ * Indexed by the bits of DNS_DAMPENING_STORAGE_*.
+ */
 static isc_result_t
 (*(implementations[])) (isc_mem_t *, dns_dampening_implementation_t *,
-			dns_dampening_t *, uint16_t) = {
-	queue_init
+			dns_dampening_t *, isc_uint32_t, isc_uint32_t) = {
+	queue_init,
+	sketch_init
 };
    
 
@@ -91,22 +167,144 @@ extract_prefix(isc_netaddr_t * prefix, const isc_netaddr_t * addr, const struct
 
 }
 
+/*
+ * Select the shard for a prefix using FNV-1a. This hash must differ from the
+ * one used inside the implementations, otherwise all entries of a shard would
+ * cluster in a fraction of the shard's hash buckets.
+ */
+static isc_uint32_t
+shard_hash(const isc_netaddr_t * prefix) {
+   const unsigned char * buff = (const unsigned char*)&prefix->type;
+   isc_uint32_t h = 2166136261U;
+   unsigned int i, len;
+
+   INSIST(prefix != NULL);
+
+   len = prefix->family == AF_INET  ? sizeof(prefix->type.in ) :
+         prefix->family == AF_INET6 ? sizeof(prefix->type.in6) :
+                                      sizeof(prefix->type    ) ;
+   for(i = 0; i < len; i++) {
+      h ^= buff[i];
+      h *= 16777619U;
+   }
+   h ^= prefix->zone;
+   h *= 16777619U;
+   return h;
+}
+
+/*
+ * Entries of the aggregation levels above 0 are told apart from the
+ * prefixes of level 0 by the level in the zone of their address.
+ */
+#define LEVEL_TAG	0x80000000U
+
+static unsigned int
+level_of(const isc_netaddr_t * prefix) {
+   return (prefix->zone & LEVEL_TAG) != 0 ? prefix->zone & ~LEVEL_TAG : 0;
+}
+
+static const struct dns_dampening_prefix *
+level_prefixlen(const dns_dampening_t * damp, unsigned int level) {
+   INSIST(level <= (unsigned int)damp->aggregate_count);
+
+   return level == 0 ? &damp->prefixlen : &damp->aggregate[level - 1].prefixlen;
+}
+
+static unsigned int
+level_length(const dns_dampening_t * damp, unsigned int level, int family) {
+   const struct dns_dampening_prefix * prefixlen = level_prefixlen(damp, level);
+
+   return family == AF_INET ? prefixlen->ipv4 : prefixlen->ipv6;
+}
+
+static void
+level_limits(const dns_dampening_t * damp, unsigned int level,
+	     unsigned int * enable, unsigned int * disable) {
+   if(level == 0 || level > (unsigned int)damp->aggregate_count) {
+      *enable  = damp->limit.enable_dampening;
+      *disable = damp->limit.disable_dampening;
+   } else {
+      *enable  = damp->aggregate[level - 1].enable_dampening;
+      *disable = damp->aggregate[level - 1].disable_dampening;
+   }
+}
+
+/*
+ * Extract the prefix of the aggregation level. Return ISC_FALSE if the
+ * level does not apply to the address family.
+ */
+static isc_boolean_t
+extract_level(isc_netaddr_t * prefix, const isc_netaddr_t * addr,
+	      const dns_dampening_t * damp, unsigned int level) {
+   extract_prefix(prefix, addr, level_prefixlen(damp, level));
+   if(level == 0)
+     return ISC_TRUE;
+   if(level_length(damp, level, addr->family) >=
+      level_length(damp, 0, addr->family))
+     return ISC_FALSE;
+   prefix->zone = LEVEL_TAG | level;
+   return ISC_TRUE;
+}
+
+/*
+ * Select the shard by the coarsest prefix of all levels, so a lock covers
+ * all entries of a client.
+ */
+static int
+shard_of(const dns_dampening_t * damp, const isc_netaddr_t * prefix) {
+   struct dns_dampening_prefix coarsest;
+   isc_netaddr_t masked;
+   int i;
+
+   INSIST(damp != NULL);
+
+   if(damp->shards_count <= 1)
+     return 0;
+   coarsest = damp->prefixlen;
+   for(i = 0; i < damp->aggregate_count; i++) {
+      coarsest.ipv4 = ISC_MIN(coarsest.ipv4, damp->aggregate[i].prefixlen.ipv4);
+      coarsest.ipv6 = ISC_MIN(coarsest.ipv6, damp->aggregate[i].prefixlen.ipv6);
+   }
+   extract_prefix(&masked, prefix, &coarsest);
+   masked.zone = 0;
+   return shard_hash(&masked) % damp->shards_count;
+}
+
+unsigned int
+dns_dampening_prefixlen(const dns_dampening_t * damp,
+			const isc_netaddr_t * prefix) {
+   unsigned int level;
+
+   REQUIRE(damp != NULL);
+   REQUIRE(prefix != NULL);
+
+   damp = damp->store != NULL ? damp->store : damp;
+   level = level_of(prefix);
+   if(level > (unsigned int)damp->aggregate_count)
+     level = 0;
+   return level_length(damp, level, prefix->family);
+}
+
 static void
 log_dampening(const dns_dampening_t * conf, const isc_netaddr_t * prefix, int enabled) {
    char pb[ISC_NETADDR_FORMATSIZE];
+   isc_netaddr_t netaddr;
    int len;
    
    INSIST(conf != NULL);
    INSIST(prefix != NULL);
    
    switch(prefix->family) {
-    case AF_INET : len = conf->prefixlen.ipv4; break;
-    case AF_INET6: len = conf->prefixlen.ipv6; break;
+    case AF_INET :
+    case AF_INET6: len = dns_dampening_prefixlen(conf, prefix); break;
     default      : return;
    }
 
    if(isc_log_wouldlog(dns_lctx, ISC_LOG_INFO)) {
-      isc_netaddr_format(prefix, pb, sizeof(pb));
+      netaddr = *prefix;
+      if(level_of(&netaddr) != 0)
+	netaddr.zone = 0;
+      isc_netaddr_format(&netaddr, pb, sizeof(pb));
       isc_log_write(dns_lctx, DNS_LOGCATEGORY_DAMPENING,
 		    DNS_LOGMODULE_REQUEST, ISC_LOG_INFO,
 		    "%s/%d dampening %s.",pb, len,
@@ -114,6 +312,62 @@ log_dampening(const dns_dampening_t * conf, const isc_netaddr_t * prefix, int en
    }
 }
 
+/*
+ * Compute 2^(-num/den) for 0 <= num <= den by the series of exp(-x).
+ * This is only used to set up the decay table, so libm is not needed.
+ */
+static double
+decay_base(int num, int den) {
+   double x = -0.69314718055994530942 * num / den, term = 1.0, sum = 1.0;
+   int i;
+
+   for(i = 1; i < 30; i++) {
+      term *= x / i;
+      sum += term;
+   }
+   return sum;
+}
+
+void
+dns_dampening_setdecay(dns_dampening_t * damp, int halflife, int updatedelay) {
+   double base, factor = 1.0;
+   int i;
+
+   REQUIRE( damp != NULL );
+   REQUIRE( halflife > 0 );
+
+   damp->decay.halflife = halflife;
+   damp->decay.updatedelay = updatedelay;
+   damp->decay.step = (halflife + DNS_DAMPENING_DECAY_STEPS - 1)
+		      / DNS_DAMPENING_DECAY_STEPS;
+
+   base = decay_base(damp->decay.step, halflife);
+   for(i = 0; i < DNS_DAMPENING_DECAY_STEPS; i++) {
+      damp->decay.factor[i] = (isc_uint32_t)(factor * 65536.0 + 0.5);
+      factor *= base;
+   }
+}
+
+/*
+ * Exponential decay by fixed point arithmetic: Each full halflife is a
+ * shift, the rest is looked up in the table.
+ */
+unsigned int
+dns_dampening_decay(const dns_dampening_t * damp, unsigned int penalty,
+		    unsigned int elapsed) {
+   unsigned int halves, rest;
+
+   REQUIRE( damp != NULL );
+   INSIST( damp->decay.halflife > 0 );
+
+   halves = elapsed / damp->decay.halflife;
+   if(halves >= 32)
+     return 0;
+   rest = elapsed % damp->decay.halflife;
+   return ((isc_uint64_t)penalty * damp->decay.factor[rest / damp->decay.step])
+     >> (16 + halves);
+}
+
 /*
  * Decay the penalty value, if necessary and add the new points.
  * Return zero if the entry is below the drop limit. Caller should remove it
@@ -123,16 +377,16 @@ log_dampening(const dns_dampening_t * conf, const isc_netaddr_t * prefix, int en
 static int
 update_penalty(const dns_dampening_t * conf, dns_dampening_entry_t * entry,
 	       uint16_t points, isc_stdtime_t now) {
+   unsigned int enable, disable;
    int timediff;
    
    INSIST(conf != NULL);
    INSIST(entry != NULL);
    
+   level_limits(conf, level_of(&entry->netaddr), &enable, &disable);
    timediff = now - entry->last_updated;
    if(timediff > conf->decay.updatedelay) {
-      float penalty = entry->penalty;
-      penalty *= exp(-(0.693*timediff)/conf->decay.halflife);
-      entry->penalty = penalty;
+      entry->penalty = dns_dampening_decay(conf, entry->penalty, timediff);
       entry->last_updated = now;
    }
    if(entry->penalty >= conf->limit.maximum - points)
@@ -140,12 +394,12 @@ update_penalty(const dns_dampening_t * conf, dns_dampening_entry_t * entry,
    else
      entry->penalty += points;
 
-   if(entry->dampening == 1 && entry->penalty < conf->limit.disable_dampening) {
+   if(entry->dampening == 1 && entry->penalty < disable) {
       entry->dampening = 0;
       log_dampening(conf, &entry->netaddr, entry->dampening);
    }
    
-   if(entry->dampening == 0 && entry->penalty > conf->limit.enable_dampening) {
+   if(entry->dampening == 0 && entry->penalty > enable) {
       entry->dampening = 1;
       log_dampening(conf, &entry->netaddr, entry->dampening);
    }
@@ -158,247 +412,1335 @@ update_penalty(const dns_dampening_t * conf, dns_dampening_entry_t * entry,
    }
 }
 
+/*
+ * Return the entry of implementation #i for prefix #l of the handle.
+ * A valid slot reference saves the search, a stale one is refreshed.
+ * Must be called with the lock held.
+ */
+static dns_dampening_entry_t *
+handle_entry(dns_dampening_implementation_t * impl,
+	     dns_dampening_handle_t * handle, int l, int i) {
+   dns_dampening_entry_t * entry = handle->level[l].slot[i].entry;
+
+   if(entry != NULL && entry->generation == handle->level[l].slot[i].generation)
+     return entry;
+
+   DAMPENING_STATISTICS_DO(impl, search, entry = impl->search(impl->data, &handle->level[l].prefix));
+   handle->level[l].slot[i].entry = entry;
+   if(entry != NULL)
+     handle->level[l].slot[i].generation = entry->generation;
+   return entry;
+}
+
+/*
+ * Compute the points for the query type and repeated message ids.
+ */
+static uint16_t
+qtype_points(const dns_dampening_t * damp, dns_dampening_entry_t * entry,
+	     dns_messageid_t message_id, int qtype) {
+   uint16_t points;
+
+   switch(qtype) {
+    case dns_rdatatype_any: points = damp->score.qtype_any; break;
+    default               : points = 0;                     break;
+   }
+	 
+   if(entry->last_id == message_id) {
+      points += (entry->last_id_count++)*damp->score.duplicates;
+   } else {
+      entry->last_id = message_id;
+      entry->last_id_count = 1;
+   }
+   return points;
+}
+
+/*
+ * Compute the points for the response size.
+ */
+static uint16_t
+size_points(const dns_dampening_t * damp, int length) {
+   length = ISC_MAX(length, damp->score.minimum_size);
+   length = ISC_MIN(length, damp->score.maximum_size);
+   return damp->score.size_penalty
+     * (length - damp->score.minimum_size)
+     / (damp->score.maximum_size - damp->score.minimum_size);
+}
+
+/*
+ * The state of an entry for the view 'damp'. The entries of a shared
+ * table carry the state computed with the limits of the table. A view
+ * with limits of its own suppresses above its enable limit, and keeps
+ * suppressing down to its disable limit while the table does.
+ */
+static dns_dampening_state_t
+entry_state(const dns_dampening_t * damp, const dns_dampening_entry_t * entry) {
+   unsigned int enable, disable;
+
+   if(damp->store == NULL)
+     return entry->dampening == 1
+       ? DNS_DAMPENING_STATE_SUPPRESS
+       : DNS_DAMPENING_STATE_NORMAL;
+
+   level_limits(damp, level_of(&entry->netaddr), &enable, &disable);
+   return (entry->penalty > enable ||
+	   (entry->dampening == 1 && entry->penalty >= disable))
+     ? DNS_DAMPENING_STATE_SUPPRESS
+     : DNS_DAMPENING_STATE_NORMAL;
+}
+
+/*
+ * Fill the handle with the prefixes, shard, and exemption of the client.
+ */
+static void
+handle_resolve(dns_dampening_t * damp, const isc_sockaddr_t * addr,
+	       dns_dampening_handle_t * handle) {
+   isc_netaddr_t netaddr;
+   dns_dampening_t * table = DAMPENING_TABLE(damp);
+   int l;
+
+   dns_dampening_handle_init(handle);
+   isc_netaddr_fromsockaddr(&netaddr, addr);
+   for(l = 0; l <= table->aggregate_count; l++)
+     if(extract_level(&handle->level[handle->levels].prefix, &netaddr, table, l))
+       handle->levels++;
+   handle->shard = shard_of(table, &handle->level[0].prefix);
+   handle->damp = damp;
+
+   if(damp->exempt != NULL) {
+      int match;
+	 
+      if (ISC_R_SUCCESS == dns_acl_match(&netaddr, NULL, damp->exempt,
+					 NULL, &match, NULL) &&
+	  match > 0)
+	handle->exempt = ISC_TRUE;
+   }
+}
+
+void
+dns_dampening_handle_init(dns_dampening_handle_t * handle) {
+   REQUIRE( handle != NULL );
+
+   memset(handle, 0, sizeof(*handle));
+   handle->pending_qtype = -1;
+}
+
 dns_dampening_state_t
 dns_dampening_query(dns_dampening_t * damp, const isc_sockaddr_t * addr,
-		    isc_stdtime_t now, int * penalty) {
-   isc_netaddr_t netaddr, prefix;
+		    isc_stdtime_t now, int * penalty,
+		    dns_dampening_handle_t * handle) {
+   dns_dampening_handle_t local;
    dns_dampening_state_t final_state = DNS_DAMPENING_STATE_NORMAL, state = DNS_DAMPENING_STATE_NORMAL;
    dns_dampening_entry_t * entry;
    dns_dampening_implementation_t *impl;
-   int max_penalty = -2;
+   dns_dampening_t * table;
+   isc_netaddr_t published;
+   int max_penalty = -2, i = 0, l, publish = -1;
 
    RUNTIME_CHECK( damp != NULL );
    RUNTIME_CHECK( addr != NULL );
+   table = DAMPENING_TABLE(damp);
+   INSIST( table->workers_count <= DNS_DAMPENING_MAXIMPL );
 
-   isc_netaddr_fromsockaddr(&netaddr, addr);
-   extract_prefix(&prefix, &netaddr, &(damp->prefixlen));
+   if(handle == NULL)
+     handle = &local;
+   handle_resolve(damp, addr, handle);
    
-   for(impl = damp->workers;
-       impl - damp->workers < damp->workers_count;
-       impl++) {
+   DAMPENING_FOREACH(table, impl, handle->shard) {
+      isc_boolean_t suppress = ISC_FALSE;
       
-      if(damp->exempt != NULL) {
-	 int match;
-	 
-	 if (ISC_R_SUCCESS == dns_acl_match(&netaddr, NULL, damp->exempt,
-					    NULL, &match, NULL) &&
-	     match > 0) {
-	    max_penalty = ISC_MAX(max_penalty, -1);
-	    DAMPENING_STATISTICS_INC(impl,skipped);
-	    continue;
-	 }
+      if(handle->exempt) {
+	 max_penalty = ISC_MAX(max_penalty, -1);
+	 DAMPENING_STATISTICS_INC(impl,skipped);
+	 continue;
       }
       
       DAMPENING_STATISTICS_DO(impl, lock, LOCK(&impl->lock));
       
-      if(damp->statistics.report_interval > 0 &&
-	 damp->statistics.report_interval + impl->statistics.last_report <= now) {
-	 if(isc_log_wouldlog(dns_lctx, ISC_LOG_INFO))
-	   isc_log_write(dns_lctx, DNS_LOGCATEGORY_DAMPENING,
-			 DNS_LOGMODULE_REQUEST, ISC_LOG_INFO,
-			 "Stats for #%d: queries %u/%u/%u: lock=%ld.%06ld, search=%ld.%06ld, update=%ld.%06ld, add=%ld.%06ld",
-			 impl - damp->workers,
-			 impl->statistics.allowed, impl->statistics.denied, impl->statistics.skipped,
-			 impl->statistics.lock.tv_sec, impl->statistics.lock.tv_usec,
-			 impl->statistics.search.tv_sec, impl->statistics.search.tv_usec,
-			 impl->statistics.update.tv_sec, impl->statistics.update.tv_usec,
-			 impl->statistics.add.tv_sec, impl->statistics.add.tv_usec);
-	 memset(&impl->statistics, 0, sizeof(impl->statistics));
+      if(table->statistics.report_interval > 0 &&
+	 table->statistics.report_interval + impl->statistics.last_report <= now) {
+	 report_statistics(impl, handle->shard);
 	 impl->statistics.last_report = now;
       }
       
-      DAMPENING_STATISTICS_DO(impl, search, entry = impl->search(impl->data, &prefix));
-      if(entry == NULL) {
-	 state = DNS_DAMPENING_STATE_NORMAL;
-	 DAMPENING_STATISTICS_DO(impl, add, impl->add(impl->data, &prefix, damp->score.first_query, now));
-	 max_penalty = ISC_MAX(max_penalty, 0);
-      } else {
-	 state = entry->dampening == 1
-	   ? DNS_DAMPENING_STATE_SUPPRESS
-	   : DNS_DAMPENING_STATE_NORMAL;
-	 max_penalty = ISC_MAX(max_penalty, entry->penalty);
-	 DAMPENING_STATISTICS_DO(impl, update, impl->update(impl->data, &entry, damp->score.per_query, now));
+      for(l = 0; l < handle->levels; l++) {
+	 DAMPENING_STATISTICS_DO(impl, search, entry = impl->search(impl->data, &handle->level[l].prefix));
+	 if(entry == NULL) {
+	    state = DNS_DAMPENING_STATE_NORMAL;
+	    DAMPENING_STATISTICS_DO(impl, add, entry = impl->add(impl->data, &handle->level[l].prefix, damp->score.first_query, now));
+	    max_penalty = ISC_MAX(max_penalty, 0);
+	    handle->level[l].slot[i].entry = entry;
+	    if(entry != NULL)
+	      handle->level[l].slot[i].generation = entry->generation;
+	 } else {
+	    /*
+	     * Remember the generation before the update: an irrelevant
+	     * entry is freed by it, which invalidates the reference.
+	     */
+	    handle->level[l].slot[i].entry = entry;
+	    handle->level[l].slot[i].generation = entry->generation;
+	    state = entry_state(damp, entry);
+	    max_penalty = ISC_MAX(max_penalty, entry->penalty);
+	    DAMPENING_STATISTICS_DO(impl, update, impl->update(impl->data, &entry, damp->score.per_query, now));
+	 }
+
+	 /* The coarsest suppressed prefix covers the others in the filter */
+	 if(state == DNS_DAMPENING_STATE_SUPPRESS) {
+	    suppress = ISC_TRUE;
+	    if(publish < 0 ||
+	       dns_dampening_prefixlen(table, &handle->level[l].prefix) <
+	       dns_dampening_prefixlen(table, &handle->level[publish].prefix))
+	      publish = l;
+	 }
       }
       
-      if(state == DNS_DAMPENING_STATE_NORMAL) {
+      if(!suppress) {
 	 DAMPENING_STATISTICS_INC(impl, allowed);
       } else {
 	 DAMPENING_STATISTICS_INC(impl, denied);
-	 final_state = state;	       /* any dampening suffice */
+	 final_state = DNS_DAMPENING_STATE_SUPPRESS; /* any dampening suffice */
       }
 
       UNLOCK(&impl->lock);
+      i++;
+   }
+
+   /*
+    * Let the early drop filter reject the following queries of this prefix
+    * and charge the queries it dropped meanwhile.
+    */
+   if(final_state == DNS_DAMPENING_STATE_SUPPRESS && damp->filter != NULL) {
+      isc_uint32_t drops;
+
+      published = handle->level[publish].prefix;
+      if(level_of(&published) != 0)
+	published.zone = 0;
+      drops = filter_publish(damp->filter, damp, &published,
+			     level_prefixlen(table, level_of(&handle->level[publish].prefix)),
+			     now);
+
+      i = 0;
+      if(drops > 0) {
+	 uint16_t points = ISC_MIN(drops * damp->score.per_query, 0xffff);
+
+	 DAMPENING_FOREACH(table, impl, handle->shard) {
+	    DAMPENING_STATISTICS_DO(impl, lock, LOCK(&impl->lock));
+	    for(l = 0; l < handle->levels; l++) {
+	       entry = handle_entry(impl, handle, l, i);
+	       if(entry != NULL)
+		 DAMPENING_STATISTICS_DO(impl, update, impl->update(impl->data, &entry, points, now));
+	    }
+	    impl->statistics.total.denied += drops;
+	    UNLOCK(&impl->lock);
+	    i++;
+	 }
+      }
    }
    
    if(penalty != NULL) *penalty = max_penalty;
    return final_state;
 }
 
-void dns_dampening_score_qtype(dns_dampening_t * damp,
-			       const isc_sockaddr_t * addr,
-			       isc_stdtime_t now,
-			       dns_messageid_t message_id,
-			       int qtype) {
-   isc_netaddr_t netaddr, prefix;
+/*
+ * Apply the deferred query type points and the given size points to
+ * all entries of the handle.
+ */
+static void
+handle_apply(dns_dampening_t * damp, dns_dampening_handle_t * handle,
+	     isc_stdtime_t now, uint16_t size) {
    dns_dampening_entry_t * entry;
-   uint16_t points;
    dns_dampening_implementation_t *impl;
+   uint16_t points;
+   int i = 0, l;
    
-   RUNTIME_CHECK( damp != NULL );
-   RUNTIME_CHECK( addr != NULL );
-   
-   isc_netaddr_fromsockaddr(&netaddr, addr);
-   extract_prefix(&prefix, &netaddr, &(damp->prefixlen));
-  
-   for(impl = damp->workers;
-       impl - damp->workers < damp->workers_count;
-       impl++) {
-
-      if(damp->exempt != NULL) {
-	 int match;
-	 
-	 if (ISC_R_SUCCESS == dns_acl_match(&netaddr, NULL, damp->exempt,
-					    NULL, &match, NULL) &&
-	     match > 0) {
-	    DAMPENING_STATISTICS_INC(impl,skipped);
-	    continue;
-	 }
+   DAMPENING_FOREACH(DAMPENING_TABLE(damp), impl, handle->shard) {
+      if(handle->exempt) {
+	 DAMPENING_STATISTICS_INC(impl,skipped);
+	 continue;
       }
       
       DAMPENING_STATISTICS_DO(impl, lock, LOCK(&impl->lock));
-      DAMPENING_STATISTICS_DO(impl, search, entry = impl->search(impl->data, &prefix));
-      
-      if(entry != NULL) {
-	 switch(qtype) {
-	  case dns_rdatatype_any: points = damp->score.qtype_any; break;
-	  default               : points = 0;                     break;
-	 }
-	 
-	 if(entry->last_id == message_id) {
-	    points += (entry->last_id_count++)*damp->score.duplicates;
-	 } else {
-	    entry->last_id = message_id;
-	    entry->last_id_count = 1;
+      for(l = 0; l < handle->levels; l++) {
+	 entry = handle_entry(impl, handle, l, i);
+	 if(entry != NULL) {
+	    points = size;
+	    if(handle->pending_qtype >= 0)
+	      points += qtype_points(damp, entry, handle->pending_id,
+				     handle->pending_qtype);
+	    DAMPENING_STATISTICS_DO(impl, update, impl->update(impl->data, &entry, points, now));
 	 }
-
-	 DAMPENING_STATISTICS_DO(impl, update, impl->update(impl->data, &entry, points, now));
       }
-
       UNLOCK(&impl->lock);
+      i++;
    }
+   handle->pending_qtype = -1;
 }
 
-void dns_dampening_score_size(dns_dampening_t * damp, const isc_sockaddr_t * addr, isc_stdtime_t now, int length) {
-   isc_netaddr_t netaddr, prefix;
-   dns_dampening_entry_t * entry;
-   uint16_t points;
-   dns_dampening_implementation_t *impl;
+void dns_dampening_score_qtype(dns_dampening_t * damp,
+			       const isc_sockaddr_t * addr,
+			       isc_stdtime_t now,
+			       dns_messageid_t message_id,
+			       int qtype,
+			       dns_dampening_handle_t * handle) {
+   dns_dampening_handle_t local;
    
    RUNTIME_CHECK( damp != NULL );
    RUNTIME_CHECK( addr != NULL );
-
-   isc_netaddr_fromsockaddr(&netaddr, addr);
-   extract_prefix(&prefix, &netaddr, &(damp->prefixlen));
    
-   for(impl = damp->workers;
-       impl - damp->workers < damp->workers_count;
-       impl++) {
+   /*
+    * With a resolved handle the points are added together with the
+    * size points, saving a lock round-trip.
+    */
+   if(handle != NULL && handle->damp == damp) {
+      handle->pending_qtype = qtype;
+      handle->pending_id = message_id;
+      return;
+   }
    
-      if(damp->exempt != NULL) {
-	 int match;
-	 
-	 if (ISC_R_SUCCESS == dns_acl_match(&netaddr, NULL, damp->exempt,
-					    NULL, &match, NULL) &&
-	     match > 0) {
-	    DAMPENING_STATISTICS_INC(impl,skipped);
-	    continue;
-	 }
-      }
+   handle_resolve(damp, addr, &local);
+   local.pending_qtype = qtype;
+   local.pending_id = message_id;
+   handle_apply(damp, &local, now, 0);
+}
+
+void dns_dampening_score_size(dns_dampening_t * damp,
+			      const isc_sockaddr_t * addr,
+			      isc_stdtime_t now, int length,
+			      dns_dampening_handle_t * handle) {
+   dns_dampening_handle_t local;
    
-      DAMPENING_STATISTICS_DO(impl, lock, LOCK(&impl->lock));
-      DAMPENING_STATISTICS_DO(impl, search, entry = impl->search(impl->data, &prefix));
-      if(entry != NULL) {
-	 length = ISC_MAX(length, damp->score.minimum_size);
-	 length = ISC_MIN(length, damp->score.maximum_size);
-	 points = damp->score.size_penalty
-	   * (length - damp->score.minimum_size)
-	   / (damp->score.maximum_size - damp->score.minimum_size);
-	 DAMPENING_STATISTICS_DO(impl, update, impl->update(impl->data, &entry, points, now));
+   RUNTIME_CHECK( damp != NULL );
+   RUNTIME_CHECK( addr != NULL );
+
+   if(handle == NULL || handle->damp != damp) {
+      handle = &local;
+      handle_resolve(damp, addr, handle);
+   }
+   handle_apply(damp, handle, now, size_points(damp, length));
+}
+
+void dns_dampening_flush(dns_dampening_t * damp,
+			 dns_dampening_handle_t * handle,
+			 isc_stdtime_t now) {
+   REQUIRE( handle != NULL );
+
+   if(damp != NULL && handle->damp == damp &&
+      handle->pending_qtype >= 0)
+     handle_apply(damp, handle, now, 0);
+   dns_dampening_handle_init(handle);
+}
+
+/********************************************************
+ * Early drop filter
+ ********************************************************/
+
+/*
+ * The filter is a direct mapped cache of the currently suppressed prefixes,
+ * shared by all views. It is checked before the query is parsed, so a
+ * dampened client costs only a hash probe. Entries expire after the
+ * update-delay of the publishing view. The next query then passes the normal
+ * path, which republishes the prefix if it is still dampened. The dropped
+ * queries are counted in the entry and charged to the dampening table on
+ * republishing, so penalties are the same as without the filter. When the
+ * slot is taken over by another prefix, or the publishing view goes away,
+ * the pending drops are charged to the entry of the prefix instead, so
+ * none is lost from the penalties and the denied counters.
+ *
+ * Each entry remembers the table of the view which published it. A query
+ * is only dropped if it would be handled by that view and the view does
+ * not exempt the client, see dns_dampening_filter_check().
+ *
+ * Only the prefix lengths used by the views are probed, usually one per
+ * address family. The lengths are only appended, and the count is updated
+ * atomically after the new length is stored.
+ */
+
+#define FILTER_SIZE	16384		/* power of two */
+#define FILTER_LOCKS	64
+#define FILTER_LENGTHS	4
+
+typedef struct {
+   isc_netaddr_t prefix;
+   unsigned int prefixlen;
+   isc_stdtime_t expire;
+   isc_uint32_t drops;
+   const dns_dampening_t * owner;	/* publishing view, not attached */
+} filter_entry_t;
+
+struct dns_dampening_filter {
+   isc_mem_t * mctx;
+   isc_refcount_t references;
+   isc_mutex_t lock;			/* protects lengths */
+   struct dns_dampening_prefix lengths[FILTER_LENGTHS];
+   isc_int32_t lengths_count;
+   isc_mutex_t locks[FILTER_LOCKS];
+   filter_entry_t entries[FILTER_SIZE];
+};
+
+static unsigned int
+filter_slot(const isc_netaddr_t * prefix, unsigned int prefixlen) {
+   return (shard_hash(prefix) ^ (prefixlen * 0x9e3779b1U)) & (FILTER_SIZE - 1);
+}
+
+/*
+ * Return the number of prefix lengths registered in the filter.
+ */
+static int
+filter_lengths(dns_dampening_filter_t * filter) {
+   int n;
+
+#ifdef ISC_PLATFORM_HAVEXADD
+   n = isc_atomic_xadd(&filter->lengths_count, 0);
+#else
+   LOCK(&filter->lock);
+   n = filter->lengths_count;
+   UNLOCK(&filter->lock);
+#endif
+   return n;
+}
+
+/*
+ * Probe the filter for the prefixes of 'addr'. If 'damp' is NULL, any
+ * published entry matches, otherwise only one published by 'damp', and
+ * the drop is counted.
+ */
+static isc_boolean_t
+filter_probe(dns_dampening_filter_t * filter, const dns_dampening_t * damp,
+	     const isc_sockaddr_t * addr, isc_stdtime_t now) {
+   isc_netaddr_t netaddr, prefix;
+   filter_entry_t * e;
+   unsigned int len, slot;
+   isc_boolean_t drop = ISC_FALSE;
+   int i, n;
+
+   isc_netaddr_fromsockaddr(&netaddr, addr);
+   n = filter_lengths(filter);
+   for(i = 0; i < n && !drop; i++) {
+      extract_prefix(&prefix, &netaddr, &filter->lengths[i]);
+      len = prefix.family == AF_INET ? filter->lengths[i].ipv4
+				     : filter->lengths[i].ipv6;
+      slot = filter_slot(&prefix, len);
+      e = &filter->entries[slot];
+
+      LOCK(&filter->locks[slot % FILTER_LOCKS]);
+      if(e->expire > now && e->prefixlen == len &&
+	 (damp == NULL || e->owner == damp) &&
+	 ISC_TRUE == isc_netaddr_equal(&prefix, &e->prefix)) {
+	 if(damp != NULL)
+	   e->drops++;
+	 drop = ISC_TRUE;
       }
+      UNLOCK(&filter->locks[slot % FILTER_LOCKS]);
+   }
+   return drop;
+}
+
+/*
+ * Charge 'drops' queries dropped by the filter for 'prefix' of length 'len'
+ * to the table of the view 'damp'. The entries of other prefixes of the
+ * dropped clients are unknown here, only the published prefix itself is
+ * penalized. Called with the slot lock held, which keeps 'damp' alive, see
+ * filter_forget().
+ */
+static void
+filter_charge(const dns_dampening_t * damp, const isc_netaddr_t * prefix,
+	      unsigned int len, isc_uint32_t drops, isc_stdtime_t now) {
+   dns_dampening_implementation_t * impl;
+   dns_dampening_entry_t * entry;
+   dns_dampening_t * table;
+   isc_netaddr_t key;
+   unsigned int level;
+   uint16_t points;
+   int shard;
 
+   DE_CONST(DAMPENING_TABLE(damp), table);
+   for(level = 0; level <= (unsigned int)table->aggregate_count; level++)
+     if(level_length(table, level, prefix->family) == len)
+       break;
+   if(level > (unsigned int)table->aggregate_count)
+     return;
+
+   key = *prefix;
+   key.zone = level == 0 ? 0 : LEVEL_TAG | level;
+   shard = shard_of(table, &key);
+   points = ISC_MIN(drops * damp->score.per_query, 0xffff);
+
+   DAMPENING_FOREACH(table, impl, shard) {
+      DAMPENING_STATISTICS_DO(impl, lock, LOCK(&impl->lock));
+      DAMPENING_STATISTICS_DO(impl, search, entry = impl->search(impl->data, &key));
+      if(entry != NULL)
+	DAMPENING_STATISTICS_DO(impl, update, impl->update(impl->data, &entry, points, now));
+      impl->statistics.total.denied += drops;
       UNLOCK(&impl->lock);
    }
 }
 
-isc_result_t dns_dampening_init(dns_view_t * view, int initial_size) {
+/*
+ * Remove the entries published by 'damp' from the filter, charging their
+ * pending drops. Called when the last reference to 'damp' is released, so
+ * no entry refers to a released view table.
+ */
+static void
+filter_forget(dns_dampening_filter_t * filter, const dns_dampening_t * damp) {
+   filter_entry_t * e;
+   isc_stdtime_t now;
+   unsigned int slot;
+
+   isc_stdtime_get(&now);
+   for(slot = 0; slot < FILTER_SIZE; slot++) {
+      e = &filter->entries[slot];
+      LOCK(&filter->locks[slot % FILTER_LOCKS]);
+      if(e->owner == damp) {
+	 if(e->drops > 0)
+	   filter_charge(damp, &e->prefix, e->prefixlen, e->drops, now);
+	 memset(e, 0, sizeof(*e));
+      }
+      UNLOCK(&filter->locks[slot % FILTER_LOCKS]);
+   }
+}
+
+isc_result_t
+dns_dampening_filter_create(isc_mem_t * mctx, dns_dampening_filter_t ** filterp) {
+   dns_dampening_filter_t * filter;
    isc_result_t result;
-   int i, num_workers = sizeof(implementations)/sizeof(*implementations);
-   
-   INSIST( view != NULL );
-   INSIST( view->dampening == NULL );
-   RUNTIME_CHECK( 0 < initial_size && initial_size <= ISC_UINT16_MAX );
 
-   view->dampening = isc_mem_get(view->mctx, sizeof(*(view->dampening)));
-   if( view->dampening == NULL ) {
-      result = ISC_R_NOMEMORY;
-      goto cleanup;
+   REQUIRE( mctx != NULL );
+   REQUIRE( filterp != NULL && *filterp == NULL );
+
+   filter = isc_mem_get(mctx, sizeof(*filter));
+   if(filter == NULL)
+     return ISC_R_NOMEMORY;
+   memset(filter, 0, sizeof(*filter));
+
+   result = isc_refcount_init(&filter->references, 1);
+   if(result != ISC_R_SUCCESS)
+     goto cleanup_filter;
+   result = isc_mutex_init(&filter->lock);
+   if(result != ISC_R_SUCCESS)
+     goto cleanup_refcount;
+   result = isc_mutexblock_init(filter->locks, FILTER_LOCKS);
+   if(result != ISC_R_SUCCESS)
+     goto cleanup_lock;
+
+   isc_mem_attach(mctx, &filter->mctx);
+   *filterp = filter;
+   return ISC_R_SUCCESS;
+
+cleanup_lock:
+   DESTROYLOCK(&filter->lock);
+cleanup_refcount:
+   isc_refcount_destroy(&filter->references);
+cleanup_filter:
+   isc_mem_put(mctx, filter, sizeof(*filter));
+   return result;
+}
+
+void
+dns_dampening_filter_attach(dns_dampening_filter_t * source,
+			    dns_dampening_filter_t ** targetp) {
+   REQUIRE( source != NULL );
+   REQUIRE( targetp != NULL && *targetp == NULL );
+
+   isc_refcount_increment(&source->references, NULL);
+   *targetp = source;
+}
+
+void
+dns_dampening_filter_detach(dns_dampening_filter_t ** filterp) {
+   dns_dampening_filter_t * filter;
+   unsigned int refs;
+
+   REQUIRE( filterp != NULL && *filterp != NULL );
+
+   filter = *filterp;
+   *filterp = NULL;
+   isc_refcount_decrement(&filter->references, &refs);
+   if(refs > 0)
+     return;
+
+   RUNTIME_CHECK(isc_mutexblock_destroy(filter->locks, FILTER_LOCKS) == ISC_R_SUCCESS);
+   DESTROYLOCK(&filter->lock);
+   isc_refcount_destroy(&filter->references);
+   isc_mem_putanddetach(&filter->mctx, filter, sizeof(*filter));
+}
+
+isc_boolean_t
+dns_dampening_filter_lookup(dns_dampening_filter_t * filter,
+			    const isc_sockaddr_t * addr, isc_stdtime_t now) {
+   REQUIRE( filter != NULL );
+   REQUIRE( addr != NULL );
+
+   return filter_probe(filter, NULL, addr, now);
+}
+
+isc_boolean_t
+dns_dampening_filter_check(dns_dampening_filter_t * filter,
+			   const dns_dampening_t * damp,
+			   const isc_sockaddr_t * addr, isc_stdtime_t now) {
+   isc_netaddr_t netaddr;
+   int match;
+
+   REQUIRE( filter != NULL );
+   REQUIRE( damp != NULL );
+   REQUIRE( addr != NULL );
+
+   if(damp->exempt != NULL) {
+      isc_netaddr_fromsockaddr(&netaddr, addr);
+      if (ISC_R_SUCCESS == dns_acl_match(&netaddr, NULL, damp->exempt,
+					 NULL, &match, NULL) &&
+	  match > 0)
+	return ISC_FALSE;
    }
-   memset( view->dampening, 0, sizeof(*(view->dampening)) );
+   return filter_probe(filter, damp, addr, now);
+}
 
-   view->dampening->workers = isc_mem_get(view->mctx, num_workers * sizeof(*(view->dampening->workers)));
-   if( view->dampening->workers == NULL ) {
-      result = ISC_R_NOMEMORY;
-      goto cleanup;
+/*
+ * Make a prefix of length 'prefixlen' suppressed by the view table 'damp'
+ * known to the filter. Return the number of queries dropped by the filter
+ * for this view since the prefix was last published.
+ */
+static isc_uint32_t
+filter_publish(dns_dampening_filter_t * filter, const dns_dampening_t * damp,
+	       const isc_netaddr_t * prefix,
+	       const struct dns_dampening_prefix * prefixlen,
+	       isc_stdtime_t now) {
+   filter_entry_t * e;
+   unsigned int len, slot;
+   isc_uint32_t drops = 0;
+   int i, n;
+
+   len = prefix->family == AF_INET ? prefixlen->ipv4 : prefixlen->ipv6;
+
+   /* Register the prefix lengths of this view once */
+   n = filter_lengths(filter);
+   for(i = 0; i < n; i++)
+     if(filter->lengths[i].ipv4 == prefixlen->ipv4 &&
+	filter->lengths[i].ipv6 == prefixlen->ipv6)
+       break;
+   if(i == n) {
+      LOCK(&filter->lock);
+      n = filter->lengths_count;
+      for(i = 0; i < n; i++)
+	if(filter->lengths[i].ipv4 == prefixlen->ipv4 &&
+	   filter->lengths[i].ipv6 == prefixlen->ipv6)
+	  break;
+      if(i == n && i < FILTER_LENGTHS) {
+	 filter->lengths[i] = *prefixlen;
+#ifdef ISC_PLATFORM_HAVEXADD
+	 (void)isc_atomic_xadd(&filter->lengths_count, 1);
+#else
+	 filter->lengths_count++;
+#endif
+      }
+      UNLOCK(&filter->lock);
+      if(i == FILTER_LENGTHS)
+	return 0;
+   }
+
+   slot = filter_slot(prefix, len);
+   e = &filter->entries[slot];
+   LOCK(&filter->locks[slot % FILTER_LOCKS]);
+   if(e->prefixlen == len && e->owner == damp &&
+      ISC_TRUE == isc_netaddr_equal(prefix, &e->prefix))
+     drops = e->drops;
+   else {
+      if(e->owner != NULL && e->drops > 0)
+	filter_charge(e->owner, &e->prefix, e->prefixlen, e->drops, now);
+      e->prefix = *prefix;
+      e->prefixlen = len;
+      e->owner = damp;
    }
-   memset( view->dampening->workers, 0, num_workers * sizeof(*(view->dampening->workers)) );
+   e->drops = 0;
+   e->expire = now + ISC_MAX(damp->decay.updatedelay, 1);
+   UNLOCK(&filter->locks[slot % FILTER_LOCKS]);
+
+   return drops;
+}
+
+isc_result_t dns_dampening_create(isc_mem_t * mctx, int initial_size,
+				  int max_entries, int shards,
+				  unsigned int storage,
+				  dns_dampening_t ** dampp) {
+   isc_result_t result;
+   int i, j, num_workers = 0, selected[DNS_DAMPENING_MAXIMPL];
+   int shard_size, shard_max;
+   dns_dampening_t * damp;
+   dns_dampening_implementation_t * impl;
+   
+   INSIST( mctx != NULL );
+   INSIST( dampp != NULL && *dampp == NULL );
+   RUNTIME_CHECK( 0 < initial_size && initial_size <= max_entries );
+   RUNTIME_CHECK( 0 < shards && shards <= initial_size );
+
+   for(j = 0; j < (int)(sizeof(implementations)/sizeof(*implementations)); j++)
+     if((storage & (1U << j)) != 0)
+       selected[num_workers++] = j;
+   RUNTIME_CHECK( 0 < num_workers && num_workers <= DNS_DAMPENING_MAXIMPL );
+
+   shard_size = (initial_size + shards - 1) / shards;
+   shard_max  = (max_entries  + shards - 1) / shards;
+
+   damp = isc_mem_get(mctx, sizeof(*damp));
+   if( damp == NULL )
+     return ISC_R_NOMEMORY;
+   memset( damp, 0, sizeof(*damp) );
+   isc_mem_attach(mctx, &damp->mctx);
+   isc_refcount_init(&damp->references, 1);
+
+   damp->workers = isc_mem_get(mctx, num_workers * shards * sizeof(*(damp->workers)));
+   if( damp->workers == NULL ) {
+      dns_dampening_detach(&damp);
+      return ISC_R_NOMEMORY;
+   }
+   memset( damp->workers, 0, num_workers * shards * sizeof(*(damp->workers)) );
+   damp->max_entries = max_entries;
+   damp->workers_count = num_workers;
+   damp->shards_count = shards;
+   damp->statistics.timing = ISC_TRUE;
    
-   for(i = 0; i < num_workers; i++) {
-      result = implementations[i](view->mctx,
-				  view->dampening->workers + i,
-				  view->dampening, initial_size);
+   for(i = 0; i < num_workers * shards; i++) {
+      impl = damp->workers + i;
+      impl->conf = damp;
+      
+      result = implementations[selected[i / shards]](mctx, impl, damp,
+						     shard_size, shard_max);
       if( ISC_R_SUCCESS != result) {
-	 dns_dampening_destroy( view );
-	 goto cleanup;
+	 impl->destroy = NULL;
+	 dns_dampening_detach(&damp);
+	 return result;
       }
    
-      result = isc_mutex_init(&view->dampening->workers[i].lock);
+      result = isc_mutex_init(&impl->lock);
       if( result != ISC_R_SUCCESS ) {
-	 dns_dampening_destroy( view );
-	 goto cleanup;
+	 impl->destroy(&impl->data);
+	 impl->destroy = NULL;
+	 dns_dampening_detach(&damp);
+	 return result;
+      }
+   }
+
+   *dampp = damp;
+   return ISC_R_SUCCESS;
+}
+
+isc_result_t dns_dampening_init(dns_view_t * view, int initial_size,
+				int max_entries, int shards,
+				unsigned int storage) {
+   INSIST( view != NULL );
+   INSIST( view->dampening == NULL );
+
+   return dns_dampening_create(view->mctx, initial_size, max_entries,
+			       shards, storage, &view->dampening);
+}
+
+/*
+ * Let the view use the shared table 'store'. The table parameters are
+ * copied, so the caller can check the view parameters against them.
+ */
+isc_result_t dns_dampening_initshared(dns_view_t * view,
+				      dns_dampening_t * store) {
+   dns_dampening_t * damp;
+
+   INSIST( view != NULL );
+   INSIST( view->dampening == NULL );
+   INSIST( store != NULL && store->store == NULL );
+
+   damp = isc_mem_get(view->mctx, sizeof(*damp));
+   if( damp == NULL )
+     return ISC_R_NOMEMORY;
+   memset( damp, 0, sizeof(*damp) );
+   isc_mem_attach(view->mctx, &damp->mctx);
+   isc_refcount_init(&damp->references, 1);
+   dns_dampening_attach(store, &damp->store);
+
+   damp->max_entries = store->max_entries;
+   damp->prefixlen = store->prefixlen;
+   memcpy(damp->aggregate, store->aggregate, sizeof(damp->aggregate));
+   damp->aggregate_count = store->aggregate_count;
+   damp->decay = store->decay;
+   damp->limit = store->limit;
+   damp->score = store->score;
+   damp->statistics = store->statistics;
+
+   view->dampening = damp;
+   return ISC_R_SUCCESS;
+}
+
+void dns_dampening_attach(dns_dampening_t * source,
+			  dns_dampening_t ** targetp) {
+   REQUIRE( source != NULL );
+   REQUIRE( targetp != NULL && *targetp == NULL );
+
+   isc_refcount_increment(&source->references, NULL);
+   *targetp = source;
+}
+
+void dns_dampening_detach(dns_dampening_t ** dampp) {
+   dns_dampening_t * damp;
+   isc_mem_t * mctx;
+   unsigned int refs;
+   int i, num_instances;
+   dns_dampening_implementation_t * impl;
+
+   REQUIRE( dampp != NULL && *dampp != NULL );
+
+   damp = *dampp;
+   *dampp = NULL;
+   isc_refcount_decrement(&damp->references, &refs);
+   if(refs > 0)
+     return;
+
+   mctx = damp->mctx;
+   if(damp->exempt != NULL)
+     dns_acl_detach(&damp->exempt);
+   if(damp->filter != NULL) {
+      filter_forget(damp->filter, damp);
+      dns_dampening_filter_detach(&damp->filter);
+   }
+   if(damp->store != NULL)
+     dns_dampening_detach(&damp->store);
+   if(damp->snapshot != NULL)
+     isc_mem_free(mctx, damp->snapshot);
+
+   /* Partially initialized tables have instances without destructor */
+   num_instances = damp->workers_count * damp->shards_count;
+   for( i = num_instances; i-- > 0; ) {
+      impl = damp->workers + i;
+      if(impl->destroy == NULL)
+	continue;
+      DESTROYLOCK(&impl->lock);
+      impl->destroy(&impl->data);
+   }
+   if(damp->workers != NULL)
+     isc_mem_put(mctx, damp->workers, num_instances * sizeof(*(damp->workers)));
+
+   isc_refcount_destroy(&damp->references);
+   isc_mem_put(mctx, damp, sizeof(*damp));
+   isc_mem_detach(&mctx);
+}
+
+void dns_dampening_destroy(dns_view_t * view) {
+   INSIST( view != NULL );
+   INSIST( view->dampening != NULL );
+
+   dns_dampening_detach(&view->dampening);
+   INSIST( view->dampening == NULL );
+}
+
+/*
+ * Count an entry in the penalty histogram of 'stats'.
+ */
+static void
+stats_entry(const dns_dampening_t * damp, dns_dampening_stats_t * stats,
+	    const dns_dampening_entry_t * entry) {
+   unsigned int bucket;
+
+   bucket = entry->penalty * DNS_DAMPENING_HISTOGRAM / (damp->limit.maximum + 1);
+   stats->histogram[ISC_MIN(bucket, DNS_DAMPENING_HISTOGRAM - 1)]++;
+   if(entry->dampening == 1)
+     stats->dampened++;
+}
+
+/*
+ * Sum up the counters and the table state of all instances. Each instance
+ * is locked in turn while its entries are counted.
+ */
+void dns_dampening_getstats(dns_dampening_t * damp,
+			    dns_dampening_stats_t * stats) {
+   dns_dampening_implementation_t * impl;
+   int i;
+
+   REQUIRE( damp != NULL );
+   REQUIRE( stats != NULL );
+
+   damp = DAMPENING_TABLE(damp);
+   memset(stats, 0, sizeof(*stats));
+   for(i = 0; i < damp->workers_count * damp->shards_count; i++) {
+      impl = damp->workers + i;
+      LOCK(&impl->lock);
+      stats->counters.lock    += impl->statistics.total.lock;
+      stats->counters.search  += impl->statistics.total.search;
+      stats->counters.update  += impl->statistics.total.update;
+      stats->counters.add     += impl->statistics.total.add;
+      stats->counters.allowed += impl->statistics.total.allowed;
+      stats->counters.denied  += impl->statistics.total.denied;
+      stats->counters.skipped += impl->statistics.total.skipped;
+      if(impl->getstats != NULL)
+	impl->getstats(impl->data, stats);
+      UNLOCK(&impl->lock);
+   }
+}
+
+/*
+ * Keep the 'n' entries with the highest penalties, sorted descending.
+ * The penalties are decayed to 'now' in the copies.
+ */
+typedef struct {
+   const dns_dampening_t * damp;
+   isc_stdtime_t now;
+   dns_dampening_entry_t * top;
+   unsigned int count, size;
+} top_arg_t;
+
+static void
+top_entry(void * arg, const dns_dampening_entry_t * entry) {
+   top_arg_t * t = arg;
+   unsigned int i, penalty;
+
+   penalty = entry->penalty;
+   if(t->now > entry->last_updated)
+     penalty = dns_dampening_decay(t->damp, penalty, t->now - entry->last_updated);
+   if(t->count == t->size && penalty <= t->top[t->count - 1].penalty)
+     return;
+
+   if(t->count < t->size)
+     t->count++;
+   for(i = t->count - 1; i > 0 && t->top[i - 1].penalty < penalty; i--)
+     t->top[i] = t->top[i - 1];
+   t->top[i] = *entry;
+   t->top[i].penalty = penalty;
+}
+
+/*
+ * Copy the top offenders into 'top'. Each instance is locked only while
+ * its own entries are scanned, so queries of other shards proceed.
+ */
+unsigned int dns_dampening_top(dns_dampening_t * damp, isc_stdtime_t now,
+			       dns_dampening_entry_t * top, unsigned int size) {
+   dns_dampening_implementation_t * impl;
+   top_arg_t arg;
+   int i;
+
+   REQUIRE( damp != NULL );
+   REQUIRE( top != NULL || size == 0 );
+
+   damp = DAMPENING_TABLE(damp);
+   arg.damp = damp;
+   arg.now = now;
+   arg.top = top;
+   arg.count = 0;
+   arg.size = size;
+   if(size == 0)
+     return 0;
+
+   /* All implementations track the same prefixes, the first one suffice */
+   for(i = 0; i < damp->shards_count; i++) {
+      impl = damp->workers + i;
+      if(impl->walk == NULL)
+	continue;
+      LOCK(&impl->lock);
+      impl->walk(impl->data, top_entry, &arg);
+      UNLOCK(&impl->lock);
+   }
+   return arg.count;
+}
+
+/*
+ * Insert a saved entry of aggregation level 'level', decayed from
+ * 'last_updated' to 'now'. The prefix is masked again, so a change of the
+ * prefix lengths merges entries. Entries below limit-irrelevant and of
+ * levels no longer configured are dropped.
+ */
+static void
+restore_entry(dns_dampening_t * damp, const isc_netaddr_t * netaddr,
+	      unsigned int level, unsigned int penalty,
+	      isc_boolean_t dampening, isc_stdtime_t last_updated,
+	      isc_stdtime_t now) {
+   dns_dampening_implementation_t * impl;
+   dns_dampening_entry_t * entry;
+   isc_netaddr_t prefix;
+   unsigned int enable, disable;
+   int shard;
+
+   if(now > last_updated)
+     penalty = dns_dampening_decay(damp, penalty, now - last_updated);
+   penalty = ISC_MIN(penalty, damp->limit.maximum);
+   if(penalty <= damp->limit.irrelevant)
+     return;
+
+   if(level > (unsigned int)damp->aggregate_count ||
+      !extract_level(&prefix, netaddr, damp, level))
+     return;
+   shard = shard_of(damp, &prefix);
+   level_limits(damp, level, &enable, &disable);
+
+   DAMPENING_FOREACH(damp, impl, shard) {
+      LOCK(&impl->lock);
+      entry = impl->search(impl->data, &prefix);
+      if(entry == NULL) {
+	 entry = impl->add(impl->data, &prefix, penalty, now);
+	 if(entry != NULL)
+	   entry->dampening =
+	     (penalty > enable || (dampening && penalty >= disable)) ? 1 : 0;
+      } else {
+	 if(dampening)
+	   entry->dampening = 1;
+	 impl->update(impl->data, &entry, penalty, now);
       }
+      UNLOCK(&impl->lock);
+   }
+}
+
+typedef struct {
+   dns_dampening_t * damp;
+   isc_stdtime_t now;
+} merge_arg_t;
+
+static void
+merge_entry(void * arg, const dns_dampening_entry_t * entry) {
+   merge_arg_t * m = arg;
+
+   restore_entry(m->damp, &entry->netaddr, level_of(&entry->netaddr),
+		 entry->penalty, entry->dampening ? ISC_TRUE : ISC_FALSE,
+		 entry->last_updated, m->now);
+}
+
+/*
+ * Take over the entries of the table 'from', which is replaced by 'damp'
+ * on reconfiguration.
+ */
+void dns_dampening_merge(dns_dampening_t * damp, dns_dampening_t * from,
+			 isc_stdtime_t now) {
+   dns_dampening_implementation_t * impl;
+   merge_arg_t arg;
+   int i;
+
+   REQUIRE( damp != NULL );
+   REQUIRE( from != NULL && from != damp );
+
+   /* Views of the same shared table need no copy */
+   damp = DAMPENING_TABLE(damp);
+   from = DAMPENING_TABLE(from);
+   if(damp == from)
+     return;
+
+   arg.damp = damp;
+   arg.now = now;
+   for(i = 0; i < from->shards_count; i++) {
+      impl = from->workers + i;
+      if(impl->walk == NULL)
+	continue;
+      LOCK(&impl->lock);
+      impl->walk(impl->data, merge_entry, &arg);
+      UNLOCK(&impl->lock);
+   }
+}
+
+/*
+ * Snapshot files
+ * ~~~~~~~~~~~~~~
+ *
+ * A header of 16 bytes is followed by fixed size records of 24 bytes,
+ * all numbers in network byte order:
+ *
+ *   header: "DAMP", version, time of the snapshot,
+ *           IPv4 prefix length, IPv6 prefix length, 2 bytes padding
+ *   record: family (4 or 6), flags, penalty, last update,
+ *           16 bytes address (IPv4 uses the first four)
+ *
+ * The lowest bit of the flags is the dampening flag, the upper seven bits
+ * are the prefix length of an entry of an aggregation level, or zero for
+ * the prefix length of the header.
+ *
+ * The fixed layout allows to map the file or to seek to a record.
+ */
+#define SNAPSHOT_MAGIC		0x44414d50	/* "DAMP" */
+#define SNAPSHOT_VERSION	1
+#define SNAPSHOT_HEADER		16
+#define SNAPSHOT_RECORD		24
+
+typedef struct {
+   const dns_dampening_t * damp;
+   FILE * fp;
+   isc_result_t result;
+   unsigned int count;
+} save_arg_t;
+
+static void
+save_entry(void * arg, const dns_dampening_entry_t * entry) {
+   save_arg_t * sv = arg;
+   unsigned char record[SNAPSHOT_RECORD];
+   isc_buffer_t b;
+
+   if(sv->result != ISC_R_SUCCESS)
+     return;
+
+   memset(record, 0, sizeof(record));
+   isc_buffer_init(&b, record, sizeof(record));
+   switch(entry->netaddr.family) {
+    case AF_INET:
+      isc_buffer_putuint8(&b, 4);
+      break;
+    case AF_INET6:
+      isc_buffer_putuint8(&b, 6);
+      break;
+    default:
+      return;
+   }
+   isc_buffer_putuint8(&b, entry->dampening |
+		       (level_of(&entry->netaddr) == 0 ? 0 :
+			dns_dampening_prefixlen(sv->damp, &entry->netaddr) << 1));
+   isc_buffer_putuint16(&b, entry->penalty);
+   isc_buffer_putuint32(&b, entry->last_updated);
+   isc_buffer_putmem(&b, (const unsigned char *)&entry->netaddr.type,
+		     entry->netaddr.family == AF_INET ? 4 : 16);
+
+   sv->result = isc_stdio_write(record, sizeof(record), 1, sv->fp, NULL);
+   sv->count++;
+}
+
+isc_result_t dns_dampening_save(dns_dampening_t * damp, const char * file,
+				isc_stdtime_t now) {
+   dns_dampening_implementation_t * impl;
+   unsigned char header[SNAPSHOT_HEADER];
+   char tempname[PATH_MAX];
+   isc_buffer_t b;
+   save_arg_t arg;
+   isc_result_t result;
+   int i;
+
+   REQUIRE( damp != NULL );
+   REQUIRE( file != NULL );
+
+   damp = DAMPENING_TABLE(damp);
+
+   result = isc_file_mktemplate(file, tempname, sizeof(tempname));
+   if(result != ISC_R_SUCCESS)
+     return result;
+   arg.fp = NULL;
+   result = isc_file_bopenuniqueprivate(tempname, &arg.fp);
+   if(result != ISC_R_SUCCESS)
+     return result;
+
+   memset(header, 0, sizeof(header));
+   isc_buffer_init(&b, header, sizeof(header));
+   isc_buffer_putuint32(&b, SNAPSHOT_MAGIC);
+   isc_buffer_putuint32(&b, SNAPSHOT_VERSION);
+   isc_buffer_putuint32(&b, now);
+   isc_buffer_putuint8(&b, damp->prefixlen.ipv4);
+   isc_buffer_putuint8(&b, damp->prefixlen.ipv6);
+   arg.damp = damp;
+   arg.result = isc_stdio_write(header, sizeof(header), 1, arg.fp, NULL);
+   arg.count = 0;
+
+   for(i = 0; i < damp->shards_count && arg.result == ISC_R_SUCCESS; i++) {
+      impl = damp->workers + i;
+      if(impl->walk == NULL)
+	continue;
+      LOCK(&impl->lock);
+      impl->walk(impl->data, save_entry, &arg);
+      UNLOCK(&impl->lock);
+   }
+
+   result = arg.result;
+   if(result == ISC_R_SUCCESS)
+     result = isc_stdio_flush(arg.fp);
+   if(result == ISC_R_SUCCESS)
+     result = isc_stdio_sync(arg.fp);
+   (void)isc_stdio_close(arg.fp);
+   if(result == ISC_R_SUCCESS)
+     result = isc_file_rename(tempname, file);
+   if(result != ISC_R_SUCCESS) {
+      (void)isc_file_remove(tempname);
+      return result;
+   }
+
+   isc_log_write(dns_lctx, DNS_LOGCATEGORY_DAMPENING,
+		 DNS_LOGMODULE_REQUEST, ISC_LOG_INFO,
+		 "Saved %u entries to '%s'", arg.count, file);
+   return ISC_R_SUCCESS;
+}
+
+isc_result_t dns_dampening_restore(dns_dampening_t * damp, const char * file,
+				   isc_stdtime_t now) {
+   unsigned char data[SNAPSHOT_RECORD];
+   unsigned int family, dampening, penalty, len, count = 0;
+   unsigned int saved_ipv4, saved_ipv6, saved, level, l, bits;
+   isc_stdtime_t last_updated;
+   isc_netaddr_t netaddr;
+   isc_buffer_t b;
+   isc_result_t result;
+   FILE * fp = NULL;
+
+   REQUIRE( damp != NULL );
+   REQUIRE( file != NULL );
+
+   damp = DAMPENING_TABLE(damp);
+
+   result = isc_stdio_open(file, "rb", &fp);
+   if(result != ISC_R_SUCCESS)
+     return result;
+
+   result = isc_stdio_read(data, SNAPSHOT_HEADER, 1, fp, NULL);
+   if(result != ISC_R_SUCCESS)
+     goto cleanup;
+   isc_buffer_init(&b, data, SNAPSHOT_HEADER);
+   isc_buffer_add(&b, SNAPSHOT_HEADER);
+   if(isc_buffer_getuint32(&b) != SNAPSHOT_MAGIC ||
+      isc_buffer_getuint32(&b) != SNAPSHOT_VERSION) {
+      result = ISC_R_BADNUMBER;
+      goto cleanup;
+   }
+   (void)isc_buffer_getuint32(&b);
+   saved_ipv4 = isc_buffer_getuint8(&b);
+   saved_ipv6 = isc_buffer_getuint8(&b);
+
+   while((result = isc_stdio_read(data, SNAPSHOT_RECORD, 1, fp, NULL)) == ISC_R_SUCCESS) {
+      isc_buffer_init(&b, data, SNAPSHOT_RECORD);
+      isc_buffer_add(&b, SNAPSHOT_RECORD);
+      family       = isc_buffer_getuint8(&b);
+      dampening    = isc_buffer_getuint8(&b);
+      penalty      = isc_buffer_getuint16(&b);
+      last_updated = isc_buffer_getuint32(&b);
+
+      memset(&netaddr, 0, sizeof(netaddr));
+      if(family == 4) {
+	 netaddr.family = AF_INET;
+	 saved = saved_ipv4;
+	 len = 4;
+      } else if(family == 6) {
+	 netaddr.family = AF_INET6;
+	 saved = saved_ipv6;
+	 len = 16;
+      } else
+	continue;
+      memcpy(&netaddr.type, isc_buffer_current(&b), len);
+
+      /* Use the finest level not finer than the saved prefix */
+      level = 0;
+      if((dampening >> 1) != 0) {
+	 saved = dampening >> 1;
+	 for(l = 1; l <= (unsigned int)damp->aggregate_count; l++) {
+	    bits = level_length(damp, l, netaddr.family);
+	    if(bits < level_length(damp, 0, netaddr.family) && bits <= saved &&
+	       (level == 0 || bits > level_length(damp, level, netaddr.family)))
+	      level = l;
+	 }
+	 if(level == 0)
+	   continue;
+      } else if(saved < level_length(damp, 0, netaddr.family))
+	continue;		/* coarser than configured */
+
+      restore_entry(damp, &netaddr, level, penalty,
+		    (dampening & 1) ? ISC_TRUE : ISC_FALSE, last_updated, now);
+      count++;
    }
-   view->dampening->workers_count = num_workers;
-   INSIST( view->dampening != NULL );
+   if(result == ISC_R_EOF)
+     result = ISC_R_SUCCESS;
 
-   result = ISC_R_SUCCESS;
+   isc_log_write(dns_lctx, DNS_LOGCATEGORY_DAMPENING,
+		 DNS_LOGMODULE_REQUEST, ISC_LOG_INFO,
+		 "Restored %u entries from '%s'", count, file);
 
 cleanup:
+   (void)isc_stdio_close(fp);
    return result;
 }
 
-void dns_dampening_destroy(dns_view_t * view) {
-   int i, num_workers = sizeof(implementations)/sizeof(*implementations);
+#ifdef HAVE_LIBXML2
+#define TRY0(a) do { xmlrc = (a); if (xmlrc < 0) goto error; } while(0)
+static int
+renderstat(const char *name, isc_uint64_t value, xmlTextWriterPtr writer) {
+   int xmlrc;
 
-   INSIST( view != NULL );
-   INSIST( view->dampening != NULL );
-   
-   if(view->dampening->exempt != NULL)
-     dns_acl_detach(&view->dampening->exempt);
+   TRY0(xmlTextWriterStartElement(writer, ISC_XMLCHAR "counter"));
+   TRY0(xmlTextWriterWriteAttribute(writer,
+				    ISC_XMLCHAR "name", ISC_XMLCHAR name));
+   TRY0(xmlTextWriterWriteFormatString(writer,
+				       "%" ISC_PRINT_QUADFORMAT "u",
+				       value));
+   TRY0(xmlTextWriterEndElement(writer)); /* counter */
 
-   for( i = view->dampening->workers_count; i-- > 0; ) {
-      DESTROYLOCK(&view->dampening->workers[i].lock);
-      view->dampening->workers[i].destroy(&(view->dampening->workers[i].data));
+error:
+   return (xmlrc);
+}
+
+int
+dns_dampening_renderxml(dns_dampening_t * damp, xmlTextWriterPtr writer) {
+   dns_dampening_stats_t stats;
+   char name[32];
+   int xmlrc, i, width;
+
+   REQUIRE( damp != NULL );
+
+   dns_dampening_getstats(damp, &stats);
+   TRY0(renderstat("Allowed", stats.counters.allowed, writer));
+   TRY0(renderstat("Denied", stats.counters.denied, writer));
+   TRY0(renderstat("Skipped", stats.counters.skipped, writer));
+   TRY0(renderstat("Entries", stats.entries, writer));
+   TRY0(renderstat("Capacity", stats.capacity, writer));
+   TRY0(renderstat("Evictions", stats.evictions, writer));
+   TRY0(renderstat("Dampened", stats.dampened, writer));
+   TRY0(renderstat("LockWaitNs", stats.counters.lock, writer));
+   TRY0(renderstat("SearchNs", stats.counters.search, writer));
+   TRY0(renderstat("UpdateNs", stats.counters.update, writer));
+   TRY0(renderstat("AddNs", stats.counters.add, writer));
+
+   width = (damp->limit.maximum + 1) / DNS_DAMPENING_HISTOGRAM;
+   for(i = 0; i < DNS_DAMPENING_HISTOGRAM; i++) {
+      snprintf(name, sizeof(name), "Penalty%d", i * width);
+      TRY0(renderstat(name, stats.histogram[i], writer));
    }
-   view->dampening->workers_count = 0;
-   
-   isc_mem_put(view->mctx, view->dampening->workers, num_workers * sizeof(*(view->dampening->workers)));
-   view->dampening->workers = NULL;
-   
-   isc_mem_put(view->mctx, view->dampening, sizeof(*(view->dampening)));
-   view->dampening = NULL;
-	       
-   INSIST( view->dampening == NULL );
+error:
+   return (xmlrc);
 }
+#endif
+
+#ifdef HAVE_JSON
+#define CHECKMEM(m) do { \
+	if (m == NULL) { \
+		result = ISC_R_NOMEMORY;\
+		goto error;\
+	} \
+} while(0)
+
+#define RENDERJSON(name, value) do { \
+	obj = json_object_new_int64(value); \
+	CHECKMEM(obj); \
+	json_object_object_add(dstats, name, obj); \
+} while(0)
+
+isc_result_t
+dns_dampening_renderjson(dns_dampening_t * damp, json_object * dstats) {
+   isc_result_t result = ISC_R_SUCCESS;
+   dns_dampening_stats_t stats;
+   json_object *obj, *histogram;
+   char name[32];
+   int i, width;
+
+   REQUIRE( damp != NULL );
+
+   dns_dampening_getstats(damp, &stats);
+   RENDERJSON("Allowed", stats.counters.allowed);
+   RENDERJSON("Denied", stats.counters.denied);
+   RENDERJSON("Skipped", stats.counters.skipped);
+   RENDERJSON("Entries", stats.entries);
+   RENDERJSON("Capacity", stats.capacity);
+   RENDERJSON("Evictions", stats.evictions);
+   RENDERJSON("Dampened", stats.dampened);
+   RENDERJSON("LockWaitNs", stats.counters.lock);
+   RENDERJSON("SearchNs", stats.counters.search);
+   RENDERJSON("UpdateNs", stats.counters.update);
+   RENDERJSON("AddNs", stats.counters.add);
+
+   histogram = json_object_new_object();
+   CHECKMEM(histogram);
+   width = (damp->limit.maximum + 1) / DNS_DAMPENING_HISTOGRAM;
+   for(i = 0; i < DNS_DAMPENING_HISTOGRAM; i++) {
+      snprintf(name, sizeof(name), "%d", i * width);
+      obj = json_object_new_int64(stats.histogram[i]);
+      if(obj == NULL) {
+	 json_object_put(histogram);
+	 result = ISC_R_NOMEMORY;
+	 goto error;
+      }
+      json_object_object_add(histogram, name, obj);
+   }
+   json_object_object_add(dstats, "Penalty", histogram);
+
+error:
+   return (result);
+}
+#endif
 
 /********************************************************
  * Quere
@@ -442,46 +1784,189 @@ void dns_dampening_destroy(dns_view_t * view) {
  * 
  */
 
+/*
+ * Growing the storage
+ * ~~~~~~~+~~~~~~~~~~~
+ *
+ * Entries are addressed by 32 bit indexes into a list of fixed size blocks.
+ * The table starts with enough blocks for the configured initial size. If
+ * no free entry is left, a new block is linked into the free space until the
+ * configured maximum of used entries is reached. Only then the least recently
+ * used entry is recycled. Existing entries never move, so a grow costs a single block.
+ *
+ * The hash is a power of two and doubles whenever it holds more entries
+ * than buckets. The old hash stays alive and each operation migrates a few
+ * of its buckets. Bucket i of the old hash splits into buckets i and
+ * i+old_length of the new one, so those are initialized by the migration
+ * itself and there is never a need to touch the whole table at once.
+ */
+
+#define QUEUE_BLOCK_BITS	10
+#define QUEUE_BLOCK_SIZE	(1U << QUEUE_BLOCK_BITS)
+#define QUEUE_BLOCK_MASK	(QUEUE_BLOCK_SIZE - 1)
+#define QUEUE_REHASH_STEP	2
+
 typedef struct {
    dns_dampening_entry_t entry;
-   uint16_t list_next, queue_next, queue_prev;
+   isc_uint32_t self, list_next, queue_next, queue_prev;
 } queue_entry_t;
 
 typedef struct {
-   queue_entry_t * field;
-   uint16_t * hash;
-   uint16_t length;
+   queue_entry_t ** blocks;
+   isc_uint32_t blocks_count, blocks_max;
+   isc_uint32_t * hash;
+   isc_uint32_t hash_length;
+   isc_uint32_t * old_hash;
+   isc_uint32_t old_length, migrated;
+   isc_uint32_t used, maximum;
+   isc_uint64_t evictions;
    isc_mem_t * mctx;
    dns_dampening_t * conf;
 } queue_t;
 
-#define QUEUE_AVAIL(d)	((d)->field[0].list_next)
-#define QUEUE_FRONT(d)	((d)->field[0].queue_next)
-#define QUEUE_REAR(d)	((d)->field[0].queue_prev)
+#define QUEUE_FIELD(d,i)	((d)->blocks[(i) >> QUEUE_BLOCK_BITS][(i) & QUEUE_BLOCK_MASK])
+#define QUEUE_LENGTH(d)		((d)->blocks_count << QUEUE_BLOCK_BITS)
+#define QUEUE_AVAIL(d)	(QUEUE_FIELD(d,0).list_next)
+#define QUEUE_FRONT(d)	(QUEUE_FIELD(d,0).queue_next)
+#define QUEUE_REAR(d)	(QUEUE_FIELD(d,0).queue_prev)
 
 /*
- * Hashing using a variant of the Adler32 algorithm. I had touble
- * with generic hash functions, the full content of netaddr varies
- * between queries for the same IP.
+ * Hashing the address bytes only, because the full content of netaddr
+ * varies between queries for the same IP. The former Adler32 variant
+ * collides for most addresses from the same netblock, which is fatal for
+ * large tables, so MurmurHash3 is used. The shard selection has to use
+ * another hash function.
  */
-static uint16_t
-queue_makehash(const queue_t * d, const isc_netaddr_t * netaddr) {
-   uint16_t a = 0, b = 0;
+static isc_uint32_t
+queue_makehash(const isc_netaddr_t * netaddr) {
    const unsigned char * buff = (const unsigned char*)&netaddr->type;
-   unsigned int i;
+   isc_uint32_t h = 0, k;
+   unsigned int i, len;
 
-   INSIST(d != NULL);
    RUNTIME_CHECK(netaddr != NULL);
    
-   for(i= netaddr->family == AF_INET  ? sizeof(netaddr->type.in ) :
-          netaddr->family == AF_INET6 ? sizeof(netaddr->type.in6) :
-                                        sizeof(netaddr->type    ) ;
-       i-->0; ) {
-      a = a + buff[i];
-      b = b + a;
+   len = netaddr->family == AF_INET  ? sizeof(netaddr->type.in ) :
+         netaddr->family == AF_INET6 ? sizeof(netaddr->type.in6) :
+                                       sizeof(netaddr->type    ) ;
+   for(i = 0; i + 4 <= len; i += 4) {
+      memcpy(&k, buff + i, sizeof(k));
+      k *= 0xcc9e2d51U;
+      k = (k << 15) | (k >> 17);
+      k *= 0x1b873593U;
+      h ^= k;
+      h = (h << 13) | (h >> 19);
+      h = h * 5 + 0xe6546b64U;
+   }
+   
+   h ^= len ^ netaddr->zone;
+   h ^= h >> 16;
+   h *= 0x85ebca6bU;
+   h ^= h >> 13;
+   h *= 0xc2b2ae35U;
+   h ^= h >> 16;
+   return h;
+}
+
+/*
+ * Return the head of the hash list for the hash value h. As long as the
+ * bucket was not migrated, it lives in the old hash.
+ */
+static isc_uint32_t *
+queue_bucket(const queue_t * d, isc_uint32_t h) {
+   if(d->old_hash != NULL && (h & (d->old_length - 1)) >= d->migrated)
+     return &d->old_hash[h & (d->old_length - 1)];
+   return &d->hash[h & (d->hash_length - 1)];
+}
+
+/*
+ * Move some buckets from the old hash into the current one.
+ */
+static void
+queue_rehash(queue_t * d) {
+   int step;
+
+   for(step = 0; step < QUEUE_REHASH_STEP && d->old_hash != NULL; step++) {
+      isc_uint32_t i, next, *lo, *hi;
+      
+      lo = &d->hash[d->migrated];
+      hi = &d->hash[d->migrated + d->old_length];
+      *lo = *hi = 0;
+      for(i = d->old_hash[d->migrated]; i > 0; i = next) {
+	 next = QUEUE_FIELD(d,i).list_next;
+	 if(queue_makehash(&QUEUE_FIELD(d,i).entry.netaddr) & d->old_length) {
+	    QUEUE_FIELD(d,i).list_next = *hi;
+	    *hi = i;
+	 } else {
+	    QUEUE_FIELD(d,i).list_next = *lo;
+	    *lo = i;
+	 }
+      }
+      
+      if(++d->migrated == d->old_length) {
+	 isc_mem_put(d->mctx, d->old_hash, d->old_length * sizeof(*(d->old_hash)));
+	 d->old_hash = NULL;
+	 d->old_length = d->migrated = 0;
+      }
+   }
+}
+
+/*
+ * Double the hash if it is overloaded. The content of the new hash is set up
+ * by queue_rehash(). If no memory is available, the longer hash lists are
+ * acceptable.
+ */
+static void
+queue_growhash(queue_t * d) {
+   isc_uint32_t * hash;
+   
+   if(d->old_hash != NULL || d->used <= d->hash_length ||
+      d->hash_length > d->maximum)
+     return;
+   
+   hash = isc_mem_get(d->mctx, 2 * d->hash_length * sizeof(*hash));
+   if(hash == NULL)
+     return;
+   
+   d->old_hash = d->hash;
+   d->old_length = d->hash_length;
+   d->migrated = 0;
+   d->hash = hash;
+   d->hash_length *= 2;
+}
+
+/*
+ * Link a new block of entries into the free space. Returns zero if the
+ * maximum size is reached or no memory is available.
+ */
+static int
+queue_growfield(queue_t * d) {
+   queue_entry_t * block;
+   isc_uint32_t i, base;
+   
+   if(d->blocks_count >= d->blocks_max)
+     return 0;
+   
+   block = isc_mem_get(d->mctx, QUEUE_BLOCK_SIZE * sizeof(*block));
+   if(block == NULL)
+     return 0;
+   
+   base = QUEUE_LENGTH(d);
+   d->blocks[d->blocks_count++] = block;
+   for(i = 0; i < QUEUE_BLOCK_SIZE; i++) {
+      block[i].self = base + i;
+      block[i].list_next = base + i + 1;
+   }
+   
+   if(base == 0) {
+      /* The sentiel is the first entry of the first block */
+      block[QUEUE_BLOCK_SIZE - 1].list_next = 0;
+      block[0].queue_next = block[0].queue_prev = 0;
+   } else {
+      block[QUEUE_BLOCK_SIZE - 1].list_next = QUEUE_AVAIL(d);
+      QUEUE_AVAIL(d) = base;
    }
    
-   return ((b << 8) + a) % d->length;
+   return 1;
 }
 
 /*
@@ -491,22 +1976,23 @@ queue_makehash(const queue_t * d, const isc_netaddr_t * netaddr) {
 static dns_dampening_entry_t *
 queue_search(void * data, const isc_netaddr_t * netaddr) {
    queue_t * d = data;
-   uint16_t h = queue_makehash(data, netaddr), i, j=0;
+   isc_uint32_t *head, i, j=0;
 
    INSIST(data != NULL);
-   INSIST(h < d->length);
+   queue_rehash(d);
+   head = queue_bucket(d, queue_makehash(netaddr));
    
-   for(i = d->hash[h]; i > 0; i = d->field[j=i].list_next) {
-      INSIST(0 < i && i < d->length);
+   for(i = *head; i > 0; j = i, i = QUEUE_FIELD(d,i).list_next) {
+      INSIST(0 < i && i < QUEUE_LENGTH(d));
       
-      if(ISC_TRUE == isc_netaddr_equal(netaddr, &d->field[i].entry.netaddr)) {
+      if(ISC_TRUE == isc_netaddr_equal(netaddr, &QUEUE_FIELD(d,i).entry.netaddr)) {
 	 if(j>0) {
 	    /* Move to front */
-	    d->field[j].list_next = d->field[i].list_next;
-	    d->field[i].list_next = d->hash[h];
-	    d->hash[h] = i;
+	    QUEUE_FIELD(d,j).list_next = QUEUE_FIELD(d,i).list_next;
+	    QUEUE_FIELD(d,i).list_next = *head;
+	    *head = i;
 	 }
-	 return &(d->field[i].entry);
+	 return &(QUEUE_FIELD(d,i).entry);
       }
    }
    return NULL;
@@ -516,31 +2002,32 @@ queue_search(void * data, const isc_netaddr_t * netaddr) {
  * Delete an entry from the quere and the hash.
  */
 static void
-queue_delete(queue_t * d, uint16_t entry) {
-   uint16_t h, i, j=0;
+queue_delete(queue_t * d, isc_uint32_t entry) {
+   isc_uint32_t *head, i, j=0;
 
    INSIST(d != NULL);
-   RUNTIME_CHECK(0 < entry && entry < d->length);
-   h = queue_makehash(d, &d->field[entry].entry.netaddr);
-   INSIST(h < d->length);
+   RUNTIME_CHECK(0 < entry && entry < QUEUE_LENGTH(d));
+   head = queue_bucket(d, queue_makehash(&QUEUE_FIELD(d,entry).entry.netaddr));
    
-   for(i = d->hash[h]; i != entry; i = d->field[j=i].list_next) {
-      INSIST(0 < i && i < d->length);
+   for(i = *head; i != entry; j = i, i = QUEUE_FIELD(d,i).list_next) {
+      INSIST(0 < i && i < QUEUE_LENGTH(d));
    }
    
    /* Remove from hash */
    if(j>0)
-     d->field[j].list_next = d->field[i].list_next;
+     QUEUE_FIELD(d,j).list_next = QUEUE_FIELD(d,i).list_next;
    else
-     d->hash[h] = d->field[i].list_next;
+     *head = QUEUE_FIELD(d,i).list_next;
    
    /* Remove from queue */
-   d->field[d->field[i].queue_next].queue_prev = d->field[i].queue_prev;
-   d->field[d->field[i].queue_prev].queue_next = d->field[i].queue_next;
+   QUEUE_FIELD(d,QUEUE_FIELD(d,i).queue_next).queue_prev = QUEUE_FIELD(d,i).queue_prev;
+   QUEUE_FIELD(d,QUEUE_FIELD(d,i).queue_prev).queue_next = QUEUE_FIELD(d,i).queue_next;
 
-   /* Back to free space */
-   d->field[i].list_next = QUEUE_AVAIL(d);
+   /* Invalidate references and back to free space */
+   QUEUE_FIELD(d,i).entry.generation++;
+   QUEUE_FIELD(d,i).list_next = QUEUE_AVAIL(d);
    QUEUE_AVAIL(d) = i;
+   d->used--;
 }
 
 /*
@@ -551,74 +2038,116 @@ queue_delete(queue_t * d, uint16_t entry) {
 static void
 queue_update(void * data, dns_dampening_entry_t ** entry, uint16_t points, isc_stdtime_t now) {
    queue_t * d = data;
-   uint16_t e;
+   isc_uint32_t e;
    
    INSIST(data != NULL);
    INSIST(entry != NULL);
-   e = (queue_entry_t*)*entry - d->field;
-   RUNTIME_CHECK(0 < e && e < d->length);
+   e = ((queue_entry_t*)*entry)->self;
+   RUNTIME_CHECK(0 < e && e < QUEUE_LENGTH(d));
    
    if(update_penalty(d->conf, *entry, points, now) == 0)
      queue_delete(d, e);
    else if(QUEUE_FRONT(d) != e) {
+      /* Unlink from queue */
+      QUEUE_FIELD(d,QUEUE_FIELD(d,e).queue_next).queue_prev = QUEUE_FIELD(d,e).queue_prev;
+      QUEUE_FIELD(d,QUEUE_FIELD(d,e).queue_prev).queue_next = QUEUE_FIELD(d,e).queue_next;
       /* Move to front */
-      d->field[e].queue_prev = d->field[QUEUE_FRONT(d)].queue_prev;
-      d->field[QUEUE_FRONT(d)].queue_prev = e;
-      d->field[e].queue_next = QUEUE_FRONT(d);
+      QUEUE_FIELD(d,e).queue_prev = 0;
+      QUEUE_FIELD(d,e).queue_next = QUEUE_FRONT(d);
+      QUEUE_FIELD(d,QUEUE_FRONT(d)).queue_prev = e;
       QUEUE_FRONT(d) = e;
    }
 }
 
 /*
  * Add a new element by inserting it into the front of the hash list
- * and the decay queue. Recalculate the oldest element to get free space
- * if necessary.
+ * and the decay queue. Grow the storage or recalculate the oldest
+ * element to get free space if necessary. Return the new entry or
+ * NULL, if the oldest element is more important than the new one.
  */
-static void
+static dns_dampening_entry_t *
 queue_add(void * data, const isc_netaddr_t * netaddr,
 	  uint16_t points, isc_stdtime_t now) {
    queue_t * d = data;
-   uint16_t n, h = queue_makehash(data,netaddr);
+   isc_uint32_t n, *head, generation;
 
    INSIST(data != NULL);
-   INSIST(h < d->length);
    
-   if(QUEUE_AVAIL(d) == 0) {   /* full */
+   if(d->used >= d->maximum ||
+      (QUEUE_AVAIL(d) == 0 && queue_growfield(d) == 0)) {   /* full */
       dns_dampening_entry_t * e;
       
       /* Check against least used element */
       INSIST(QUEUE_REAR(d) != 0);
-      e = &(d->field[QUEUE_REAR(d)].entry);
+      e = &(QUEUE_FIELD(d,QUEUE_REAR(d)).entry);
       update_penalty(d->conf, e, 0, now);
 
       if(e->penalty > points) {
 	 queue_update(d, &e, 0, now);
-	 return;
-      } else 
-	queue_delete(d, QUEUE_REAR(d));
+	 return NULL;
+      } else {
+	 queue_delete(d, QUEUE_REAR(d));
+	 d->evictions++;
+      }
    }
    
    INSIST(QUEUE_AVAIL(d) != 0);
    
    /* Allocate n */
    n = QUEUE_AVAIL(d);
-   QUEUE_AVAIL(d) = d->field[n].list_next;
+   QUEUE_AVAIL(d) = QUEUE_FIELD(d,n).list_next;
+   d->used++;
    
    /* Link to hash */
-   d->field[n].list_next = d->hash[h];
-   d->hash[h] = n;
+   queue_growhash(d);
+   queue_rehash(d);
+   head = queue_bucket(d, queue_makehash(netaddr));
+   QUEUE_FIELD(d,n).list_next = *head;
+   *head = n;
    
    /* Place in front */
-   d->field[n].queue_prev = d->field[QUEUE_FRONT(d)].queue_prev;
-   d->field[QUEUE_FRONT(d)].queue_prev = n;
-   d->field[n].queue_next = QUEUE_FRONT(d);
+   QUEUE_FIELD(d,n).queue_prev = 0;
+   QUEUE_FIELD(d,n).queue_next = QUEUE_FRONT(d);
+   QUEUE_FIELD(d,QUEUE_FRONT(d)).queue_prev = n;
    QUEUE_FRONT(d) = n;
    
    /* Setup */
-   memset(&d->field[n].entry, 0, sizeof(d->field[n].entry));
-   memcpy(&d->field[n].entry.netaddr, netaddr, sizeof(d->field[n].entry.netaddr));
-   d->field[n].entry.penalty       = points;
-   d->field[n].entry.last_updated  = now;
+   generation = QUEUE_FIELD(d,n).entry.generation;
+   memset(&QUEUE_FIELD(d,n).entry, 0, sizeof(QUEUE_FIELD(d,n).entry));
+   memcpy(&QUEUE_FIELD(d,n).entry.netaddr, netaddr, sizeof(QUEUE_FIELD(d,n).entry.netaddr));
+   QUEUE_FIELD(d,n).entry.generation    = generation;
+   QUEUE_FIELD(d,n).entry.penalty       = points;
+   QUEUE_FIELD(d,n).entry.last_updated  = now;
+   return &(QUEUE_FIELD(d,n).entry);
+}
+
+/*
+ * Count the entries along the decay queue.
+ */
+static void
+queue_getstats(void * data, dns_dampening_stats_t * stats) {
+   queue_t * d = data;
+   isc_uint32_t i;
+
+   INSIST(data != NULL);
+   stats->entries   += d->used;
+   stats->capacity  += d->maximum;
+   stats->evictions += d->evictions;
+   for(i = QUEUE_FRONT(d); i > 0; i = QUEUE_FIELD(d,i).queue_next)
+     stats_entry(d->conf, stats, &QUEUE_FIELD(d,i).entry);
+}
+
+/*
+ * Visit the entries from the most recently to the least recently updated.
+ */
+static void
+queue_walk(void * data, dns_dampening_walk_t walker, void * arg) {
+   queue_t * d = data;
+   isc_uint32_t i;
+
+   INSIST(data != NULL);
+   for(i = QUEUE_FRONT(d); i > 0; i = QUEUE_FIELD(d,i).queue_next)
+     walker(arg, &QUEUE_FIELD(d,i).entry);
 }
 
 /*
@@ -631,11 +2160,18 @@ queue_destroy(void ** pdata) {
    if(*pdata != NULL) {
       queue_t * d = *pdata;
 
+      if(d->old_hash != NULL)
+	isc_mem_put(d->mctx, d->old_hash, d->old_length * sizeof(*(d->old_hash)));
+      
       if(d->hash != NULL)
-	isc_mem_put(d->mctx, d->hash, d->length * sizeof(*(d->hash)));
+	isc_mem_put(d->mctx, d->hash, d->hash_length * sizeof(*(d->hash)));
       
-      if(d->field != NULL)
-	isc_mem_put(d->mctx, d->field, d->length * sizeof(*(d->field)));
+      if(d->blocks != NULL) {
+	 while(d->blocks_count-- > 0)
+	   isc_mem_put(d->mctx, d->blocks[d->blocks_count],
+		       QUEUE_BLOCK_SIZE * sizeof(**(d->blocks)));
+	 isc_mem_put(d->mctx, d->blocks, d->blocks_max * sizeof(*(d->blocks)));
+      }
       
       isc_mem_put(d->mctx, d, sizeof(*d));
       *pdata = NULL;
@@ -648,13 +2184,14 @@ queue_destroy(void ** pdata) {
  * Allocate the memory for this data structure.
  */
 isc_result_t queue_init(isc_mem_t * mctx, dns_dampening_implementation_t * impl,
-			dns_dampening_t * conf, uint16_t size) {
+			dns_dampening_t * conf, isc_uint32_t size,
+			isc_uint32_t maximum) {
    queue_t * d;
-   int i;
    
    INSIST(mctx != NULL);
    INSIST(impl != NULL);
    INSIST(size > 0);
+   INSIST(size <= maximum);
 
    impl->destroy = queue_destroy;
    
@@ -662,39 +2199,465 @@ isc_result_t queue_init(isc_mem_t * mctx, dns_dampening_implementation_t * impl,
    if(d == NULL)
           return ISC_R_NOMEMORY;
    memset(d, 0, sizeof(*d));
-   
-   d->length = size+1;
-   d->field = isc_mem_get(mctx, d->length * sizeof(*(d->field)));
-   d->hash  = isc_mem_get(mctx, d->length * sizeof(*(d->hash)));
    d->mctx = mctx;
    d->conf = conf;
-   if(d->field == NULL || d->hash == NULL) {
+   
+   /* One more for the sentiel */
+   d->maximum = maximum;
+   d->blocks_max = (maximum + 1 + QUEUE_BLOCK_MASK) >> QUEUE_BLOCK_BITS;
+   d->blocks = isc_mem_get(mctx, d->blocks_max * sizeof(*(d->blocks)));
+   if(d->blocks == NULL) {
       impl->destroy(&impl->data);
       return ISC_R_NOMEMORY;
    }
    
-   /* Initialize free space */
-   for(i=0; i < d->length - 1; i++) {
-      d->field[i].list_next = i+1;
-      d->hash[i] = 0;
+   for(d->hash_length = 1; d->hash_length <= size; d->hash_length *= 2)
+     ;
+   d->hash = isc_mem_get(mctx, d->hash_length * sizeof(*(d->hash)));
+   if(d->hash == NULL) {
+      impl->destroy(&impl->data);
+      return ISC_R_NOMEMORY;
    }
-   /* last element */
-   d->field[i].list_next = 0;
-   d->hash[i] = 0;
-
-   /* Sentiel values */
-   QUEUE_FRONT(d) = QUEUE_REAR(d) = 0;
-   QUEUE_AVAIL(d) = 1;
+   memset(d->hash, 0, d->hash_length * sizeof(*(d->hash)));
    
+   /* Initialize free space, the sentiel is set up by the first block */
+   while(QUEUE_LENGTH(d) < size + 1)
+     if(queue_growfield(d) == 0) {
+	impl->destroy(&impl->data);
+	return ISC_R_NOMEMORY;
+     }
    
    impl->search  = queue_search;
    impl->add     = queue_add;
    impl->update  = queue_update;
+   impl->getstats = queue_getstats;
+   impl->walk    = queue_walk;
    
    isc_log_write(dns_lctx, DNS_LOGCATEGORY_DAMPENING,
 		 DNS_LOGMODULE_REQUEST, ISC_LOG_INFO,
-		 "Queue initialized to %d entries and %d hash: %u bytes",
-		 size, size+1,
-		 (sizeof(*d->hash)+sizeof(*d->field))*(1+size));
+		 "Queue initialized to %u entries (max %u) and %u hash: %lu bytes",
+		 size, maximum, d->hash_length,
+		 (unsigned long)(sizeof(*d->hash) * d->hash_length +
+				 sizeof(**d->blocks) * QUEUE_LENGTH(d)));
+   return ISC_R_SUCCESS;
+}
+
+/********************************************************
+ * Sketch
+ ********************************************************/
+
+/*
+ * Time decayed count-min sketch
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * The penalties of all prefixes are added into SKETCH_DEPTH rows of
+ * counters, each row indexed by another hash of the prefix. The penalty
+ * of a prefix is estimated by the minimum of its counters. Collisions can
+ * only overestimate it. Counters are raised to the new estimate only
+ * (conservative update), which keeps the overestimation small. Each
+ * counter decays on access like a table entry.
+ *
+ * The memory is allocated once from max-table-size and does not depend
+ * on the number of different sources, there are no entries to allocate
+ * or link. A spoofed flood only raises the counters slightly.
+ *
+ * Prefixes with an estimate above limit-enable-dampening are promoted to
+ * a small exact table of heavy hitters, which tracks the dampening state.
+ * They are demoted into the sketch again, when the dampening ends or a
+ * heavier prefix needs the space.
+ *
+ * The search returns a scratch entry holding the estimate for prefixes
+ * outside the heavy hitter table. Its generation is incremented whenever
+ * it is refilled, so references from other queries become stale. The
+ * scratch entry does not keep message ids, so duplicate queries are only
+ * scored for heavy hitters.
+ */
+
+#define SKETCH_DEPTH		4
+#define SKETCH_HEAVY_RATIO	16	/* heavy hitters per counters of a row */
+#define SKETCH_HEAVY_MIN	16
+#define SKETCH_VICTIMS		8	/* candidates checked for eviction */
+
+typedef struct {
+   isc_uint16_t penalty;
+   isc_stdtime_t last_updated;
+} sketch_cell_t;
+
+typedef struct {
+   dns_dampening_entry_t entry;
+   isc_uint32_t self, next;		/* self is 0 if unused */
+} sketch_heavy_t;
+
+typedef struct {
+   sketch_cell_t * cells;
+   isc_uint32_t width;			/* power of two */
+   sketch_heavy_t * heavy;		/* #0 is the head of the free list */
+   isc_uint32_t heavy_length, used, cursor;
+   isc_uint32_t * hash;
+   isc_uint32_t hash_length;		/* power of two */
+   dns_dampening_entry_t scratch;
+   isc_uint64_t evictions;
+   isc_mem_t * mctx;
+   dns_dampening_t * conf;
+} sketch_t;
+
+#define SKETCH_CELL(d,row,i)	((d)->cells[(row) * (d)->width + (i)])
+#define SKETCH_AVAIL(d)		((d)->heavy[0].next)
+#define SKETCH_IS_HEAVY(d,e)	((e) != &(d)->scratch)
+
+/*
+ * Double hashing provides the counter indexes of all rows.
+ */
+static void
+sketch_indexes(const sketch_t * d, const isc_netaddr_t * netaddr,
+	       isc_uint32_t * index) {
+   isc_uint32_t h1 = queue_makehash(netaddr);
+   isc_uint32_t h2 = shard_hash(netaddr) | 1;
+   int row;
+
+   for(row = 0; row < SKETCH_DEPTH; row++)
+     index[row] = (h1 + row * h2) & (d->width - 1);
+}
+
+static unsigned int
+sketch_cell(const sketch_t * d, sketch_cell_t * cell, isc_stdtime_t now) {
+   int timediff = now - cell->last_updated;
+
+   if(timediff > d->conf->decay.updatedelay) {
+      cell->penalty = dns_dampening_decay(d->conf, cell->penalty, timediff);
+      cell->last_updated = now;
+   }
+   return cell->penalty;
+}
+
+/*
+ * Raise the counters of the prefix to at least 'penalty'.
+ */
+static void
+sketch_raise(sketch_t * d, const isc_uint32_t * index, unsigned int penalty,
+	     isc_stdtime_t now) {
+   int row;
+
+   for(row = 0; row < SKETCH_DEPTH; row++) {
+      sketch_cell_t * cell = &SKETCH_CELL(d, row, index[row]);
+
+      if(sketch_cell(d, cell, now) < penalty) {
+	 cell->penalty = penalty;
+	 cell->last_updated = now;
+      }
+   }
+}
+
+static isc_uint32_t *
+sketch_bucket(const sketch_t * d, const isc_netaddr_t * netaddr) {
+   return &d->hash[queue_makehash(netaddr) & (d->hash_length - 1)];
+}
+
+static dns_dampening_entry_t *
+sketch_heavy(const sketch_t * d, const isc_netaddr_t * netaddr) {
+   isc_uint32_t i;
+
+   for(i = *sketch_bucket(d, netaddr); i > 0; i = d->heavy[i].next)
+     if(ISC_TRUE == isc_netaddr_equal(netaddr, &d->heavy[i].entry.netaddr))
+       return &d->heavy[i].entry;
+   return NULL;
+}
+
+static void
+sketch_delete(sketch_t * d, isc_uint32_t n) {
+   isc_uint32_t * link;
+
+   for(link = sketch_bucket(d, &d->heavy[n].entry.netaddr);
+       *link != n;
+       link = &d->heavy[*link].next)
+     INSIST(*link != 0);
+   *link = d->heavy[n].next;
+
+   d->heavy[n].entry.generation++;
+   d->heavy[n].self = 0;
+   d->heavy[n].next = SKETCH_AVAIL(d);
+   SKETCH_AVAIL(d) = n;
+   d->used--;
+}
+
+/*
+ * Move a heavy hitter back into the sketch.
+ */
+static void
+sketch_demote(sketch_t * d, isc_uint32_t n, isc_stdtime_t now) {
+   isc_uint32_t index[SKETCH_DEPTH];
+
+   sketch_indexes(d, &d->heavy[n].entry.netaddr, index);
+   sketch_raise(d, index, d->heavy[n].entry.penalty, now);
+   sketch_delete(d, n);
+}
+
+/*
+ * Make room for a new heavy hitter by demoting the lowest penalty of
+ * a few candidates, preferring those which are not dampened.
+ */
+static void
+sketch_evict(sketch_t * d, isc_stdtime_t now) {
+   isc_uint32_t i, n, victim = 0;
+
+   for(n = 0; n < SKETCH_VICTIMS; n++) {
+      d->cursor = d->cursor % (d->heavy_length - 1) + 1;
+      i = d->cursor;
+      if(victim == 0 ||
+	 d->heavy[i].entry.dampening < d->heavy[victim].entry.dampening ||
+	 (d->heavy[i].entry.dampening == d->heavy[victim].entry.dampening &&
+	  d->heavy[i].entry.penalty < d->heavy[victim].entry.penalty))
+	victim = i;
+   }
+   sketch_demote(d, victim, now);
+   d->evictions++;
+}
+
+static dns_dampening_entry_t *
+sketch_promote(sketch_t * d, const isc_netaddr_t * netaddr,
+	       unsigned int penalty, isc_stdtime_t now) {
+   isc_uint32_t n, * head, generation;
+   dns_dampening_entry_t * e;
+
+   if(SKETCH_AVAIL(d) == 0)
+     sketch_evict(d, now);
+   n = SKETCH_AVAIL(d);
+   INSIST(n != 0);
+   SKETCH_AVAIL(d) = d->heavy[n].next;
+   d->used++;
+
+   head = sketch_bucket(d, netaddr);
+   d->heavy[n].self = n;
+   d->heavy[n].next = *head;
+   *head = n;
+
+   e = &d->heavy[n].entry;
+   generation = e->generation;
+   memset(e, 0, sizeof(*e));
+   memcpy(&e->netaddr, netaddr, sizeof(e->netaddr));
+   e->generation = generation;
+   e->penalty = penalty;
+   e->last_updated = now;
+   update_penalty(d->conf, e, 0, now);	/* enable dampening */
+   return e;
+}
+
+static dns_dampening_entry_t *
+sketch_search(void * data, const isc_netaddr_t * netaddr) {
+   sketch_t * d = data;
+   isc_uint32_t row, index[SKETCH_DEPTH];
+   sketch_cell_t * cell, * min = NULL;
+   dns_dampening_entry_t * e;
+
+   INSIST(data != NULL);
+   e = sketch_heavy(d, netaddr);
+   if(e != NULL)
+     return e;
+
+   sketch_indexes(d, netaddr, index);
+   for(row = 0; row < SKETCH_DEPTH; row++) {
+      cell = &SKETCH_CELL(d, row, index[row]);
+      if(min == NULL || cell->penalty < min->penalty)
+	min = cell;
+   }
+   if(min->penalty == 0)
+     return NULL;
+
+   d->scratch.generation++;
+   memcpy(&d->scratch.netaddr, netaddr, sizeof(d->scratch.netaddr));
+   d->scratch.penalty = min->penalty;
+   d->scratch.last_updated = min->last_updated;
+   d->scratch.dampening = 0;
+   d->scratch.last_id_count = 0;
+   return &d->scratch;
+}
+
+/*
+ * Add the points to the entry. A heavy hitter is updated like a queue
+ * entry, anything else is updated in the sketch and promoted if needed.
+ * The entry pointer is changed on promotion.
+ *
+ * A scratch entry may be a stale reference of a query which searched
+ * before the prefix was promoted by another one. The points then go to
+ * the heavy hitter, so a prefix is never promoted twice.
+ */
+static void
+sketch_update(void * data, dns_dampening_entry_t ** entry, uint16_t points, isc_stdtime_t now) {
+   sketch_t * d = data;
+   isc_uint32_t row, index[SKETCH_DEPTH];
+   unsigned int penalty = ISC_UINT16_MAX, enable, disable;
+
+   INSIST(data != NULL);
+   INSIST(entry != NULL && *entry != NULL);
+
+   if(!SKETCH_IS_HEAVY(d, *entry)) {
+      dns_dampening_entry_t * e = sketch_heavy(d, &(*entry)->netaddr);
+
+      if(e != NULL)
+	*entry = e;
+   }
+
+   if(SKETCH_IS_HEAVY(d, *entry)) {
+      isc_uint32_t n = ((sketch_heavy_t*)*entry)->self;
+
+      RUNTIME_CHECK(0 < n && n < d->heavy_length);
+      if(update_penalty(d->conf, *entry, points, now) == 0)
+	sketch_delete(d, n);
+      else if((*entry)->dampening == 0)
+	sketch_demote(d, n, now);
+      return;
+   }
+
+   sketch_indexes(d, &(*entry)->netaddr, index);
+   for(row = 0; row < SKETCH_DEPTH; row++)
+     penalty = ISC_MIN(penalty, sketch_cell(d, &SKETCH_CELL(d, row, index[row]), now));
+   penalty = ISC_MIN(penalty + points, d->conf->limit.maximum);
+   sketch_raise(d, index, penalty, now);
+
+   level_limits(d->conf, level_of(&(*entry)->netaddr), &enable, &disable);
+   if(penalty > enable) {
+      *entry = sketch_promote(d, &(*entry)->netaddr, penalty, now);
+      d->scratch.generation++;		/* no longer describes the prefix */
+   } else {
+      (*entry)->penalty = penalty;
+      (*entry)->last_updated = now;
+   }
+}
+
+static dns_dampening_entry_t *
+sketch_add(void * data, const isc_netaddr_t * netaddr,
+	   uint16_t points, isc_stdtime_t now) {
+   sketch_t * d = data;
+   dns_dampening_entry_t * e = &d->scratch;
+
+   INSIST(data != NULL);
+   d->scratch.generation++;
+   memcpy(&d->scratch.netaddr, netaddr, sizeof(d->scratch.netaddr));
+   d->scratch.penalty = 0;
+   d->scratch.last_updated = now;
+   d->scratch.dampening = 0;
+   d->scratch.last_id_count = 0;
+   sketch_update(d, &e, points, now);
+   return e;
+}
+
+static void
+sketch_walk(void * data, dns_dampening_walk_t walker, void * arg) {
+   sketch_t * d = data;
+   isc_uint32_t i;
+
+   INSIST(data != NULL);
+   for(i = 1; i < d->heavy_length; i++)
+     if(d->heavy[i].self != 0)
+       walker(arg, &d->heavy[i].entry);
+}
+
+/*
+ * Only the heavy hitters are counted as entries.
+ */
+static void
+sketch_getstats(void * data, dns_dampening_stats_t * stats) {
+   sketch_t * d = data;
+   isc_uint32_t i;
+
+   INSIST(data != NULL);
+   stats->entries   += d->used;
+   stats->capacity  += d->heavy_length - 1;
+   stats->evictions += d->evictions;
+   for(i = 1; i < d->heavy_length; i++)
+     if(d->heavy[i].self != 0)
+       stats_entry(d->conf, stats, &d->heavy[i].entry);
+}
+
+static void
+sketch_destroy(void ** pdata) {
+
+   INSIST(pdata != NULL);
+   if(*pdata != NULL) {
+      sketch_t * d = *pdata;
+
+      if(d->hash != NULL)
+	isc_mem_put(d->mctx, d->hash, d->hash_length * sizeof(*(d->hash)));
+      if(d->heavy != NULL)
+	isc_mem_put(d->mctx, d->heavy, d->heavy_length * sizeof(*(d->heavy)));
+      if(d->cells != NULL)
+	isc_mem_put(d->mctx, d->cells, SKETCH_DEPTH * d->width * sizeof(*(d->cells)));
+
+      isc_mem_put(d->mctx, d, sizeof(*d));
+      *pdata = NULL;
+   }
+
+   INSIST(*pdata == NULL);
+}
+
+/*
+ * The rows get at least 'maximum' counters, so the sketch starts with
+ * its final size.
+ */
+static isc_result_t
+sketch_init(isc_mem_t * mctx, dns_dampening_implementation_t * impl,
+	    dns_dampening_t * conf, isc_uint32_t size,
+	    isc_uint32_t maximum) {
+   sketch_t * d;
+   isc_uint32_t i;
+
+   INSIST(mctx != NULL);
+   INSIST(impl != NULL);
+   INSIST(size > 0);
+   INSIST(size <= maximum);
+
+   impl->destroy = sketch_destroy;
+
+   impl->data = d = isc_mem_get(mctx, sizeof(*d));
+   if(d == NULL)
+     return ISC_R_NOMEMORY;
+   memset(d, 0, sizeof(*d));
+   d->mctx = mctx;
+   d->conf = conf;
+
+   for(d->width = 1; d->width < maximum; d->width *= 2)
+     ;
+   d->cells = isc_mem_get(mctx, SKETCH_DEPTH * d->width * sizeof(*(d->cells)));
+   if(d->cells == NULL) {
+      impl->destroy(&impl->data);
+      return ISC_R_NOMEMORY;
+   }
+   memset(d->cells, 0, SKETCH_DEPTH * d->width * sizeof(*(d->cells)));
+
+   /* One more for the head of the free list */
+   d->heavy_length = ISC_MAX(maximum / SKETCH_HEAVY_RATIO, SKETCH_HEAVY_MIN) + 1;
+   d->heavy = isc_mem_get(mctx, d->heavy_length * sizeof(*(d->heavy)));
+   if(d->heavy == NULL) {
+      impl->destroy(&impl->data);
+      return ISC_R_NOMEMORY;
+   }
+   memset(d->heavy, 0, d->heavy_length * sizeof(*(d->heavy)));
+   for(i = d->heavy_length - 1; i > 0; i--) {
+      d->heavy[i].next = SKETCH_AVAIL(d);
+      SKETCH_AVAIL(d) = i;
+   }
+
+   for(d->hash_length = 1; d->hash_length < d->heavy_length; d->hash_length *= 2)
+     ;
+   d->hash = isc_mem_get(mctx, d->hash_length * sizeof(*(d->hash)));
+   if(d->hash == NULL) {
+      impl->destroy(&impl->data);
+      return ISC_R_NOMEMORY;
+   }
+   memset(d->hash, 0, d->hash_length * sizeof(*(d->hash)));
+
+   impl->search   = sketch_search;
+   impl->add      = sketch_add;
+   impl->update   = sketch_update;
+   impl->getstats = sketch_getstats;
+   impl->walk     = sketch_walk;
+
+   isc_log_write(dns_lctx, DNS_LOGCATEGORY_DAMPENING,
+		 DNS_LOGMODULE_REQUEST, ISC_LOG_INFO,
+		 "Sketch initialized to %u x %u counters and %u heavy hitters: %lu bytes",
+		 SKETCH_DEPTH, d->width, d->heavy_length - 1,
+		 (unsigned long)(SKETCH_DEPTH * d->width * sizeof(*d->cells) +
+				 d->heavy_length * sizeof(*d->heavy) +
+				 d->hash_length * sizeof(*d->hash)));
    return ISC_R_SUCCESS;
 }
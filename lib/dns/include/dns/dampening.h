@@ -5,8 +5,11 @@
 #ifndef DNS_DAMPENING_H
 #define DNS_DAMPENING_H 1
 
+#include <isc/json.h>
 #include <isc/mutex.h>
+#include <isc/refcount.h>
 #include <isc/stdtime.h>
+#include <isc/xml.h>
 #include <dns/acl.h>
 
 typedef enum {
@@ -14,13 +17,45 @@ typedef enum {
    DNS_DAMPENING_STATE_SUPPRESS
 } dns_dampening_state_t;
 
+/*
+ * Entries returned by an implementation stay addressable until the
+ * implementation is destroyed. Whenever an entry is removed from the
+ * table, its generation is incremented, so references to it can be
+ * checked for validity. The address of an entry of an aggregation level
+ * above 0 carries the level in its zone, see dns_dampening_prefixlen().
+ */
 typedef struct dns_dampening_entry {
    isc_netaddr_t netaddr;
    isc_stdtime_t last_updated;
+   isc_uint32_t generation;
    dns_messageid_t last_id;
    unsigned int dampening : 1, last_id_count : 15, penalty : 16;
 } dns_dampening_entry_t;
 
+/*
+ * Counters of an implementation instance. The times are the accumulated
+ * nanoseconds spent waiting for the lock and within the operations.
+ */
+typedef struct dns_dampening_counters {
+   isc_uint64_t lock, search, update, add;
+   isc_uint64_t allowed, denied, skipped;
+} dns_dampening_counters_t;
+
+#define DNS_DAMPENING_HISTOGRAM	8
+
+/*
+ * Summary of a dampening table, filled by dns_dampening_getstats().
+ * The penalties are counted in DNS_DAMPENING_HISTOGRAM buckets of equal
+ * width up to limit-maximum.
+ */
+typedef struct dns_dampening_stats {
+   dns_dampening_counters_t counters;
+   isc_uint64_t entries, capacity, evictions, dampened;
+   isc_uint64_t histogram[DNS_DAMPENING_HISTOGRAM];
+} dns_dampening_stats_t;
+
+typedef void (*dns_dampening_walk_t)(void *, const dns_dampening_entry_t *);
+
 typedef struct dns_dampening_implementation {
    /* Interals */
    void * data;
@@ -28,31 +63,75 @@ typedef struct dns_dampening_implementation {
    /* API */
    void (*destroy)(void **);
    dns_dampening_entry_t * (*search)(void *, const isc_netaddr_t * netaddr);
-   void (*add)(void *, const isc_netaddr_t * netaddr, uint16_t points, isc_stdtime_t now);
+   dns_dampening_entry_t * (*add)(void *, const isc_netaddr_t * netaddr, uint16_t points, isc_stdtime_t now);
    void (*update)(void *, dns_dampening_entry_t ** entry, uint16_t points, isc_stdtime_t now);
+   void (*getstats)(void *, dns_dampening_stats_t * stats);
+   void (*walk)(void *, dns_dampening_walk_t walker, void * arg);
    /* Used by externals */
    isc_mutex_t lock;
    struct {
-      struct timeval lock, search, update, add;
-      unsigned int allowed, denied, skipped;
+      dns_dampening_counters_t total, reported;
       isc_stdtime_t last_report;
    } statistics;
 }  dns_dampening_implementation_t;
 
+#define DNS_DAMPENING_DECAY_STEPS	1024
+#define DNS_DAMPENING_MAXLEVELS		4
+
+typedef struct dns_dampening_filter dns_dampening_filter_t;
+
+/*
+ * A table is either owned by a view, or a shared table of the server
+ * referenced by several views. The views referencing a shared table have
+ * no workers of their own, they keep only the exempt list, the scores and
+ * the enable/disable limits. All other parameters are copied from the
+ * shared table.
+ */
 typedef struct dns_dampening {
+   isc_mem_t	*mctx;
+   isc_refcount_t references;
+   struct dns_dampening * store;	/* shared table, or NULL */
    dns_acl_t	*exempt;
    int		max_entries;
+   dns_dampening_filter_t * filter;	/* early drop, shared by views */
+   char		*snapshot;	/* file saved on shutdown, or NULL */
+   /*
+    * Each implementation is split into 'shards_count' independently locked
+    * instances, selected by hashing the client prefix. The instances of
+    * implementation #i are found at workers[i*shards_count .. (i+1)*shards_count-1].
+    */
    dns_dampening_implementation_t * workers;
    int workers_count;
+   int shards_count;
 
    struct dns_dampening_prefix {
       unsigned int ipv4;
       unsigned int ipv6;
    } prefixlen;
+
+   /*
+    * Coarser prefixes tracked in the same table in addition to 'prefixlen',
+    * each with limits of its own. Level 0 is 'prefixlen' with 'limit',
+    * level i > 0 is aggregate[i-1]. A level not shorter than 'prefixlen'
+    * for an address family does not apply to that family.
+    */
+   struct dns_dampening_aggregate {
+      struct dns_dampening_prefix prefixlen;
+      unsigned int
+	enable_dampening   : 16,
+	disable_dampening  : 16;
+   } aggregate[DNS_DAMPENING_MAXLEVELS - 1];
+   int aggregate_count;
    
+   /*
+    * The decay factors 2^16 * 2^(-i*step/halflife) for the elapsed time
+    * within one halflife, set up by dns_dampening_setdecay().
+    */
    struct dns_dampening_decay {
       int halflife;
       int updatedelay;
+      int step;
+      isc_uint32_t factor[DNS_DAMPENING_DECAY_STEPS];
    } decay;
     
    struct dns_dampening_limit {
@@ -76,14 +155,74 @@ typedef struct dns_dampening {
    
    struct dns_dampening_statistics {
       int report_interval;
+      isc_boolean_t timing;
    } statistics;
    
 } dns_dampening_t;
 
-dns_dampening_state_t dns_dampening_query(dns_dampening_t *, const isc_sockaddr_t *, isc_stdtime_t, int *);
-void dns_dampening_score_qtype(dns_dampening_t *, const isc_sockaddr_t *, isc_stdtime_t, dns_messageid_t, int);
-void dns_dampening_score_size(dns_dampening_t *, const isc_sockaddr_t *, isc_stdtime_t, int);
-isc_result_t dns_dampening_init(dns_view_t *, int);
+#define DNS_DAMPENING_MAXIMPL	4
+
+/*
+ * Storage implementations, several of them can run in parallel for
+ * comparison.
+ */
+#define DNS_DAMPENING_STORAGE_QUEUE	0x01
+#define DNS_DAMPENING_STORAGE_SKETCH	0x02
+
+/*
+ * Reference to the entries of a client prefix. It is filled by
+ * dns_dampening_query() and reused by the scoring functions of the same
+ * request, so the prefixes are extracted, matched against the exempt list,
+ * and searched only once. The query type points are deferred until the
+ * size is scored or the handle is flushed. All levels of a client are
+ * kept in the same shard.
+ */
+typedef struct dns_dampening_handle {
+   dns_dampening_t * damp;		/* NULL if not resolved */
+   int shard;
+   isc_boolean_t exempt;
+   int levels;
+   struct {
+      isc_netaddr_t prefix;
+      struct {
+	 dns_dampening_entry_t * entry;
+	 isc_uint32_t generation;
+      } slot[DNS_DAMPENING_MAXIMPL];
+   } level[DNS_DAMPENING_MAXLEVELS];
+   int pending_qtype;			/* -1 if nothing deferred */
+   dns_messageid_t pending_id;
+} dns_dampening_handle_t;
+
+void dns_dampening_handle_init(dns_dampening_handle_t *);
+dns_dampening_state_t dns_dampening_query(dns_dampening_t *, const isc_sockaddr_t *, isc_stdtime_t, int *, dns_dampening_handle_t *);
+void dns_dampening_score_qtype(dns_dampening_t *, const isc_sockaddr_t *, isc_stdtime_t, dns_messageid_t, int, dns_dampening_handle_t *);
+void dns_dampening_score_size(dns_dampening_t *, const isc_sockaddr_t *, isc_stdtime_t, int, dns_dampening_handle_t *);
+void dns_dampening_flush(dns_dampening_t *, dns_dampening_handle_t *, isc_stdtime_t);
+isc_result_t dns_dampening_init(dns_view_t *, int, int, int, unsigned int);
+isc_result_t dns_dampening_initshared(dns_view_t *, dns_dampening_t *);
+isc_result_t dns_dampening_create(isc_mem_t *, int, int, int, unsigned int, dns_dampening_t **);
+void dns_dampening_attach(dns_dampening_t *, dns_dampening_t **);
+void dns_dampening_detach(dns_dampening_t **);
+void dns_dampening_setdecay(dns_dampening_t *, int, int);
+unsigned int dns_dampening_decay(const dns_dampening_t *, unsigned int, unsigned int);
 void dns_dampening_destroy(dns_view_t *);
+void dns_dampening_getstats(dns_dampening_t *, dns_dampening_stats_t *);
+unsigned int dns_dampening_prefixlen(const dns_dampening_t *, const isc_netaddr_t *);
+unsigned int dns_dampening_top(dns_dampening_t *, isc_stdtime_t, dns_dampening_entry_t *, unsigned int);
+void dns_dampening_merge(dns_dampening_t *, dns_dampening_t *, isc_stdtime_t);
+isc_result_t dns_dampening_save(dns_dampening_t *, const char *, isc_stdtime_t);
+isc_result_t dns_dampening_restore(dns_dampening_t *, const char *, isc_stdtime_t);
+#ifdef HAVE_LIBXML2
+int dns_dampening_renderxml(dns_dampening_t *, xmlTextWriterPtr);
+#endif
+#ifdef HAVE_JSON
+isc_result_t dns_dampening_renderjson(dns_dampening_t *, json_object *);
+#endif
+
+isc_result_t dns_dampening_filter_create(isc_mem_t *, dns_dampening_filter_t **);
+void dns_dampening_filter_attach(dns_dampening_filter_t *, dns_dampening_filter_t **);
+void dns_dampening_filter_detach(dns_dampening_filter_t **);
+isc_boolean_t dns_dampening_filter_lookup(dns_dampening_filter_t *, const isc_sockaddr_t *, isc_stdtime_t);
+isc_boolean_t dns_dampening_filter_check(dns_dampening_filter_t *, const dns_dampening_t *, const isc_sockaddr_t *, isc_stdtime_t);
 
 #endif
@@ -134,6 +134,11 @@ struct dns_dispatchset {
  *
  * _EXCLUSIVE
  *	A separate socket will be used on-demand for each transaction.
+ *
+ * _REUSEPORT
+ *	The dispatcher gets a socket of its own bound with SO_REUSEPORT to
+ *	a specific port, so that other _REUSEPORT dispatchers can be bound
+ *	to the same address and port.  It is never shared.
  */
 #define DNS_DISPATCHATTR_PRIVATE	0x00000001U
 #define DNS_DISPATCHATTR_TCP		0x00000002U
@@ -145,6 +150,7 @@ struct dns_dispatchset {
 #define DNS_DISPATCHATTR_CONNECTED	0x00000080U
 /*#define DNS_DISPATCHATTR_RANDOMPORT	0x00000100U*/
 #define DNS_DISPATCHATTR_EXCLUSIVE	0x00000200U
+#define DNS_DISPATCHATTR_REUSEPORT	0x00000400U
 /*@}*/
 
 isc_result_t
@@ -269,7 +275,9 @@ dns_dispatch_getudp_dup(dns_dispatchmgr_t *mgr, isc_socketmgr_t *sockmgr,
 		    dns_dispatch_t **dispp, dns_dispatch_t *dup);
 /*%<
  * Attach to existing dns_dispatch_t if one is found with dns_dispatchmgr_find,
- * otherwise create a new UDP dispatch.
+ * otherwise create a new UDP dispatch.  A dispatch with the
+ * DNS_DISPATCHATTR_REUSEPORT attribute is always created with a socket of
+ * its own; 'dup' is ignored then.
  *
  * Requires:
  *\li	All pointer parameters be valid for their respective types.
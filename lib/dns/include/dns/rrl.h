@@ -22,7 +22,9 @@
  * Rate limit DNS responses.
  */
 
+#include <isc/event.h>
 #include <isc/lang.h>
+#include <isc/refcount.h>
 
 #include <dns/fixedname.h>
 #include <dns/rdata.h>
@@ -191,6 +193,58 @@ struct dns_rrl_qname_buf {
 	dns_fixedname_t	    qname;
 };
 
+/*
+ * An independently locked part of the database.  The shard of an entry
+ * is chosen by the hash of its whole key, so the responses to a single
+ * address for different names and types are spread over the shards.
+ * A response holds the lock of one shard at a time.
+ * Each shard ages, expands, and logs its entries by itself.
+ *
+ * Free entries are kept at the tail of the LRU list, starting with
+ * 'free_head'.  When they run low while all used entries are busy, the
+ * 'grow' event adds entries or bins on the task of the database, so
+ * responses do not wait for the allocation.  The bins of a replaced hash
+ * table are moved to the new one a few at a time.
+ */
+typedef struct dns_rrl_shard dns_rrl_shard_t;
+struct dns_rrl_shard {
+	isc_mutex_t	lock;
+
+	int		num_entries;
+	int		num_free;
+	dns_rrl_entry_t	*free_head;
+
+	unsigned int	probes;
+	unsigned int	searches;
+
+	ISC_LIST(dns_rrl_block_t) blocks;
+	ISC_LIST(dns_rrl_entry_t) lru;
+
+	dns_rrl_hash_t	*hash;
+	dns_rrl_hash_t	*old_hash;
+	int		migrated;
+	unsigned int	hash_gen;
+
+	isc_event_t	grow;
+	isc_boolean_t	grow_sent;
+	isc_boolean_t	grow_entries;
+	isc_boolean_t	grow_hash;
+
+	unsigned int	ts_gen;
+# define DNS_RRL_TS_BASES   (1<<DNS_RRL_TS_GEN_BITS)
+	isc_stdtime_t	ts_bases[DNS_RRL_TS_BASES];
+
+	isc_stdtime_t	log_stops_time;
+	dns_rrl_entry_t	*last_logged;
+	int		num_logged;
+	int		num_qnames;
+	ISC_LIST(dns_rrl_qname_buf_t) qname_free;
+# define DNS_RRL_QNAMES	    (1<<DNS_RRL_QNAMES_BITS)
+	dns_rrl_qname_buf_t *qnames[DNS_RRL_QNAMES];
+};
+
+#define DNS_RRL_MAX_SHARDS	1024
+
 typedef struct dns_rrl_rate dns_rrl_rate_t;
 struct dns_rrl_rate {
 	int	    r;
@@ -200,11 +254,16 @@ struct dns_rrl_rate {
 
 /*
  * Per-view query rate limit parameters and a pointer to database.
+ * The lock protects only the estimate of the query rate and the
+ * scaled rates.  Pending 'grow' events hold references to the database.
  */
 typedef struct dns_rrl dns_rrl_t;
 struct dns_rrl {
 	isc_mutex_t	lock;
 	isc_mem_t	*mctx;
+	isc_refcount_t	references;
+	isc_task_t	*task;
+	isc_boolean_t	exiting;
 
 	isc_boolean_t	log_only;
 	dns_rrl_rate_t	responses_per_second;
@@ -220,38 +279,17 @@ struct dns_rrl {
 
 	dns_acl_t	*exempt;
 
-	int		num_entries;
-
 	int		qps_responses;
 	isc_stdtime_t	qps_time;
 	double		qps;
 
-	unsigned int	probes;
-	unsigned int	searches;
-
-	ISC_LIST(dns_rrl_block_t) blocks;
-	ISC_LIST(dns_rrl_entry_t) lru;
-
-	dns_rrl_hash_t	*hash;
-	dns_rrl_hash_t	*old_hash;
-	unsigned int	hash_gen;
-
-	unsigned int	ts_gen;
-# define DNS_RRL_TS_BASES   (1<<DNS_RRL_TS_GEN_BITS)
-	isc_stdtime_t	ts_bases[DNS_RRL_TS_BASES];
-
 	int		ipv4_prefixlen;
 	isc_uint32_t	ipv4_mask;
 	int		ipv6_prefixlen;
 	isc_uint32_t	ipv6_mask[4];
 
-	isc_stdtime_t	log_stops_time;
-	dns_rrl_entry_t	*last_logged;
-	int		num_logged;
-	int		num_qnames;
-	ISC_LIST(dns_rrl_qname_buf_t) qname_free;
-# define DNS_RRL_QNAMES	    (1<<DNS_RRL_QNAMES_BITS)
-	dns_rrl_qname_buf_t *qnames[DNS_RRL_QNAMES];
+	int		num_shards;
+	dns_rrl_shard_t	*shards;
 };
 
 typedef enum {
@@ -271,7 +309,19 @@ void
 dns_rrl_view_destroy(dns_view_t *view);
 
 isc_result_t
-dns_rrl_init(dns_rrl_t **rrlp, dns_view_t *view, int min_entries);
+dns_rrl_init(dns_rrl_t **rrlp, dns_view_t *view, int min_entries,
+	     int num_shards);
+/*%<
+ * Create the rate limit database of 'view' with 'num_shards' shards
+ * sharing 'min_entries' entries.  The number of shards is reduced to
+ * 'min_entries' and limited to DNS_RRL_MAX_SHARDS.
+ */
+
+void
+dns_rrl_settask(dns_rrl_t *rrl, isc_task_t *task);
+/*%<
+ * Grow the database on 'task' instead of while answering queries.
+ */
 
 ISC_LANG_ENDDECLS
 
@@ -193,6 +193,31 @@ LIBDNS_EXTERNAL_DATA extern const char *dns_statscounter_names[];
 #define DNS_RDATASTATSTYPE_ATTR(type)	((type) >> 16)
 #define DNS_RDATASTATSTYPE_VALUE(b, a)	(((a) << 16) | (b))
 
+/*%<
+ * Where the answer to a query came from, for query latency statistics.
+ */
+typedef enum {
+	dns_latencysource_auth = 0,
+	dns_latencysource_cache = 1,
+	dns_latencysource_recursion = 2,
+
+	dns_latencysource_max = 3
+} dns_latencysource_t;
+
+/*%<
+ * Response codes kept apart by the query latency statistics; all other
+ * codes are counted as dns_latencyrcode_other.
+ */
+typedef enum {
+	dns_latencyrcode_noerror = 0,
+	dns_latencyrcode_servfail = 1,
+	dns_latencyrcode_nxdomain = 2,
+	dns_latencyrcode_refused = 3,
+	dns_latencyrcode_other = 4,
+
+	dns_latencyrcode_max = 5
+} dns_latencyrcode_t;
+
 /*%<
  * Types of dump callbacks.
  */
@@ -201,6 +226,12 @@ typedef void (*dns_generalstats_dumper_t)(isc_statscounter_t, isc_uint64_t,
 typedef void (*dns_rdatatypestats_dumper_t)(dns_rdatastatstype_t, isc_uint64_t,
 					    void *);
 typedef void (*dns_opcodestats_dumper_t)(dns_opcode_t, isc_uint64_t, void *);
+typedef void (*dns_latencystats_dumper_t)(dns_latencysource_t,
+					  dns_latencyrcode_t, isc_uint64_t,
+					  isc_uint64_t, isc_uint64_t, void *);
+typedef void (*dns_latencysum_dumper_t)(dns_latencysource_t,
+					dns_latencyrcode_t, isc_uint64_t,
+					void *);
 
 ISC_LANG_BEGINDECLS
 
@@ -291,6 +322,25 @@ dns_stats_detach(dns_stats_t **statsp);
  *\li	'statsp' != NULL and '*statsp' is a valid dns_stats_t.
  */
 
+isc_result_t
+dns_latencystats_create(isc_mem_t *mctx, dns_stats_t **statsp);
+/*%<
+ * Create a set of query latency histograms, one per answer source and
+ * response code class.  The buckets are log-linear: microsecond wide
+ * below 4us, then four per power of two up to about 2 minutes, above
+ * which everything lands in the last bucket.
+ *
+ * Requires:
+ *\li	'mctx' must be a valid memory context.
+ *
+ *\li	'statsp' != NULL && '*statsp' == NULL.
+ *
+ * Returns:
+ *\li	ISC_R_SUCCESS	-- all ok
+ *
+ *\li	anything else	-- failure
+ */
+
 void
 dns_generalstats_increment(dns_stats_t *stats, isc_statscounter_t counter);
 /*%<
@@ -343,6 +393,19 @@ dns_opcodestats_increment(dns_stats_t *stats, dns_opcode_t code);
  *\li	'stats' is a valid dns_stats_t created by dns_opcodestats_create().
  */
 
+void
+dns_latencystats_record(dns_stats_t *stats, dns_latencysource_t source,
+			dns_rcode_t rcode, isc_uint64_t usec);
+/*%<
+ * Count a query from 'source' answered with 'rcode' after 'usec'
+ * microseconds, and add 'usec' to the histogram's total latency.
+ *
+ * Requires:
+ *\li	'stats' is a valid dns_stats_t created by dns_latencystats_create().
+ *
+ *\li	'source' < dns_latencysource_max.
+ */
+
 void
 dns_generalstats_dump(dns_stats_t *stats, dns_generalstats_dumper_t dump_fn,
 		      void *arg, unsigned int options);
@@ -401,6 +464,38 @@ dns_opcodestats_dump(dns_stats_t *stats, dns_opcodestats_dumper_t dump_fn,
  *\li	'stats' is a valid dns_stats_t created by dns_generalstats_create().
  */
 
+void
+dns_latencystats_dump(dns_stats_t *stats, dns_latencystats_dumper_t dump_fn,
+		      void *arg, unsigned int options);
+/*%<
+ * Dump the current latency histograms.  For each bucket, dump_fn is
+ * called with the answer source, the response code class, the lower
+ * and upper bounds of the bucket in microseconds (the upper bound is
+ * exclusive, and 0 for the last, unbounded bucket), the number of
+ * queries in it and the given argument arg.  Buckets are dumped in
+ * order of increasing latency for each histogram.  By default empty
+ * buckets are skipped; if options has the ISC_STATSDUMP_VERBOSE flag,
+ * even such buckets are dumped.
+ *
+ * Requires:
+ *\li	'stats' is a valid dns_stats_t created by dns_latencystats_create().
+ */
+
+void
+dns_latencystats_dumpsums(dns_stats_t *stats, dns_latencysum_dumper_t dump_fn,
+			  void *arg, unsigned int options);
+/*%<
+ * Dump the total latency of each histogram.  For each histogram, dump_fn
+ * is called with the answer source, the response code class, the sum of
+ * the latencies of the queries counted in it in microseconds and the
+ * given argument arg.  By default histograms with a total of 0 are
+ * skipped; if options has the ISC_STATSDUMP_VERBOSE flag, even such
+ * histograms are dumped.
+ *
+ * Requires:
+ *\li	'stats' is a valid dns_stats_t created by dns_latencystats_create().
+ */
+
 isc_result_t
 dns_stats_alloccounters(isc_mem_t *mctx, isc_uint64_t **ctrp);
 /*%<
@@ -113,6 +113,7 @@ struct dns_view {
 	isc_stats_t *			adbstats;
 	isc_stats_t *			resstats;
 	dns_stats_t *			resquerystats;
+	dns_stats_t *			latencystats;
 	isc_boolean_t			cacheshared;
 
 	/* Configurable data. */
@@ -1065,6 +1066,32 @@ dns_view_getresquerystats(dns_view_t *view, dns_stats_t **statsp);
  *\li	'statsp' != NULL && '*statsp' != NULL
  */
 
+void
+dns_view_setlatencystats(dns_view_t *view, dns_stats_t *stats);
+/*%<
+ * Set a set of query latency histograms, 'stats', for 'view'.  Once the
+ * set is installed, the server records how long each query answered in
+ * 'view' took.
+ *
+ * Requires:
+ * \li	'view' is valid and is not frozen.
+ *
+ *\li	stats is a valid statistics created by dns_latencystats_create().
+ */
+
+void
+dns_view_getlatencystats(dns_view_t *view, dns_stats_t **statsp);
+/*%<
+ * Get the query latency histograms for 'view'.  If a statistics set is
+ * set '*statsp' will be attached to the set; otherwise, '*statsp' will be
+ * untouched.
+ *
+ * Requires:
+ * \li	'view' is valid.
+ *
+ *\li	'statsp' != NULL && '*statsp' == NULL
+ */
+
 isc_boolean_t
 dns_view_iscacheshared(dns_view_t *view);
 /*%<
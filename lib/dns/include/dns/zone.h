@@ -1776,6 +1776,16 @@ dns_zonemgr_getserialqueryrate(dns_zonemgr_t *zmgr);
  *\li	'zmgr' to be a valid zone manager.
  */
 
+void
+dns_zonemgr_sethugepages(dns_zonemgr_t *zmgr, isc_boolean_t value);
+/*%<
+ *	Set whether the memory contexts of zones created from now on
+ *	get their blocks from huge pages (see isc_mem_sethugepages()).
+ *
+ * Requires:
+ *\li	'zmgr' to be a valid zone manager.
+ */
+
 unsigned int
 dns_zonemgr_getcount(dns_zonemgr_t *zmgr, int state);
 /*%<
@@ -27,7 +27,10 @@
 #include <isc/net.h>
 #include <isc/netaddr.h>
 #include <isc/print.h>
+#include <isc/task.h>
+#include <isc/util.h>
 
+#include <dns/events.h>
 #include <dns/result.h>
 #include <dns/rcode.h>
 #include <dns/rdatatype.h>
@@ -37,8 +40,8 @@
 #include <dns/view.h>
 
 static void
-log_end(dns_rrl_t *rrl, dns_rrl_entry_t *e, isc_boolean_t early,
-	char *log_buf, unsigned int log_buf_len);
+log_end(dns_rrl_t *rrl, dns_rrl_shard_t *shard, dns_rrl_entry_t *e,
+	isc_boolean_t early, char *log_buf, unsigned int log_buf_len);
 
 /*
  * Get a modulus for a hash function that is tolerably likely to be
@@ -131,20 +134,22 @@ delta_rrl_time(isc_stdtime_t ts, isc_stdtime_t now) {
 }
 
 static inline int
-get_age(const dns_rrl_t *rrl, const dns_rrl_entry_t *e, isc_stdtime_t now) {
+get_age(const dns_rrl_shard_t *shard, const dns_rrl_entry_t *e,
+	isc_stdtime_t now)
+{
 	if (!e->ts_valid)
 		return (DNS_RRL_FOREVER);
-	return (delta_rrl_time(e->ts + rrl->ts_bases[e->ts_gen], now));
+	return (delta_rrl_time(e->ts + shard->ts_bases[e->ts_gen], now));
 }
 
 static inline void
-set_age(dns_rrl_t *rrl, dns_rrl_entry_t *e, isc_stdtime_t now) {
+set_age(dns_rrl_shard_t *shard, dns_rrl_entry_t *e, isc_stdtime_t now) {
 	dns_rrl_entry_t *e_old;
 	unsigned int ts_gen;
 	int i, ts;
 
-	ts_gen = rrl->ts_gen;
-	ts = now - rrl->ts_bases[ts_gen];
+	ts_gen = shard->ts_gen;
+	ts = now - shard->ts_bases[ts_gen];
 	if (ts < 0) {
 		if (ts < -DNS_RRL_MAX_TIME_TRAVEL)
 			ts = DNS_RRL_FOREVER;
@@ -166,7 +171,7 @@ set_age(dns_rrl_t *rrl, dns_rrl_entry_t *e, isc_stdtime_t now) {
 	 */
 	if (ts >= DNS_RRL_MAX_TS) {
 		ts_gen = (ts_gen + 1) % DNS_RRL_TS_BASES;
-		for (e_old = ISC_LIST_TAIL(rrl->lru), i = 0;
+		for (e_old = ISC_LIST_TAIL(shard->lru), i = 0;
 		     e_old != NULL && (e_old->ts_gen == ts_gen ||
 				       !ISC_LINK_LINKED(e_old, hlink));
 		     e_old = ISC_LIST_PREV(e_old, lru), ++i)
@@ -178,15 +183,15 @@ set_age(dns_rrl_t *rrl, dns_rrl_entry_t *e, isc_stdtime_t now) {
 				      DNS_LOGMODULE_REQUEST, DNS_RRL_LOG_DEBUG1,
 				      "rrl new time base scanned %d entries"
 				      " at %d for %d %d %d %d",
-				      i, now, rrl->ts_bases[ts_gen],
-				      rrl->ts_bases[(ts_gen + 1) %
+				      i, now, shard->ts_bases[ts_gen],
+				      shard->ts_bases[(ts_gen + 1) %
 					DNS_RRL_TS_BASES],
-				      rrl->ts_bases[(ts_gen + 2) %
+				      shard->ts_bases[(ts_gen + 2) %
 					DNS_RRL_TS_BASES],
-				      rrl->ts_bases[(ts_gen + 3) %
+				      shard->ts_bases[(ts_gen + 3) %
 					DNS_RRL_TS_BASES]);
-		rrl->ts_gen = ts_gen;
-		rrl->ts_bases[ts_gen] = now;
+		shard->ts_gen = ts_gen;
+		shard->ts_bases[ts_gen] = now;
 		ts = 0;
 	}
 
@@ -195,39 +200,36 @@ set_age(dns_rrl_t *rrl, dns_rrl_entry_t *e, isc_stdtime_t now) {
 	e->ts_valid = ISC_TRUE;
 }
 
-static isc_result_t
-expand_entries(dns_rrl_t *rrl, int new) {
+/*
+ * The share of max-table-size of each shard.
+ */
+static inline int
+shard_max_entries(const dns_rrl_t *rrl) {
+	if (rrl->max_entries == 0)
+		return (0);
+	return (ISC_MAX(rrl->max_entries / rrl->num_shards, 1));
+}
+
+/*
+ * Limit the number of entries to add to a shard by max-table-size.
+ */
+static inline int
+grow_size(const dns_rrl_t *rrl, const dns_rrl_shard_t *shard, int new) {
+	int max_entries;
+
+	max_entries = shard_max_entries(rrl);
+	if (shard->num_entries + new >= max_entries && max_entries != 0)
+		new = max_entries - shard->num_entries;
+	return (new);
+}
+
+static dns_rrl_block_t *
+alloc_entries(dns_rrl_t *rrl, int new) {
 	unsigned int bsize;
 	dns_rrl_block_t *b;
 	dns_rrl_entry_t *e;
-	double rate;
 	int i;
 
-	if (rrl->num_entries + new >= rrl->max_entries &&
-	    rrl->max_entries != 0)
-	{
-		new = rrl->max_entries - rrl->num_entries;
-		if (new <= 0)
-			return (ISC_R_SUCCESS);
-	}
-
-	/*
-	 * Log expansions so that the user can tune max-table-size
-	 * and min-table-size.
-	 */
-	if (isc_log_wouldlog(dns_lctx, DNS_RRL_LOG_DROP) &&
-	    rrl->hash != NULL) {
-		rate = rrl->probes;
-		if (rrl->searches != 0)
-			rate /= rrl->searches;
-		isc_log_write(dns_lctx, DNS_LOGCATEGORY_RRL,
-			      DNS_LOGMODULE_REQUEST, DNS_RRL_LOG_DROP,
-			      "increase from %d to %d RRL entries with"
-			      " %d bins; average search length %.1f",
-			      rrl->num_entries, rrl->num_entries+new,
-			      rrl->hash->length, rate);
-	}
-
 	bsize = sizeof(dns_rrl_block_t) + (new-1)*sizeof(dns_rrl_entry_t);
 	b = isc_mem_get(rrl->mctx, bsize);
 	if (b == NULL) {
@@ -235,19 +237,72 @@ expand_entries(dns_rrl_t *rrl, int new) {
 			      DNS_LOGMODULE_REQUEST, DNS_RRL_LOG_FAIL,
 			      "isc_mem_get(%d) failed for RRL entries",
 			      bsize);
-		return (ISC_R_NOMEMORY);
+		return (NULL);
 	}
 	memset(b, 0, bsize);
 	b->size = bsize;
+	ISC_LINK_INIT(b, link);
 
 	e = b->entries;
 	for (i = 0; i < new; ++i, ++e) {
 		ISC_LINK_INIT(e, hlink);
-		ISC_LIST_INITANDAPPEND(rrl->lru, e, lru);
+		ISC_LINK_INIT(e, lru);
+	}
+	return (b);
+}
+
+/*
+ * Append the new entries to the free entries at the tail of the LRU list.
+ */
+static void
+add_entries(dns_rrl_t *rrl, dns_rrl_shard_t *shard, dns_rrl_block_t *b,
+	    int new)
+{
+	dns_rrl_entry_t *e;
+	double rate;
+	int i;
+
+	/*
+	 * Log expansions so that the user can tune max-table-size
+	 * and min-table-size.
+	 */
+	if (isc_log_wouldlog(dns_lctx, DNS_RRL_LOG_DROP) &&
+	    shard->hash != NULL) {
+		rate = shard->probes;
+		if (shard->searches != 0)
+			rate /= shard->searches;
+		isc_log_write(dns_lctx, DNS_LOGCATEGORY_RRL,
+			      DNS_LOGMODULE_REQUEST, DNS_RRL_LOG_DROP,
+			      "increase from %d to %d RRL entries with"
+			      " %d bins in shard %d;"
+			      " average search length %.1f",
+			      shard->num_entries, shard->num_entries+new,
+			      shard->hash->length,
+			      (int)(shard - rrl->shards), rate);
 	}
-	rrl->num_entries += new;
-	ISC_LIST_INITANDAPPEND(rrl->blocks, b, link);
 
+	e = b->entries;
+	for (i = 0; i < new; ++i, ++e)
+		ISC_LIST_APPEND(shard->lru, e, lru);
+	if (shard->free_head == NULL)
+		shard->free_head = b->entries;
+	shard->num_free += new;
+	shard->num_entries += new;
+	ISC_LIST_APPEND(shard->blocks, b, link);
+}
+
+static isc_result_t
+expand_entries(dns_rrl_t *rrl, dns_rrl_shard_t *shard, int new) {
+	dns_rrl_block_t *b;
+
+	new = grow_size(rrl, shard, new);
+	if (new <= 0)
+		return (ISC_R_SUCCESS);
+
+	b = alloc_entries(rrl, new);
+	if (b == NULL)
+		return (ISC_R_NOMEMORY);
+	add_entries(rrl, shard, b, new);
 	return (ISC_R_SUCCESS);
 }
 
@@ -256,46 +311,18 @@ get_bin(dns_rrl_hash_t *hash, unsigned int hval) {
 	return (&hash->bins[hval % hash->length]);
 }
 
-static void
-free_old_hash(dns_rrl_t *rrl) {
-	dns_rrl_hash_t *old_hash;
-	dns_rrl_bin_t *old_bin;
-	dns_rrl_entry_t *e, *e_next;
-
-	old_hash = rrl->old_hash;
-	for (old_bin = &old_hash->bins[0];
-	     old_bin < &old_hash->bins[old_hash->length];
-	     ++old_bin)
-	{
-		for (e = ISC_LIST_HEAD(*old_bin); e != NULL; e = e_next) {
-			e_next = ISC_LIST_NEXT(e, hlink);
-			ISC_LINK_INIT(e, hlink);
-		}
-	}
-
-	isc_mem_put(rrl->mctx, old_hash,
-		    sizeof(*old_hash)
-		      + (old_hash->length - 1) * sizeof(old_hash->bins[0]));
-	rrl->old_hash = NULL;
-}
-
-static isc_result_t
-expand_rrl_hash(dns_rrl_t *rrl, isc_stdtime_t now) {
+static dns_rrl_hash_t *
+alloc_hash(dns_rrl_t *rrl, int old_bins, int num_entries) {
 	dns_rrl_hash_t *hash;
-	int old_bins, new_bins, hsize;
-	double rate;
-
-	if (rrl->old_hash != NULL)
-		free_old_hash(rrl);
+	int new_bins, hsize;
 
 	/*
 	 * Most searches fail and so go to the end of the chain.
 	 * Use a small hash table load factor.
 	 */
-	old_bins = (rrl->hash == NULL) ? 0 : rrl->hash->length;
 	new_bins = old_bins/8 + old_bins;
-	if (new_bins < rrl->num_entries)
-		new_bins = rrl->num_entries;
+	if (new_bins < num_entries)
+		new_bins = num_entries;
 	new_bins = hash_divisor(new_bins);
 
 	hsize = sizeof(dns_rrl_hash_t) + (new_bins-1)*sizeof(hash->bins[0]);
@@ -306,59 +333,190 @@ expand_rrl_hash(dns_rrl_t *rrl, isc_stdtime_t now) {
 			      "isc_mem_get(%d) failed for"
 			      " RRL hash table",
 			      hsize);
-		return (ISC_R_NOMEMORY);
+		return (NULL);
 	}
 	memset(hash, 0, hsize);
 	hash->length = new_bins;
-	rrl->hash_gen ^= 1;
-	hash->gen = rrl->hash_gen;
+	return (hash);
+}
 
-	if (isc_log_wouldlog(dns_lctx, DNS_RRL_LOG_DROP) && old_bins != 0) {
-		rate = rrl->probes;
-		if (rrl->searches != 0)
-			rate /= rrl->searches;
+static void
+free_hash(dns_rrl_t *rrl, dns_rrl_hash_t *hash) {
+	isc_mem_put(rrl->mctx, hash,
+		    sizeof(*hash) + (hash->length - 1) * sizeof(hash->bins[0]));
+}
+
+/*
+ * Make a new hash table current.  The bins of the previous table are
+ * moved to it by move_bins().
+ */
+static void
+add_hash(dns_rrl_t *rrl, dns_rrl_shard_t *shard, dns_rrl_hash_t *hash) {
+	double rate;
+
+	INSIST(shard->old_hash == NULL);
+
+	shard->hash_gen ^= 1;
+	hash->gen = shard->hash_gen;
+
+	if (isc_log_wouldlog(dns_lctx, DNS_RRL_LOG_DROP) &&
+	    shard->hash != NULL) {
+		rate = shard->probes;
+		if (shard->searches != 0)
+			rate /= shard->searches;
 		isc_log_write(dns_lctx, DNS_LOGCATEGORY_RRL,
 			      DNS_LOGMODULE_REQUEST, DNS_RRL_LOG_DROP,
 			      "increase from %d to %d RRL bins for"
-			      " %d entries; average search length %.1f",
-			      old_bins, new_bins, rrl->num_entries, rate);
+			      " %d entries in shard %d;"
+			      " average search length %.1f",
+			      shard->hash->length, hash->length,
+			      shard->num_entries,
+			      (int)(shard - rrl->shards), rate);
 	}
 
-	rrl->old_hash = rrl->hash;
-	if (rrl->old_hash != NULL)
-		rrl->old_hash->check_time = now;
-	rrl->hash = hash;
+	shard->old_hash = shard->hash;
+	shard->migrated = 0;
+	shard->hash = hash;
+}
 
+static isc_result_t
+expand_rrl_hash(dns_rrl_t *rrl, dns_rrl_shard_t *shard) {
+	dns_rrl_hash_t *hash;
+
+	/*
+	 * Wait until the previous table is emptied.
+	 */
+	if (shard->old_hash != NULL)
+		return (ISC_R_SUCCESS);
+
+	hash = alloc_hash(rrl, (shard->hash == NULL) ? 0 : shard->hash->length,
+			  shard->num_entries);
+	if (hash == NULL)
+		return (ISC_R_NOMEMORY);
+	add_hash(rrl, shard, hash);
 	return (ISC_R_SUCCESS);
 }
 
 static void
-ref_entry(dns_rrl_t *rrl, dns_rrl_entry_t *e, int probes, isc_stdtime_t now) {
+detach_rrl(dns_rrl_t **rrlp);
+
+/*
+ * Add the entries or bins requested for a shard.  The memory is
+ * allocated and cleared before the shard is locked again.
+ */
+static void
+grow_shard(isc_task_t *task, isc_event_t *event) {
+	dns_rrl_t *rrl;
+	dns_rrl_shard_t *shard;
+	dns_rrl_block_t *b;
+	dns_rrl_hash_t *hash;
+	isc_boolean_t want_hash;
+	int new, old_bins, num_entries;
+
+	UNUSED(task);
+	REQUIRE(event->ev_type == DNS_EVENT_RRLGROW);
+
+	shard = event->ev_arg;
+	rrl = event->ev_sender;
+	isc_event_free(&event);
+
+	LOCK(&shard->lock);
+	new = 0;
+	if (shard->grow_entries && !rrl->exiting)
+		new = grow_size(rrl, shard,
+				ISC_MIN((shard->num_entries+1)/2, 1000));
+	want_hash = ISC_TF(shard->grow_hash && !rrl->exiting &&
+			   shard->old_hash == NULL);
+	old_bins = shard->hash->length;
+	num_entries = shard->num_entries + ISC_MAX(new, 0);
+	UNLOCK(&shard->lock);
+
+	b = NULL;
+	if (new > 0)
+		b = alloc_entries(rrl, new);
+	hash = NULL;
+	if (want_hash)
+		hash = alloc_hash(rrl, old_bins, num_entries);
+
+	LOCK(&shard->lock);
+	if (b != NULL)
+		add_entries(rrl, shard, b, new);
+	if (hash != NULL) {
+		if (shard->old_hash == NULL)
+			add_hash(rrl, shard, hash);
+		else
+			free_hash(rrl, hash);
+	}
+	shard->grow_entries = ISC_FALSE;
+	shard->grow_hash = ISC_FALSE;
+	shard->grow_sent = ISC_FALSE;
+	UNLOCK(&shard->lock);
+
+	detach_rrl(&rrl);
+}
+
+/*
+ * Ask for more entries or a larger hash table.  Without a task, expand
+ * the shard while the response waits.
+ */
+static void
+request_grow(dns_rrl_t *rrl, dns_rrl_shard_t *shard, isc_boolean_t entries) {
+	isc_event_t *event;
+
+	if (rrl->task == NULL) {
+		if (entries)
+			expand_entries(rrl, shard,
+				       ISC_MIN((shard->num_entries+1)/2,
+					       1000));
+		else
+			expand_rrl_hash(rrl, shard);
+		return;
+	}
+
+	if (entries) {
+		if (grow_size(rrl, shard, 1) <= 0)
+			return;
+		shard->grow_entries = ISC_TRUE;
+	} else {
+		shard->grow_hash = ISC_TRUE;
+	}
+	if (!shard->grow_sent) {
+		shard->grow_sent = ISC_TRUE;
+		isc_refcount_increment(&rrl->references, NULL);
+		event = &shard->grow;
+		isc_task_send(rrl->task, &event);
+	}
+}
+
+static void
+ref_entry(dns_rrl_t *rrl, dns_rrl_shard_t *shard, dns_rrl_entry_t *e,
+	  int probes, isc_stdtime_t now)
+{
 	/*
 	 * Make the entry most recently used.
 	 */
-	if (ISC_LIST_HEAD(rrl->lru) != e) {
-		if (e == rrl->last_logged)
-			rrl->last_logged = ISC_LIST_PREV(e, lru);
-		ISC_LIST_UNLINK(rrl->lru, e, lru);
-		ISC_LIST_PREPEND(rrl->lru, e, lru);
+	if (ISC_LIST_HEAD(shard->lru) != e) {
+		if (e == shard->last_logged)
+			shard->last_logged = ISC_LIST_PREV(e, lru);
+		ISC_LIST_UNLINK(shard->lru, e, lru);
+		ISC_LIST_PREPEND(shard->lru, e, lru);
 	}
 
 	/*
 	 * Expand the hash table if it is time and necessary.
 	 * This will leave the newly referenced entry in a chain in the
 	 * old hash table.  It will migrate to the new hash table the next
-	 * time it is used or be cut loose when the old hash table is destroyed.
+	 * time it is used or when move_bins() reaches its bin.
 	 */
-	rrl->probes += probes;
-	++rrl->searches;
-	if (rrl->searches > 100 &&
-	    delta_rrl_time(rrl->hash->check_time, now) > 1) {
-		if (rrl->probes/rrl->searches > 2)
-			expand_rrl_hash(rrl, now);
-		rrl->hash->check_time = now;
-		rrl->probes = 0;
-		rrl->searches = 0;
+	shard->probes += probes;
+	++shard->searches;
+	if (shard->searches > 100 &&
+	    delta_rrl_time(shard->hash->check_time, now) > 1) {
+		if (shard->probes/shard->searches > 2)
+			request_grow(rrl, shard, ISC_FALSE);
+		shard->hash->check_time = now;
+		shard->probes = 0;
+		shard->searches = 0;
 	}
 }
 
@@ -381,6 +539,32 @@ hash_key(const dns_rrl_key_t *key) {
 	return (hval);
 }
 
+/*
+ * Move a few bins of the previous hash table to the current one, so the
+ * previous table is emptied bit by bit and can then be freed.
+ */
+#define DNS_RRL_MOVE_BINS	2
+static void
+move_bins(dns_rrl_t *rrl, dns_rrl_shard_t *shard) {
+	dns_rrl_bin_t *old_bin, *new_bin;
+	dns_rrl_entry_t *e;
+	int i;
+
+	for (i = 0; i < DNS_RRL_MOVE_BINS && shard->old_hash != NULL; ++i) {
+		old_bin = &shard->old_hash->bins[shard->migrated];
+		while ((e = ISC_LIST_HEAD(*old_bin)) != NULL) {
+			ISC_LIST_UNLINK(*old_bin, e, hlink);
+			new_bin = get_bin(shard->hash, hash_key(&e->key));
+			ISC_LIST_APPEND(*new_bin, e, hlink);
+			e->hash_gen = shard->hash_gen;
+		}
+		if (++shard->migrated == shard->old_hash->length) {
+			free_hash(rrl, shard->old_hash);
+			shard->old_hash = NULL;
+		}
+	}
+}
+
 /*
  * Construct the hash table key.
  * Use a hash of the DNS query name to save space in the database.
@@ -447,6 +631,22 @@ make_key(const dns_rrl_t *rrl, dns_rrl_key_t *key,
 	}
 }
 
+/*
+ * Find the shard of an entry by the hash of its whole key, so the
+ * responses to one client for different names and response types are
+ * spread over the shards.  The bins use the low bits of the same hash.
+ */
+static dns_rrl_shard_t *
+get_shard(const dns_rrl_t *rrl, const dns_rrl_key_t *key) {
+	isc_uint32_t hval;
+
+	if (rrl->num_shards == 1)
+		return (&rrl->shards[0]);
+
+	hval = hash_key(key) * 0x9e3779b1U;
+	return (&rrl->shards[(hval >> 16) % rrl->num_shards]);
+}
+
 static inline dns_rrl_rate_t *
 get_rate(dns_rrl_t *rrl, dns_rrl_rtype_t rtype) {
 	switch (rtype) {
@@ -489,31 +689,31 @@ response_balance(dns_rrl_t *rrl, const dns_rrl_entry_t *e, int age) {
 /*
  * Search for an entry for a response and optionally create it.
  */
+#define DNS_RRL_MAX_SCAN	16
 static dns_rrl_entry_t *
-get_entry(dns_rrl_t *rrl, const isc_sockaddr_t *client_addr,
-	  dns_rdataclass_t qclass, dns_rdatatype_t qtype, dns_name_t *qname,
-	  dns_rrl_rtype_t rtype, isc_stdtime_t now, isc_boolean_t create,
+get_entry(dns_rrl_t *rrl, dns_rrl_shard_t *shard, const dns_rrl_key_t *key,
+	  isc_stdtime_t now, isc_boolean_t create,
 	  char *log_buf, unsigned int log_buf_len)
 {
-	dns_rrl_key_t key;
 	isc_uint32_t hval;
-	dns_rrl_entry_t *e;
+	dns_rrl_entry_t *e, *oldest;
 	dns_rrl_hash_t *hash;
 	dns_rrl_bin_t *new_bin, *old_bin;
-	int probes, age;
+	int probes, age, scanned;
 
-	make_key(rrl, &key, client_addr, qtype, qname, qclass, rtype);
-	hval = hash_key(&key);
+	move_bins(rrl, shard);
+
+	hval = hash_key(key);
 
 	/*
 	 * Look for the entry in the current hash table.
 	 */
-	new_bin = get_bin(rrl->hash, hval);
+	new_bin = get_bin(shard->hash, hval);
 	probes = 1;
 	e = ISC_LIST_HEAD(*new_bin);
 	while (e != NULL) {
-		if (key_cmp(&e->key, &key)) {
-			ref_entry(rrl, e, probes, now);
+		if (key_cmp(&e->key, key)) {
+			ref_entry(rrl, shard, e, probes, now);
 			return (e);
 		}
 		++probes;
@@ -523,26 +723,19 @@ get_entry(dns_rrl_t *rrl, const isc_sockaddr_t *client_addr,
 	/*
 	 * Look in the old hash table.
 	 */
-	if (rrl->old_hash != NULL) {
-		old_bin = get_bin(rrl->old_hash, hval);
+	if (shard->old_hash != NULL) {
+		old_bin = get_bin(shard->old_hash, hval);
 		e = ISC_LIST_HEAD(*old_bin);
 		while (e != NULL) {
-			if (key_cmp(&e->key, &key)) {
+			if (key_cmp(&e->key, key)) {
 				ISC_LIST_UNLINK(*old_bin, e, hlink);
 				ISC_LIST_PREPEND(*new_bin, e, hlink);
-				e->hash_gen = rrl->hash_gen;
-				ref_entry(rrl, e, probes, now);
+				e->hash_gen = shard->hash_gen;
+				ref_entry(rrl, shard, e, probes, now);
 				return (e);
 			}
 			e = ISC_LIST_NEXT(e, hlink);
 		}
-
-		/*
-		 * Discard prevous hash table when all of its entries are old.
-		 */
-		age = delta_rrl_time(rrl->old_hash->check_time, now);
-		if (age > rrl->window)
-			free_old_hash(rrl);
 	}
 
 	if (!create)
@@ -550,18 +743,22 @@ get_entry(dns_rrl_t *rrl, const isc_sockaddr_t *client_addr,
 
 	/*
 	 * The entry does not exist, so create it by finding a free entry.
-	 * Keep currently penalized and logged entries.
+	 * Keep currently penalized and logged entries, but do not look
+	 * at more than a few of them.
 	 * Try to make more entries if none are idle.
-	 * Steal the oldest entry if we cannot create more.
+	 * Steal the oldest entry if we cannot create more right now,
+	 * but do not reset the limit of a client being limited while
+	 * the shard may still grow: expand it at once instead of
+	 * waiting for the task.
 	 */
-	for (e = ISC_LIST_TAIL(rrl->lru);
+	for (e = ISC_LIST_TAIL(shard->lru), scanned = 0;
 	     e != NULL;
 	     e = ISC_LIST_PREV(e, lru))
 	{
 		if (!ISC_LINK_LINKED(e, hlink))
 			break;
-		age = get_age(rrl, e, now);
-		if (age <= 1) {
+		age = get_age(shard, e, now);
+		if (age <= 1 || ++scanned > DNS_RRL_MAX_SCAN) {
 			e = NULL;
 			break;
 		}
@@ -569,24 +766,45 @@ get_entry(dns_rrl_t *rrl, const isc_sockaddr_t *client_addr,
 			break;
 	}
 	if (e == NULL) {
-		expand_entries(rrl, ISC_MIN((rrl->num_entries+1)/2, 1000));
-		e = ISC_LIST_TAIL(rrl->lru);
+		request_grow(rrl, shard, ISC_TRUE);
+		e = ISC_LIST_TAIL(shard->lru);
+		if (rrl->task != NULL && ISC_LINK_LINKED(e, hlink) &&
+		    (e->logged ||
+		     response_balance(rrl, e, get_age(shard, e, now)) <= 0) &&
+		    expand_entries(rrl, shard,
+				   ISC_MIN((shard->num_entries+1)/2,
+					   1000)) == ISC_R_SUCCESS)
+			e = ISC_LIST_TAIL(shard->lru);
+	} else if (rrl->task != NULL && shard->free_head != NULL &&
+		   shard->num_free <= shard->num_entries / 8) {
+		/*
+		 * Ask for more entries before the free entries are gone
+		 * if the oldest used entry is still busy.
+		 */
+		oldest = ISC_LIST_PREV(shard->free_head, lru);
+		if (oldest != NULL && get_age(shard, oldest, now) <= 1)
+			request_grow(rrl, shard, ISC_TRUE);
+	}
+	if (!ISC_LINK_LINKED(e, hlink)) {
+		if (e == shard->free_head)
+			shard->free_head = NULL;
+		--shard->num_free;
 	}
 	if (e->logged)
-		log_end(rrl, e, ISC_TRUE, log_buf, log_buf_len);
+		log_end(rrl, shard, e, ISC_TRUE, log_buf, log_buf_len);
 	if (ISC_LINK_LINKED(e, hlink)) {
-		if (e->hash_gen == rrl->hash_gen)
-			hash = rrl->hash;
+		if (e->hash_gen == shard->hash_gen)
+			hash = shard->hash;
 		else
-			hash = rrl->old_hash;
+			hash = shard->old_hash;
 		old_bin = get_bin(hash, hash_key(&e->key));
 		ISC_LIST_UNLINK(*old_bin, e, hlink);
 	}
 	ISC_LIST_PREPEND(*new_bin, e, hlink);
-	e->hash_gen = rrl->hash_gen;
-	e->key = key;
+	e->hash_gen = shard->hash_gen;
+	e->key = *key;
 	e->ts_valid = ISC_FALSE;
-	ref_entry(rrl, e, probes, now);
+	ref_entry(rrl, shard, e, probes, now);
 	return (e);
 }
 
@@ -608,13 +826,12 @@ debit_log(const dns_rrl_entry_t *e, int age, const char *action) {
 }
 
 static inline dns_rrl_result_t
-debit_rrl_entry(dns_rrl_t *rrl, dns_rrl_entry_t *e, double qps, double scale,
-		const isc_sockaddr_t *client_addr, isc_stdtime_t now,
-		char *log_buf, unsigned int log_buf_len)
+debit_rrl_entry(dns_rrl_t *rrl, dns_rrl_shard_t *shard, dns_rrl_entry_t *e,
+		double qps, double scale, isc_boolean_t tcp_credit,
+		isc_stdtime_t now)
 {
 	int rate, new_rate, slip, new_slip, age, log_secs, min;
 	dns_rrl_rate_t *ratep;
-	dns_rrl_entry_t const *credit_e;
 
 	/*
 	 * Pick the rate counter.
@@ -625,35 +842,33 @@ debit_rrl_entry(dns_rrl_t *rrl, dns_rrl_entry_t *e, double qps, double scale,
 	if (rate == 0)
 		return (DNS_RRL_RESULT_OK);
 
-	if (scale < 1.0) {
+	if (scale < 1.0 && tcp_credit) {
 		/*
 		 * The limit for clients that have used TCP is not scaled.
 		 */
-		credit_e = get_entry(rrl, client_addr,
-				     0, dns_rdatatype_none, NULL,
-				     DNS_RRL_RTYPE_TCP, now, ISC_FALSE,
-				     log_buf, log_buf_len);
-		if (credit_e != NULL) {
-			age = get_age(rrl, e, now);
-			if (age < rrl->window)
-				scale = 1.0;
-		}
+		age = get_age(shard, e, now);
+		if (age < rrl->window)
+			scale = 1.0;
 	}
 	if (scale < 1.0) {
 		new_rate = (int) (rate * scale);
 		if (new_rate < 1)
 			new_rate = 1;
 		if (ratep->scaled != new_rate) {
-			isc_log_write(dns_lctx, DNS_LOGCATEGORY_RRL,
-				      DNS_LOGMODULE_REQUEST,
-				      DNS_RRL_LOG_DEBUG1,
-				      "%d qps scaled %s by %.2f"
-				      " from %d to %d",
-				      (int)qps, ratep->str, scale,
-				      rate, new_rate);
-			rate = new_rate;
-			ratep->scaled = rate;
+			LOCK(&rrl->lock);
+			if (ratep->scaled != new_rate) {
+				isc_log_write(dns_lctx, DNS_LOGCATEGORY_RRL,
+					      DNS_LOGMODULE_REQUEST,
+					      DNS_RRL_LOG_DEBUG1,
+					      "%d qps scaled %s by %.2f"
+					      " from %d to %d",
+					      (int)qps, ratep->str, scale,
+					      rate, new_rate);
+				ratep->scaled = new_rate;
+			}
+			UNLOCK(&rrl->lock);
 		}
+		rate = new_rate;
 	}
 
 	min = -rrl->window * rate;
@@ -663,7 +878,7 @@ debit_rrl_entry(dns_rrl_t *rrl, dns_rrl_entry_t *e, double qps, double scale,
 	 * Treat entries older than the window as if they were just created
 	 * Credit other entries.
 	 */
-	age = get_age(rrl, e, now);
+	age = get_age(shard, e, now);
 	if (age > 0) {
 		/*
 		 * Credit tokens earned during elapsed time.
@@ -694,7 +909,7 @@ debit_rrl_entry(dns_rrl_t *rrl, dns_rrl_entry_t *e, double qps, double scale,
 			e->log_secs = log_secs;
 		}
 	}
-	set_age(rrl, e, now);
+	set_age(shard, e, now);
 
 	/*
 	 * Debit the entry for this response.
@@ -717,16 +932,20 @@ debit_rrl_entry(dns_rrl_t *rrl, dns_rrl_entry_t *e, double qps, double scale,
 		if (new_slip < 2)
 			new_slip = 2;
 		if (rrl->slip.scaled != new_slip) {
-			isc_log_write(dns_lctx, DNS_LOGCATEGORY_RRL,
-				      DNS_LOGMODULE_REQUEST,
-				      DNS_RRL_LOG_DEBUG1,
-				      "%d qps scaled slip"
-				      " by %.2f from %d to %d",
-				      (int)qps, scale,
-				      slip, new_slip);
-			slip = new_slip;
-			rrl->slip.scaled = slip;
+			LOCK(&rrl->lock);
+			if (rrl->slip.scaled != new_slip) {
+				isc_log_write(dns_lctx, DNS_LOGCATEGORY_RRL,
+					      DNS_LOGMODULE_REQUEST,
+					      DNS_RRL_LOG_DEBUG1,
+					      "%d qps scaled slip"
+					      " by %.2f from %d to %d",
+					      (int)qps, scale,
+					      slip, new_slip);
+				rrl->slip.scaled = new_slip;
+			}
+			UNLOCK(&rrl->lock);
 		}
+		slip = new_slip;
 	}
 	if (slip != 0 && e->key.s.rtype != DNS_RRL_RTYPE_ALL) {
 		if (e->slip_cnt++ == 0) {
@@ -746,23 +965,23 @@ debit_rrl_entry(dns_rrl_t *rrl, dns_rrl_entry_t *e, double qps, double scale,
 }
 
 static inline dns_rrl_qname_buf_t *
-get_qname(dns_rrl_t *rrl, const dns_rrl_entry_t *e) {
+get_qname(dns_rrl_shard_t *shard, const dns_rrl_entry_t *e) {
 	dns_rrl_qname_buf_t *qbuf;
 
-	qbuf = rrl->qnames[e->log_qname];
+	qbuf = shard->qnames[e->log_qname];
 	if (qbuf == NULL || qbuf->e != e)
 		return (NULL);
 	return (qbuf);
 }
 
 static inline void
-free_qname(dns_rrl_t *rrl, dns_rrl_entry_t *e) {
+free_qname(dns_rrl_shard_t *shard, dns_rrl_entry_t *e) {
 	dns_rrl_qname_buf_t *qbuf;
 
-	qbuf = get_qname(rrl, e);
+	qbuf = get_qname(shard, e);
 	if (qbuf != NULL) {
 		qbuf->e = NULL;
-		ISC_LIST_APPEND(rrl->qname_free, qbuf, link);
+		ISC_LIST_APPEND(shard->qname_free, qbuf, link);
 	}
 }
 
@@ -786,7 +1005,7 @@ add_log_str(isc_buffer_t *lb, const char *str, unsigned int str_len) {
  * Build strings for the logs
  */
 static void
-make_log_buf(dns_rrl_t *rrl, dns_rrl_entry_t *e,
+make_log_buf(dns_rrl_t *rrl, dns_rrl_shard_t *shard, dns_rrl_entry_t *e,
 	     const char *str1, const char *str2, isc_boolean_t plural,
 	     dns_name_t *qname, isc_boolean_t save_qname,
 	     dns_rrl_result_t rrl_result, isc_result_t resp_result,
@@ -878,22 +1097,23 @@ make_log_buf(dns_rrl_t *rrl, dns_rrl_entry_t *e,
 	    e->key.s.rtype == DNS_RRL_RTYPE_REFERRAL ||
 	    e->key.s.rtype == DNS_RRL_RTYPE_NODATA ||
 	    e->key.s.rtype == DNS_RRL_RTYPE_NXDOMAIN) {
-		qbuf = get_qname(rrl, e);
+		qbuf = get_qname(shard, e);
 		if (save_qname && qbuf == NULL &&
 		    qname != NULL && dns_name_isabsolute(qname)) {
 			/*
 			 * Capture the qname for the "stop limiting" message.
 			 */
-			qbuf = ISC_LIST_TAIL(rrl->qname_free);
+			qbuf = ISC_LIST_TAIL(shard->qname_free);
 			if (qbuf != NULL) {
-				ISC_LIST_UNLINK(rrl->qname_free, qbuf, link);
-			} else if (rrl->num_qnames < DNS_RRL_QNAMES) {
+				ISC_LIST_UNLINK(shard->qname_free, qbuf, link);
+			} else if (shard->num_qnames < DNS_RRL_QNAMES) {
 				qbuf = isc_mem_get(rrl->mctx, sizeof(*qbuf));
 				if (qbuf != NULL) {
 					memset(qbuf, 0, sizeof(*qbuf));
 					ISC_LINK_INIT(qbuf, link);
-					qbuf->index = rrl->num_qnames;
-					rrl->qnames[rrl->num_qnames++] = qbuf;
+					qbuf->index = shard->num_qnames;
+					shard->qnames[shard->num_qnames++] =
+						qbuf;
 				} else {
 					isc_log_write(dns_lctx,
 						      DNS_LOGCATEGORY_RRL,
@@ -941,11 +1161,11 @@ make_log_buf(dns_rrl_t *rrl, dns_rrl_entry_t *e,
 }
 
 static void
-log_end(dns_rrl_t *rrl, dns_rrl_entry_t *e, isc_boolean_t early,
-	char *log_buf, unsigned int log_buf_len)
+log_end(dns_rrl_t *rrl, dns_rrl_shard_t *shard, dns_rrl_entry_t *e,
+	isc_boolean_t early, char *log_buf, unsigned int log_buf_len)
 {
 	if (e->logged) {
-		make_log_buf(rrl, e,
+		make_log_buf(rrl, shard, e,
 			     early ? "*" : NULL,
 			     rrl->log_only ? "would stop limiting "
 					   : "stop limiting ",
@@ -955,53 +1175,87 @@ log_end(dns_rrl_t *rrl, dns_rrl_entry_t *e, isc_boolean_t early,
 		isc_log_write(dns_lctx, DNS_LOGCATEGORY_RRL,
 			      DNS_LOGMODULE_REQUEST, DNS_RRL_LOG_DROP,
 			      "%s", log_buf);
-		free_qname(rrl, e);
+		free_qname(shard, e);
 		e->logged = ISC_FALSE;
-		--rrl->num_logged;
+		--shard->num_logged;
 	}
 }
 
 /*
- * Log messages for streams that have stopped being rate limited.
+ * Log messages for streams of a shard that have stopped being rate limited.
+ * Only the shard of the current response is visited, so the other shards
+ * are not held up.
  */
 static void
-log_stops(dns_rrl_t *rrl, isc_stdtime_t now, int limit,
-	  char *log_buf, unsigned int log_buf_len)
+log_stops(dns_rrl_t *rrl, dns_rrl_shard_t *shard, isc_stdtime_t now,
+	  int limit, char *log_buf, unsigned int log_buf_len)
 {
 	dns_rrl_entry_t *e;
 	int age;
 
-	for (e = rrl->last_logged; e != NULL; e = ISC_LIST_PREV(e, lru)) {
+	for (e = shard->last_logged; e != NULL; e = ISC_LIST_PREV(e, lru)) {
 		if (!e->logged)
 			continue;
 		if (now != 0) {
-			age = get_age(rrl, e, now);
+			age = get_age(shard, e, now);
 			if (age < DNS_RRL_STOP_LOG_SECS ||
 			    response_balance(rrl, e, age) < 0)
 				break;
 		}
 
-		log_end(rrl, e, now == 0, log_buf, log_buf_len);
-		if (rrl->num_logged <= 0)
+		log_end(rrl, shard, e, now == 0, log_buf, log_buf_len);
+		if (shard->num_logged <= 0)
 			break;
 
 		/*
 		 * Too many messages could stall real work.
 		 */
 		if (--limit < 0) {
-			rrl->last_logged = ISC_LIST_PREV(e, lru);
+			shard->last_logged = ISC_LIST_PREV(e, lru);
 			return;
 		}
 	}
 	if (e == NULL) {
-		INSIST(rrl->num_logged == 0);
-		rrl->log_stops_time = now;
+		INSIST(shard->num_logged == 0);
+		shard->log_stops_time = now;
 	}
-	rrl->last_logged = e;
+	shard->last_logged = e;
+}
+
+/*
+ * Lock the shard of the entry for a response and find the entry,
+ * optionally creating it.  The shard is returned locked in '*shardp',
+ * even if there is no entry.  The stopped streams of the shard are
+ * logged once per second.
+ */
+static dns_rrl_entry_t *
+lock_entry(dns_rrl_t *rrl, dns_rrl_shard_t **shardp,
+	   const isc_sockaddr_t *client_addr,
+	   dns_rdataclass_t qclass, dns_rdatatype_t qtype, dns_name_t *qname,
+	   dns_rrl_rtype_t rtype, isc_stdtime_t now, isc_boolean_t create,
+	   char *log_buf, unsigned int log_buf_len)
+{
+	dns_rrl_key_t key;
+	dns_rrl_shard_t *shard;
+
+	make_key(rrl, &key, client_addr, qtype, qname, qclass, rtype);
+	shard = get_shard(rrl, &key);
+	LOCK(&shard->lock);
+	*shardp = shard;
+
+	if (shard->num_logged > 0 && shard->log_stops_time != now)
+		log_stops(rrl, shard, now, 8, log_buf, log_buf_len);
+
+	return (get_entry(rrl, shard, &key, now, create,
+			  log_buf, log_buf_len));
 }
 
 /*
  * Main rate limit interface.
+ *
+ * The entry of the response, the TCP credit and the all-per-second
+ * entry of the client are usually in different shards.  Only one shard
+ * is locked at a time, so there is no lock order between them.
  */
 dns_rrl_result_t
 dns_rrl(dns_view_t *view,
@@ -1011,12 +1265,14 @@ dns_rrl(dns_view_t *view,
 	isc_boolean_t wouldlog, char *log_buf, unsigned int log_buf_len)
 {
 	dns_rrl_t *rrl;
+	dns_rrl_shard_t *shard;
 	dns_rrl_rtype_t rtype;
 	dns_rrl_entry_t *e;
 	isc_netaddr_t netclient;
 	int secs;
 	double qps, scale;
 	int exempt_match;
+	isc_boolean_t tcp_credit;
 	isc_result_t result;
 	dns_rrl_result_t rrl_result;
 
@@ -1031,8 +1287,6 @@ dns_rrl(dns_view_t *view,
 			return (DNS_RRL_RESULT_OK);
 	}
 
-	LOCK(&rrl->lock);
-
 	/*
 	 * Estimate total query per second rate when scaling by qps.
 	 */
@@ -1040,6 +1294,7 @@ dns_rrl(dns_view_t *view,
 		qps = 0.0;
 		scale = 1.0;
 	} else {
+		LOCK(&rrl->lock);
 		++rrl->qps_responses;
 		secs = delta_rrl_time(rrl->qps_time, now);
 		if (secs <= 0) {
@@ -1064,34 +1319,43 @@ dns_rrl(dns_view_t *view,
 				qps = rrl->qps;
 			}
 		}
+		UNLOCK(&rrl->lock);
 		scale = rrl->qps_scale / qps;
 	}
 
-	/*
-	 * Do maintenance once per second.
-	 */
-	if (rrl->num_logged > 0 && rrl->log_stops_time != now)
-		log_stops(rrl, now, 8, log_buf, log_buf_len);
-
 	/*
 	 * Notice TCP responses when scaling limits by qps.
 	 * Do not try to rate limit TCP responses.
 	 */
 	if (is_tcp) {
 		if (scale < 1.0) {
-			e = get_entry(rrl, client_addr,
-				      0, dns_rdatatype_none, NULL,
-				      DNS_RRL_RTYPE_TCP, now, ISC_TRUE,
-				      log_buf, log_buf_len);
+			e = lock_entry(rrl, &shard, client_addr,
+				       0, dns_rdatatype_none, NULL,
+				       DNS_RRL_RTYPE_TCP, now, ISC_TRUE,
+				       log_buf, log_buf_len);
 			if (e != NULL) {
 				e->responses = -(rrl->window+1);
-				set_age(rrl, e, now);
+				set_age(shard, e, now);
 			}
+			UNLOCK(&shard->lock);
 		}
-		UNLOCK(&rrl->lock);
 		return (ISC_R_SUCCESS);
 	}
 
+	/*
+	 * Look for the TCP credit of the client before its other entries
+	 * are locked.
+	 */
+	tcp_credit = ISC_FALSE;
+	if (scale < 1.0) {
+		e = lock_entry(rrl, &shard, client_addr,
+			       0, dns_rdatatype_none, NULL,
+			       DNS_RRL_RTYPE_TCP, now, ISC_FALSE,
+			       log_buf, log_buf_len);
+		tcp_credit = ISC_TF(e != NULL);
+		UNLOCK(&shard->lock);
+	}
+
 	/*
 	 * Find the right kind of entry, creating it if necessary.
 	 * If that is impossible, then nothing more can be done
@@ -1113,10 +1377,10 @@ dns_rrl(dns_view_t *view,
 		rtype = DNS_RRL_RTYPE_ERROR;
 		break;
 	}
-	e = get_entry(rrl, client_addr, qclass, qtype, qname, rtype,
-		      now, ISC_TRUE, log_buf, log_buf_len);
+	e = lock_entry(rrl, &shard, client_addr, qclass, qtype, qname, rtype,
+		       now, ISC_TRUE, log_buf, log_buf_len);
 	if (e == NULL) {
-		UNLOCK(&rrl->lock);
+		UNLOCK(&shard->lock);
 		return (DNS_RRL_RESULT_OK);
 	}
 
@@ -1125,7 +1389,8 @@ dns_rrl(dns_view_t *view,
 		 * Do not worry about speed or releasing the lock.
 		 * This message appears before messages from debit_rrl_entry().
 		 */
-		make_log_buf(rrl, e, "consider limiting ", NULL, ISC_FALSE,
+		make_log_buf(rrl, shard, e, "consider limiting ", NULL,
+			     ISC_FALSE,
 			     qname, ISC_FALSE, DNS_RRL_RESULT_OK, resp_result,
 			     log_buf, log_buf_len);
 		isc_log_write(dns_lctx, DNS_LOGCATEGORY_RRL,
@@ -1133,8 +1398,8 @@ dns_rrl(dns_view_t *view,
 			      "%s", log_buf);
 	}
 
-	rrl_result = debit_rrl_entry(rrl, e, qps, scale, client_addr, now,
-				     log_buf, log_buf_len);
+	rrl_result = debit_rrl_entry(rrl, shard, e, qps, scale, tcp_credit,
+				     now);
 
 	if (rrl->all_per_second.r != 0) {
 		/*
@@ -1144,24 +1409,40 @@ dns_rrl(dns_view_t *view,
 		 * when both limits are hit.
 		 * The response limiting must continue if the
 		 * all-per-second limiting lapses.
+		 * The response entry is released while the all-per-second
+		 * entry is locked, and found again for the log messages
+		 * if only the response is limited.
 		 */
 		dns_rrl_entry_t *e_all;
+		dns_rrl_shard_t *shard_all;
 		dns_rrl_result_t rrl_all_result;
 
-		e_all = get_entry(rrl, client_addr,
-				  0, dns_rdatatype_none, NULL,
-				  DNS_RRL_RTYPE_ALL, now, ISC_TRUE,
-				  log_buf, log_buf_len);
+		UNLOCK(&shard->lock);
+		e_all = lock_entry(rrl, &shard_all, client_addr,
+				   0, dns_rdatatype_none, NULL,
+				   DNS_RRL_RTYPE_ALL, now, ISC_TRUE,
+				   log_buf, log_buf_len);
 		if (e_all == NULL) {
-			UNLOCK(&rrl->lock);
+			UNLOCK(&shard_all->lock);
 			return (DNS_RRL_RESULT_OK);
 		}
-		rrl_all_result = debit_rrl_entry(rrl, e_all, qps, scale,
-						 client_addr, now,
-						 log_buf, log_buf_len);
-		if (rrl_all_result != DNS_RRL_RESULT_OK) {
+		rrl_all_result = debit_rrl_entry(rrl, shard_all, e_all, qps,
+						 scale, tcp_credit, now);
+		if (rrl_all_result == DNS_RRL_RESULT_OK) {
+			UNLOCK(&shard_all->lock);
+			if (rrl_result == DNS_RRL_RESULT_OK)
+				return (DNS_RRL_RESULT_OK);
+			e = lock_entry(rrl, &shard, client_addr, qclass,
+				       qtype, qname, rtype, now, ISC_TRUE,
+				       log_buf, log_buf_len);
+			if (e == NULL) {
+				UNLOCK(&shard->lock);
+				return (rrl_result);
+			}
+		} else {
 			int level;
 
+			shard = shard_all;
 			e = e_all;
 			rrl_result = rrl_all_result;
 			if (rrl_result == DNS_RRL_RESULT_OK)
@@ -1169,7 +1450,7 @@ dns_rrl(dns_view_t *view,
 			else
 				level = DNS_RRL_LOG_DEBUG1;
 			if (isc_log_wouldlog(dns_lctx, level)) {
-				make_log_buf(rrl, e,
+				make_log_buf(rrl, shard, e,
 					     "prefer all-per-second limiting ",
 					     NULL, ISC_TRUE, qname, ISC_FALSE,
 					     DNS_RRL_RESULT_OK, resp_result,
@@ -1182,7 +1463,7 @@ dns_rrl(dns_view_t *view,
 	}
 
 	if (rrl_result == DNS_RRL_RESULT_OK) {
-		UNLOCK(&rrl->lock);
+		UNLOCK(&shard->lock);
 		return (DNS_RRL_RESULT_OK);
 	}
 
@@ -1191,15 +1472,15 @@ dns_rrl(dns_view_t *view,
 	 */
 	if ((!e->logged || e->log_secs >= DNS_RRL_MAX_LOG_SECS) &&
 	    isc_log_wouldlog(dns_lctx, DNS_RRL_LOG_DROP)) {
-		make_log_buf(rrl, e, rrl->log_only ? "would " : NULL,
+		make_log_buf(rrl, shard, e, rrl->log_only ? "would " : NULL,
 			     e->logged ? "continue limiting " : "limit ",
 			     ISC_TRUE, qname, ISC_TRUE,
 			     DNS_RRL_RESULT_OK, resp_result,
 			     log_buf, log_buf_len);
 		if (!e->logged) {
 			e->logged = ISC_TRUE;
-			if (++rrl->num_logged <= 1)
-				rrl->last_logged = e;
+			if (++shard->num_logged <= 1)
+				shard->last_logged = e;
 		}
 		e->log_secs = 0;
 
@@ -1207,7 +1488,7 @@ dns_rrl(dns_view_t *view,
 		 * Avoid holding the lock.
 		 */
 		if (!wouldlog) {
-			UNLOCK(&rrl->lock);
+			UNLOCK(&shard->lock);
 			e = NULL;
 		}
 		isc_log_write(dns_lctx, DNS_LOGCATEGORY_RRL,
@@ -1219,7 +1500,7 @@ dns_rrl(dns_view_t *view,
 	 * Make a log message for the caller.
 	 */
 	if (wouldlog)
-		make_log_buf(rrl, e,
+		make_log_buf(rrl, shard, e,
 			     rrl->log_only ? "would rate limit " : "rate limit ",
 			     NULL, ISC_FALSE, qname, ISC_FALSE,
 			     rrl_result, resp_result, log_buf, log_buf_len);
@@ -1230,70 +1511,127 @@ dns_rrl(dns_view_t *view,
 		 * the ending log message.
 		 */
 		if (!e->logged)
-			free_qname(rrl, e);
-		UNLOCK(&rrl->lock);
+			free_qname(shard, e);
+		UNLOCK(&shard->lock);
 	}
 
 	return (rrl_result);
 }
 
-void
-dns_rrl_view_destroy(dns_view_t *view) {
-	dns_rrl_t *rrl;
+static void
+free_shard(dns_rrl_t *rrl, dns_rrl_shard_t *shard) {
 	dns_rrl_block_t *b;
-	dns_rrl_hash_t *h;
 	char log_buf[DNS_RRL_LOG_BUF_LEN];
 	int i;
 
-	rrl = view->rrl;
-	if (rrl == NULL)
-		return;
-	view->rrl = NULL;
-
-	/*
-	 * Assume the caller takes care of locking the view and anything else.
-	 */
-
-	if (rrl->num_logged > 0)
-		log_stops(rrl, 0, ISC_INT32_MAX, log_buf, sizeof(log_buf));
+	if (shard->num_logged > 0)
+		log_stops(rrl, shard, 0, ISC_INT32_MAX,
+			  log_buf, sizeof(log_buf));
 
 	for (i = 0; i < DNS_RRL_QNAMES; ++i) {
-		if (rrl->qnames[i] == NULL)
+		if (shard->qnames[i] == NULL)
 			break;
-		isc_mem_put(rrl->mctx, rrl->qnames[i], sizeof(*rrl->qnames[i]));
+		isc_mem_put(rrl->mctx, shard->qnames[i],
+			    sizeof(*shard->qnames[i]));
 	}
 
+	DESTROYLOCK(&shard->lock);
+
+	while (!ISC_LIST_EMPTY(shard->blocks)) {
+		b = ISC_LIST_HEAD(shard->blocks);
+		ISC_LIST_UNLINK(shard->blocks, b, link);
+		isc_mem_put(rrl->mctx, b, b->size);
+	}
+
+	if (shard->hash != NULL)
+		free_hash(rrl, shard->hash);
+	if (shard->old_hash != NULL)
+		free_hash(rrl, shard->old_hash);
+}
+
+static void
+free_rrl(dns_rrl_t *rrl) {
+	int i;
+
+	for (i = 0; i < rrl->num_shards; ++i)
+		free_shard(rrl, &rrl->shards[i]);
+	isc_mem_put(rrl->mctx, rrl->shards,
+		    rrl->num_shards * sizeof(*rrl->shards));
+
 	if (rrl->exempt != NULL)
 		dns_acl_detach(&rrl->exempt);
 
+	if (rrl->task != NULL)
+		isc_task_detach(&rrl->task);
+
 	DESTROYLOCK(&rrl->lock);
+	isc_refcount_destroy(&rrl->references);
 
-	while (!ISC_LIST_EMPTY(rrl->blocks)) {
-		b = ISC_LIST_HEAD(rrl->blocks);
-		ISC_LIST_UNLINK(rrl->blocks, b, link);
-		isc_mem_put(rrl->mctx, b, b->size);
-	}
+	isc_mem_putanddetach(&rrl->mctx, rrl, sizeof(*rrl));
+}
 
-	h = rrl->hash;
-	if (h != NULL)
-		isc_mem_put(rrl->mctx, h,
-			    sizeof(*h) + (h->length - 1) * sizeof(h->bins[0]));
+static void
+detach_rrl(dns_rrl_t **rrlp) {
+	dns_rrl_t *rrl;
+	unsigned int refs;
 
-	h = rrl->old_hash;
-	if (h != NULL)
-		isc_mem_put(rrl->mctx, h,
-			    sizeof(*h) + (h->length - 1) * sizeof(h->bins[0]));
+	rrl = *rrlp;
+	*rrlp = NULL;
+	isc_refcount_decrement(&rrl->references, &refs);
+	if (refs == 0)
+		free_rrl(rrl);
+}
 
-	isc_mem_putanddetach(&rrl->mctx, rrl, sizeof(*rrl));
+/*
+ * The database is freed when the last pending 'grow' event is done.
+ */
+void
+dns_rrl_view_destroy(dns_view_t *view) {
+	dns_rrl_t *rrl;
+	int i;
+
+	rrl = view->rrl;
+	if (rrl == NULL)
+		return;
+	view->rrl = NULL;
+
+	/*
+	 * Assume the caller takes care of locking the view and anything else.
+	 */
+
+	for (i = 0; i < rrl->num_shards; ++i) {
+		LOCK(&rrl->shards[i].lock);
+		rrl->exiting = ISC_TRUE;
+		UNLOCK(&rrl->shards[i].lock);
+	}
+	detach_rrl(&rrl);
+}
+
+void
+dns_rrl_settask(dns_rrl_t *rrl, isc_task_t *task) {
+	REQUIRE(rrl != NULL && rrl->task == NULL);
+
+	isc_task_attach(task, &rrl->task);
 }
 
 isc_result_t
-dns_rrl_init(dns_rrl_t **rrlp, dns_view_t *view, int min_entries) {
+dns_rrl_init(dns_rrl_t **rrlp, dns_view_t *view, int min_entries,
+	     int num_shards)
+{
 	dns_rrl_t *rrl;
+	dns_rrl_shard_t *shard;
 	isc_result_t result;
+	int i;
 
 	*rrlp = NULL;
 
+	if (num_shards > min_entries)
+		num_shards = min_entries;
+	if (num_shards > DNS_RRL_MAX_SHARDS)
+		num_shards = DNS_RRL_MAX_SHARDS;
+	if (num_shards < 1)
+		num_shards = 1;
+
 	rrl = isc_mem_get(view->mctx, sizeof(*rrl));
 	if (rrl == NULL)
 		return (ISC_R_NOMEMORY);
@@ -1304,19 +1642,62 @@ dns_rrl_init(dns_rrl_t **rrlp, dns_view_t *view, int min_entries) {
 		isc_mem_putanddetach(&rrl->mctx, rrl, sizeof(*rrl));
 		return (result);
 	}
-	isc_stdtime_get(&rrl->ts_bases[0]);
-
-	view->rrl = rrl;
-
-	result = expand_entries(rrl, min_entries);
+	result = isc_refcount_init(&rrl->references, 1);
 	if (result != ISC_R_SUCCESS) {
-		dns_rrl_view_destroy(view);
+		DESTROYLOCK(&rrl->lock);
+		isc_mem_putanddetach(&rrl->mctx, rrl, sizeof(*rrl));
 		return (result);
 	}
-	result = expand_rrl_hash(rrl, 0);
-	if (result != ISC_R_SUCCESS) {
-		dns_rrl_view_destroy(view);
-		return (result);
+
+	rrl->shards = isc_mem_get(rrl->mctx,
+				  num_shards * sizeof(*rrl->shards));
+	if (rrl->shards == NULL) {
+		isc_refcount_decrement(&rrl->references, NULL);
+		isc_refcount_destroy(&rrl->references);
+		DESTROYLOCK(&rrl->lock);
+		isc_mem_putanddetach(&rrl->mctx, rrl, sizeof(*rrl));
+		return (ISC_R_NOMEMORY);
+	}
+	memset(rrl->shards, 0, num_shards * sizeof(*rrl->shards));
+	for (i = 0; i < num_shards; ++i) {
+		result = isc_mutex_init(&rrl->shards[i].lock);
+		if (result != ISC_R_SUCCESS) {
+			while (--i >= 0)
+				DESTROYLOCK(&rrl->shards[i].lock);
+			isc_mem_put(rrl->mctx, rrl->shards,
+				    num_shards * sizeof(*rrl->shards));
+			isc_refcount_decrement(&rrl->references, NULL);
+			isc_refcount_destroy(&rrl->references);
+			DESTROYLOCK(&rrl->lock);
+			isc_mem_putanddetach(&rrl->mctx, rrl, sizeof(*rrl));
+			return (result);
+		}
+	}
+	rrl->num_shards = num_shards;
+
+	view->rrl = rrl;
+
+	/*
+	 * The minimum number of entries is divided among the shards.
+	 */
+	for (i = 0; i < num_shards; ++i) {
+		shard = &rrl->shards[i];
+		isc_stdtime_get(&shard->ts_bases[0]);
+		ISC_LIST_INIT(shard->blocks);
+		ISC_LIST_INIT(shard->lru);
+		ISC_LIST_INIT(shard->qname_free);
+		ISC_EVENT_INIT(&shard->grow, sizeof(shard->grow), 0, NULL,
+			       DNS_EVENT_RRLGROW, grow_shard, shard,
+			       rrl, NULL, NULL);
+
+		result = expand_entries(rrl, shard,
+					(min_entries + i) / num_shards);
+		if (result == ISC_R_SUCCESS)
+			result = expand_rrl_hash(rrl, shard);
+		if (result != ISC_R_SUCCESS) {
+			dns_rrl_view_destroy(view);
+			return (result);
+		}
 	}
 
 	*rrlp = rrl;
@@ -40,7 +40,8 @@ typedef enum {
 	dns_statstype_general = 0,
 	dns_statstype_rdtype = 1,
 	dns_statstype_rdataset = 2,
-	dns_statstype_opcode = 3
+	dns_statstype_opcode = 3,
+	dns_statstype_latency = 4
 } dns_statstype_t;
 
 /*%
@@ -66,6 +67,23 @@ enum {
 	rdatasettypecounter_max = rdtypecounter_stale * 2
 };
 
+/*%
+ * Latency histograms are log-linear in microseconds: one bucket per
+ * microsecond below 4, then LATENCY_SUBBUCKETS buckets per power of two
+ * up to 2^LATENCY_MAXEXP, which is about two minutes.  Each of the
+ * dns_latencysource_max * dns_latencyrcode_max histograms takes
+ * LATENCY_BUCKETS consecutive counters; after all of them come the
+ * histograms' total latencies in microseconds, one counter each.
+ */
+#define LATENCY_SUBBITS		2
+#define LATENCY_SUBBUCKETS	(1 << LATENCY_SUBBITS)
+#define LATENCY_MAXEXP		27
+#define LATENCY_BUCKETS \
+	((LATENCY_MAXEXP - LATENCY_SUBBITS + 1) * LATENCY_SUBBUCKETS)
+#define LATENCY_HISTOGRAMS \
+	(dns_latencysource_max * dns_latencyrcode_max)
+#define LATENCY_SUMS		(LATENCY_HISTOGRAMS * LATENCY_BUCKETS)
+
 struct dns_stats {
 	/*% Unlocked */
 	unsigned int	magic;
@@ -88,6 +106,16 @@ typedef struct opcodedumparg {
 	void				*arg;
 } opcodedumparg_t;
 
+typedef struct latencydumparg {
+	dns_latencystats_dumper_t	fn;
+	void				*arg;
+} latencydumparg_t;
+
+typedef struct latencysumdumparg {
+	dns_latencysum_dumper_t		fn;
+	void				*arg;
+} latencysumdumparg_t;
+
 void
 dns_stats_attach(dns_stats_t *stats, dns_stats_t **statsp) {
 	REQUIRE(DNS_STATS_VALID(stats));
@@ -191,6 +219,14 @@ dns_opcodestats_create(isc_mem_t *mctx, dns_stats_t **statsp) {
 	return (create_stats(mctx, dns_statstype_opcode, 16, statsp));
 }
 
+isc_result_t
+dns_latencystats_create(isc_mem_t *mctx, dns_stats_t **statsp) {
+	REQUIRE(statsp != NULL && *statsp == NULL);
+
+	return (create_stats(mctx, dns_statstype_latency,
+			     LATENCY_SUMS + LATENCY_HISTOGRAMS, statsp));
+}
+
 /*%
  * Increment/Decrement methods
  */
@@ -281,6 +317,99 @@ dns_opcodestats_increment(dns_stats_t *stats, dns_opcode_t code) {
 	isc_stats_increment(stats->counters, (isc_statscounter_t)code);
 }
 
+static inline int
+latency_bucket(isc_uint64_t usec) {
+	isc_uint64_t v = usec;
+	int exp = 0;
+
+	if (usec < LATENCY_SUBBUCKETS)
+		return ((int)usec);
+
+	/*
+	 * 'exp' is the index of the most significant bit; the next
+	 * LATENCY_SUBBITS bits select the bucket within the octave.
+	 */
+	if ((v >> 32) != 0) {
+		v >>= 32;
+		exp += 32;
+	}
+	if ((v >> 16) != 0) {
+		v >>= 16;
+		exp += 16;
+	}
+	if ((v >> 8) != 0) {
+		v >>= 8;
+		exp += 8;
+	}
+	if ((v >> 4) != 0) {
+		v >>= 4;
+		exp += 4;
+	}
+	if ((v >> 2) != 0) {
+		v >>= 2;
+		exp += 2;
+	}
+	if ((v >> 1) != 0)
+		exp += 1;
+	if (exp >= LATENCY_MAXEXP)
+		return (LATENCY_BUCKETS - 1);
+
+	return ((exp - LATENCY_SUBBITS + 1) * LATENCY_SUBBUCKETS +
+		(int)((usec >> (exp - LATENCY_SUBBITS)) &
+		      (LATENCY_SUBBUCKETS - 1)));
+}
+
+static inline isc_uint64_t
+latency_lowerbound(int bucket) {
+	int exp, sub;
+
+	if (bucket < LATENCY_SUBBUCKETS)
+		return ((isc_uint64_t)bucket);
+
+	exp = bucket / LATENCY_SUBBUCKETS + LATENCY_SUBBITS - 1;
+	sub = bucket % LATENCY_SUBBUCKETS;
+	return ((isc_uint64_t)(LATENCY_SUBBUCKETS + sub) <<
+		(exp - LATENCY_SUBBITS));
+}
+
+void
+dns_latencystats_record(dns_stats_t *stats, dns_latencysource_t source,
+			dns_rcode_t rcode, isc_uint64_t usec)
+{
+	dns_latencyrcode_t rclass;
+	int histogram;
+
+	REQUIRE(DNS_STATS_VALID(stats) && stats->type == dns_statstype_latency);
+	REQUIRE(source < dns_latencysource_max);
+
+	switch (rcode) {
+	case dns_rcode_noerror:
+		rclass = dns_latencyrcode_noerror;
+		break;
+	case dns_rcode_servfail:
+		rclass = dns_latencyrcode_servfail;
+		break;
+	case dns_rcode_nxdomain:
+		rclass = dns_latencyrcode_nxdomain;
+		break;
+	case dns_rcode_refused:
+		rclass = dns_latencyrcode_refused;
+		break;
+	default:
+		rclass = dns_latencyrcode_other;
+		break;
+	}
+
+	histogram = source * dns_latencyrcode_max + rclass;
+	isc_stats_increment(stats->counters,
+			    (isc_statscounter_t)(histogram * LATENCY_BUCKETS +
+						 latency_bucket(usec)));
+	isc_stats_add(stats->counters,
+		      (isc_statscounter_t)(LATENCY_SUMS + histogram),
+		      usec > ISC_UINT32_MAX ? ISC_UINT32_MAX :
+					      (isc_uint32_t)usec);
+}
+
 /*%
  * Dump methods
  */
@@ -402,6 +531,61 @@ dns_opcodestats_dump(dns_stats_t *stats, dns_opcodestats_dumper_t dump_fn,
 	isc_stats_dump(stats->counters, opcode_dumpcb, &arg, options);
 }
 
+static void
+latency_dumpcb(isc_statscounter_t counter, isc_uint64_t value, void *arg) {
+	latencydumparg_t *latencyarg = arg;
+	int histogram = counter / LATENCY_BUCKETS;
+	int bucket = counter % LATENCY_BUCKETS;
+	isc_uint64_t upper = 0;
+
+	if (counter >= LATENCY_SUMS)
+		return;
+	if (bucket < LATENCY_BUCKETS - 1)
+		upper = latency_lowerbound(bucket + 1);
+	latencyarg->fn((dns_latencysource_t)(histogram / dns_latencyrcode_max),
+		       (dns_latencyrcode_t)(histogram % dns_latencyrcode_max),
+		       latency_lowerbound(bucket), upper, value,
+		       latencyarg->arg);
+}
+
+void
+dns_latencystats_dump(dns_stats_t *stats, dns_latencystats_dumper_t dump_fn,
+		      void *arg0, unsigned int options)
+{
+	latencydumparg_t arg;
+
+	REQUIRE(DNS_STATS_VALID(stats) && stats->type == dns_statstype_latency);
+
+	arg.fn = dump_fn;
+	arg.arg = arg0;
+	isc_stats_dump(stats->counters, latency_dumpcb, &arg, options);
+}
+
+static void
+latencysum_dumpcb(isc_statscounter_t counter, isc_uint64_t value, void *arg) {
+	latencysumdumparg_t *sumarg = arg;
+	int histogram = counter - LATENCY_SUMS;
+
+	if (counter < LATENCY_SUMS)
+		return;
+	sumarg->fn((dns_latencysource_t)(histogram / dns_latencyrcode_max),
+		   (dns_latencyrcode_t)(histogram % dns_latencyrcode_max),
+		   value, sumarg->arg);
+}
+
+void
+dns_latencystats_dumpsums(dns_stats_t *stats, dns_latencysum_dumper_t dump_fn,
+			  void *arg0, unsigned int options)
+{
+	latencysumdumparg_t arg;
+
+	REQUIRE(DNS_STATS_VALID(stats) && stats->type == dns_statstype_latency);
+
+	arg.fn = dump_fn;
+	arg.arg = arg0;
+	isc_stats_dump(stats->counters, latencysum_dumpcb, &arg, options);
+}
+
 /***
  *** Obsolete variables and functions follow:
  ***/
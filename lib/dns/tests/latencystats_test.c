@@ -0,0 +1,278 @@
+/*
+ * Copyright (C) 2014  Internet Systems Consortium, Inc. ("ISC")
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS.  IN NO EVENT SHALL ISC BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE
+ * OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/* $Id$ */
+
+/*! \file */
+
+#include <config.h>
+
+#include <atf-c.h>
+
+#include <unistd.h>
+
+#include <isc/stats.h>
+
+#include <dns/rcode.h>
+#include <dns/stats.h>
+
+#include "dnstest.h"
+
+/*
+ * Helper functions
+ */
+
+/*
+ * The bucket a single recorded latency was found in.
+ */
+typedef struct {
+	unsigned int		found;
+	dns_latencysource_t	source;
+	dns_latencyrcode_t	rcode;
+	isc_uint64_t		lower;
+	isc_uint64_t		upper;
+} bucket_t;
+
+static void
+findit(dns_latencysource_t source, dns_latencyrcode_t rcode,
+       isc_uint64_t lower, isc_uint64_t upper, isc_uint64_t value, void *arg)
+{
+	bucket_t *bucket = arg;
+
+	ATF_REQUIRE_EQ(value, 1);
+	bucket->found++;
+	bucket->source = source;
+	bucket->rcode = rcode;
+	bucket->lower = lower;
+	bucket->upper = upper;
+}
+
+/*
+ * Record 'usec' once in a new set of histograms and return the bounds of
+ * the bucket it went in; 0 as the upper bound means unbounded.
+ */
+static void
+bucketof(isc_uint64_t usec, isc_uint64_t *lowerp, isc_uint64_t *upperp) {
+	dns_stats_t *stats = NULL;
+	bucket_t bucket;
+	isc_result_t result;
+
+	result = dns_latencystats_create(mctx, &stats);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+
+	dns_latencystats_record(stats, dns_latencysource_cache,
+				dns_rcode_nxdomain, usec);
+	memset(&bucket, 0, sizeof(bucket));
+	dns_latencystats_dump(stats, findit, &bucket, 0);
+	dns_stats_detach(&stats);
+
+	ATF_REQUIRE_EQ(bucket.found, 1);
+	ATF_CHECK_EQ(bucket.source, dns_latencysource_cache);
+	ATF_CHECK_EQ(bucket.rcode, dns_latencyrcode_nxdomain);
+	ATF_CHECK_MSG(bucket.lower <= usec &&
+		      (bucket.upper == 0 || usec < bucket.upper),
+		      "%llu us put in [%llu, %llu)", (unsigned long long)usec,
+		      (unsigned long long)bucket.lower,
+		      (unsigned long long)bucket.upper);
+	*lowerp = bucket.lower;
+	*upperp = bucket.upper;
+}
+
+static void
+checkbucket(isc_uint64_t usec, isc_uint64_t lower, isc_uint64_t upper) {
+	isc_uint64_t l, u;
+
+	bucketof(usec, &l, &u);
+	ATF_CHECK_EQ_MSG(l, lower, "%llu us: lower bound %llu, expected %llu",
+			 (unsigned long long)usec, (unsigned long long)l,
+			 (unsigned long long)lower);
+	ATF_CHECK_EQ_MSG(u, upper, "%llu us: upper bound %llu, expected %llu",
+			 (unsigned long long)usec, (unsigned long long)u,
+			 (unsigned long long)upper);
+}
+
+typedef struct {
+	unsigned int		buckets;
+	isc_uint64_t		next;		/* lower bound expected */
+	isc_boolean_t		last;		/* unbounded bucket seen */
+} walk_t;
+
+static void
+walkit(dns_latencysource_t source, dns_latencyrcode_t rcode,
+       isc_uint64_t lower, isc_uint64_t upper, isc_uint64_t value, void *arg)
+{
+	walk_t *walk = arg;
+
+	ATF_REQUIRE_EQ(value, 0);
+	if (source != dns_latencysource_auth ||
+	    rcode != dns_latencyrcode_noerror)
+		return;
+
+	ATF_CHECK(!walk->last);
+	ATF_CHECK_EQ(lower, walk->next);
+	if (upper == 0)
+		walk->last = ISC_TRUE;
+	else
+		ATF_CHECK(upper > lower);
+	walk->next = upper;
+	walk->buckets++;
+}
+
+static void
+sumit(dns_latencysource_t source, dns_latencyrcode_t rcode,
+      isc_uint64_t usec, void *arg)
+{
+	isc_uint64_t *sums = arg;
+
+	sums[source * dns_latencyrcode_max + rcode] = usec;
+}
+
+/*
+ * Individual unit tests
+ */
+
+ATF_TC(buckets);
+ATF_TC_HEAD(buckets, tc) {
+	atf_tc_set_md_var(tc, "descr", "latencies are put in the right "
+			  "histogram buckets");
+}
+ATF_TC_BODY(buckets, tc) {
+	isc_result_t result;
+	isc_uint64_t usec, lower, upper;
+	int exp;
+
+	UNUSED(tc);
+
+	result = dns_test_begin(NULL, ISC_FALSE);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+
+	/* One microsecond per bucket below 4 us. */
+	checkbucket(0, 0, 1);
+	checkbucket(1, 1, 2);
+	checkbucket(3, 3, 4);
+
+	/* Then four buckets per power of two. */
+	checkbucket(4, 4, 5);
+	checkbucket(7, 7, 8);
+	checkbucket(8, 8, 10);
+	checkbucket(9, 8, 10);
+	checkbucket(15, 14, 16);
+	checkbucket(16, 16, 20);
+	checkbucket(1023, 896, 1024);
+	checkbucket(1024, 1024, 1280);
+	checkbucket(1000000, 917504, 1048576);
+
+	/*
+	 * Every octave edge starts a bucket, and the microsecond before
+	 * it ends one.
+	 */
+	for (exp = 2; exp < 27; exp++) {
+		usec = (isc_uint64_t)1 << exp;
+		bucketof(usec, &lower, &upper);
+		ATF_CHECK_EQ(lower, usec);
+		bucketof(usec - 1, &lower, &upper);
+		ATF_CHECK_EQ(upper, usec);
+	}
+
+	/*
+	 * The last bucket is unbounded: it starts at 7 * 2^24 us and
+	 * takes everything from 2^27 us (about two minutes) on.
+	 */
+	checkbucket(((isc_uint64_t)7 << 24) - 1, (isc_uint64_t)6 << 24,
+		    (isc_uint64_t)7 << 24);
+	checkbucket((isc_uint64_t)7 << 24, (isc_uint64_t)7 << 24, 0);
+	checkbucket(((isc_uint64_t)1 << 27) - 1, (isc_uint64_t)7 << 24, 0);
+	checkbucket((isc_uint64_t)1 << 27, (isc_uint64_t)7 << 24, 0);
+	checkbucket((isc_uint64_t)1 << 40, (isc_uint64_t)7 << 24, 0);
+	checkbucket(ISC_UINT64_MAX, (isc_uint64_t)7 << 24, 0);
+
+	dns_test_end();
+}
+
+ATF_TC(contiguous);
+ATF_TC_HEAD(contiguous, tc) {
+	atf_tc_set_md_var(tc, "descr", "histogram buckets cover all "
+			  "latencies without gaps");
+}
+ATF_TC_BODY(contiguous, tc) {
+	dns_stats_t *stats = NULL;
+	walk_t walk;
+	isc_result_t result;
+
+	UNUSED(tc);
+
+	result = dns_test_begin(NULL, ISC_FALSE);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+
+	result = dns_latencystats_create(mctx, &stats);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+
+	memset(&walk, 0, sizeof(walk));
+	dns_latencystats_dump(stats, walkit, &walk, ISC_STATSDUMP_VERBOSE);
+	ATF_CHECK(walk.last);
+	ATF_CHECK_EQ(walk.buckets, 104);
+
+	dns_stats_detach(&stats);
+	dns_test_end();
+}
+
+ATF_TC(sums);
+ATF_TC_HEAD(sums, tc) {
+	atf_tc_set_md_var(tc, "descr", "each histogram keeps the total "
+			  "of its latencies");
+}
+ATF_TC_BODY(sums, tc) {
+	dns_stats_t *stats = NULL;
+	isc_uint64_t sums[dns_latencysource_max * dns_latencyrcode_max];
+	isc_result_t result;
+
+	UNUSED(tc);
+
+	result = dns_test_begin(NULL, ISC_FALSE);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+
+	result = dns_latencystats_create(mctx, &stats);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+
+	dns_latencystats_record(stats, dns_latencysource_auth,
+				dns_rcode_noerror, 3);
+	dns_latencystats_record(stats, dns_latencysource_auth,
+				dns_rcode_noerror, 1500000);
+	dns_latencystats_record(stats, dns_latencysource_recursion,
+				dns_rcode_formerr, 250);
+
+	memset(sums, 0xff, sizeof(sums));
+	dns_latencystats_dumpsums(stats, sumit, sums, ISC_STATSDUMP_VERBOSE);
+	ATF_CHECK_EQ(sums[dns_latencysource_auth * dns_latencyrcode_max +
+			  dns_latencyrcode_noerror], 1500003);
+	ATF_CHECK_EQ(sums[dns_latencysource_recursion * dns_latencyrcode_max +
+			  dns_latencyrcode_other], 250);
+	ATF_CHECK_EQ(sums[dns_latencysource_cache * dns_latencyrcode_max +
+			  dns_latencyrcode_noerror], 0);
+
+	dns_stats_detach(&stats);
+	dns_test_end();
+}
+
+/*
+ * Main
+ */
+ATF_TP_ADD_TCS(tp) {
+	ATF_TP_ADD_TC(tp, buckets);
+	ATF_TP_ADD_TC(tp, contiguous);
+	ATF_TP_ADD_TC(tp, sums);
+	return (atf_no_error());
+}
@@ -156,6 +156,7 @@ dns_view_create(isc_mem_t *mctx, dns_rdataclass_t rdclass,
 	view->adbstats = NULL;
 	view->resstats = NULL;
 	view->resquerystats = NULL;
+	view->latencystats = NULL;
 	view->cacheshared = ISC_FALSE;
 	ISC_LIST_INIT(view->dns64);
 	view->dns64cnt = 0;
@@ -446,6 +447,8 @@ destroy(dns_view_t *view) {
 		isc_stats_detach(&view->resstats);
 	if (view->resquerystats != NULL)
 		dns_stats_detach(&view->resquerystats);
+	if (view->latencystats != NULL)
+		dns_stats_detach(&view->latencystats);
 	if (view->secroots_priv != NULL)
 		dns_keytable_detach(&view->secroots_priv);
 	for (dns64 = ISC_LIST_HEAD(view->dns64);
@@ -1775,6 +1778,24 @@ dns_view_getresquerystats(dns_view_t *view, dns_stats_t **statsp) {
 		dns_stats_attach(view->resquerystats, statsp);
 }
 
+void
+dns_view_setlatencystats(dns_view_t *view, dns_stats_t *stats) {
+	REQUIRE(DNS_VIEW_VALID(view));
+	REQUIRE(!view->frozen);
+	REQUIRE(view->latencystats == NULL);
+
+	dns_stats_attach(stats, &view->latencystats);
+}
+
+void
+dns_view_getlatencystats(dns_view_t *view, dns_stats_t **statsp) {
+	REQUIRE(DNS_VIEW_VALID(view));
+	REQUIRE(statsp != NULL && *statsp == NULL);
+
+	if (view->latencystats != NULL)
+		dns_stats_attach(view->latencystats, statsp);
+}
+
 isc_result_t
 dns_view_initsecroots(dns_view_t *view, isc_mem_t *mctx) {
 	REQUIRE(DNS_VIEW_VALID(view));
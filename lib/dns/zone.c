@@ -517,6 +517,7 @@ struct dns_zonemgr {
 	isc_uint32_t		transfersin;
 	isc_uint32_t		transfersperns;
 	unsigned int		serialqueryrate;
+	isc_boolean_t		hugepages;
 
 	/* Locked by iolock */
 	isc_uint32_t		iolimit;
@@ -15079,6 +15080,7 @@ dns_zonemgr_create(isc_mem_t *mctx, isc_taskmgr_t *taskmgr,
 
 	zmgr->transfersin = 10;
 	zmgr->transfersperns = 2;
+	zmgr->hugepages = ISC_FALSE;
 
 	/* Unreachable lock. */
 	result = isc_rwlock_init(&zmgr->urlock, 0, 0);
@@ -15162,6 +15164,11 @@ dns_zonemgr_createzone(dns_zonemgr_t *zmgr, dns_zone_t **zonep) {
 	if (item == NULL)
 		return (ISC_R_FAILURE);
 
+	/*
+	 * The pool's contexts pick up a change of the huge page setting
+	 * as they are handed to new zones.
+	 */
+	(void)isc_mem_sethugepages((isc_mem_t *) item, zmgr->hugepages);
 	isc_mem_attach((isc_mem_t *) item, &mctx);
 	result = dns_zone_create(&zone, mctx);
 	isc_mem_detach(&mctx);
@@ -15871,6 +15878,13 @@ dns_zonemgr_getserialqueryrate(dns_zonemgr_t *zmgr) {
 	return (zmgr->serialqueryrate);
 }
 
+void
+dns_zonemgr_sethugepages(dns_zonemgr_t *zmgr, isc_boolean_t value) {
+	REQUIRE(DNS_ZONEMGR_VALID(zmgr));
+
+	zmgr->hugepages = value;
+}
+
 isc_boolean_t
 dns_zonemgr_unreachable(dns_zonemgr_t *zmgr, isc_sockaddr_t *remote,
 			isc_sockaddr_t *local, isc_time_t *now)
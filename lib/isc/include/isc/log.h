@@ -70,6 +70,8 @@
 #define ISC_LOG_PRINTTAG	0x0010		/* tag and ":" */
 #define ISC_LOG_PRINTPREFIX	0x0020		/* tag only, no colon */
 #define ISC_LOG_PRINTALL	0x003F
+#define ISC_LOG_ASYNC		0x0100		/* write from a thread */
+#define ISC_LOG_ASYNCBLOCK	0x0200		/* wait, don't drop */
 #define ISC_LOG_DEBUGONLY	0x1000
 #define ISC_LOG_OPENERR		0x8000		/* internal */
 /*@}*/
@@ -434,6 +436,14 @@ isc_log_createchannel(isc_logconfig_t *lcfg, const char *name,
  *	debug level of the logging context (see isc_log_setdebuglevel)
  *	is non-zero.
  *
+ *\li	#ISC_LOG_ASYNC makes an #ISC_LOG_TOFILE or #ISC_LOG_TOFILEDESC
+ *	channel queue each line in memory and return at once; a thread
+ *	belonging to the channel writes the queued lines out in batches.
+ *	When the queue is full new lines are dropped and counted (see
+ *	isc_log_getdropped()), unless #ISC_LOG_ASYNCBLOCK is also set, in
+ *	which case the caller waits for room.  The flags are ignored for
+ *	other channel types and in builds without threads.
+ *
  * Requires:
  *\li	lcfg is a valid logging configuration.
  *
@@ -446,8 +456,8 @@ isc_log_createchannel(isc_logconfig_t *lcfg, const char *name,
  *
  *\li	level is >= #ISC_LOG_CRITICAL (the most negative logging level).
  *
- *\li	flags does not include any bits aside from the ISC_LOG_PRINT* bits
- *	or #ISC_LOG_DEBUGONLY.
+ *\li	flags does not include any bits aside from the ISC_LOG_PRINT* bits,
+ *	#ISC_LOG_ASYNC, #ISC_LOG_ASYNCBLOCK or #ISC_LOG_DEBUGONLY.
  *
  * Ensures:
  *\li	#ISC_R_SUCCESS
@@ -863,7 +873,18 @@ isc_log_closefilelogs(isc_log_t *lctx);
  *
  * Ensures:
  *\li	The open files are closed and will be reopened when they are
- *	next needed.
+ *	next needed.  Files of #ISC_LOG_ASYNC channels are closed once
+ *	the lines already queued for them have been written.
+ */
+
+isc_uint64_t
+isc_log_getdropped(isc_log_t *lctx);
+/*%<
+ * Return the number of lines dropped so far because the queue of an
+ * #ISC_LOG_ASYNC channel was full.
+ *
+ * Requires:
+ *\li	lctx is a valid context.
  */
 
 isc_logcategory_t *
@@ -395,6 +395,11 @@ isc_mem_inuse(isc_mem_t *mctx);
  * Get an estimate of the amount of memory in use in 'mctx', in bytes.
  * This includes quantization overhead, but does not include memory
  * allocated from the system but not yet used.
+ *
+ * When ISC_MEMFLAG_INTERNAL is set (and ISC_MEMFLAG_NOLOCK is not), each
+ * thread keeps a small cache of freed memory per context.  That memory
+ * is not counted as in use.  While other threads are allocating from
+ * 'mctx', the size of their caches may be slightly out of date.
  */
 
 size_t
@@ -537,6 +542,82 @@ isc_mem_gettag(isc_mem_t *ctx);
  *\li	'ctx' is a valid task.
  */
 
+isc_result_t
+isc_mem_sethugepages(isc_mem_t *ctx, isc_boolean_t flag);
+/*%<
+ * If 'flag' is ISC_TRUE, the blocks 'ctx' carves its small allocations
+ * from are henceforth obtained 2MB at a time, aligned to and backed by
+ * huge pages: explicit ones if the system has reserved some, otherwise
+ * transparent huge pages.  Blocks already obtained are unaffected.
+ *
+ * Requires:
+ *\li	'ctx' is a valid ctx.
+ *
+ * Returns:
+ *\li	#ISC_R_SUCCESS
+ *\li	#ISC_R_NOTIMPLEMENTED	'flag' is ISC_TRUE but huge pages are not
+ *				supported on this system, or 'ctx' was not
+ *				created with ISC_MEMFLAG_INTERNAL.
+ */
+
+size_t
+isc_mem_hugepages(isc_mem_t *ctx);
+/*%<
+ * Get the number of bytes of 'ctx' that are on huge pages: mapped from
+ * explicit huge pages, or advised to be backed by transparent ones.
+ */
+
+isc_result_t
+isc_mem_setnode(isc_mem_t *ctx, int node);
+/*%<
+ * Have the blocks 'ctx' carves its small allocations from henceforth
+ * taken from NUMA node 'node' where the system allows it; they are then
+ * obtained 2MB at a time like huge pages.  With 'node' -1 the blocks are
+ * placed by the system again.  Blocks already obtained, and allocations
+ * too large for the blocks, are placed by the system where they are
+ * first touched.
+ *
+ * Requires:
+ *\li	'ctx' is a valid ctx.
+ *\li	'node' >= -1.
+ *
+ * Returns:
+ *\li	#ISC_R_SUCCESS
+ *\li	#ISC_R_RANGE		'node' is too large.
+ *\li	#ISC_R_NOTIMPLEMENTED	'node' is not -1 but the system cannot
+ *				place memory on a node, or 'ctx' was not
+ *				created with ISC_MEMFLAG_INTERNAL.
+ */
+
+size_t
+isc_mem_nodesize(isc_mem_t *ctx);
+/*%<
+ * Get the number of bytes of 'ctx' that were asked to be on the node set
+ * by isc_mem_setnode().
+ */
+
+/*%
+ * Totals over all memory contexts, as shown in the statistics summary.
+ */
+typedef struct isc_memsummary {
+	isc_uint64_t	total;		/*%< obtained from the system */
+	isc_uint64_t	inuse;
+	isc_uint64_t	blocksize;	/*%< internal allocator blocks */
+	isc_uint64_t	hugesize;	/*%< of which on huge pages */
+	isc_uint64_t	contextsize;	/*%< used by the contexts themselves */
+	isc_uint64_t	lost;
+	unsigned int	contexts;
+} isc_memsummary_t;
+
+void
+isc_mem_summary(isc_memsummary_t *summary);
+/*%<
+ * Fill in '*summary' with the totals over all memory contexts.
+ *
+ * Requires:
+ *\li	'summary' is not NULL.
+ */
+
 #ifdef HAVE_LIBXML2
 int
 isc_mem_renderxml(xmlTextWriterPtr writer);
@@ -33,6 +33,21 @@ isc_os_ncpus(void);
  * be determined.
  */
 
+int
+isc_os_cpunode(int cpu);
+/*%<
+ * Return the NUMA node of processor 'cpu', or -1 if the system does not
+ * say or the processor does not exist.
+ */
+
+int
+isc_os_ifnode(const char *ifname);
+/*%<
+ * Return the NUMA node the network device behind interface 'ifname' is
+ * attached to, or -1 if the system does not say.  An alias suffix
+ * (":n") of 'ifname' is ignored.
+ */
+
 ISC_LANG_ENDDECLS
 
 #endif /* ISC_OS_H */
@@ -128,12 +128,26 @@ ISC_LANG_BEGINDECLS
  */
 #define ISC_SOCKET_MAXSCATTERGATHER	8
 
+/*%
+ * Maximum number of queued UDP reads or writes on one socket that are
+ * handled by a single recvmmsg() or sendmmsg() call where available.
+ */
+#define ISC_SOCKET_MAXBATCH		32
+
 /*%
  * In isc_socket_bind() set socket option SO_REUSEADDR prior to calling
  * bind() if a non zero port is specified (AF_INET and AF_INET6).
  */
 #define ISC_SOCKET_REUSEADDRESS		0x01U
 
+/*%
+ * In isc_socket_bind() set socket option SO_REUSEPORT prior to calling
+ * bind() if a non zero port is specified (AF_INET and AF_INET6).  Every
+ * socket bound to the address and port this way gets a share of the
+ * incoming datagrams.
+ */
+#define ISC_SOCKET_REUSEPORT		0x02U
+
 /*%
  * Statistics counters.  Used as isc_statscounter_t values.
  */
@@ -212,7 +226,16 @@ enum {
 	isc_sockstatscounter_rawrecvfail = 60,
 	isc_sockstatscounter_rawactive = 61,
 
-	isc_sockstatscounter_max = 62
+	isc_sockstatscounter_udp4recvbatch = 62,
+	isc_sockstatscounter_udp6recvbatch = 63,
+	isc_sockstatscounter_udp4recvbatchmsgs = 64,
+	isc_sockstatscounter_udp6recvbatchmsgs = 65,
+	isc_sockstatscounter_udp4sendbatch = 66,
+	isc_sockstatscounter_udp6sendbatch = 67,
+	isc_sockstatscounter_udp4sendbatchmsgs = 68,
+	isc_sockstatscounter_udp6sendbatchmsgs = 69,
+
+	isc_sockstatscounter_max = 70
 };
 
 /***
@@ -706,6 +729,7 @@ isc_socket_bind(isc_socket_t *sock, isc_sockaddr_t *addressp,
  * \li	ISC_R_ADDRNOTAVAIL
  * \li	ISC_R_ADDRINUSE
  * \li	ISC_R_BOUND
+ * \li	ISC_R_NOTIMPLEMENTED	ISC_SOCKET_REUSEPORT is not supported
  * \li	ISC_R_UNEXPECTED
  */
 
@@ -1026,12 +1050,15 @@ isc_socketmgr_create(isc_mem_t *mctx, isc_socketmgr_t **managerp);
 
 isc_result_t
 isc_socketmgr_create2(isc_mem_t *mctx, isc_socketmgr_t **managerp,
-		      unsigned int maxsocks);
+		      unsigned int maxsocks, unsigned int nthreads);
 /*%<
  * Create a socket manager.  If "maxsocks" is non-zero, it specifies the
  * maximum number of sockets that the created manager should handle.
+ * "nthreads" is the number of watcher threads; each of them polls its own
+ * share of the sockets.  Zero means one.  Implementations that cannot
+ * split the polling use a single thread.
  * isc_socketmgr_create() is equivalent of isc_socketmgr_create2() with
- * "maxsocks" being zero.
+ * "maxsocks" being zero and "nthreads" being one.
  * isc_socketmgr_createinctx() also associates the new manager with the
  * specified application context.
  *
@@ -1229,6 +1256,24 @@ isc__socketmgr_maxudp(isc_socketmgr_t *mgr, int maxudp);
  * Test interface. Drop UDP packet > 'maxudp'.
  */
 
+isc_result_t
+isc_socketmgr_setaffinity(isc_socketmgr_t *mgr, const int *cpus,
+			  unsigned int ncpus);
+/*%<
+ * Bind watcher thread N of 'mgr' to processor cpus[N % ncpus].  With
+ * 'ncpus' 0 the watcher threads may run on any processor again.
+ *
+ * Requires:
+ *\li	'mgr' is a valid socket manager.
+ *\li	'cpus' is not NULL if 'ncpus' is not 0.
+ *
+ * Returns:
+ *\li	#ISC_R_SUCCESS
+ *\li	#ISC_R_NOTIMPLEMENTED	there are no watcher threads, or the
+ *				platform cannot bind threads.
+ *\li	#ISC_R_RANGE		a processor does not exist.
+ */
+
 #ifdef HAVE_LIBXML2
 int
 isc_socketmgr_renderxml(isc_socketmgr_t *mgr, xmlTextWriterPtr writer);
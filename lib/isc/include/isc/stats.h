@@ -94,6 +94,19 @@ isc_stats_increment(isc_stats_t *stats, isc_statscounter_t counter);
  *	on creation.
  */
 
+void
+isc_stats_add(isc_stats_t *stats, isc_statscounter_t counter,
+	      isc_uint32_t val);
+/*%<
+ * Add 'val' to the counter-th counter of stats.
+ *
+ * Requires:
+ *\li	'stats' is a valid isc_stats_t.
+ *
+ *\li	counter is less than the maximum available ID for the stats specified
+ *	on creation.
+ */
+
 void
 isc_stats_decrement(isc_stats_t *stats, isc_statscounter_t counter);
 /*%<
@@ -112,6 +125,9 @@ isc_stats_dump(isc_stats_t *stats, isc_stats_dumper_t dump_fn, void *arg,
  * arg.  By default counters that have a value of 0 is skipped; if options has
  * the ISC_STATSDUMP_VERBOSE flag, even such counters are dumped.
  *
+ * Dumps of the same 'stats' are serialized, and dump_fn must not call
+ * any isc_stats function on 'stats'.
+ *
  * Requires:
  *\li	'stats' is a valid isc_stats_t.
  */
@@ -136,6 +152,18 @@ isc_stats_set(isc_stats_t *stats, isc_uint64_t val,
  *\li	'stats' is a valid isc_stats_t.
  */
 
+void
+isc_stats_setthreads(unsigned int nthreads);
+/*%<
+ * Set the number of threads expected to update statistics.  Each
+ * statistics set created from now on keeps a separate copy of its
+ * counters for up to that many threads (at most 64), so that they do not
+ * contend for the same memory.  Copies are assigned to threads in the
+ * order they first update any statistics, so 'n' should count every
+ * thread that may do so; any beyond that share a copy with another.
+ * The default is the number of processors.
+ */
+
 ISC_LANG_ENDDECLS
 
 #endif /* ISC_STATS_H */
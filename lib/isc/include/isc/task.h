@@ -651,6 +651,18 @@ isc_task_privilege(isc_task_t *task);
  *\li	'task' is a valid task.
  */
 
+void
+isc_task_sethome(isc_task_t *task, unsigned int threadid);
+/*%<
+ * Make worker 'threadid' (modulo the number of workers) the home of
+ * 'task', so that its events are run on that worker from now on.
+ * The home of a task that is ready or running cannot be changed and
+ * is left alone.
+ *
+ * Requires:
+ *\li	'task' is a valid task.
+ */
+
 /*****
  ***** Task Manager.
  *****/
@@ -786,6 +798,30 @@ isc_taskmgr_excltask(isc_taskmgr_t *mgr, isc_task_t **taskp);
  *\li	taskp != NULL && *taskp == NULL
  */
 
+isc_result_t
+isc_taskmgr_setaffinity(isc_taskmgr_t *mgr, const int *cpus,
+			unsigned int ncpus);
+/*%<
+ * Bind worker thread N of 'mgr' to processor cpus[N % ncpus].  With
+ * 'ncpus' 0 the worker threads may run on any processor again.
+ *
+ * Requires:
+ *\li	'mgr' is a valid task manager.
+ *\li	'cpus' is not NULL if 'ncpus' is not 0.
+ *
+ * Returns:
+ *\li	#ISC_R_SUCCESS
+ *\li	#ISC_R_NOTIMPLEMENTED	there are no worker threads, or the
+ *				platform cannot bind threads.
+ *\li	#ISC_R_RANGE		a processor does not exist.
+ */
+
+int
+isc_taskmgr_currentworker(void);
+/*%<
+ * Return the number of the task manager worker thread the caller runs
+ * on, or -1 if the caller is not a worker thread.
+ */
 
 #ifdef HAVE_LIBXML2
 int
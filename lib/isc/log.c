@@ -42,6 +42,13 @@
 #include <isc/time.h>
 #include <isc/util.h>
 
+#if defined(ISC_PLATFORM_USETHREADS) && !defined(_WIN32)
+#define USE_ASYNC_CHANNELS
+#include <sys/uio.h>
+#include <isc/condition.h>
+#include <isc/thread.h>
+#endif
+
 #define LCTX_MAGIC		ISC_MAGIC('L', 'c', 't', 'x')
 #define VALID_CONTEXT(lctx)	ISC_MAGIC_VALID(lctx, LCTX_MAGIC)
 
@@ -53,6 +60,25 @@
  */
 #define LOG_BUFFER_SIZE	(8 * 1024)
 
+/*
+ * Room for the message plus the time, tag, category, module and level
+ * prefixes when a whole line is built for an asynchronous channel.
+ */
+#define LOG_RECORD_SIZE	(LOG_BUFFER_SIZE + 1024)
+
+/*
+ * Ring size of an asynchronous channel.  Must be a power of two.
+ */
+#define LOG_ASYNC_RINGSIZE	(1024 * 1024)
+
+/*
+ * The writer of an asynchronous channel waits up to LOG_ASYNC_DELAY
+ * nanoseconds for LOG_ASYNC_BATCH bytes to collect before writing, so
+ * a busy channel is written in large pieces instead of line by line.
+ */
+#define LOG_ASYNC_BATCH		(64 * 1024)
+#define LOG_ASYNC_DELAY		10000000
+
 #ifndef PATH_MAX
 #define PATH_MAX 1024	/* AIX and others don't define this. */
 #endif
@@ -68,12 +94,44 @@
  */
 typedef struct isc_logchannel isc_logchannel_t;
 
+#ifdef USE_ASYNC_CHANNELS
+/*!
+ * An #ISC_LOG_ASYNC file channel does not write in isc_log_doit().
+ * Complete lines are copied into a ring instead, and the channel's own
+ * writer thread writes out everything queued since its last pass with
+ * a single writev().  The writer also owns the channel's stream: it
+ * opens, rolls and closes the file, so no file I/O is done while the
+ * log context is locked.
+ *
+ * Lines are only ever queued with the log context locked, so each end
+ * of the ring has exactly one thread.  The ring lock just moves the
+ * offsets and is never held across I/O.
+ */
+typedef struct isc_logasync {
+	isc_mutex_t			lock;
+	isc_condition_t			ready;	/*%< data queued or shutdown */
+	isc_condition_t			space;	/*%< ring drained */
+	isc_thread_t			thread;
+	char *				ring;
+	unsigned int			head;	/*%< producer offset */
+	unsigned int			tail;	/*%< consumer offset */
+	unsigned int			dropped; /*%< not yet reported */
+	isc_boolean_t			idle;	/*%< writer waits for data */
+	isc_boolean_t			reopen;
+	unsigned int			reopenhead; /*%< close after this */
+	isc_boolean_t			shutdown;
+} isc_logasync_t;
+#endif
+
 struct isc_logchannel {
 	char *				name;
 	unsigned int			type;
 	int 				level;
 	unsigned int			flags;
 	isc_logdestination_t 		destination;
+#ifdef USE_ASYNC_CHANNELS
+	isc_logasync_t *		async;
+#endif
 	ISC_LINK(isc_logchannel_t)	link;
 };
 
@@ -155,6 +213,10 @@ struct isc_log {
 	isc_logconfig_t * 		logconfig;
 	char 				buffer[LOG_BUFFER_SIZE];
 	ISC_LIST(isc_logmessage_t)	messages;
+	isc_uint64_t			dropped;
+#ifdef USE_ASYNC_CHANNELS
+	char				record[LOG_RECORD_SIZE];
+#endif
 };
 
 /*!
@@ -237,6 +299,23 @@ greatest_version(isc_logchannel_t *channel, int *greatest);
 static isc_result_t
 roll_log(isc_logchannel_t *channel);
 
+static isc_boolean_t
+file_ready(isc_logchannel_t *channel);
+
+static void
+file_checksize(isc_logchannel_t *channel);
+
+#ifdef USE_ASYNC_CHANNELS
+static isc_result_t
+async_create(isc_mem_t *mctx, isc_logchannel_t *channel);
+
+static void
+async_destroy(isc_mem_t *mctx, isc_logchannel_t *channel);
+
+static void
+async_queue(isc_log_t *lctx, isc_logchannel_t *channel, size_t len);
+#endif
+
 static void
 isc_log_doit(isc_log_t *lctx, isc_logcategory_t *category,
 	     isc_logmodule_t *module, int level, isc_boolean_t write_once,
@@ -283,6 +362,7 @@ isc_log_create(isc_mem_t *mctx, isc_log_t **lctxp, isc_logconfig_t **lcfgp) {
 		lctx->modules = NULL;
 		lctx->module_count = 0;
 		lctx->debug_level = 0;
+		lctx->dropped = 0;
 
 		ISC_LIST_INIT(lctx->messages);
 
@@ -524,6 +604,14 @@ isc_logconfig_destroy(isc_logconfig_t **lcfgp) {
 	while ((channel = ISC_LIST_HEAD(lcfg->channels)) != NULL) {
 		ISC_LIST_UNLINK(lcfg->channels, channel, link);
 
+#ifdef USE_ASYNC_CHANNELS
+		/*
+		 * Let the writer drain the ring before the stream is closed.
+		 */
+		if (channel->async != NULL)
+			async_destroy(mctx, channel);
+#endif
+
 		if (channel->type == ISC_LOG_TOFILE) {
 			/*
 			 * The filename for the channel may have ultimately
@@ -716,7 +804,8 @@ isc_log_createchannel(isc_logconfig_t *lcfg, const char *name,
 	REQUIRE(destination != NULL || type == ISC_LOG_TONULL);
 	REQUIRE(level >= ISC_LOG_CRITICAL);
 	REQUIRE((flags &
-		 (unsigned int)~(ISC_LOG_PRINTALL | ISC_LOG_DEBUGONLY)) == 0);
+		 (unsigned int)~(ISC_LOG_PRINTALL | ISC_LOG_DEBUGONLY |
+				 ISC_LOG_ASYNC | ISC_LOG_ASYNCBLOCK)) == 0);
 
 	/* XXXDCL find duplicate names? */
 
@@ -735,6 +824,9 @@ isc_log_createchannel(isc_logconfig_t *lcfg, const char *name,
 	channel->type = type;
 	channel->level = level;
 	channel->flags = flags;
+#ifdef USE_ASYNC_CHANNELS
+	channel->async = NULL;
+#endif
 	ISC_LINK_INIT(channel, link);
 
 	switch (type) {
@@ -773,6 +865,24 @@ isc_log_createchannel(isc_logconfig_t *lcfg, const char *name,
 		return (ISC_R_UNEXPECTED);
 	}
 
+#ifdef USE_ASYNC_CHANNELS
+	if ((flags & ISC_LOG_ASYNC) != 0 &&
+	    (type == ISC_LOG_TOFILE || type == ISC_LOG_TOFILEDESC)) {
+		isc_result_t result = async_create(mctx, channel);
+		if (result != ISC_R_SUCCESS) {
+			if (type == ISC_LOG_TOFILE) {
+				char *filename;
+
+				DE_CONST(FILE_NAME(channel), filename);
+				isc_mem_free(mctx, filename);
+			}
+			isc_mem_free(mctx, channel->name);
+			isc_mem_put(mctx, channel, sizeof(*channel));
+			return (result);
+		}
+	}
+#endif
+
 	ISC_LIST_PREPEND(lcfg->channels, channel, link);
 
 	/*
@@ -1039,14 +1149,42 @@ isc_log_closefilelogs(isc_log_t *lctx) {
 	LOCK(&lctx->lock);
 	for (channel = ISC_LIST_HEAD(lctx->logconfig->channels);
 	     channel != NULL;
-	     channel = ISC_LIST_NEXT(channel, link))
-
-		if (channel->type == ISC_LOG_TOFILE &&
-		    FILE_STREAM(channel) != NULL) {
+	     channel = ISC_LIST_NEXT(channel, link)) {
+		if (channel->type != ISC_LOG_TOFILE)
+			continue;
+#ifdef USE_ASYNC_CHANNELS
+		/*
+		 * The writer owns the stream of an asynchronous channel,
+		 * so it is asked to close it after the lines already queued.
+		 */
+		if (channel->async != NULL) {
+			LOCK(&channel->async->lock);
+			channel->async->reopen = ISC_TRUE;
+			channel->async->reopenhead = channel->async->head;
+			SIGNAL(&channel->async->ready);
+			UNLOCK(&channel->async->lock);
+			continue;
+		}
+#endif
+		if (FILE_STREAM(channel) != NULL) {
 			(void)fclose(FILE_STREAM(channel));
 			FILE_STREAM(channel) = NULL;
 		}
+	}
+	UNLOCK(&lctx->lock);
+}
+
+isc_uint64_t
+isc_log_getdropped(isc_log_t *lctx) {
+	isc_uint64_t dropped;
+
+	REQUIRE(VALID_CONTEXT(lctx));
+
+	LOCK(&lctx->lock);
+	dropped = lctx->dropped;
 	UNLOCK(&lctx->lock);
+
+	return (dropped);
 }
 
 /****
@@ -1375,6 +1513,334 @@ isc_log_open(isc_logchannel_t *channel) {
 	return (result);
 }
 
+/*
+ * Get a file channel ready to be written to, reopening it if it was
+ * closed, or if it reached its maximum size and can now be rolled.
+ * Returns ISC_FALSE if the message should be skipped.
+ */
+static isc_boolean_t
+file_ready(isc_logchannel_t *channel) {
+	struct stat statbuf;
+	isc_result_t result;
+
+	if (FILE_MAXREACHED(channel)) {
+		/*
+		 * If the file can be rolled, OR
+		 * If the file no longer exists, OR
+		 * If the file is less than the maximum size,
+		 *    (such as if it had been renamed and
+		 *     a new one touched, or it was truncated
+		 *     in place)
+		 * ... then close it to trigger reopening.
+		 */
+		if (FILE_VERSIONS(channel) != ISC_LOG_ROLLNEVER ||
+		    (stat(FILE_NAME(channel), &statbuf) != 0 &&
+		     errno == ENOENT) ||
+		    statbuf.st_size < FILE_MAXSIZE(channel)) {
+			(void)fclose(FILE_STREAM(channel));
+			FILE_STREAM(channel) = NULL;
+			FILE_MAXREACHED(channel) = ISC_FALSE;
+		} else
+			/*
+			 * Eh, skip it.
+			 */
+			return (ISC_FALSE);
+	}
+
+	if (FILE_STREAM(channel) == NULL) {
+		result = isc_log_open(channel);
+		if (result != ISC_R_SUCCESS &&
+		    result != ISC_R_MAXSIZE &&
+		    (channel->flags & ISC_LOG_OPENERR) == 0) {
+			syslog(LOG_ERR,
+			       "isc_log_open '%s' failed: %s",
+			       FILE_NAME(channel),
+			       isc_result_totext(result));
+			channel->flags |= ISC_LOG_OPENERR;
+		}
+		if (result != ISC_R_SUCCESS)
+			return (ISC_FALSE);
+		channel->flags &= ~ISC_LOG_OPENERR;
+	}
+
+	return (ISC_TRUE);
+}
+
+/*
+ * If the file now exceeds its maximum size threshold, note it so that
+ * it will not be logged to any more.
+ */
+static void
+file_checksize(isc_logchannel_t *channel) {
+	struct stat statbuf;
+
+	if (FILE_MAXSIZE(channel) > 0) {
+		INSIST(channel->type == ISC_LOG_TOFILE);
+
+		/* XXXDCL NT fstat/fileno */
+		/* XXXDCL complain if fstat fails? */
+		if (fstat(fileno(FILE_STREAM(channel)), &statbuf) >= 0 &&
+		    statbuf.st_size > FILE_MAXSIZE(channel))
+			FILE_MAXREACHED(channel) = ISC_TRUE;
+	}
+}
+
+#ifdef USE_ASYNC_CHANNELS
+/*
+ * Write out everything in 'iov', retrying after short writes.  Lines
+ * that cannot be written are lost, as they would be with stdio.
+ */
+static void
+async_writev(int fd, struct iovec *iov, int iovcnt) {
+	ssize_t n;
+
+	while (iovcnt > 0) {
+		n = writev(fd, iov, iovcnt);
+		if (n < 0) {
+			if (errno == EINTR)
+				continue;
+			return;
+		}
+		while (iovcnt > 0 && (size_t)n >= iov->iov_len) {
+			n -= iov->iov_len;
+			iov++;
+			iovcnt--;
+		}
+		if (iovcnt > 0) {
+			iov->iov_base = (char *)iov->iov_base + n;
+			iov->iov_len -= n;
+		}
+	}
+}
+
+/*
+ * Write ring[tail, head) and, if lines were dropped since the last pass,
+ * a note saying how many.
+ */
+static void
+async_write(isc_logchannel_t *channel, unsigned int tail, unsigned int head,
+	    unsigned int dropped)
+{
+	isc_logasync_t *async = channel->async;
+	struct iovec iov[3];
+	char note[128];
+	char time_string[64];
+	unsigned int off, len;
+	int iovcnt = 0;
+
+	if (channel->type == ISC_LOG_TOFILE && !file_ready(channel))
+		return;
+
+	off = tail & (LOG_ASYNC_RINGSIZE - 1);
+	len = head - tail;
+	if (len > 0) {
+		iov[iovcnt].iov_base = async->ring + off;
+		iov[iovcnt].iov_len = ISC_MIN(len, LOG_ASYNC_RINGSIZE - off);
+		len -= iov[iovcnt++].iov_len;
+	}
+	if (len > 0) {
+		iov[iovcnt].iov_base = async->ring;
+		iov[iovcnt++].iov_len = len;
+	}
+
+	if (dropped > 0) {
+		time_string[0] = '\0';
+		if ((channel->flags & ISC_LOG_PRINTTIME) != 0) {
+			isc_time_t isctime;
+
+			TIME_NOW(&isctime);
+			isc_time_formattimestamp(&isctime, time_string,
+						 sizeof(time_string));
+			strcat(time_string, " ");
+		}
+		snprintf(note, sizeof(note), "%s%u log messages dropped\n",
+			 time_string, dropped);
+		iov[iovcnt].iov_base = note;
+		iov[iovcnt++].iov_len = strlen(note);
+	}
+
+	async_writev(fileno(FILE_STREAM(channel)), iov, iovcnt);
+
+	file_checksize(channel);
+}
+
+static isc_threadresult_t
+#ifdef _WIN32
+WINAPI
+#endif
+async_run(isc_threadarg_t arg) {
+	isc_logchannel_t *channel = arg;
+	isc_logasync_t *async = channel->async;
+	unsigned int head, tail, dropped;
+	isc_boolean_t reopen, shutdown;
+
+	LOCK(&async->lock);
+	for (;;) {
+		while (async->head == async->tail && async->dropped == 0 &&
+		       !async->reopen && !async->shutdown) {
+			async->idle = ISC_TRUE;
+			WAIT(&async->ready, &async->lock);
+			async->idle = ISC_FALSE;
+		}
+
+		if (async->head - async->tail < LOG_ASYNC_BATCH &&
+		    !async->reopen && !async->shutdown) {
+			isc_interval_t interval;
+			isc_time_t when;
+
+			isc_interval_set(&interval, 0, LOG_ASYNC_DELAY);
+			if (isc_time_nowplusinterval(&when, &interval) ==
+			    ISC_R_SUCCESS)
+				(void)WAITUNTIL(&async->ready, &async->lock,
+						&when);
+		}
+
+		/*
+		 * Lines queued after a reopen was asked for go to the
+		 * new file, in the next pass.
+		 */
+		head = async->head;
+		tail = async->tail;
+		dropped = async->dropped;
+		async->dropped = 0;
+		reopen = async->reopen;
+		async->reopen = ISC_FALSE;
+		if (reopen)
+			head = async->reopenhead;
+		shutdown = async->shutdown;
+		UNLOCK(&async->lock);
+
+		if (head != tail || dropped != 0)
+			async_write(channel, tail, head, dropped);
+
+		if (reopen && FILE_STREAM(channel) != NULL) {
+			(void)fclose(FILE_STREAM(channel));
+			FILE_STREAM(channel) = NULL;
+		}
+
+		LOCK(&async->lock);
+		async->tail = head;
+		BROADCAST(&async->space);
+		if (shutdown && async->head == async->tail)
+			break;
+	}
+	UNLOCK(&async->lock);
+
+	return ((isc_threadresult_t)0);
+}
+
+static isc_result_t
+async_create(isc_mem_t *mctx, isc_logchannel_t *channel) {
+	isc_logasync_t *async;
+	isc_result_t result;
+
+	async = isc_mem_get(mctx, sizeof(*async));
+	if (async == NULL)
+		return (ISC_R_NOMEMORY);
+
+	async->ring = isc_mem_get(mctx, LOG_ASYNC_RINGSIZE);
+	if (async->ring == NULL) {
+		result = ISC_R_NOMEMORY;
+		goto cleanup_async;
+	}
+	async->head = 0;
+	async->tail = 0;
+	async->dropped = 0;
+	async->idle = ISC_FALSE;
+	async->reopen = ISC_FALSE;
+	async->reopenhead = 0;
+	async->shutdown = ISC_FALSE;
+
+	result = isc_mutex_init(&async->lock);
+	if (result != ISC_R_SUCCESS)
+		goto cleanup_ring;
+	result = isc_condition_init(&async->ready);
+	if (result != ISC_R_SUCCESS)
+		goto cleanup_lock;
+	result = isc_condition_init(&async->space);
+	if (result != ISC_R_SUCCESS)
+		goto cleanup_ready;
+
+	channel->async = async;
+	result = isc_thread_create(async_run, channel, &async->thread);
+	if (result != ISC_R_SUCCESS) {
+		channel->async = NULL;
+		goto cleanup_space;
+	}
+
+	return (ISC_R_SUCCESS);
+
+ cleanup_space:
+	(void)isc_condition_destroy(&async->space);
+ cleanup_ready:
+	(void)isc_condition_destroy(&async->ready);
+ cleanup_lock:
+	DESTROYLOCK(&async->lock);
+ cleanup_ring:
+	isc_mem_put(mctx, async->ring, LOG_ASYNC_RINGSIZE);
+ cleanup_async:
+	isc_mem_put(mctx, async, sizeof(*async));
+	return (result);
+}
+
+static void
+async_destroy(isc_mem_t *mctx, isc_logchannel_t *channel) {
+	isc_logasync_t *async = channel->async;
+
+	LOCK(&async->lock);
+	async->shutdown = ISC_TRUE;
+	SIGNAL(&async->ready);
+	UNLOCK(&async->lock);
+
+	(void)isc_thread_join(async->thread, NULL);
+
+	(void)isc_condition_destroy(&async->space);
+	(void)isc_condition_destroy(&async->ready);
+	DESTROYLOCK(&async->lock);
+	isc_mem_put(mctx, async->ring, LOG_ASYNC_RINGSIZE);
+	isc_mem_put(mctx, async, sizeof(*async));
+	channel->async = NULL;
+}
+
+/*
+ * Copy the line in lctx->record into the channel's ring.  When the ring
+ * is full the line is dropped, or with #ISC_LOG_ASYNCBLOCK the caller
+ * waits for the writer to make room.
+ */
+static void
+async_queue(isc_log_t *lctx, isc_logchannel_t *channel, size_t len) {
+	isc_logasync_t *async = channel->async;
+	unsigned int off, first, used;
+
+	LOCK(&async->lock);
+	while (LOG_ASYNC_RINGSIZE - (async->head - async->tail) < len) {
+		if ((channel->flags & ISC_LOG_ASYNCBLOCK) == 0) {
+			async->dropped++;
+			lctx->dropped++;
+			UNLOCK(&async->lock);
+			return;
+		}
+		WAIT(&async->space, &async->lock);
+	}
+
+	off = async->head & (LOG_ASYNC_RINGSIZE - 1);
+	first = ISC_MIN(len, LOG_ASYNC_RINGSIZE - off);
+	memmove(async->ring + off, lctx->record, first);
+	memmove(async->ring, lctx->record + first, len - first);
+
+	/*
+	 * Wake the writer for the first line after it went idle, and
+	 * again when a full batch is waiting.
+	 */
+	used = async->head - async->tail;
+	async->head += len;
+	if (async->idle ||
+	    (used < LOG_ASYNC_BATCH && used + len >= LOG_ASYNC_BATCH))
+		SIGNAL(&async->ready);
+	UNLOCK(&async->lock);
+}
+#endif /* USE_ASYNC_CHANNELS */
+
 isc_boolean_t
 isc_log_wouldlog(isc_log_t *lctx, int level) {
 	/*
@@ -1412,14 +1878,12 @@ isc_log_doit(isc_log_t *lctx, isc_logcategory_t *category,
 	char time_string[64];
 	char level_string[24];
 	const char *iformat;
-	struct stat statbuf;
 	isc_boolean_t matched = ISC_FALSE;
 	isc_boolean_t printtime, printtag, printcolon;
 	isc_boolean_t printcategory, printmodule, printlevel;
 	isc_logconfig_t *lcfg;
 	isc_logchannel_t *channel;
 	isc_logchannellist_t *category_channels;
-	isc_result_t result;
 
 	REQUIRE(lctx == NULL || VALID_CONTEXT(lctx));
 	REQUIRE(category != NULL);
@@ -1655,48 +2119,40 @@ isc_log_doit(isc_log_t *lctx, isc_logcategory_t *category,
 		printlevel    = ISC_TF((channel->flags & ISC_LOG_PRINTLEVEL)
 				       != 0);
 
-		switch (channel->type) {
-		case ISC_LOG_TOFILE:
-			if (FILE_MAXREACHED(channel)) {
-				/*
-				 * If the file can be rolled, OR
-				 * If the file no longer exists, OR
-				 * If the file is less than the maximum size,
-				 *    (such as if it had been renamed and
-				 *     a new one touched, or it was truncated
-				 *     in place)
-				 * ... then close it to trigger reopening.
-				 */
-				if (FILE_VERSIONS(channel) !=
-				    ISC_LOG_ROLLNEVER ||
-				    (stat(FILE_NAME(channel), &statbuf) != 0 &&
-				     errno == ENOENT) ||
-				    statbuf.st_size < FILE_MAXSIZE(channel)) {
-					(void)fclose(FILE_STREAM(channel));
-					FILE_STREAM(channel) = NULL;
-					FILE_MAXREACHED(channel) = ISC_FALSE;
-				} else
-					/*
-					 * Eh, skip it.
-					 */
-					break;
+#ifdef USE_ASYNC_CHANNELS
+		if (channel->async != NULL) {
+			int n;
+
+			n = snprintf(lctx->record, sizeof(lctx->record),
+				     "%s%s%s%s%s%s%s%s%s%s\n",
+				     printtime     ? time_string	: "",
+				     printtime     ? " "		: "",
+				     printtag      ? lcfg->tag	: "",
+				     printcolon    ? ": "		: "",
+				     printcategory ? category->name	: "",
+				     printcategory ? ": "		: "",
+				     printmodule   ? (module != NULL
+						       ? module->name
+						       : "no_module")
+								: "",
+				     printmodule   ? ": "		: "",
+				     printlevel    ? level_string	: "",
+				     lctx->buffer);
+			if (n < 0)
+				continue;
+			if (n >= (int)sizeof(lctx->record)) {
+				n = sizeof(lctx->record) - 1;
+				lctx->record[n - 1] = '\n';
 			}
+			async_queue(lctx, channel, n);
+			continue;
+		}
+#endif
 
-			if (FILE_STREAM(channel) == NULL) {
-				result = isc_log_open(channel);
-				if (result != ISC_R_SUCCESS &&
-				    result != ISC_R_MAXSIZE &&
-				    (channel->flags & ISC_LOG_OPENERR) == 0) {
-					syslog(LOG_ERR,
-					       "isc_log_open '%s' failed: %s",
-					       FILE_NAME(channel),
-					       isc_result_totext(result));
-					channel->flags |= ISC_LOG_OPENERR;
-				}
-				if (result != ISC_R_SUCCESS)
-					break;
-				channel->flags &= ~ISC_LOG_OPENERR;
-			}
+		switch (channel->type) {
+		case ISC_LOG_TOFILE:
+			if (!file_ready(channel))
+				break;
 			/* FALLTHROUGH */
 
 		case ISC_LOG_TOFILEDESC:
@@ -1717,22 +2173,7 @@ isc_log_doit(isc_log_t *lctx, isc_logcategory_t *category,
 
 			fflush(FILE_STREAM(channel));
 
-			/*
-			 * If the file now exceeds its maximum size
-			 * threshold, note it so that it will not be logged
-			 * to any more.
-			 */
-			if (FILE_MAXSIZE(channel) > 0) {
-				INSIST(channel->type == ISC_LOG_TOFILE);
-
-				/* XXXDCL NT fstat/fileno */
-				/* XXXDCL complain if fstat fails? */
-				if (fstat(fileno(FILE_STREAM(channel)),
-					  &statbuf) >= 0 &&
-				    statbuf.st_size > FILE_MAXSIZE(channel))
-					FILE_MAXREACHED(channel) = ISC_TRUE;
-			}
-
+			file_checksize(channel);
 			break;
 
 		case ISC_LOG_TOSYSLOG:
@@ -27,6 +27,10 @@
 
 #include <limits.h>
 
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H)
+#include <sys/mman.h>
+#endif
+
 #include <isc/bind9.h>
 #include <isc/json.h>
 #include <isc/magic.h>
@@ -34,9 +38,11 @@
 #include <isc/msgs.h>
 #include <isc/once.h>
 #include <isc/ondestroy.h>
+#include <isc/platform.h>
 #include <isc/string.h>
 #include <isc/mutex.h>
 #include <isc/print.h>
+#include <isc/thread.h>
 #include <isc/util.h>
 #include <isc/xml.h>
 
@@ -48,6 +54,38 @@
 #endif
 LIBISC_EXTERNAL_DATA unsigned int isc_mem_debugging = ISC_MEM_DEBUGGING;
 
+/*
+ * Threads keep per-context caches of free fragments only when there can
+ * be more than one of them.
+ */
+#ifdef ISC_PLATFORM_USETHREADS
+#define USE_MEMCACHE
+#endif /* ISC_PLATFORM_USETHREADS */
+
+/*
+ * Huge page backed basic blocks need anonymous mappings.
+ */
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H)
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+#ifdef MAP_ANONYMOUS
+#define USE_HUGEPAGES
+#endif
+#endif
+
+/*
+ * Preferring a NUMA node for the basic blocks needs mbind(2), which libc
+ * only wraps with libnuma; call it directly.
+ */
+#if defined(USE_HUGEPAGES) && defined(__linux)
+#include <sys/syscall.h>
+#include <unistd.h>
+#ifdef SYS_mbind
+#define USE_MEMNODES
+#endif
+#endif
+
 /*
  * Constants.
  */
@@ -58,6 +96,20 @@ LIBISC_EXTERNAL_DATA unsigned int isc_mem_debugging = ISC_MEM_DEBUGGING;
 #define NUM_BASIC_BLOCKS	64		/*%< must be > 1 */
 #define TABLE_INCREMENT		1024
 #define DEBUGLIST_COUNT		1024
+#define CACHE_THREADS		64		/*%< threads with a cache */
+#define CACHE_BATCH		1024		/*%< bytes moved at once */
+#define CACHE_MAXITEMS		32		/*%< largest batch, in items */
+#define CACHE_MAXBYTES		32768		/*%< per thread and context */
+#define HUGEPAGE_SIZE		(2U * 1024 * 1024)
+#define MEM_MAXNODES		64		/*%< NUMA nodes we can prefer */
+#define MEM_MPOL_PREFERRED	1		/*%< MPOL_PREFERRED of mbind(2) */
+
+/*
+ * How the memory of each entry of basic_table was obtained.
+ */
+#define CHUNK_MAPPED		0x01		/*%< mmap(), not memalloc */
+#define CHUNK_HUGE		0x02		/*%< on huge pages */
+#define CHUNK_NODE		0x04		/*%< on the preferred node */
 
 /*
  * Types.
@@ -106,6 +158,28 @@ struct stats {
 	unsigned long		freefrags;
 };
 
+#ifdef USE_MEMCACHE
+/*%
+ * A thread's cache of free fragments of one memory context, one
+ * "magazine" per size class.  Fragments are taken from the context's
+ * free lists and given back to them in batches of about CACHE_BATCH
+ * bytes, so the context lock is only taken once per batch.
+ *
+ * Fragments in a cache are accounted as in use by the context (in
+ * 'inuse' and stats[].gets) from the time they are taken until they are
+ * given back, which keeps the water marks and the leak check simple;
+ * memused() leaves them out again when 'inuse' is reported.  Only the
+ * gets served from the cache are counted here, and added to
+ * stats[].totalgets with the next batch.
+ */
+typedef struct memcache {
+	size_t			bytes;		/*%< in all magazines */
+	element **		items;		/*%< per size class */
+	unsigned int *		count;		/*%< per size class */
+	unsigned long *		gets;		/*%< per size class */
+} memcache_t;
+#endif /* USE_MEMCACHE */
+
 #define MEM_MAGIC		ISC_MAGIC('M', 'e', 'm', 'C')
 #define VALID_CONTEXT(c)	ISC_MAGIC_VALID(c, MEM_MAGIC)
 
@@ -121,6 +195,18 @@ static isc_once_t		once = ISC_ONCE_INIT;
 static isc_mutex_t		lock;
 static isc_mutex_t 		createlock;
 
+#ifdef USE_MEMCACHE
+/*%
+ * Each thread that allocates from a memory context gets a cache slot
+ * number, stored (plus one) as its thread specific value; the slot is
+ * given back when the thread exits, and the next thread to take it
+ * inherits the caches.  Threads beyond CACHE_THREADS have no caches.
+ * Locked by the global lock.
+ */
+static isc_thread_key_t		cachekey;
+static isc_boolean_t		cacheslots[CACHE_THREADS];
+#endif /* USE_MEMCACHE */
+
 /*%
  * Total size of lost memory due to a bug of external library.
  * Locked by the global lock.
@@ -163,6 +249,15 @@ struct isc__mem {
 	unsigned int		basic_table_size;
 	unsigned char *		lowest;
 	unsigned char *		highest;
+	unsigned char *		basic_chunks;	/*%< CHUNK_* per table entry */
+	size_t			blocksize;	/*%< in basic blocks */
+	isc_boolean_t		hugepages;
+	size_t			hugesize;	/*%< on huge pages */
+	int			node;		/*%< preferred NUMA node */
+	size_t			nodesize;	/*%< on that node */
+#ifdef USE_MEMCACHE
+	memcache_t **		caches;		/*%< per cache slot */
+#endif
 
 #if ISC_MEM_TRACKLINES
 	debuglist_t *	 	debuglist;
@@ -513,22 +608,118 @@ quantize(size_t size) {
 	return ((size + ALIGNMENT_SIZE - 1) & (~(ALIGNMENT_SIZE - 1)));
 }
 
+#ifdef USE_HUGEPAGES
+/*%
+ * Map 'size' bytes aligned to a huge page.  Explicit huge pages are used
+ * if some are reserved, otherwise the kernel is asked to back the mapping
+ * with transparent huge pages.  '*chunkp' tells which of these happened.
+ */
+static void *
+huge_map(size_t size, unsigned char *chunkp) {
+	unsigned char *p, *aligned;
+	size_t head;
+
+#ifdef MAP_HUGETLB
+	if (size % HUGEPAGE_SIZE == 0) {
+		p = mmap(NULL, size, PROT_READ | PROT_WRITE,
+			 MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+		if (p != MAP_FAILED) {
+			*chunkp = CHUNK_MAPPED | CHUNK_HUGE;
+			return (p);
+		}
+	}
+#endif
+
+	/*
+	 * Map a huge page more than needed and trim it to alignment.
+	 */
+	p = mmap(NULL, size + HUGEPAGE_SIZE, PROT_READ | PROT_WRITE,
+		 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (p == MAP_FAILED)
+		return (NULL);
+	aligned = (unsigned char *)(((size_t)p + HUGEPAGE_SIZE - 1) &
+				    ~((size_t)HUGEPAGE_SIZE - 1));
+	head = aligned - p;
+	if (head != 0U)
+		(void)munmap(p, head);
+	(void)munmap(aligned + size, HUGEPAGE_SIZE - head);
+
+	*chunkp = CHUNK_MAPPED;
+#ifdef MADV_HUGEPAGE
+	if (madvise(aligned, size, MADV_HUGEPAGE) == 0)
+		*chunkp |= CHUNK_HUGE;
+#endif
+	return (aligned);
+}
+
+/*%
+ * Map 'size' bytes of ordinary pages.
+ */
+static void *
+page_map(size_t size, unsigned char *chunkp) {
+	void *p;
+
+	p = mmap(NULL, size, PROT_READ | PROT_WRITE,
+		 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (p == MAP_FAILED)
+		return (NULL);
+	*chunkp = CHUNK_MAPPED;
+	return (p);
+}
+#endif /* USE_HUGEPAGES */
+
+#ifdef USE_MEMNODES
+/*%
+ * Ask for the pages of the fresh mapping 'p' to come from NUMA node 'node'
+ * when they are first touched.  This is a preference, not a binding, so
+ * a node which runs out of memory does not make allocations fail.
+ */
+static isc_boolean_t
+node_bind(void *p, size_t size, int node) {
+	unsigned long mask[MEM_MAXNODES / (8 * sizeof(unsigned long))];
+	const unsigned int bits = 8 * sizeof(unsigned long);
+
+	memset(mask, 0, sizeof(mask));
+	mask[node / bits] |= 1UL << (node % bits);
+	return (ISC_TF(syscall(SYS_mbind, p, (unsigned long)size,
+			       MEM_MPOL_PREFERRED, mask,
+			       (unsigned long)MEM_MAXNODES + 1, 0U) == 0));
+}
+#endif /* USE_MEMNODES */
+
+/*%
+ * The number of basic blocks got from the system at once.  A context which
+ * maps its blocks, for huge pages or a NUMA node, gets a huge page worth
+ * of them.
+ */
+static inline unsigned int
+basic_count(isc__mem_t *ctx, unsigned char chunk) {
+	if ((chunk & CHUNK_MAPPED) != 0 && ctx->mem_target <= HUGEPAGE_SIZE)
+		return (HUGEPAGE_SIZE / ctx->mem_target);
+	return (NUM_BASIC_BLOCKS);
+}
+
 static inline isc_boolean_t
 more_basic_blocks(isc__mem_t *ctx) {
-	void *new;
+	void *new = NULL;
 	unsigned char *curr, *next;
 	unsigned char *first, *last;
 	unsigned char **table;
-	unsigned int table_size;
+	unsigned char *chunks;
+	unsigned char chunk = 0;
+	unsigned int table_size, nblocks, i;
 	size_t increment;
-	int i;
 
 	/* Require: we hold the context lock. */
 
+	if (ctx->hugepages || ctx->node >= 0)
+		chunk = CHUNK_MAPPED;
+	nblocks = basic_count(ctx, chunk);
+
 	/*
 	 * Did we hit the quota for this context?
 	 */
-	increment = NUM_BASIC_BLOCKS * ctx->mem_target;
+	increment = nblocks * ctx->mem_target;
 	if (ctx->quota != 0U && ctx->total + increment > ctx->quota)
 		return (ISC_FALSE);
 
@@ -541,28 +732,71 @@ more_basic_blocks(isc__mem_t *ctx) {
 			ctx->memalloc_failures++;
 			return (ISC_FALSE);
 		}
+		chunks = (ctx->memalloc)(ctx->arg, table_size);
+		if (chunks == NULL) {
+			(ctx->memfree)(ctx->arg, table);
+			ctx->memalloc_failures++;
+			return (ISC_FALSE);
+		}
 		if (ctx->basic_table_size != 0) {
 			memmove(table, ctx->basic_table,
 				ctx->basic_table_size *
 				  sizeof(unsigned char *));
+			memmove(chunks, ctx->basic_chunks,
+				ctx->basic_table_size);
 			(ctx->memfree)(ctx->arg, ctx->basic_table);
+			(ctx->memfree)(ctx->arg, ctx->basic_chunks);
 		}
 		ctx->basic_table = table;
+		ctx->basic_chunks = chunks;
 		ctx->basic_table_size = table_size;
 	}
 
-	new = (ctx->memalloc)(ctx->arg, NUM_BASIC_BLOCKS * ctx->mem_target);
+#ifdef USE_HUGEPAGES
+	if ((chunk & CHUNK_MAPPED) != 0) {
+		if (ctx->hugepages)
+			new = huge_map(increment, &chunk);
+		else
+			new = page_map(increment, &chunk);
+	}
+#endif
+#ifdef USE_MEMNODES
+	/*
+	 * Nothing has touched the mapping yet, so none of its pages have
+	 * been placed.
+	 */
+	if (new != NULL && ctx->node >= 0 &&
+	    node_bind(new, increment, ctx->node))
+		chunk |= CHUNK_NODE;
+#endif
+	if (new == NULL) {
+		/*
+		 * Fall back to the regular allocator.
+		 */
+		if ((chunk & CHUNK_MAPPED) != 0) {
+			chunk = 0;
+			nblocks = basic_count(ctx, chunk);
+			increment = nblocks * ctx->mem_target;
+		}
+		new = (ctx->memalloc)(ctx->arg, increment);
+	}
 	if (new == NULL) {
 		ctx->memalloc_failures++;
 		return (ISC_FALSE);
 	}
 	ctx->total += increment;
+	ctx->blocksize += increment;
+	if ((chunk & CHUNK_HUGE) != 0)
+		ctx->hugesize += increment;
+	if ((chunk & CHUNK_NODE) != 0)
+		ctx->nodesize += increment;
 	ctx->basic_table[ctx->basic_table_count] = new;
+	ctx->basic_chunks[ctx->basic_table_count] = chunk;
 	ctx->basic_table_count++;
 
 	curr = new;
 	next = curr + ctx->mem_target;
-	for (i = 0; i < (NUM_BASIC_BLOCKS - 1); i++) {
+	for (i = 0; i < (nblocks - 1); i++) {
 		((element *)curr)->next = (element *)next;
 		curr = next;
 		next += ctx->mem_target;
@@ -573,7 +807,7 @@ more_basic_blocks(isc__mem_t *ctx) {
 	 */
 	((element *)curr)->next = NULL;
 	first = new;
-	last = first + NUM_BASIC_BLOCKS * ctx->mem_target - 1;
+	last = first + increment - 1;
 	if (first < ctx->lowest || ctx->lowest == NULL)
 		ctx->lowest = first;
 	if (last > ctx->highest)
@@ -691,13 +925,13 @@ mem_getunlocked(isc__mem_t *ctx, size_t size) {
 	ctx->freelists[new_size] = ctx->freelists[new_size]->next;
 
 	/*
-	 * The stats[] uses the _actual_ "size" requested by the
-	 * caller, with the caveat (in the code above) that "size" >= the
-	 * max. size (max_size) ends up getting recorded as a call to
-	 * max_size.
+	 * The stats[] also uses the "rounded-up" size, as the fragment
+	 * may be given back through a thread's cache which only knows the
+	 * size class.  "size" >= the max. size (max_size) ends up getting
+	 * recorded as a call to max_size (in the code above).
 	 */
-	ctx->stats[size].gets++;
-	ctx->stats[size].totalgets++;
+	ctx->stats[new_size].gets++;
+	ctx->stats[new_size].totalgets++;
 	ctx->stats[new_size].freefrags--;
 	ctx->inuse += new_size;
 
@@ -761,13 +995,11 @@ mem_putunlocked(isc__mem_t *ctx, void *mem, size_t size) {
 	ctx->freelists[new_size] = (element *)mem;
 
 	/*
-	 * The stats[] uses the _actual_ "size" requested by the
-	 * caller, with the caveat (in the code above) that "size" >= the
-	 * max. size (max_size) ends up getting recorded as a call to
-	 * max_size.
+	 * The stats[] also uses the "rounded-up" size; see
+	 * mem_getunlocked().
 	 */
-	INSIST(ctx->stats[size].gets != 0U);
-	ctx->stats[size].gets--;
+	INSIST(ctx->stats[new_size].gets != 0U);
+	ctx->stats[new_size].gets--;
 	ctx->stats[new_size].freefrags++;
 	ctx->inuse -= new_size;
 }
@@ -853,6 +1085,327 @@ mem_putstats(isc__mem_t *ctx, void *ptr, size_t size) {
 	}
 }
 
+#ifdef USE_MEMCACHE
+/*
+ * Thread caches.
+ */
+
+/*%
+ * Thread caches are bypassed while allocations are traced or recorded.
+ */
+#define CACHE_USABLE(c) \
+	((c)->caches != NULL && \
+	 (isc_mem_debugging & (ISC_MEM_DEBUGTRACE|ISC_MEM_DEBUGRECORD)) == 0)
+
+static void
+cache_release(void *value) {
+	size_t slot = (size_t)value - 1;
+
+	if (slot >= CACHE_THREADS)
+		return;
+	LOCK(&lock);
+	cacheslots[slot] = ISC_FALSE;
+	UNLOCK(&lock);
+}
+
+static inline unsigned int
+cache_batch(size_t new_size) {
+	size_t n = CACHE_BATCH / new_size;
+
+	if (n == 0U)
+		n = 1;
+	else if (n > CACHE_MAXITEMS)
+		n = CACHE_MAXITEMS;
+	return ((unsigned int)n);
+}
+
+static memcache_t *
+cache_create(isc__mem_t *ctx, size_t slot) {
+	memcache_t *cache;
+	size_t nclasses = ctx->max_size / ALIGNMENT_SIZE + 1;
+	unsigned char *p;
+
+	p = (ctx->memalloc)(ctx->arg, sizeof(*cache) +
+			    nclasses * (sizeof(element *) +
+					sizeof(unsigned long) +
+					sizeof(unsigned int)));
+	if (p == NULL)
+		return (NULL);
+	cache = (memcache_t *)p;
+	p += sizeof(*cache);
+	cache->items = (element **)p;
+	p += nclasses * sizeof(element *);
+	cache->gets = (unsigned long *)p;
+	p += nclasses * sizeof(unsigned long);
+	cache->count = (unsigned int *)p;
+	cache->bytes = 0;
+	memset(cache->items, 0, nclasses * sizeof(element *));
+	memset(cache->gets, 0, nclasses * sizeof(unsigned long));
+	memset(cache->count, 0, nclasses * sizeof(unsigned int));
+
+	MCTXLOCK(ctx, &ctx->lock);
+	ctx->caches[slot] = cache;
+	MCTXUNLOCK(ctx, &ctx->lock);
+
+	return (cache);
+}
+
+/*%
+ * Return the calling thread's cache for 'ctx', or NULL if it has none.
+ */
+static inline memcache_t *
+cache_self(isc__mem_t *ctx) {
+	memcache_t *cache;
+	size_t slot;
+
+	slot = (size_t)isc_thread_key_getspecific(cachekey);
+	if (slot == 0U) {
+		/*
+		 * First allocation by this thread: take the lowest free
+		 * slot, or remember that there was none.
+		 */
+		LOCK(&lock);
+		for (slot = 0; slot < CACHE_THREADS; slot++)
+			if (!cacheslots[slot])
+				break;
+		if (slot < CACHE_THREADS)
+			cacheslots[slot] = ISC_TRUE;
+		UNLOCK(&lock);
+		slot++;
+		if (isc_thread_key_setspecific(cachekey, (void *)slot) != 0) {
+			cache_release((void *)slot);
+			return (NULL);
+		}
+	}
+	slot--;
+	if (slot >= CACHE_THREADS)
+		return (NULL);
+
+	/*
+	 * Only this thread sets its slot of ctx->caches.
+	 */
+	cache = ctx->caches[slot];
+	if (cache == NULL)
+		cache = cache_create(ctx, slot);
+	return (cache);
+}
+
+/*%
+ * Give 'n' fragments of size 'new_size' back to the context's free list.
+ * The caller must hold the context lock, if it needs one.
+ */
+static inline void
+cache_returnunlocked(isc__mem_t *ctx, memcache_t *cache, size_t new_size,
+		     unsigned int n)
+{
+	size_t c = new_size / ALIGNMENT_SIZE;
+	element *item;
+	unsigned int i;
+
+	INSIST(cache->count[c] >= n);
+	for (i = 0; i < n; i++) {
+		item = cache->items[c];
+		cache->items[c] = item->next;
+		item->next = ctx->freelists[new_size];
+		ctx->freelists[new_size] = item;
+	}
+	cache->count[c] -= n;
+	cache->bytes -= n * new_size;
+
+	INSIST(ctx->stats[new_size].gets >= n);
+	ctx->stats[new_size].gets -= n;
+	ctx->stats[new_size].totalgets += cache->gets[c];
+	ctx->stats[new_size].freefrags += n;
+	cache->gets[c] = 0;
+	INSIST(ctx->inuse >= n * new_size);
+	ctx->inuse -= n * new_size;
+}
+
+static void
+cache_return(isc__mem_t *ctx, memcache_t *cache, size_t new_size,
+	     unsigned int n)
+{
+	isc_boolean_t call_water = ISC_FALSE;
+
+	MCTXLOCK(ctx, &ctx->lock);
+	cache_returnunlocked(ctx, cache, new_size, n);
+
+	/*
+	 * See isc___mem_put().
+	 */
+	if (ctx->is_overmem &&
+	    (ctx->inuse < ctx->lo_water || ctx->lo_water == 0U)) {
+		ctx->is_overmem = ISC_FALSE;
+	}
+	if (ctx->hi_called &&
+	    (ctx->inuse < ctx->lo_water || ctx->lo_water == 0U)) {
+		if (ctx->water != NULL)
+			call_water = ISC_TRUE;
+	}
+	MCTXUNLOCK(ctx, &ctx->lock);
+
+	if (call_water)
+		(ctx->water)(ctx->water_arg, ISC_MEM_LOWATER);
+}
+
+/*%
+ * Move a batch of fragments of size 'new_size' from the context's free
+ * list to 'cache'.
+ */
+static isc_boolean_t
+cache_fill(isc__mem_t *ctx, memcache_t *cache, size_t new_size) {
+	size_t c = new_size / ALIGNMENT_SIZE;
+	unsigned int n, want = cache_batch(new_size);
+	isc_boolean_t call_water = ISC_FALSE;
+	element *item;
+
+	MCTXLOCK(ctx, &ctx->lock);
+	for (n = 0; n < want; n++) {
+		if (ctx->freelists[new_size] == NULL &&
+		    !more_frags(ctx, new_size))
+			break;
+		item = ctx->freelists[new_size];
+		ctx->freelists[new_size] = item->next;
+		item->next = cache->items[c];
+		cache->items[c] = item;
+	}
+	cache->count[c] += n;
+	cache->bytes += n * new_size;
+
+	ctx->stats[new_size].gets += n;
+	ctx->stats[new_size].totalgets += cache->gets[c];
+	ctx->stats[new_size].freefrags -= n;
+	cache->gets[c] = 0;
+	ctx->inuse += n * new_size;
+
+	/*
+	 * See isc___mem_get().
+	 */
+	if (ctx->hi_water != 0U && ctx->inuse > ctx->hi_water &&
+	    !ctx->is_overmem) {
+		ctx->is_overmem = ISC_TRUE;
+	}
+	if (ctx->hi_water != 0U && !ctx->hi_called &&
+	    ctx->inuse > ctx->hi_water) {
+		call_water = ISC_TRUE;
+	}
+	if (ctx->inuse > ctx->maxinuse)
+		ctx->maxinuse = ctx->inuse;
+	MCTXUNLOCK(ctx, &ctx->lock);
+
+	if (call_water)
+		(ctx->water)(ctx->water_arg, ISC_MEM_HIWATER);
+
+	return (ISC_TF(n > 0));
+}
+
+/*%
+ * Get a fragment for 'size' bytes from the calling thread's cache,
+ * refilling it if needed.  Returns NULL if the cache cannot serve it;
+ * the caller then has to use the context.
+ */
+static inline void *
+cache_get(isc__mem_t *ctx, size_t size) {
+	size_t new_size = quantize(size);
+	size_t c = new_size / ALIGNMENT_SIZE;
+	memcache_t *cache;
+	element *item;
+
+	if (size >= ctx->max_size || new_size >= ctx->max_size)
+		return (NULL);
+	cache = cache_self(ctx);
+	if (cache == NULL)
+		return (NULL);
+
+	/*
+	 * Over the high water mark, fragments are taken from the context
+	 * one by one rather than stocking the cache.
+	 */
+	if (cache->count[c] == 0U &&
+	    (ctx->is_overmem || !cache_fill(ctx, cache, new_size)))
+		return (NULL);
+
+	item = cache->items[c];
+	cache->items[c] = item->next;
+	cache->count[c]--;
+	cache->bytes -= new_size;
+	cache->gets[c]++;
+
+#if ISC_MEM_FILL
+	memset(item, 0xbe, new_size); /* Mnemonic for "beef". */
+#endif
+
+	return (item);
+}
+
+/*%
+ * Put 'mem' into the calling thread's cache, giving a batch back to the
+ * context if the magazine is full.  Returns ISC_FALSE if the caller has
+ * to give it back to the context itself.
+ */
+static inline isc_boolean_t
+cache_put(isc__mem_t *ctx, void *mem, size_t size) {
+	size_t new_size = quantize(size);
+	size_t c = new_size / ALIGNMENT_SIZE;
+	memcache_t *cache;
+	unsigned int batch;
+
+	/*
+	 * Over the high water mark, memory goes straight back to the
+	 * context so that it notices when it drops below the low water
+	 * mark.
+	 */
+	if (new_size >= ctx->max_size || ctx->is_overmem)
+		return (ISC_FALSE);
+	cache = cache_self(ctx);
+	if (cache == NULL || cache->bytes + new_size > CACHE_MAXBYTES)
+		return (ISC_FALSE);
+
+	batch = cache_batch(new_size);
+	if (cache->count[c] >= 2 * batch)
+		cache_return(ctx, cache, new_size, batch);
+
+#if ISC_MEM_FILL
+#if ISC_MEM_CHECKOVERRUN
+	check_overrun(mem, size, new_size);
+#endif
+	memset(mem, 0xde, new_size); /* Mnemonic for "dead". */
+#endif
+
+	((element *)mem)->next = cache->items[c];
+	cache->items[c] = (element *)mem;
+	cache->count[c]++;
+	cache->bytes += new_size;
+
+	return (ISC_TRUE);
+}
+#endif /* USE_MEMCACHE */
+
+/*%
+ * Return the memory in use in 'ctx', leaving out the free fragments
+ * kept in thread caches.  The caller must hold the context lock.  The
+ * caches are read without their owners' cooperation, so the result is
+ * only exact while no thread is allocating from 'ctx'.
+ */
+static size_t
+memused(isc__mem_t *ctx) {
+#ifdef USE_MEMCACHE
+	size_t cached = 0;
+	unsigned int i;
+
+	if (ctx->caches != NULL) {
+		for (i = 0; i < CACHE_THREADS; i++)
+			if (ctx->caches[i] != NULL)
+				cached += ctx->caches[i]->bytes;
+		if (cached > ctx->inuse)
+			return (0);
+	}
+	return (ctx->inuse - cached);
+#else
+	return (ctx->inuse);
+#endif /* USE_MEMCACHE */
+}
+
 /*
  * Private.
  */
@@ -877,6 +1430,9 @@ initialize_action(void) {
 	RUNTIME_CHECK(isc_mutex_init(&lock) == ISC_R_SUCCESS);
 	ISC_LIST_INIT(contexts);
 	totallost = 0;
+#ifdef USE_MEMCACHE
+	RUNTIME_CHECK(isc_thread_key_create(&cachekey, cache_release) == 0);
+#endif
 }
 
 /*
@@ -961,6 +1517,15 @@ isc_mem_createx2(size_t init_max_size, size_t target_size,
 	ctx->basic_table_size = 0;
 	ctx->lowest = NULL;
 	ctx->highest = NULL;
+	ctx->basic_chunks = NULL;
+	ctx->blocksize = 0;
+	ctx->hugepages = ISC_FALSE;
+	ctx->hugesize = 0;
+	ctx->node = -1;
+	ctx->nodesize = 0;
+#ifdef USE_MEMCACHE
+	ctx->caches = NULL;
+#endif
 
 	ctx->stats = (memalloc)(arg,
 				(ctx->max_size+1) * sizeof(struct stats));
@@ -985,6 +1550,19 @@ isc_mem_createx2(size_t init_max_size, size_t target_size,
 		       ctx->max_size * sizeof(element *));
 	}
 
+#ifdef USE_MEMCACHE
+	if ((flags & ISC_MEMFLAG_INTERNAL) != 0 &&
+	    (flags & ISC_MEMFLAG_NOLOCK) == 0) {
+		ctx->caches = (memalloc)(arg, CACHE_THREADS *
+					      sizeof(memcache_t *));
+		if (ctx->caches == NULL) {
+			result = ISC_R_NOMEMORY;
+			goto error;
+		}
+		memset(ctx->caches, 0, CACHE_THREADS * sizeof(memcache_t *));
+	}
+#endif
+
 #if ISC_MEM_TRACKLINES
 	if ((isc_mem_debugging & ISC_MEM_DEBUGRECORD) != 0) {
 		unsigned int i;
@@ -1015,6 +1593,10 @@ isc_mem_createx2(size_t init_max_size, size_t target_size,
 			(memfree)(arg, ctx->stats);
 		if (ctx->freelists != NULL)
 			(memfree)(arg, ctx->freelists);
+#ifdef USE_MEMCACHE
+		if (ctx->caches != NULL)
+			(memfree)(arg, ctx->caches);
+#endif
 #if ISC_MEM_TRACKLINES
 		if (ctx->debuglist != NULL)
 			(ctx->memfree)(ctx->arg, ctx->debuglist);
@@ -1032,6 +1614,31 @@ destroy(isc__mem_t *ctx) {
 	unsigned int i;
 	isc_ondestroy_t ondest;
 
+#ifdef USE_MEMCACHE
+	/*
+	 * No other thread uses the context any more, so the fragments
+	 * left in their caches can be given back from here.
+	 */
+	if (ctx->caches != NULL) {
+		memcache_t *cache;
+		size_t c;
+
+		for (i = 0; i < CACHE_THREADS; i++) {
+			cache = ctx->caches[i];
+			if (cache == NULL)
+				continue;
+			for (c = 0; c <= ctx->max_size / ALIGNMENT_SIZE; c++)
+				if (cache->count[c] != 0U ||
+				    cache->gets[c] != 0U)
+					cache_returnunlocked(ctx, cache,
+							c * ALIGNMENT_SIZE,
+							cache->count[c]);
+			(ctx->memfree)(ctx->arg, cache);
+		}
+		(ctx->memfree)(ctx->arg, ctx->caches);
+	}
+#endif
+
 	LOCK(&lock);
 	ISC_LIST_UNLINK(contexts, ctx, link);
 	totallost += ctx->inuse;
@@ -1080,11 +1687,24 @@ destroy(isc__mem_t *ctx) {
 	(ctx->memfree)(ctx->arg, ctx->stats);
 
 	if ((ctx->flags & ISC_MEMFLAG_INTERNAL) != 0) {
-		for (i = 0; i < ctx->basic_table_count; i++)
+		for (i = 0; i < ctx->basic_table_count; i++) {
+#ifdef USE_HUGEPAGES
+			unsigned char chunk = ctx->basic_chunks[i];
+
+			if ((chunk & CHUNK_MAPPED) != 0) {
+				(void)munmap(ctx->basic_table[i],
+					     basic_count(ctx, chunk) *
+					     ctx->mem_target);
+				continue;
+			}
+#endif
 			(ctx->memfree)(ctx->arg, ctx->basic_table[i]);
+		}
 		(ctx->memfree)(ctx->arg, ctx->freelists);
-		if (ctx->basic_table != NULL)
+		if (ctx->basic_table != NULL) {
 			(ctx->memfree)(ctx->arg, ctx->basic_table);
+			(ctx->memfree)(ctx->arg, ctx->basic_chunks);
+		}
 	}
 
 	ondest = ctx->ondestroy;
@@ -1253,6 +1873,14 @@ isc___mem_get(isc_mem_t *ctx0, size_t size FLARG) {
 	if ((isc_mem_debugging & (ISC_MEM_DEBUGSIZE|ISC_MEM_DEBUGCTX)) != 0)
 		return (isc__mem_allocate(ctx0, size FLARG_PASS));
 
+#ifdef USE_MEMCACHE
+	if (CACHE_USABLE(ctx)) {
+		ptr = cache_get(ctx, size);
+		if (ptr != NULL)
+			return (ptr);
+	}
+#endif
+
 	if ((ctx->flags & ISC_MEMFLAG_INTERNAL) != 0) {
 		MCTXLOCK(ctx, &ctx->lock);
 		ptr = mem_getunlocked(ctx, size);
@@ -1309,6 +1937,11 @@ isc___mem_put(isc_mem_t *ctx0, void *ptr, size_t size FLARG) {
 		return;
 	}
 
+#ifdef USE_MEMCACHE
+	if (CACHE_USABLE(ctx) && cache_put(ctx, ptr, size))
+		return;
+#endif
+
 	MCTXLOCK(ctx, &ctx->lock);
 
 	DELETE_TRACE(ctx, ptr, size, file, line);
@@ -1512,6 +2145,17 @@ isc___mem_allocate(isc_mem_t *ctx0, size_t size FLARG) {
 
 	REQUIRE(VALID_CONTEXT(ctx));
 
+#ifdef USE_MEMCACHE
+	if (CACHE_USABLE(ctx) &&
+	    (isc_mem_debugging & ISC_MEM_DEBUGCTX) == 0) {
+		si = cache_get(ctx, size + ALIGNMENT_SIZE);
+		if (si != NULL) {
+			si->u.size = size + ALIGNMENT_SIZE;
+			return (&si[1]);
+		}
+	}
+#endif
+
 	if ((ctx->flags & ISC_MEMFLAG_INTERNAL) != 0) {
 		MCTXLOCK(ctx, &ctx->lock);
 		si = mem_allocateunlocked((isc_mem_t *)ctx, size);
@@ -1608,6 +2252,11 @@ isc___mem_free(isc_mem_t *ctx0, void *ptr FLARG) {
 		size = si->u.size;
 	}
 
+#ifdef USE_MEMCACHE
+	if (CACHE_USABLE(ctx) && cache_put(ctx, si, size))
+		return;
+#endif
+
 	MCTXLOCK(ctx, &ctx->lock);
 
 	DELETE_TRACE(ctx, ptr, size, file, line);
@@ -1717,7 +2366,7 @@ isc__mem_inuse(isc_mem_t *ctx0) {
 	REQUIRE(VALID_CONTEXT(ctx));
 	MCTXLOCK(ctx, &ctx->lock);
 
-	inuse = ctx->inuse;
+	inuse = memused(ctx);
 
 	MCTXUNLOCK(ctx, &ctx->lock);
 
@@ -1841,6 +2490,81 @@ isc_mem_gettag(isc_mem_t *ctx0) {
 	return (ctx->tag);
 }
 
+isc_result_t
+isc_mem_sethugepages(isc_mem_t *ctx0, isc_boolean_t flag) {
+	isc__mem_t *ctx = (isc__mem_t *)ctx0;
+	isc_result_t result = ISC_R_SUCCESS;
+
+	REQUIRE(VALID_CONTEXT(ctx));
+
+	MCTXLOCK(ctx, &ctx->lock);
+#ifdef USE_HUGEPAGES
+	if ((ctx->flags & ISC_MEMFLAG_INTERNAL) != 0)
+		ctx->hugepages = flag;
+	else if (flag)
+		result = ISC_R_NOTIMPLEMENTED;
+#else
+	if (flag)
+		result = ISC_R_NOTIMPLEMENTED;
+#endif
+	MCTXUNLOCK(ctx, &ctx->lock);
+
+	return (result);
+}
+
+isc_result_t
+isc_mem_setnode(isc_mem_t *ctx0, int node) {
+	isc__mem_t *ctx = (isc__mem_t *)ctx0;
+	isc_result_t result = ISC_R_SUCCESS;
+
+	REQUIRE(VALID_CONTEXT(ctx));
+	REQUIRE(node >= -1);
+
+	MCTXLOCK(ctx, &ctx->lock);
+#ifdef USE_MEMNODES
+	if (node >= MEM_MAXNODES)
+		result = ISC_R_RANGE;
+	else if ((ctx->flags & ISC_MEMFLAG_INTERNAL) != 0)
+		ctx->node = node;
+	else if (node >= 0)
+		result = ISC_R_NOTIMPLEMENTED;
+#else
+	if (node >= 0)
+		result = ISC_R_NOTIMPLEMENTED;
+#endif
+	MCTXUNLOCK(ctx, &ctx->lock);
+
+	return (result);
+}
+
+size_t
+isc_mem_nodesize(isc_mem_t *ctx0) {
+	isc__mem_t *ctx = (isc__mem_t *)ctx0;
+	size_t nodesize;
+
+	REQUIRE(VALID_CONTEXT(ctx));
+
+	MCTXLOCK(ctx, &ctx->lock);
+	nodesize = ctx->nodesize;
+	MCTXUNLOCK(ctx, &ctx->lock);
+
+	return (nodesize);
+}
+
+size_t
+isc_mem_hugepages(isc_mem_t *ctx0) {
+	isc__mem_t *ctx = (isc__mem_t *)ctx0;
+	size_t hugesize;
+
+	REQUIRE(VALID_CONTEXT(ctx));
+
+	MCTXLOCK(ctx, &ctx->lock);
+	hugesize = ctx->hugesize;
+	MCTXUNLOCK(ctx, &ctx->lock);
+
+	return (hugesize);
+}
+
 /*
  * Memory pool stuff
  */
@@ -2345,11 +3069,62 @@ isc_mem_references(isc_mem_t *ctx0) {
 	return (references);
 }
 
+/*%
+ * Bytes used by the bookkeeping of 'ctx' itself.  Requires ctx->lock.
+ */
+static size_t
+contextsize(isc__mem_t *ctx) {
+	size_t size;
+
+	size = sizeof(*ctx) +
+		(ctx->max_size + 1) * sizeof(struct stats) +
+		ctx->max_size * sizeof(element *) +
+		ctx->basic_table_size * (sizeof(char *) + 1);
+#if ISC_MEM_TRACKLINES
+	if (ctx->debuglist != NULL) {
+		size += (ctx->max_size + 1) * sizeof(debuglist_t) +
+			ctx->debuglistcnt * sizeof(debuglink_t);
+	}
+#endif
+	size += ctx->poolcnt * sizeof(isc_mempool_t);
+
+	return (size);
+}
+
+void
+isc_mem_summary(isc_memsummary_t *summary) {
+	isc__mem_t *ctx;
+
+	REQUIRE(summary != NULL);
+
+	memset(summary, 0, sizeof(*summary));
+
+	RUNTIME_CHECK(isc_once_do(&once, initialize_action) == ISC_R_SUCCESS);
+
+	LOCK(&lock);
+	summary->lost = totallost;
+	for (ctx = ISC_LIST_HEAD(contexts);
+	     ctx != NULL;
+	     ctx = ISC_LIST_NEXT(ctx, link)) {
+		MCTXLOCK(ctx, &ctx->lock);
+		summary->contexts++;
+		summary->contextsize += contextsize(ctx);
+		summary->total += ctx->total;
+		summary->inuse += memused(ctx);
+		if ((ctx->flags & ISC_MEMFLAG_INTERNAL) != 0)
+			summary->blocksize += ctx->blocksize;
+		summary->hugesize += ctx->hugesize;
+		MCTXUNLOCK(ctx, &ctx->lock);
+	}
+	UNLOCK(&lock);
+}
+
 #if defined(HAVE_LIBXML2) || defined(HAVE_JSON)
 typedef struct summarystat {
 	isc_uint64_t	total;
 	isc_uint64_t	inuse;
 	isc_uint64_t	blocksize;
+	isc_uint64_t	hugesize;
 	isc_uint64_t	contextsize;
 } summarystat_t;
 #endif
@@ -2378,17 +3153,7 @@ xml_renderctx(isc__mem_t *ctx, summarystat_t *summary,
 		TRY0(xmlTextWriterEndElement(writer)); /* name */
 	}
 
-	summary->contextsize += sizeof(*ctx) +
-		(ctx->max_size + 1) * sizeof(struct stats) +
-		ctx->max_size * sizeof(element *) +
-		ctx->basic_table_count * sizeof(char *);
-#if ISC_MEM_TRACKLINES
-	if (ctx->debuglist != NULL) {
-		summary->contextsize +=
-			(ctx->max_size + 1) * sizeof(debuglist_t) +
-			ctx->debuglistcnt * sizeof(debuglink_t);
-	}
-#endif
+	summary->contextsize += contextsize(ctx);
 	TRY0(xmlTextWriterStartElement(writer, ISC_XMLCHAR "references"));
 	TRY0(xmlTextWriterWriteFormatString(writer, "%d", ctx->references));
 	TRY0(xmlTextWriterEndElement(writer)); /* references */
@@ -2400,11 +3165,11 @@ xml_renderctx(isc__mem_t *ctx, summarystat_t *summary,
 					    (isc_uint64_t)ctx->total));
 	TRY0(xmlTextWriterEndElement(writer)); /* total */
 
-	summary->inuse += ctx->inuse;
+	summary->inuse += memused(ctx);
 	TRY0(xmlTextWriterStartElement(writer, ISC_XMLCHAR "inuse"));
 	TRY0(xmlTextWriterWriteFormatString(writer,
 					    "%" ISC_PRINT_QUADFORMAT "u",
-					    (isc_uint64_t)ctx->inuse));
+					    (isc_uint64_t)memused(ctx)));
 	TRY0(xmlTextWriterEndElement(writer)); /* inuse */
 
 	TRY0(xmlTextWriterStartElement(writer, ISC_XMLCHAR "maxinuse"));
@@ -2415,22 +3180,24 @@ xml_renderctx(isc__mem_t *ctx, summarystat_t *summary,
 
 	TRY0(xmlTextWriterStartElement(writer, ISC_XMLCHAR "blocksize"));
 	if ((ctx->flags & ISC_MEMFLAG_INTERNAL) != 0) {
-		summary->blocksize += ctx->basic_table_count *
-			NUM_BASIC_BLOCKS * ctx->mem_target;
+		summary->blocksize += ctx->blocksize;
 		TRY0(xmlTextWriterWriteFormatString(writer,
 					       "%" ISC_PRINT_QUADFORMAT "u",
-					       (isc_uint64_t)
-					       ctx->basic_table_count *
-					       NUM_BASIC_BLOCKS *
-					       ctx->mem_target));
+					       (isc_uint64_t)ctx->blocksize));
 	} else
 		TRY0(xmlTextWriterWriteFormatString(writer, "%s", "-"));
 	TRY0(xmlTextWriterEndElement(writer)); /* blocksize */
 
+	summary->hugesize += ctx->hugesize;
+	TRY0(xmlTextWriterStartElement(writer, ISC_XMLCHAR "hugepages"));
+	TRY0(xmlTextWriterWriteFormatString(writer,
+					    "%" ISC_PRINT_QUADFORMAT "u",
+					    (isc_uint64_t)ctx->hugesize));
+	TRY0(xmlTextWriterEndElement(writer)); /* hugepages */
+
 	TRY0(xmlTextWriterStartElement(writer, ISC_XMLCHAR "pools"));
 	TRY0(xmlTextWriterWriteFormatString(writer, "%u", ctx->poolcnt));
 	TRY0(xmlTextWriterEndElement(writer)); /* pools */
-	summary->contextsize += ctx->poolcnt * sizeof(isc_mempool_t);
 
 	TRY0(xmlTextWriterStartElement(writer, ISC_XMLCHAR "hiwater"));
 	TRY0(xmlTextWriterWriteFormatString(writer,
@@ -2500,6 +3267,12 @@ isc_mem_renderxml(xmlTextWriterPtr writer) {
 					    summary.blocksize));
 	TRY0(xmlTextWriterEndElement(writer)); /* BlockSize */
 
+	TRY0(xmlTextWriterStartElement(writer, ISC_XMLCHAR "HugePages"));
+	TRY0(xmlTextWriterWriteFormatString(writer,
+					    "%" ISC_PRINT_QUADFORMAT "u",
+					    summary.hugesize));
+	TRY0(xmlTextWriterEndElement(writer)); /* HugePages */
+
 	TRY0(xmlTextWriterStartElement(writer, ISC_XMLCHAR "ContextSize"));
 	TRY0(xmlTextWriterWriteFormatString(writer,
 					    "%" ISC_PRINT_QUADFORMAT "u",
@@ -2539,22 +3312,12 @@ json_renderctx(isc__mem_t *ctx, summarystat_t *summary, json_object *array) {
 
 	MCTXLOCK(ctx, &ctx->lock);
 
-	summary->contextsize += sizeof(*ctx) +
-		(ctx->max_size + 1) * sizeof(struct stats) +
-		ctx->max_size * sizeof(element *) +
-		ctx->basic_table_count * sizeof(char *);
+	summary->contextsize += contextsize(ctx);
 	summary->total += ctx->total;
-	summary->inuse += ctx->inuse;
+	summary->inuse += memused(ctx);
 	if ((ctx->flags & ISC_MEMFLAG_INTERNAL) != 0)
-		summary->blocksize += ctx->basic_table_count *
-			NUM_BASIC_BLOCKS * ctx->mem_target;
-#if ISC_MEM_TRACKLINES
-	if (ctx->debuglist != NULL) {
-		summary->contextsize +=
-			(ctx->max_size + 1) * sizeof(debuglist_t) +
-			ctx->debuglistcnt * sizeof(debuglink_t);
-	}
-#endif
+		summary->blocksize += ctx->blocksize;
+	summary->hugesize += ctx->hugesize;
 
 	ctxobj = json_object_new_object();
 	CHECKMEM(ctxobj);
@@ -2578,7 +3341,7 @@ json_renderctx(isc__mem_t *ctx, summarystat_t *summary, json_object *array) {
 	CHECKMEM(obj);
 	json_object_object_add(ctxobj, "total", obj);
 
-	obj = json_object_new_int64(ctx->inuse);
+	obj = json_object_new_int64(memused(ctx));
 	CHECKMEM(obj);
 	json_object_object_add(ctxobj, "inuse", obj);
 
@@ -2587,14 +3350,15 @@ json_renderctx(isc__mem_t *ctx, summarystat_t *summary, json_object *array) {
 	json_object_object_add(ctxobj, "maxinuse", obj);
 
 	if ((ctx->flags & ISC_MEMFLAG_INTERNAL) != 0) {
-		isc_uint64_t blocksize;
-		blocksize = ctx->basic_table_count * NUM_BASIC_BLOCKS *
-			ctx->mem_target;
-		obj = json_object_new_int64(blocksize);
+		obj = json_object_new_int64(ctx->blocksize);
 		CHECKMEM(obj);
 		json_object_object_add(ctxobj, "blocksize", obj);
 	}
 
+	obj = json_object_new_int64(ctx->hugesize);
+	CHECKMEM(obj);
+	json_object_object_add(ctxobj, "hugepages", obj);
+
 	obj = json_object_new_int64(ctx->poolcnt);
 	CHECKMEM(obj);
 	json_object_object_add(ctxobj, "pools", obj);
@@ -2657,6 +3421,10 @@ isc_mem_renderjson(json_object *memobj) {
 	CHECKMEM(obj);
 	json_object_object_add(memobj, "BlockSize", obj);
 
+	obj = json_object_new_int64(summary.hugesize);
+	CHECKMEM(obj);
+	json_object_object_add(memobj, "HugePages", obj);
+
 	obj = json_object_new_int64(summary.contextsize);
 	CHECKMEM(obj);
 	json_object_object_add(memobj, "ContextSize", obj);
@@ -44,6 +44,16 @@ isc_thread_setconcurrency(unsigned int level);
 void
 isc_thread_yield(void);
 
+isc_result_t
+isc_thread_setaffinity(isc_thread_t thread, int cpu);
+/*%<
+ * Bind 'thread' to run on processor 'cpu' only, or on any processor
+ * if 'cpu' is -1.
+ *
+ * Returns ISC_R_NOTIMPLEMENTED if the platform does not support it,
+ * and ISC_R_RANGE if there is no such processor.
+ */
+
 /* XXX We could do fancier error handling... */
 
 #define isc_thread_join(t, rp) \
@@ -79,6 +79,30 @@ isc_thread_setconcurrency(unsigned int level) {
 #endif
 }
 
+isc_result_t
+isc_thread_setaffinity(isc_thread_t thread, int cpu) {
+#if defined(HAVE_PTHREAD_SETAFFINITY_NP) && defined(CPU_SET)
+	cpu_set_t set;
+	int i;
+
+	if (cpu < -1 || cpu >= CPU_SETSIZE)
+		return (ISC_R_RANGE);
+	CPU_ZERO(&set);
+	if (cpu == -1) {
+		for (i = 0; i < CPU_SETSIZE; i++)
+			CPU_SET(i, &set);
+	} else
+		CPU_SET(cpu, &set);
+	if (pthread_setaffinity_np(thread, sizeof(set), &set) != 0)
+		return (ISC_R_RANGE);
+	return (ISC_R_SUCCESS);
+#else
+	UNUSED(thread);
+	UNUSED(cpu);
+	return (ISC_R_NOTIMPLEMENTED);
+#endif
+}
+
 void
 isc_thread_yield(void) {
 #if defined(HAVE_SCHED_YIELD)
@@ -304,9 +304,9 @@ isc_socket_close(isc_socket_t *sock) {
 
 isc_result_t
 isc_socketmgr_create2(isc_mem_t *mctx, isc_socketmgr_t **managerp,
-		       unsigned int maxsocks)
+		       unsigned int maxsocks, unsigned int nthreads)
 {
-	return (isc__socketmgr_create2(mctx, managerp, maxsocks));
+	return (isc__socketmgr_create2(mctx, managerp, maxsocks, nthreads));
 }
 
 isc_result_t
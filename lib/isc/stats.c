@@ -26,10 +26,13 @@
 #include <isc/buffer.h>
 #include <isc/magic.h>
 #include <isc/mem.h>
+#include <isc/once.h>
+#include <isc/os.h>
 #include <isc/platform.h>
 #include <isc/print.h>
 #include <isc/rwlock.h>
 #include <isc/stats.h>
+#include <isc/thread.h>
 #include <isc/util.h>
 
 #define ISC_STATS_MAGIC			ISC_MAGIC('S', 't', 'a', 't')
@@ -43,6 +46,46 @@
 #endif
 #endif	/* ISC_STATS_USEMULTIFIELDS */
 
+/*%
+ * Counter updates go to a per-thread shard so that threads counting the
+ * same event do not pull the same cache lines back and forth; the shards
+ * are only summed when the counters are dumped.  Threads are numbered in
+ * the order they first update any statistics, whatever their role, and
+ * thread N uses shard N % nshards, which is allocated on its first use.
+ * A statistics set has as many shards as there are threads expected to
+ * update it (see isc_stats_setthreads()), but never more than
+ * STATS_MAXSHARDS; if more threads turn up, they share shards.
+ */
+#ifdef ISC_PLATFORM_USETHREADS
+#define STATS_MAXSHARDS			64
+#else
+#define STATS_MAXSHARDS			1
+#endif
+
+/*%
+ * A shard is published by storing its pointer once it is initialized, and
+ * the updating threads look it up without the lock, so the store must have
+ * release and the lookup acquire semantics.  Without compiler support for
+ * that, only shard 0, which is published with the statistics set itself,
+ * is used.
+ */
+#if defined(ISC_PLATFORM_USETHREADS) && defined(__GNUC__) && \
+    defined(__ATOMIC_ACQUIRE)
+#define STATS_USESHARDS			1
+#define SHARD_LOAD(p)		__atomic_load_n(&(p), __ATOMIC_ACQUIRE)
+#define SHARD_STORE(p, v)	__atomic_store_n(&(p), (v), __ATOMIC_RELEASE)
+#else
+#define STATS_USESHARDS			0
+#endif
+
+/*%
+ * Shard headers and counters are padded to STATS_LINE so that neither
+ * shares a cache line with another shard.
+ */
+#define STATS_LINE			64
+#define STATS_ROUNDUP(x) \
+	(((x) + STATS_LINE - 1) & ~((size_t)STATS_LINE - 1))
+
 #if ISC_STATS_USEMULTIFIELDS
 typedef struct {
 	isc_uint32_t hi;
@@ -52,6 +95,17 @@ typedef struct {
 typedef isc_uint64_t isc_stat_t;
 #endif
 
+typedef struct {
+	/*%
+	 * Locked by counterlock or unlocked if efficient rwlock is not
+	 * available.
+	 */
+#ifdef ISC_RWLOCK_USEATOMIC
+	isc_rwlock_t	counterlock;
+#endif
+	isc_stat_t	*counters;
+} isc_statshard_t;
+
 struct isc_stats {
 	/*% Unlocked */
 	unsigned int	magic;
@@ -62,20 +116,20 @@ struct isc_stats {
 	unsigned int	references; /* locked by lock */
 
 	/*%
-	 * Locked by counterlock or unlocked if efficient rwlock is not
-	 * available.
+	 * Set once, under lock, and never cleared until the stats are
+	 * destroyed; the updating threads read them unlocked.  Shard 0
+	 * always exists and is used whenever another cannot be allocated.
 	 */
-#ifdef ISC_RWLOCK_USEATOMIC
-	isc_rwlock_t	counterlock;
-#endif
-	isc_stat_t	*counters;
+	unsigned int	nshards;
+	isc_statshard_t	**shards;
 
 	/*%
 	 * We don't want to lock the counters while we are dumping, so we first
 	 * copy the current counter values into a local array.  This buffer
 	 * will be used as the copy destination.  It's allocated on creation
 	 * of the stats structure so that the dump operation won't fail due
-	 * to memory allocation failure.
+	 * to memory allocation failure.  Locked by lock, which is held until
+	 * the dump is complete.
 	 * XXX: this approach is weird for non-threaded build because the
 	 * additional memory and the copy overhead could be avoided.  We prefer
 	 * simplicity here, however, under the assumption that this function
@@ -84,13 +138,141 @@ struct isc_stats {
 	isc_uint64_t	*copiedcounters;
 };
 
+#ifdef ISC_PLATFORM_USETHREADS
+static isc_once_t		once = ISC_ONCE_INIT;
+static isc_mutex_t		slotlock;
+static isc_thread_key_t		slotkey;
+static size_t			nextslot;	/* locked by slotlock */
+static unsigned int		nthreads;	/* locked by slotlock */
+
+static void
+initialize_action(void) {
+	RUNTIME_CHECK(isc_mutex_init(&slotlock) == ISC_R_SUCCESS);
+	RUNTIME_CHECK(isc_thread_key_create(&slotkey, NULL) == 0);
+	nextslot = 0;
+	nthreads = isc_os_ncpus();
+}
+#endif
+
+void
+isc_stats_setthreads(unsigned int n) {
+#ifdef ISC_PLATFORM_USETHREADS
+	RUNTIME_CHECK(isc_once_do(&once, initialize_action) == ISC_R_SUCCESS);
+
+	LOCK(&slotlock);
+	nthreads = n;
+	UNLOCK(&slotlock);
+#else
+	UNUSED(n);
+#endif
+}
+
+static unsigned int
+shardcount(void) {
+#if STATS_USESHARDS
+	unsigned int n;
+
+	LOCK(&slotlock);
+	n = nthreads;
+	UNLOCK(&slotlock);
+	if (n == 0U)
+		n = 1;
+	if (n > STATS_MAXSHARDS)
+		n = STATS_MAXSHARDS;
+	return (n);
+#else
+	return (1);
+#endif
+}
+
+static inline size_t
+shardsize(int ncounters) {
+	return (STATS_ROUNDUP(sizeof(isc_statshard_t)) +
+		STATS_ROUNDUP(sizeof(isc_stat_t) * ncounters));
+}
+
+static isc_statshard_t *
+create_shard(isc_mem_t *mctx, int ncounters) {
+	isc_statshard_t *shard;
+	unsigned char *p;
+
+	p = isc_mem_get(mctx, shardsize(ncounters));
+	if (p == NULL)
+		return (NULL);
+	shard = (isc_statshard_t *)p;
+#ifdef ISC_RWLOCK_USEATOMIC
+	if (isc_rwlock_init(&shard->counterlock, 0, 0) != ISC_R_SUCCESS) {
+		isc_mem_put(mctx, p, shardsize(ncounters));
+		return (NULL);
+	}
+#endif
+	shard->counters = (isc_stat_t *)(p +
+				STATS_ROUNDUP(sizeof(isc_statshard_t)));
+	memset(shard->counters, 0, sizeof(isc_stat_t) * ncounters);
+
+	return (shard);
+}
+
+static void
+destroy_shard(isc_mem_t *mctx, isc_statshard_t *shard, int ncounters) {
+#ifdef ISC_RWLOCK_USEATOMIC
+	isc_rwlock_destroy(&shard->counterlock);
+#endif
+	isc_mem_put(mctx, shard, shardsize(ncounters));
+}
+
+/*%
+ * Return the shard the calling thread updates.
+ */
+static inline isc_statshard_t *
+getshard(isc_stats_t *stats) {
+#if STATS_USESHARDS
+	isc_statshard_t *shard;
+	size_t slot;
+
+	slot = (size_t)isc_thread_key_getspecific(slotkey);
+	if (slot == 0U) {
+		LOCK(&slotlock);
+		slot = nextslot++ % STATS_MAXSHARDS + 1;
+		UNLOCK(&slotlock);
+		if (isc_thread_key_setspecific(slotkey, (void *)slot) != 0)
+			return (stats->shards[0]);
+	}
+	slot = (slot - 1) % stats->nshards;
+
+	shard = SHARD_LOAD(stats->shards[slot]);
+	if (shard != NULL)
+		return (shard);
+
+	LOCK(&stats->lock);
+	shard = stats->shards[slot];
+	if (shard == NULL) {
+		shard = create_shard(stats->mctx, stats->ncounters);
+		if (shard != NULL)
+			SHARD_STORE(stats->shards[slot], shard);
+		else
+			shard = stats->shards[0];
+	}
+	UNLOCK(&stats->lock);
+
+	return (shard);
+#else
+	return (stats->shards[0]);
+#endif
+}
+
 static isc_result_t
 create_stats(isc_mem_t *mctx, int ncounters, isc_stats_t **statsp) {
 	isc_stats_t *stats;
 	isc_result_t result = ISC_R_SUCCESS;
+	unsigned int i;
 
 	REQUIRE(statsp != NULL && *statsp == NULL);
 
+#ifdef ISC_PLATFORM_USETHREADS
+	RUNTIME_CHECK(isc_once_do(&once, initialize_action) == ISC_R_SUCCESS);
+#endif
+
 	stats = isc_mem_get(mctx, sizeof(*stats));
 	if (stats == NULL)
 		return (ISC_R_NOMEMORY);
@@ -99,26 +281,28 @@ create_stats(isc_mem_t *mctx, int ncounters, isc_stats_t **statsp) {
 	if (result != ISC_R_SUCCESS)
 		goto clean_stats;
 
-	stats->counters = isc_mem_get(mctx, sizeof(isc_stat_t) * ncounters);
-	if (stats->counters == NULL) {
+	stats->nshards = shardcount();
+	stats->shards = isc_mem_get(mctx,
+				    stats->nshards * sizeof(isc_statshard_t *));
+	if (stats->shards == NULL) {
 		result = ISC_R_NOMEMORY;
 		goto clean_mutex;
 	}
+	for (i = 0; i < stats->nshards; i++)
+		stats->shards[i] = NULL;
+	stats->shards[0] = create_shard(mctx, ncounters);
+	if (stats->shards[0] == NULL) {
+		result = ISC_R_NOMEMORY;
+		goto clean_shards;
+	}
 	stats->copiedcounters = isc_mem_get(mctx,
 					    sizeof(isc_uint64_t) * ncounters);
 	if (stats->copiedcounters == NULL) {
 		result = ISC_R_NOMEMORY;
-		goto clean_counters;
+		goto clean_shard;
 	}
 
-#ifdef ISC_RWLOCK_USEATOMIC
-	result = isc_rwlock_init(&stats->counterlock, 0, 0);
-	if (result != ISC_R_SUCCESS)
-		goto clean_copiedcounters;
-#endif
-
 	stats->references = 1;
-	memset(stats->counters, 0, sizeof(isc_stat_t) * ncounters);
 	stats->mctx = NULL;
 	isc_mem_attach(mctx, &stats->mctx);
 	stats->ncounters = ncounters;
@@ -128,14 +312,12 @@ create_stats(isc_mem_t *mctx, int ncounters, isc_stats_t **statsp) {
 
 	return (result);
 
-clean_counters:
-	isc_mem_put(mctx, stats->counters, sizeof(isc_stat_t) * ncounters);
+clean_shard:
+	destroy_shard(mctx, stats->shards[0], ncounters);
 
-#ifdef ISC_RWLOCK_USEATOMIC
-clean_copiedcounters:
-	isc_mem_put(mctx, stats->copiedcounters,
-		    sizeof(isc_stat_t) * ncounters);
-#endif
+clean_shards:
+	isc_mem_put(mctx, stats->shards,
+		    stats->nshards * sizeof(isc_statshard_t *));
 
 clean_mutex:
 	DESTROYLOCK(&stats->lock);
@@ -161,6 +343,7 @@ isc_stats_attach(isc_stats_t *stats, isc_stats_t **statsp) {
 void
 isc_stats_detach(isc_stats_t **statsp) {
 	isc_stats_t *stats;
+	unsigned int i;
 
 	REQUIRE(statsp != NULL && ISC_STATS_VALID(*statsp));
 
@@ -173,13 +356,14 @@ isc_stats_detach(isc_stats_t **statsp) {
 
 	if (stats->references == 0) {
 		isc_mem_put(stats->mctx, stats->copiedcounters,
-			    sizeof(isc_stat_t) * stats->ncounters);
-		isc_mem_put(stats->mctx, stats->counters,
-			    sizeof(isc_stat_t) * stats->ncounters);
+			    sizeof(isc_uint64_t) * stats->ncounters);
+		for (i = 0; i < stats->nshards; i++)
+			if (stats->shards[i] != NULL)
+				destroy_shard(stats->mctx, stats->shards[i],
+					      stats->ncounters);
+		isc_mem_put(stats->mctx, stats->shards,
+			    stats->nshards * sizeof(isc_statshard_t *));
 		DESTROYLOCK(&stats->lock);
-#ifdef ISC_RWLOCK_USEATOMIC
-		isc_rwlock_destroy(&stats->counterlock);
-#endif
 		isc_mem_putanddetach(&stats->mctx, stats, sizeof(*stats));
 	}
 }
@@ -192,7 +376,8 @@ isc_stats_ncounters(isc_stats_t *stats) {
 }
 
 static inline void
-incrementcounter(isc_stats_t *stats, int counter) {
+addcounter(isc_stats_t *stats, int counter, isc_uint32_t val) {
+	isc_statshard_t *shard = getshard(stats);
 	isc_int32_t prev;
 
 #ifdef ISC_RWLOCK_USEATOMIC
@@ -201,11 +386,12 @@ incrementcounter(isc_stats_t *stats, int counter) {
 	 * counter while we "writing" a counter field.  The write access itself
 	 * is protected by the atomic operation.
 	 */
-	isc_rwlock_lock(&stats->counterlock, isc_rwlocktype_read);
+	isc_rwlock_lock(&shard->counterlock, isc_rwlocktype_read);
 #endif
 
 #if ISC_STATS_USEMULTIFIELDS
-	prev = isc_atomic_xadd((isc_int32_t *)&stats->counters[counter].lo, 1);
+	prev = isc_atomic_xadd((isc_int32_t *)&shard->counters[counter].lo,
+			       (isc_int32_t)val);
 	/*
 	 * If the lower 32-bit field overflows, increment the higher field.
 	 * Note that it's *theoretically* possible that the lower field
@@ -214,74 +400,93 @@ incrementcounter(isc_stats_t *stats, int counter) {
 	 * isc_stats_copy() is called where the whole process is protected
 	 * by the write (exclusive) lock.
 	 */
-	if (prev == (isc_int32_t)0xffffffff)
-		isc_atomic_xadd((isc_int32_t *)&stats->counters[counter].hi, 1);
+	if ((isc_uint32_t)prev + val < (isc_uint32_t)prev)
+		isc_atomic_xadd((isc_int32_t *)&shard->counters[counter].hi, 1);
 #elif defined(ISC_PLATFORM_HAVEXADDQ)
 	UNUSED(prev);
-	isc_atomic_xaddq((isc_int64_t *)&stats->counters[counter], 1);
+	isc_atomic_xaddq((isc_int64_t *)&shard->counters[counter],
+			 (isc_int64_t)val);
 #else
 	UNUSED(prev);
-	stats->counters[counter]++;
+	shard->counters[counter] += val;
 #endif
 
 #ifdef ISC_RWLOCK_USEATOMIC
-	isc_rwlock_unlock(&stats->counterlock, isc_rwlocktype_read);
+	isc_rwlock_unlock(&shard->counterlock, isc_rwlocktype_read);
 #endif
 }
 
+/*
+ * A shard may go "below zero" when a counter is decremented by a
+ * different thread than the one that incremented it; the sum over all
+ * shards is still right modulo 2^64.
+ */
 static inline void
 decrementcounter(isc_stats_t *stats, int counter) {
+	isc_statshard_t *shard = getshard(stats);
 	isc_int32_t prev;
 
 #ifdef ISC_RWLOCK_USEATOMIC
-	isc_rwlock_lock(&stats->counterlock, isc_rwlocktype_read);
+	isc_rwlock_lock(&shard->counterlock, isc_rwlocktype_read);
 #endif
 
 #if ISC_STATS_USEMULTIFIELDS
-	prev = isc_atomic_xadd((isc_int32_t *)&stats->counters[counter].lo, -1);
+	prev = isc_atomic_xadd((isc_int32_t *)&shard->counters[counter].lo, -1);
 	if (prev == 0)
-		isc_atomic_xadd((isc_int32_t *)&stats->counters[counter].hi,
+		isc_atomic_xadd((isc_int32_t *)&shard->counters[counter].hi,
 				-1);
 #elif defined(ISC_PLATFORM_HAVEXADDQ)
 	UNUSED(prev);
-	isc_atomic_xaddq((isc_int64_t *)&stats->counters[counter], -1);
+	isc_atomic_xaddq((isc_int64_t *)&shard->counters[counter], -1);
 #else
 	UNUSED(prev);
-	stats->counters[counter]--;
+	shard->counters[counter]--;
 #endif
 
 #ifdef ISC_RWLOCK_USEATOMIC
-	isc_rwlock_unlock(&stats->counterlock, isc_rwlocktype_read);
+	isc_rwlock_unlock(&shard->counterlock, isc_rwlocktype_read);
 #endif
 }
 
+/*
+ * Sum the shards into copiedcounters.  Each shard is read under its own
+ * write lock, so every counter is exact but the set as a whole is not
+ * a snapshot of a single instant.  The caller must hold stats->lock,
+ * which keeps copiedcounters for it until it is done with them.
+ */
 static void
 copy_counters(isc_stats_t *stats) {
+	isc_statshard_t *shard;
+	unsigned int s;
 	int i;
 
+	memset(stats->copiedcounters, 0,
+	       stats->ncounters * sizeof(isc_uint64_t));
+
+	for (s = 0; s < stats->nshards; s++) {
+		shard = stats->shards[s];
+		if (shard == NULL)
+			continue;
 #ifdef ISC_RWLOCK_USEATOMIC
-	/*
-	 * We use a "write" lock before "reading" the statistics counters as
-	 * an exclusive lock.
-	 */
-	isc_rwlock_lock(&stats->counterlock, isc_rwlocktype_write);
+		/*
+		 * We use a "write" lock before "reading" the statistics
+		 * counters as an exclusive lock.
+		 */
+		isc_rwlock_lock(&shard->counterlock, isc_rwlocktype_write);
 #endif
-
+		for (i = 0; i < stats->ncounters; i++) {
 #if ISC_STATS_USEMULTIFIELDS
-	for (i = 0; i < stats->ncounters; i++) {
-		stats->copiedcounters[i] =
-				(isc_uint64_t)(stats->counters[i].hi) << 32 |
-				stats->counters[i].lo;
-	}
+			stats->copiedcounters[i] +=
+				(isc_uint64_t)(shard->counters[i].hi) << 32 |
+				shard->counters[i].lo;
 #else
-	UNUSED(i);
-	memmove(stats->copiedcounters, stats->counters,
-		stats->ncounters * sizeof(isc_stat_t));
+			stats->copiedcounters[i] += shard->counters[i];
 #endif
-
+		}
 #ifdef ISC_RWLOCK_USEATOMIC
-	isc_rwlock_unlock(&stats->counterlock, isc_rwlocktype_write);
+		isc_rwlock_unlock(&shard->counterlock, isc_rwlocktype_write);
 #endif
+	}
 }
 
 isc_result_t
@@ -296,7 +501,17 @@ isc_stats_increment(isc_stats_t *stats, isc_statscounter_t counter) {
 	REQUIRE(ISC_STATS_VALID(stats));
 	REQUIRE(counter < stats->ncounters);
 
-	incrementcounter(stats, (int)counter);
+	addcounter(stats, (int)counter, 1);
+}
+
+void
+isc_stats_add(isc_stats_t *stats, isc_statscounter_t counter,
+	      isc_uint32_t val)
+{
+	REQUIRE(ISC_STATS_VALID(stats));
+	REQUIRE(counter < stats->ncounters);
+
+	addcounter(stats, (int)counter, val);
 }
 
 void
@@ -315,6 +530,7 @@ isc_stats_dump(isc_stats_t *stats, isc_stats_dumper_t dump_fn,
 
 	REQUIRE(ISC_STATS_VALID(stats));
 
+	LOCK(&stats->lock);
 	copy_counters(stats);
 
 	for (i = 0; i < stats->ncounters; i++) {
@@ -323,32 +539,49 @@ isc_stats_dump(isc_stats_t *stats, isc_stats_dumper_t dump_fn,
 				continue;
 		dump_fn((isc_statscounter_t)i, stats->copiedcounters[i], arg);
 	}
+	UNLOCK(&stats->lock);
 }
 
 void
 isc_stats_set(isc_stats_t *stats, isc_uint64_t val,
 	      isc_statscounter_t counter)
 {
+	isc_statshard_t *shard;
+	isc_uint64_t v;
+	unsigned int s;
+
 	REQUIRE(ISC_STATS_VALID(stats));
 	REQUIRE(counter < stats->ncounters);
 
-#ifdef ISC_RWLOCK_USEATOMIC
 	/*
-	 * We use a "write" lock before "reading" the statistics counters as
-	 * an exclusive lock.
+	 * Shard 0 takes the value and the others are cleared, so that the
+	 * sum is 'val' until the next update.
 	 */
-	isc_rwlock_lock(&stats->counterlock, isc_rwlocktype_write);
+	LOCK(&stats->lock);
+	for (s = 0; s < stats->nshards; s++) {
+		shard = stats->shards[s];
+		if (shard == NULL)
+			continue;
+		v = (s == 0) ? val : 0;
+#ifdef ISC_RWLOCK_USEATOMIC
+		/*
+		 * We use a "write" lock before "reading" the statistics
+		 * counters as an exclusive lock.
+		 */
+		isc_rwlock_lock(&shard->counterlock, isc_rwlocktype_write);
 #endif
 
 #if ISC_STATS_USEMULTIFIELDS
-	stats->counters[counter].hi = (isc_uint32_t)((val >> 32) & 0xffffffff);
-	stats->counters[counter].lo = (isc_uint32_t)(val & 0xffffffff);
+		shard->counters[counter].hi =
+			(isc_uint32_t)((v >> 32) & 0xffffffff);
+		shard->counters[counter].lo = (isc_uint32_t)(v & 0xffffffff);
 #else
-	stats->counters[counter] = val;
+		shard->counters[counter] = v;
 #endif
 
 #ifdef ISC_RWLOCK_USEATOMIC
-	isc_rwlock_unlock(&stats->counterlock, isc_rwlocktype_write);
+		isc_rwlock_unlock(&shard->counterlock, isc_rwlocktype_write);
 #endif
+	}
+	UNLOCK(&stats->lock);
 }
-
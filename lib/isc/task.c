@@ -106,6 +106,7 @@ struct isc__task {
 	isc_task_t			common;
 	isc__taskmgr_t *		manager;
 	isc_mutex_t			lock;
+	unsigned int			threadid;	/* Home worker. */
 	/* Locked by task lock. */
 	task_state_t			state;
 	unsigned int			references;
@@ -119,6 +120,7 @@ struct isc__task {
 	void *				tag;
 	/* Locked by task manager lock. */
 	LINK(isc__task_t)		link;
+	/* Locked by the queue lock of the home worker. */
 	LINK(isc__task_t)		ready_link;
 	LINK(isc__task_t)		ready_priority_link;
 };
@@ -134,11 +136,34 @@ struct isc__task {
 
 typedef ISC_LIST(isc__task_t)	isc__tasklist_t;
 
+/*%
+ * The ready queues of one worker thread.  A task is queued on the queues
+ * of its home worker; a worker that runs out of work steals ready tasks
+ * from the queues of workers that are busy.
+ */
+typedef struct isc__taskqueue {
+	/* Not locked. */
+	isc__taskmgr_t *		manager;
+	unsigned int			threadid;
+	isc_mutex_t			lock;
+	/* Locked by queue lock. */
+	isc__tasklist_t			ready_tasks;
+	isc__tasklist_t			ready_priority_tasks;
+#ifdef ISC_PLATFORM_USETHREADS
+	isc_condition_t			work_available;
+#endif /* ISC_PLATFORM_USETHREADS */
+	unsigned int			tasks_running;
+	unsigned int			tasks_ready;
+	isc_boolean_t			idle;
+} isc__taskqueue_t;
+
 struct isc__taskmgr {
 	/* Not locked. */
 	isc_taskmgr_t			common;
 	isc_mem_t *			mctx;
 	isc_mutex_t			lock;
+	unsigned int			nqueues;
+	isc__taskqueue_t *		queues;
 #ifdef ISC_PLATFORM_USETHREADS
 	unsigned int			workers;
 	isc_thread_t *			threads;
@@ -146,19 +171,20 @@ struct isc__taskmgr {
 	/* Locked by task manager lock. */
 	unsigned int			default_quantum;
 	LIST(isc__task_t)		tasks;
-	isc__tasklist_t			ready_tasks;
-	isc__tasklist_t			ready_priority_tasks;
-	isc_taskmgrmode_t		mode;
+	unsigned int			nexthome;
 #ifdef ISC_PLATFORM_USETHREADS
-	isc_condition_t			work_available;
 	isc_condition_t			exclusive_granted;
 	isc_condition_t			paused;
 #endif /* ISC_PLATFORM_USETHREADS */
-	unsigned int			tasks_running;
-	unsigned int			tasks_ready;
+	/*
+	 * Changed with the task manager lock and every queue lock held,
+	 * so that the workers can test them under their own queue lock.
+	 */
+	isc_taskmgrmode_t		mode;
 	isc_boolean_t			pause_requested;
 	isc_boolean_t			exclusive_requested;
 	isc_boolean_t			exiting;
+	isc_boolean_t			finished;
 	isc__task_t			*excl;
 #ifdef USE_SHARED_MANAGER
 	unsigned int			refs;
@@ -168,6 +194,11 @@ struct isc__taskmgr {
 #define DEFAULT_TASKMGR_QUANTUM		10
 #define DEFAULT_DEFAULT_QUANTUM		5
 #define FINISHED(m)			((m)->exiting && EMPTY((m)->tasks))
+#ifdef USE_WORKER_THREADS
+#define NWORKERS(m)			((m)->workers)
+#else
+#define NWORKERS(m)			1
+#endif /* USE_WORKER_THREADS */
 
 #ifdef USE_SHARED_MANAGER
 static isc__taskmgr_t *taskmgr = NULL;
@@ -243,13 +274,13 @@ isc_taskmgrmode_t
 isc__taskmgr_mode(isc_taskmgr_t *manager0);
 
 static inline isc_boolean_t
-empty_readyq(isc__taskmgr_t *manager);
+empty_readyq(isc__taskmgr_t *manager, isc__taskqueue_t *queue);
 
 static inline isc__task_t *
-pop_readyq(isc__taskmgr_t *manager);
+pop_readyq(isc__taskmgr_t *manager, isc__taskqueue_t *queue);
 
 static inline void
-push_readyq(isc__taskmgr_t *manager, isc__task_t *task);
+push_readyq(isc__taskqueue_t *queue, isc__task_t *task);
 
 static struct isc__taskmethods {
 	isc_taskmethods_t methods;
@@ -292,6 +323,95 @@ static isc_taskmgrmethods_t taskmgrmethods = {
 	isc_taskmgr_excltask
 };
 
+/*
+ * Lock and unlock the ready queues of every worker, in order.  Caller must
+ * be holding the task manager lock and no queue lock.
+ */
+static void
+lock_queues(isc__taskmgr_t *manager) {
+	unsigned int i;
+
+	for (i = 0; i < manager->nqueues; i++)
+		LOCK(&manager->queues[i].lock);
+}
+
+static void
+unlock_queues(isc__taskmgr_t *manager) {
+	unsigned int i;
+
+	for (i = manager->nqueues; i > 0; i--)
+		UNLOCK(&manager->queues[i - 1].lock);
+}
+
+#ifdef USE_WORKER_THREADS
+/*
+ * Wake up every worker so that it rechecks the manager state.  Caller
+ * must be holding every queue lock.
+ */
+static void
+wake_workers(isc__taskmgr_t *manager) {
+	unsigned int i;
+
+	for (i = 0; i < manager->nqueues; i++)
+		BROADCAST(&manager->queues[i].work_available);
+}
+
+/*
+ * Wake up one idle worker other than 'threadid' so that it steals work
+ * from the busy worker 'threadid'.  The idle flags are peeked at without
+ * the queue locks: a stale value costs a spurious wakeup, or leaves the
+ * work to its home worker.
+ */
+static void
+wake_idle(isc__taskmgr_t *manager, unsigned int threadid) {
+	isc__taskqueue_t *queue;
+	unsigned int i;
+
+	for (i = 1; i < manager->workers; i++) {
+		queue = &manager->queues[(threadid + i) % manager->workers];
+		if (!queue->idle)
+			continue;
+		LOCK(&queue->lock);
+		if (queue->idle) {
+			/*
+			 * Clear the flag so that the next ready task
+			 * wakes up another worker.
+			 */
+			queue->idle = ISC_FALSE;
+			SIGNAL(&queue->work_available);
+			UNLOCK(&queue->lock);
+			return;
+		}
+		UNLOCK(&queue->lock);
+	}
+}
+#endif /* USE_WORKER_THREADS */
+
+#if defined(USE_WORKER_THREADS) || defined(HAVE_LIBXML2) || defined(HAVE_JSON)
+/*
+ * Count the running and ready tasks over all workers.  Caller must be
+ * holding the task manager lock and no queue lock.
+ */
+static void
+count_tasks(isc__taskmgr_t *manager, unsigned int *runningp,
+	    unsigned int *readyp)
+{
+	unsigned int i, running = 0, ready = 0;
+
+	lock_queues(manager);
+	for (i = 0; i < manager->nqueues; i++) {
+		running += manager->queues[i].tasks_running;
+		ready += manager->queues[i].tasks_ready;
+	}
+	unlock_queues(manager);
+
+	if (runningp != NULL)
+		*runningp = running;
+	if (readyp != NULL)
+		*readyp = ready;
+}
+#endif
+
 /***
  *** Tasks.
  ***/
@@ -310,17 +430,20 @@ task_finished(isc__task_t *task) {
 
 	LOCK(&manager->lock);
 	UNLINK(manager->tasks, task, link);
-#ifdef USE_WORKER_THREADS
 	if (FINISHED(manager)) {
+		lock_queues(manager);
+		manager->finished = ISC_TRUE;
+#ifdef USE_WORKER_THREADS
 		/*
 		 * All tasks have completed and the
 		 * task manager is exiting.  Wake up
 		 * any idle worker threads so they
 		 * can exit.
 		 */
-		BROADCAST(&manager->work_available);
-	}
+		wake_workers(manager);
 #endif /* USE_WORKER_THREADS */
+		unlock_queues(manager);
+	}
 	UNLOCK(&manager->lock);
 
 	DESTROYLOCK(&task->lock);
@@ -370,6 +493,8 @@ isc__task_create(isc_taskmgr_t *manager0, unsigned int quantum,
 	if (!manager->exiting) {
 		if (task->quantum == 0)
 			task->quantum = manager->default_quantum;
+		task->threadid = manager->nexthome;
+		manager->nexthome = (manager->nexthome + 1) % NWORKERS(manager);
 		APPEND(manager->tasks, task, link);
 	} else
 		exiting = ISC_TRUE;
@@ -449,15 +574,18 @@ task_shutdown(isc__task_t *task) {
 }
 
 /*
- * Moves a task onto the appropriate run queue.
+ * Moves a task onto the appropriate run queue of its home worker.  If
+ * the home worker is busy, an idle worker is woken up to steal the task.
  *
- * Caller must NOT hold manager lock.
+ * Caller must NOT hold manager lock or any queue lock.
  */
 static inline void
 task_ready(isc__task_t *task) {
 	isc__taskmgr_t *manager = task->manager;
+	isc__taskqueue_t *queue = &manager->queues[task->threadid];
 #ifdef USE_WORKER_THREADS
 	isc_boolean_t has_privilege = isc__task_privilege((isc_task_t *) task);
+	isc_boolean_t busy = ISC_FALSE;
 #endif /* USE_WORKER_THREADS */
 
 	REQUIRE(VALID_MANAGER(manager));
@@ -465,13 +593,20 @@ task_ready(isc__task_t *task) {
 
 	XTRACE("task_ready");
 
-	LOCK(&manager->lock);
-	push_readyq(manager, task);
+	LOCK(&queue->lock);
+	push_readyq(queue, task);
 #ifdef USE_WORKER_THREADS
-	if (manager->mode == isc_taskmgrmode_normal || has_privilege)
-		SIGNAL(&manager->work_available);
+	if (manager->mode == isc_taskmgrmode_normal || has_privilege) {
+		SIGNAL(&queue->work_available);
+		busy = ISC_TF(!queue->idle);
+	}
+#endif /* USE_WORKER_THREADS */
+	UNLOCK(&queue->lock);
+
+#ifdef USE_WORKER_THREADS
+	if (busy)
+		wake_idle(manager, task->threadid);
 #endif /* USE_WORKER_THREADS */
-	UNLOCK(&manager->lock);
 }
 
 static inline isc_boolean_t
@@ -920,46 +1055,47 @@ isc__task_getcurrenttime(isc_task_t *task0, isc_stdtime_t *t) {
  ***/
 
 /*
- * Return ISC_TRUE if the current ready list for the manager, which is
+ * Return ISC_TRUE if the current ready list of 'queue', which is
  * either ready_tasks or the ready_priority_tasks, depending on whether
  * the manager is currently in normal or privileged execution mode.
  *
- * Caller must hold the task manager lock.
+ * Caller must hold the queue lock.
  */
 static inline isc_boolean_t
-empty_readyq(isc__taskmgr_t *manager) {
-	isc__tasklist_t queue;
+empty_readyq(isc__taskmgr_t *manager, isc__taskqueue_t *queue) {
+	isc__tasklist_t list;
 
 	if (manager->mode == isc_taskmgrmode_normal)
-		queue = manager->ready_tasks;
+		list = queue->ready_tasks;
 	else
-		queue = manager->ready_priority_tasks;
+		list = queue->ready_priority_tasks;
 
-	return (ISC_TF(EMPTY(queue)));
+	return (ISC_TF(EMPTY(list)));
 }
 
 /*
  * Dequeue and return a pointer to the first task on the current ready
- * list for the manager.
+ * list of 'queue'.
  * If the task is privileged, dequeue it from the other ready list
  * as well.
  *
- * Caller must hold the task manager lock.
+ * Caller must hold the queue lock.
  */
 static inline isc__task_t *
-pop_readyq(isc__taskmgr_t *manager) {
+pop_readyq(isc__taskmgr_t *manager, isc__taskqueue_t *queue) {
 	isc__task_t *task;
 
 	if (manager->mode == isc_taskmgrmode_normal)
-		task = HEAD(manager->ready_tasks);
+		task = HEAD(queue->ready_tasks);
 	else
-		task = HEAD(manager->ready_priority_tasks);
+		task = HEAD(queue->ready_priority_tasks);
 
 	if (task != NULL) {
-		DEQUEUE(manager->ready_tasks, task, ready_link);
+		DEQUEUE(queue->ready_tasks, task, ready_link);
 		if (ISC_LINK_LINKED(task, ready_priority_link))
-			DEQUEUE(manager->ready_priority_tasks, task,
+			DEQUEUE(queue->ready_priority_tasks, task,
 				ready_priority_link);
+		queue->tasks_ready--;
 	}
 
 	return (task);
@@ -969,21 +1105,132 @@ pop_readyq(isc__taskmgr_t *manager) {
  * Push 'task' onto the ready_tasks queue.  If 'task' has the privilege
  * flag set, then also push it onto the ready_priority_tasks queue.
  *
- * Caller must hold the task manager lock.
+ * Caller must hold the queue lock.
  */
 static inline void
-push_readyq(isc__taskmgr_t *manager, isc__task_t *task) {
-	ENQUEUE(manager->ready_tasks, task, ready_link);
+push_readyq(isc__taskqueue_t *queue, isc__task_t *task) {
+	ENQUEUE(queue->ready_tasks, task, ready_link);
 	if ((task->flags & TASK_F_PRIVILEGED) != 0)
-		ENQUEUE(manager->ready_priority_tasks, task,
+		ENQUEUE(queue->ready_priority_tasks, task,
 			ready_priority_link);
-	manager->tasks_ready++;
+	queue->tasks_ready++;
+}
+
+#ifdef USE_WORKER_THREADS
+/*
+ * Take a ready task from the queue of another worker which is busy
+ * running a task.  The queues of idle workers are left alone: they
+ * have been woken up to run their own tasks.
+ *
+ * Caller must not hold any queue lock.  Only one queue lock is held at
+ * a time.
+ */
+static isc__task_t *
+steal_task(isc__taskmgr_t *manager, unsigned int threadid) {
+	isc__taskqueue_t *queue;
+	isc__task_t *task = NULL;
+	unsigned int i;
+
+	for (i = 1; i < manager->workers && task == NULL; i++) {
+		queue = &manager->queues[(threadid + i) % manager->workers];
+		/*
+		 * Peek without the lock to skip empty queues cheaply.
+		 */
+		if (queue->tasks_ready == 0)
+			continue;
+		LOCK(&queue->lock);
+		if (!queue->idle)
+			task = pop_readyq(manager, queue);
+		UNLOCK(&queue->lock);
+	}
+
+	return (task);
+}
+
+/*
+ * Find the next task for the worker of 'queue': the first task of its
+ * own ready queue, or one stolen from a busy worker.  Returns NULL if
+ * there is nothing to do, or if the worker must not run anything while
+ * a pause or exclusive mode is requested.
+ *
+ * Caller must hold the queue lock; it is released while stealing.
+ */
+static isc__task_t *
+next_task(isc__taskmgr_t *manager, isc__taskqueue_t *queue) {
+	isc__taskqueue_t *home;
+	isc__task_t *task;
+
+	if (manager->pause_requested || manager->exclusive_requested)
+		return (NULL);
+
+	task = pop_readyq(manager, queue);
+	if (task != NULL || manager->workers == 1)
+		return (task);
+
+	UNLOCK(&queue->lock);
+	task = steal_task(manager, queue->threadid);
+	LOCK(&queue->lock);
+
+	if (task != NULL &&
+	    (manager->pause_requested || manager->exclusive_requested))
+	{
+		/*
+		 * A pause or exclusive mode was requested while we were
+		 * stealing, and the stolen task was not counted as
+		 * running.  Give it back; the workers are woken up when
+		 * the request is released.
+		 */
+		home = &manager->queues[task->threadid];
+		UNLOCK(&queue->lock);
+		LOCK(&home->lock);
+		push_readyq(home, task);
+		UNLOCK(&home->lock);
+		LOCK(&queue->lock);
+		task = NULL;
+	}
+
+	return (task);
 }
 
+/*
+ * If we are in privileged execution mode and there are no privileged
+ * tasks running or ready on any worker, then we're stuck.  Automatically
+ * drop privileges at that point and continue with the regular ready
+ * queues.
+ *
+ * Caller must not hold any queue lock.
+ */
 static void
-dispatch(isc__taskmgr_t *manager) {
+check_privilege_drop(isc__taskmgr_t *manager) {
+	isc__taskqueue_t *queue;
+	isc_boolean_t stuck = ISC_TRUE;
+	unsigned int i;
+
+	LOCK(&manager->lock);
+	lock_queues(manager);
+	if (manager->mode == isc_taskmgrmode_privileged) {
+		for (i = 0; i < manager->nqueues && stuck; i++) {
+			queue = &manager->queues[i];
+			if (queue->tasks_running != 0 ||
+			    !EMPTY(queue->ready_priority_tasks))
+				stuck = ISC_FALSE;
+		}
+		if (stuck) {
+			manager->mode = isc_taskmgrmode_normal;
+			wake_workers(manager);
+		}
+	}
+	unlock_queues(manager);
+	UNLOCK(&manager->lock);
+}
+#endif /* USE_WORKER_THREADS */
+
+static void
+dispatch(isc__taskmgr_t *manager, isc__taskqueue_t *queue) {
 	isc__task_t *task;
-#ifndef USE_WORKER_THREADS
+#ifdef USE_WORKER_THREADS
+	isc__taskqueue_t *home;
+#else
 	unsigned int total_dispatch_count = 0;
 	isc__tasklist_t new_ready_tasks;
 	isc__tasklist_t new_priority_tasks;
@@ -1040,46 +1287,71 @@ dispatch(isc__taskmgr_t *manager) {
 	 *
 	 * For N iterations of the loop, this code does N+1 locks and N+1
 	 * unlocks.  The while expression is always protected by the lock.
+	 *
+	 * The lock is that of the ready queue of this worker; the task
+	 * manager lock is not taken on the way of an event.
 	 */
 
 #ifndef USE_WORKER_THREADS
 	ISC_LIST_INIT(new_ready_tasks);
 	ISC_LIST_INIT(new_priority_tasks);
 #endif
-	LOCK(&manager->lock);
+	LOCK(&queue->lock);
 
-	while (!FINISHED(manager)) {
+	while (!manager->finished) {
 #ifdef USE_WORKER_THREADS
 		/*
 		 * For reasons similar to those given in the comment in
 		 * isc_task_send() above, it is safe for us to dequeue
-		 * the task while only holding the manager lock, and then
+		 * the task while only holding the queue lock, and then
 		 * change the task to running state while only holding the
 		 * task lock.
 		 *
 		 * If a pause has been requested, don't do any work
 		 * until it's been released.
 		 */
-		while ((empty_readyq(manager) || manager->pause_requested ||
-			manager->exclusive_requested) && !FINISHED(manager))
-		{
+		task = NULL;
+		while (!manager->finished) {
+			task = next_task(manager, queue);
+			if (task != NULL)
+				break;
+			if (manager->mode == isc_taskmgrmode_privileged &&
+			    !manager->pause_requested &&
+			    !manager->exclusive_requested)
+			{
+				UNLOCK(&queue->lock);
+				check_privilege_drop(manager);
+				LOCK(&queue->lock);
+			}
+			/*
+			 * The lock may have been released above, and the
+			 * wakeup for a ready task or for the end of the
+			 * task manager missed.
+			 */
+			if (manager->finished ||
+			    (!manager->pause_requested &&
+			     !manager->exclusive_requested &&
+			     !empty_readyq(manager, queue)))
+				continue;
 			XTHREADTRACE(isc_msgcat_get(isc_msgcat,
 						    ISC_MSGSET_GENERAL,
 						    ISC_MSG_WAIT, "wait"));
-			WAIT(&manager->work_available, &manager->lock);
+			queue->idle = ISC_TRUE;
+			WAIT(&queue->work_available, &queue->lock);
+			queue->idle = ISC_FALSE;
 			XTHREADTRACE(isc_msgcat_get(isc_msgcat,
 						    ISC_MSGSET_TASK,
 						    ISC_MSG_AWAKE, "awake"));
 		}
 #else /* USE_WORKER_THREADS */
 		if (total_dispatch_count >= DEFAULT_TASKMGR_QUANTUM ||
-		    empty_readyq(manager))
+		    empty_readyq(manager, queue))
 			break;
+		task = pop_readyq(manager, queue);
 #endif /* USE_WORKER_THREADS */
 		XTHREADTRACE(isc_msgcat_get(isc_msgcat, ISC_MSGSET_TASK,
 					    ISC_MSG_WORKING, "working"));
 
-		task = pop_readyq(manager);
 		if (task != NULL) {
 			unsigned int dispatch_count = 0;
 			isc_boolean_t done = ISC_FALSE;
@@ -1090,13 +1362,12 @@ dispatch(isc__taskmgr_t *manager) {
 			INSIST(VALID_TASK(task));
 
 			/*
-			 * Note we only unlock the manager lock if we actually
-			 * have a task to do.  We must reacquire the manager
+			 * Note we only unlock the queue lock if we actually
+			 * have a task to do.  We must reacquire the queue
 			 * lock before exiting the 'if (task != NULL)' block.
 			 */
-			manager->tasks_ready--;
-			manager->tasks_running++;
-			UNLOCK(&manager->lock);
+			queue->tasks_running++;
+			UNLOCK(&queue->lock);
 
 			LOCK(&task->lock);
 			INSIST(task->state == task_state_ready);
@@ -1210,15 +1481,40 @@ dispatch(isc__taskmgr_t *manager) {
 			if (finished)
 				task_finished(task);
 
-			LOCK(&manager->lock);
-			manager->tasks_running--;
 #ifdef USE_WORKER_THREADS
-			if (manager->exclusive_requested &&
-			    manager->tasks_running == 1) {
-				SIGNAL(&manager->exclusive_granted);
-			} else if (manager->pause_requested &&
-				   manager->tasks_running == 0) {
-				SIGNAL(&manager->paused);
+			if (requeue && task->threadid != queue->threadid) {
+				/*
+				 * The task was stolen; put it back on the
+				 * queue of its home worker, which may be
+				 * sleeping.
+				 */
+				home = &manager->queues[task->threadid];
+				LOCK(&home->lock);
+				push_readyq(home, task);
+				SIGNAL(&home->work_available);
+				UNLOCK(&home->lock);
+				requeue = ISC_FALSE;
+			}
+#endif /* USE_WORKER_THREADS */
+
+			LOCK(&queue->lock);
+			queue->tasks_running--;
+#ifdef USE_WORKER_THREADS
+			if (manager->exclusive_requested ||
+			    manager->pause_requested) {
+				/*
+				 * The requester waits on the task manager
+				 * lock, and recounts the running tasks when
+				 * signaled.
+				 */
+				UNLOCK(&queue->lock);
+				LOCK(&manager->lock);
+				if (manager->exclusive_requested)
+					SIGNAL(&manager->exclusive_granted);
+				if (manager->pause_requested)
+					SIGNAL(&manager->paused);
+				UNLOCK(&manager->lock);
+				LOCK(&queue->lock);
 			}
 #endif /* USE_WORKER_THREADS */
 			if (requeue) {
@@ -1242,7 +1538,7 @@ dispatch(isc__taskmgr_t *manager) {
 				 * might even hurt rather than help.
 				 */
 #ifdef USE_WORKER_THREADS
-				push_readyq(manager, task);
+				push_readyq(queue, task);
 #else
 				ENQUEUE(new_ready_tasks, task, ready_link);
 				if ((task->flags & TASK_F_PRIVILEGED) != 0)
@@ -1252,46 +1548,54 @@ dispatch(isc__taskmgr_t *manager) {
 #endif
 			}
 		}
-
-#ifdef USE_WORKER_THREADS
-		/*
-		 * If we are in privileged execution mode and there are no
-		 * tasks remaining on the current ready queue, then
-		 * we're stuck.  Automatically drop privileges at that
-		 * point and continue with the regular ready queue.
-		 */
-		if (manager->tasks_running == 0 && empty_readyq(manager)) {
-			manager->mode = isc_taskmgrmode_normal;
-			if (!empty_readyq(manager))
-				BROADCAST(&manager->work_available);
-		}
-#endif
 	}
 
 #ifndef USE_WORKER_THREADS
-	ISC_LIST_APPENDLIST(manager->ready_tasks, new_ready_tasks, ready_link);
-	ISC_LIST_APPENDLIST(manager->ready_priority_tasks, new_priority_tasks,
+	ISC_LIST_APPENDLIST(queue->ready_tasks, new_ready_tasks, ready_link);
+	ISC_LIST_APPENDLIST(queue->ready_priority_tasks, new_priority_tasks,
 			    ready_priority_link);
-	manager->tasks_ready += tasks_ready;
-	if (empty_readyq(manager))
+	queue->tasks_ready += tasks_ready;
+	if (empty_readyq(manager, queue))
 		manager->mode = isc_taskmgrmode_normal;
 #endif
 
-	UNLOCK(&manager->lock);
+	UNLOCK(&queue->lock);
 }
 
 #ifdef USE_WORKER_THREADS
+/*
+ * Each worker thread keeps its number plus one under 'workerkey', so
+ * that threads which are not workers read 0.
+ */
+static isc_once_t workeronce = ISC_ONCE_INIT;
+static isc_thread_key_t workerkey;
+
+static void
+initialize_workerkey(void) {
+	RUNTIME_CHECK(isc_thread_key_create(&workerkey, NULL) == 0);
+}
+
 static isc_threadresult_t
 #ifdef _WIN32
 WINAPI
 #endif
 run(void *uap) {
-	isc__taskmgr_t *manager = uap;
+	isc__taskqueue_t *queue = uap;
+	isc__taskmgr_t *manager = queue->manager;
 
 	XTHREADTRACE(isc_msgcat_get(isc_msgcat, ISC_MSGSET_GENERAL,
 				    ISC_MSG_STARTING, "starting"));
 
-	dispatch(manager);
+	(void)isc_thread_key_setspecific(workerkey,
+					 (void *)(size_t)(queue->threadid + 1));
+
+	/*
+	 * Wait until the task manager has started all the workers.
+	 */
+	LOCK(&manager->lock);
+	UNLOCK(&manager->lock);
+
+	dispatch(manager, queue);
 
 	XTHREADTRACE(isc_msgcat_get(isc_msgcat, ISC_MSGSET_GENERAL,
 				    ISC_MSG_EXITING, "exiting"));
@@ -1304,16 +1608,83 @@ run(void *uap) {
 }
 #endif /* USE_WORKER_THREADS */
 
+static void
+destroy_queues(isc_mem_t *mctx, isc__taskqueue_t *queues, unsigned int n) {
+	unsigned int i;
+
+	for (i = 0; i < n; i++) {
+		INSIST(EMPTY(queues[i].ready_tasks));
+#ifdef USE_WORKER_THREADS
+		(void)isc_condition_destroy(&queues[i].work_available);
+#endif /* USE_WORKER_THREADS */
+		DESTROYLOCK(&queues[i].lock);
+	}
+	isc_mem_put(mctx, queues, n * sizeof(*queues));
+}
+
+static isc_result_t
+create_queues(isc__taskmgr_t *manager, isc_mem_t *mctx, unsigned int n) {
+	isc__taskqueue_t *queues, *queue;
+	isc_result_t result;
+	unsigned int i;
+
+	queues = isc_mem_get(mctx, n * sizeof(*queues));
+	if (queues == NULL)
+		return (ISC_R_NOMEMORY);
+
+	for (i = 0; i < n; i++) {
+		queue = &queues[i];
+		queue->manager = manager;
+		queue->threadid = i;
+		INIT_LIST(queue->ready_tasks);
+		INIT_LIST(queue->ready_priority_tasks);
+		queue->tasks_running = 0;
+		queue->tasks_ready = 0;
+		queue->idle = ISC_FALSE;
+		result = isc_mutex_init(&queue->lock);
+		if (result != ISC_R_SUCCESS)
+			goto cleanup;
+#ifdef USE_WORKER_THREADS
+		if (isc_condition_init(&queue->work_available) !=
+		    ISC_R_SUCCESS) {
+			UNEXPECTED_ERROR(__FILE__, __LINE__,
+					 "isc_condition_init() %s",
+					 isc_msgcat_get(isc_msgcat,
+							ISC_MSGSET_GENERAL,
+							ISC_MSG_FAILED,
+							"failed"));
+			DESTROYLOCK(&queue->lock);
+			result = ISC_R_UNEXPECTED;
+			goto cleanup;
+		}
+#endif /* USE_WORKER_THREADS */
+	}
+
+	manager->queues = queues;
+	manager->nqueues = n;
+	return (ISC_R_SUCCESS);
+
+ cleanup:
+	while (i-- > 0) {
+#ifdef USE_WORKER_THREADS
+		(void)isc_condition_destroy(&queues[i].work_available);
+#endif /* USE_WORKER_THREADS */
+		DESTROYLOCK(&queues[i].lock);
+	}
+	isc_mem_put(mctx, queues, n * sizeof(*queues));
+	return (result);
+}
+
 static void
 manager_free(isc__taskmgr_t *manager) {
 	isc_mem_t *mctx;
 
 #ifdef USE_WORKER_THREADS
 	(void)isc_condition_destroy(&manager->exclusive_granted);
-	(void)isc_condition_destroy(&manager->work_available);
 	(void)isc_condition_destroy(&manager->paused);
 	isc_mem_free(manager->mctx, manager->threads);
 #endif /* USE_WORKER_THREADS */
+	destroy_queues(manager->mctx, manager->queues, manager->nqueues);
 	DESTROYLOCK(&manager->lock);
 	manager->common.impmagic = 0;
 	manager->common.magic = 0;
@@ -1376,21 +1747,16 @@ isc__taskmgr_create(isc_mem_t *mctx, unsigned int workers,
 		result = ISC_R_NOMEMORY;
 		goto cleanup_lock;
 	}
-	if (isc_condition_init(&manager->work_available) != ISC_R_SUCCESS) {
-		UNEXPECTED_ERROR(__FILE__, __LINE__,
-				 "isc_condition_init() %s",
-				 isc_msgcat_get(isc_msgcat, ISC_MSGSET_GENERAL,
-						ISC_MSG_FAILED, "failed"));
-		result = ISC_R_UNEXPECTED;
+	result = create_queues(manager, mctx, workers);
+	if (result != ISC_R_SUCCESS)
 		goto cleanup_threads;
-	}
 	if (isc_condition_init(&manager->exclusive_granted) != ISC_R_SUCCESS) {
 		UNEXPECTED_ERROR(__FILE__, __LINE__,
 				 "isc_condition_init() %s",
 				 isc_msgcat_get(isc_msgcat, ISC_MSGSET_GENERAL,
 						ISC_MSG_FAILED, "failed"));
 		result = ISC_R_UNEXPECTED;
-		goto cleanup_workavailable;
+		goto cleanup_queues;
 	}
 	if (isc_condition_init(&manager->paused) != ISC_R_SUCCESS) {
 		UNEXPECTED_ERROR(__FILE__, __LINE__,
@@ -1400,29 +1766,34 @@ isc__taskmgr_create(isc_mem_t *mctx, unsigned int workers,
 		result = ISC_R_UNEXPECTED;
 		goto cleanup_exclusivegranted;
 	}
+#else
+	result = create_queues(manager, mctx, 1);
+	if (result != ISC_R_SUCCESS)
+		goto cleanup_lock;
 #endif /* USE_WORKER_THREADS */
 	if (default_quantum == 0)
 		default_quantum = DEFAULT_DEFAULT_QUANTUM;
 	manager->default_quantum = default_quantum;
 	INIT_LIST(manager->tasks);
-	INIT_LIST(manager->ready_tasks);
-	INIT_LIST(manager->ready_priority_tasks);
-	manager->tasks_running = 0;
-	manager->tasks_ready = 0;
+	manager->nexthome = 0;
 	manager->exclusive_requested = ISC_FALSE;
 	manager->pause_requested = ISC_FALSE;
 	manager->exiting = ISC_FALSE;
+	manager->finished = ISC_FALSE;
 	manager->excl = NULL;
 
 	isc_mem_attach(mctx, &manager->mctx);
 
 #ifdef USE_WORKER_THREADS
+	RUNTIME_CHECK(isc_once_do(&workeronce, initialize_workerkey) ==
+		      ISC_R_SUCCESS);
 	LOCK(&manager->lock);
 	/*
-	 * Start workers.
+	 * Start workers.  Worker N serves queue N, so the queues of the
+	 * started workers are contiguous.
 	 */
 	for (i = 0; i < workers; i++) {
-		if (isc_thread_create(run, manager,
+		if (isc_thread_create(run, &manager->queues[manager->workers],
 				      &manager->threads[manager->workers]) ==
 		    ISC_R_SUCCESS) {
 			manager->workers++;
@@ -1449,13 +1820,13 @@ isc__taskmgr_create(isc_mem_t *mctx, unsigned int workers,
 #ifdef USE_WORKER_THREADS
  cleanup_exclusivegranted:
 	(void)isc_condition_destroy(&manager->exclusive_granted);
- cleanup_workavailable:
-	(void)isc_condition_destroy(&manager->work_available);
+ cleanup_queues:
+	destroy_queues(mctx, manager->queues, manager->nqueues);
  cleanup_threads:
 	isc_mem_free(mctx, manager->threads);
+#endif
  cleanup_lock:
 	DESTROYLOCK(&manager->lock);
-#endif
  cleanup_mgr:
 	isc_mem_put(mctx, manager, sizeof(*manager));
 	return (result);
@@ -1517,12 +1888,14 @@ isc__taskmgr_destroy(isc_taskmgr_t **managerp) {
 	 * Make sure we only get called once.
 	 */
 	INSIST(!manager->exiting);
+	lock_queues(manager);
 	manager->exiting = ISC_TRUE;
 
 	/*
 	 * If privileged mode was on, turn it off.
 	 */
 	manager->mode = isc_taskmgrmode_normal;
+	unlock_queues(manager);
 
 	/*
 	 * Post shutdown event(s) to every task (if they haven't already been
@@ -1532,17 +1905,27 @@ isc__taskmgr_destroy(isc_taskmgr_t **managerp) {
 	     task != NULL;
 	     task = NEXT(task, link)) {
 		LOCK(&task->lock);
-		if (task_shutdown(task))
-			push_readyq(manager, task);
+		if (task_shutdown(task)) {
+			isc__taskqueue_t *queue;
+
+			queue = &manager->queues[task->threadid];
+			LOCK(&queue->lock);
+			push_readyq(queue, task);
+			UNLOCK(&queue->lock);
+		}
 		UNLOCK(&task->lock);
 	}
+	lock_queues(manager);
+	if (FINISHED(manager))
+		manager->finished = ISC_TRUE;
 #ifdef USE_WORKER_THREADS
 	/*
 	 * Wake up any sleeping workers.  This ensures we get work done if
 	 * there's work left to do, and if there are already no tasks left
-	 * it will cause the workers to see manager->exiting.
+	 * it will cause the workers to see manager->finished.
 	 */
-	BROADCAST(&manager->work_available);
+	wake_workers(manager);
+	unlock_queues(manager);
 	UNLOCK(&manager->lock);
 
 	/*
@@ -1554,6 +1937,7 @@ isc__taskmgr_destroy(isc_taskmgr_t **managerp) {
 	/*
 	 * Dispatch the shutdown events.
 	 */
+	unlock_queues(manager);
 	UNLOCK(&manager->lock);
 	while (isc__taskmgr_ready((isc_taskmgr_t *)manager))
 		(void)isc__taskmgr_dispatch((isc_taskmgr_t *)manager);
@@ -1575,7 +1959,17 @@ isc__taskmgr_setmode(isc_taskmgr_t *manager0, isc_taskmgrmode_t mode) {
 	isc__taskmgr_t *manager = (isc__taskmgr_t *)manager0;
 
 	LOCK(&manager->lock);
+	lock_queues(manager);
 	manager->mode = mode;
+#ifdef USE_WORKER_THREADS
+	/*
+	 * Tasks which are not privileged were queued without waking up
+	 * their home workers.
+	 */
+	if (mode == isc_taskmgrmode_normal)
+		wake_workers(manager);
+#endif /* USE_WORKER_THREADS */
+	unlock_queues(manager);
 	UNLOCK(&manager->lock);
 }
 
@@ -1602,9 +1996,9 @@ isc__taskmgr_ready(isc_taskmgr_t *manager0) {
 	if (manager == NULL)
 		return (ISC_FALSE);
 
-	LOCK(&manager->lock);
-	is_ready = !empty_readyq(manager);
-	UNLOCK(&manager->lock);
+	LOCK(&manager->queues[0].lock);
+	is_ready = !empty_readyq(manager, &manager->queues[0]);
+	UNLOCK(&manager->queues[0].lock);
 
 	return (is_ready);
 }
@@ -1620,7 +2014,7 @@ isc__taskmgr_dispatch(isc_taskmgr_t *manager0) {
 	if (manager == NULL)
 		return (ISC_R_NOTFOUND);
 
-	dispatch(manager);
+	dispatch(manager, &manager->queues[0]);
 
 	return (ISC_R_SUCCESS);
 }
@@ -1629,11 +2023,22 @@ isc__taskmgr_dispatch(isc_taskmgr_t *manager0) {
 void
 isc__taskmgr_pause(isc_taskmgr_t *manager0) {
 	isc__taskmgr_t *manager = (isc__taskmgr_t *)manager0;
+	unsigned int running;
+
 	LOCK(&manager->lock);
-	while (manager->tasks_running > 0) {
+	/*
+	 * Stop the workers from starting new tasks, then wait for the
+	 * running ones to finish.
+	 */
+	lock_queues(manager);
+	manager->pause_requested = ISC_TRUE;
+	unlock_queues(manager);
+	for (;;) {
+		count_tasks(manager, &running, NULL);
+		if (running == 0)
+			break;
 		WAIT(&manager->paused, &manager->lock);
 	}
-	manager->pause_requested = ISC_TRUE;
 	UNLOCK(&manager->lock);
 }
 
@@ -1643,8 +2048,10 @@ isc__taskmgr_resume(isc_taskmgr_t *manager0) {
 
 	LOCK(&manager->lock);
 	if (manager->pause_requested) {
+		lock_queues(manager);
 		manager->pause_requested = ISC_FALSE;
-		BROADCAST(&manager->work_available);
+		wake_workers(manager);
+		unlock_queues(manager);
 	}
 	UNLOCK(&manager->lock);
 }
@@ -1676,11 +2083,52 @@ isc_taskmgr_excltask(isc_taskmgr_t *mgr0, isc_task_t **taskp) {
 	return (ISC_R_SUCCESS);
 }
 
+isc_result_t
+isc_taskmgr_setaffinity(isc_taskmgr_t *mgr0, const int *cpus,
+			unsigned int ncpus)
+{
+	isc__taskmgr_t *mgr = (isc__taskmgr_t *) mgr0;
+#ifdef USE_WORKER_THREADS
+	isc_result_t result = ISC_R_SUCCESS;
+	unsigned int i;
+#endif
+
+	REQUIRE(VALID_MANAGER(mgr));
+	REQUIRE(cpus != NULL || ncpus == 0);
+
+#ifdef USE_WORKER_THREADS
+	for (i = 0; i < mgr->workers && result == ISC_R_SUCCESS; i++)
+		result = isc_thread_setaffinity(mgr->threads[i],
+						ncpus == 0 ? -1 :
+						cpus[i % ncpus]);
+	return (result);
+#else
+	UNUSED(cpus);
+	UNUSED(ncpus);
+	return (ISC_R_NOTIMPLEMENTED);
+#endif /* USE_WORKER_THREADS */
+}
+
+int
+isc_taskmgr_currentworker(void) {
+#ifdef USE_WORKER_THREADS
+	size_t id;
+
+	RUNTIME_CHECK(isc_once_do(&workeronce, initialize_workerkey) ==
+		      ISC_R_SUCCESS);
+	id = (size_t)isc_thread_key_getspecific(workerkey);
+	return ((int)id - 1);
+#else
+	return (-1);
+#endif /* USE_WORKER_THREADS */
+}
+
 isc_result_t
 isc__task_beginexclusive(isc_task_t *task0) {
 #ifdef USE_WORKER_THREADS
 	isc__task_t *task = (isc__task_t *)task0;
 	isc__taskmgr_t *manager = task->manager;
+	unsigned int running;
 
 	REQUIRE(task->state == task_state_running);
 	/* XXX: Require task == manager->excl? */
@@ -1690,8 +2138,13 @@ isc__task_beginexclusive(isc_task_t *task0) {
 		UNLOCK(&manager->lock);
 		return (ISC_R_LOCKBUSY);
 	}
+	lock_queues(manager);
 	manager->exclusive_requested = ISC_TRUE;
-	while (manager->tasks_running > 1) {
+	unlock_queues(manager);
+	for (;;) {
+		count_tasks(manager, &running, NULL);
+		if (running <= 1)
+			break;
 		WAIT(&manager->exclusive_granted, &manager->lock);
 	}
 	UNLOCK(&manager->lock);
@@ -1710,8 +2163,10 @@ isc__task_endexclusive(isc_task_t *task0) {
 	REQUIRE(task->state == task_state_running);
 	LOCK(&manager->lock);
 	REQUIRE(manager->exclusive_requested);
+	lock_queues(manager);
 	manager->exclusive_requested = ISC_FALSE;
-	BROADCAST(&manager->work_available);
+	wake_workers(manager);
+	unlock_queues(manager);
 	UNLOCK(&manager->lock);
 #else
 	UNUSED(task0);
@@ -1721,7 +2176,7 @@ isc__task_endexclusive(isc_task_t *task0) {
 void
 isc__task_setprivilege(isc_task_t *task0, isc_boolean_t priv) {
 	isc__task_t *task = (isc__task_t *)task0;
-	isc__taskmgr_t *manager = task->manager;
+	isc__taskqueue_t *queue = &task->manager->queues[task->threadid];
 	isc_boolean_t oldpriv;
 
 	LOCK(&task->lock);
@@ -1735,14 +2190,14 @@ isc__task_setprivilege(isc_task_t *task0, isc_boolean_t priv) {
 	if (priv == oldpriv)
 		return;
 
-	LOCK(&manager->lock);
+	LOCK(&queue->lock);
 	if (priv && ISC_LINK_LINKED(task, ready_link))
-		ENQUEUE(manager->ready_priority_tasks, task,
+		ENQUEUE(queue->ready_priority_tasks, task,
 			ready_priority_link);
 	else if (!priv && ISC_LINK_LINKED(task, ready_priority_link))
-		DEQUEUE(manager->ready_priority_tasks, task,
+		DEQUEUE(queue->ready_priority_tasks, task,
 			ready_priority_link);
-	UNLOCK(&manager->lock);
+	UNLOCK(&queue->lock);
 }
 
 isc_boolean_t
@@ -1756,6 +2211,22 @@ isc__task_privilege(isc_task_t *task0) {
 	return (priv);
 }
 
+void
+isc_task_sethome(isc_task_t *task0, unsigned int threadid) {
+	isc__task_t *task = (isc__task_t *)task0;
+
+	REQUIRE(VALID_TASK(task));
+
+	/*
+	 * An idle task is on no ready queue, so moving it is safe; the
+	 * next task_ready() will use the new home.
+	 */
+	LOCK(&task->lock);
+	if (task->state == task_state_idle)
+		task->threadid = threadid % NWORKERS(task->manager);
+	UNLOCK(&task->lock);
+}
+
 isc_result_t
 isc__task_register(void) {
 	return (isc_task_register(isc__taskmgr_create));
@@ -1776,9 +2247,11 @@ int
 isc_taskmgr_renderxml(isc_taskmgr_t *mgr0, xmlTextWriterPtr writer) {
 	isc__taskmgr_t *mgr = (isc__taskmgr_t *)mgr0;
 	isc__task_t *task = NULL;
+	unsigned int running, ready;
 	int xmlrc;
 
 	LOCK(&mgr->lock);
+	count_tasks(mgr, &running, &ready);
 
 	/*
 	 * Write out the thread-model, and some details about each depending
@@ -1809,11 +2282,11 @@ isc_taskmgr_renderxml(isc_taskmgr_t *mgr0, xmlTextWriterPtr writer) {
 	TRY0(xmlTextWriterEndElement(writer)); /* default-quantum */
 
 	TRY0(xmlTextWriterStartElement(writer, ISC_XMLCHAR "tasks-running"));
-	TRY0(xmlTextWriterWriteFormatString(writer, "%d", mgr->tasks_running));
+	TRY0(xmlTextWriterWriteFormatString(writer, "%d", running));
 	TRY0(xmlTextWriterEndElement(writer)); /* tasks-running */
 
 	TRY0(xmlTextWriterStartElement(writer, ISC_XMLCHAR "tasks-ready"));
-	TRY0(xmlTextWriterWriteFormatString(writer, "%d", mgr->tasks_ready));
+	TRY0(xmlTextWriterWriteFormatString(writer, "%d", ready));
 	TRY0(xmlTextWriterEndElement(writer)); /* tasks-ready */
 
 	TRY0(xmlTextWriterEndElement(writer)); /* thread-model */
@@ -1887,8 +2360,10 @@ isc_taskmgr_renderjson(isc_taskmgr_t *mgr0, json_object *tasks) {
 	isc__taskmgr_t *mgr = (isc__taskmgr_t *)mgr0;
 	isc__task_t *task = NULL;
 	json_object *obj = NULL, *array = NULL, *taskobj = NULL;
+	unsigned int running, ready;
 
 	LOCK(&mgr->lock);
+	count_tasks(mgr, &running, &ready);
 
 	/*
 	 * Write out the thread-model, and some details about each depending
@@ -1916,11 +2391,11 @@ isc_taskmgr_renderjson(isc_taskmgr_t *mgr0, json_object *tasks) {
 	CHECKMEM(obj);
 	json_object_object_add(tasks, "default-quantum", obj);
 
-	obj = json_object_new_int(mgr->tasks_running);
+	obj = json_object_new_int(running);
 	CHECKMEM(obj);
 	json_object_object_add(tasks, "tasks-running", obj);
 
-	obj = json_object_new_int(mgr->tasks_ready);
+	obj = json_object_new_int(ready);
 	CHECKMEM(obj);
 	json_object_object_add(tasks, "tasks-ready", obj);
 
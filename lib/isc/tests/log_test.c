@@ -0,0 +1,534 @@
+/*
+ * Copyright (C) 2014  Internet Systems Consortium, Inc. ("ISC")
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS.  IN NO EVENT SHALL ISC BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE
+ * OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/* $Id$ */
+
+/*! \file */
+
+#include <config.h>
+
+#include <atf-c.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/stat.h>
+
+#include <isc/log.h>
+#include <isc/mem.h>
+#include <isc/thread.h>
+#include <isc/util.h>
+
+#include "isctest.h"
+
+/*
+ * Helper functions
+ */
+
+#if defined(ISC_PLATFORM_USETHREADS) && !defined(WIN32)
+/*
+ * Every line logged is "line <n> " followed by LINEPAD 'x's.  Logging
+ * LONGRUN of them queues more than an asynchronous channel's ring (1MB)
+ * and a pipe's buffer can hold together.
+ */
+#define LINEPAD		1000
+#define LONGRUN		3000
+
+static char pad[LINEPAD + 1];
+
+/*
+ * What was found in the output of a channel: the numbered lines, which
+ * must appear in order, and the "N log messages dropped" notes.
+ */
+typedef struct {
+	unsigned int		next;		/* lowest number expected */
+	unsigned int		lines;
+	unsigned int		dropped;	/* total of the notes */
+	isc_boolean_t		gaps;		/* missing lines allowed */
+	isc_boolean_t		bad;
+} scan_t;
+
+static void
+scan_init(scan_t *scan, unsigned int first, isc_boolean_t gaps) {
+	memset(scan, 0, sizeof(*scan));
+	scan->next = first;
+	scan->gaps = gaps;
+}
+
+static void
+scan_line(scan_t *scan, const char *line) {
+	unsigned int n;
+
+	if (sscanf(line, "line %u ", &n) == 1) {
+		if (n < scan->next || (!scan->gaps && n != scan->next)) {
+			fprintf(stderr, "line %u, expected %u\n",
+				n, scan->next);
+			scan->bad = ISC_TRUE;
+		}
+		scan->next = n + 1;
+		scan->lines++;
+	} else if (sscanf(line, "%u log messages dropped", &n) == 1)
+		scan->dropped += n;
+	else {
+		fprintf(stderr, "unexpected line '%.40s'\n", line);
+		scan->bad = ISC_TRUE;
+	}
+}
+
+static void
+scan_text(scan_t *scan, char *text) {
+	char *line, *eol;
+
+	for (line = text; *line != '\0'; line = eol + 1) {
+		eol = strchr(line, '\n');
+		ATF_REQUIRE(eol != NULL);
+		*eol = '\0';
+		scan_line(scan, line);
+	}
+}
+
+/*
+ * Scan 'file', which must exist.
+ */
+static void
+scan_file(scan_t *scan, const char *file) {
+	char line[LINEPAD + 100];
+	FILE *fp;
+
+	fp = fopen(file, "r");
+	ATF_REQUIRE_MSG(fp != NULL, "cannot open %s", file);
+	while (fgets(line, sizeof(line), fp) != NULL)
+		scan_line(scan, line);
+	fclose(fp);
+}
+
+static void
+logit(unsigned int from, unsigned int to) {
+	unsigned int i;
+
+	for (i = from; i < to; i++)
+		isc_log_write(lctx, ISC_LOGCATEGORY_GENERAL,
+			      ISC_LOGMODULE_OTHER, ISC_LOG_INFO,
+			      "line %u %s", i, pad);
+}
+
+static off_t
+linebytes(unsigned int from, unsigned int to) {
+	char num[32];
+	off_t bytes = 0;
+	unsigned int i;
+
+	for (i = from; i < to; i++) {
+		snprintf(num, sizeof(num), "%u", i);
+		bytes += strlen("line  \n") + strlen(num) + LINEPAD;
+	}
+	return (bytes);
+}
+
+/*
+ * Wait up to five seconds for the writer to bring 'file' to 'size'.
+ */
+static void
+waitsize(const char *file, off_t size) {
+	struct stat sb;
+	int i;
+
+	for (i = 0; i < 500; i++) {
+		if (stat(file, &sb) == 0 && sb.st_size >= size)
+			break;
+		isc_test_nap(10000);
+	}
+	ATF_REQUIRE_EQ(stat(file, &sb), 0);
+	ATF_REQUIRE_EQ(sb.st_size, size);
+}
+
+/*
+ * Create the log context with an asynchronous channel that gets every
+ * category.
+ */
+static void
+setup(isc_logconfig_t **lcfgp, unsigned int type, FILE *stream,
+      const char *file, int versions, isc_offset_t maxsize,
+      unsigned int flags)
+{
+	isc_logdestination_t destination;
+	isc_result_t result;
+
+	memset(pad, 'x', LINEPAD);
+	pad[LINEPAD] = '\0';
+
+	result = isc_test_begin(NULL, ISC_FALSE);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+
+	result = isc_log_create(mctx, &lctx, lcfgp);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+
+	destination.file.stream = stream;
+	destination.file.name = file;
+	destination.file.versions = versions;
+	destination.file.maximum_size = maxsize;
+	result = isc_log_createchannel(*lcfgp, "async", type, ISC_LOG_INFO,
+				       &destination, ISC_LOG_ASYNC | flags);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+	result = isc_log_usechannel(*lcfgp, "async", NULL, NULL);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+}
+
+/*
+ * Replace the configuration with an empty one.  isc_logconfig_use()
+ * destroys the old one, which must write out everything queued for its
+ * channel first.
+ */
+static void
+drain(isc_logconfig_t **lcfgp) {
+	isc_logconfig_t *empty = NULL;
+	isc_result_t result;
+
+	result = isc_logconfig_create(lctx, &empty);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+	result = isc_logconfig_use(lctx, empty);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+	*lcfgp = NULL;
+}
+
+/*
+ * Collects what an asynchronous channel writes into a pipe, starting
+ * 'delay' microseconds after it is started.
+ */
+typedef struct {
+	int			fd;
+	isc_uint32_t		delay;
+	char *			text;
+	size_t			len;
+	size_t			size;
+} reader_t;
+
+static isc_threadresult_t
+#ifdef _WIN32
+WINAPI
+#endif
+reader_run(isc_threadarg_t arg) {
+	reader_t *reader = arg;
+	ssize_t n;
+
+	if (reader->delay != 0)
+		isc_test_nap(reader->delay);
+	for (;;) {
+		if (reader->size - reader->len < 65536) {
+			reader->size += 1024 * 1024;
+			reader->text = realloc(reader->text, reader->size);
+			if (reader->text == NULL)
+				break;
+		}
+		n = read(reader->fd, reader->text + reader->len,
+			 reader->size - reader->len - 1);
+		if (n <= 0)
+			break;
+		reader->len += n;
+	}
+	if (reader->text != NULL)
+		reader->text[reader->len] = '\0';
+
+	return ((isc_threadresult_t)0);
+}
+
+static void
+pipe_open(reader_t *reader, FILE **streamp) {
+	int fds[2];
+
+	ATF_REQUIRE_EQ(pipe(fds), 0);
+	memset(reader, 0, sizeof(*reader));
+	reader->fd = fds[0];
+	*streamp = fdopen(fds[1], "w");
+	ATF_REQUIRE(*streamp != NULL);
+}
+
+/*
+ * Close the write end of the pipe and wait for the reader to see the
+ * end of it.
+ */
+static void
+pipe_close(reader_t *reader, isc_thread_t thread, FILE *stream) {
+	fclose(stream);
+	(void)isc_thread_join(thread, NULL);
+	close(reader->fd);
+	ATF_REQUIRE(reader->text != NULL);
+}
+#endif
+
+/*
+ * Individual unit tests
+ */
+
+ATF_TC(ordered);
+ATF_TC_HEAD(ordered, tc) {
+	atf_tc_set_md_var(tc, "descr", "an asynchronous file channel writes "
+			  "every line in order");
+}
+ATF_TC_BODY(ordered, tc) {
+#if defined(ISC_PLATFORM_USETHREADS) && !defined(WIN32)
+	isc_logconfig_t *lcfg = NULL;
+	scan_t scan;
+
+	UNUSED(tc);
+
+	(void)unlink("log_test.ordered");
+	setup(&lcfg, ISC_LOG_TOFILE, NULL, "log_test.ordered",
+	      ISC_LOG_ROLLNEVER, 0, 0);
+
+	logit(0, 500);
+
+	drain(&lcfg);
+
+	scan_init(&scan, 0, ISC_FALSE);
+	scan_file(&scan, "log_test.ordered");
+	ATF_CHECK(!scan.bad);
+	ATF_CHECK_EQ(scan.lines, 500);
+	ATF_CHECK_EQ(scan.dropped, 0);
+	ATF_CHECK_EQ(isc_log_getdropped(lctx), 0);
+
+	(void)unlink("log_test.ordered");
+	isc_test_end();
+#else
+	UNUSED(tc);
+	atf_tc_skip("asynchronous channels need threads");
+#endif
+}
+
+ATF_TC(drop);
+ATF_TC_HEAD(drop, tc) {
+	atf_tc_set_md_var(tc, "descr", "a full ring drops lines, counts them "
+			  "and says so in the log");
+}
+ATF_TC_BODY(drop, tc) {
+#if defined(ISC_PLATFORM_USETHREADS) && !defined(WIN32)
+	isc_logconfig_t *lcfg = NULL;
+	reader_t reader;
+	isc_thread_t thread;
+	isc_uint64_t dropped;
+	FILE *stream;
+	scan_t scan;
+
+	UNUSED(tc);
+
+	/*
+	 * Nothing reads the pipe while the lines are logged, so the
+	 * writer stalls and the ring fills up.
+	 */
+	pipe_open(&reader, &stream);
+	setup(&lcfg, ISC_LOG_TOFILEDESC, stream, NULL,
+	      ISC_LOG_ROLLNEVER, 0, 0);
+
+	logit(0, LONGRUN);
+
+	dropped = isc_log_getdropped(lctx);
+	ATF_CHECK(dropped > 0);
+	ATF_CHECK(dropped < LONGRUN);
+
+	ATF_REQUIRE_EQ(isc_thread_create(reader_run, &reader, &thread),
+		       ISC_R_SUCCESS);
+	drain(&lcfg);
+	pipe_close(&reader, thread, stream);
+
+	scan_init(&scan, 0, ISC_TRUE);
+	scan_text(&scan, reader.text);
+	ATF_CHECK(!scan.bad);
+	ATF_CHECK_EQ(scan.lines + dropped, LONGRUN);
+	ATF_CHECK_EQ(scan.dropped, dropped);
+	ATF_CHECK_EQ(isc_log_getdropped(lctx), dropped);
+
+	free(reader.text);
+	isc_test_end();
+#else
+	UNUSED(tc);
+	atf_tc_skip("asynchronous channels need threads");
+#endif
+}
+
+ATF_TC(block);
+ATF_TC_HEAD(block, tc) {
+	atf_tc_set_md_var(tc, "descr", "with the block policy a full ring "
+			  "makes the caller wait and no line is lost");
+}
+ATF_TC_BODY(block, tc) {
+#if defined(ISC_PLATFORM_USETHREADS) && !defined(WIN32)
+	isc_logconfig_t *lcfg = NULL;
+	reader_t reader;
+	isc_thread_t thread;
+	FILE *stream;
+	scan_t scan;
+
+	UNUSED(tc);
+
+	/*
+	 * The reader only starts after the ring has filled up and the
+	 * logging has had to wait.
+	 */
+	pipe_open(&reader, &stream);
+	reader.delay = 200000;
+	setup(&lcfg, ISC_LOG_TOFILEDESC, stream, NULL,
+	      ISC_LOG_ROLLNEVER, 0, ISC_LOG_ASYNCBLOCK);
+	ATF_REQUIRE_EQ(isc_thread_create(reader_run, &reader, &thread),
+		       ISC_R_SUCCESS);
+
+	logit(0, LONGRUN);
+
+	drain(&lcfg);
+	pipe_close(&reader, thread, stream);
+
+	scan_init(&scan, 0, ISC_FALSE);
+	scan_text(&scan, reader.text);
+	ATF_CHECK(!scan.bad);
+	ATF_CHECK_EQ(scan.lines, LONGRUN);
+	ATF_CHECK_EQ(scan.dropped, 0);
+	ATF_CHECK_EQ(isc_log_getdropped(lctx), 0);
+
+	free(reader.text);
+	isc_test_end();
+#else
+	UNUSED(tc);
+	atf_tc_skip("asynchronous channels need threads");
+#endif
+}
+
+ATF_TC(reopen);
+ATF_TC_HEAD(reopen, tc) {
+	atf_tc_set_md_var(tc, "descr", "isc_log_closefilelogs() makes the "
+			  "writer reopen the file for later lines");
+}
+ATF_TC_BODY(reopen, tc) {
+#if defined(ISC_PLATFORM_USETHREADS) && !defined(WIN32)
+	isc_logconfig_t *lcfg = NULL;
+	scan_t scan;
+
+	UNUSED(tc);
+
+	(void)unlink("log_test.reopen");
+	(void)unlink("log_test.moved");
+	setup(&lcfg, ISC_LOG_TOFILE, NULL, "log_test.reopen",
+	      ISC_LOG_ROLLNEVER, 0, 0);
+
+	/*
+	 * Move the file away, as a log rotation would, once the first
+	 * lines are in it.
+	 */
+	logit(0, 10);
+	waitsize("log_test.reopen", linebytes(0, 10));
+	ATF_REQUIRE_EQ(rename("log_test.reopen", "log_test.moved"), 0);
+
+	isc_log_closefilelogs(lctx);
+	logit(10, 20);
+
+	drain(&lcfg);
+
+	scan_init(&scan, 0, ISC_FALSE);
+	scan_file(&scan, "log_test.moved");
+	ATF_CHECK(!scan.bad);
+	ATF_CHECK_EQ(scan.lines, 10);
+
+	scan_init(&scan, 10, ISC_FALSE);
+	scan_file(&scan, "log_test.reopen");
+	ATF_CHECK(!scan.bad);
+	ATF_CHECK_EQ(scan.lines, 10);
+
+	(void)unlink("log_test.reopen");
+	(void)unlink("log_test.moved");
+	isc_test_end();
+#else
+	UNUSED(tc);
+	atf_tc_skip("asynchronous channels need threads");
+#endif
+}
+
+ATF_TC(roll);
+ATF_TC_HEAD(roll, tc) {
+	atf_tc_set_md_var(tc, "descr", "the writer rolls a file that "
+			  "reached its maximum size");
+}
+ATF_TC_BODY(roll, tc) {
+#if defined(ISC_PLATFORM_USETHREADS) && !defined(WIN32)
+	isc_logconfig_t *lcfg = NULL;
+	char file[64];
+	scan_t scan;
+	int i, versions;
+
+	UNUSED(tc);
+
+	(void)unlink("log_test.roll");
+	for (i = 0; i < 20; i++) {
+		snprintf(file, sizeof(file), "log_test.roll.%d", i);
+		(void)unlink(file);
+	}
+	setup(&lcfg, ISC_LOG_TOFILE, NULL, "log_test.roll",
+	      ISC_LOG_ROLLINFINITE, 4096, 0);
+
+	/*
+	 * The first lines take the file past its limit; the line after
+	 * them has to go to a new one.
+	 */
+	logit(0, 10);
+	waitsize("log_test.roll", linebytes(0, 10));
+	logit(10, 11);
+
+	drain(&lcfg);
+
+	/*
+	 * However the lines were split between the files, the oldest
+	 * version comes first and together they hold every line.
+	 */
+	for (versions = 0; versions < 20; versions++) {
+		snprintf(file, sizeof(file), "log_test.roll.%d", versions);
+		if (access(file, F_OK) != 0)
+			break;
+	}
+	ATF_CHECK(versions > 0);
+
+	scan_init(&scan, 0, ISC_FALSE);
+	for (i = versions - 1; i >= 0; i--) {
+		snprintf(file, sizeof(file), "log_test.roll.%d", i);
+		scan_file(&scan, file);
+		(void)unlink(file);
+	}
+	scan_file(&scan, "log_test.roll");
+	ATF_CHECK(!scan.bad);
+	ATF_CHECK_EQ(scan.lines, 11);
+
+	scan_init(&scan, 10, ISC_FALSE);
+	scan_file(&scan, "log_test.roll");
+	ATF_CHECK(!scan.bad);
+	ATF_CHECK_EQ(scan.lines, 1);
+
+	(void)unlink("log_test.roll");
+	isc_test_end();
+#else
+	UNUSED(tc);
+	atf_tc_skip("asynchronous channels need threads");
+#endif
+}
+
+/*
+ * Main
+ */
+ATF_TP_ADD_TCS(tp) {
+	ATF_TP_ADD_TC(tp, ordered);
+	ATF_TP_ADD_TC(tp, drop);
+	ATF_TP_ADD_TC(tp, block);
+	ATF_TP_ADD_TC(tp, reopen);
+	ATF_TP_ADD_TC(tp, roll);
+	return (atf_no_error());
+}
@@ -0,0 +1,347 @@
+/*
+ * Copyright (C) 2014  Internet Systems Consortium, Inc. ("ISC")
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS.  IN NO EVENT SHALL ISC BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE
+ * OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/* $Id$ */
+
+/*! \file */
+
+#include <config.h>
+
+#include <atf-c.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <isc/mem.h>
+#include <isc/mutex.h>
+#include <isc/os.h>
+#include <isc/thread.h>
+#include <isc/util.h>
+
+/*
+ * These tests deliberately do not use isc_test_begin(): it turns on
+ * ISC_MEM_DEBUGRECORD, which bypasses the thread caches under test.
+ */
+
+#define NTHREADS	4
+#define NITEMS		2000
+
+/*
+ * Helper functions
+ */
+
+/*
+ * A system allocator which counts the blocks it has handed out and not
+ * yet been given back.
+ */
+static isc_mutex_t syslock;
+static int sysblocks = 0;
+
+static void *
+sysalloc(void *arg, size_t size) {
+	void *p;
+
+	UNUSED(arg);
+
+	p = malloc(size == 0U ? 1 : size);
+	if (p != NULL) {
+		LOCK(&syslock);
+		sysblocks++;
+		UNLOCK(&syslock);
+	}
+	return (p);
+}
+
+static void
+sysfree(void *arg, void *p) {
+	UNUSED(arg);
+
+	LOCK(&syslock);
+	sysblocks--;
+	UNLOCK(&syslock);
+	free(p);
+}
+
+/*
+ * Sizes from a few bytes up to beyond the largest size class, so some
+ * allocations bypass the caches.
+ */
+static size_t
+itemsize(unsigned int i) {
+	return (8 + (i * 37) % 1200);
+}
+
+typedef struct work work_t;
+struct work {
+	isc_mem_t *		mctx;
+	void *			items[NITEMS];
+	isc_boolean_t		mallocated;	/* isc_mem_allocate() */
+	work_t *		next;		/* whose items to free */
+};
+
+/*
+ * Threads which have allocated their items; each thread waits for all
+ * of them before it frees the items of another one.
+ */
+static unsigned int ready;
+
+static void
+allocate(work_t *work) {
+	unsigned int i;
+
+	for (i = 0; i < NITEMS; i++) {
+		if (work->mallocated)
+			work->items[i] = isc_mem_allocate(work->mctx,
+							  itemsize(i));
+		else
+			work->items[i] = isc_mem_get(work->mctx,
+						     itemsize(i));
+		if (work->items[i] != NULL)
+			memset(work->items[i], i & 0xff, itemsize(i));
+	}
+}
+
+static void
+release(work_t *work) {
+	unsigned int i;
+
+	for (i = 0; i < NITEMS; i++) {
+		if (work->items[i] == NULL)
+			continue;
+		if (work->mallocated)
+			isc_mem_free(work->mctx, work->items[i]);
+		else
+			isc_mem_put(work->mctx, work->items[i], itemsize(i));
+		work->items[i] = NULL;
+	}
+}
+
+static isc_threadresult_t
+#ifdef WIN32
+WINAPI
+#endif
+crossworker(isc_threadarg_t arg) {
+	work_t *work = arg;
+	unsigned int n;
+
+	allocate(work);
+
+	LOCK(&syslock);
+	ready++;
+	UNLOCK(&syslock);
+	do {
+		isc_thread_yield();
+		LOCK(&syslock);
+		n = ready;
+		UNLOCK(&syslock);
+	} while (n < NTHREADS);
+
+	release(work->next);
+	return ((isc_threadresult_t)0);
+}
+
+static isc_threadresult_t
+#ifdef WIN32
+WINAPI
+#endif
+ownworker(isc_threadarg_t arg) {
+	work_t *work = arg;
+
+	allocate(work);
+	release(work);
+	return ((isc_threadresult_t)0);
+}
+
+/*
+ * Run 'func' on every piece of 'work' on threads of its own.
+ */
+static void
+run(isc_threadfunc_t func, work_t *work) {
+	isc_thread_t threads[NTHREADS];
+	unsigned int i;
+
+	ready = 0;
+	for (i = 0; i < NTHREADS; i++)
+		ATF_REQUIRE_EQ(isc_thread_create(func, &work[i], &threads[i]),
+			       ISC_R_SUCCESS);
+	for (i = 0; i < NTHREADS; i++)
+		ATF_REQUIRE_EQ(isc_thread_join(threads[i], NULL),
+			       ISC_R_SUCCESS);
+}
+
+static void
+setup(isc_mem_t **mctxp, work_t *work) {
+	unsigned int i;
+
+	ATF_REQUIRE_EQ(isc_mutex_init(&syslock), ISC_R_SUCCESS);
+	sysblocks = 0;
+	ATF_REQUIRE_EQ(isc_mem_createx2(0, 0, sysalloc, sysfree, NULL, mctxp,
+					ISC_MEMFLAG_INTERNAL),
+		       ISC_R_SUCCESS);
+	memset(work, 0, NTHREADS * sizeof(*work));
+	for (i = 0; i < NTHREADS; i++) {
+		work[i].mctx = *mctxp;
+		work[i].mallocated = ISC_TF(i % 2 == 1);
+		work[i].next = &work[(i + 1) % NTHREADS];
+	}
+}
+
+/*
+ * Individual unit tests
+ */
+
+/* Memory freed on another thread than it was allocated on */
+ATF_TC(cross_thread);
+ATF_TC_HEAD(cross_thread, tc) {
+	atf_tc_set_md_var(tc, "descr", "free memory on other threads");
+}
+ATF_TC_BODY(cross_thread, tc) {
+	isc_mem_t *mctx = NULL;
+	static work_t work[NTHREADS];
+	void *p;
+	int round;
+
+	UNUSED(tc);
+
+	setup(&mctx, work);
+
+	/*
+	 * Each thread frees what its neighbour allocated, while the
+	 * neighbour is still running with its cache.
+	 */
+	for (round = 0; round < 3; round++) {
+		run(crossworker, work);
+
+		/*
+		 * Everything has been given back; what the threads kept
+		 * in their caches is not in use.
+		 */
+		ATF_CHECK_EQ(isc_mem_inuse(mctx), 0);
+	}
+
+	p = isc_mem_get(mctx, 100);
+	ATF_REQUIRE(p != NULL);
+	ATF_CHECK(isc_mem_inuse(mctx) >= 100U);
+	isc_mem_put(mctx, p, 100);
+	ATF_CHECK_EQ(isc_mem_inuse(mctx), 0);
+
+	isc_mem_destroy(&mctx);
+	ATF_CHECK_EQ(sysblocks, 0);
+	DESTROYLOCK(&syslock);
+}
+
+/* A context destroyed while thread caches still hold memory */
+ATF_TC(destroy_cached);
+ATF_TC_HEAD(destroy_cached, tc) {
+	atf_tc_set_md_var(tc, "descr", "destroy a context with full caches");
+}
+ATF_TC_BODY(destroy_cached, tc) {
+	isc_mem_t *mctx = NULL;
+	static work_t work[NTHREADS];
+	void *p;
+
+	UNUSED(tc);
+
+	setup(&mctx, work);
+
+	/*
+	 * Threads which allocate and free on their own fill their caches,
+	 * and exit with the caches still full.
+	 */
+	run(ownworker, work);
+	ATF_CHECK_EQ(isc_mem_inuse(mctx), 0);
+
+	/*
+	 * The main thread leaves its cache stocked too.
+	 */
+	p = isc_mem_get(mctx, 64);
+	ATF_REQUIRE(p != NULL);
+	isc_mem_put(mctx, p, 64);
+	ATF_CHECK_EQ(isc_mem_inuse(mctx), 0);
+
+	/*
+	 * Destroying the context checks that every fragment was given
+	 * back, and must hand all memory back to the system allocator.
+	 */
+	isc_mem_destroy(&mctx);
+	ATF_CHECK_EQ(sysblocks, 0);
+	DESTROYLOCK(&syslock);
+}
+
+/* Blocks taken from a NUMA node */
+ATF_TC(node);
+ATF_TC_HEAD(node, tc) {
+	atf_tc_set_md_var(tc, "descr", "take the blocks of a context "
+			  "from a NUMA node");
+}
+ATF_TC_BODY(node, tc) {
+	isc_mem_t *mctx = NULL;
+	isc_result_t result;
+	size_t nodesize;
+	void *p;
+	int node;
+
+	UNUSED(tc);
+
+	result = isc_mem_create(0, 0, &mctx);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+
+	/*
+	 * The node of the first processor exists on any system which
+	 * tells; others only have node 0.
+	 */
+	node = isc_os_cpunode(0);
+	if (node < 0)
+		node = 0;
+	result = isc_mem_setnode(mctx, node);
+	if (result == ISC_R_NOTIMPLEMENTED) {
+		isc_mem_destroy(&mctx);
+		atf_tc_skip("memory cannot be placed on a node");
+	}
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+	ATF_CHECK_EQ(isc_mem_setnode(mctx, 1000), ISC_R_RANGE);
+
+	/*
+	 * Small allocations come from blocks mapped for the node.
+	 */
+	p = isc_mem_get(mctx, 64);
+	ATF_REQUIRE(p != NULL);
+	memset(p, 0, 64);
+	nodesize = isc_mem_nodesize(mctx);
+	ATF_CHECK(nodesize > 0);
+	isc_mem_put(mctx, p, 64);
+
+	/*
+	 * Going back to system placement leaves the blocks already
+	 * obtained where they are.
+	 */
+	ATF_CHECK_EQ(isc_mem_setnode(mctx, -1), ISC_R_SUCCESS);
+	ATF_CHECK_EQ(isc_mem_nodesize(mctx), nodesize);
+
+	isc_mem_destroy(&mctx);
+}
+
+/*
+ * Main
+ */
+ATF_TP_ADD_TCS(tp) {
+	ATF_TP_ADD_TC(tp, cross_thread);
+	ATF_TP_ADD_TC(tp, destroy_cached);
+	ATF_TP_ADD_TC(tp, node);
+
+	return (atf_no_error());
+}
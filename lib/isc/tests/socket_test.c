@@ -26,6 +26,7 @@
 #include <time.h>
 
 #include <isc/socket.h>
+#include <isc/stats.h>
 
 #include "../task_p.h"
 #include "../unix/socket_p.h"
@@ -511,6 +512,116 @@ ATF_TC_BODY(udp_dscp_v6, tc) {
 	isc_test_end();
 }
 
+#define NBATCH 16
+
+static void
+batch_counter(isc_statscounter_t counter, isc_uint64_t value, void *arg) {
+	isc_uint64_t *counters = arg;
+
+	if (counter == isc_sockstatscounter_udp4recvbatch)
+		counters[0] = value;
+	else if (counter == isc_sockstatscounter_udp4recvbatchmsgs)
+		counters[1] = value;
+}
+
+/* Test batched UDP reads and a burst of writes */
+ATF_TC(udp_batch);
+ATF_TC_HEAD(udp_batch, tc) {
+	atf_tc_set_md_var(tc, "descr", "UDP reads queued on a socket are "
+			  "filled in batches without losing datagrams");
+}
+ATF_TC_BODY(udp_batch, tc) {
+	isc_result_t result;
+	isc_sockaddr_t addr1, addr2;
+	struct in_addr in;
+	isc_socket_t *s1 = NULL, *s2 = NULL;
+	isc_task_t *task = NULL;
+	isc_stats_t *stats = NULL;
+	char sendbuf[NBATCH][16], recvbuf[NBATCH][BUFSIZ];
+	completion_t sent[NBATCH], received[NBATCH];
+	isc_uint64_t counters[2] = { 0, 0 };
+	isc_region_t r;
+	int i, n;
+
+	UNUSED(tc);
+
+	result = isc_test_begin(NULL, ISC_TRUE);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+
+	result = isc_stats_create(mctx, &stats, isc_sockstatscounter_max);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+	isc_socketmgr_setstats(socketmgr, stats);
+
+	in.s_addr = inet_addr("127.0.0.1");
+	isc_sockaddr_fromin(&addr1, &in, 5446);
+	isc_sockaddr_fromin(&addr2, &in, 5447);
+
+	result = isc_socket_create(socketmgr, PF_INET, isc_sockettype_udp, &s1);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+	result = isc_socket_bind(s1, &addr1, ISC_SOCKET_REUSEADDRESS);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+
+	result = isc_socket_create(socketmgr, PF_INET, isc_sockettype_udp, &s2);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+	result = isc_socket_bind(s2, &addr2, ISC_SOCKET_REUSEADDRESS);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+
+	result = isc_task_create(taskmgr, 0, &task);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+
+	/*
+	 * Nothing has been sent yet, so all reads are queued and the later
+	 * ones join the first.
+	 */
+	for (i = 0; i < NBATCH; i++) {
+		memset(recvbuf[i], 0, sizeof(recvbuf[i]));
+		r.base = (void *) recvbuf[i];
+		r.length = sizeof(recvbuf[i]);
+		completion_init(&received[i]);
+		result = isc_socket_recv(s2, &r, 1, task, event_done,
+					 &received[i]);
+		ATF_CHECK_EQ(result, ISC_R_SUCCESS);
+	}
+
+	for (i = 0; i < NBATCH; i++) {
+		snprintf(sendbuf[i], sizeof(sendbuf[i]), "Hello %d", i);
+		r.base = (void *) sendbuf[i];
+		r.length = strlen(sendbuf[i]) + 1;
+		completion_init(&sent[i]);
+		result = isc_socket_sendto(s1, &r, task, event_done, &sent[i],
+					   &addr2, NULL);
+		ATF_CHECK_EQ(result, ISC_R_SUCCESS);
+	}
+
+	for (i = 0; i < NBATCH; i++) {
+		waitfor2(&sent[i], &received[i]);
+		ATF_CHECK(sent[i].done);
+		ATF_CHECK_EQ(sent[i].result, ISC_R_SUCCESS);
+		ATF_CHECK(received[i].done);
+		ATF_CHECK_EQ(received[i].result, ISC_R_SUCCESS);
+	}
+
+	/* Every datagram arrived once, in order */
+	for (i = 0; i < NBATCH; i++) {
+		ATF_CHECK_EQ(sscanf(recvbuf[i], "Hello %d", &n), 1);
+		ATF_CHECK_EQ(n, i);
+	}
+
+#ifdef HAVE_RECVMMSG
+	isc_stats_dump(stats, batch_counter, counters, ISC_STATSDUMP_VERBOSE);
+	ATF_CHECK(counters[0] > 0);
+	ATF_CHECK(counters[1] > counters[0]);
+#endif
+
+	isc_task_detach(&task);
+
+	isc_socket_detach(&s1);
+	isc_socket_detach(&s2);
+
+	isc_stats_detach(&stats);
+	isc_test_end();
+}
+
 /* Test TCP sendto/recv (IPv4) */
 ATF_TC(tcp_dscp_v4);
 ATF_TC_HEAD(tcp_dscp_v4, tc) {
@@ -760,6 +871,7 @@ ATF_TC_BODY(net_probedscp, tc) {
 ATF_TP_ADD_TCS(tp) {
 	ATF_TP_ADD_TC(tp, udp_sendto);
 	ATF_TP_ADD_TC(tp, udp_dup);
+	ATF_TP_ADD_TC(tp, udp_batch);
 	ATF_TP_ADD_TC(tp, tcp_dscp_v4);
 	ATF_TP_ADD_TC(tp, tcp_dscp_v6);
 	ATF_TP_ADD_TC(tp, udp_dscp_v4);
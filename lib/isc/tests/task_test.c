@@ -64,6 +64,42 @@ set_and_drop(isc_task_t *task, isc_event_t *event) {
 	isc_taskmgr_setmode(taskmgr, isc_taskmgrmode_normal);
 }
 
+#ifdef ISC_PLATFORM_USETHREADS
+static int started = 0, released = 0;
+
+/* task event handler, waits up to five seconds to be released */
+static void
+block(isc_task_t *task, isc_event_t *event) {
+	isc_boolean_t *value = (isc_boolean_t *) event->ev_arg;
+	int i = 0, done = 0;
+
+	UNUSED(task);
+
+	isc_event_free(&event);
+	LOCK(&set_lock);
+	started = 1;
+	UNLOCK(&set_lock);
+	while (!done && i++ < 5000) {
+		isc_test_nap(1000);
+		LOCK(&set_lock);
+		done = released;
+		UNLOCK(&set_lock);
+	}
+	*value = ISC_TF(done != 0);
+}
+
+/* task event handler, releases block() */
+static void
+release(isc_task_t *task, isc_event_t *event) {
+	UNUSED(task);
+
+	isc_event_free(&event);
+	LOCK(&set_lock);
+	released = 1;
+	UNLOCK(&set_lock);
+}
+#endif
+
 /*
  * Individual unit tests
  */
@@ -402,6 +438,147 @@ ATF_TC_BODY(privilege_drop, tc) {
 	isc_test_end();
 }
 
+/* An idle worker steals the tasks queued behind a busy one */
+ATF_TC(steal);
+ATF_TC_HEAD(steal, tc) {
+	atf_tc_set_md_var(tc, "descr", "idle workers steal ready tasks");
+}
+ATF_TC_BODY(steal, tc) {
+#ifdef ISC_PLATFORM_USETHREADS
+	isc_result_t result;
+	isc_taskmgr_t *manager = NULL;
+	isc_task_t *task1 = NULL, *task2 = NULL, *task3 = NULL;
+	isc_event_t *event;
+	isc_boolean_t unblocked = ISC_FALSE;
+	int i = 0, go = 0;
+
+	UNUSED(tc);
+
+	result = isc_mutex_init(&set_lock);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+
+	result = isc_test_begin(NULL, ISC_FALSE);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+
+	/*
+	 * Two workers: the tasks are homed round robin, so task1 and
+	 * task3 share the first worker.
+	 */
+	result = isc_taskmgr_create(mctx, 2, 0, &manager);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+	result = isc_task_create(manager, 0, &task1);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+	result = isc_task_create(manager, 0, &task2);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+	result = isc_task_create(manager, 0, &task3);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+
+	event = isc_event_allocate(mctx, task1, ISC_TASKEVENT_TEST,
+				   block, &unblocked, sizeof (isc_event_t));
+	ATF_REQUIRE(event != NULL);
+	isc_task_send(task1, &event);
+
+	while (!go && i++ < 5000) {
+		isc_test_nap(1000);
+		LOCK(&set_lock);
+		go = started;
+		UNLOCK(&set_lock);
+	}
+	ATF_REQUIRE(go);
+
+	/*
+	 * Whichever worker runs task1, the other one is idle and must
+	 * run task3 while task1 is still blocked.
+	 */
+	event = isc_event_allocate(mctx, task3, ISC_TASKEVENT_TEST,
+				   release, NULL, sizeof (isc_event_t));
+	ATF_REQUIRE(event != NULL);
+	isc_task_send(task3, &event);
+
+	isc_task_detach(&task1);
+	isc_task_detach(&task2);
+	isc_task_detach(&task3);
+	isc_taskmgr_destroy(&manager);
+
+	ATF_CHECK(unblocked);
+
+	isc_test_end();
+#else
+	UNUSED(tc);
+#endif
+}
+
+#ifdef ISC_PLATFORM_USETHREADS
+static int worker = -2;
+
+static void
+record_worker(isc_task_t *task, isc_event_t *event) {
+	UNUSED(task);
+
+	LOCK(&set_lock);
+	worker = isc_taskmgr_currentworker();
+	UNLOCK(&set_lock);
+
+	isc_event_free(&event);
+}
+#endif
+
+/* Worker threads know their number, other threads have none */
+ATF_TC(current_worker);
+ATF_TC_HEAD(current_worker, tc) {
+	atf_tc_set_md_var(tc, "descr", "isc_taskmgr_currentworker()");
+}
+ATF_TC_BODY(current_worker, tc) {
+#ifdef ISC_PLATFORM_USETHREADS
+	isc_result_t result;
+	isc_taskmgr_t *manager = NULL;
+	isc_task_t *task = NULL;
+	isc_event_t *event;
+	int i = 0, seen = -2;
+
+	UNUSED(tc);
+
+	result = isc_mutex_init(&set_lock);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+
+	result = isc_test_begin(NULL, ISC_FALSE);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+
+	ATF_CHECK_EQ(isc_taskmgr_currentworker(), -1);
+
+	result = isc_taskmgr_create(mctx, 3, 0, &manager);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+	result = isc_task_create(manager, 0, &task);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+	isc_task_sethome(task, 2);
+
+	event = isc_event_allocate(mctx, task, ISC_TASKEVENT_TEST,
+				   record_worker, NULL, sizeof (isc_event_t));
+	ATF_REQUIRE(event != NULL);
+	isc_task_send(task, &event);
+
+	while (seen == -2 && i++ < 5000) {
+		isc_test_nap(1000);
+		LOCK(&set_lock);
+		seen = worker;
+		UNLOCK(&set_lock);
+	}
+
+	/*
+	 * An idle worker may steal the task from its home, so any
+	 * worker number will do.
+	 */
+	ATF_CHECK(seen >= 0 && seen < 3);
+
+	isc_task_detach(&task);
+	isc_taskmgr_destroy(&manager);
+
+	isc_test_end();
+#else
+	UNUSED(tc);
+#endif
+}
+
 /*
  * Main
  */
@@ -410,6 +587,8 @@ ATF_TP_ADD_TCS(tp) {
 	ATF_TP_ADD_TC(tp, all_events);
 	ATF_TP_ADD_TC(tp, privileged_events);
 	ATF_TP_ADD_TC(tp, privilege_drop);
+	ATF_TP_ADD_TC(tp, steal);
+	ATF_TP_ADD_TC(tp, current_worker);
 
 	return (atf_no_error());
 }
@@ -0,0 +1,526 @@
+/*
+ * Copyright (C) 2014  Internet Systems Consortium, Inc. ("ISC")
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND ISC DISCLAIMS ALL WARRANTIES WITH
+ * REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS.  IN NO EVENT SHALL ISC BE LIABLE FOR ANY SPECIAL, DIRECT,
+ * INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+ * LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE
+ * OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/* $Id$ */
+
+/*! \file */
+
+#include <config.h>
+
+#include <atf-c.h>
+
+#include <unistd.h>
+
+#include <isc/task.h>
+#include <isc/time.h>
+#include <isc/timer.h>
+#include <isc/util.h>
+
+#include "isctest.h"
+#include "../timer_p.h"
+
+/*
+ * Helper functions
+ */
+
+#ifdef ISC_PLATFORM_USETHREADS
+/*
+ * A timer must never fire before its due time, but on a loaded machine
+ * it may fire late; only gross lateness, such as a timer which was never
+ * cascaded down from a higher wheel level, is an error.
+ */
+#define MAXLATE_US	2000000
+
+typedef struct {
+	isc_timer_t *		timer;
+	isc_time_t		start;		/* set before scheduling */
+	unsigned int		ms;		/* interval or lifetime */
+	isc_eventtype_t		type;		/* event expected */
+	unsigned int		fired;		/* events of 'type' */
+	unsigned int		others;		/* events of other types */
+	isc_boolean_t		early;
+	isc_uint64_t		late;		/* worst lateness, in us */
+} record_t;
+
+static isc_mutex_t lock;
+
+static void
+record_init(record_t *rec, unsigned int ms, isc_eventtype_t type) {
+	memset(rec, 0, sizeof(*rec));
+	rec->ms = ms;
+	rec->type = type;
+	ATF_REQUIRE_EQ(isc_time_now(&rec->start), ISC_R_SUCCESS);
+}
+
+/*
+ * The earliest time at which event number 'n' of 'rec' may arrive.
+ */
+static void
+earliest(record_t *rec, unsigned int n, isc_time_t *t) {
+	isc_interval_t interval;
+	isc_uint64_t ms = (isc_uint64_t)rec->ms * n;
+
+	isc_interval_set(&interval, (unsigned int)(ms / 1000),
+			 (unsigned int)(ms % 1000) * 1000000);
+	ATF_REQUIRE_EQ(isc_time_add(&rec->start, &interval, t),
+		       ISC_R_SUCCESS);
+}
+
+static void
+fire(isc_task_t *task, isc_event_t *event) {
+	record_t *rec = event->ev_arg;
+	isc_timerevent_t *tev = (isc_timerevent_t *)event;
+	isc_time_t now, first;
+	isc_uint64_t late;
+
+	UNUSED(task);
+
+	(void)isc_time_now(&now);
+	LOCK(&lock);
+	if (event->ev_type != rec->type) {
+		rec->others++;
+	} else {
+		rec->fired++;
+		earliest(rec, rec->fired, &first);
+		if (isc_time_compare(&now, &first) < 0 ||
+		    isc_time_compare(&tev->due, &first) < 0)
+			rec->early = ISC_TRUE;
+		late = isc_time_microdiff(&now, &first);
+		if (late > rec->late)
+			rec->late = late;
+	}
+	UNLOCK(&lock);
+	isc_event_free(&event);
+}
+
+static unsigned int
+fired(record_t *rec) {
+	unsigned int n;
+
+	LOCK(&lock);
+	n = rec->fired;
+	UNLOCK(&lock);
+	return (n);
+}
+
+/*
+ * Wait up to 'ms' milliseconds for 'rec' to have fired 'n' times.
+ */
+static isc_boolean_t
+waitfor(record_t *rec, unsigned int n, unsigned int ms) {
+	unsigned int i;
+
+	for (i = 0; i < ms; i++) {
+		if (fired(rec) >= n)
+			return (ISC_TRUE);
+		isc_test_nap(1000);
+	}
+	return (ISC_TF(fired(rec) >= n));
+}
+
+static void
+lifetime(unsigned int ms, isc_time_t *expires) {
+	isc_interval_t interval;
+	isc_time_t now;
+
+	isc_interval_set(&interval, ms / 1000, (ms % 1000) * 1000000);
+	ATF_REQUIRE_EQ(isc_time_now(&now), ISC_R_SUCCESS);
+	ATF_REQUIRE_EQ(isc_time_add(&now, &interval, expires), ISC_R_SUCCESS);
+}
+
+static void
+setup(isc_task_t **taskp) {
+	isc_result_t result;
+
+	result = isc_test_begin(NULL, ISC_TRUE);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+	result = isc_mutex_init(&lock);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+	result = isc_task_create(taskmgr, 0, taskp);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+}
+
+static void
+teardown(isc_task_t **taskp) {
+	isc_task_detach(taskp);
+	DESTROYLOCK(&lock);
+	isc_test_end();
+}
+#endif /* ISC_PLATFORM_USETHREADS */
+
+/*
+ * Individual unit tests
+ */
+
+/* A ticker fires at every interval, never ahead of time */
+ATF_TC(ticker);
+ATF_TC_HEAD(ticker, tc) {
+	atf_tc_set_md_var(tc, "descr", "ticker timers");
+}
+ATF_TC_BODY(ticker, tc) {
+#ifdef ISC_PLATFORM_USETHREADS
+	isc_task_t *task = NULL;
+	isc_interval_t interval;
+	record_t rec;
+	isc_result_t result;
+
+	UNUSED(tc);
+
+	setup(&task);
+
+	record_init(&rec, 40, ISC_TIMEREVENT_TICK);
+	isc_interval_set(&interval, 0, rec.ms * 1000000);
+	result = isc_timer_create(timermgr, isc_timertype_ticker, NULL,
+				  &interval, task, fire, &rec, &rec.timer);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+
+	ATF_CHECK(waitfor(&rec, 5, 5000));
+	isc_timer_detach(&rec.timer);
+
+	LOCK(&lock);
+	ATF_CHECK(!rec.early);
+	ATF_CHECK_EQ(rec.others, 0);
+	UNLOCK(&lock);
+
+	teardown(&task);
+#else
+	UNUSED(tc);
+	atf_tc_skip("timers need threads");
+#endif
+}
+
+/* A once timer fires exactly once, at its expiry or after being idle */
+ATF_TC(once);
+ATF_TC_HEAD(once, tc) {
+	atf_tc_set_md_var(tc, "descr", "once timers");
+}
+ATF_TC_BODY(once, tc) {
+#ifdef ISC_PLATFORM_USETHREADS
+	isc_task_t *task = NULL;
+	isc_interval_t interval;
+	isc_time_t expires;
+	record_t life, idle;
+	isc_result_t result;
+	int i;
+
+	UNUSED(tc);
+
+	setup(&task);
+
+	record_init(&life, 150, ISC_TIMEREVENT_LIFE);
+	lifetime(life.ms, &expires);
+	result = isc_timer_create(timermgr, isc_timertype_once, &expires,
+				  NULL, task, fire, &life, &life.timer);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+
+	/*
+	 * Touching an idle timer pushes its expiry back, so it cannot
+	 * fire until it has been left alone for the whole interval.
+	 */
+	record_init(&idle, 100, ISC_TIMEREVENT_IDLE);
+	isc_interval_set(&interval, 0, idle.ms * 1000000);
+	result = isc_timer_create(timermgr, isc_timertype_once, NULL,
+				  &interval, task, fire, &idle, &idle.timer);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+	for (i = 0; i < 5; i++) {
+		isc_test_nap(50000);
+		LOCK(&lock);
+		ATF_REQUIRE_EQ(isc_time_now(&idle.start), ISC_R_SUCCESS);
+		UNLOCK(&lock);
+		ATF_REQUIRE_EQ(isc_timer_touch(idle.timer), ISC_R_SUCCESS);
+	}
+	ATF_CHECK_EQ(fired(&idle), 0);
+
+	ATF_CHECK(waitfor(&life, 1, 5000));
+	ATF_CHECK(waitfor(&idle, 1, 5000));
+	isc_test_nap(300000);
+
+	LOCK(&lock);
+	ATF_CHECK_EQ(life.fired, 1);
+	ATF_CHECK(!life.early);
+	ATF_CHECK_EQ(life.others, 0);
+	ATF_CHECK_EQ(idle.fired, 1);
+	ATF_CHECK(!idle.early);
+	ATF_CHECK_EQ(idle.others, 0);
+	UNLOCK(&lock);
+
+	isc_timer_detach(&life.timer);
+	isc_timer_detach(&idle.timer);
+	teardown(&task);
+#else
+	UNUSED(tc);
+	atf_tc_skip("timers need threads");
+#endif
+}
+
+/* An inactive timer never fires, until it is reset */
+ATF_TC(inactive);
+ATF_TC_HEAD(inactive, tc) {
+	atf_tc_set_md_var(tc, "descr", "inactive timers");
+}
+ATF_TC_BODY(inactive, tc) {
+#ifdef ISC_PLATFORM_USETHREADS
+	isc_task_t *task = NULL;
+	isc_interval_t interval;
+	record_t rec;
+	isc_result_t result;
+	unsigned int n;
+
+	UNUSED(tc);
+
+	setup(&task);
+
+	record_init(&rec, 20, ISC_TIMEREVENT_TICK);
+	isc_interval_set(&interval, 0, rec.ms * 1000000);
+	result = isc_timer_create(timermgr, isc_timertype_inactive, NULL,
+				  &interval, task, fire, &rec, &rec.timer);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+	isc_test_nap(200000);
+	ATF_CHECK_EQ(fired(&rec), 0);
+
+	LOCK(&lock);
+	ATF_REQUIRE_EQ(isc_time_now(&rec.start), ISC_R_SUCCESS);
+	UNLOCK(&lock);
+	result = isc_timer_reset(rec.timer, isc_timertype_ticker, NULL,
+				 &interval, ISC_TRUE);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+	ATF_CHECK(waitfor(&rec, 2, 5000));
+
+	/*
+	 * Once made inactive again, and with its pending events purged,
+	 * it falls silent.  A tick already being delivered may still
+	 * arrive, so only count from a little after the reset.
+	 */
+	result = isc_timer_reset(rec.timer, isc_timertype_inactive, NULL,
+				 NULL, ISC_TRUE);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+	isc_test_nap(50000);
+	n = fired(&rec);
+	isc_test_nap(200000);
+	ATF_CHECK_EQ(fired(&rec), n);
+
+	LOCK(&lock);
+	ATF_CHECK(!rec.early);
+	ATF_CHECK_EQ(rec.others, 0);
+	UNLOCK(&lock);
+
+	isc_timer_detach(&rec.timer);
+	teardown(&task);
+#else
+	UNUSED(tc);
+	atf_tc_skip("timers need threads");
+#endif
+}
+
+/* Resetting a running ticker to a once timer stops the ticks */
+ATF_TC(reset);
+ATF_TC_HEAD(reset, tc) {
+	atf_tc_set_md_var(tc, "descr", "reset running timers");
+}
+ATF_TC_BODY(reset, tc) {
+#ifdef ISC_PLATFORM_USETHREADS
+	isc_task_t *task = NULL;
+	isc_interval_t interval;
+	isc_time_t expires;
+	record_t rec;
+	isc_result_t result;
+	unsigned int ticks;
+
+	UNUSED(tc);
+
+	setup(&task);
+
+	record_init(&rec, 20, ISC_TIMEREVENT_TICK);
+	isc_interval_set(&interval, 0, rec.ms * 1000000);
+	result = isc_timer_create(timermgr, isc_timertype_ticker, NULL,
+				  &interval, task, fire, &rec, &rec.timer);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+	ATF_CHECK(waitfor(&rec, 3, 5000));
+
+	/*
+	 * From here on only the life event counts: it must not come
+	 * before the new expiry, which is well past the old next tick.
+	 */
+	LOCK(&lock);
+	ticks = rec.fired;
+	rec.fired = 0;
+	rec.ms = 300;
+	rec.type = ISC_TIMEREVENT_LIFE;
+	ATF_REQUIRE_EQ(isc_time_now(&rec.start), ISC_R_SUCCESS);
+	lifetime(rec.ms, &expires);
+	result = isc_timer_reset(rec.timer, isc_timertype_once, &expires,
+				 NULL, ISC_TRUE);
+	UNLOCK(&lock);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+
+	ATF_CHECK(waitfor(&rec, 1, 5000));
+	isc_test_nap(200000);
+
+	LOCK(&lock);
+	ATF_CHECK(ticks >= 3);
+	ATF_CHECK_EQ(rec.fired, 1);
+	ATF_CHECK(!rec.early);
+	/* At most one tick was already on its way. */
+	ATF_CHECK(rec.others <= 1);
+	UNLOCK(&lock);
+
+	isc_timer_detach(&rec.timer);
+	teardown(&task);
+#else
+	UNUSED(tc);
+	atf_tc_skip("timers need threads");
+#endif
+}
+
+/*
+ * Timers due beyond the first wheel level (64 ms) and beyond the second
+ * (4096 ms) are cascaded down before they fire; all must fire once, in
+ * time and not before.
+ */
+ATF_TC(cascade);
+ATF_TC_HEAD(cascade, tc) {
+	atf_tc_set_md_var(tc, "descr", "cascade from higher wheel levels");
+}
+ATF_TC_BODY(cascade, tc) {
+#ifdef ISC_PLATFORM_USETHREADS
+	static const unsigned int ms[] = {
+		1, 2, 63, 64, 65, 127, 128, 129, 700,
+		4095, 4096, 4097, 4300
+	};
+	record_t recs[sizeof(ms) / sizeof(ms[0])];
+	isc_task_t *task = NULL;
+	isc_time_t expires;
+	isc_result_t result;
+	unsigned int i;
+
+	UNUSED(tc);
+
+	setup(&task);
+
+	for (i = 0; i < sizeof(ms) / sizeof(ms[0]); i++) {
+		record_init(&recs[i], ms[i], ISC_TIMEREVENT_LIFE);
+		lifetime(ms[i], &expires);
+		result = isc_timer_create(timermgr, isc_timertype_once,
+					  &expires, NULL, task, fire,
+					  &recs[i], &recs[i].timer);
+		ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+	}
+
+	for (i = 0; i < sizeof(ms) / sizeof(ms[0]); i++)
+		ATF_CHECK_MSG(waitfor(&recs[i], 1, 10000),
+			      "%u ms timer did not fire", ms[i]);
+	isc_test_nap(200000);
+
+	LOCK(&lock);
+	for (i = 0; i < sizeof(ms) / sizeof(ms[0]); i++) {
+		ATF_CHECK_EQ_MSG(recs[i].fired, 1, "%u ms timer fired %u "
+				 "times", ms[i], recs[i].fired);
+		ATF_CHECK_MSG(!recs[i].early, "%u ms timer fired early",
+			      ms[i]);
+		ATF_CHECK_MSG(recs[i].late < MAXLATE_US,
+			      "%u ms timer fired %u us late", ms[i],
+			      (unsigned int)recs[i].late);
+		ATF_CHECK_EQ(recs[i].others, 0);
+	}
+	UNLOCK(&lock);
+
+	for (i = 0; i < sizeof(ms) / sizeof(ms[0]); i++)
+		isc_timer_detach(&recs[i].timer);
+	teardown(&task);
+#else
+	UNUSED(tc);
+	atf_tc_skip("timers need threads");
+#endif
+}
+
+/*
+ * When the clock is stepped back the wheels are left ahead of it.  Timers
+ * scheduled afterwards must fire in time, not once the clock has caught
+ * up with the wheels again.
+ */
+ATF_TC(clock_back);
+ATF_TC_HEAD(clock_back, tc) {
+	atf_tc_set_md_var(tc, "descr", "timers after a backward clock step");
+}
+ATF_TC_BODY(clock_back, tc) {
+#ifdef ISC_PLATFORM_USETHREADS
+	record_t once, ticker;
+	isc_task_t *task = NULL;
+	isc_interval_t interval;
+	isc_time_t now, ahead, expires;
+	isc_result_t result;
+
+	UNUSED(tc);
+
+	setup(&task);
+
+	/*
+	 * Running the timers a minute from now turns the wheels to where
+	 * they would be had the clock just gone back by a minute.
+	 */
+	ATF_REQUIRE_EQ(isc_time_now(&now), ISC_R_SUCCESS);
+	isc_interval_set(&interval, 60, 0);
+	ATF_REQUIRE_EQ(isc_time_add(&now, &interval, &ahead), ISC_R_SUCCESS);
+	isc__timermgr_dispatchat(timermgr, &ahead);
+
+	record_init(&once, 100, ISC_TIMEREVENT_LIFE);
+	lifetime(100, &expires);
+	result = isc_timer_create(timermgr, isc_timertype_once, &expires,
+				  NULL, task, fire, &once, &once.timer);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+
+	record_init(&ticker, 50, ISC_TIMEREVENT_TICK);
+	isc_interval_set(&interval, 0, 50000000);
+	result = isc_timer_create(timermgr, isc_timertype_ticker, NULL,
+				  &interval, task, fire, &ticker,
+				  &ticker.timer);
+	ATF_REQUIRE_EQ(result, ISC_R_SUCCESS);
+
+	ATF_CHECK_MSG(waitfor(&once, 1, 10000), "once timer did not fire");
+	ATF_CHECK_MSG(waitfor(&ticker, 3, 10000), "ticker did not fire");
+
+	isc_timer_detach(&ticker.timer);
+	isc_timer_detach(&once.timer);
+
+	LOCK(&lock);
+	ATF_CHECK(!once.early);
+	ATF_CHECK(once.late < MAXLATE_US);
+	ATF_CHECK_EQ(once.others, 0);
+	ATF_CHECK(!ticker.early);
+	ATF_CHECK(ticker.late < MAXLATE_US);
+	ATF_CHECK_EQ(ticker.others, 0);
+	UNLOCK(&lock);
+
+	teardown(&task);
+#else
+	UNUSED(tc);
+	atf_tc_skip("timers need threads");
+#endif
+}
+
+/*
+ * Main
+ */
+ATF_TP_ADD_TCS(tp) {
+	ATF_TP_ADD_TC(tp, ticker);
+	ATF_TP_ADD_TC(tp, once);
+	ATF_TP_ADD_TC(tp, inactive);
+	ATF_TP_ADD_TC(tp, reset);
+	ATF_TP_ADD_TC(tp, cascade);
+	ATF_TP_ADD_TC(tp, clock_back);
+
+	return (atf_no_error());
+}
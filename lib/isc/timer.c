@@ -23,7 +23,6 @@
 
 #include <isc/app.h>
 #include <isc/condition.h>
-#include <isc/heap.h>
 #include <isc/log.h>
 #include <isc/magic.h>
 #include <isc/mem.h>
@@ -68,32 +67,84 @@
 #define XTRACETIMER(s, t, d)
 #endif /* ISC_TIMER_TRACE */
 
+/*
+ * Scheduled timers are kept in hierarchical timing wheels.  Time is
+ * counted in ticks of one millisecond.  Level 0 has one slot per tick;
+ * each slot of level N covers a whole turn of level N - 1.  A timer is
+ * put in the lowest level whose turn reaches its due tick, so scheduling
+ * and cancelling are a list append and unlink.  When the wheel reaches
+ * the start of a higher level slot, the timers in it are redistributed
+ * ("cascaded") to the lower levels.  A timer due more than a full turn of
+ * the top level ahead (about two years) is parked in the top level and
+ * cascaded again until it comes within reach.
+ *
+ * The manager has several wheels ("shards"), each with its own lock.  A
+ * timer always lives in the shard picked by the task it posts to, so
+ * timers of unrelated tasks do not contend for one lock.  The timer
+ * thread visits every shard when it wakes up.
+ */
+#define WHEEL_BITS			6
+#define WHEEL_SLOTS			(1U << WHEEL_BITS)
+#define WHEEL_MASK			(WHEEL_SLOTS - 1)
+#define WHEEL_LEVELS			6
+#define WHEEL_SPAN			((isc_uint64_t)1 << \
+					 (WHEEL_BITS * WHEEL_LEVELS))
+#define WHEEL_NEVER			ISC_UINT64_MAX
+
+#define TICKS_PER_SECOND		1000U
+#define NS_PER_TICK			(1000000000U / TICKS_PER_SECOND)
+
+#ifdef USE_TIMER_THREAD
+#define TIMER_SHARDS			16
+#else
+#define TIMER_SHARDS			1
+#endif /* USE_TIMER_THREAD */
+
 #define TIMER_MAGIC			ISC_MAGIC('T', 'I', 'M', 'R')
 #define VALID_TIMER(t)			ISC_MAGIC_VALID(t, TIMER_MAGIC)
 
 typedef struct isc__timer isc__timer_t;
+typedef struct isc__timershard isc__timershard_t;
 typedef struct isc__timermgr isc__timermgr_t;
 
+typedef ISC_LIST(isc__timer_t) timerlist_t;
+
 struct isc__timer {
 	/*! Not locked. */
 	isc_timer_t			common;
 	isc__timermgr_t *		manager;
+	isc__timershard_t *		shard;
 	isc_mutex_t			lock;
 	/*! Locked by timer lock. */
 	unsigned int			references;
 	isc_time_t			idle;
-	/*! Locked by manager lock. */
+	/*! Locked by shard lock. */
 	isc_timertype_t			type;
 	isc_time_t			expires;
 	isc_interval_t			interval;
 	isc_task_t *			task;
 	isc_taskaction_t		action;
 	void *				arg;
-	unsigned int			index;
 	isc_time_t			due;
+	isc_uint64_t			tick;
+	unsigned int			level;
+	unsigned int			slot;
+	LINK(isc__timer_t)		wheellink;
 	LINK(isc__timer_t)		link;
 };
 
+struct isc__timershard {
+	isc_mutex_t			lock;
+	/* Locked by shard lock. */
+	timerlist_t			timers;
+	unsigned int			nscheduled;
+	isc_uint64_t			current;	/* next tick to run */
+	isc_uint64_t			wakeup;		/* next visit by the
+							   timer thread */
+	isc_uint64_t			occupied[WHEEL_LEVELS];
+	timerlist_t			wheel[WHEEL_LEVELS][WHEEL_SLOTS];
+};
+
 #define TIMER_MANAGER_MAGIC		ISC_MAGIC('T', 'I', 'M', 'M')
 #define VALID_MANAGER(m)		ISC_MAGIC_VALID(m, TIMER_MANAGER_MAGIC)
 
@@ -104,9 +155,7 @@ struct isc__timermgr {
 	isc_mutex_t			lock;
 	/* Locked by manager lock. */
 	isc_boolean_t			done;
-	LIST(isc__timer_t)		timers;
-	unsigned int			nscheduled;
-	isc_time_t			due;
+	isc_uint64_t			due;
 #ifdef USE_TIMER_THREAD
 	isc_condition_t			wakeup;
 	isc_thread_t			thread;
@@ -114,7 +163,8 @@ struct isc__timermgr {
 #ifdef USE_SHARED_MANAGER
 	unsigned int			refs;
 #endif /* USE_SHARED_MANAGER */
-	isc_heap_t *			heap;
+	/* Locked by the shard locks. */
+	isc__timershard_t		shards[TIMER_SHARDS];
 };
 
 /*%
@@ -182,15 +232,200 @@ static struct isc__timermgrmethods {
 static isc__timermgr_t *timermgr = NULL;
 #endif /* USE_SHARED_MANAGER */
 
+static inline isc_uint64_t
+time2tick(const isc_time_t *t, isc_boolean_t roundup) {
+	unsigned int ns = isc_time_nanoseconds(t);
+	isc_uint64_t tick;
+
+	tick = (isc_uint64_t)isc_time_seconds(t) * TICKS_PER_SECOND +
+	       ns / NS_PER_TICK;
+	if (roundup && ns % NS_PER_TICK != 0)
+		tick++;
+	return (tick);
+}
+
+static inline void
+tick2time(isc_uint64_t tick, isc_time_t *t) {
+	isc_time_set(t, (unsigned int)(tick / TICKS_PER_SECOND),
+		     (unsigned int)(tick % TICKS_PER_SECOND) * NS_PER_TICK);
+}
+
+static inline isc__timershard_t *
+pickshard(isc__timermgr_t *manager, isc_task_t *task) {
+	isc_uint32_t h;
+
+	/*
+	 * Task objects are allocated with the same size, so the low bits
+	 * of their addresses repeat; mix them before taking the modulus.
+	 */
+	h = (isc_uint32_t)((size_t)task >> 3) * 2654435761U;
+	return (&manager->shards[(h >> 16) % TIMER_SHARDS]);
+}
+
+/*%
+ * Return the distance from 'first' to the next bit set in 'bits',
+ * wrapping around.  'bits' must not be zero.
+ */
+static inline unsigned int
+nextslot(isc_uint64_t bits, unsigned int first) {
+	unsigned int n = 0;
+
+	if (first != 0)
+		bits = (bits >> first) | (bits << (WHEEL_SLOTS - first));
+	if ((bits & 0xffffffffU) == 0) {
+		bits >>= 32;
+		n += 32;
+	}
+	if ((bits & 0xffffU) == 0) {
+		bits >>= 16;
+		n += 16;
+	}
+	if ((bits & 0xffU) == 0) {
+		bits >>= 8;
+		n += 8;
+	}
+	if ((bits & 0xfU) == 0) {
+		bits >>= 4;
+		n += 4;
+	}
+	if ((bits & 0x3U) == 0) {
+		bits >>= 2;
+		n += 2;
+	}
+	if ((bits & 0x1U) == 0)
+		n += 1;
+	return (n);
+}
+
+/*%
+ * Compute the level and slot 'tick' belongs in as the wheel stands now.
+ */
+static inline void
+wheel_place(isc__timershard_t *shard, isc_uint64_t tick,
+	    unsigned int *levelp, unsigned int *slotp)
+{
+	isc_uint64_t delta;
+	unsigned int level;
+
+	/*
+	 * Timers already due go in the slot run next; timers beyond the
+	 * top level are parked at its far end.
+	 */
+	if (tick < shard->current)
+		tick = shard->current;
+	delta = tick - shard->current;
+	if (delta >= WHEEL_SPAN) {
+		delta = WHEEL_SPAN - 1;
+		tick = shard->current + delta;
+	}
+
+	for (level = 0; level < WHEEL_LEVELS - 1; level++)
+		if ((delta >> (WHEEL_BITS * (level + 1))) == 0)
+			break;
+
+	*levelp = level;
+	*slotp = (unsigned int)(tick >> (WHEEL_BITS * level)) & WHEEL_MASK;
+}
+
+static inline void
+wheel_insert(isc__timershard_t *shard, isc__timer_t *timer) {
+	wheel_place(shard, timer->tick, &timer->level, &timer->slot);
+	APPEND(shard->wheel[timer->level][timer->slot], timer, wheellink);
+	shard->occupied[timer->level] |= (isc_uint64_t)1 << timer->slot;
+	shard->nscheduled++;
+}
+
+static inline void
+wheel_remove(isc__timershard_t *shard, isc__timer_t *timer) {
+	timerlist_t *bucket = &shard->wheel[timer->level][timer->slot];
+
+	UNLINK(*bucket, timer, wheellink);
+	if (EMPTY(*bucket))
+		shard->occupied[timer->level] &=
+			~((isc_uint64_t)1 << timer->slot);
+	INSIST(shard->nscheduled > 0);
+	shard->nscheduled--;
+}
+
+/*%
+ * Return the first tick, not before shard->current, at which a level 0
+ * slot is due or a higher level slot has to be cascaded.
+ */
+static isc_uint64_t
+wheel_next(isc__timershard_t *shard) {
+	isc_uint64_t next = WHEEL_NEVER, span, start;
+	unsigned int level, first;
+
+	for (level = 0; level < WHEEL_LEVELS; level++) {
+		if (shard->occupied[level] == 0)
+			continue;
+		/*
+		 * A slot of this level is cascaded when the wheel reaches
+		 * a tick aligned to the slot span whose digit at this
+		 * level is the slot number.
+		 */
+		span = (isc_uint64_t)1 << (WHEEL_BITS * level);
+		start = (shard->current + span - 1) & ~(span - 1);
+		first = (unsigned int)(start >> (WHEEL_BITS * level)) &
+			WHEEL_MASK;
+		start += nextslot(shard->occupied[level], first) * span;
+		if (start < next)
+			next = start;
+	}
+
+	return (next);
+}
+
+static void
+wheel_cascade(isc__timershard_t *shard, unsigned int level,
+	      unsigned int slot)
+{
+	timerlist_t list;
+	isc__timer_t *timer;
+
+	list = shard->wheel[level][slot];
+	INIT_LIST(shard->wheel[level][slot]);
+	shard->occupied[level] &= ~((isc_uint64_t)1 << slot);
+
+	while ((timer = HEAD(list)) != NULL) {
+		UNLINK(list, timer, wheellink);
+		shard->nscheduled--;
+		wheel_insert(shard, timer);
+	}
+}
+
+/*%
+ * The wheel only turns forward.  If the clock was stepped back, timers
+ * scheduled since then were clamped to shard->current and would fire
+ * late by the size of the step.  Start the wheel over at 'nowtick' and
+ * put every scheduled timer back in by its own due tick.
+ */
+static void
+wheel_rebase(isc__timershard_t *shard, isc_uint64_t nowtick) {
+	timerlist_t list;
+	isc__timer_t *timer;
+	unsigned int level, slot;
+
+	INIT_LIST(list);
+	for (level = 0; level < WHEEL_LEVELS; level++) {
+		for (slot = 0; slot < WHEEL_SLOTS; slot++)
+			APPENDLIST(list, shard->wheel[level][slot], wheellink);
+		shard->occupied[level] = 0;
+	}
+	shard->nscheduled = 0;
+	shard->current = nowtick;
+
+	while ((timer = HEAD(list)) != NULL) {
+		UNLINK(list, timer, wheellink);
+		wheel_insert(shard, timer);
+	}
+}
+
 static inline isc_result_t
-schedule(isc__timer_t *timer, isc_time_t *now, isc_boolean_t signal_ok) {
+schedule(isc__timer_t *timer, isc_time_t *now, isc_boolean_t *wakeupp) {
 	isc_result_t result;
-	isc__timermgr_t *manager;
+	isc__timershard_t *shard;
 	isc_time_t due;
-	int cmp;
-#ifdef USE_TIMER_THREAD
-	isc_boolean_t timedwait;
-#endif
 
 	/*!
 	 * Note: the caller must ensure locking.
@@ -198,20 +433,7 @@ schedule(isc__timer_t *timer, isc_time_t *now, isc_boolean_t signal_ok) {
 
 	REQUIRE(timer->type != isc_timertype_inactive);
 
-#ifndef USE_TIMER_THREAD
-	UNUSED(signal_ok);
-#endif /* USE_TIMER_THREAD */
-
-	manager = timer->manager;
-
-#ifdef USE_TIMER_THREAD
-	/*!
-	 * If the manager was timed wait, we may need to signal the
-	 * manager to force a wakeup.
-	 */
-	timedwait = ISC_TF(manager->nscheduled > 0 &&
-			   isc_time_seconds(&manager->due) != 0);
-#endif
+	shard = timer->shard;
 
 	/*
 	 * Compute the new due time.
@@ -235,128 +457,86 @@ schedule(isc__timer_t *timer, isc_time_t *now, isc_boolean_t signal_ok) {
 	}
 
 	/*
-	 * Schedule the timer.
+	 * Schedule the timer.  A timer never fires before its due time;
+	 * rounding up to the next tick delays it by less than a tick.
 	 */
+	timer->due = due;
+	timer->tick = time2tick(&due, ISC_TRUE);
+	if (ISC_LINK_LINKED(timer, wheellink)) {
+		unsigned int level, slot;
 
-	if (timer->index > 0) {
 		/*
-		 * Already scheduled.
+		 * Timers are mostly pushed back by about the same interval
+		 * again and again, which often leaves them in the slot they
+		 * are in; they need not move then.
 		 */
-		cmp = isc_time_compare(&due, &timer->due);
-		timer->due = due;
-		switch (cmp) {
-		case -1:
-			isc_heap_increased(manager->heap, timer->index);
-			break;
-		case 1:
-			isc_heap_decreased(manager->heap, timer->index);
-			break;
-		case 0:
-			/* Nothing to do. */
-			break;
+		wheel_place(shard, timer->tick, &level, &slot);
+		if (level != timer->level || slot != timer->slot) {
+			wheel_remove(shard, timer);
+			wheel_insert(shard, timer);
 		}
-	} else {
-		timer->due = due;
-		result = isc_heap_insert(manager->heap, timer);
-		if (result != ISC_R_SUCCESS) {
-			INSIST(result == ISC_R_NOMEMORY);
-			return (ISC_R_NOMEMORY);
-		}
-		manager->nscheduled++;
-	}
+	} else
+		wheel_insert(shard, timer);
 
 	XTRACETIMER(isc_msgcat_get(isc_msgcat, ISC_MSGSET_TIMER,
 				   ISC_MSG_SCHEDULE, "schedule"), timer, due);
 
 	/*
-	 * If this timer is at the head of the queue, we need to ensure
-	 * that we won't miss it if it has a more recent due time than
-	 * the current "next" timer.  We do this either by waking up the
-	 * run thread, or explicitly setting the value in the manager.
+	 * If this timer is due before the timer thread will next look at
+	 * this shard, the caller must wake it up once it has dropped the
+	 * shard lock.
 	 */
-#ifdef USE_TIMER_THREAD
-
-	/*
-	 * This is a temporary (probably) hack to fix a bug on tru64 5.1
-	 * and 5.1a.  Sometimes, pthread_cond_timedwait() doesn't actually
-	 * return when the time expires, so here, we check to see if
-	 * we're 15 seconds or more behind, and if we are, we signal
-	 * the dispatcher.  This isn't such a bad idea as a general purpose
-	 * watchdog, so perhaps we should just leave it in here.
-	 */
-	if (signal_ok && timedwait) {
-		isc_interval_t fifteen;
-		isc_time_t then;
-
-		isc_interval_set(&fifteen, 15, 0);
-		result = isc_time_add(&manager->due, &fifteen, &then);
-
-		if (result == ISC_R_SUCCESS &&
-		    isc_time_compare(&then, now) < 0) {
-			SIGNAL(&manager->wakeup);
-			signal_ok = ISC_FALSE;
-			isc_log_write(isc_lctx, ISC_LOGCATEGORY_GENERAL,
-				      ISC_LOGMODULE_TIMER, ISC_LOG_WARNING,
-				      "*** POKED TIMER ***");
-		}
+	if (timer->tick < shard->wakeup) {
+		shard->wakeup = timer->tick;
+		if (wakeupp != NULL)
+			*wakeupp = ISC_TRUE;
 	}
 
-	if (timer->index == 1 && signal_ok) {
-		XTRACE(isc_msgcat_get(isc_msgcat, ISC_MSGSET_TIMER,
-				      ISC_MSG_SIGNALSCHED,
-				      "signal (schedule)"));
-		SIGNAL(&manager->wakeup);
-	}
-#else /* USE_TIMER_THREAD */
-	if (timer->index == 1 &&
-	    isc_time_compare(&timer->due, &manager->due) < 0)
-		manager->due = timer->due;
-#endif /* USE_TIMER_THREAD */
-
 	return (ISC_R_SUCCESS);
 }
 
 static inline void
 deschedule(isc__timer_t *timer) {
-#ifdef USE_TIMER_THREAD
-	isc_boolean_t need_wakeup = ISC_FALSE;
-#endif
-	isc__timermgr_t *manager;
-
 	/*
 	 * The caller must ensure locking.
+	 *
+	 * The timer thread is not woken up: if this timer was the next one
+	 * due, it just finds nothing to do in this shard.
 	 */
 
-	manager = timer->manager;
-	if (timer->index > 0) {
-#ifdef USE_TIMER_THREAD
-		if (timer->index == 1)
-			need_wakeup = ISC_TRUE;
-#endif
-		isc_heap_delete(manager->heap, timer->index);
-		timer->index = 0;
-		INSIST(manager->nscheduled > 0);
-		manager->nscheduled--;
+	if (ISC_LINK_LINKED(timer, wheellink))
+		wheel_remove(timer->shard, timer);
+}
+
+static void
+wakeup(isc__timermgr_t *manager, isc_uint64_t tick) {
+	/*
+	 * The caller must not hold any shard lock.
+	 */
+
+	LOCK(&manager->lock);
 #ifdef USE_TIMER_THREAD
-		if (need_wakeup) {
-			XTRACE(isc_msgcat_get(isc_msgcat, ISC_MSGSET_TIMER,
-					      ISC_MSG_SIGNALDESCHED,
-					      "signal (deschedule)"));
-			SIGNAL(&manager->wakeup);
-		}
+	UNUSED(tick);
+	XTRACE(isc_msgcat_get(isc_msgcat, ISC_MSGSET_TIMER,
+			      ISC_MSG_SIGNALSCHED, "signal (schedule)"));
+	SIGNAL(&manager->wakeup);
+#else /* USE_TIMER_THREAD */
+	if (tick < manager->due)
+		manager->due = tick;
 #endif /* USE_TIMER_THREAD */
-	}
+	UNLOCK(&manager->lock);
 }
 
 static void
 destroy(isc__timer_t *timer) {
 	isc__timermgr_t *manager = timer->manager;
+	isc__timershard_t *shard = timer->shard;
 
 	/*
 	 * The caller must ensure it is safe to destroy the timer.
 	 */
 
-	LOCK(&manager->lock);
+	LOCK(&shard->lock);
 
 	(void)isc_task_purgerange(timer->task,
 				  timer,
@@ -364,9 +544,9 @@ destroy(isc__timer_t *timer) {
 				  ISC_TIMEREVENT_LASTEVENT,
 				  NULL);
 	deschedule(timer);
-	UNLINK(manager->timers, timer, link);
+	UNLINK(shard->timers, timer, link);
 
-	UNLOCK(&manager->lock);
+	UNLOCK(&shard->lock);
 
 	isc_task_detach(&timer->task);
 	DESTROYLOCK(&timer->lock);
@@ -383,8 +563,10 @@ isc__timer_create(isc_timermgr_t *manager0, isc_timertype_t type,
 {
 	isc__timermgr_t *manager = (isc__timermgr_t *)manager0;
 	isc__timer_t *timer;
+	isc__timershard_t *shard;
 	isc_result_t result;
 	isc_time_t now;
+	isc_boolean_t need_wakeup = ISC_FALSE;
 
 	/*
 	 * Create a new 'type' timer managed by 'manager'.  The timers
@@ -427,6 +609,7 @@ isc__timer_create(isc_timermgr_t *manager0, isc_timertype_t type,
 		return (ISC_R_NOMEMORY);
 
 	timer->manager = manager;
+	timer->shard = shard = pickshard(manager, task);
 	timer->references = 1;
 
 	if (type == isc_timertype_once && !isc_interval_iszero(interval)) {
@@ -455,19 +638,22 @@ isc__timer_create(isc_timermgr_t *manager0, isc_timertype_t type,
 	 * keep track of whether arg started as a true const.
 	 */
 	DE_CONST(arg, timer->arg);
-	timer->index = 0;
+	timer->tick = 0;
+	timer->level = 0;
+	timer->slot = 0;
 	result = isc_mutex_init(&timer->lock);
 	if (result != ISC_R_SUCCESS) {
 		isc_task_detach(&timer->task);
 		isc_mem_put(manager->mctx, timer, sizeof(*timer));
 		return (result);
 	}
+	ISC_LINK_INIT(timer, wheellink);
 	ISC_LINK_INIT(timer, link);
 	timer->common.impmagic = TIMER_MAGIC;
 	timer->common.magic = ISCAPI_TIMER_MAGIC;
 	timer->common.methods = (isc_timermethods_t *)&timermethods;
 
-	LOCK(&manager->lock);
+	LOCK(&shard->lock);
 
 	/*
 	 * Note we don't have to lock the timer like we normally would because
@@ -475,13 +661,13 @@ isc__timer_create(isc_timermgr_t *manager0, isc_timertype_t type,
 	 */
 
 	if (type != isc_timertype_inactive)
-		result = schedule(timer, &now, ISC_TRUE);
+		result = schedule(timer, &now, &need_wakeup);
 	else
 		result = ISC_R_SUCCESS;
 	if (result == ISC_R_SUCCESS)
-		APPEND(manager->timers, timer, link);
+		APPEND(shard->timers, timer, link);
 
-	UNLOCK(&manager->lock);
+	UNLOCK(&shard->lock);
 
 	if (result != ISC_R_SUCCESS) {
 		timer->common.impmagic = 0;
@@ -492,6 +678,9 @@ isc__timer_create(isc_timermgr_t *manager0, isc_timertype_t type,
 		return (result);
 	}
 
+	if (need_wakeup)
+		wakeup(manager, timer->tick);
+
 	*timerp = (isc_timer_t *)timer;
 
 	return (ISC_R_SUCCESS);
@@ -505,7 +694,10 @@ isc__timer_reset(isc_timer_t *timer0, isc_timertype_t type,
 	isc__timer_t *timer = (isc__timer_t *)timer0;
 	isc_time_t now;
 	isc__timermgr_t *manager;
+	isc__timershard_t *shard;
 	isc_result_t result;
+	isc_uint64_t tick = 0;
+	isc_boolean_t need_wakeup = ISC_FALSE;
 
 	/*
 	 * Change the timer's type, expires, and interval values to the given
@@ -516,6 +708,7 @@ isc__timer_reset(isc_timer_t *timer0, isc_timertype_t type,
 	REQUIRE(VALID_TIMER(timer));
 	manager = timer->manager;
 	REQUIRE(VALID_MANAGER(manager));
+	shard = timer->shard;
 
 	if (expires == NULL)
 		expires = isc_time_epoch;
@@ -540,7 +733,7 @@ isc__timer_reset(isc_timer_t *timer0, isc_timertype_t type,
 		isc_time_settoepoch(&now);
 	}
 
-	LOCK(&manager->lock);
+	LOCK(&shard->lock);
 	LOCK(&timer->lock);
 
 	if (purge)
@@ -564,11 +757,15 @@ isc__timer_reset(isc_timer_t *timer0, isc_timertype_t type,
 			deschedule(timer);
 			result = ISC_R_SUCCESS;
 		} else
-			result = schedule(timer, &now, ISC_TRUE);
+			result = schedule(timer, &now, &need_wakeup);
 	}
+	tick = timer->tick;
 
 	UNLOCK(&timer->lock);
-	UNLOCK(&manager->lock);
+	UNLOCK(&shard->lock);
+
+	if (need_wakeup)
+		wakeup(manager, tick);
 
 	return (result);
 }
@@ -606,7 +803,7 @@ isc__timer_touch(isc_timer_t *timer0) {
 	 *
 	 *	REQUIRE(timer->type == isc_timertype_once);
 	 *
-	 * but we cannot without locking the manager lock too, which we
+	 * but we cannot without locking the shard lock too, which we
 	 * don't want to do.
 	 */
 
@@ -663,122 +860,190 @@ isc__timer_detach(isc_timer_t **timerp) {
 }
 
 static void
-dispatch(isc__timermgr_t *manager, isc_time_t *now) {
-	isc_boolean_t done = ISC_FALSE, post_event, need_schedule;
+fire(isc__timermgr_t *manager, isc__timer_t *timer, isc_time_t *now) {
+	isc_boolean_t post_event, need_schedule;
 	isc_timerevent_t *event;
 	isc_eventtype_t type = 0;
-	isc__timer_t *timer;
 	isc_result_t result;
 	isc_boolean_t idle;
 
 	/*!
-	 * The caller must be holding the manager lock.
+	 * The caller must be holding the shard lock, and must have taken
+	 * 'timer' off the wheel.
 	 */
 
-	while (manager->nscheduled > 0 && !done) {
-		timer = isc_heap_element(manager->heap, 1);
-		INSIST(timer != NULL && timer->type != isc_timertype_inactive);
-		if (isc_time_compare(now, &timer->due) >= 0) {
-			if (timer->type == isc_timertype_ticker) {
-				type = ISC_TIMEREVENT_TICK;
-				post_event = ISC_TRUE;
-				need_schedule = ISC_TRUE;
-			} else if (timer->type == isc_timertype_limited) {
-				int cmp;
-				cmp = isc_time_compare(now, &timer->expires);
-				if (cmp >= 0) {
-					type = ISC_TIMEREVENT_LIFE;
-					post_event = ISC_TRUE;
-					need_schedule = ISC_FALSE;
-				} else {
-					type = ISC_TIMEREVENT_TICK;
-					post_event = ISC_TRUE;
-					need_schedule = ISC_TRUE;
-				}
-			} else if (!isc_time_isepoch(&timer->expires) &&
-				   isc_time_compare(now,
-						    &timer->expires) >= 0) {
-				type = ISC_TIMEREVENT_LIFE;
-				post_event = ISC_TRUE;
-				need_schedule = ISC_FALSE;
-			} else {
-				idle = ISC_FALSE;
-
-				LOCK(&timer->lock);
-				if (!isc_time_isepoch(&timer->idle) &&
-				    isc_time_compare(now,
-						     &timer->idle) >= 0) {
-					idle = ISC_TRUE;
-				}
-				UNLOCK(&timer->lock);
-				if (idle) {
-					type = ISC_TIMEREVENT_IDLE;
-					post_event = ISC_TRUE;
-					need_schedule = ISC_FALSE;
-				} else {
-					/*
-					 * Idle timer has been touched;
-					 * reschedule.
-					 */
-					XTRACEID(isc_msgcat_get(isc_msgcat,
-								ISC_MSGSET_TIMER,
-								ISC_MSG_IDLERESCHED,
-								"idle reschedule"),
-						 timer);
-					post_event = ISC_FALSE;
-					need_schedule = ISC_TRUE;
-				}
-			}
-
-			if (post_event) {
-				XTRACEID(isc_msgcat_get(isc_msgcat,
+	INSIST(timer->type != isc_timertype_inactive);
+	INSIST(isc_time_compare(now, &timer->due) >= 0);
+
+	if (timer->type == isc_timertype_ticker) {
+		type = ISC_TIMEREVENT_TICK;
+		post_event = ISC_TRUE;
+		need_schedule = ISC_TRUE;
+	} else if (timer->type == isc_timertype_limited) {
+		int cmp;
+		cmp = isc_time_compare(now, &timer->expires);
+		if (cmp >= 0) {
+			type = ISC_TIMEREVENT_LIFE;
+			post_event = ISC_TRUE;
+			need_schedule = ISC_FALSE;
+		} else {
+			type = ISC_TIMEREVENT_TICK;
+			post_event = ISC_TRUE;
+			need_schedule = ISC_TRUE;
+		}
+	} else if (!isc_time_isepoch(&timer->expires) &&
+		   isc_time_compare(now, &timer->expires) >= 0) {
+		type = ISC_TIMEREVENT_LIFE;
+		post_event = ISC_TRUE;
+		need_schedule = ISC_FALSE;
+	} else {
+		idle = ISC_FALSE;
+
+		LOCK(&timer->lock);
+		if (!isc_time_isepoch(&timer->idle) &&
+		    isc_time_compare(now, &timer->idle) >= 0) {
+			idle = ISC_TRUE;
+		}
+		UNLOCK(&timer->lock);
+		if (idle) {
+			type = ISC_TIMEREVENT_IDLE;
+			post_event = ISC_TRUE;
+			need_schedule = ISC_FALSE;
+		} else {
+			/*
+			 * Idle timer has been touched; reschedule.
+			 */
+			XTRACEID(isc_msgcat_get(isc_msgcat, ISC_MSGSET_TIMER,
+						ISC_MSG_IDLERESCHED,
+						"idle reschedule"),
+				 timer);
+			post_event = ISC_FALSE;
+			need_schedule = ISC_TRUE;
+		}
+	}
+
+	if (post_event) {
+		XTRACEID(isc_msgcat_get(isc_msgcat, ISC_MSGSET_TIMER,
+					ISC_MSG_POSTING, "posting"), timer);
+		/*
+		 * XXX We could preallocate this event.
+		 */
+		event = (isc_timerevent_t *)isc_event_allocate(manager->mctx,
+							       timer,
+							       type,
+							       timer->action,
+							       timer->arg,
+							       sizeof(*event));
+
+		if (event != NULL) {
+			event->due = timer->due;
+			isc_task_send(timer->task, ISC_EVENT_PTR(&event));
+		} else
+			UNEXPECTED_ERROR(__FILE__, __LINE__, "%s",
+					 isc_msgcat_get(isc_msgcat,
 							ISC_MSGSET_TIMER,
-							ISC_MSG_POSTING,
-							"posting"), timer);
-				/*
-				 * XXX We could preallocate this event.
-				 */
-				event = (isc_timerevent_t *)isc_event_allocate(manager->mctx,
-							   timer,
-							   type,
-							   timer->action,
-							   timer->arg,
-							   sizeof(*event));
-
-				if (event != NULL) {
-					event->due = timer->due;
-					isc_task_send(timer->task,
-						      ISC_EVENT_PTR(&event));
-				} else
-					UNEXPECTED_ERROR(__FILE__, __LINE__, "%s",
-						 isc_msgcat_get(isc_msgcat,
-							 ISC_MSGSET_TIMER,
-							 ISC_MSG_EVENTNOTALLOC,
-							 "couldn't "
-							 "allocate event"));
-			}
-
-			timer->index = 0;
-			isc_heap_delete(manager->heap, 1);
-			manager->nscheduled--;
-
-			if (need_schedule) {
-				result = schedule(timer, now, ISC_FALSE);
-				if (result != ISC_R_SUCCESS)
-					UNEXPECTED_ERROR(__FILE__, __LINE__,
-							 "%s: %u",
-						isc_msgcat_get(isc_msgcat,
+							ISC_MSG_EVENTNOTALLOC,
+							"couldn't "
+							"allocate event"));
+	}
+
+	if (need_schedule) {
+		/*
+		 * The thread dispatching this shard recomputes its wakeup
+		 * time afterwards, so there is no one to wake up.
+		 */
+		result = schedule(timer, now, NULL);
+		if (result != ISC_R_SUCCESS)
+			UNEXPECTED_ERROR(__FILE__, __LINE__, "%s: %u",
+					 isc_msgcat_get(isc_msgcat,
 							ISC_MSGSET_TIMER,
 							ISC_MSG_SCHEDFAIL,
 							"couldn't schedule "
 							"timer"),
-							 result);
-			}
-		} else {
-			manager->due = timer->due;
-			done = ISC_TRUE;
+					 result);
+	}
+}
+
+static void
+dispatch_shard(isc__timermgr_t *manager, isc__timershard_t *shard,
+	       isc_time_t *now, isc_uint64_t nowtick)
+{
+	isc_uint64_t next;
+	unsigned int level, slot;
+	timerlist_t list;
+	isc__timer_t *timer;
+
+	/*!
+	 * The caller must be holding the shard lock.
+	 */
+
+	while (shard->nscheduled > 0 &&
+	       (next = wheel_next(shard)) <= nowtick)
+	{
+		shard->current = next;
+
+		/*
+		 * Cascade every level whose slot starts at this tick,
+		 * highest first, then run the level 0 slot.
+		 */
+		for (level = WHEEL_LEVELS - 1; level > 0; level--) {
+			if ((next & (((isc_uint64_t)1 <<
+				      (WHEEL_BITS * level)) - 1)) != 0)
+				continue;
+			slot = (unsigned int)(next >> (WHEEL_BITS * level)) &
+			       WHEEL_MASK;
+			if ((shard->occupied[level] &
+			     ((isc_uint64_t)1 << slot)) != 0)
+				wheel_cascade(shard, level, slot);
+		}
+
+		slot = (unsigned int)next & WHEEL_MASK;
+		list = shard->wheel[0][slot];
+		INIT_LIST(shard->wheel[0][slot]);
+		shard->occupied[0] &= ~((isc_uint64_t)1 << slot);
+		shard->current = next + 1;
+
+		while ((timer = HEAD(list)) != NULL) {
+			UNLINK(list, timer, wheellink);
+			shard->nscheduled--;
+			fire(manager, timer, now);
 		}
 	}
+
+	/*
+	 * Nothing is due up to 'nowtick', so the wheel can skip ahead.
+	 */
+	if (shard->current <= nowtick)
+		shard->current = nowtick + 1;
+	shard->wakeup = wheel_next(shard);
+}
+
+static void
+dispatch(isc__timermgr_t *manager, isc_time_t *now) {
+	isc_uint64_t nowtick, due = WHEEL_NEVER;
+	unsigned int i;
+
+	/*!
+	 * The caller must be holding the manager lock.
+	 */
+
+	nowtick = time2tick(now, ISC_FALSE);
+	for (i = 0; i < TIMER_SHARDS; i++) {
+		isc__timershard_t *shard = &manager->shards[i];
+
+		LOCK(&shard->lock);
+		/*
+		 * After a run shard->current is nowtick + 1; anything
+		 * further ahead means the clock went back.
+		 */
+		if (nowtick + 1 < shard->current)
+			wheel_rebase(shard, nowtick);
+		dispatch_shard(manager, shard, now, nowtick);
+		if (shard->wakeup < due)
+			due = shard->wakeup;
+		UNLOCK(&shard->lock);
+	}
+	manager->due = due;
 }
 
 #ifdef USE_TIMER_THREAD
@@ -788,7 +1053,7 @@ WINAPI
 #endif
 run(void *uap) {
 	isc__timermgr_t *manager = uap;
-	isc_time_t now;
+	isc_time_t now, due;
 	isc_result_t result;
 
 	LOCK(&manager->lock);
@@ -801,13 +1066,14 @@ run(void *uap) {
 
 		dispatch(manager, &now);
 
-		if (manager->nscheduled > 0) {
+		if (manager->due != WHEEL_NEVER) {
+			tick2time(manager->due, &due);
 			XTRACETIME2(isc_msgcat_get(isc_msgcat,
 						   ISC_MSGSET_GENERAL,
 						   ISC_MSG_WAITUNTIL,
 						   "waituntil"),
-				    manager->due, now);
-			result = WAITUNTIL(&manager->wakeup, &manager->lock, &manager->due);
+				    due, now);
+			result = WAITUNTIL(&manager->wakeup, &manager->lock, &due);
 			INSIST(result == ISC_R_SUCCESS ||
 			       result == ISC_R_TIMEDOUT);
 		} else {
@@ -828,34 +1094,38 @@ run(void *uap) {
 }
 #endif /* USE_TIMER_THREAD */
 
-static isc_boolean_t
-sooner(void *v1, void *v2) {
-	isc__timer_t *t1, *t2;
-
-	t1 = v1;
-	t2 = v2;
-	REQUIRE(VALID_TIMER(t1));
-	REQUIRE(VALID_TIMER(t2));
-
-	if (isc_time_compare(&t1->due, &t2->due) < 0)
-		return (ISC_TRUE);
-	return (ISC_FALSE);
+static isc_result_t
+shard_init(isc__timershard_t *shard, isc_uint64_t now) {
+	unsigned int level, slot;
+
+	INIT_LIST(shard->timers);
+	shard->nscheduled = 0;
+	shard->current = now;
+	shard->wakeup = WHEEL_NEVER;
+	for (level = 0; level < WHEEL_LEVELS; level++) {
+		shard->occupied[level] = 0;
+		for (slot = 0; slot < WHEEL_SLOTS; slot++)
+			INIT_LIST(shard->wheel[level][slot]);
+	}
+	return (isc_mutex_init(&shard->lock));
 }
 
 static void
-set_index(void *what, unsigned int index) {
-	isc__timer_t *timer;
-
-	timer = what;
-	REQUIRE(VALID_TIMER(timer));
+destroy_shards(isc__timermgr_t *manager, unsigned int n) {
+	unsigned int i;
 
-	timer->index = index;
+	for (i = 0; i < n; i++) {
+		INSIST(manager->shards[i].nscheduled == 0);
+		DESTROYLOCK(&manager->shards[i].lock);
+	}
 }
 
 isc_result_t
 isc__timermgr_create(isc_mem_t *mctx, isc_timermgr_t **managerp) {
 	isc__timermgr_t *manager;
 	isc_result_t result;
+	isc_time_t now;
+	unsigned int i;
 
 	/*
 	 * Create a timer manager.
@@ -880,19 +1150,20 @@ isc__timermgr_create(isc_mem_t *mctx, isc_timermgr_t **managerp) {
 	manager->common.methods = (isc_timermgrmethods_t *)&timermgrmethods;
 	manager->mctx = NULL;
 	manager->done = ISC_FALSE;
-	INIT_LIST(manager->timers);
-	manager->nscheduled = 0;
-	isc_time_settoepoch(&manager->due);
-	manager->heap = NULL;
-	result = isc_heap_create(mctx, sooner, set_index, 0, &manager->heap);
-	if (result != ISC_R_SUCCESS) {
-		INSIST(result == ISC_R_NOMEMORY);
-		isc_mem_put(mctx, manager, sizeof(*manager));
-		return (ISC_R_NOMEMORY);
+	manager->due = WHEEL_NEVER;
+	TIME_NOW(&now);
+	for (i = 0; i < TIMER_SHARDS; i++) {
+		result = shard_init(&manager->shards[i],
+				    time2tick(&now, ISC_FALSE));
+		if (result != ISC_R_SUCCESS) {
+			destroy_shards(manager, i);
+			isc_mem_put(mctx, manager, sizeof(*manager));
+			return (result);
+		}
 	}
 	result = isc_mutex_init(&manager->lock);
 	if (result != ISC_R_SUCCESS) {
-		isc_heap_destroy(&manager->heap);
+		destroy_shards(manager, TIMER_SHARDS);
 		isc_mem_put(mctx, manager, sizeof(*manager));
 		return (result);
 	}
@@ -901,7 +1172,7 @@ isc__timermgr_create(isc_mem_t *mctx, isc_timermgr_t **managerp) {
 	if (isc_condition_init(&manager->wakeup) != ISC_R_SUCCESS) {
 		isc_mem_detach(&manager->mctx);
 		DESTROYLOCK(&manager->lock);
-		isc_heap_destroy(&manager->heap);
+		destroy_shards(manager, TIMER_SHARDS);
 		isc_mem_put(mctx, manager, sizeof(*manager));
 		UNEXPECTED_ERROR(__FILE__, __LINE__,
 				 "isc_condition_init() %s",
@@ -914,7 +1185,7 @@ isc__timermgr_create(isc_mem_t *mctx, isc_timermgr_t **managerp) {
 		isc_mem_detach(&manager->mctx);
 		(void)isc_condition_destroy(&manager->wakeup);
 		DESTROYLOCK(&manager->lock);
-		isc_heap_destroy(&manager->heap);
+		destroy_shards(manager, TIMER_SHARDS);
 		isc_mem_put(mctx, manager, sizeof(*manager));
 		UNEXPECTED_ERROR(__FILE__, __LINE__,
 				 "isc_thread_create() %s",
@@ -950,6 +1221,7 @@ void
 isc__timermgr_destroy(isc_timermgr_t **managerp) {
 	isc__timermgr_t *manager;
 	isc_mem_t *mctx;
+	unsigned int i;
 
 	/*
 	 * Destroy a timer manager.
@@ -972,10 +1244,19 @@ isc__timermgr_destroy(isc_timermgr_t **managerp) {
 #endif /* USE_SHARED_MANAGER */
 
 #ifndef USE_TIMER_THREAD
-	isc__timermgr_dispatch((isc_timermgr_t *)manager);
+	{
+		isc_time_t now;
+
+		TIME_NOW(&now);
+		dispatch(manager, &now);
+	}
 #endif
 
-	REQUIRE(EMPTY(manager->timers));
+	for (i = 0; i < TIMER_SHARDS; i++) {
+		LOCK(&manager->shards[i].lock);
+		REQUIRE(EMPTY(manager->shards[i].timers));
+		UNLOCK(&manager->shards[i].lock);
+	}
 	manager->done = ISC_TRUE;
 
 #ifdef USE_TIMER_THREAD
@@ -1004,7 +1285,7 @@ isc__timermgr_destroy(isc_timermgr_t **managerp) {
 	(void)isc_condition_destroy(&manager->wakeup);
 #endif /* USE_TIMER_THREAD */
 	DESTROYLOCK(&manager->lock);
-	isc_heap_destroy(&manager->heap);
+	destroy_shards(manager, TIMER_SHARDS);
 	manager->common.impmagic = 0;
 	manager->common.magic = 0;
 	mctx = manager->mctx;
@@ -1018,6 +1299,22 @@ isc__timermgr_destroy(isc_timermgr_t **managerp) {
 #endif
 }
 
+/*
+ * Run the timers as if it were 'now'.  Tests use this to leave the wheels
+ * ahead of the clock, as a backward step of the clock does.
+ */
+void
+isc__timermgr_dispatchat(isc_timermgr_t *manager0, const isc_time_t *now) {
+	isc__timermgr_t *manager = (isc__timermgr_t *)manager0;
+	isc_time_t t = *now;
+
+	REQUIRE(VALID_MANAGER(manager));
+
+	LOCK(&manager->lock);
+	dispatch(manager, &t);
+	UNLOCK(&manager->lock);
+}
+
 #ifndef USE_TIMER_THREAD
 isc_result_t
 isc__timermgr_nextevent(isc_timermgr_t *manager0, isc_time_t *when) {
@@ -1027,9 +1324,9 @@ isc__timermgr_nextevent(isc_timermgr_t *manager0, isc_time_t *when) {
 	if (manager == NULL)
 		manager = timermgr;
 #endif
-	if (manager == NULL || manager->nscheduled == 0)
+	if (manager == NULL || manager->due == WHEEL_NEVER)
 		return (ISC_R_NOTFOUND);
-	*when = manager->due;
+	tick2time(manager->due, when);
 	return (ISC_R_SUCCESS);
 }
 
@@ -1045,10 +1342,13 @@ isc__timermgr_dispatch(isc_timermgr_t *manager0) {
 	if (manager == NULL)
 		return;
 	TIME_NOW(&now);
+	LOCK(&manager->lock);
 	dispatch(manager, &now);
+	UNLOCK(&manager->lock);
 }
 #endif /* USE_TIMER_THREAD */
 
+
 isc_result_t
 isc__timer_register(void) {
 	return (isc_timer_register(isc__timermgr_create));
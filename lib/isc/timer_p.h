@@ -28,4 +28,7 @@ isc__timermgr_nextevent(isc_timermgr_t *timermgr, isc_time_t *when);
 void
 isc__timermgr_dispatch(isc_timermgr_t *timermgr);
 
+void
+isc__timermgr_dispatchat(isc_timermgr_t *timermgr, const isc_time_t *now);
+
 #endif /* ISC_TIMER_P_H */
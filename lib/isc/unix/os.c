@@ -20,7 +20,16 @@
 #include <config.h>
 
 #include <isc/os.h>
-
+#include <isc/print.h>
+#include <isc/string.h>
+#include <isc/util.h>
+
+#ifdef __linux
+#include <ctype.h>
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#endif
 
 #ifdef HAVE_SYSCONF
 
@@ -92,3 +101,74 @@ isc_os_ncpus(void) {
 
 	return ((unsigned int)ncpus);
 }
+
+int
+isc_os_cpunode(int cpu) {
+#ifdef __linux
+	char path[sizeof("/sys/devices/system/cpu/cpu") + 11];
+	struct dirent *de;
+	DIR *dir;
+	int node = -1;
+
+	if (cpu < 0)
+		return (-1);
+
+	/*
+	 * The processor directory holds a "node<N>" link to its node.
+	 */
+	snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d", cpu);
+	dir = opendir(path);
+	if (dir == NULL)
+		return (-1);
+	while ((de = readdir(dir)) != NULL) {
+		if (strncmp(de->d_name, "node", 4) == 0 &&
+		    isdigit((unsigned char)de->d_name[4])) {
+			node = atoi(de->d_name + 4);
+			break;
+		}
+	}
+	(void)closedir(dir);
+
+	return (node);
+#else
+	UNUSED(cpu);
+
+	return (-1);
+#endif
+}
+
+int
+isc_os_ifnode(const char *ifname) {
+#ifdef __linux
+	char name[64], path[sizeof(name) + 40];
+	char *colon;
+	FILE *fp;
+	int node;
+
+	if (strlen(ifname) >= sizeof(name) || strchr(ifname, '/') != NULL)
+		return (-1);
+	strcpy(name, ifname);
+	colon = strchr(name, ':');
+	if (colon != NULL)
+		*colon = '\0';
+
+	/*
+	 * Virtual devices have no "device", and devices of machines
+	 * without NUMA report -1.
+	 */
+	snprintf(path, sizeof(path), "/sys/class/net/%s/device/numa_node",
+		 name);
+	fp = fopen(path, "r");
+	if (fp == NULL)
+		return (-1);
+	if (fscanf(fp, "%d", &node) != 1 || node < 0)
+		node = -1;
+	(void)fclose(fp);
+
+	return (node);
+#else
+	UNUSED(ifname);
+
+	return (-1);
+#endif
+}
@@ -221,6 +221,17 @@ typedef enum { poll_idle, poll_active, poll_checking } pollstate_t;
 #define FDLOCK_ID(fd)		0
 #endif	/* ISC_PLATFORM_USETHREADS */
 
+/*%
+ * The watcher thread of an FD.  An FD always maps to the same watcher, so
+ * the messages about it are processed in order even after the FD number
+ * is reused.
+ */
+#ifdef USE_WATCHER_THREAD
+#define FDTHREAD(manager, fd)	((fd) % (manager)->nthreads)
+#else
+#define FDTHREAD(manager, fd)	0
+#endif	/* USE_WATCHER_THREAD */
+
 /*%
  * Maximum number of events communicated with the kernel.  There should normally
  * be no need for having a large number.
@@ -304,6 +315,18 @@ typedef isc_event_t intev_t;
 #endif
 #endif
 
+/*%
+ * Linux can move several datagrams in a single system call.  Queued UDP
+ * reads and writes are then handled in batches of up to
+ * ISC_SOCKET_MAXBATCH.
+ */
+#ifdef HAVE_RECVMMSG
+#define USE_RECVMMSG	1
+#endif
+#ifdef HAVE_SENDMMSG
+#define USE_SENDMMSG	1
+#endif
+
 /*%
  * The size to raise the receive buffer to (from BIND 8).
  */
@@ -320,6 +343,7 @@ typedef isc_event_t intev_t;
 
 typedef struct isc__socket isc__socket_t;
 typedef struct isc__socketmgr isc__socketmgr_t;
+typedef struct isc__socketthread isc__socketthread_t;
 
 #define NEWCONNSOCK(ev) ((isc__socket_t *)(ev)->newsocket)
 
@@ -372,6 +396,10 @@ struct isc__socket {
 	ISC_SOCKADDR_LEN_T	recvcmsgbuflen;
 	char			*sendcmsgbuf;
 	ISC_SOCKADDR_LEN_T	sendcmsgbuflen;
+#if defined(USE_RECVMMSG) || defined(USE_SENDMMSG)
+	char			*batchcmsgbuf;	/* allocated on first use */
+	ISC_SOCKADDR_LEN_T	batchcmsgbuflen;
+#endif
 
 	void			*fdwatcharg;
 	isc_sockfdwatch_t	fdwatchcb;
@@ -383,13 +411,14 @@ struct isc__socket {
 #define SOCKET_MANAGER_MAGIC	ISC_MAGIC('I', 'O', 'm', 'g')
 #define VALID_MANAGER(m)	ISC_MAGIC_VALID(m, SOCKET_MANAGER_MAGIC)
 
-struct isc__socketmgr {
+/*%
+ * A watcher with its own poll set and control pipe.  It only sees the
+ * FDs that FDTHREAD() assigns to it.
+ */
+struct isc__socketthread {
 	/* Not locked. */
-	isc_socketmgr_t		common;
-	isc_mem_t	       *mctx;
-	isc_mutex_t		lock;
-	isc_mutex_t		*fdlock;
-	isc_stats_t		*stats;
+	isc__socketmgr_t	*manager;
+	int			threadid;
 #ifdef USE_KQUEUE
 	int			kqueue_fd;
 	int			nevents;
@@ -405,13 +434,27 @@ struct isc__socketmgr {
 	int			nevents;
 	struct pollfd		*events;
 #endif	/* USE_DEVPOLL */
+#ifdef ISC_PLATFORM_USETHREADS
+	int			pipe_fds[2];
+#endif
+#ifdef USE_WATCHER_THREAD
+	isc_thread_t		thread;
+#endif /* USE_WATCHER_THREAD */
+};
+
+struct isc__socketmgr {
+	/* Not locked. */
+	isc_socketmgr_t		common;
+	isc_mem_t	       *mctx;
+	isc_mutex_t		lock;
+	isc_mutex_t		*fdlock;
+	isc_stats_t		*stats;
+	int			nthreads;
+	isc__socketthread_t	*threads;
 #ifdef USE_SELECT
 	int			fd_bufsize;
 #endif	/* USE_SELECT */
 	unsigned int		maxsocks;
-#ifdef ISC_PLATFORM_USETHREADS
-	int			pipe_fds[2];
-#endif
 
 	/* Locked by fdlock. */
 	isc__socket_t	       **fds;
@@ -431,7 +474,6 @@ struct isc__socketmgr {
 #endif	/* USE_SELECT */
 	int			reserved;	/* unlocked */
 #ifdef USE_WATCHER_THREAD
-	isc_thread_t		watcher;
 	isc_condition_t		shutdown_ok;
 #else /* USE_WATCHER_THREAD */
 	unsigned int		refs;
@@ -479,7 +521,7 @@ static void build_msghdr_send(isc__socket_t *, isc_socketevent_t *,
 static void build_msghdr_recv(isc__socket_t *, isc_socketevent_t *,
 			      struct msghdr *, struct iovec *, size_t *);
 #ifdef USE_WATCHER_THREAD
-static isc_boolean_t process_ctlfd(isc__socketmgr_t *manager);
+static isc_boolean_t process_ctlfd(isc__socketthread_t *thread);
 #endif
 static void setdscp(isc__socket_t *sock, isc_dscp_t dscp);
 
@@ -589,7 +631,7 @@ isc_result_t
 isc__socketmgr_create(isc_mem_t *mctx, isc_socketmgr_t **managerp);
 isc_result_t
 isc__socketmgr_create2(isc_mem_t *mctx, isc_socketmgr_t **managerp,
-		       unsigned int maxsocks);
+		       unsigned int maxsocks, unsigned int nthreads);
 isc_result_t
 isc_socketmgr_getmaxsockets(isc_socketmgr_t *manager0, unsigned int *nsockp);
 void
@@ -677,7 +719,11 @@ enum {
 	STATID_ACCEPT = 7,
 	STATID_SENDFAIL = 8,
 	STATID_RECVFAIL = 9,
-	STATID_ACTIVE = 10
+	STATID_ACTIVE = 10,
+	STATID_RECVBATCH = 11,
+	STATID_RECVBATCHMSGS = 12,
+	STATID_SENDBATCH = 13,
+	STATID_SENDBATCHMSGS = 14
 };
 static const isc_statscounter_t udp4statsindex[] = {
 	isc_sockstatscounter_udp4open,
@@ -690,7 +736,11 @@ static const isc_statscounter_t udp4statsindex[] = {
 	-1,
 	isc_sockstatscounter_udp4sendfail,
 	isc_sockstatscounter_udp4recvfail,
-	isc_sockstatscounter_udp4active
+	isc_sockstatscounter_udp4active,
+	isc_sockstatscounter_udp4recvbatch,
+	isc_sockstatscounter_udp4recvbatchmsgs,
+	isc_sockstatscounter_udp4sendbatch,
+	isc_sockstatscounter_udp4sendbatchmsgs
 };
 static const isc_statscounter_t udp6statsindex[] = {
 	isc_sockstatscounter_udp6open,
@@ -703,7 +753,11 @@ static const isc_statscounter_t udp6statsindex[] = {
 	-1,
 	isc_sockstatscounter_udp6sendfail,
 	isc_sockstatscounter_udp6recvfail,
-	isc_sockstatscounter_udp6active
+	isc_sockstatscounter_udp6active,
+	isc_sockstatscounter_udp6recvbatch,
+	isc_sockstatscounter_udp6recvbatchmsgs,
+	isc_sockstatscounter_udp6sendbatch,
+	isc_sockstatscounter_udp6sendbatchmsgs
 };
 static const isc_statscounter_t tcp4statsindex[] = {
 	isc_sockstatscounter_tcp4open,
@@ -716,7 +770,11 @@ static const isc_statscounter_t tcp4statsindex[] = {
 	isc_sockstatscounter_tcp4accept,
 	isc_sockstatscounter_tcp4sendfail,
 	isc_sockstatscounter_tcp4recvfail,
-	isc_sockstatscounter_tcp4active
+	isc_sockstatscounter_tcp4active,
+	-1,
+	-1,
+	-1,
+	-1
 };
 static const isc_statscounter_t tcp6statsindex[] = {
 	isc_sockstatscounter_tcp6open,
@@ -729,7 +787,11 @@ static const isc_statscounter_t tcp6statsindex[] = {
 	isc_sockstatscounter_tcp6accept,
 	isc_sockstatscounter_tcp6sendfail,
 	isc_sockstatscounter_tcp6recvfail,
-	isc_sockstatscounter_tcp6active
+	isc_sockstatscounter_tcp6active,
+	-1,
+	-1,
+	-1,
+	-1
 };
 static const isc_statscounter_t unixstatsindex[] = {
 	isc_sockstatscounter_unixopen,
@@ -742,7 +804,11 @@ static const isc_statscounter_t unixstatsindex[] = {
 	isc_sockstatscounter_unixaccept,
 	isc_sockstatscounter_unixsendfail,
 	isc_sockstatscounter_unixrecvfail,
-	isc_sockstatscounter_unixactive
+	isc_sockstatscounter_unixactive,
+	-1,
+	-1,
+	-1,
+	-1
 };
 static const isc_statscounter_t fdwatchstatsindex[] = {
 	-1,
@@ -755,6 +821,10 @@ static const isc_statscounter_t fdwatchstatsindex[] = {
 	-1,
 	isc_sockstatscounter_fdwatchsendfail,
 	isc_sockstatscounter_fdwatchrecvfail,
+	-1,
+	-1,
+	-1,
+	-1,
 	-1
 };
 static const isc_statscounter_t rawstatsindex[] = {
@@ -768,7 +838,11 @@ static const isc_statscounter_t rawstatsindex[] = {
 	-1,
 	-1,
 	isc_sockstatscounter_rawrecvfail,
-	isc_sockstatscounter_rawactive
+	isc_sockstatscounter_rawactive,
+	-1,
+	-1,
+	-1,
+	-1
 };
 
 #if defined(USE_KQUEUE) || defined(USE_EPOLL) || defined(USE_DEVPOLL) || \
@@ -886,8 +960,23 @@ dec_stats(isc_stats_t *stats, isc_statscounter_t counterid) {
 		isc_stats_decrement(stats, counterid);
 }
 
+#if defined(USE_RECVMMSG) || defined(USE_SENDMMSG)
+/*%
+ * Add to socket-related statistics counters.
+ */
+static inline void
+add_stats(isc_stats_t *stats, isc_statscounter_t counterid,
+	  isc_uint32_t val)
+{
+	REQUIRE(counterid != -1);
+
+	if (stats != NULL)
+		isc_stats_add(stats, counterid, val);
+}
+#endif
+
 static inline isc_result_t
-watch_fd(isc__socketmgr_t *manager, int fd, int msg) {
+watch_fd(isc__socketthread_t *thread, int fd, int msg) {
 	isc_result_t result = ISC_R_SUCCESS;
 
 #ifdef USE_KQUEUE
@@ -900,7 +989,7 @@ watch_fd(isc__socketmgr_t *manager, int fd, int msg) {
 		evchange.filter = EVFILT_WRITE;
 	evchange.flags = EV_ADD;
 	evchange.ident = fd;
-	if (kevent(manager->kqueue_fd, &evchange, 1, NULL, 0, NULL) != 0)
+	if (kevent(thread->kqueue_fd, &evchange, 1, NULL, 0, NULL) != 0)
 		result = isc__errno2result(errno);
 
 	return (result);
@@ -913,13 +1002,14 @@ watch_fd(isc__socketmgr_t *manager, int fd, int msg) {
 		event.events = EPOLLOUT;
 	memset(&event.data, 0, sizeof(event.data));
 	event.data.fd = fd;
-	if (epoll_ctl(manager->epoll_fd, EPOLL_CTL_ADD, fd, &event) == -1 &&
+	if (epoll_ctl(thread->epoll_fd, EPOLL_CTL_ADD, fd, &event) == -1 &&
 	    errno != EEXIST) {
 		result = isc__errno2result(errno);
 	}
 
 	return (result);
 #elif defined(USE_DEVPOLL)
+	isc__socketmgr_t *manager = thread->manager;
 	struct pollfd pfd;
 	int lockid = FDLOCK_ID(fd);
 
@@ -931,7 +1021,7 @@ watch_fd(isc__socketmgr_t *manager, int fd, int msg) {
 	pfd.fd = fd;
 	pfd.revents = 0;
 	LOCK(&manager->fdlock[lockid]);
-	if (write(manager->devpoll_fd, &pfd, sizeof(pfd)) == -1)
+	if (write(thread->devpoll_fd, &pfd, sizeof(pfd)) == -1)
 		result = isc__errno2result(errno);
 	else {
 		if (msg == SELECT_POKE_READ)
@@ -943,6 +1033,8 @@ watch_fd(isc__socketmgr_t *manager, int fd, int msg) {
 
 	return (result);
 #elif defined(USE_SELECT)
+	isc__socketmgr_t *manager = thread->manager;
+
 	LOCK(&manager->lock);
 	if (msg == SELECT_POKE_READ)
 		FD_SET(fd, manager->read_fds);
@@ -955,7 +1047,7 @@ watch_fd(isc__socketmgr_t *manager, int fd, int msg) {
 }
 
 static inline isc_result_t
-unwatch_fd(isc__socketmgr_t *manager, int fd, int msg) {
+unwatch_fd(isc__socketthread_t *thread, int fd, int msg) {
 	isc_result_t result = ISC_R_SUCCESS;
 
 #ifdef USE_KQUEUE
@@ -968,7 +1060,7 @@ unwatch_fd(isc__socketmgr_t *manager, int fd, int msg) {
 		evchange.filter = EVFILT_WRITE;
 	evchange.flags = EV_DELETE;
 	evchange.ident = fd;
-	if (kevent(manager->kqueue_fd, &evchange, 1, NULL, 0, NULL) != 0)
+	if (kevent(thread->kqueue_fd, &evchange, 1, NULL, 0, NULL) != 0)
 		result = isc__errno2result(errno);
 
 	return (result);
@@ -981,7 +1073,7 @@ unwatch_fd(isc__socketmgr_t *manager, int fd, int msg) {
 		event.events = EPOLLOUT;
 	memset(&event.data, 0, sizeof(event.data));
 	event.data.fd = fd;
-	if (epoll_ctl(manager->epoll_fd, EPOLL_CTL_DEL, fd, &event) == -1 &&
+	if (epoll_ctl(thread->epoll_fd, EPOLL_CTL_DEL, fd, &event) == -1 &&
 	    errno != ENOENT) {
 		char strbuf[ISC_STRERRORSIZE];
 		isc__strerror(errno, strbuf, sizeof(strbuf));
@@ -991,6 +1083,7 @@ unwatch_fd(isc__socketmgr_t *manager, int fd, int msg) {
 	}
 	return (result);
 #elif defined(USE_DEVPOLL)
+	isc__socketmgr_t *manager = thread->manager;
 	struct pollfd pfds[2];
 	size_t writelen = sizeof(pfds[0]);
 	int lockid = FDLOCK_ID(fd);
@@ -1018,7 +1111,7 @@ unwatch_fd(isc__socketmgr_t *manager, int fd, int msg) {
 		writelen += sizeof(pfds[1]);
 	}
 
-	if (write(manager->devpoll_fd, pfds, writelen) == -1)
+	if (write(thread->devpoll_fd, pfds, writelen) == -1)
 		result = isc__errno2result(errno);
 	else {
 		if (msg == SELECT_POKE_READ)
@@ -1030,6 +1123,8 @@ unwatch_fd(isc__socketmgr_t *manager, int fd, int msg) {
 
 	return (result);
 #elif defined(USE_SELECT)
+	isc__socketmgr_t *manager = thread->manager;
+
 	LOCK(&manager->lock);
 	if (msg == SELECT_POKE_READ)
 		FD_CLR(fd, manager->read_fds);
@@ -1042,7 +1137,8 @@ unwatch_fd(isc__socketmgr_t *manager, int fd, int msg) {
 }
 
 static void
-wakeup_socket(isc__socketmgr_t *manager, int fd, int msg) {
+wakeup_socket(isc__socketthread_t *thread, int fd, int msg) {
+	isc__socketmgr_t *manager = thread->manager;
 	isc_result_t result;
 	int lockid = FDLOCK_ID(fd);
 
@@ -1053,13 +1149,14 @@ wakeup_socket(isc__socketmgr_t *manager, int fd, int msg) {
 	 */
 
 	INSIST(fd >= 0 && fd < (int)manager->maxsocks);
+	INSIST(FDTHREAD(manager, fd) == thread->threadid);
 
 	if (msg == SELECT_POKE_CLOSE) {
 		/* No one should be updating fdstate, so no need to lock it */
 		INSIST(manager->fdstate[fd] == CLOSE_PENDING);
 		manager->fdstate[fd] = CLOSED;
-		(void)unwatch_fd(manager, fd, SELECT_POKE_READ);
-		(void)unwatch_fd(manager, fd, SELECT_POKE_WRITE);
+		(void)unwatch_fd(thread, fd, SELECT_POKE_READ);
+		(void)unwatch_fd(thread, fd, SELECT_POKE_WRITE);
 		(void)close(fd);
 		return;
 	}
@@ -1076,8 +1173,8 @@ wakeup_socket(isc__socketmgr_t *manager, int fd, int msg) {
 		 * fdlock; otherwise it could cause deadlock due to a lock order
 		 * reversal.
 		 */
-		(void)unwatch_fd(manager, fd, SELECT_POKE_READ);
-		(void)unwatch_fd(manager, fd, SELECT_POKE_WRITE);
+		(void)unwatch_fd(thread, fd, SELECT_POKE_READ);
+		(void)unwatch_fd(thread, fd, SELECT_POKE_WRITE);
 		return;
 	}
 	if (manager->fdstate[fd] != MANAGED) {
@@ -1089,7 +1186,7 @@ wakeup_socket(isc__socketmgr_t *manager, int fd, int msg) {
 	/*
 	 * Set requested bit.
 	 */
-	result = watch_fd(manager, fd, msg);
+	result = watch_fd(thread, fd, msg);
 	if (result != ISC_R_SUCCESS) {
 		/*
 		 * XXXJT: what should we do?  Ignoring the failure of watching
@@ -1105,12 +1202,13 @@ wakeup_socket(isc__socketmgr_t *manager, int fd, int msg) {
 
 #ifdef USE_WATCHER_THREAD
 /*
- * Poke the select loop when there is something for us to do.
- * The write is required (by POSIX) to complete.  That is, we
- * will not get partial writes.
+ * Poke the select loop of the watcher of 'fd' when there is something
+ * for us to do.  The write is required (by POSIX) to complete.  That is,
+ * we will not get partial writes.
  */
 static void
 select_poke(isc__socketmgr_t *mgr, int fd, int msg) {
+	isc__socketthread_t *thread = &mgr->threads[FDTHREAD(mgr, fd)];
 	int cc;
 	int buf[2];
 	char strbuf[ISC_STRERRORSIZE];
@@ -1119,7 +1217,7 @@ select_poke(isc__socketmgr_t *mgr, int fd, int msg) {
 	buf[1] = msg;
 
 	do {
-		cc = write(mgr->pipe_fds[1], buf, sizeof(buf));
+		cc = write(thread->pipe_fds[1], buf, sizeof(buf));
 #ifdef ENOSR
 		/*
 		 * Treat ENOSR as EAGAIN but loop slowly as it is
@@ -1149,12 +1247,12 @@ select_poke(isc__socketmgr_t *mgr, int fd, int msg) {
  * Read a message on the internal fd.
  */
 static void
-select_readmsg(isc__socketmgr_t *mgr, int *fd, int *msg) {
+select_readmsg(isc__socketthread_t *thread, int *fd, int *msg) {
 	int buf[2];
 	int cc;
 	char strbuf[ISC_STRERRORSIZE];
 
-	cc = read(mgr->pipe_fds[0], buf, sizeof(buf));
+	cc = read(thread->pipe_fds[0], buf, sizeof(buf));
 	if (cc < 0) {
 		*msg = SELECT_POKE_NOTHING;
 		*fd = -1;	/* Silence compiler. */
@@ -1185,7 +1283,7 @@ select_poke(isc__socketmgr_t *manager, int fd, int msg) {
 	if (msg == SELECT_POKE_SHUTDOWN)
 		return;
 	else if (fd >= 0)
-		wakeup_socket(manager, fd, msg);
+		wakeup_socket(&manager->threads[0], fd, msg);
 	return;
 }
 #endif /* USE_WATCHER_THREAD */
@@ -1821,43 +1919,12 @@ dump_msg(struct msghdr *msg) {
 #define DOIO_HARD		2	/* i/o error, event sent */
 #define DOIO_EOF		3	/* EOF, no event sent */
 
+/*
+ * Map a failed receive to DOIO_SOFT, or to DOIO_HARD with the error
+ * stored in 'dev'.
+ */
 static int
-doio_recv(isc__socket_t *sock, isc_socketevent_t *dev) {
-	int cc;
-	struct iovec iov[MAXSCATTERGATHER_RECV];
-	size_t read_count;
-	size_t actual_count;
-	struct msghdr msghdr;
-	isc_buffer_t *buffer;
-	int recv_errno;
-	char strbuf[ISC_STRERRORSIZE];
-
-	build_msghdr_recv(sock, dev, &msghdr, iov, &read_count);
-
-#if defined(ISC_SOCKET_DEBUG)
-	dump_msg(&msghdr);
-#endif
-
-	cc = recvmsg(sock->fd, &msghdr, 0);
-	recv_errno = errno;
-
-#if defined(ISC_SOCKET_DEBUG)
-	dump_msg(&msghdr);
-#endif
-
-	if (cc < 0) {
-		if (SOFT_ERROR(recv_errno))
-			return (DOIO_SOFT);
-
-		if (isc_log_wouldlog(isc_lctx, IOEVENT_LEVEL)) {
-			isc__strerror(recv_errno, strbuf, sizeof(strbuf));
-			socket_log(sock, NULL, IOEVENT,
-				   isc_msgcat, ISC_MSGSET_SOCKET,
-				   ISC_MSG_DOIORECV,
-				  "doio_recv: recvmsg(%d) %d bytes, err %d/%s",
-				   sock->fd, cc, recv_errno, strbuf);
-		}
-
+recv_error(isc__socket_t *sock, isc_socketevent_t *dev, int recv_errno) {
 #define SOFT_OR_HARD(_system, _isc) \
 	if (recv_errno == _system) { \
 		if (sock->connected) { \
@@ -1876,34 +1943,44 @@ doio_recv(isc__socket_t *sock, isc_socketevent_t *dev) {
 		return (DOIO_HARD); \
 	}
 
-		SOFT_OR_HARD(ECONNREFUSED, ISC_R_CONNREFUSED);
-		SOFT_OR_HARD(ENETUNREACH, ISC_R_NETUNREACH);
-		SOFT_OR_HARD(EHOSTUNREACH, ISC_R_HOSTUNREACH);
-		SOFT_OR_HARD(EHOSTDOWN, ISC_R_HOSTDOWN);
-		/* HPUX 11.11 can return EADDRNOTAVAIL. */
-		SOFT_OR_HARD(EADDRNOTAVAIL, ISC_R_ADDRNOTAVAIL);
-		ALWAYS_HARD(ENOBUFS, ISC_R_NORESOURCES);
-		/* Should never get this one but it was seen. */
+	SOFT_OR_HARD(ECONNREFUSED, ISC_R_CONNREFUSED);
+	SOFT_OR_HARD(ENETUNREACH, ISC_R_NETUNREACH);
+	SOFT_OR_HARD(EHOSTUNREACH, ISC_R_HOSTUNREACH);
+	SOFT_OR_HARD(EHOSTDOWN, ISC_R_HOSTDOWN);
+	/* HPUX 11.11 can return EADDRNOTAVAIL. */
+	SOFT_OR_HARD(EADDRNOTAVAIL, ISC_R_ADDRNOTAVAIL);
+	ALWAYS_HARD(ENOBUFS, ISC_R_NORESOURCES);
+	/* Should never get this one but it was seen. */
 #ifdef ENOPROTOOPT
-		SOFT_OR_HARD(ENOPROTOOPT, ISC_R_HOSTUNREACH);
+	SOFT_OR_HARD(ENOPROTOOPT, ISC_R_HOSTUNREACH);
 #endif
-		/*
-		 * HPUX returns EPROTO and EINVAL on receiving some ICMP/ICMPv6
-		 * errors.
-		 */
+	/*
+	 * HPUX returns EPROTO and EINVAL on receiving some ICMP/ICMPv6
+	 * errors.
+	 */
 #ifdef EPROTO
-		SOFT_OR_HARD(EPROTO, ISC_R_HOSTUNREACH);
+	SOFT_OR_HARD(EPROTO, ISC_R_HOSTUNREACH);
 #endif
-		SOFT_OR_HARD(EINVAL, ISC_R_HOSTUNREACH);
+	SOFT_OR_HARD(EINVAL, ISC_R_HOSTUNREACH);
 
 #undef SOFT_OR_HARD
 #undef ALWAYS_HARD
 
-		dev->result = isc__errno2result(recv_errno);
-		inc_stats(sock->manager->stats,
-			  sock->statsindex[STATID_RECVFAIL]);
-		return (DOIO_HARD);
-	}
+	dev->result = isc__errno2result(recv_errno);
+	inc_stats(sock->manager->stats, sock->statsindex[STATID_RECVFAIL]);
+	return (DOIO_HARD);
+}
+
+/*
+ * Update 'dev' after 'cc' bytes have been received into the buffers
+ * described by 'msghdr', which can take 'read_count' bytes.
+ */
+static int
+complete_recv(isc__socket_t *sock, isc_socketevent_t *dev,
+	      struct msghdr *msghdr, int cc, size_t read_count)
+{
+	size_t actual_count;
+	isc_buffer_t *buffer;
 
 	/*
 	 * On TCP and UNIX sockets, zero length reads indicate EOF,
@@ -1925,7 +2002,7 @@ doio_recv(isc__socket_t *sock, isc_socketevent_t *dev) {
 	}
 
 	if (sock->type == isc_sockettype_udp) {
-		dev->address.length = msghdr.msg_namelen;
+		dev->address.length = msghdr->msg_namelen;
 		if (isc_sockaddr_getport(&dev->address) == 0) {
 			if (isc_log_wouldlog(isc_lctx, IOEVENT_LEVEL)) {
 				socket_log(sock, &dev->address, IOEVENT,
@@ -1963,7 +2040,7 @@ doio_recv(isc__socket_t *sock, isc_socketevent_t *dev) {
 	 * If there are control messages attached, run through them and pull
 	 * out the interesting bits.
 	 */
-	process_cmsg(sock, &msghdr, dev);
+	process_cmsg(sock, msghdr, dev);
 
 	/*
 	 * update the buffers (if any) and the i/o count
@@ -2003,6 +2080,162 @@ doio_recv(isc__socket_t *sock, isc_socketevent_t *dev) {
 	return (DOIO_SUCCESS);
 }
 
+static int
+doio_recv(isc__socket_t *sock, isc_socketevent_t *dev) {
+	int cc;
+	struct iovec iov[MAXSCATTERGATHER_RECV];
+	size_t read_count;
+	struct msghdr msghdr;
+	int recv_errno;
+	char strbuf[ISC_STRERRORSIZE];
+
+	build_msghdr_recv(sock, dev, &msghdr, iov, &read_count);
+
+#if defined(ISC_SOCKET_DEBUG)
+	dump_msg(&msghdr);
+#endif
+
+	cc = recvmsg(sock->fd, &msghdr, 0);
+	recv_errno = errno;
+
+#if defined(ISC_SOCKET_DEBUG)
+	dump_msg(&msghdr);
+#endif
+
+	if (cc < 0) {
+		if (SOFT_ERROR(recv_errno))
+			return (DOIO_SOFT);
+
+		if (isc_log_wouldlog(isc_lctx, IOEVENT_LEVEL)) {
+			isc__strerror(recv_errno, strbuf, sizeof(strbuf));
+			socket_log(sock, NULL, IOEVENT,
+				   isc_msgcat, ISC_MSGSET_SOCKET,
+				   ISC_MSG_DOIORECV,
+				  "doio_recv: recvmsg(%d) %d bytes, err %d/%s",
+				   sock->fd, cc, recv_errno, strbuf);
+		}
+
+		return (recv_error(sock, dev, recv_errno));
+	}
+
+	return (complete_recv(sock, dev, &msghdr, cc, read_count));
+}
+
+#if defined(USE_RECVMMSG) || defined(USE_SENDMMSG)
+/*
+ * Make sure the socket has one control message slot per datagram of a
+ * batch.  Only sockets that ever see a batch pay for it.
+ *
+ * The socket must be locked.
+ */
+static isc_boolean_t
+get_batchcmsgbuf(isc__socket_t *sock) {
+	ISC_SOCKADDR_LEN_T len;
+
+	if (sock->batchcmsgbuf != NULL)
+		return (ISC_TRUE);
+
+	len = ISC_MAX(sock->recvcmsgbuflen, sock->sendcmsgbuflen);
+	if (len == 0U)
+		return (ISC_TRUE);
+
+	sock->batchcmsgbuf = isc_mem_get(sock->manager->mctx,
+					 len * ISC_SOCKET_MAXBATCH);
+	if (sock->batchcmsgbuf == NULL)
+		return (ISC_FALSE);
+	sock->batchcmsgbuflen = len * ISC_SOCKET_MAXBATCH;
+
+	return (ISC_TRUE);
+}
+#endif
+
+#ifdef USE_RECVMMSG
+/*
+ * Fill the first ISC_SOCKET_MAXBATCH events on the receive list of a UDP
+ * socket with a single recvmmsg() call and post the completed ones.
+ *
+ * Returns:
+ *	DOIO_SUCCESS	Datagrams (or an error) were delivered, there may
+ *			be more to read.
+ *
+ *	DOIO_SOFT	The socket has been drained.
+ *
+ *	DOIO_HARD	No batch could be set up; use doio_recv().
+ *
+ * The socket must be locked.
+ */
+static int
+doio_recvbatch(isc__socket_t *sock) {
+	struct mmsghdr msgs[ISC_SOCKET_MAXBATCH];
+	struct iovec iov[ISC_SOCKET_MAXBATCH][MAXSCATTERGATHER_RECV];
+	size_t read_count[ISC_SOCKET_MAXBATCH];
+	isc_socketevent_t *devs[ISC_SOCKET_MAXBATCH];
+	isc_socketevent_t *dev;
+	unsigned int slot;
+	int cc, i, n, recv_errno;
+	char strbuf[ISC_STRERRORSIZE];
+
+	if (!get_batchcmsgbuf(sock))
+		return (DOIO_HARD);
+	slot = sock->batchcmsgbuflen / ISC_SOCKET_MAXBATCH;
+
+	n = 0;
+	for (dev = ISC_LIST_HEAD(sock->recv_list);
+	     dev != NULL && n < ISC_SOCKET_MAXBATCH;
+	     dev = ISC_LIST_NEXT(dev, ev_link))
+	{
+		build_msghdr_recv(sock, dev, &msgs[n].msg_hdr, iov[n],
+				  &read_count[n]);
+#if defined(ISC_NET_BSD44MSGHDR) && defined(USE_CMSG)
+		msgs[n].msg_hdr.msg_control = sock->batchcmsgbuf + n * slot;
+#endif
+		msgs[n].msg_len = 0;
+		devs[n++] = dev;
+	}
+
+	cc = recvmmsg(sock->fd, msgs, n, 0, NULL);
+	recv_errno = errno;
+
+	if (cc < 0) {
+		if (SOFT_ERROR(recv_errno))
+			return (DOIO_SOFT);
+
+		if (isc_log_wouldlog(isc_lctx, IOEVENT_LEVEL)) {
+			isc__strerror(recv_errno, strbuf, sizeof(strbuf));
+			socket_log(sock, NULL, IOEVENT,
+				   isc_msgcat, ISC_MSGSET_SOCKET,
+				   ISC_MSG_DOIORECV,
+				   "doio_recvbatch: recvmmsg(%d) %d messages, "
+				   "err %d/%s", sock->fd, n, recv_errno,
+				   strbuf);
+		}
+
+		if (recv_error(sock, devs[0], recv_errno) == DOIO_SOFT)
+			return (DOIO_SOFT);
+		send_recvdone_event(sock, &devs[0]);
+		return (DOIO_SUCCESS);
+	}
+	if (cc == 0)
+		return (DOIO_SOFT);
+
+	inc_stats(sock->manager->stats, sock->statsindex[STATID_RECVBATCH]);
+	add_stats(sock->manager->stats,
+		  sock->statsindex[STATID_RECVBATCHMSGS], cc);
+
+	/*
+	 * Events whose datagram was dropped stay on the list.
+	 */
+	for (i = 0; i < cc; i++) {
+		if (complete_recv(sock, devs[i], &msgs[i].msg_hdr,
+				  (int)msgs[i].msg_len,
+				  read_count[i]) == DOIO_SUCCESS)
+			send_recvdone_event(sock, &devs[i]);
+	}
+
+	return (cc == n ? DOIO_SUCCESS : DOIO_SOFT);
+}
+#endif
+
 /*
  * Returns:
  *	DOIO_SUCCESS	The operation succeeded.  dev->result contains
@@ -2126,6 +2359,93 @@ doio_send(isc__socket_t *sock, isc_socketevent_t *dev) {
 	return (DOIO_SUCCESS);
 }
 
+#ifdef USE_SENDMMSG
+/*
+ * Send the first ISC_SOCKET_MAXBATCH events on the send list of a UDP
+ * socket with a single sendmmsg() call and post the completed ones.
+ *
+ * Returns:
+ *	DOIO_SUCCESS	Datagrams were sent, there may be more to send.
+ *
+ *	DOIO_SOFT	The socket would block.
+ *
+ *	DOIO_HARD	No batch could be sent; use doio_send() to send
+ *			the first event or to report its error.
+ *
+ * The socket must be locked.
+ */
+static int
+doio_sendbatch(isc__socket_t *sock) {
+	struct mmsghdr msgs[ISC_SOCKET_MAXBATCH];
+	struct iovec iov[ISC_SOCKET_MAXBATCH][MAXSCATTERGATHER_SEND];
+	size_t write_count[ISC_SOCKET_MAXBATCH];
+	isc_socketevent_t *devs[ISC_SOCKET_MAXBATCH];
+	isc_socketevent_t *dev;
+	unsigned int slot;
+	int attempts = 0;
+	int cc, i, n;
+
+	if (!get_batchcmsgbuf(sock))
+		return (DOIO_HARD);
+	slot = sock->batchcmsgbuflen / ISC_SOCKET_MAXBATCH;
+
+	n = 0;
+	for (dev = ISC_LIST_HEAD(sock->send_list);
+	     dev != NULL && n < ISC_SOCKET_MAXBATCH;
+	     dev = ISC_LIST_NEXT(dev, ev_link))
+	{
+		build_msghdr_send(sock, dev, &msgs[n].msg_hdr, iov[n],
+				  &write_count[n]);
+		/*
+		 * Oversized responses are dropped by doio_send().
+		 */
+		if (sock->manager->maxudp != 0 &&
+		    write_count[n] > (size_t)sock->manager->maxudp)
+			break;
+#ifdef ISC_NET_BSD44MSGHDR
+		if (msgs[n].msg_hdr.msg_controllen != 0U) {
+			INSIST(msgs[n].msg_hdr.msg_controllen <= slot);
+			memmove(sock->batchcmsgbuf + n * slot,
+				msgs[n].msg_hdr.msg_control,
+				msgs[n].msg_hdr.msg_controllen);
+			msgs[n].msg_hdr.msg_control = sock->batchcmsgbuf +
+						      n * slot;
+		}
+#endif
+		msgs[n].msg_len = 0;
+		devs[n++] = dev;
+	}
+	if (n < 2)
+		return (DOIO_HARD);
+
+ resend:
+	cc = sendmmsg(sock->fd, msgs, n, 0);
+	if (cc < 0) {
+		if (errno == EINTR && ++attempts < NRETRIES)
+			goto resend;
+		if (SOFT_ERROR(errno))
+			return (DOIO_SOFT);
+		return (DOIO_HARD);
+	}
+	if (cc == 0)
+		return (DOIO_HARD);
+
+	inc_stats(sock->manager->stats, sock->statsindex[STATID_SENDBATCH]);
+	add_stats(sock->manager->stats,
+		  sock->statsindex[STATID_SENDBATCHMSGS], cc);
+
+	for (i = 0; i < cc; i++) {
+		devs[i]->n += msgs[i].msg_len;
+		if ((size_t)msgs[i].msg_len != write_count[i])
+			return (DOIO_SOFT);
+		devs[i]->result = ISC_R_SUCCESS;
+		send_senddone_event(sock, &devs[i]);
+	}
+
+	return (DOIO_SUCCESS);
+}
+#endif
+
 /*
  * Kill.
  *
@@ -2134,6 +2454,7 @@ doio_send(isc__socket_t *sock, isc_socketevent_t *dev) {
  */
 static void
 closesocket(isc__socketmgr_t *manager, isc__socket_t *sock, int fd) {
+	isc__socketthread_t *thread;
 	isc_sockettype_t type = sock->type;
 	int lockid = FDLOCK_ID(fd);
 
@@ -2158,8 +2479,9 @@ closesocket(isc__socketmgr_t *manager, isc__socket_t *sock, int fd) {
 		 * solve this would be to dup() the watched descriptor, but we
 		 * take a simpler approach at this moment.
 		 */
-		(void)unwatch_fd(manager, fd, SELECT_POKE_READ);
-		(void)unwatch_fd(manager, fd, SELECT_POKE_WRITE);
+		thread = &manager->threads[FDTHREAD(manager, fd)];
+		(void)unwatch_fd(thread, fd, SELECT_POKE_READ);
+		(void)unwatch_fd(thread, fd, SELECT_POKE_WRITE);
 	} else
 		select_poke(manager, fd, SELECT_POKE_CLOSE);
 
@@ -2191,8 +2513,8 @@ closesocket(isc__socketmgr_t *manager, isc__socket_t *sock, int fd) {
 			UNLOCK(&manager->fdlock[lockid]);
 		}
 #ifdef ISC_PLATFORM_USETHREADS
-		if (manager->maxfd < manager->pipe_fds[0])
-			manager->maxfd = manager->pipe_fds[0];
+		if (manager->maxfd < manager->threads[0].pipe_fds[0])
+			manager->maxfd = manager->threads[0].pipe_fds[0];
 #endif
 	}
 
@@ -2264,6 +2586,10 @@ allocate_socket(isc__socketmgr_t *manager, isc_sockettype_t type,
 
 	sock->recvcmsgbuf = NULL;
 	sock->sendcmsgbuf = NULL;
+#if defined(USE_RECVMMSG) || defined(USE_SENDMMSG)
+	sock->batchcmsgbuf = NULL;
+	sock->batchcmsgbuflen = 0;
+#endif
 
 	/*
 	 * Set up cmsg buffers.
@@ -2394,6 +2720,11 @@ free_socket(isc__socket_t **socketp) {
 	if (sock->sendcmsgbuf != NULL)
 		isc_mem_put(sock->manager->mctx, sock->sendcmsgbuf,
 			    sock->sendcmsgbuflen);
+#if defined(USE_RECVMMSG) || defined(USE_SENDMMSG)
+	if (sock->batchcmsgbuf != NULL)
+		isc_mem_put(sock->manager->mctx, sock->batchcmsgbuf,
+			    sock->batchcmsgbuflen);
+#endif
 
 	sock->common.magic = 0;
 	sock->common.impmagic = 0;
@@ -3652,6 +3983,22 @@ internal_recv(isc_task_t *me, isc_event_t *ev) {
 	 */
 	dev = ISC_LIST_HEAD(sock->recv_list);
 	while (dev != NULL) {
+#ifdef USE_RECVMMSG
+		/*
+		 * Several UDP reads are waiting, fill them all at once.
+		 */
+		if (sock->type == isc_sockettype_udp &&
+		    ISC_LIST_NEXT(dev, ev_link) != NULL)
+		{
+			switch (doio_recvbatch(sock)) {
+			case DOIO_SOFT:
+				goto poke;
+			case DOIO_SUCCESS:
+				dev = ISC_LIST_HEAD(sock->recv_list);
+				continue;
+			}
+		}
+#endif
 		switch (doio_recv(sock, dev)) {
 		case DOIO_SOFT:
 			goto poke;
@@ -3720,6 +4067,22 @@ internal_send(isc_task_t *me, isc_event_t *ev) {
 	 */
 	dev = ISC_LIST_HEAD(sock->send_list);
 	while (dev != NULL) {
+#ifdef USE_SENDMMSG
+		/*
+		 * Several UDP writes are waiting, send them all at once.
+		 */
+		if (sock->type == isc_sockettype_udp &&
+		    ISC_LIST_NEXT(dev, ev_link) != NULL)
+		{
+			switch (doio_sendbatch(sock)) {
+			case DOIO_SOFT:
+				goto poke;
+			case DOIO_SUCCESS:
+				dev = ISC_LIST_HEAD(sock->send_list);
+				continue;
+			}
+		}
+#endif
 		switch (doio_send(sock, dev)) {
 		case DOIO_SOFT:
 			goto poke;
@@ -3827,9 +4190,10 @@ internal_fdwatch_read(isc_task_t *me, isc_event_t *ev) {
  * and unlocking twice if both reads and writes are possible.
  */
 static void
-process_fd(isc__socketmgr_t *manager, int fd, isc_boolean_t readable,
+process_fd(isc__socketthread_t *thread, int fd, isc_boolean_t readable,
 	   isc_boolean_t writeable)
 {
+	isc__socketmgr_t *manager = thread->manager;
 	isc__socket_t *sock;
 	isc_boolean_t unlock_sock;
 	isc_boolean_t unwatch_read = ISC_FALSE, unwatch_write = ISC_FALSE;
@@ -3842,8 +4206,8 @@ process_fd(isc__socketmgr_t *manager, int fd, isc_boolean_t readable,
 	if (manager->fdstate[fd] == CLOSE_PENDING) {
 		UNLOCK(&manager->fdlock[lockid]);
 
-		(void)unwatch_fd(manager, fd, SELECT_POKE_READ);
-		(void)unwatch_fd(manager, fd, SELECT_POKE_WRITE);
+		(void)unwatch_fd(thread, fd, SELECT_POKE_READ);
+		(void)unwatch_fd(thread, fd, SELECT_POKE_WRITE);
 		return;
 	}
 
@@ -3888,15 +4252,17 @@ check_write:
  unlock_fd:
 	UNLOCK(&manager->fdlock[lockid]);
 	if (unwatch_read)
-		(void)unwatch_fd(manager, fd, SELECT_POKE_READ);
+		(void)unwatch_fd(thread, fd, SELECT_POKE_READ);
 	if (unwatch_write)
-		(void)unwatch_fd(manager, fd, SELECT_POKE_WRITE);
+		(void)unwatch_fd(thread, fd, SELECT_POKE_WRITE);
 
 }
 
 #ifdef USE_KQUEUE
 static isc_boolean_t
-process_fds(isc__socketmgr_t *manager, struct kevent *events, int nevents) {
+process_fds(isc__socketthread_t *thread, struct kevent *events,
+	    int nevents)
+{
 	int i;
 	isc_boolean_t readable, writable;
 	isc_boolean_t done = ISC_FALSE;
@@ -3904,41 +4270,42 @@ process_fds(isc__socketmgr_t *manager, struct kevent *events, int nevents) {
 	isc_boolean_t have_ctlevent = ISC_FALSE;
 #endif
 
-	if (nevents == manager->nevents) {
+	if (nevents == thread->nevents) {
 		/*
 		 * This is not an error, but something unexpected.  If this
 		 * happens, it may indicate the need for increasing
 		 * ISC_SOCKET_MAXEVENTS.
 		 */
-		manager_log(manager, ISC_LOGCATEGORY_GENERAL,
+		manager_log(thread->manager, ISC_LOGCATEGORY_GENERAL,
 			    ISC_LOGMODULE_SOCKET, ISC_LOG_INFO,
 			    "maximum number of FD events (%d) received",
 			    nevents);
 	}
 
 	for (i = 0; i < nevents; i++) {
-		REQUIRE(events[i].ident < manager->maxsocks);
+		REQUIRE(events[i].ident < thread->manager->maxsocks);
 #ifdef USE_WATCHER_THREAD
-		if (events[i].ident == (uintptr_t)manager->pipe_fds[0]) {
+		if (events[i].ident == (uintptr_t)thread->pipe_fds[0]) {
 			have_ctlevent = ISC_TRUE;
 			continue;
 		}
 #endif
 		readable = ISC_TF(events[i].filter == EVFILT_READ);
 		writable = ISC_TF(events[i].filter == EVFILT_WRITE);
-		process_fd(manager, events[i].ident, readable, writable);
+		process_fd(thread, events[i].ident, readable, writable);
 	}
 
 #ifdef USE_WATCHER_THREAD
 	if (have_ctlevent)
-		done = process_ctlfd(manager);
+		done = process_ctlfd(thread);
 #endif
 
 	return (done);
 }
 #elif defined(USE_EPOLL)
 static isc_boolean_t
-process_fds(isc__socketmgr_t *manager, struct epoll_event *events, int nevents)
+process_fds(isc__socketthread_t *thread, struct epoll_event *events,
+	    int nevents)
 {
 	int i;
 	isc_boolean_t done = ISC_FALSE;
@@ -3946,17 +4313,17 @@ process_fds(isc__socketmgr_t *manager, struct epoll_event *events, int nevents)
 	isc_boolean_t have_ctlevent = ISC_FALSE;
 #endif
 
-	if (nevents == manager->nevents) {
-		manager_log(manager, ISC_LOGCATEGORY_GENERAL,
+	if (nevents == thread->nevents) {
+		manager_log(thread->manager, ISC_LOGCATEGORY_GENERAL,
 			    ISC_LOGMODULE_SOCKET, ISC_LOG_INFO,
 			    "maximum number of FD events (%d) received",
 			    nevents);
 	}
 
 	for (i = 0; i < nevents; i++) {
-		REQUIRE(events[i].data.fd < (int)manager->maxsocks);
+		REQUIRE(events[i].data.fd < (int)thread->manager->maxsocks);
 #ifdef USE_WATCHER_THREAD
-		if (events[i].data.fd == manager->pipe_fds[0]) {
+		if (events[i].data.fd == thread->pipe_fds[0]) {
 			have_ctlevent = ISC_TRUE;
 			continue;
 		}
@@ -3972,69 +4339,71 @@ process_fds(isc__socketmgr_t *manager, struct epoll_event *events, int nevents)
 			 */
 			events[i].events |= (EPOLLIN | EPOLLOUT);
 		}
-		process_fd(manager, events[i].data.fd,
+		process_fd(thread, events[i].data.fd,
 			   (events[i].events & EPOLLIN) != 0,
 			   (events[i].events & EPOLLOUT) != 0);
 	}
 
 #ifdef USE_WATCHER_THREAD
 	if (have_ctlevent)
-		done = process_ctlfd(manager);
+		done = process_ctlfd(thread);
 #endif
 
 	return (done);
 }
 #elif defined(USE_DEVPOLL)
 static isc_boolean_t
-process_fds(isc__socketmgr_t *manager, struct pollfd *events, int nevents) {
+process_fds(isc__socketthread_t *thread, struct pollfd *events,
+	    int nevents)
+{
 	int i;
 	isc_boolean_t done = ISC_FALSE;
 #ifdef USE_WATCHER_THREAD
 	isc_boolean_t have_ctlevent = ISC_FALSE;
 #endif
 
-	if (nevents == manager->nevents) {
-		manager_log(manager, ISC_LOGCATEGORY_GENERAL,
+	if (nevents == thread->nevents) {
+		manager_log(thread->manager, ISC_LOGCATEGORY_GENERAL,
 			    ISC_LOGMODULE_SOCKET, ISC_LOG_INFO,
 			    "maximum number of FD events (%d) received",
 			    nevents);
 	}
 
 	for (i = 0; i < nevents; i++) {
-		REQUIRE(events[i].fd < (int)manager->maxsocks);
+		REQUIRE(events[i].fd < (int)thread->manager->maxsocks);
 #ifdef USE_WATCHER_THREAD
-		if (events[i].fd == manager->pipe_fds[0]) {
+		if (events[i].fd == thread->pipe_fds[0]) {
 			have_ctlevent = ISC_TRUE;
 			continue;
 		}
 #endif
-		process_fd(manager, events[i].fd,
+		process_fd(thread, events[i].fd,
 			   (events[i].events & POLLIN) != 0,
 			   (events[i].events & POLLOUT) != 0);
 	}
 
 #ifdef USE_WATCHER_THREAD
 	if (have_ctlevent)
-		done = process_ctlfd(manager);
+		done = process_ctlfd(thread);
 #endif
 
 	return (done);
 }
 #elif defined(USE_SELECT)
 static void
-process_fds(isc__socketmgr_t *manager, int maxfd, fd_set *readfds,
+process_fds(isc__socketthread_t *thread, int maxfd, fd_set *readfds,
 	    fd_set *writefds)
 {
 	int i;
 
-	REQUIRE(maxfd <= (int)manager->maxsocks);
+	REQUIRE(maxfd <= (int)thread->manager->maxsocks);
 
 	for (i = 0; i < maxfd; i++) {
 #ifdef USE_WATCHER_THREAD
-		if (i == manager->pipe_fds[0] || i == manager->pipe_fds[1])
+		if (i == thread->pipe_fds[0] || i == thread->pipe_fds[1])
 			continue;
 #endif /* USE_WATCHER_THREAD */
-		process_fd(manager, i, FD_ISSET(i, readfds),
+		process_fd(thread, i, FD_ISSET(i, readfds),
 			   FD_ISSET(i, writefds));
 	}
 }
@@ -4042,13 +4411,13 @@ process_fds(isc__socketmgr_t *manager, int maxfd, fd_set *readfds,
 
 #ifdef USE_WATCHER_THREAD
 static isc_boolean_t
-process_ctlfd(isc__socketmgr_t *manager) {
+process_ctlfd(isc__socketthread_t *thread) {
 	int msg, fd;
 
 	for (;;) {
-		select_readmsg(manager, &fd, &msg);
+		select_readmsg(thread, &fd, &msg);
 
-		manager_log(manager, IOEVENT,
+		manager_log(thread->manager, IOEVENT,
 			    isc_msgcat_get(isc_msgcat, ISC_MSGSET_SOCKET,
 					   ISC_MSG_WATCHERMSG,
 					   "watcher got message %d "
@@ -4075,7 +4444,7 @@ process_ctlfd(isc__socketmgr_t *manager) {
 		 * and decide if we need to watch on it now
 		 * or not.
 		 */
-		wakeup_socket(manager, fd, msg);
+		wakeup_socket(thread, fd, msg);
 	}
 
 	return (ISC_FALSE);
@@ -4083,14 +4452,15 @@ process_ctlfd(isc__socketmgr_t *manager) {
 
 /*
  * This is the thread that will loop forever, always in a select or poll
- * call.
+ * call.  There is one of them for each watcher of the manager.
  *
  * When select returns something to do, track down what thread gets to do
  * this I/O and post the event to it.
  */
 static isc_threadresult_t
 watcher(void *uap) {
-	isc__socketmgr_t *manager = uap;
+	isc__socketthread_t *thread = uap;
+	isc__socketmgr_t *manager = thread->manager;
 	isc_boolean_t done;
 	int cc;
 #ifdef USE_KQUEUE
@@ -4114,20 +4484,20 @@ watcher(void *uap) {
 	/*
 	 * Get the control fd here.  This will never change.
 	 */
-	ctlfd = manager->pipe_fds[0];
+	ctlfd = thread->pipe_fds[0];
 #endif
 	done = ISC_FALSE;
 	while (!done) {
 		do {
 #ifdef USE_KQUEUE
-			cc = kevent(manager->kqueue_fd, NULL, 0,
-				    manager->events, manager->nevents, NULL);
+			cc = kevent(thread->kqueue_fd, NULL, 0,
+				    thread->events, thread->nevents, NULL);
 #elif defined(USE_EPOLL)
-			cc = epoll_wait(manager->epoll_fd, manager->events,
-					manager->nevents, -1);
+			cc = epoll_wait(thread->epoll_fd, thread->events,
+					thread->nevents, -1);
 #elif defined(USE_DEVPOLL)
-			dvp.dp_fds = manager->events;
-			dvp.dp_nfds = manager->nevents;
+			dvp.dp_fds = thread->events;
+			dvp.dp_nfds = thread->nevents;
 #ifndef ISC_SOCKET_USE_POLLWATCH
 			dvp.dp_timeout = -1;
 #else
@@ -4136,7 +4506,7 @@ watcher(void *uap) {
 			else
 				dvp.dp_timeout = ISC_SOCKET_POLLWATCH_TIMEOUT;
 #endif	/* ISC_SOCKET_USE_POLLWATCH */
-			cc = ioctl(manager->devpoll_fd, DP_POLL, &dvp);
+			cc = ioctl(thread->devpoll_fd, DP_POLL, &dvp);
 #elif defined(USE_SELECT)
 			LOCK(&manager->lock);
 			memmove(manager->read_fds_copy, manager->read_fds,
@@ -4188,16 +4558,16 @@ watcher(void *uap) {
 		} while (cc < 0);
 
 #if defined(USE_KQUEUE) || defined (USE_EPOLL) || defined (USE_DEVPOLL)
-		done = process_fds(manager, manager->events, cc);
+		done = process_fds(thread, thread->events, cc);
 #elif defined(USE_SELECT)
-		process_fds(manager, maxfd, manager->read_fds_copy,
+		process_fds(thread, maxfd, manager->read_fds_copy,
 			    manager->write_fds_copy);
 
 		/*
 		 * Process reads on internal, control fd.
 		 */
 		if (FD_ISSET(ctlfd, manager->read_fds_copy))
-			done = process_ctlfd(manager);
+			done = process_ctlfd(thread);
 #endif
 	}
 
@@ -4227,25 +4597,75 @@ isc__socketmgr_maxudp(isc_socketmgr_t *manager0, int maxudp) {
 	manager->maxudp = maxudp;
 }
 
+isc_result_t
+isc_socketmgr_setaffinity(isc_socketmgr_t *manager0, const int *cpus,
+			  unsigned int ncpus)
+{
+	isc__socketmgr_t *manager = (isc__socketmgr_t *)manager0;
+#ifdef USE_WATCHER_THREAD
+	isc_result_t result = ISC_R_SUCCESS;
+	int i;
+#endif
+
+	REQUIRE(VALID_MANAGER(manager));
+	REQUIRE(cpus != NULL || ncpus == 0);
+
+#ifdef USE_WATCHER_THREAD
+	for (i = 0; i < manager->nthreads && result == ISC_R_SUCCESS; i++)
+		result = isc_thread_setaffinity(manager->threads[i].thread,
+						ncpus == 0 ? -1 :
+						cpus[i % ncpus]);
+	return (result);
+#else
+	UNUSED(cpus);
+	UNUSED(ncpus);
+	return (ISC_R_NOTIMPLEMENTED);
+#endif /* USE_WATCHER_THREAD */
+}
+
 /*
  * Create a new socket manager.
  */
 
 static isc_result_t
-setup_watcher(isc_mem_t *mctx, isc__socketmgr_t *manager) {
+setup_thread(isc_mem_t *mctx, isc__socketthread_t *thread) {
 	isc_result_t result;
-#if defined(USE_KQUEUE) || defined(USE_EPOLL) || defined(USE_DEVPOLL)
+#if defined(USE_KQUEUE) || defined(USE_EPOLL) || defined(USE_DEVPOLL) || \
+    defined(USE_WATCHER_THREAD)
 	char strbuf[ISC_STRERRORSIZE];
 #endif
 
+#ifdef USE_WATCHER_THREAD
+	/*
+	 * Create the special fds that will be used to wake up the
+	 * select/poll loop when something internal needs to be done.
+	 */
+	if (pipe(thread->pipe_fds) != 0) {
+		isc__strerror(errno, strbuf, sizeof(strbuf));
+		UNEXPECTED_ERROR(__FILE__, __LINE__,
+				 "pipe() %s: %s",
+				 isc_msgcat_get(isc_msgcat, ISC_MSGSET_GENERAL,
+						ISC_MSG_FAILED, "failed"),
+				 strbuf);
+		return (ISC_R_UNEXPECTED);
+	}
+
+	RUNTIME_CHECK(make_nonblock(thread->pipe_fds[0]) == ISC_R_SUCCESS);
+#if 0
+	RUNTIME_CHECK(make_nonblock(thread->pipe_fds[1]) == ISC_R_SUCCESS);
+#endif
+#endif	/* USE_WATCHER_THREAD */
+
 #ifdef USE_KQUEUE
-	manager->nevents = ISC_SOCKET_MAXEVENTS;
-	manager->events = isc_mem_get(mctx, sizeof(struct kevent) *
-				      manager->nevents);
-	if (manager->events == NULL)
-		return (ISC_R_NOMEMORY);
-	manager->kqueue_fd = kqueue();
-	if (manager->kqueue_fd == -1) {
+	thread->nevents = ISC_SOCKET_MAXEVENTS;
+	thread->events = isc_mem_get(mctx, sizeof(struct kevent) *
+				     thread->nevents);
+	if (thread->events == NULL) {
+		result = ISC_R_NOMEMORY;
+		goto close_pipe;
+	}
+	thread->kqueue_fd = kqueue();
+	if (thread->kqueue_fd == -1) {
 		result = isc__errno2result(errno);
 		isc__strerror(errno, strbuf, sizeof(strbuf));
 		UNEXPECTED_ERROR(__FILE__, __LINE__,
@@ -4253,28 +4673,32 @@ setup_watcher(isc_mem_t *mctx, isc__socketmgr_t *manager) {
 				 isc_msgcat_get(isc_msgcat, ISC_MSGSET_GENERAL,
 						ISC_MSG_FAILED, "failed"),
 				 strbuf);
-		isc_mem_put(mctx, manager->events,
-			    sizeof(struct kevent) * manager->nevents);
-		return (result);
+		goto free_events;
 	}
 
 #ifdef USE_WATCHER_THREAD
-	result = watch_fd(manager, manager->pipe_fds[0], SELECT_POKE_READ);
+	result = watch_fd(thread, thread->pipe_fds[0], SELECT_POKE_READ);
 	if (result != ISC_R_SUCCESS) {
-		close(manager->kqueue_fd);
-		isc_mem_put(mctx, manager->events,
-			    sizeof(struct kevent) * manager->nevents);
-		return (result);
+		close(thread->kqueue_fd);
+		goto free_events;
 	}
 #endif	/* USE_WATCHER_THREAD */
+
+	return (ISC_R_SUCCESS);
+
+ free_events:
+	isc_mem_put(mctx, thread->events,
+		    sizeof(struct kevent) * thread->nevents);
 #elif defined(USE_EPOLL)
-	manager->nevents = ISC_SOCKET_MAXEVENTS;
-	manager->events = isc_mem_get(mctx, sizeof(struct epoll_event) *
-				      manager->nevents);
-	if (manager->events == NULL)
-		return (ISC_R_NOMEMORY);
-	manager->epoll_fd = epoll_create(manager->nevents);
-	if (manager->epoll_fd == -1) {
+	thread->nevents = ISC_SOCKET_MAXEVENTS;
+	thread->events = isc_mem_get(mctx, sizeof(struct epoll_event) *
+				     thread->nevents);
+	if (thread->events == NULL) {
+		result = ISC_R_NOMEMORY;
+		goto close_pipe;
+	}
+	thread->epoll_fd = epoll_create(thread->nevents);
+	if (thread->epoll_fd == -1) {
 		result = isc__errno2result(errno);
 		isc__strerror(errno, strbuf, sizeof(strbuf));
 		UNEXPECTED_ERROR(__FILE__, __LINE__,
@@ -4282,43 +4706,35 @@ setup_watcher(isc_mem_t *mctx, isc__socketmgr_t *manager) {
 				 isc_msgcat_get(isc_msgcat, ISC_MSGSET_GENERAL,
 						ISC_MSG_FAILED, "failed"),
 				 strbuf);
-		isc_mem_put(mctx, manager->events,
-			    sizeof(struct epoll_event) * manager->nevents);
-		return (result);
+		goto free_events;
 	}
 #ifdef USE_WATCHER_THREAD
-	result = watch_fd(manager, manager->pipe_fds[0], SELECT_POKE_READ);
+	result = watch_fd(thread, thread->pipe_fds[0], SELECT_POKE_READ);
 	if (result != ISC_R_SUCCESS) {
-		close(manager->epoll_fd);
-		isc_mem_put(mctx, manager->events,
-			    sizeof(struct epoll_event) * manager->nevents);
-		return (result);
+		close(thread->epoll_fd);
+		goto free_events;
 	}
 #endif	/* USE_WATCHER_THREAD */
+
+	return (ISC_R_SUCCESS);
+
+ free_events:
+	isc_mem_put(mctx, thread->events,
+		    sizeof(struct epoll_event) * thread->nevents);
 #elif defined(USE_DEVPOLL)
 	/*
 	 * XXXJT: /dev/poll seems to reject large numbers of events,
 	 * so we should be careful about redefining ISC_SOCKET_MAXEVENTS.
 	 */
-	manager->nevents = ISC_SOCKET_MAXEVENTS;
-	manager->events = isc_mem_get(mctx, sizeof(struct pollfd) *
-				      manager->nevents);
-	if (manager->events == NULL)
-		return (ISC_R_NOMEMORY);
-	/*
-	 * Note: fdpollinfo should be able to support all possible FDs, so
-	 * it must have maxsocks entries (not nevents).
-	 */
-	manager->fdpollinfo = isc_mem_get(mctx, sizeof(pollinfo_t) *
-					  manager->maxsocks);
-	if (manager->fdpollinfo == NULL) {
-		isc_mem_put(mctx, manager->events,
-			    sizeof(struct pollfd) * manager->nevents);
-		return (ISC_R_NOMEMORY);
+	thread->nevents = ISC_SOCKET_MAXEVENTS;
+	thread->events = isc_mem_get(mctx, sizeof(struct pollfd) *
+				     thread->nevents);
+	if (thread->events == NULL) {
+		result = ISC_R_NOMEMORY;
+		goto close_pipe;
 	}
-	memset(manager->fdpollinfo, 0, sizeof(pollinfo_t) * manager->maxsocks);
-	manager->devpoll_fd = open("/dev/poll", O_RDWR);
-	if (manager->devpoll_fd == -1) {
+	thread->devpoll_fd = open("/dev/poll", O_RDWR);
+	if (thread->devpoll_fd == -1) {
 		result = isc__errno2result(errno);
 		isc__strerror(errno, strbuf, sizeof(strbuf));
 		UNEXPECTED_ERROR(__FILE__, __LINE__,
@@ -4326,26 +4742,118 @@ setup_watcher(isc_mem_t *mctx, isc__socketmgr_t *manager) {
 				 isc_msgcat_get(isc_msgcat, ISC_MSGSET_GENERAL,
 						ISC_MSG_FAILED, "failed"),
 				 strbuf);
-		isc_mem_put(mctx, manager->events,
-			    sizeof(struct pollfd) * manager->nevents);
-		isc_mem_put(mctx, manager->fdpollinfo,
-			    sizeof(pollinfo_t) * manager->maxsocks);
-		return (result);
+		goto free_events;
 	}
 #ifdef USE_WATCHER_THREAD
-	result = watch_fd(manager, manager->pipe_fds[0], SELECT_POKE_READ);
+	result = watch_fd(thread, thread->pipe_fds[0], SELECT_POKE_READ);
 	if (result != ISC_R_SUCCESS) {
-		close(manager->devpoll_fd);
-		isc_mem_put(mctx, manager->events,
-			    sizeof(struct pollfd) * manager->nevents);
-		isc_mem_put(mctx, manager->fdpollinfo,
-			    sizeof(pollinfo_t) * manager->maxsocks);
-		return (result);
+		close(thread->devpoll_fd);
+		goto free_events;
 	}
 #endif	/* USE_WATCHER_THREAD */
+
+	return (ISC_R_SUCCESS);
+
+ free_events:
+	isc_mem_put(mctx, thread->events,
+		    sizeof(struct pollfd) * thread->nevents);
 #elif defined(USE_SELECT)
+	UNUSED(mctx);
 	UNUSED(result);
 
+#ifdef USE_WATCHER_THREAD
+	(void)watch_fd(thread, thread->pipe_fds[0], SELECT_POKE_READ);
+	thread->manager->maxfd = thread->pipe_fds[0];
+#else /* USE_WATCHER_THREAD */
+	UNUSED(thread);
+#endif /* USE_WATCHER_THREAD */
+
+	return (ISC_R_SUCCESS);
+#endif	/* USE_KQUEUE */
+
+#if defined(USE_KQUEUE) || defined(USE_EPOLL) || defined(USE_DEVPOLL)
+ close_pipe:
+#ifdef USE_WATCHER_THREAD
+	(void)close(thread->pipe_fds[0]);
+	(void)close(thread->pipe_fds[1]);
+#endif	/* USE_WATCHER_THREAD */
+	return (result);
+#endif
+}
+
+static void
+cleanup_thread(isc_mem_t *mctx, isc__socketthread_t *thread) {
+#ifdef USE_WATCHER_THREAD
+	isc_result_t result;
+
+	result = unwatch_fd(thread, thread->pipe_fds[0], SELECT_POKE_READ);
+	if (result != ISC_R_SUCCESS) {
+		UNEXPECTED_ERROR(__FILE__, __LINE__,
+				 "epoll_ctl(DEL) %s",
+				 isc_msgcat_get(isc_msgcat, ISC_MSGSET_GENERAL,
+						ISC_MSG_FAILED, "failed"));
+	}
+#endif	/* USE_WATCHER_THREAD */
+
+#ifdef USE_KQUEUE
+	close(thread->kqueue_fd);
+	isc_mem_put(mctx, thread->events,
+		    sizeof(struct kevent) * thread->nevents);
+#elif defined(USE_EPOLL)
+	close(thread->epoll_fd);
+	isc_mem_put(mctx, thread->events,
+		    sizeof(struct epoll_event) * thread->nevents);
+#elif defined(USE_DEVPOLL)
+	close(thread->devpoll_fd);
+	isc_mem_put(mctx, thread->events,
+		    sizeof(struct pollfd) * thread->nevents);
+#elif defined(USE_SELECT)
+	UNUSED(mctx);
+	UNUSED(thread);
+#endif	/* USE_KQUEUE */
+
+#ifdef USE_WATCHER_THREAD
+	(void)close(thread->pipe_fds[0]);
+	(void)close(thread->pipe_fds[1]);
+#endif	/* USE_WATCHER_THREAD */
+}
+
+static void
+free_pollstate(isc_mem_t *mctx, isc__socketmgr_t *manager) {
+#ifdef USE_DEVPOLL
+	isc_mem_put(mctx, manager->fdpollinfo,
+		    sizeof(pollinfo_t) * manager->maxsocks);
+#elif defined(USE_SELECT)
+	if (manager->read_fds != NULL)
+		isc_mem_put(mctx, manager->read_fds, manager->fd_bufsize);
+	if (manager->read_fds_copy != NULL)
+		isc_mem_put(mctx, manager->read_fds_copy, manager->fd_bufsize);
+	if (manager->write_fds != NULL)
+		isc_mem_put(mctx, manager->write_fds, manager->fd_bufsize);
+	if (manager->write_fds_copy != NULL)
+		isc_mem_put(mctx, manager->write_fds_copy, manager->fd_bufsize);
+#else
+	UNUSED(mctx);
+	UNUSED(manager);
+#endif
+}
+
+static isc_result_t
+setup_watcher(isc_mem_t *mctx, isc__socketmgr_t *manager) {
+	isc_result_t result;
+	int i;
+
+#ifdef USE_DEVPOLL
+	/*
+	 * Note: fdpollinfo should be able to support all possible FDs, so
+	 * it must have maxsocks entries (not nevents).
+	 */
+	manager->fdpollinfo = isc_mem_get(mctx, sizeof(pollinfo_t) *
+					  manager->maxsocks);
+	if (manager->fdpollinfo == NULL)
+		return (ISC_R_NOMEMORY);
+	memset(manager->fdpollinfo, 0, sizeof(pollinfo_t) * manager->maxsocks);
+#elif defined(USE_SELECT)
 #if ISC_SOCKET_MAXSOCKETS > FD_SETSIZE
 	/*
 	 * Note: this code should also cover the case of MAXSOCKETS <=
@@ -4373,88 +4881,49 @@ setup_watcher(isc_mem_t *mctx, isc__socketmgr_t *manager) {
 						      manager->fd_bufsize);
 	}
 	if (manager->write_fds_copy == NULL) {
-		if (manager->write_fds != NULL) {
-			isc_mem_put(mctx, manager->write_fds,
-				    manager->fd_bufsize);
-		}
-		if (manager->read_fds_copy != NULL) {
-			isc_mem_put(mctx, manager->read_fds_copy,
-				    manager->fd_bufsize);
-		}
-		if (manager->read_fds != NULL) {
-			isc_mem_put(mctx, manager->read_fds,
-				    manager->fd_bufsize);
-		}
+		free_pollstate(mctx, manager);
 		return (ISC_R_NOMEMORY);
 	}
 	memset(manager->read_fds, 0, manager->fd_bufsize);
 	memset(manager->write_fds, 0, manager->fd_bufsize);
-
-#ifdef USE_WATCHER_THREAD
-	(void)watch_fd(manager, manager->pipe_fds[0], SELECT_POKE_READ);
-	manager->maxfd = manager->pipe_fds[0];
-#else /* USE_WATCHER_THREAD */
 	manager->maxfd = 0;
-#endif /* USE_WATCHER_THREAD */
-#endif	/* USE_KQUEUE */
+#endif	/* USE_DEVPOLL */
+
+	for (i = 0; i < manager->nthreads; i++) {
+		manager->threads[i].manager = manager;
+		manager->threads[i].threadid = i;
+		result = setup_thread(mctx, &manager->threads[i]);
+		if (result != ISC_R_SUCCESS) {
+			while (--i >= 0)
+				cleanup_thread(mctx, &manager->threads[i]);
+			free_pollstate(mctx, manager);
+			return (result);
+		}
+	}
 
 	return (ISC_R_SUCCESS);
 }
 
 static void
 cleanup_watcher(isc_mem_t *mctx, isc__socketmgr_t *manager) {
-#ifdef USE_WATCHER_THREAD
-	isc_result_t result;
-
-	result = unwatch_fd(manager, manager->pipe_fds[0], SELECT_POKE_READ);
-	if (result != ISC_R_SUCCESS) {
-		UNEXPECTED_ERROR(__FILE__, __LINE__,
-				 "epoll_ctl(DEL) %s",
-				 isc_msgcat_get(isc_msgcat, ISC_MSGSET_GENERAL,
-						ISC_MSG_FAILED, "failed"));
-	}
-#endif	/* USE_WATCHER_THREAD */
+	int i;
 
-#ifdef USE_KQUEUE
-	close(manager->kqueue_fd);
-	isc_mem_put(mctx, manager->events,
-		    sizeof(struct kevent) * manager->nevents);
-#elif defined(USE_EPOLL)
-	close(manager->epoll_fd);
-	isc_mem_put(mctx, manager->events,
-		    sizeof(struct epoll_event) * manager->nevents);
-#elif defined(USE_DEVPOLL)
-	close(manager->devpoll_fd);
-	isc_mem_put(mctx, manager->events,
-		    sizeof(struct pollfd) * manager->nevents);
-	isc_mem_put(mctx, manager->fdpollinfo,
-		    sizeof(pollinfo_t) * manager->maxsocks);
-#elif defined(USE_SELECT)
-	if (manager->read_fds != NULL)
-		isc_mem_put(mctx, manager->read_fds, manager->fd_bufsize);
-	if (manager->read_fds_copy != NULL)
-		isc_mem_put(mctx, manager->read_fds_copy, manager->fd_bufsize);
-	if (manager->write_fds != NULL)
-		isc_mem_put(mctx, manager->write_fds, manager->fd_bufsize);
-	if (manager->write_fds_copy != NULL)
-		isc_mem_put(mctx, manager->write_fds_copy, manager->fd_bufsize);
-#endif	/* USE_KQUEUE */
+	for (i = 0; i < manager->nthreads; i++)
+		cleanup_thread(mctx, &manager->threads[i]);
+	free_pollstate(mctx, manager);
 }
 
 isc_result_t
 isc__socketmgr_create(isc_mem_t *mctx, isc_socketmgr_t **managerp) {
-	return (isc__socketmgr_create2(mctx, managerp, 0));
+	return (isc__socketmgr_create2(mctx, managerp, 0, 1));
 }
 
 isc_result_t
 isc__socketmgr_create2(isc_mem_t *mctx, isc_socketmgr_t **managerp,
-		       unsigned int maxsocks)
+		       unsigned int maxsocks, unsigned int nthreads)
 {
 	int i;
 	isc__socketmgr_t *manager;
-#ifdef USE_WATCHER_THREAD
-	char strbuf[ISC_STRERRORSIZE];
-#endif
 	isc_result_t result;
 
 	REQUIRE(managerp != NULL && *managerp == NULL);
@@ -4473,6 +4942,15 @@ isc__socketmgr_create2(isc_mem_t *mctx, isc_socketmgr_t **managerp,
 
 	if (maxsocks == 0)
 		maxsocks = ISC_SOCKET_MAXSOCKETS;
+#if defined(USE_WATCHER_THREAD) && !defined(USE_SELECT)
+	if (nthreads == 0)
+		nthreads = 1;
+#else
+	/*
+	 * select() has to scan every FD, so it is never split.
+	 */
+	nthreads = 1;
+#endif
 
 	manager = isc_mem_get(mctx, sizeof(*manager));
 	if (manager == NULL)
@@ -4494,6 +4972,14 @@ isc__socketmgr_create2(isc_mem_t *mctx, isc_socketmgr_t **managerp,
 		result = ISC_R_NOMEMORY;
 		goto free_manager;
 	}
+	manager->threads = isc_mem_get(mctx,
+				       nthreads * sizeof(isc__socketthread_t));
+	if (manager->threads == NULL) {
+		result = ISC_R_NOMEMORY;
+		goto free_manager;
+	}
+	memset(manager->threads, 0, nthreads * sizeof(isc__socketthread_t));
+	manager->nthreads = nthreads;
 	manager->stats = NULL;
 
 	manager->common.methods = &socketmgrmethods;
@@ -4531,26 +5017,6 @@ isc__socketmgr_create2(isc_mem_t *mctx, isc_socketmgr_t **managerp,
 		result = ISC_R_UNEXPECTED;
 		goto cleanup_lock;
 	}
-
-	/*
-	 * Create the special fds that will be used to wake up the
-	 * select/poll loop when something internal needs to be done.
-	 */
-	if (pipe(manager->pipe_fds) != 0) {
-		isc__strerror(errno, strbuf, sizeof(strbuf));
-		UNEXPECTED_ERROR(__FILE__, __LINE__,
-				 "pipe() %s: %s",
-				 isc_msgcat_get(isc_msgcat, ISC_MSGSET_GENERAL,
-						ISC_MSG_FAILED, "failed"),
-				 strbuf);
-		result = ISC_R_UNEXPECTED;
-		goto cleanup_condition;
-	}
-
-	RUNTIME_CHECK(make_nonblock(manager->pipe_fds[0]) == ISC_R_SUCCESS);
-#if 0
-	RUNTIME_CHECK(make_nonblock(manager->pipe_fds[1]) == ISC_R_SUCCESS);
-#endif
 #endif	/* USE_WATCHER_THREAD */
 
 #ifdef USE_SHARED_MANAGER
@@ -4566,17 +5032,30 @@ isc__socketmgr_create2(isc_mem_t *mctx, isc_socketmgr_t **managerp,
 	memset(manager->fdstate, 0, manager->maxsocks * sizeof(int));
 #ifdef USE_WATCHER_THREAD
 	/*
-	 * Start up the select/poll thread.
+	 * Start up the select/poll threads.
 	 */
-	if (isc_thread_create(watcher, manager, &manager->watcher) !=
-	    ISC_R_SUCCESS) {
-		UNEXPECTED_ERROR(__FILE__, __LINE__,
-				 "isc_thread_create() %s",
-				 isc_msgcat_get(isc_msgcat, ISC_MSGSET_GENERAL,
-						ISC_MSG_FAILED, "failed"));
-		cleanup_watcher(mctx, manager);
-		result = ISC_R_UNEXPECTED;
-		goto cleanup;
+	for (i = 0; i < manager->nthreads; i++) {
+		if (isc_thread_create(watcher, &manager->threads[i],
+				      &manager->threads[i].thread) !=
+		    ISC_R_SUCCESS) {
+			UNEXPECTED_ERROR(__FILE__, __LINE__,
+					 "isc_thread_create() %s",
+					 isc_msgcat_get(isc_msgcat,
+							ISC_MSGSET_GENERAL,
+							ISC_MSG_FAILED,
+							"failed"));
+			/*
+			 * FD 'i' is watched by thread 'i' here.
+			 */
+			while (--i >= 0) {
+				select_poke(manager, i, SELECT_POKE_SHUTDOWN);
+				(void)isc_thread_join(manager->threads[i].thread,
+						      NULL);
+			}
+			cleanup_watcher(mctx, manager);
+			result = ISC_R_UNEXPECTED;
+			goto cleanup;
+		}
 	}
 #endif /* USE_WATCHER_THREAD */
 	isc_mem_attach(mctx, &manager->mctx);
@@ -4590,12 +5069,6 @@ isc__socketmgr_create2(isc_mem_t *mctx, isc_socketmgr_t **managerp,
 
 cleanup:
 #ifdef USE_WATCHER_THREAD
-	(void)close(manager->pipe_fds[0]);
-	(void)close(manager->pipe_fds[1]);
-#endif	/* USE_WATCHER_THREAD */
-
-#ifdef USE_WATCHER_THREAD
-cleanup_condition:
 	(void)isc_condition_destroy(&manager->shutdown_ok);
 #endif	/* USE_WATCHER_THREAD */
 
@@ -4612,6 +5085,10 @@ free_manager:
 		isc_mem_put(mctx, manager->fdlock,
 			    FDLOCK_COUNT * sizeof(isc_mutex_t));
 	}
+	if (manager->threads != NULL) {
+		isc_mem_put(mctx, manager->threads,
+			    nthreads * sizeof(isc__socketthread_t));
+	}
 	if (manager->fdstate != NULL) {
 		isc_mem_put(mctx, manager->fdstate,
 			    manager->maxsocks * sizeof(int));
@@ -4693,21 +5170,27 @@ isc__socketmgr_destroy(isc_socketmgr_t **managerp) {
 	UNLOCK(&manager->lock);
 
 	/*
-	 * Here, poke our select/poll thread.  Do this by closing the write
-	 * half of the pipe, which will send EOF to the read half.
+	 * Here, poke our select/poll threads.  FD 'i' is watched by
+	 * thread 'i' for every thread.
 	 * This is currently a no-op in the non-threaded case.
 	 */
-	select_poke(manager, 0, SELECT_POKE_SHUTDOWN);
+	for (i = 0; i < manager->nthreads; i++)
+		select_poke(manager, i, SELECT_POKE_SHUTDOWN);
 
 #ifdef USE_WATCHER_THREAD
 	/*
-	 * Wait for thread to exit.
+	 * Wait for the threads to exit.
 	 */
-	if (isc_thread_join(manager->watcher, NULL) != ISC_R_SUCCESS)
-		UNEXPECTED_ERROR(__FILE__, __LINE__,
-				 "isc_thread_join() %s",
-				 isc_msgcat_get(isc_msgcat, ISC_MSGSET_GENERAL,
-						ISC_MSG_FAILED, "failed"));
+	for (i = 0; i < manager->nthreads; i++) {
+		if (isc_thread_join(manager->threads[i].thread, NULL) !=
+		    ISC_R_SUCCESS)
+			UNEXPECTED_ERROR(__FILE__, __LINE__,
+					 "isc_thread_join() %s",
+					 isc_msgcat_get(isc_msgcat,
+							ISC_MSGSET_GENERAL,
+							ISC_MSG_FAILED,
+							"failed"));
+	}
 #endif /* USE_WATCHER_THREAD */
 
 	/*
@@ -4716,8 +5199,6 @@ isc__socketmgr_destroy(isc_socketmgr_t **managerp) {
 	cleanup_watcher(manager->mctx, manager);
 
 #ifdef USE_WATCHER_THREAD
-	(void)close(manager->pipe_fds[0]);
-	(void)close(manager->pipe_fds[1]);
 	(void)isc_condition_destroy(&manager->shutdown_ok);
 #endif /* USE_WATCHER_THREAD */
 
@@ -4729,6 +5210,8 @@ isc__socketmgr_destroy(isc_socketmgr_t **managerp) {
 		    manager->maxsocks * sizeof(isc__socket_t *));
 	isc_mem_put(manager->mctx, manager->fdstate,
 		    manager->maxsocks * sizeof(int));
+	isc_mem_put(manager->mctx, manager->threads,
+		    manager->nthreads * sizeof(isc__socketthread_t));
 
 	if (manager->stats != NULL)
 		isc_stats_detach(&manager->stats);
@@ -4765,6 +5248,21 @@ socket_recv(isc__socket_t *sock, isc_socketevent_t *dev, isc_task_t *task,
 
 	dev->ev_sender = task;
 
+#ifdef USE_RECVMMSG
+	/*
+	 * If other reads are waiting, join them and fill them all at once
+	 * below.
+	 */
+	if (sock->type == isc_sockettype_udp) {
+		LOCK(&sock->lock);
+		have_lock = ISC_TRUE;
+
+		if (ISC_LIST_EMPTY(sock->recv_list))
+			io_state = doio_recv(sock, dev);
+		else
+			io_state = DOIO_SOFT;
+	} else
+#endif
 	if (sock->type == isc_sockettype_udp) {
 		io_state = doio_recv(sock, dev);
 	} else {
@@ -4805,6 +5303,12 @@ socket_recv(isc__socket_t *sock, isc_socketevent_t *dev, isc_task_t *task,
 			   "socket_recv: event %p -> task %p",
 			   dev, ntask);
 
+#ifdef USE_RECVMMSG
+		if (sock->type == isc_sockettype_udp &&
+		    ISC_LIST_HEAD(sock->recv_list) != dev)
+			(void)doio_recvbatch(sock);
+#endif
+
 		if ((flags & ISC_SOCKFLAG_IMMEDIATE) != 0)
 			result = ISC_R_INPROGRESS;
 		break;
@@ -5370,6 +5874,23 @@ isc__socket_bind(isc_socket_t *sock0, isc_sockaddr_t *sockaddr,
 						ISC_MSG_FAILED, "failed"));
 		/* Press on... */
 	}
+	/*
+	 * Unlike SO_REUSEADDR the caller depends on SO_REUSEPORT, so
+	 * report when the system does not have it.
+	 */
+	if ((options & ISC_SOCKET_REUSEPORT) != 0 &&
+	    isc_sockaddr_getport(sockaddr) != (in_port_t)0) {
+#ifdef SO_REUSEPORT
+		if (setsockopt(sock->fd, SOL_SOCKET, SO_REUSEPORT,
+			       (void *)&on, sizeof(on)) < 0) {
+			UNLOCK(&sock->lock);
+			return (ISC_R_NOTIMPLEMENTED);
+		}
+#else
+		UNLOCK(&sock->lock);
+		return (ISC_R_NOTIMPLEMENTED);
+#endif
+	}
 #ifdef AF_UNIX
  bind_socket:
 #endif
@@ -6149,7 +6670,9 @@ isc__socketmgr_waitevents(isc_socketmgr_t *manager0, struct timeval *tvp,
 			  isc_socketwait_t **swaitp)
 {
 	isc__socketmgr_t *manager = (isc__socketmgr_t *)manager0;
-
+#if defined(USE_KQUEUE) || defined(USE_EPOLL) || defined(USE_DEVPOLL)
+	isc__socketthread_t *thread;
+#endif
 
 	int n;
 #ifdef USE_KQUEUE
@@ -6170,6 +6693,9 @@ isc__socketmgr_waitevents(isc_socketmgr_t *manager0, struct timeval *tvp,
 #endif
 	if (manager == NULL)
 		return (0);
+#if defined(USE_KQUEUE) || defined(USE_EPOLL) || defined(USE_DEVPOLL)
+	thread = &manager->threads[0];
+#endif
 
 #ifdef USE_KQUEUE
 	if (tvp != NULL) {
@@ -6178,8 +6704,8 @@ isc__socketmgr_waitevents(isc_socketmgr_t *manager0, struct timeval *tvp,
 		tsp = &ts;
 	} else
 		tsp = NULL;
-	swait_private.nevents = kevent(manager->kqueue_fd, NULL, 0,
-				       manager->events, manager->nevents,
+	swait_private.nevents = kevent(thread->kqueue_fd, NULL, 0,
+				       thread->events, thread->nevents,
 				       tsp);
 	n = swait_private.nevents;
 #elif defined(USE_EPOLL)
@@ -6187,19 +6713,19 @@ isc__socketmgr_waitevents(isc_socketmgr_t *manager0, struct timeval *tvp,
 		timeout = tvp->tv_sec * 1000 + (tvp->tv_usec + 999) / 1000;
 	else
 		timeout = -1;
-	swait_private.nevents = epoll_wait(manager->epoll_fd,
-					   manager->events,
-					   manager->nevents, timeout);
+	swait_private.nevents = epoll_wait(thread->epoll_fd,
+					   thread->events,
+					   thread->nevents, timeout);
 	n = swait_private.nevents;
 #elif defined(USE_DEVPOLL)
-	dvp.dp_fds = manager->events;
-	dvp.dp_nfds = manager->nevents;
+	dvp.dp_fds = thread->events;
+	dvp.dp_nfds = thread->nevents;
 	if (tvp != NULL) {
 		dvp.dp_timeout = tvp->tv_sec * 1000 +
 			(tvp->tv_usec + 999) / 1000;
 	} else
 		dvp.dp_timeout = -1;
-	swait_private.nevents = ioctl(manager->devpoll_fd, DP_POLL, &dvp);
+	swait_private.nevents = ioctl(thread->devpoll_fd, DP_POLL, &dvp);
 	n = swait_private.nevents;
 #elif defined(USE_SELECT)
 	memmove(manager->read_fds_copy, manager->read_fds, manager->fd_bufsize);
@@ -6232,10 +6758,12 @@ isc__socketmgr_dispatch(isc_socketmgr_t *manager0, isc_socketwait_t *swait) {
 		return (ISC_R_NOTFOUND);
 
 #if defined(USE_KQUEUE) || defined(USE_EPOLL) || defined(USE_DEVPOLL)
-	(void)process_fds(manager, manager->events, swait->nevents);
+	(void)process_fds(&manager->threads[0], manager->threads[0].events,
+			  swait->nevents);
 	return (ISC_R_SUCCESS);
 #elif defined(USE_SELECT)
-	process_fds(manager, swait->maxfd, swait->readset, swait->writeset);
+	process_fds(&manager->threads[0], swait->maxfd, swait->readset,
+		    swait->writeset);
 	return (ISC_R_SUCCESS);
 #endif
 }
@@ -20,6 +20,7 @@
 #include <windows.h>
 
 #include <isc/os.h>
+#include <isc/util.h>
 
 static BOOL bInit = FALSE;
 static SYSTEM_INFO SystemInfo;
@@ -43,3 +44,17 @@ isc_os_ncpus(void) {
 
 	return ((unsigned int)ncpus);
 }
+
+int
+isc_os_cpunode(int cpu) {
+	UNUSED(cpu);
+
+	return (-1);
+}
+
+int
+isc_os_ifnode(const char *ifname) {
+	UNUSED(ifname);
+
+	return (-1);
+}
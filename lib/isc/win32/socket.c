@@ -2634,18 +2634,23 @@ SocketIoThread(LPVOID ThreadContext) {
  */
 isc_result_t
 isc__socketmgr_create(isc_mem_t *mctx, isc_socketmgr_t **managerp) {
-	return (isc_socketmgr_create2(mctx, managerp, 0));
+	return (isc_socketmgr_create2(mctx, managerp, 0, 1));
 }
 
 isc_result_t
 isc__socketmgr_create2(isc_mem_t *mctx, isc_socketmgr_t **managerp,
-		       unsigned int maxsocks)
+		       unsigned int maxsocks, unsigned int nthreads)
 {
 	isc_socketmgr_t *manager;
 	isc_result_t result;
 
 	REQUIRE(managerp != NULL && *managerp == NULL);
 
+	/*
+	 * The completion port threads are sized by the system.
+	 */
+	UNUSED(nthreads);
+
 	if (maxsocks != 0)
 		return (ISC_R_NOTIMPLEMENTED);
 
@@ -3254,6 +3259,11 @@ isc__socket_bind(isc_socket_t *sock, isc_sockaddr_t *sockaddr,
 						ISC_MSG_FAILED, "failed"));
 		/* Press on... */
 	}
+	if ((options & ISC_SOCKET_REUSEPORT) != 0 &&
+	    isc_sockaddr_getport(sockaddr) != (in_port_t)0) {
+		UNLOCK(&sock->lock);
+		return (ISC_R_NOTIMPLEMENTED);
+	}
 	if (bind(sock->fd, &sockaddr->type.sa, sockaddr->length) < 0) {
 		bind_errno = WSAGetLastError();
 		UNLOCK(&sock->lock);
@@ -3933,6 +3943,17 @@ isc___socketmgr_maxudp(isc_socketmgr_t *manager, int maxudp) {
 	UNUSED(maxudp);
 }
 
+isc_result_t
+isc_socketmgr_setaffinity(isc_socketmgr_t *manager, const int *cpus,
+			  unsigned int ncpus)
+{
+	UNUSED(manager);
+	UNUSED(cpus);
+	UNUSED(ncpus);
+
+	return (ISC_R_NOTIMPLEMENTED);
+}
+
 isc_socketevent_t *
 isc_socket_socketevent(isc_mem_t *mctx, void *sender,
 		       isc_eventtype_t eventtype, isc_taskaction_t action,
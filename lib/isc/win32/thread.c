@@ -67,6 +67,23 @@ isc_thread_setconcurrency(unsigned int level) {
 	 */
 }
 
+isc_result_t
+isc_thread_setaffinity(isc_thread_t thread, int cpu) {
+	DWORD_PTR mask, sysmask;
+
+	if (cpu < -1 || cpu >= (int)(sizeof(DWORD_PTR) * 8))
+		return (ISC_R_RANGE);
+	if (cpu == -1) {
+		if (!GetProcessAffinityMask(GetCurrentProcess(),
+					    &mask, &sysmask))
+			return (ISC_R_UNEXPECTED);
+	} else
+		mask = (DWORD_PTR)1 << cpu;
+	if (SetThreadAffinityMask(thread, mask) == 0)
+		return (ISC_R_RANGE);
+	return (ISC_R_SUCCESS);
+}
+
 void *
 isc_thread_key_getspecific(isc_thread_key_t key) {
 	return(TlsGetValue(key));
@@ -554,6 +554,12 @@ static cfg_type_t cfg_type_checkmode = {
 	&cfg_rep_string, &checkmode_enums
 };
 
+static const char *asyncoverflow_enums[] = { "drop", "block", NULL };
+static cfg_type_t cfg_type_asyncoverflow = {
+	"asyncoverflow", cfg_parse_enum, cfg_print_ustring, cfg_doc_enum,
+	&cfg_rep_string, &asyncoverflow_enums
+};
+
 static const char *warn_enums[] = { "warn", "ignore", NULL };
 static cfg_type_t cfg_type_warn = {
 	"warn", cfg_parse_enum, cfg_print_ustring, cfg_doc_enum,
@@ -583,6 +589,12 @@ static cfg_type_t cfg_type_bracketed_sockaddrlist = {
 	&cfg_type_sockaddr
 };
 
+static cfg_type_t cfg_type_bracketed_uint32list = {
+	"bracketed_uint32list", cfg_parse_bracketed_list,
+	cfg_print_bracketed_list, cfg_doc_bracketed_list, &cfg_rep_list,
+	&cfg_type_uint32
+};
+
 static const char *autodnssec_enums[] = { "allow", "maintain", "off", NULL };
 static cfg_type_t cfg_type_autodnssec = {
 	"autodnssec", cfg_parse_enum, cfg_print_ustring, cfg_doc_enum,
@@ -964,6 +976,8 @@ options_clauses[] = {
 	{ "bindkeys-file", &cfg_type_qstring, 0 },
 	{ "blackhole", &cfg_type_bracketed_aml, 0 },
 	{ "coresize", &cfg_type_size, 0 },
+	{ "cpu-affinity", &cfg_type_bracketed_uint32list, 0 },
+	{ "dampening-early-drop", &cfg_type_boolean, 0 },
 	{ "datasize", &cfg_type_size, 0 },
 	{ "session-keyfile", &cfg_type_qstringornone, 0 },
 	{ "session-keyname", &cfg_type_astring, 0 },
@@ -986,6 +1000,7 @@ options_clauses[] = {
 	{ "host-statistics", &cfg_type_boolean, CFG_CLAUSEFLAG_NOTIMP },
 	{ "host-statistics-max", &cfg_type_uint32, CFG_CLAUSEFLAG_NOTIMP },
 	{ "hostname", &cfg_type_qstringornone, 0 },
+	{ "huge-pages", &cfg_type_boolean, 0 },
 	{ "interface-interval", &cfg_type_uint32, 0 },
 	{ "listen-on", &cfg_type_listenon, CFG_CLAUSEFLAG_MULTI },
 	{ "listen-on-v6", &cfg_type_listenon, CFG_CLAUSEFLAG_MULTI },
@@ -1008,6 +1023,7 @@ options_clauses[] = {
 	{ "random-device", &cfg_type_qstring, 0 },
 	{ "recursive-clients", &cfg_type_uint32, 0 },
 	{ "reserved-sockets", &cfg_type_uint32, 0 },
+	{ "reuseport", &cfg_type_boolean, 0 },
 	{ "secroots-file", &cfg_type_qstring, 0 },
 	{ "serial-queries", &cfg_type_uint32, CFG_CLAUSEFLAG_OBSOLETE },
 	{ "serial-query-rate", &cfg_type_uint32, 0 },
@@ -1025,6 +1041,7 @@ options_clauses[] = {
 	{ "transfers-in", &cfg_type_uint32, 0 },
 	{ "transfers-out", &cfg_type_uint32, 0 },
 	{ "treat-cr-as-space", &cfg_type_boolean, CFG_CLAUSEFLAG_OBSOLETE },
+	{ "udp-receive-batch", &cfg_type_uint32, 0 },
 	{ "use-id-pool", &cfg_type_boolean, CFG_CLAUSEFLAG_OBSOLETE },
 	{ "use-ixfr", &cfg_type_boolean, 0 },
 	{ "use-v4-udp-ports", &cfg_type_bracketed_portlist, 0 },
@@ -1362,6 +1379,7 @@ static cfg_clausedef_t rrl_clauses[] = {
 	{ "exempt-clients", &cfg_type_bracketed_aml, 0 },
 	{ "max-table-size", &cfg_type_uint32, 0 },
 	{ "min-table-size", &cfg_type_uint32, 0 },
+	{ "table-shards", &cfg_type_uint32, 0 },
 	{ NULL, NULL, 0 }
 };
 
@@ -1381,9 +1399,36 @@ static cfg_type_t cfg_type_rrl = {
  * dampening
  */
 
+static const char *dampening_storage_enums[] = { "queue", "sketch", "all", NULL };
+static cfg_type_t cfg_type_dampening_storage = {
+     "storage", cfg_parse_enum, cfg_print_ustring, cfg_doc_enum,
+     &cfg_rep_string, &dampening_storage_enums
+};
+
+static cfg_clausedef_t dampening_aggregate_clauses[] = {
+     { "IPv4-prefix-length", &cfg_type_uint32, 0 },
+     { "IPv6-prefix-length", &cfg_type_uint32, 0 },
+     { "limit-enable-dampening", &cfg_type_uint32, 0 },
+     { "limit-disable-dampening", &cfg_type_uint32, 0 },
+     { NULL, NULL, 0 }
+};
+
+static cfg_clausedef_t * dampening_aggregate_clauseset[] = {
+     dampening_aggregate_clauses,
+     NULL
+};
+
+static cfg_type_t cfg_type_dampening_aggregate = {
+   "aggregate", cfg_parse_map, cfg_print_map, cfg_doc_map,
+     &cfg_rep_map, dampening_aggregate_clauseset
+};
+
 static cfg_clausedef_t dampening_clauses[] = {
      { "min-table-size", &cfg_type_uint32, 0 },
      { "max-table-size", &cfg_type_uint32, 0 },
+     { "table-shards", &cfg_type_uint32, 0 },
+     { "shared-table", &cfg_type_boolean, 0 },
+     { "storage", &cfg_type_dampening_storage, 0 },
      { "halflife", &cfg_type_uint32, 0 },
      { "update-delay", &cfg_type_uint32, 0 },
      { "limit-maximum", &cfg_type_uint32, 0 },
@@ -1399,7 +1444,10 @@ static cfg_clausedef_t dampening_clauses[] = {
      { "score-duplicates", &cfg_type_uint32, 0 },
      { "IPv4-prefix-length", &cfg_type_uint32, 0 },
      { "IPv6-prefix-length", &cfg_type_uint32, 0 },
+     { "aggregate", &cfg_type_dampening_aggregate, CFG_CLAUSEFLAG_MULTI },
      { "report-interval", &cfg_type_uint32, 0 },
+     { "report-timing", &cfg_type_boolean, 0 },
+     { "snapshot", &cfg_type_boolean, 0 },
      { "exempt-clients", &cfg_type_bracketed_aml, 0 },
      { NULL, NULL, 0 }
 };
@@ -1925,6 +1973,8 @@ channel_clauses[] = {
 	{ "null", &cfg_type_void, 0 },
 	{ "stderr", &cfg_type_void, 0 },
 	/* Options.  We now accept these for the null channel, too. */
+	{ "async", &cfg_type_boolean, 0 },
+	{ "async-overflow", &cfg_type_asyncoverflow, 0 },
 	{ "severity", &cfg_type_logseverity, 0 },
 	{ "print-time", &cfg_type_boolean, 0 },
 	{ "print-severity", &cfg_type_boolean, 0 },